@@ -540,6 +540,10 @@ VPATH += $(KEYBOARD_PATHS)
 VPATH += $(COMMON_VPATH)
 VPATH += $(INTERMEDIATE_OUTPUT)/src
 
+include $(BUILDDEFS_PATH)/keymap_dce.mk
+include $(BUILDDEFS_PATH)/nkro_compact.mk
+include $(BUILDDEFS_PATH)/introspection_counts.mk
+include $(BUILDDEFS_PATH)/sparse_keymap.mk
 include $(BUILDDEFS_PATH)/common_features.mk
 include $(BUILDDEFS_PATH)/generic_features.mk
 include $(TMK_PATH)/protocol.mk
@@ -593,6 +597,11 @@ check-size: build
 check-md5: build
 objs-size: build
 
+# Static per-event dispatch cost estimate for the resolved keymap and enabled
+# features; no compile needed. See util/dispatch_cost_report.py.
+dispatch-report:
+	python3 $(TOP_DIR)/util/dispatch_cost_report.py $(OPT_DEFS) $(CONFIG_H) $(POST_CONFIG_H) $(wildcard $(KEYMAP_C)) $(wildcard $(KEYMAP_PATH)/*.c)
+
 ifneq ($(strip $(TOP_SYMBOLS)),)
 ifeq ($(strip $(TOP_SYMBOLS)),yes)
 NUM_TOP_SYMBOLS := 10
@@ -612,6 +621,7 @@ top-symbols: build
 endif
 
 include $(BUILDDEFS_PATH)/show_options.mk
+include $(BUILDDEFS_PATH)/sram_report.mk
 include $(BUILDDEFS_PATH)/common_rules.mk
 
 # Ensure we have generated files available for each of the objects
@@ -0,0 +1,139 @@
+# Host-side replay simulator build.
+#
+# Compiles the target keyboard's keymap plus the quantum event pipeline (layers, tap
+# dances, combos, caps word, ...) into a native binary, using the test platform for
+# the simulated clock and eeprom and the shared virtual matrix from tests/test_common.
+# The resulting binary replays recorded event traces at far beyond real time; see
+# sim/replay/replay_main.c for the trace format and the cycle-cost model.
+#
+# Usage, from the repository root:
+#
+#     make <keyboard>:<keymap>                          # once; generates info_config.h et al.
+#     make replay-sim KEYBOARD=<keyboard> KEYMAP=<keymap>
+#     .build/replay_sim/replay_sim_<keyboard>_<keymap>.elf sim/replay/sample_trace.txt 1000
+#
+# Hardware-bound features from the keyboard's configuration are forced off below: the
+# simulator exercises keymap-level logic, not drivers. Keymap code that touches
+# hardware directly should be guarded with `#ifndef QMK_REPLAY_SIM`.
+
+ifndef VERBOSE
+.SILENT:
+endif
+
+.DEFAULT_GOAL := all
+
+OPT = 2
+
+include paths.mk
+include $(BUILDDEFS_PATH)/support.mk
+include $(BUILDDEFS_PATH)/message.mk
+
+KEYMAP ?= default
+ifeq ($(strip $(KEYBOARD)),)
+    $(call CATASTROPHIC_ERROR,Invalid usage,Usage: make replay-sim KEYBOARD=<keyboard> KEYMAP=<keymap>)
+endif
+
+KEYBOARD_FILESAFE := $(subst /,_,$(KEYBOARD))
+SIM_OUTPUT := replay_sim_$(KEYBOARD_FILESAFE)_$(KEYMAP)
+SIM_OBJ := $(BUILD_DIR)/replay_sim_obj
+
+TARGET = replay_sim/$(SIM_OUTPUT)
+
+OUTPUTS := $(SIM_OBJ)/$(SIM_OUTPUT)
+
+LDFLAGS += -lpthread
+CREATE_MAP := no
+
+all: elf
+
+PLATFORM := TEST
+PLATFORM_KEY := test
+BOOTLOADER_TYPE := none
+
+MAIN_KEYMAP_PATH := keyboards/$(KEYBOARD)/keymaps/$(KEYMAP)
+ifeq ($(wildcard $(MAIN_KEYMAP_PATH)/keymap.c),)
+    $(call CATASTROPHIC_ERROR,Invalid keymap,No keymap.c at $(MAIN_KEYMAP_PATH))
+endif
+
+# Generated headers (info_config.h, default_keyboard.h, the rules.mk derived from
+# info.json) are reused from a prior firmware build of the same keyboard and keymap.
+INTERMEDIATE_OUTPUT := $(BUILD_DIR)/obj_$(KEYBOARD_FILESAFE)_$(KEYMAP)
+ifeq ($(wildcard $(INTERMEDIATE_OUTPUT)/src/info_config.h),)
+    $(call CATASTROPHIC_ERROR,Missing generated files,Build the firmware once first: make $(KEYBOARD):$(KEYMAP))
+endif
+
+# Pick up the feature set the keymap was written against. Parent-folder rules.mk files
+# of nested keyboards are not consulted; leaf plus keymap covers the temanyl boards.
+-include $(INTERMEDIATE_OUTPUT)/src/rules.mk
+-include keyboards/$(KEYBOARD)/rules.mk
+-include $(MAIN_KEYMAP_PATH)/rules.mk
+
+# Force off everything that drives hardware; the virtual matrix replaces scanning.
+CUSTOM_MATRIX := yes
+SPLIT_KEYBOARD := no
+QUANTUM_PAINTER_ENABLE := no
+RGB_MATRIX_ENABLE := no
+RGBLIGHT_ENABLE := no
+LED_MATRIX_ENABLE := no
+BACKLIGHT_ENABLE := no
+AUDIO_ENABLE := no
+HAPTIC_ENABLE := no
+OLED_ENABLE := no
+ENCODER_ENABLE := no
+POINTING_DEVICE_ENABLE := no
+BLUETOOTH_ENABLE := no
+RAW_ENABLE := no
+CONSOLE_ENABLE := no
+VIRTSER_ENABLE := no
+BENCHMARK_ENABLE := no
+CPU_PROFILER_ENABLE := no
+RP2040_CORE1_EXECUTOR := no
+RP2040_MATRIX_PIO := no
+KEYMAP_DEAD_CODE_ELIMINATION := no
+DEBOUNCE_TYPE := sym_defer_g
+
+include $(BUILDDEFS_PATH)/common_features.mk
+include $(BUILDDEFS_PATH)/generic_features.mk
+include $(PLATFORM_PATH)/common.mk
+include $(TMK_PATH)/protocol.mk
+include $(QUANTUM_PATH)/logging/print.mk
+
+VPATH += \
+	$(COMMON_VPATH) \
+	$(MAIN_KEYMAP_PATH) \
+	sim/replay \
+	tests/test_common
+
+$(SIM_OUTPUT)_SRC := \
+	$(QUANTUM_SRC) \
+	$(SRC) \
+	$(QUANTUM_PATH)/keymap_introspection.c \
+	$(QUANTUM_PATH)/logging/print.c \
+	tests/test_common/matrix.c \
+	sim/replay/replay_main.c
+
+$(SIM_OUTPUT)_DEFS := $(OPT_DEFS) \
+	-DQMK_REPLAY_SIM \
+	"-DKEYMAP_C=\"keymap.c\"" \
+	-DQMK_KEYBOARD=\"$(KEYBOARD)\" \
+	-DQMK_KEYBOARD_H=\"$(INTERMEDIATE_OUTPUT)/src/default_keyboard.h\"
+
+# The keymap's own config (tapping terms, combo tuning, ...) applies; the keyboard's
+# hardware config headers do not -- see sim/replay/config.h.
+ifneq ($(wildcard $(MAIN_KEYMAP_PATH)/config.h),)
+    $(SIM_OUTPUT)_DEFS += -include $(MAIN_KEYMAP_PATH)/config.h
+endif
+
+$(SIM_OUTPUT)_INC := $(VPATH) $(INTERMEDIATE_OUTPUT)/src
+$(SIM_OUTPUT)_CONFIG := sim/replay/config.h
+
+$(SIM_OBJ)/$(SIM_OUTPUT)_SRC := $($(SIM_OUTPUT)_SRC)
+$(SIM_OBJ)/$(SIM_OUTPUT)_INC := $($(SIM_OUTPUT)_INC)
+$(SIM_OBJ)/$(SIM_OUTPUT)_DEFS := $($(SIM_OUTPUT)_DEFS)
+$(SIM_OBJ)/$(SIM_OUTPUT)_CONFIG := $($(SIM_OUTPUT)_CONFIG)
+
+include $(PLATFORM_PATH)/$(PLATFORM_KEY)/platform.mk
+include $(BUILDDEFS_PATH)/common_rules.mk
+
+$(shell mkdir -p $(BUILD_DIR)/replay_sim 2>/dev/null)
+$(shell mkdir -p $(SIM_OBJ) 2>/dev/null)
@@ -21,6 +21,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/action_layer.c \
     $(QUANTUM_DIR)/action_tapping.c \
     $(QUANTUM_DIR)/action_util.c \
+    $(QUANTUM_DIR)/key_wait_buffer.c \
     $(QUANTUM_DIR)/eeconfig.c \
     $(QUANTUM_DIR)/keyboard.c \
     $(QUANTUM_DIR)/keymap_common.c \
@@ -42,6 +43,13 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(BINLOG_ENABLE)), yes)
+    # Deferred-format binary logging; records drain over the console endpoint
+    OPT_DEFS += -DBINLOG_ENABLE
+    SRC += $(QUANTUM_DIR)/logging/binlog.c
+    CONSOLE_ENABLE = yes
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -293,6 +301,10 @@ ifneq ($(strip $(FLASH_DRIVER)), none)
             SRC += flash_spi.c
             SPI_DRIVER_REQUIRED = yes
         endif
+        ifeq ($(strip $(FLASH_CACHE_ENABLE)), yes)
+            OPT_DEFS += -DFLASH_CACHE_ENABLE
+            SRC += flash_cache.c
+        endif
     endif
 endif
 
@@ -640,6 +652,12 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(RAW_HID_CHANNELS_ENABLE)), yes)
+    RAW_ENABLE := yes
+    OPT_DEFS += -DRAW_HID_CHANNELS_ENABLE
+    SRC += raw_hid_channels.c
+endif
+
 ifeq ($(strip $(RAW_ENABLE)), yes)
     OPT_DEFS += -DRAW_ENABLE
     SRC += raw_hid.c
@@ -689,6 +707,16 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Include files used by all split keyboards
     QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_util.c
 
+    ifeq ($(strip $(SPLIT_UI_STREAM_ENABLE)), yes)
+        OPT_DEFS += -DSPLIT_UI_STREAM_ENABLE
+        QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_ui_stream.c
+    endif
+
+    ifeq ($(strip $(SPLIT_LINK_MONITOR_ENABLE)), yes)
+        OPT_DEFS += -DSPLIT_LINK_MONITOR_ENABLE
+        QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_link_monitor.c
+    endif
+
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
@@ -821,6 +849,11 @@ ifeq ($(strip $(UNICODE_COMMON)), yes)
            $(QUANTUM_DIR)/unicode/utf8.c
 endif
 
+# Shared word-boundary tracker, pulled in by any word-aware feature
+ifneq ($(strip $(filter yes, $(CAPS_WORD_ENABLE) $(AUTOCORRECT_ENABLE))),)
+    QUANTUM_SRC += $(QUANTUM_DIR)/word_boundary.c
+endif
+
 ifeq ($(strip $(PS2_MOUSE_ENABLE)), yes)
     PS2_ENABLE := yes
     MOUSE_ENABLE := yes
@@ -937,12 +970,30 @@ ifeq ($(strip $(ENCODER_ENABLE)), yes)
     ifeq ($(strip $(ENCODER_MAP_ENABLE)), yes)
         OPT_DEFS += -DENCODER_MAP_ENABLE
     endif
+
+    ifeq ($(strip $(ENCODER_INTERRUPT_ENABLE)), yes)
+        ifneq ($(strip $(ENCODER_DRIVER)), quadrature)
+            $(call CATASTROPHIC_ERROR,Invalid ENCODER_DRIVER,ENCODER_INTERRUPT_ENABLE requires the quadrature encoder driver)
+        endif
+        OPT_DEFS += -DENCODER_INTERRUPT_ENABLE
+        GPIO_EVENT_REQUIRED := yes
+    endif
 endif
 
 ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     ifeq ($(strip $(DIP_SWITCH_MAP_ENABLE)), yes)
         OPT_DEFS += -DDIP_SWITCH_MAP_ENABLE
     endif
+
+    ifeq ($(strip $(DIP_SWITCH_INTERRUPT_ENABLE)), yes)
+        OPT_DEFS += -DDIP_SWITCH_INTERRUPT_ENABLE
+        GPIO_EVENT_REQUIRED := yes
+    endif
+endif
+
+# Shared GPIO edge-event service backing the interrupt-driven dip switch and encoder paths
+ifeq ($(strip $(GPIO_EVENT_REQUIRED)), yes)
+    QUANTUM_SRC += $(QUANTUM_DIR)/gpio_event.c
 endif
 
 ifeq ($(strip $(BATTERY_ENABLE)), yes)
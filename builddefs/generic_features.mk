@@ -19,14 +19,18 @@ SEND_STRING_ENABLE ?= yes
 SPACE_CADET_ENABLE ?= yes
 
 GENERIC_FEATURES = \
+    ATOMIC_PROFILER \
     AUTO_SHIFT \
     AUTOCORRECT \
     BATTERY \
+    BENCHMARK \
     BOOTMAGIC \
     CAPS_WORD \
     COMBO \
     COMMAND \
     CONNECTION \
+    CPU_PROFILER \
+    CPU_STATS \
     CRC \
     DEFERRED_EXEC \
     DIGITIZER \
@@ -34,11 +38,16 @@ GENERIC_FEATURES = \
     DYNAMIC_KEYMAP \
     DYNAMIC_MACRO \
     DYNAMIC_TAPPING_TERM \
+    EXPERIMENT \
     GRAVE_ESC \
     HAPTIC \
+    HOST_METRICS \
+    HOUSEKEEPING_SCHEDULER \
     KEYCODE_STRING \
+    KEY_LATENCY \
     KEY_LOCK \
     KEY_OVERRIDE \
+    KEY_STATS \
     LAYER_LOCK \
     LEADER \
     MAGIC \
@@ -0,0 +1,45 @@
+# Copyright 2024 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Compile-time introspection counts.
+#
+# keymap_layer_count(), combo_count() and tap_dance_count() answer compile-time-constant questions
+# through out-of-line function calls, so their callers carry calls and guard branches the compiler
+# could otherwise fold away. With KEYMAP_INTROSPECTION_CONSTANTS enabled, the resolved keymap
+# sources are scanned for the introspection array initializers (util/introspection_counts.py) and
+# the counts are injected as defines; keymap_introspection.h then provides static inline accessors
+# returning the literals, and static asserts in keymap_introspection.c fail the build if a scanned
+# count ever drifts from the real ARRAY_SIZE().
+#
+# The constants pin the counts at build time, so this must not be combined with features that
+# resize them at runtime (DYNAMIC_KEYMAP_ENABLE, or overriding the accessors); those combinations
+# are rejected in quantum/keymap_introspection.c. Keymaps generated from keymap.json are left
+# alone, as their sources may not exist yet when this runs.
+
+ifeq ($(strip $(KEYMAP_INTROSPECTION_CONSTANTS)), yes)
+    INTROSPECTION_COUNT_SOURCES := $(wildcard $(KEYMAP_C)) $(wildcard $(KEYMAP_PATH)/*.c)
+
+    # A userspace can hold introspected arrays (e.g. tap_dance_actions) in a file it
+    # feeds into the introspection TU via INTROSPECTION_KEYMAP_C; scan that file too
+    INTROSPECTION_COUNT_SOURCES += $(wildcard $(INTROSPECTION_KEYMAP_C)) $(wildcard $(addprefix $(USER_PATH)/,$(INTROSPECTION_KEYMAP_C)))
+
+    ifneq ($(INTROSPECTION_COUNT_SOURCES),)
+        INTROSPECTION_COUNT_DEFS := $(shell python3 $(TOP_DIR)/util/introspection_counts.py $(INTROSPECTION_COUNT_SOURCES) 2>/dev/null)
+
+        ifneq ($(INTROSPECTION_COUNT_DEFS),)
+            OPT_DEFS += $(INTROSPECTION_COUNT_DEFS)
+        endif
+    endif
+endif
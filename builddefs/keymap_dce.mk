@@ -0,0 +1,56 @@
+# Copyright 2024 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Keymap-driven dead code elimination.
+#
+# The default-enabled features below are purely keycode-triggered: their process hooks sit in the
+# per-event dispatch chain but can never fire unless the keymap actually places one of their
+# keycodes on a layer. When KEYMAP_DEAD_CODE_ELIMINATION is enabled, the resolved keymap sources
+# are scanned for each feature's trigger keycodes and the feature is compiled out entirely when
+# none are present -- shrinking the hot loop rather than linking unreachable handlers.
+#
+# An explicit <FEATURE>_ENABLE from any rules.mk always wins over the scan; only the `?= yes`
+# defaults in generic_features.mk are overridden. Keymaps generated from keymap.json are left
+# alone, as their sources may not exist yet when this runs.
+
+ifeq ($(strip $(KEYMAP_DEAD_CODE_ELIMINATION)), yes)
+    # Userspace sources count too: shared process_record/tap dance code can reference
+    # keycodes that never appear in the keymap itself
+    KEYMAP_DCE_SOURCES := $(wildcard $(KEYMAP_C)) $(wildcard $(KEYMAP_PATH)/*.c) $(wildcard $(KEYMAP_PATH)/*.h) $(wildcard $(USER_PATH)/*.c) $(wildcard $(USER_PATH)/*.h)
+
+    ifneq ($(KEYMAP_DCE_SOURCES),)
+        KEYMAP_DCE_GRAVE_ESC_KEYCODES := QK_GESC|QK_GRAVE_ESCAPE
+        KEYMAP_DCE_SPACE_CADET_KEYCODES := QK_SPACE_CADET|SC_LCPO|SC_RCPC|SC_LSPO|SC_RSPC|SC_LAPO|SC_RAPC|SC_SENT
+        KEYMAP_DCE_MAGIC_KEYCODES := QK_MAGIC|CL_SWAP|CL_NORM|CL_TOGG|CL_CAPS|CL_CTRL|AG_LSWP|AG_LNRM|AG_RSWP|AG_RNRM|GU_ON|GU_OFF|GU_TOGG|GE_SWAP|GE_NORM|BS_SWAP|BS_NORM|BS_TOGG|NK_ON|NK_OFF|NK_TOGG|AG_SWAP|AG_NORM|AG_TOGG|CG_LSWP|CG_LNRM|CG_RSWP|CG_RNRM|CG_SWAP|CG_NORM|CG_TOGG|EH_LEFT|EH_RGHT|EC_SWAP|EC_NORM|EC_TOGG
+
+        ifeq ($(origin GRAVE_ESC_ENABLE), undefined)
+            ifeq ($(shell grep -l -w -E '$(KEYMAP_DCE_GRAVE_ESC_KEYCODES)' $(KEYMAP_DCE_SOURCES) 2>/dev/null),)
+                GRAVE_ESC_ENABLE := no
+            endif
+        endif
+
+        ifeq ($(origin SPACE_CADET_ENABLE), undefined)
+            ifeq ($(shell grep -l -w -E '$(KEYMAP_DCE_SPACE_CADET_KEYCODES)' $(KEYMAP_DCE_SOURCES) 2>/dev/null),)
+                SPACE_CADET_ENABLE := no
+            endif
+        endif
+
+        ifeq ($(origin MAGIC_ENABLE), undefined)
+            ifeq ($(shell grep -l -w -E '$(KEYMAP_DCE_MAGIC_KEYCODES)' $(KEYMAP_DCE_SOURCES) 2>/dev/null),)
+                MAGIC_ENABLE := no
+            endif
+        endif
+    endif
+endif
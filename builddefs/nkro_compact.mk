@@ -0,0 +1,44 @@
+# Copyright 2024 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Keymap-driven NKRO report sizing.
+#
+# The NKRO input report carries a fixed 30-byte key bitmap covering usages 0x00-0xEF, padded the
+# same no matter how few of those usages a board can ever send. With NKRO_COMPACT_REPORT enabled,
+# the resolved keymap sources are scanned for the basic keycodes they actually reference and the
+# bitmap is sized to the highest one found (util/nkro_report_bits.py, floor of 13 bytes so
+# SEND_STRING() and macro output always fit) -- shrinking every NKRO transfer on the wire and the
+# report descriptor parsed at enumeration.
+#
+# Boards that synthesize high keycodes at runtime outside their keymap sources should define
+# NKRO_REPORT_BITS in config.h themselves instead of enabling this scan; the two must not be
+# combined. Keymaps generated from keymap.json are left alone, as their sources may not exist
+# yet when this runs.
+
+ifeq ($(strip $(NKRO_COMPACT_REPORT)), yes)
+    ifeq ($(strip $(NKRO_ENABLE)), yes)
+        # Userspace sources count too: shared process_record code can send keycodes
+        # (e.g. KC_DEL from shift+backspace) that never appear in the keymap itself
+        NKRO_COMPACT_SOURCES := $(wildcard $(KEYMAP_C)) $(wildcard $(KEYMAP_PATH)/*.c) $(wildcard $(KEYMAP_PATH)/*.h) $(wildcard $(USER_PATH)/*.c) $(wildcard $(USER_PATH)/*.h)
+
+        ifneq ($(NKRO_COMPACT_SOURCES),)
+            NKRO_COMPACT_BITS := $(shell python3 $(TOP_DIR)/util/nkro_report_bits.py $(TOP_DIR)/data/constants/keycodes/keycodes_0.0.1_basic.hjson $(NKRO_COMPACT_SOURCES) 2>/dev/null)
+
+            ifneq ($(NKRO_COMPACT_BITS),)
+                OPT_DEFS += -DNKRO_REPORT_BITS=$(NKRO_COMPACT_BITS)
+            endif
+        endif
+    endif
+endif
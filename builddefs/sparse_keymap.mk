@@ -0,0 +1,46 @@
+# Copyright 2024 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Sparse keymap storage.
+#
+# keymaps[] stores a dense MATRIX_ROWS x MATRIX_COLS keycode matrix per layer, so keymaps with
+# many mostly-transparent layers pay two bytes of flash for every KC_TRNS. With KEYMAP_SPARSE
+# enabled, the resolved keymap source is re-expanded at build time (util/sparse_keymap.py,
+# using the layout definitions from the keyboard's json) into a column bitmap per layer-row
+# plus a packed array of only the stored keycodes; quantum/keymap_introspection.c then resolves
+# locations with a bitmap test and a popcount index instead of a dense read, and the dense
+# keymaps[] -- now unreferenced -- is discarded by the linker's --gc-sections.
+#
+# Break-even: the row table costs 4 bytes per layer-row, so a layer row starts saving flash
+# once more than two of its keys are transparent. Fully-populated keymaps (like the ones in
+# this tree today) gain nothing; the feature is for the base-layer-plus-many-thin-layers shape.
+# Matrix positions with no physical key read back as KC_TRNS instead of the dense path's KC_NO;
+# no event can originate there, so nothing observes the difference. Requires a static keymap
+# (DYNAMIC_KEYMAP_ENABLE is rejected in quantum/keymap_introspection.c) and MATRIX_COLS <= 16.
+# If the generator cannot parse the keymap it emits nothing and the build silently falls back
+# to the dense path. Keymaps generated from keymap.json are left alone, as their sources may
+# not exist yet when this runs.
+
+ifeq ($(strip $(KEYMAP_SPARSE)), yes)
+    SPARSE_KEYMAP_SOURCES := $(wildcard $(KEYMAP_C)) $(wildcard $(KEYMAP_PATH)/*.c)
+
+    ifneq ($(SPARSE_KEYMAP_SOURCES),)
+        SPARSE_KEYMAP_DEFS := $(shell python3 $(TOP_DIR)/util/sparse_keymap.py $(INTERMEDIATE_OUTPUT)/src/sparse_keymap.h $(SPARSE_KEYMAP_SOURCES) $(DD_CONFIG_FILES) 2>/dev/null)
+
+        ifneq ($(SPARSE_KEYMAP_DEFS),)
+            OPT_DEFS += $(SPARSE_KEYMAP_DEFS)
+        endif
+    endif
+endif
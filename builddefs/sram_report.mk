@@ -0,0 +1,26 @@
+# Per-subsystem static RAM report and budget enforcement, derived from the
+# linker map file after each link.
+#
+# Enable the report with:
+#     SRAM_REPORT = yes
+#
+# Budgets are declared per subsystem (as classified by util/sram_report.py:
+# painter, framebuffer-heavy keymap code under "keymap", audio, rgb_matrix,
+# chibios, ...) and fail the build when the linked firmware exceeds them:
+#     SRAM_BUDGETS += painter=16384 keymap=70000
+#
+# Add SRAM_REPORT_VERBOSE = yes to list per-object contributions.
+
+ifeq ($(strip $(SRAM_REPORT)), yes)
+
+SRAM_REPORT_FLAGS := $(patsubst %,--budget %,$(strip $(SRAM_BUDGETS)))
+ifeq ($(strip $(SRAM_REPORT_VERBOSE)), yes)
+    SRAM_REPORT_FLAGS += --verbose
+endif
+
+all: sram-report
+check-size: sram-report
+sram-report: build
+	python3 util/sram_report.py $(BUILD_DIR)/$(TARGET).map $(SRAM_REPORT_FLAGS)
+
+endif
@@ -26,4 +26,11 @@ void battery_driver_init(void);
  */
 uint8_t battery_driver_sample_percent(void);
 
+/**
+ * \brief Sample the battery voltage. Required by the adaptive sampling engine (`BATTERY_ADAPTIVE_SAMPLING`).
+ *
+ * \return The battery voltage, in millivolts.
+ */
+uint16_t battery_driver_get_mv(void);
+
 /** \} */
@@ -83,3 +83,13 @@ void eeprom_driver_format(bool erase) {
     (void)erase; /* The default implementation assumes that the eeprom must be erased in order to be usable. */
     eeprom_driver_erase();
 }
+
+void eeprom_driver_transaction_begin(void) __attribute__((weak));
+void eeprom_driver_transaction_begin(void) {
+    /* The default implementation writes through immediately, so there is nothing to stage. */
+}
+
+void eeprom_driver_transaction_commit(void) __attribute__((weak));
+void eeprom_driver_transaction_commit(void) {
+    /* The default implementation writes through immediately, so there is nothing to flush. */
+}
@@ -22,3 +22,10 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+/* Batched update transactions: updates performed between begin and commit may be staged by the
+ * driver and written to the backing store as one coalesced operation when the outermost commit is
+ * issued. Transactions nest; drivers without deferred writes treat both calls as no-ops and every
+ * update lands immediately as usual. */
+void eeprom_driver_transaction_begin(void);
+void eeprom_driver_transaction_commit(void);
@@ -27,3 +27,18 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+static uint8_t transaction_depth = 0;
+
+void eeprom_driver_transaction_begin(void) {
+    ++transaction_depth;
+}
+
+void eeprom_driver_transaction_commit(void) {
+    if (transaction_depth > 0 && --transaction_depth == 0) {
+        /* With write-behind enabled all writes since the outermost begin are still staged in the
+         * cache, so this commits them as one coalesced write log append. Without write-behind each
+         * write already hit the backing store and the flush is a no-op. */
+        wear_leveling_flush();
+    }
+}
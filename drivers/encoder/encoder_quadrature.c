@@ -27,6 +27,17 @@
 #    define ENCODER_DEFAULT_PIN_API_IMPL
 #endif
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+#    if !defined(ENCODER_DEFAULT_PIN_API_IMPL)
+#        error "ENCODER_INTERRUPT_ENABLE requires ENCODER_A_PINS and ENCODER_B_PINS."
+#    endif
+#    include "gpio_event.h"
+
+#    ifndef ENCODER_VELOCITY_TIMEOUT_MS
+#        define ENCODER_VELOCITY_TIMEOUT_MS 250
+#    endif
+#endif
+
 extern volatile bool isLeftHand;
 
 __attribute__((weak)) void    encoder_quadrature_init_pin(uint8_t index, bool pad_b);
@@ -74,6 +85,17 @@ static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1,
 static uint8_t encoder_state[NUM_ENCODERS]  = {0};
 static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+// Pin levels reconstructed from edge events (bit 0 = pad A, bit 1 = pad B), plus ISR-timestamped
+// detent intervals feeding the velocity estimate.
+static uint8_t  encoder_pin_levels[NUM_ENCODERS_MAX_PER_SIDE]      = {0};
+static uint16_t encoder_isr_velocity[NUM_ENCODERS_MAX_PER_SIDE]    = {0};
+static uint16_t encoder_isr_last_detent[NUM_ENCODERS_MAX_PER_SIDE] = {0};
+static bool     encoder_isr_has_detent[NUM_ENCODERS_MAX_PER_SIDE]  = {0};
+
+static void encoder_edge_handler(uint8_t slot, bool level, uint16_t time_ms, void *context);
+#endif
+
 // encoder counts
 static uint8_t thisCount;
 #ifdef SPLIT_KEYBOARD
@@ -99,6 +121,14 @@ void encoder_quadrature_post_init(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_state[i] = (encoder_quadrature_read_pin(i, false) << 0) | (encoder_quadrature_read_pin(i, true) << 1);
     }
+#    ifdef ENCODER_INTERRUPT_ENABLE
+    // Seed the reconstructed pin levels from the initial read, then hand the pads over to edge interrupts.
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_pin_levels[i] = encoder_state[i] & 0x3;
+        gpio_event_register(encoders_pad_a[i], (i << 1) | 0, encoder_edge_handler, NULL);
+        gpio_event_register(encoders_pad_b[i], (i << 1) | 1, encoder_edge_handler, NULL);
+    }
+#    endif
 #else
     memset(encoder_state, 0, sizeof(encoder_state));
 #endif
@@ -158,8 +188,10 @@ void encoder_driver_init(void) {
     encoder_quadrature_post_init();
 }
 
-static void encoder_handle_state_change(uint8_t index, uint8_t state) {
-    uint8_t i = index;
+// Returns true if the state change completed a detent and queued an encoder event.
+static bool encoder_handle_state_change(uint8_t index, uint8_t state) {
+    uint8_t i      = index;
+    bool    queued = false;
 
 #ifdef SPLIT_KEYBOARD
     index += thisHand;
@@ -181,6 +213,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
 #endif
 
             encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            queued = true;
         }
 
 #ifdef ENCODER_DEFAULT_POS
@@ -189,25 +222,92 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] <= -resolution) { // direction is arbitrary here, but this clockwise
 #endif
             encoder_queue_event(index, ENCODER_CLOCKWISE);
+            queued = true;
         }
         encoder_pulses[i] %= resolution;
 #ifdef ENCODER_DEFAULT_POS
         encoder_pulses[i] = 0;
     }
 #endif
+    return queued;
 }
 
-void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state) {
+static bool encoder_quadrature_process_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state) {
     uint8_t state = pin_a_state | (pin_b_state << 1);
     if ((encoder_state[index] & 0x3) != state) {
         encoder_state[index] <<= 2;
         encoder_state[index] |= state;
-        encoder_handle_state_change(index, encoder_state[index]);
+        return encoder_handle_state_change(index, encoder_state[index]);
+    }
+    return false;
+}
+
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state) {
+    encoder_quadrature_process_read(index, pin_a_state, pin_b_state);
+}
+
+#ifdef ENCODER_INTERRUPT_ENABLE
+
+static void encoder_edge_handler(uint8_t slot, bool level, uint16_t time_ms, void *context) {
+    uint8_t index = slot >> 1;
+    uint8_t mask  = 1 << (slot & 1);
+    if (level) {
+        encoder_pin_levels[index] |= mask;
+    } else {
+        encoder_pin_levels[index] &= ~mask;
+    }
+
+    // The Gray-code LUT zeroes out invalid transitions, which is all the debounce quadrature needs.
+    if (encoder_quadrature_process_read(index, encoder_pin_levels[index] & 1, (encoder_pin_levels[index] >> 1) & 1)) {
+        // A detent completed on this edge -- fold the ISR-precision detent interval into the velocity
+        // estimate, rather than quantising to scan granularity.
+        if (encoder_isr_has_detent[index]) {
+            uint16_t period = time_ms - encoder_isr_last_detent[index];
+            if (period > ENCODER_VELOCITY_TIMEOUT_MS) {
+                encoder_isr_velocity[index] = 0; // stale -- this detent starts a new spin
+            } else if (period > 0) {
+                uint16_t steps_per_sec = 1000U / period;
+                encoder_isr_velocity[index] += ((int32_t)steps_per_sec - (int32_t)encoder_isr_velocity[index]) >> 2;
+            }
+        }
+        encoder_isr_last_detent[index] = time_ms;
+        encoder_isr_has_detent[index]  = true;
+    }
+}
+
+bool encoder_interrupt_velocity(uint8_t index, uint16_t *velocity) {
+#    ifdef SPLIT_KEYBOARD
+    // Only encoders on this half are interrupt-driven; the other half's events arrive over the
+    // split link without edge timestamps.
+    if (index < thisHand || index >= thisHand + thisCount) {
+        return false;
     }
+    index -= thisHand;
+#    else
+    if (index >= thisCount) {
+        return false;
+    }
+#    endif
+
+    if (!encoder_isr_has_detent[index] || (uint16_t)(gpio_event_time() - encoder_isr_last_detent[index]) > ENCODER_VELOCITY_TIMEOUT_MS) {
+        *velocity = 0;
+    } else {
+        *velocity = encoder_isr_velocity[index];
+    }
+    return true;
 }
 
+void encoder_driver_task(void) {
+    // Edge interrupts have already captured any movement; just drain the shared queue.
+    gpio_event_drain();
+}
+
+#else // ENCODER_INTERRUPT_ENABLE
+
 __attribute__((weak)) void encoder_driver_task(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
 }
+
+#endif // ENCODER_INTERRUPT_ENABLE
@@ -121,6 +121,21 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len);
  */
 flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len);
 
+#ifdef FLASH_CACHE_ENABLE
+/**
+ * @brief Backend (uncached) implementations of the range and erase API.
+ *
+ * When the cache layer is enabled, flash_cache.c owns the public names above and the
+ * backend driver provides its implementations under these names instead; see
+ * flash_cache.h.
+ */
+flash_status_t flash_backend_read_range(uint32_t addr, void *buf, size_t len);
+flash_status_t flash_backend_write_range(uint32_t addr, const void *buf, size_t len);
+flash_status_t flash_backend_erase_chip(void);
+flash_status_t flash_backend_erase_block(uint32_t addr);
+flash_status_t flash_backend_erase_sector(uint32_t addr);
+#endif // FLASH_CACHE_ENABLE
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,158 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "flash_cache.h"
+
+static flash_cache_stats_t stats = {0};
+
+// Read-ahead window state (logic below the write-combining section).
+static uint8_t  read_buf[FLASH_CACHE_READ_BUFFER_SIZE];
+static uint32_t read_addr  = 0; // address of read_buf[0]
+static bool     read_valid = false;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Write combining
+
+static uint8_t  write_buf[FLASH_CACHE_WRITE_BUFFER_SIZE];
+static uint32_t write_addr   = 0; // address of write_buf[0]
+static size_t   write_length = 0; // bytes staged; 0 == nothing staged
+
+static bool ranges_overlap(uint32_t a_addr, size_t a_len, uint32_t b_addr, size_t b_len) {
+    return a_addr < (b_addr + b_len) && b_addr < (a_addr + a_len);
+}
+
+flash_status_t flash_cache_flush(void) {
+    if (write_length == 0) {
+        return FLASH_STATUS_SUCCESS;
+    }
+    flash_status_t response = flash_backend_write_range(write_addr, write_buf, write_length);
+    write_length            = 0;
+    stats.write_flushes++;
+    return response;
+}
+
+flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    // The read-ahead window would go stale underneath this write.
+    if (read_valid && ranges_overlap(addr, len, read_addr, FLASH_CACHE_READ_BUFFER_SIZE)) {
+        read_valid = false;
+    }
+
+    // Anything staged that this write doesn't directly extend goes out first.
+    if (write_length != 0 && addr != write_addr + write_length) {
+        response = flash_cache_flush();
+        if (response != FLASH_STATUS_SUCCESS) {
+            return response;
+        }
+    }
+
+    const uint8_t *src = (const uint8_t *)buf;
+    while (len > 0) {
+        if (write_length == 0) {
+            write_addr = addr;
+        } else {
+            stats.write_combines++;
+        }
+
+        size_t space = FLASH_CACHE_WRITE_BUFFER_SIZE - write_length;
+        size_t chunk = len < space ? len : space;
+        memcpy(&write_buf[write_length], src, chunk);
+        write_length += chunk;
+        src += chunk;
+        addr += chunk;
+        len -= chunk;
+
+        if (write_length == FLASH_CACHE_WRITE_BUFFER_SIZE) {
+            response = flash_cache_flush();
+            if (response != FLASH_STATUS_SUCCESS) {
+                return response;
+            }
+        }
+    }
+    return response;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Read-ahead
+
+void flash_cache_invalidate(void) {
+    read_valid = false;
+}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    // Staged writes must be observable: push them out before reading over them.
+    if (write_length != 0 && ranges_overlap(addr, len, write_addr, write_length)) {
+        response = flash_cache_flush();
+        if (response != FLASH_STATUS_SUCCESS) {
+            return response;
+        }
+    }
+
+    // Oversized reads pass straight through; they'd only thrash the window.
+    if (len > FLASH_CACHE_READ_BUFFER_SIZE) {
+        stats.read_bypasses++;
+        return flash_backend_read_range(addr, buf, len);
+    }
+
+    if (!read_valid || addr < read_addr || (addr + len) > (read_addr + FLASH_CACHE_READ_BUFFER_SIZE)) {
+        // Refill the window, aligned so the adjacent reads of a sequential scan
+        // (wear-leveling log replay) land in the same fill.
+        uint32_t base = addr - (addr % FLASH_CACHE_READ_BUFFER_SIZE);
+        if ((addr + len) > (base + FLASH_CACHE_READ_BUFFER_SIZE)) {
+            base = addr; // request straddles an alignment boundary; anchor on it instead
+        }
+        response = flash_backend_read_range(base, read_buf, FLASH_CACHE_READ_BUFFER_SIZE);
+        if (response != FLASH_STATUS_SUCCESS) {
+            read_valid = false;
+            memset(buf, 0, len);
+            return response;
+        }
+        read_addr  = base;
+        read_valid = true;
+        stats.read_misses++;
+    } else {
+        stats.read_hits++;
+    }
+
+    memcpy(buf, &read_buf[addr - read_addr], len);
+    return response;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Erase interposers -- flush staged writes for ordering, drop the stale read window
+
+flash_status_t flash_erase_chip(void) {
+    flash_status_t response = flash_cache_flush();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+    flash_cache_invalidate();
+    return flash_backend_erase_chip();
+}
+
+flash_status_t flash_erase_block(uint32_t addr) {
+    flash_status_t response = flash_cache_flush();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+    flash_cache_invalidate();
+    return flash_backend_erase_block(addr);
+}
+
+flash_status_t flash_erase_sector(uint32_t addr) {
+    flash_status_t response = flash_cache_flush();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+    flash_cache_invalidate();
+    return flash_backend_erase_sector(addr);
+}
+
+flash_cache_stats_t flash_cache_stats(void) {
+    return stats;
+}
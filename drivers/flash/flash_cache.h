@@ -0,0 +1,73 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "flash.h"
+
+/**
+ * @brief Caching layer interposed on the flash range/erase API.
+ *
+ * Backends above issue one transaction per call; wear-leveling log replay at boot
+ * produces many small adjacent reads, and runtime config updates produce many small
+ * adjacent programs. This layer adds an aligned read-ahead window serving adjacent
+ * reads from RAM, and combines contiguous programs within one window into a single
+ * page-program transaction.
+ *
+ * Staged writes are flushed automatically on a non-contiguous write, on a read or
+ * erase touching the staged range, and when the combining window fills. Until one of
+ * those happens the most recent write is not yet durable; call flash_cache_flush()
+ * at quiescent points when that matters.
+ */
+
+/**
+ * @brief Size of the aligned read-ahead window, in bytes.
+ */
+#ifndef FLASH_CACHE_READ_BUFFER_SIZE
+#    define FLASH_CACHE_READ_BUFFER_SIZE 256
+#endif
+
+/**
+ * @brief Size of the aligned write-combining window, in bytes. Must not exceed the flash page size.
+ */
+#ifndef FLASH_CACHE_WRITE_BUFFER_SIZE
+#    define FLASH_CACHE_WRITE_BUFFER_SIZE 64
+#endif
+
+/**
+ * @brief Hit/miss counters maintained by the cache layer.
+ */
+typedef struct flash_cache_stats_t {
+    uint32_t read_hits;      //< Reads served entirely from the read-ahead window.
+    uint32_t read_misses;    //< Reads that refilled the read-ahead window.
+    uint32_t read_bypasses;  //< Reads larger than the window, passed straight through.
+    uint32_t write_combines; //< Writes appended to an already-staged program.
+    uint32_t write_flushes;  //< Page-program transactions issued for staged writes.
+} flash_cache_stats_t;
+
+/**
+ * @brief Flushes any staged write to the backend.
+ *
+ * @return FLASH_STATUS_SUCCESS if nothing was staged or the flush succeeded, otherwise the backend's error.
+ */
+flash_status_t flash_cache_flush(void);
+
+/**
+ * @brief Drops the read-ahead window, forcing the next read to hit the backend.
+ */
+void flash_cache_invalidate(void);
+
+/**
+ * @brief Retrieves the cache counters.
+ */
+flash_cache_stats_t flash_cache_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
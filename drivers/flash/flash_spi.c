@@ -12,6 +12,16 @@
 #include "flash_spi.h"
 #include "spi_master.h"
 
+#ifdef FLASH_CACHE_ENABLE
+// The cache layer (flash_cache.c) owns the public range/erase entry points; this
+// backend's implementations take the flash_backend_* names instead.
+#    define flash_read_range flash_backend_read_range
+#    define flash_write_range flash_backend_write_range
+#    define flash_erase_chip flash_backend_erase_chip
+#    define flash_erase_block flash_backend_erase_block
+#    define flash_erase_sector flash_backend_erase_sector
+#endif // FLASH_CACHE_ENABLE
+
 /*
     The time-out time of spi flash transmission.
 */
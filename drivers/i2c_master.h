@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * \file
@@ -138,4 +139,39 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+#if defined(I2C_MASTER_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Completion callback for an asynchronous I2C transaction.
+ *
+ * \param status The result of the transaction, as per the blocking API.
+ * \param user_data The pointer given at submission time.
+ */
+typedef void (*i2c_async_callback_t)(i2c_status_t status, void* user_data);
+
+/**
+ * \brief Queue a transmit to the selected I2C device without blocking the calling thread.
+ *
+ * The transfer runs on a dedicated worker thread; the buffer must stay valid until the completion callback fires.
+ * Callbacks are dispatched from i2c_async_task(), not from interrupt or worker context. Traffic for a given device
+ * should go through either the blocking or the asynchronous API, not both concurrently.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout, i2c_async_callback_t callback, void* user_data);
+
+/**
+ * \brief Queue a receive from the selected I2C device without blocking the calling thread.
+ *
+ * See i2c_transmit_async() for buffer lifetime and dispatch semantics.
+ *
+ * \return `true` if the transaction was queued, `false` if the queue is full.
+ */
+bool i2c_receive_async(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout, i2c_async_callback_t callback, void* user_data);
+
+/**
+ * \brief Dispatch completion callbacks for finished asynchronous transactions. Call from housekeeping.
+ */
+void i2c_async_task(void);
+#endif
+
 /** \} */
@@ -95,3 +95,8 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+#if defined(WS2812_GAMMA_CORRECTION)
+// Gamma 2.2 lookup, applied per channel when the effect writes into the LED frame buffer
+uint8_t ws2812_gamma8(uint8_t v);
+#endif
@@ -3,6 +3,8 @@
 
 #ifdef QUANTUM_PAINTER_SPI_ENABLE
 
+#    include <string.h>
+
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
@@ -30,6 +32,44 @@ bool qp_comms_spi_start(painter_device_t device) {
     return spi_start(comms_config->chip_select_pin, comms_config->lsb_first, comms_config->mode, comms_config->divisor);
 }
 
+#    ifdef QUANTUM_PAINTER_SPI_DMA_ENABLE
+
+// Ping-pong bounce buffers -- one chunk is copied while the previous chunk is still on the wire.
+static uint8_t qp_comms_spi_dma_buffer[2][QP_COMMS_SPI_DMA_BUFFER_SIZE];
+static uint8_t qp_comms_spi_dma_buffer_idx = 0;
+
+#        if defined(SPI_SCHEDULER) && !defined(QP_COMMS_SPI_YIELD_PRIORITY)
+// Queued transactions at or above this priority may cut in between chunks of a bulk send
+#            define QP_COMMS_SPI_YIELD_PRIORITY 128
+#        endif
+
+uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+
+    while (bytes_remaining > 0) {
+#        ifdef SPI_SCHEDULER
+        // ST77xx-style panels pause their interface while chip select is deasserted mid stream, so
+        // chunk boundaries are safe points to let short high-priority transfers onto the bus.
+        spi_scheduler_yield(QP_COMMS_SPI_YIELD_PRIORITY);
+#        endif
+        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, QP_COMMS_SPI_DMA_BUFFER_SIZE);
+        uint8_t *buf             = qp_comms_spi_dma_buffer[qp_comms_spi_dma_buffer_idx];
+        memcpy(buf, p, bytes_this_loop);
+        // Blocks only if the transfer before last is still in flight, then kicks off this chunk in the background.
+        if (spi_transmit_async(buf, bytes_this_loop) != SPI_STATUS_SUCCESS) {
+            break;
+        }
+        qp_comms_spi_dma_buffer_idx ^= 1;
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    return byte_count - bytes_remaining;
+}
+
+#    else // QUANTUM_PAINTER_SPI_DMA_ENABLE
+
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
@@ -45,10 +85,12 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    endif // QUANTUM_PAINTER_SPI_DMA_ENABLE
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
-    spi_stop();
+    spi_stop(); // waits out any in-flight background transfer before deasserting CS
     gpio_write_pin_high(comms_config->chip_select_pin);
 }
 
@@ -81,10 +123,15 @@ bool qp_comms_spi_dc_reset_init(painter_device_t device) {
     // Set up RST as output, if specified, performing a reset in the process
     if (comms_config->reset_pin != NO_PIN) {
         gpio_set_pin_output(comms_config->reset_pin);
-        gpio_write_pin_low(comms_config->reset_pin);
-        wait_ms(20);
-        gpio_write_pin_high(comms_config->reset_pin);
-        wait_ms(20);
+        if (driver->warm_init) {
+            // Warm init: the panel stayed powered and is still displaying content -- just hold RST deasserted
+            gpio_write_pin_high(comms_config->reset_pin);
+        } else {
+            gpio_write_pin_low(comms_config->reset_pin);
+            wait_ms(20);
+            gpio_write_pin_high(comms_config->reset_pin);
+            wait_ms(20);
+        }
     }
 
     return true;
@@ -100,6 +147,7 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_transmit_async_wait(); // D/C must not change while pixel data is still on the wire
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -19,6 +19,11 @@ typedef struct qp_comms_spi_config_t {
     int8_t   mode;
 } qp_comms_spi_config_t;
 
+// Size of each of the two bounce buffers used when background (DMA) transmission is enabled
+#    ifndef QP_COMMS_SPI_DMA_BUFFER_SIZE
+#        define QP_COMMS_SPI_DMA_BUFFER_SIZE 1024
+#    endif
+
 bool     qp_comms_spi_init(painter_device_t device);
 bool     qp_comms_spi_start(painter_device_t device);
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void* data, uint32_t byte_count);
@@ -64,4 +64,17 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Attaches a shadow buffer to the surface, enabling diff-based transmission in \ref qp_surface_draw.
+ *
+ * The shadow buffer keeps a copy of the last frame sent to the target; subsequent draws compare each scanline in the
+ * dirty region against it and transmit only the spans that actually changed, skipping identical rows entirely.
+ * Currently supported for RGB565 surfaces only.
+ *
+ * @param surface[in] the surface to attach the shadow buffer to
+ * @param shadow_buffer[in] pointer to a preallocated buffer of the same size as the surface's own buffer
+ * @return whether the shadow buffer was attached successfully
+ */
+bool qp_surface_attach_shadow(painter_device_t surface, void *shadow_buffer);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -139,3 +139,21 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Shadow buffer attachment for diff-based transmission
+
+bool qp_surface_attach_shadow(painter_device_t surface, void *shadow_buffer) {
+    painter_driver_t *        driver         = (painter_driver_t *)surface;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)driver;
+
+    // Scanline diffing is only implemented for RGB565 surfaces at this point
+    if (!driver || driver->native_bits_per_pixel != 16) {
+        qp_dprintf("qp_surface_attach_shadow: fail (only RGB565 surfaces supported)\n");
+        return false;
+    }
+
+    surface_handle->shadow_buffer = shadow_buffer;
+    surface_handle->shadow_valid  = false; // first draw after attach transfers the full dirty region
+    return true;
+}
@@ -52,6 +52,16 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Optional copy of the last frame transferred to a target, used for per-scanline diff transmission
+    union {
+        void *    shadow_buffer;
+        uint8_t * u8shadow;
+        uint16_t *u16shadow;
+    };
+
+    // Whether the shadow buffer matches a frame the target has actually received
+    bool shadow_valid;
 } surface_painter_device_t;
 
 /**
@@ -68,6 +68,61 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
+// Streams a single run of pixels from the surface buffer to the target, chunked through the global pixdata buffer
+static bool rgb565_stream_span(painter_driver_t *target_driver, const uint16_t *src, uint32_t pixel_count) {
+    uint32_t  pixels_per_chunk = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / 16;
+    uint16_t *target_buffer    = (uint16_t *)qp_internal_global_pixdata_buffer;
+
+    while (pixel_count > 0) {
+        uint32_t pixels_this_loop = QP_MIN(pixel_count, pixels_per_chunk);
+        memcpy(target_buffer, src, pixels_this_loop * sizeof(uint16_t));
+        if (!qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixels_this_loop)) {
+            return false;
+        }
+        src += pixels_this_loop;
+        pixel_count -= pixels_this_loop;
+    }
+    return true;
+}
+
+// Diff-based transfer -- compares each scanline in the dirty region against the shadow copy of the last transmitted
+// frame, sending only the changed span of each row and skipping identical rows entirely
+static bool rgb565_shadow_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    uint16_t                  stride         = surface_handle->base.panel_width;
+
+    for (uint16_t row = t; row <= b; ++row) {
+        uint16_t *cur    = &surface_handle->u16buffer[row * stride];
+        uint16_t *shadow = &surface_handle->u16shadow[row * stride];
+
+        // Find the first and last differing pixels in this row
+        uint16_t sl = l;
+        while (sl <= r && cur[sl] == shadow[sl]) {
+            ++sl;
+        }
+        if (sl > r) {
+            continue; // row unchanged, skip it
+        }
+        uint16_t sr = r;
+        while (cur[sr] == shadow[sr]) {
+            --sr;
+        }
+
+        // Transmit just the changed span and bring the shadow up to date
+        if (!qp_viewport((painter_device_t)target_driver, x + sl, y + row, x + sr, y + row)) {
+            qp_dprintf("rgb565_shadow_pixdata_transfer: fail (could not set target viewport)\n");
+            return false;
+        }
+        if (!rgb565_stream_span(target_driver, &cur[sl], (uint32_t)(sr - sl + 1))) {
+            qp_dprintf("rgb565_shadow_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+        memcpy(&shadow[sl], &cur[sl], ((uint32_t)(sr - sl + 1)) * sizeof(uint16_t));
+    }
+
+    return true;
+}
+
 static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
@@ -76,6 +131,11 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
     uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
 
+    // If a shadow of the last transmitted frame is available, only send the spans that changed
+    if (surface_handle->shadow_buffer && surface_handle->shadow_valid) {
+        return rgb565_shadow_pixdata_transfer(surface_driver, target_driver, x, y, l, t, r, b);
+    }
+
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
@@ -116,6 +176,12 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
         }
     }
 
+    // A full frame has now hit the target -- seed the shadow so subsequent draws can diff against it
+    if (surface_handle->shadow_buffer) {
+        memcpy(surface_handle->shadow_buffer, surface_handle->buffer, ((uint32_t)surface_handle->base.panel_width) * surface_handle->base.panel_height * sizeof(uint16_t));
+        surface_handle->shadow_valid = true;
+    }
+
     return true;
 }
 
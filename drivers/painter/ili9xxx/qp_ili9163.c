@@ -90,37 +90,7 @@ const tft_panel_dc_reset_painter_driver_vtable_t ili9163_driver_vtable = {
 
 // Factory function for creating a handle to the ILI9163 device
 painter_device_t qp_ili9163_make_spi_device(uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin, pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode) {
-    for (uint32_t i = 0; i < ILI9163_NUM_DEVICES; ++i) {
-        tft_panel_dc_reset_painter_device_t *driver = &ili9163_drivers[i];
-        if (!driver->base.driver_vtable) {
-            driver->base.driver_vtable         = (const painter_driver_vtable_t *)&ili9163_driver_vtable;
-            driver->base.comms_vtable          = (const painter_comms_vtable_t *)&spi_comms_with_dc_vtable;
-            driver->base.panel_width           = panel_width;
-            driver->base.panel_height          = panel_height;
-            driver->base.rotation              = QP_ROTATION_0;
-            driver->base.offset_x              = 0;
-            driver->base.offset_y              = 0;
-            driver->base.native_bits_per_pixel = 16; // RGB565
-
-            // SPI and other pin configuration
-            driver->base.comms_config                                   = &driver->spi_dc_reset_config;
-            driver->spi_dc_reset_config.spi_config.chip_select_pin      = chip_select_pin;
-            driver->spi_dc_reset_config.spi_config.divisor              = spi_divisor;
-            driver->spi_dc_reset_config.spi_config.lsb_first            = false;
-            driver->spi_dc_reset_config.spi_config.mode                 = spi_mode;
-            driver->spi_dc_reset_config.dc_pin                          = dc_pin;
-            driver->spi_dc_reset_config.reset_pin                       = reset_pin;
-            driver->spi_dc_reset_config.command_params_uses_command_pin = false;
-
-            if (!qp_internal_register_device((painter_device_t)driver)) {
-                memset(driver, 0, sizeof(tft_panel_dc_reset_painter_device_t));
-                return NULL;
-            }
-
-            return (painter_device_t)driver;
-        }
-    }
-    return NULL;
+    return qp_tft_panel_make_spi_device_dc_reset(ili9163_drivers, ILI9163_NUM_DEVICES, &ili9163_driver_vtable, &spi_comms_with_dc_vtable, 16 /* RGB565 */, panel_width, panel_height, chip_select_pin, dc_pin, reset_pin, spi_divisor, spi_mode);
 }
 
 #endif // QUANTUM_PAINTER_ILI9163_SPI_ENABLE
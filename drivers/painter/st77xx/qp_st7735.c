@@ -49,9 +49,28 @@ static inline void st7735_automatic_viewport_offsets(painter_device_t device, pa
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Initialization
 
+// Post-sequence configuration; with QUANTUM_PAINTER_ASYNC_INIT this runs as the
+// final deferred continuation, after the init table's delays have elapsed.
+static void st7735_init_finalize(painter_device_t device) {
+    painter_rotation_t rotation = ((painter_driver_t *)device)->rotation;
+
+    // Configure the rotation (i.e. the ordering and direction of memory writes in GRAM)
+    const uint8_t madctl[] = {
+        [QP_ROTATION_0]   = ST77XX_MADCTL_BGR,
+        [QP_ROTATION_90]  = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MX | ST77XX_MADCTL_MV,
+        [QP_ROTATION_180] = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MX | ST77XX_MADCTL_MY,
+        [QP_ROTATION_270] = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MV | ST77XX_MADCTL_MY,
+    };
+    qp_comms_command_databyte(device, ST77XX_SET_MADCTL, madctl[rotation]);
+
+#ifndef ST7735_NO_AUTOMATIC_VIEWPORT_OFFSETS
+    st7735_automatic_viewport_offsets(device, rotation);
+#endif // ST7735_NO_AUTOMATIC_VIEWPORT_OFFSETS
+}
+
 __attribute__((weak)) bool qp_st7735_init(painter_device_t device, painter_rotation_t rotation) {
     // clang-format off
-    const uint8_t st7735_init_sequence[] = {
+    static const uint8_t st7735_init_sequence[] = {
         // Command,                 Delay, N, Data[N]
         ST77XX_CMD_RESET,            120,  0,
         ST77XX_CMD_SLEEP_OFF,          5,  0,
@@ -63,20 +82,15 @@ __attribute__((weak)) bool qp_st7735_init(painter_device_t device, painter_rotat
         ST77XX_CMD_DISPLAY_ON,        20,  0
     };
     // clang-format on
-    qp_comms_bulk_command_sequence(device, st7735_init_sequence, sizeof(st7735_init_sequence));
 
-    // Configure the rotation (i.e. the ordering and direction of memory writes in GRAM)
-    const uint8_t madctl[] = {
-        [QP_ROTATION_0]   = ST77XX_MADCTL_BGR,
-        [QP_ROTATION_90]  = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MX | ST77XX_MADCTL_MV,
-        [QP_ROTATION_180] = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MX | ST77XX_MADCTL_MY,
-        [QP_ROTATION_270] = ST77XX_MADCTL_BGR | ST77XX_MADCTL_MV | ST77XX_MADCTL_MY,
-    };
-    qp_comms_command_databyte(device, ST77XX_SET_MADCTL, madctl[rotation]);
-
-#ifndef ST7735_NO_AUTOMATIC_VIEWPORT_OFFSETS
-    st7735_automatic_viewport_offsets(device, rotation);
-#endif // ST7735_NO_AUTOMATIC_VIEWPORT_OFFSETS
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+    // The table's >140ms of delays run as deferred continuations; draws are
+    // rejected until the sequence and the finalize step have completed.
+    qp_comms_bulk_command_sequence_async(device, st7735_init_sequence, sizeof(st7735_init_sequence), st7735_init_finalize);
+#else
+    qp_comms_bulk_command_sequence(device, st7735_init_sequence, sizeof(st7735_init_sequence));
+    st7735_init_finalize(device);
+#endif // QUANTUM_PAINTER_ASYNC_INIT
 
     return true;
 }
@@ -116,37 +130,7 @@ const tft_panel_dc_reset_painter_driver_vtable_t st7735_driver_vtable = {
 
 // Factory function for creating a handle to the ST7735 device
 painter_device_t qp_st7735_make_spi_device(uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin, pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode) {
-    for (uint32_t i = 0; i < ST7735_NUM_DEVICES; ++i) {
-        tft_panel_dc_reset_painter_device_t *driver = &st7735_drivers[i];
-        if (!driver->base.driver_vtable) {
-            driver->base.driver_vtable         = (const painter_driver_vtable_t *)&st7735_driver_vtable;
-            driver->base.comms_vtable          = (const painter_comms_vtable_t *)&spi_comms_with_dc_vtable;
-            driver->base.panel_width           = panel_width;
-            driver->base.panel_height          = panel_height;
-            driver->base.rotation              = QP_ROTATION_0;
-            driver->base.offset_x              = 0;
-            driver->base.offset_y              = 0;
-            driver->base.native_bits_per_pixel = 16; // RGB565
-
-            // SPI and other pin configuration
-            driver->base.comms_config                                   = &driver->spi_dc_reset_config;
-            driver->spi_dc_reset_config.spi_config.chip_select_pin      = chip_select_pin;
-            driver->spi_dc_reset_config.spi_config.divisor              = spi_divisor;
-            driver->spi_dc_reset_config.spi_config.lsb_first            = false;
-            driver->spi_dc_reset_config.spi_config.mode                 = spi_mode;
-            driver->spi_dc_reset_config.dc_pin                          = dc_pin;
-            driver->spi_dc_reset_config.reset_pin                       = reset_pin;
-            driver->spi_dc_reset_config.command_params_uses_command_pin = false;
-
-            if (!qp_internal_register_device((painter_device_t)driver)) {
-                memset(driver, 0, sizeof(tft_panel_dc_reset_painter_device_t));
-                return NULL;
-            }
-
-            return (painter_device_t)driver;
-        }
-    }
-    return NULL;
+    return qp_tft_panel_make_spi_device_dc_reset(st7735_drivers, ST7735_NUM_DEVICES, &st7735_driver_vtable, &spi_comms_with_dc_vtable, 16 /* RGB565 */, panel_width, panel_height, chip_select_pin, dc_pin, reset_pin, spi_divisor, spi_mode);
 }
 
 #endif // QUANTUM_PAINTER_ST7735_SPI_ENABLE
@@ -48,19 +48,10 @@ static inline void st7789_automatic_viewport_offsets(painter_device_t device, pa
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Initialization
 
-__attribute__((weak)) bool qp_st7789_init(painter_device_t device, painter_rotation_t rotation) {
-    // clang-format off
-    const uint8_t st7789_init_sequence[] = {
-        // Command,                 Delay, N, Data[N]
-        ST77XX_CMD_RESET,            120,  0,
-        ST77XX_CMD_SLEEP_OFF,          5,  0,
-        ST77XX_SET_PIX_FMT,            0,  1, 0x55,
-        ST77XX_CMD_INVERT_ON,          0,  0,
-        ST77XX_CMD_NORMAL_ON,          0,  0,
-        ST77XX_CMD_DISPLAY_ON,        20,  0
-    };
-    // clang-format on
-    qp_comms_bulk_command_sequence(device, st7789_init_sequence, sizeof(st7789_init_sequence));
+// Post-sequence configuration; with QUANTUM_PAINTER_ASYNC_INIT this runs as the
+// final deferred continuation, after the init table's delays have elapsed.
+static void st7789_init_finalize(painter_device_t device) {
+    painter_rotation_t rotation = ((painter_driver_t *)device)->rotation;
 
     // Configure the rotation (i.e. the ordering and direction of memory writes in GRAM)
     const uint8_t madctl[] = {
@@ -74,6 +65,36 @@ __attribute__((weak)) bool qp_st7789_init(painter_device_t device, painter_rotat
 #ifndef ST7789_NO_AUTOMATIC_VIEWPORT_OFFSETS
     st7789_automatic_viewport_offsets(device, rotation);
 #endif // ST7789_NO_AUTOMATIC_VIEWPORT_OFFSETS
+}
+
+__attribute__((weak)) bool qp_st7789_init(painter_device_t device, painter_rotation_t rotation) {
+    if (((painter_driver_t *)device)->warm_init) {
+        // Warm init: the panel is already awake and displaying content, so skip the reset/init
+        // sequence (and its >140ms of delays) and only reapply the non-destructive configuration.
+        st7789_init_finalize(device);
+        return true;
+    }
+
+    // clang-format off
+    static const uint8_t st7789_init_sequence[] = {
+        // Command,                 Delay, N, Data[N]
+        ST77XX_CMD_RESET,            120,  0,
+        ST77XX_CMD_SLEEP_OFF,          5,  0,
+        ST77XX_SET_PIX_FMT,            0,  1, 0x55,
+        ST77XX_CMD_INVERT_ON,          0,  0,
+        ST77XX_CMD_NORMAL_ON,          0,  0,
+        ST77XX_CMD_DISPLAY_ON,        20,  0
+    };
+    // clang-format on
+
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+    // The table's >140ms of delays run as deferred continuations; draws are
+    // rejected until the sequence and the finalize step have completed.
+    qp_comms_bulk_command_sequence_async(device, st7789_init_sequence, sizeof(st7789_init_sequence), st7789_init_finalize);
+#else
+    qp_comms_bulk_command_sequence(device, st7789_init_sequence, sizeof(st7789_init_sequence));
+    st7789_init_finalize(device);
+#endif // QUANTUM_PAINTER_ASYNC_INIT
 
     return true;
 }
@@ -93,6 +114,8 @@ const tft_panel_dc_reset_painter_driver_vtable_t st7789_driver_vtable = {
             .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
             .append_pixels   = qp_tft_panel_append_pixels_rgb565,
             .append_pixdata  = qp_tft_panel_append_pixdata,
+            .scroll_region   = qp_tft_panel_set_scroll_region,
+            .scroll_start    = qp_tft_panel_set_scroll_start,
         },
     .num_window_bytes   = 2,
     .swap_window_coords = false,
@@ -103,6 +126,8 @@ const tft_panel_dc_reset_painter_driver_vtable_t st7789_driver_vtable = {
             .set_column_address = ST77XX_SET_COL_ADDR,
             .set_row_address    = ST77XX_SET_ROW_ADDR,
             .enable_writes      = ST77XX_SET_MEM,
+            .set_scroll_area    = ST7789_SET_VERT_SCRL,
+            .set_scroll_start   = ST7789_SET_VERT_SCRL_ADDR,
         },
 };
 
@@ -113,37 +138,7 @@ const tft_panel_dc_reset_painter_driver_vtable_t st7789_driver_vtable = {
 
 // Factory function for creating a handle to the ST7789 device
 painter_device_t qp_st7789_make_spi_device(uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin, pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode) {
-    for (uint32_t i = 0; i < ST7789_NUM_DEVICES; ++i) {
-        tft_panel_dc_reset_painter_device_t *driver = &st7789_drivers[i];
-        if (!driver->base.driver_vtable) {
-            driver->base.driver_vtable         = (const painter_driver_vtable_t *)&st7789_driver_vtable;
-            driver->base.comms_vtable          = (const painter_comms_vtable_t *)&spi_comms_with_dc_vtable;
-            driver->base.panel_width           = panel_width;
-            driver->base.panel_height          = panel_height;
-            driver->base.rotation              = QP_ROTATION_0;
-            driver->base.offset_x              = 0;
-            driver->base.offset_y              = 0;
-            driver->base.native_bits_per_pixel = 16; // RGB565
-
-            // SPI and other pin configuration
-            driver->base.comms_config                                   = &driver->spi_dc_reset_config;
-            driver->spi_dc_reset_config.spi_config.chip_select_pin      = chip_select_pin;
-            driver->spi_dc_reset_config.spi_config.divisor              = spi_divisor;
-            driver->spi_dc_reset_config.spi_config.lsb_first            = false;
-            driver->spi_dc_reset_config.spi_config.mode                 = spi_mode;
-            driver->spi_dc_reset_config.dc_pin                          = dc_pin;
-            driver->spi_dc_reset_config.reset_pin                       = reset_pin;
-            driver->spi_dc_reset_config.command_params_uses_command_pin = false;
-
-            if (!qp_internal_register_device((painter_device_t)driver)) {
-                memset(driver, 0, sizeof(tft_panel_dc_reset_painter_device_t));
-                return NULL;
-            }
-
-            return (painter_device_t)driver;
-        }
-    }
-    return NULL;
+    return qp_tft_panel_make_spi_device_dc_reset(st7789_drivers, ST7789_NUM_DEVICES, &st7789_driver_vtable, &spi_comms_with_dc_vtable, 16 /* RGB565 */, panel_width, panel_height, chip_select_pin, dc_pin, reset_pin, spi_divisor, spi_mode);
 }
 
 #endif // QUANTUM_PAINTER_ST7789_SPI_ENABLE
@@ -21,6 +21,9 @@ bool qp_tft_panel_power(painter_device_t device, bool power_on) {
 // Screen clear
 bool qp_tft_panel_clear(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
+#ifdef QUANTUM_PAINTER_WINDOW_CACHE
+    driver->window_cache.valid = false; // Init sequence resets the panel's window registers
+#endif
     driver->driver_vtable->init(device, driver->rotation); // Re-init the LCD
     return true;
 }
@@ -55,6 +58,17 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
         bottom = temp;
     }
 
+#ifdef QUANTUM_PAINTER_WINDOW_CACHE
+    // The column/row address registers persist across writes; when the window matches the
+    // one already programmed, only the write-enable (which resets the GRAM write pointer
+    // to the window origin) needs re-sending. Saves two command+data transactions per
+    // draw for the common repeated-region case (e.g. full-frame framebuffer flushes).
+    if (driver->window_cache.valid && driver->window_cache.l == left && driver->window_cache.t == top && driver->window_cache.r == right && driver->window_cache.b == bottom) {
+        qp_comms_command(device, vtable->opcodes.enable_writes);
+        return true;
+    }
+#endif
+
     if (vtable->num_window_bytes == 1) {
         // Set up the x-window
         uint8_t xbuf[2] = {left & 0xFF, right & 0xFF};
@@ -73,11 +87,48 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
         qp_comms_command_databuf(device, vtable->opcodes.set_row_address, ybuf, sizeof(ybuf));
     }
 
+#ifdef QUANTUM_PAINTER_WINDOW_CACHE
+    driver->window_cache.valid = true;
+    driver->window_cache.l     = left;
+    driver->window_cache.t     = top;
+    driver->window_cache.r     = right;
+    driver->window_cache.b     = bottom;
+#endif
+
     // Lock in the window
     qp_comms_command(device, vtable->opcodes.enable_writes);
     return true;
 }
 
+// Hardware scroll region: fixed top area, scrolling middle area, fixed bottom area. The three
+// line counts must cover the panel's full GRAM height; scrolling is along the native vertical axis.
+bool qp_tft_panel_set_scroll_region(painter_device_t device, uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines) {
+    painter_driver_t *                          driver = (painter_driver_t *)device;
+    tft_panel_dc_reset_painter_driver_vtable_t *vtable = (tft_panel_dc_reset_painter_driver_vtable_t *)driver->driver_vtable;
+
+    if (vtable->opcodes.set_scroll_area == 0) {
+        return false;
+    }
+
+    uint8_t buf[6] = {top_fixed_lines >> 8, top_fixed_lines & 0xFF, scroll_lines >> 8, scroll_lines & 0xFF, bottom_fixed_lines >> 8, bottom_fixed_lines & 0xFF};
+    qp_comms_command_databuf(device, vtable->opcodes.set_scroll_area, buf, sizeof(buf));
+    return true;
+}
+
+// Set which GRAM line the scroll region displays first
+bool qp_tft_panel_set_scroll_start(painter_device_t device, uint16_t line) {
+    painter_driver_t *                          driver = (painter_driver_t *)device;
+    tft_panel_dc_reset_painter_driver_vtable_t *vtable = (tft_panel_dc_reset_painter_driver_vtable_t *)driver->driver_vtable;
+
+    if (vtable->opcodes.set_scroll_start == 0) {
+        return false;
+    }
+
+    uint8_t buf[2] = {line >> 8, line & 0xFF};
+    qp_comms_command_databuf(device, vtable->opcodes.set_scroll_start, buf, sizeof(buf));
+    return true;
+}
+
 // Stream pixel data to the current write position in GRAM
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -85,6 +136,47 @@ bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint3
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Shared SPI factory
+
+#ifdef QUANTUM_PAINTER_SPI_ENABLE
+
+painter_device_t qp_tft_panel_make_spi_device_dc_reset(tft_panel_dc_reset_painter_device_t *device_table, uint32_t device_limit, const tft_panel_dc_reset_painter_driver_vtable_t *driver_vtable, const painter_comms_with_command_vtable_t *comms_vtable, uint8_t native_bits_per_pixel, uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin, pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode) {
+    for (uint32_t i = 0; i < device_limit; ++i) {
+        tft_panel_dc_reset_painter_device_t *driver = &device_table[i];
+        if (!driver->base.driver_vtable) {
+            driver->base.driver_vtable         = (const painter_driver_vtable_t *)driver_vtable;
+            driver->base.comms_vtable          = (const painter_comms_vtable_t *)comms_vtable;
+            driver->base.native_bits_per_pixel = native_bits_per_pixel;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+
+            // SPI and other pin configuration
+            driver->base.comms_config                                   = &driver->spi_dc_reset_config;
+            driver->spi_dc_reset_config.spi_config.chip_select_pin      = chip_select_pin;
+            driver->spi_dc_reset_config.spi_config.divisor              = spi_divisor;
+            driver->spi_dc_reset_config.spi_config.lsb_first            = false;
+            driver->spi_dc_reset_config.spi_config.mode                 = spi_mode;
+            driver->spi_dc_reset_config.dc_pin                          = dc_pin;
+            driver->spi_dc_reset_config.reset_pin                       = reset_pin;
+            driver->spi_dc_reset_config.command_params_uses_command_pin = false;
+
+            if (!qp_internal_register_device((painter_device_t)driver)) {
+                memset(driver, 0, sizeof(tft_panel_dc_reset_painter_device_t));
+                return NULL;
+            }
+
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+#endif // QUANTUM_PAINTER_SPI_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Convert supplied palette entries into their native equivalents
 
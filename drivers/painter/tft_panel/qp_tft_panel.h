@@ -29,6 +29,8 @@ typedef struct tft_panel_dc_reset_painter_driver_vtable_t {
         uint8_t set_column_address;
         uint8_t set_row_address;
         uint8_t enable_writes;
+        uint8_t set_scroll_area;  // 0 if the panel has no hardware vertical scrolling
+        uint8_t set_scroll_start; // 0 if the panel has no hardware vertical scrolling
     } opcodes;
 } tft_panel_dc_reset_painter_driver_vtable_t;
 
@@ -46,6 +48,15 @@ typedef struct tft_panel_dc_reset_painter_device_t {
     };
 } tft_panel_dc_reset_painter_device_t;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Shared factory
+
+#ifdef QUANTUM_PAINTER_SPI_ENABLE
+// Allocates a slot in the supplied device table and performs the configuration common to every D/C+reset SPI TFT;
+// panel differences live in the vtables. Returns NULL if the table is exhausted or registration fails.
+painter_device_t qp_tft_panel_make_spi_device_dc_reset(tft_panel_dc_reset_painter_device_t *device_table, uint32_t device_limit, const tft_panel_dc_reset_painter_driver_vtable_t *driver_vtable, const painter_comms_with_command_vtable_t *comms_vtable, uint8_t native_bits_per_pixel, uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin, pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode);
+#endif // QUANTUM_PAINTER_SPI_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations for injecting into concrete driver vtables
 
@@ -54,6 +65,8 @@ bool qp_tft_panel_clear(painter_device_t device);
 bool qp_tft_panel_flush(painter_device_t device);
 bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
+bool qp_tft_panel_set_scroll_region(painter_device_t device, uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines);
+bool qp_tft_panel_set_scroll_start(painter_device_t device, uint16_t line);
 
 bool qp_tft_panel_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 bool qp_tft_panel_palette_convert_rgb888(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
@@ -103,12 +103,74 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
  */
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
+/**
+ * \brief Send multiple bytes to the selected SPI device without waiting for completion.
+ *
+ * On platforms with DMA-capable SPI peripherals the transfer proceeds in the background and this function returns as
+ * soon as the transfer has been started. The supplied buffer must remain valid and unmodified until
+ * `spi_transmit_async_done()` returns `true`. On platforms without background transfer support this is equivalent to
+ * `spi_transmit()`.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether a transfer started by `spi_transmit_async()` has completed.
+ *
+ * \return `true` if no background transfer is in flight.
+ */
+bool spi_transmit_async_done(void);
+
+/**
+ * \brief Block until any transfer started by `spi_transmit_async()` has completed.
+ */
+void spi_transmit_async_wait(void);
+
 /**
  * \brief End the current SPI transaction. This will deassert the slave select pin and reset the endianness, mode and divisor configured by `spi_start()`.
  *
  */
 void spi_stop(void);
 
+#if defined(SPI_SCHEDULER) || defined(__DOXYGEN__)
+/**
+ * \brief Completion callback for a scheduled SPI transaction.
+ *
+ * \param status The result of the transfer.
+ * \param user_data The pointer given at submission time.
+ */
+typedef void (*spi_scheduler_callback_t)(spi_status_t status, void *user_data);
+
+/**
+ * \brief Queue a complete transmit-only transaction (start, send, stop) for deferred execution.
+ *
+ * Runs immediately if the bus is free; otherwise it runs when the current holder stops the bus or yields at a chunk
+ * boundary via `spi_scheduler_yield()`. Higher priority values run first. The buffer must stay valid until the
+ * callback fires; callbacks execute in the thread that drains the queue.
+ *
+ * \return `true` if the transaction was queued or executed, `false` if the queue is full.
+ */
+bool spi_transaction_submit(const spi_start_config_t *start_config, const uint8_t *data, uint16_t length, uint8_t priority, spi_scheduler_callback_t callback, void *user_data);
+
+/**
+ * \brief Whether any queued transaction of at least the given priority is waiting for the bus.
+ */
+bool spi_scheduler_pending(uint8_t min_priority);
+
+/**
+ * \brief Called by the current bus holder at a safe chunk boundary: suspends the holder's transaction, runs all queued
+ * transactions of at least the given priority, then re-establishes the holder's session.
+ *
+ * Only safe where the selected device tolerates its chip select being deasserted mid data stream and resumed later
+ * (true of the ST77xx-style panels that dominate bulk traffic in this codebase).
+ */
+void spi_scheduler_yield(uint8_t min_priority);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
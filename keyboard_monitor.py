@@ -66,6 +66,24 @@ CMD_DATETIME_UPDATE = 0x03
 CMD_WEATHER_UPDATE = 0x04
 CMD_WIND_UPDATE = 0x05
 
+# Protocol v2: framed multi-field updates (firmware side in keymaps/default/hid_protocol.h)
+CMD_FRAME = 0x20      # Computer → Keyboard: framed update
+CMD_FRAME_ACK = 0x21  # Keyboard → Computer: frame acknowledgement
+
+# Field bits for CMD_FRAME packets; fields are packed in bit order after the 3-byte header
+FIELD_DATETIME = 1 << 0  # 7 bytes: year_low, year_high, month, day, hour, minute, second
+FIELD_VOLUME = 1 << 1    # 1 byte: 0-100
+FIELD_WEATHER = 1 << 2   # 1 byte: weather state 0-8
+FIELD_WIND = 1 << 3      # 2 bytes: intensity 0-3, direction 0-1
+FIELD_MEDIA = 1 << 4     # Null-terminated string, must be the last field in the frame
+
+FRAME_WINDOW = 4         # Max unacknowledged frames in flight before send() blocks
+FRAME_ACK_TIMEOUT = 0.5  # Seconds before an unacknowledged frame is retransmitted
+FRAME_MAX_RETRIES = 3    # Retransmissions before a frame is dropped as lost
+
+# A/B experiment harness query command (firmware side in quantum/experiment.h)
+CMD_EXPERIMENT = 0x0D
+
 # Command IDs for game protocol (0x10-0x13: bidirectional)
 MSG_SCORE_SUBMIT = 0x10  # Keyboard → Computer: score submission
 MSG_ENTER_NAME = 0x11    # Computer → Keyboard: ask for name (top 10)
@@ -650,6 +668,131 @@ def find_keyboard_device(silent=False):
     return None
 
 
+class FrameLink:
+    """Sliding-window sender for protocol v2 frames (CMD_FRAME / CMD_FRAME_ACK).
+
+    Packs several state fields into one 32-byte packet so a full state push is
+    1-2 frames (and 1-2 display redraws) instead of one packet per value. Frames
+    carry a sequence number; the firmware ACKs each one. USB HID transfers are
+    reliable in themselves, so the window/retransmit machinery only kicks in for
+    frames sent while the firmware was resetting or re-enumerating.
+    """
+
+    def __init__(self):
+        self.next_seq = 0
+        self.pending = {}  # seq -> [packet(bytearray), deadline, retries]
+        self.inbox = []    # Non-ACK packets swallowed while waiting for window room
+
+    def reset(self):
+        """Drop all link state, e.g. after a disconnect."""
+        self.pending.clear()
+        self.inbox.clear()
+
+    @staticmethod
+    def _build_fields(dt=None, volume=None, weather=None, wind=None, media=None):
+        """Returns (field_bitmap, payload_bytes) for the given fields."""
+        fields = 0
+        payload = bytearray()
+        if dt is not None:
+            fields |= FIELD_DATETIME
+            payload += bytes([dt.year & 0xFF, (dt.year >> 8) & 0xFF,
+                              dt.month, dt.day, dt.hour, dt.minute, dt.second])
+        if volume is not None:
+            fields |= FIELD_VOLUME
+            payload += bytes([max(0, min(100, int(volume)))])
+        if weather is not None:
+            fields |= FIELD_WEATHER
+            payload += bytes([weather])
+        if wind is not None:
+            fields |= FIELD_WIND
+            payload += bytes([wind[0], wind[1]])
+        if media is not None:
+            # Media must be last: it runs to the end of the packet. Truncate to the
+            # room left after the header and any other fields, keeping the terminator.
+            fields |= FIELD_MEDIA
+            room = HID_PACKET_SIZE - 3 - len(payload) - 1
+            media_bytes = media.encode('utf-8')[:room]
+            # Don't leave a partial UTF-8 sequence at the truncation point
+            while media_bytes and (media_bytes[-1] & 0xC0) == 0x80:
+                media_bytes = media_bytes[:-1]
+            payload += media_bytes + b'\x00'
+        return fields, payload
+
+    def send(self, device, dt=None, volume=None, weather=None, wind=None, media=None):
+        """Builds and sends one frame; blocks if the ACK window is full.
+
+        Returns True if the frame was written, False on a write error (caller
+        should treat this as a disconnect, same as the legacy senders).
+        """
+        fields, payload = self._build_fields(dt, volume, weather, wind, media)
+        if fields == 0:
+            return True
+
+        if len(self.pending) >= FRAME_WINDOW:
+            self._wait_for_room(device)
+
+        seq = self.next_seq
+        self.next_seq = (self.next_seq + 1) & 0xFF
+
+        packet = bytearray(HID_PACKET_SIZE)
+        packet[0] = CMD_FRAME
+        packet[1] = seq
+        packet[2] = fields
+        packet[3:3 + len(payload)] = payload
+
+        if not self._write(device, packet):
+            return False
+        self.pending[seq] = [packet, time.time() + FRAME_ACK_TIMEOUT, 0]
+        return True
+
+    def handle_packet(self, data):
+        """Consumes frame ACKs; returns True if the packet was one."""
+        if len(data) >= 2 and data[0] == CMD_FRAME_ACK:
+            self.pending.pop(data[1], None)
+            return True
+        return False
+
+    def service(self, device):
+        """Retransmits overdue frames; call once per poll iteration."""
+        now = time.time()
+        for seq in list(self.pending):
+            packet, deadline, retries = self.pending[seq]
+            if now < deadline:
+                continue
+            if retries >= FRAME_MAX_RETRIES:
+                print(f"✗ Frame {seq} lost after {retries} retries")
+                del self.pending[seq]
+                continue
+            self._write(device, packet)
+            self.pending[seq] = [packet, now + FRAME_ACK_TIMEOUT, retries + 1]
+
+    def _wait_for_room(self, device):
+        """Reads until the window has room, stashing non-ACK packets for the caller."""
+        deadline = time.time() + FRAME_ACK_TIMEOUT
+        while len(self.pending) >= FRAME_WINDOW and time.time() < deadline:
+            try:
+                data = device.read(HID_PACKET_SIZE, timeout_ms=50)
+            except Exception:
+                break
+            if data and not self.handle_packet(data):
+                self.inbox.append(data)
+        if len(self.pending) >= FRAME_WINDOW:
+            # Window still full; let the retransmit path sort it out rather than stalling
+            self.service(device)
+
+    @staticmethod
+    def _write(device, packet):
+        try:
+            bytes_written = device.write([0] + list(packet))
+            if bytes_written <= 0:
+                print(f"✗ Frame write failed: {bytes_written} bytes written")
+                return False
+            return True
+        except Exception as e:
+            print(f"✗ Error sending frame: {e}")
+            return False
+
+
 def send_volume_update(device, volume):
     """Send volume update to keyboard via Raw HID."""
     # Create HID packet (32 bytes)
@@ -929,6 +1072,95 @@ def connect_to_keyboard(silent=False):
         return None
 
 
+# ============================================================================
+# A/B EXPERIMENT HARNESS
+# ============================================================================
+
+EXPERIMENT_MODE_NAMES = {0: "alternate", 1: "pin-a", 2: "pin-b"}
+EXPERIMENT_MODE_IDS = {"alternate": 0, "a": 1, "b": 2}
+
+
+def experiment_request(device, payload):
+    """Send one CMD_EXPERIMENT sub-command and wait for the matching response."""
+    packet = bytearray(HID_PACKET_SIZE)
+    packet[0] = CMD_EXPERIMENT
+    packet[1:1 + len(payload)] = bytes(payload)
+    device.write([0] + list(packet))
+
+    deadline = time.time() + 1.0
+    while time.time() < deadline:
+        data = device.read(HID_PACKET_SIZE, timeout_ms=100)
+        # Unrelated traffic (score submissions etc.) may interleave; skip it
+        if data and data[0] == CMD_EXPERIMENT and data[1] == payload[0]:
+            return data
+    return None
+
+
+def experiment_read_counters(device, variant):
+    """Read one variant's persisted counters. Returns a dict or None."""
+    data = experiment_request(device, [0x01, variant])
+    if data is None:
+        return None
+    boots = data[3] | (data[4] << 8)
+    presses = data[5] | (data[6] << 8) | (data[7] << 16) | (data[8] << 24)
+    samples = data[9] | (data[10] << 8) | (data[11] << 16) | (data[12] << 24)
+    sum_ms = data[13] | (data[14] << 8) | (data[15] << 16) | (data[16] << 24)
+    max_ms = data[17] | (data[18] << 8)
+    return {
+        'boots': boots,
+        'presses': presses,
+        'latency_samples': samples,
+        'latency_sum_ms': sum_ms,
+        'latency_max_ms': max_ms,
+    }
+
+
+def run_experiment(args):
+    """One-shot mode: read back (or control) the firmware A/B experiment harness."""
+    device = connect_to_keyboard()
+    if device is None:
+        print("✗ Keyboard not found")
+        return 1
+
+    try:
+        if args.experiment_mode is not None:
+            mode = EXPERIMENT_MODE_IDS[args.experiment_mode]
+            if experiment_request(device, [0x02, mode]) is None:
+                print("✗ No response (is EXPERIMENT_ENABLE set in the firmware?)")
+                return 1
+            print(f"✓ Selection mode set to '{args.experiment_mode}' (takes effect next boot)")
+            return 0
+
+        if args.experiment_reset:
+            if experiment_request(device, [0xFF]) is None:
+                print("✗ No response (is EXPERIMENT_ENABLE set in the firmware?)")
+                return 1
+            print("✓ Experiment counters reset")
+            return 0
+
+        status = experiment_request(device, [0x00])
+        if status is None:
+            print("✗ No response (is EXPERIMENT_ENABLE set in the firmware?)")
+            return 1
+
+        mode_name = EXPERIMENT_MODE_NAMES.get(status[2], f"unknown ({status[2]})")
+        print(f"Selection mode:  {mode_name}")
+        print(f"Active variant:  {'B' if status[3] else 'A'} (this boot)")
+        print()
+        print(f"{'':>10} {'boots':>8} {'presses':>10} {'samples':>10} {'mean ms':>8} {'max ms':>7}")
+        for variant, name in ((0, 'A'), (1, 'B')):
+            c = experiment_read_counters(device, variant)
+            if c is None:
+                print(f"✗ Failed to read variant {name}")
+                return 1
+            mean = c['latency_sum_ms'] / c['latency_samples'] if c['latency_samples'] else 0.0
+            print(f"Variant {name}: {c['boots']:>8} {c['presses']:>10} {c['latency_samples']:>10} "
+                  f"{mean:>8.2f} {c['latency_max_ms']:>7}")
+        return 0
+    finally:
+        device.close()
+
+
 # ============================================================================
 # UTILITY FUNCTIONS
 # ============================================================================
@@ -1005,6 +1237,9 @@ Examples:
   # Test summer day (July 20th at 2 PM)
   python3 keyboard_monitor.py --test-date "2025-07-20 14:00"
 
+  # Read back the firmware A/B experiment counters (per-variant, persisted across boots)
+  python3 keyboard_monitor.py --experiment
+
 Features:
   • Monitors system volume and sends to keyboard display
   • Tracks media playback (Music/Spotify on macOS)
@@ -1052,8 +1287,28 @@ Features:
         action='store_true',
         help='Disable weather monitoring (weather is enabled by default with Otterndorf, Germany)'
     )
+    parser.add_argument(
+        '--experiment',
+        action='store_true',
+        help='Read back the firmware A/B experiment counters and exit (requires EXPERIMENT_ENABLE)'
+    )
+    parser.add_argument(
+        '--experiment-mode',
+        choices=['alternate', 'a', 'b'],
+        metavar='MODE',
+        help='Set the experiment variant selection mode (alternate, a, b; takes effect next boot) and exit'
+    )
+    parser.add_argument(
+        '--experiment-reset',
+        action='store_true',
+        help='Reset the experiment counters for both variants and exit'
+    )
     args = parser.parse_args()
 
+    # One-shot experiment readback/control, no monitoring loop
+    if args.experiment or args.experiment_mode is not None or args.experiment_reset:
+        sys.exit(run_experiment(args))
+
     print("=" * 60)
     print("    QMK KEYBOARD COMPANION")
     print("    Volume/Media/Weather Monitor + High Score Manager")
@@ -1104,6 +1359,9 @@ Features:
     score_manager = HighScoreManager()
     score_manager.print_scores()
 
+    # Protocol v2 frame link (sequence numbers + ACK window)
+    link = FrameLink()
+
     device = None
     last_volume = None
     last_media = None
@@ -1142,49 +1400,24 @@ Features:
                         # Reset connection check timer to check immediately
                         last_connection_check = current_time
 
-                        # Immediately send current volume on (re)connect
+                        # Fresh connection, fresh frame link
+                        link.reset()
+
+                        # Gather the full state and push it as one framed update
+                        # (datetime + volume + weather + wind in a single packet, media in a
+                        # second one) instead of one packet -- and one redraw -- per value
                         current_volume = get_system_volume()
                         if current_volume is not None:
                             print(f"🔊 Syncing volume: {current_volume}%")
-                            if send_volume_update(device, current_volume):
-                                last_volume = current_volume
-                            else:
-                                # Send failed immediately after connect
-                                print("✗ Initial sync failed")
-                                print("⏳ Waiting for keyboard to reconnect...\n")
-                                try:
-                                    device.close()
-                                except:
-                                    pass
-                                device = None
-                                last_volume = None
-                                last_media = None
-                                last_weather = None
-                                last_wind_intensity = None
-                                last_wind_direction = None
-                                continue
-                        else:
-                            # Reset last_volume to force update on next successful read
-                            last_volume = None
-
-                        # Immediately send current media on (re)connect
                         current_media = get_current_media()
                         if current_media:
                             print(f"♪ Syncing media: {current_media}")
-                            send_media_update(device, current_media)
-                            last_media = current_media
-                        else:
-                            last_media = None
 
-                        # Immediately send current date/time on (re)connect
                         dt_to_send = args.test_date if args.test_date else datetime.now()
                         print(f"📅 Syncing date/time: {dt_to_send.strftime('%Y-%m-%d %H:%M:%S')}")
-                        if send_datetime_update(device, dt_to_send):
-                            last_datetime_update = current_time
-                        else:
-                            print("✗ DateTime sync failed")
 
-                        # Immediately send current weather and wind on (re)connect if enabled
+                        current_weather = None
+                        current_wind = None
                         if weather_enabled:
                             weather_data = get_current_weather(
                                 location=weather_location,
@@ -1206,13 +1439,6 @@ Features:
                                     WEATHER_OVERCAST: "Overcast"
                                 }
                                 print(f"🌤️  Syncing weather: {weather_names.get(current_weather, 'Unknown')}")
-                                if send_weather_update(device, current_weather):
-                                    last_weather = current_weather
-                                    last_weather_check = current_time
-                                else:
-                                    print("✗ Weather sync failed")
-
-                                # Send wind update if available
                                 if current_wind_intensity is not None and current_wind_direction is not None:
                                     wind_intensity_names = {
                                         WIND_NONE: "None",
@@ -1225,14 +1451,41 @@ Features:
                                         WIND_RIGHT: "West (→)"
                                     }
                                     print(f"💨 Syncing wind: {wind_intensity_names.get(current_wind_intensity, 'Unknown')} {wind_direction_names.get(current_wind_direction, 'Unknown')}")
-                                    if send_wind_update(device, current_wind_intensity, current_wind_direction):
-                                        last_wind_intensity = current_wind_intensity
-                                        last_wind_direction = current_wind_direction
-                                    else:
-                                        print("✗ Wind sync failed")
+                                    current_wind = (current_wind_intensity, current_wind_direction)
                             else:
                                 print("⚠ Weather fetch failed")
 
+                        sync_ok = link.send(device, dt=dt_to_send, volume=current_volume,
+                                            weather=current_weather, wind=current_wind)
+                        if sync_ok and current_media:
+                            sync_ok = link.send(device, media=current_media)
+
+                        if not sync_ok:
+                            # Send failed immediately after connect
+                            print("✗ Initial sync failed")
+                            print("⏳ Waiting for keyboard to reconnect...\n")
+                            try:
+                                device.close()
+                            except:
+                                pass
+                            device = None
+                            link.reset()
+                            last_volume = None
+                            last_media = None
+                            last_weather = None
+                            last_wind_intensity = None
+                            last_wind_direction = None
+                            continue
+
+                        last_volume = current_volume
+                        last_media = current_media if current_media else None
+                        last_datetime_update = current_time
+                        if current_weather is not None:
+                            last_weather = current_weather
+                            last_weather_check = current_time
+                        if current_wind is not None:
+                            last_wind_intensity, last_wind_direction = current_wind
+
                 # Wait before next iteration
                 time.sleep(0.5)
                 continue
@@ -1255,12 +1508,19 @@ Features:
                     last_wind_direction = None
                     continue
 
+            # Retransmit any frames whose ACK never arrived
+            link.service(device)
+
             # Check for incoming messages from keyboard (non-blocking)
             try:
-                # Read with very short timeout to not block volume monitoring
-                data = device.read(HID_PACKET_SIZE, timeout_ms=10)
+                # Read with very short timeout to not block volume monitoring;
+                # drain packets stashed by the frame link first
+                if link.inbox:
+                    data = link.inbox.pop(0)
+                else:
+                    data = device.read(HID_PACKET_SIZE, timeout_ms=10)
 
-                if data and len(data) > 0:
+                if data and len(data) > 0 and not link.handle_packet(data):
                     # Process game message
                     if not process_game_message(device, data, score_manager):
                         # Message handling failed, likely disconnected
@@ -1290,7 +1550,7 @@ Features:
                     # Only send update if volume changed
                     if current_volume != last_volume:
                         print(f"🔊 Volume changed: {current_volume}%")
-                        if send_volume_update(device, current_volume):
+                        if link.send(device, volume=current_volume):
                             last_volume = current_volume
                         else:
                             # Send failed, likely disconnected
@@ -1320,7 +1580,7 @@ Features:
                         else:
                             print("♪ Playback stopped")
 
-                        if send_media_update(device, current_media if current_media else ""):
+                        if link.send(device, media=current_media if current_media else ""):
                             last_media = current_media
                         else:
                             # Send failed, likely disconnected
@@ -1341,7 +1601,7 @@ Features:
                 # Periodically send date/time updates (every minute, unless using test date)
                 # If using test date, only send once at connection
                 if not args.test_date and current_time - last_datetime_update >= DATETIME_UPDATE_INTERVAL:
-                    if send_datetime_update(device):
+                    if link.send(device, dt=datetime.now()):
                         last_datetime_update = current_time
                     else:
                         # Send failed, likely disconnected
@@ -1384,7 +1644,7 @@ Features:
                             }
                             print(f"🌤️  Weather changed: {weather_names.get(current_weather, 'Unknown')}")
 
-                            if send_weather_update(device, current_weather):
+                            if link.send(device, weather=current_weather):
                                 last_weather = current_weather
                                 last_weather_check = current_time
                             else:
@@ -1419,7 +1679,7 @@ Features:
                                 }
                                 print(f"💨 Wind changed: {wind_intensity_names.get(current_wind_intensity, 'Unknown')} {wind_direction_names.get(current_wind_direction, 'Unknown')}")
 
-                                if send_wind_update(device, current_wind_intensity, current_wind_direction):
+                                if link.send(device, wind=(current_wind_intensity, current_wind_direction)):
                                     last_wind_intensity = current_wind_intensity
                                     last_wind_direction = current_wind_direction
                                 else:
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Kernel accounting for the CPU stats raw HID export (quantum/cpu_stats.h):
+// the registry lets us enumerate threads, statistics give per-thread runtime
+// measurements plus IRQ/context-switch counters.
+#define CH_CFG_USE_REGISTRY TRUE
+#define CH_DBG_STATISTICS TRUE
+
+#include_next <chconf.h>
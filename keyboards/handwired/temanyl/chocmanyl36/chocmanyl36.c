@@ -0,0 +1,78 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "debounce.h"
+
+#ifdef RP2040_CLOCK_GOVERNOR_ENABLE
+#    include "clock_governor.h"
+#endif
+
+#ifdef RP2040_MATRIX_PIO_ENABLE
+#    include "matrix_pio.h"
+#endif
+
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+#    include "core1_executor.h"
+#endif
+
+// How often the learned debounce window table is flushed to the eeconfig datablock, at most.
+#ifndef ADAPTIVE_DEBOUNCE_SAVE_INTERVAL_MS
+#    define ADAPTIVE_DEBOUNCE_SAVE_INTERVAL_MS 30000
+#endif
+
+static uint32_t last_debounce_save = 0;
+
+void keyboard_post_init_kb(void) {
+    // Restore the adaptive debounce windows learned in previous sessions.
+    if (eeconfig_is_kb_datablock_valid()) {
+        uint8_t table[EECONFIG_KB_DATA_SIZE] = {0};
+        eeconfig_read_kb_datablock(table, 0, sizeof(table));
+        debounce_adaptive_import_table(table, sizeof(table));
+    }
+
+#ifdef RP2040_CLOCK_GOVERNOR_ENABLE
+    // Run at 200 MHz while the enclosed case stays cool, for faster painter flushes. Timing that
+    // must not scale with clk_sys is re-derived in clock_governor_sysclk_changed() below.
+    clock_governor_init();
+#endif
+
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+    // Bring up the second core's dispatch loop; the game manager offloads its framebuffer
+    // drawing there so matrix scanning doesn't wait out a frame (see game_manager_housekeeping).
+    core1_executor_start();
+#endif
+
+    keyboard_post_init_user();
+}
+
+#ifdef RP2040_CLOCK_GOVERNOR_ENABLE
+// Re-derive clk_sys-scaled timing after every governor transition. The PIO matrix scanner's row
+// settle window is counted in instruction cycles, so its divider must track sysclk or the window
+// shrinks ~38% at the boosted clock. The display's SPI divisor (16) deliberately stays fixed:
+// 200 MHz / 16 = 12.5 MHz is comfortably inside the ST7789's write-clock spec, and the faster
+// flush is the point of the boost.
+void clock_governor_sysclk_changed(uint32_t sysclk_hz) {
+#    ifdef RP2040_MATRIX_PIO_ENABLE
+    matrix_pio_sysclk_changed(sysclk_hz);
+#    else
+    (void)sysclk_hz;
+#    endif
+}
+#endif
+
+void housekeeping_task_kb(void) {
+#ifdef RP2040_CLOCK_GOVERNOR_ENABLE
+    clock_governor_task();
+#endif
+    // Flush learned windows at a slow cadence so chattering switches don't wear out the flash.
+    if (timer_elapsed32(last_debounce_save) >= ADAPTIVE_DEBOUNCE_SAVE_INTERVAL_MS) {
+        last_debounce_save = timer_read32();
+        if (debounce_adaptive_table_dirty()) {
+            uint8_t table[EECONFIG_KB_DATA_SIZE] = {0};
+            if (debounce_adaptive_export_table(table, sizeof(table))) {
+                eeconfig_update_kb_datablock(table, 0, sizeof(table));
+            }
+        }
+    }
+}
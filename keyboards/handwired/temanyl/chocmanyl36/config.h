@@ -0,0 +1,56 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Scanning is handled autonomously by a PIO state machine (see RP2040_MATRIX_PIO in rules.mk); matrix_scan() just
+// reads the latest DMA'd snapshot.
+
+// Defer action processing until after the full matrix scan; the default keymap's process_record_user() drives the
+// display, which would otherwise stall mid-scan.
+#define KEY_EVENT_QUEUE
+
+// Drain at most 8 queued events per scan cycle, carrying the rest over to the next; an event flood
+// (stuck key at plug-in, macro playback) then can't monopolize a loop iteration and starve the display.
+#define KEY_EVENT_QUEUE_QUOTA 8
+
+// Storage for the adaptive debounce window table: one byte per key (4x10 matrix).
+#define EECONFIG_KB_DATA_SIZE 40
+
+// Merge mod+key presses (e.g. shifted keycodes) into a single HID report instead of two back-to-back transfers.
+#define REPORT_COALESCING_ENABLE
+
+// Additionally merge releases from fast rolls (A down, B down, A up, B up) into fewer reports; the
+// keymap opts the arrow-layer gaming keys out via roll_coalescing_key_allowed().
+#define ROLL_COALESCING_ENABLE
+
+// Defer eeprom write-log appends to idle time; programming the RP2040's XIP flash stalls both cores, so a burst of
+// eeconfig updates (RGB stepping, layer state) would otherwise interrupt scanning once per write.
+#define WEAR_LEVELING_WRITE_BEHIND
+
+// Consolidate the eeprom write log proactively during verified-idle windows, one flash sector per increment,
+// so the log can't fill up and force a synchronous multi-ms erase mid-game.
+#define WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+
+// Decode keycodes to action categories through a 256-entry LUT plus a sorted range table instead of the
+// per-event cascaded range switch in action_for_keycode().
+#define ACTION_CATEGORY_LUT
+
+// The keymap is static (no VIA/dynamic keymaps), so layer transparency can be flattened into per-layer bitmaps and
+// layer_switch_get_layer() tests one bit per active layer instead of resolving an action from the keymap per layer.
+#define KEYMAP_FLATTENING
+
+// Pre-render upcoming timeline scene transitions (season/weather keyframes) into the framebuffer
+// during idle frames behind a held crossfade, so the switch itself is just a blend stream.
+#define SCENE_TIMELINE_PREFETCH
+
+// Track debounced key events per second; the keymap's frame pacing governor throttles display work while typing.
+#define MATRIX_EVENT_RATE
+
+// Tiered idle: lengthen the scan interval and idle the CPU between scans once the board sits untouched;
+// the keymap's display governor also drops to ~2 FPS at the deepest tier.
+#define IDLE_SCAN_GOVERNOR
+
+// Latency test-rig probe: GP26 pulses high from debounce commit to HID send when the probe mode is
+// toggled on (DISP_UP held + DISP_DN); a logic analyzer on the pin measures the external leg.
+#define KEY_LATENCY_PROBE_PIN GP26
@@ -17,13 +17,32 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
-// Define options
-#define TAPPING_TERM 250
-#define PERMISSIVE_HOLD
-#define TAPPING_TERM_PER_KEY
-#define ONESHOT_TIMEOUT 2000
+// Tap/hold tuning comes from the shared userspace (users/temanyl/config.h)
 
 // Quantum Painter display settings
 // Set to 0 to disable timeout and keep display always on
 // Default is 30000 (30 seconds)
 #define QUANTUM_PAINTER_DISPLAY_TIMEOUT 60000
+
+// Eeconfig user datablock on the wear-leveled flash log, so saves append to
+// the current page instead of erasing a sector. Offset 0: persistent high
+// score table (highscore_store.c). Offset 64: scene state snapshot
+// (scene_store.c). Growing the block changes the implicit datablock version,
+// so both reset once on the first boot after resizing
+#define EECONFIG_USER_DATA_SIZE 80
+
+// Store the background shadow buffer as row-RLE runs instead of a second 64 KB pixel
+// array; scene backgrounds compress to well under the 20 KB arena, freeing ~44 KB of
+// SRAM for the games and the QP caches. See display/framebuffer.h.
+#define FB_COMPRESSED_BACKGROUND
+
+// Staged bring-up: matrix scanning goes live first, then the ST7789 init (with its
+// >120ms of power/reset delays) runs as a deferred stage from the main loop, so the
+// first keystroke doesn't wait for the panel. See keyboard_post_init_deferred_kb().
+#define STAGED_INIT
+
+// A/B experiment under test: does a shorter base tapping term hurt on real typing?
+// Variant A keeps the userspace's 250ms term, variant B tries 200ms; the harness
+// alternates per boot and tags the latency/press counters by variant (experiment.h)
+#define EXPERIMENT_TAPPING_TERM_A 250
+#define EXPERIMENT_TAPPING_TERM_B 200
@@ -1,108 +0,0 @@
-// Auto-generated logo drawing code
-// Image size: 120x120
-#pragma once
-
-// Generic logo drawing function with color parameters
-static void draw_amboss_logo(uint16_t x_offset, uint16_t y_offset, uint8_t hue, uint8_t sat, uint8_t val) {
-    fb_line_hsv(59 + x_offset, 40 + y_offset, 60 + x_offset, 40 + y_offset, hue, sat, val);
-    fb_line_hsv(59 + x_offset, 41 + y_offset, 61 + x_offset, 41 + y_offset, hue, sat, val);
-    fb_line_hsv(58 + x_offset, 42 + y_offset, 61 + x_offset, 42 + y_offset, hue, sat, val);
-    fb_line_hsv(57 + x_offset, 43 + y_offset, 61 + x_offset, 43 + y_offset, hue, sat, val);
-    fb_line_hsv(57 + x_offset, 44 + y_offset, 60 + x_offset, 44 + y_offset, hue, sat, val);
-    fb_line_hsv(56 + x_offset, 45 + y_offset, 60 + x_offset, 45 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 45 + y_offset, 63 + x_offset, 45 + y_offset, hue, sat, val);
-    fb_line_hsv(56 + x_offset, 46 + y_offset, 59 + x_offset, 46 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 46 + y_offset, 63 + x_offset, 46 + y_offset, hue, sat, val);
-    fb_line_hsv(55 + x_offset, 47 + y_offset, 58 + x_offset, 47 + y_offset, hue, sat, val);
-    fb_line_hsv(61 + x_offset, 47 + y_offset, 64 + x_offset, 47 + y_offset, hue, sat, val);
-    fb_line_hsv(55 + x_offset, 48 + y_offset, 58 + x_offset, 48 + y_offset, hue, sat, val);
-    fb_line_hsv(61 + x_offset, 48 + y_offset, 64 + x_offset, 48 + y_offset, hue, sat, val);
-    fb_line_hsv(54 + x_offset, 49 + y_offset, 57 + x_offset, 49 + y_offset, hue, sat, val);
-    fb_line_hsv(60 + x_offset, 49 + y_offset, 65 + x_offset, 49 + y_offset, hue, sat, val);
-    fb_line_hsv(54 + x_offset, 50 + y_offset, 57 + x_offset, 50 + y_offset, hue, sat, val);
-    fb_line_hsv(60 + x_offset, 50 + y_offset, 65 + x_offset, 50 + y_offset, hue, sat, val);
-    fb_line_hsv(53 + x_offset, 51 + y_offset, 56 + x_offset, 51 + y_offset, hue, sat, val);
-    fb_line_hsv(59 + x_offset, 51 + y_offset, 66 + x_offset, 51 + y_offset, hue, sat, val);
-    fb_line_hsv(53 + x_offset, 52 + y_offset, 56 + x_offset, 52 + y_offset, hue, sat, val);
-    fb_line_hsv(59 + x_offset, 52 + y_offset, 67 + x_offset, 52 + y_offset, hue, sat, val);
-    fb_line_hsv(52 + x_offset, 53 + y_offset, 55 + x_offset, 53 + y_offset, hue, sat, val);
-    fb_line_hsv(58 + x_offset, 53 + y_offset, 61 + x_offset, 53 + y_offset, hue, sat, val);
-    fb_line_hsv(64 + x_offset, 53 + y_offset, 67 + x_offset, 53 + y_offset, hue, sat, val);
-    fb_line_hsv(51 + x_offset, 54 + y_offset, 55 + x_offset, 54 + y_offset, hue, sat, val);
-    fb_line_hsv(57 + x_offset, 54 + y_offset, 61 + x_offset, 54 + y_offset, hue, sat, val);
-    fb_line_hsv(64 + x_offset, 54 + y_offset, 68 + x_offset, 54 + y_offset, hue, sat, val);
-    fb_line_hsv(51 + x_offset, 55 + y_offset, 54 + x_offset, 55 + y_offset, hue, sat, val);
-    fb_line_hsv(57 + x_offset, 55 + y_offset, 60 + x_offset, 55 + y_offset, hue, sat, val);
-    fb_line_hsv(65 + x_offset, 55 + y_offset, 68 + x_offset, 55 + y_offset, hue, sat, val);
-    fb_line_hsv(50 + x_offset, 56 + y_offset, 54 + x_offset, 56 + y_offset, hue, sat, val);
-    fb_line_hsv(56 + x_offset, 56 + y_offset, 60 + x_offset, 56 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 56 + y_offset, 63 + x_offset, 56 + y_offset, hue, sat, val);
-    fb_line_hsv(65 + x_offset, 56 + y_offset, 69 + x_offset, 56 + y_offset, hue, sat, val);
-    fb_line_hsv(50 + x_offset, 57 + y_offset, 53 + x_offset, 57 + y_offset, hue, sat, val);
-    fb_line_hsv(56 + x_offset, 57 + y_offset, 59 + x_offset, 57 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 57 + y_offset, 63 + x_offset, 57 + y_offset, hue, sat, val);
-    fb_line_hsv(66 + x_offset, 57 + y_offset, 69 + x_offset, 57 + y_offset, hue, sat, val);
-    fb_line_hsv(49 + x_offset, 58 + y_offset, 52 + x_offset, 58 + y_offset, hue, sat, val);
-    fb_line_hsv(55 + x_offset, 58 + y_offset, 58 + x_offset, 58 + y_offset, hue, sat, val);
-    fb_line_hsv(61 + x_offset, 58 + y_offset, 64 + x_offset, 58 + y_offset, hue, sat, val);
-    fb_line_hsv(67 + x_offset, 58 + y_offset, 70 + x_offset, 58 + y_offset, hue, sat, val);
-    fb_line_hsv(49 + x_offset, 59 + y_offset, 52 + x_offset, 59 + y_offset, hue, sat, val);
-    fb_line_hsv(55 + x_offset, 59 + y_offset, 58 + x_offset, 59 + y_offset, hue, sat, val);
-    fb_line_hsv(61 + x_offset, 59 + y_offset, 64 + x_offset, 59 + y_offset, hue, sat, val);
-    fb_line_hsv(67 + x_offset, 59 + y_offset, 70 + x_offset, 59 + y_offset, hue, sat, val);
-    fb_line_hsv(48 + x_offset, 60 + y_offset, 51 + x_offset, 60 + y_offset, hue, sat, val);
-    fb_line_hsv(54 + x_offset, 60 + y_offset, 57 + x_offset, 60 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 60 + y_offset, 65 + x_offset, 60 + y_offset, hue, sat, val);
-    fb_line_hsv(68 + x_offset, 60 + y_offset, 71 + x_offset, 60 + y_offset, hue, sat, val);
-    fb_line_hsv(48 + x_offset, 61 + y_offset, 51 + x_offset, 61 + y_offset, hue, sat, val);
-    fb_line_hsv(54 + x_offset, 61 + y_offset, 57 + x_offset, 61 + y_offset, hue, sat, val);
-    fb_line_hsv(62 + x_offset, 61 + y_offset, 65 + x_offset, 61 + y_offset, hue, sat, val);
-    fb_line_hsv(68 + x_offset, 61 + y_offset, 71 + x_offset, 61 + y_offset, hue, sat, val);
-    fb_line_hsv(47 + x_offset, 62 + y_offset, 50 + x_offset, 62 + y_offset, hue, sat, val);
-    fb_line_hsv(53 + x_offset, 62 + y_offset, 56 + x_offset, 62 + y_offset, hue, sat, val);
-    fb_line_hsv(63 + x_offset, 62 + y_offset, 66 + x_offset, 62 + y_offset, hue, sat, val);
-    fb_line_hsv(69 + x_offset, 62 + y_offset, 72 + x_offset, 62 + y_offset, hue, sat, val);
-    fb_line_hsv(47 + x_offset, 63 + y_offset, 50 + x_offset, 63 + y_offset, hue, sat, val);
-    fb_line_hsv(53 + x_offset, 63 + y_offset, 56 + x_offset, 63 + y_offset, hue, sat, val);
-    fb_line_hsv(63 + x_offset, 63 + y_offset, 67 + x_offset, 63 + y_offset, hue, sat, val);
-    fb_line_hsv(69 + x_offset, 63 + y_offset, 73 + x_offset, 63 + y_offset, hue, sat, val);
-    fb_line_hsv(46 + x_offset, 64 + y_offset, 49 + x_offset, 64 + y_offset, hue, sat, val);
-    fb_line_hsv(52 + x_offset, 64 + y_offset, 55 + x_offset, 64 + y_offset, hue, sat, val);
-    fb_line_hsv(64 + x_offset, 64 + y_offset, 67 + x_offset, 64 + y_offset, hue, sat, val);
-    fb_line_hsv(70 + x_offset, 64 + y_offset, 73 + x_offset, 64 + y_offset, hue, sat, val);
-    fb_line_hsv(45 + x_offset, 65 + y_offset, 49 + x_offset, 65 + y_offset, hue, sat, val);
-    fb_line_hsv(51 + x_offset, 65 + y_offset, 55 + x_offset, 65 + y_offset, hue, sat, val);
-    fb_line_hsv(64 + x_offset, 65 + y_offset, 68 + x_offset, 65 + y_offset, hue, sat, val);
-    fb_line_hsv(70 + x_offset, 65 + y_offset, 74 + x_offset, 65 + y_offset, hue, sat, val);
-    fb_line_hsv(45 + x_offset, 66 + y_offset, 48 + x_offset, 66 + y_offset, hue, sat, val);
-    fb_line_hsv(51 + x_offset, 66 + y_offset, 54 + x_offset, 66 + y_offset, hue, sat, val);
-    fb_line_hsv(65 + x_offset, 66 + y_offset, 68 + x_offset, 66 + y_offset, hue, sat, val);
-    fb_line_hsv(71 + x_offset, 66 + y_offset, 74 + x_offset, 66 + y_offset, hue, sat, val);
-    fb_line_hsv(44 + x_offset, 67 + y_offset, 48 + x_offset, 67 + y_offset, hue, sat, val);
-    fb_line_hsv(50 + x_offset, 67 + y_offset, 54 + x_offset, 67 + y_offset, hue, sat, val);
-    fb_line_hsv(65 + x_offset, 67 + y_offset, 69 + x_offset, 67 + y_offset, hue, sat, val);
-    fb_line_hsv(71 + x_offset, 67 + y_offset, 75 + x_offset, 67 + y_offset, hue, sat, val);
-    fb_line_hsv(44 + x_offset, 68 + y_offset, 47 + x_offset, 68 + y_offset, hue, sat, val);
-    fb_line_hsv(50 + x_offset, 68 + y_offset, 53 + x_offset, 68 + y_offset, hue, sat, val);
-    fb_line_hsv(66 + x_offset, 68 + y_offset, 69 + x_offset, 68 + y_offset, hue, sat, val);
-    fb_line_hsv(72 + x_offset, 68 + y_offset, 75 + x_offset, 68 + y_offset, hue, sat, val);
-    fb_line_hsv(43 + x_offset, 69 + y_offset, 46 + x_offset, 69 + y_offset, hue, sat, val);
-    fb_line_hsv(49 + x_offset, 69 + y_offset, 52 + x_offset, 69 + y_offset, hue, sat, val);
-    fb_line_hsv(67 + x_offset, 69 + y_offset, 70 + x_offset, 69 + y_offset, hue, sat, val);
-    fb_line_hsv(73 + x_offset, 69 + y_offset, 76 + x_offset, 69 + y_offset, hue, sat, val);
-    fb_line_hsv(43 + x_offset, 70 + y_offset, 46 + x_offset, 70 + y_offset, hue, sat, val);
-    fb_line_hsv(49 + x_offset, 70 + y_offset, 52 + x_offset, 70 + y_offset, hue, sat, val);
-    fb_line_hsv(67 + x_offset, 70 + y_offset, 70 + x_offset, 70 + y_offset, hue, sat, val);
-    fb_line_hsv(73 + x_offset, 70 + y_offset, 76 + x_offset, 70 + y_offset, hue, sat, val);
-    fb_line_hsv(42 + x_offset, 71 + y_offset, 77 + x_offset, 71 + y_offset, hue, sat, val);
-    fb_line_hsv(42 + x_offset, 72 + y_offset, 77 + x_offset, 72 + y_offset, hue, sat, val);
-    fb_line_hsv(41 + x_offset, 73 + y_offset, 78 + x_offset, 73 + y_offset, hue, sat, val);
-    fb_line_hsv(41 + x_offset, 74 + y_offset, 78 + x_offset, 74 + y_offset, hue, sat, val);
-    fb_line_hsv(46 + x_offset, 75 + y_offset, 49 + x_offset, 75 + y_offset, hue, sat, val);
-    fb_line_hsv(70 + x_offset, 75 + y_offset, 73 + x_offset, 75 + y_offset, hue, sat, val);
-    fb_line_hsv(45 + x_offset, 76 + y_offset, 49 + x_offset, 76 + y_offset, hue, sat, val);
-    fb_line_hsv(70 + x_offset, 76 + y_offset, 74 + x_offset, 76 + y_offset, hue, sat, val);
-    fb_line_hsv(45 + x_offset, 77 + y_offset, 74 + x_offset, 77 + y_offset, hue, sat, val);
-    fb_line_hsv(44 + x_offset, 78 + y_offset, 75 + x_offset, 78 + y_offset, hue, sat, val);
-    fb_line_hsv(44 + x_offset, 79 + y_offset, 75 + x_offset, 79 + y_offset, hue, sat, val);
-}
@@ -20,12 +20,30 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include "temanyl.h"
 #include "display/display.h"
 #include "display/framebuffer.h"
 #include "game_manager.h"
+#include "highscore_store.h"
+#include "scene_store.h"
 #include "weather_transition.h"
 #include "scenes/scenes.h"
 #include "objects/weather/wind.h"
+#include "key_latency.h"
+#include "key_stats.h"
+#include "cpu_profiler.h"
+#include "cpu_stats.h"
+#include "benchmark.h"
+#ifdef ATOMIC_PROFILER_ENABLE
+#    include "atomic_profiler.h"
+#endif
+#ifdef EXPERIMENT_ENABLE
+#    include "experiment.h"
+#endif
+#include "hid_protocol.h"
+#include "hid_inbox.h"
+#include "scene_timeline.h"
+#include "media_image.h"
 
 // Custom keycodes
 enum custom_keycodes {
@@ -34,47 +52,11 @@ enum custom_keycodes {
     // Wind control is via HID (command 0x05), not keyboard keys
 };
 
-// Layer Names
+// Board-specific layers on top of the shared temanyl userspace layers
 enum layer_names {
-    _MAC_COLEMAK_DH,
-    _MAC_CODE,
-    _MAC_NAV,
-    _MAC_NUM,
-    _MAC_ARROW
-};
-
-// Tap Dance declarations
-enum {
-    TD_Q_ESC_EMOJI_RESET,
-    TD_ESC_WINDOWS_EMOJI,
-    TD_LAYER_NAV_NUM,
-    TD_LAYER_DEFAULT_SHIFT,
-    TD_OSL_CODE
+    _MAC_ARROW = TEMANYL_LAYER_SAFE
 };
 
-// Define a type for as many tap dance states as you need
-typedef enum {
-    TD_NONE,
-    TD_UNKNOWN,
-    TD_SINGLE_TAP,
-    TD_SINGLE_HOLD,
-    TD_DOUBLE_TAP
-} td_state_t;
-
-typedef struct {
-    bool is_press_action;
-    td_state_t state;
-} td_tap_t;
-
-// Forward declarations for tap dance functions
-td_state_t cur_dance(tap_dance_state_t *state);
-void nav_num_finished(tap_dance_state_t *state, void *user_data);
-void nav_num_reset(tap_dance_state_t *state, void *user_data);
-void layer_default_shift_finished(tap_dance_state_t *state, void *user_data);
-void layer_default_shift_reset(tap_dance_state_t *state, void *user_data);
-void osl_code_finished(tap_dance_state_t *state, void *user_data);
-void osl_code_reset(tap_dance_state_t *state, void *user_data);
-
 const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     [_MAC_COLEMAK_DH] = LAYOUT_ortho_3x10_6(
          TD(TD_Q_ESC_EMOJI_RESET), KC_W,  KC_F,    KC_P,  KC_B,           KC_J,  KC_L,          KC_U,              KC_Y,           LT(0,KC_SCLN),
@@ -108,160 +90,27 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     )
 };
 
-// tap dances again
-// Determine the current tap dance state
-td_state_t cur_dance(tap_dance_state_t *state) {
-    if (state->count == 1) {
-        if (!state->pressed) return TD_SINGLE_TAP;
-        else return TD_SINGLE_HOLD;
-    } else if (state->count == 2) return TD_DOUBLE_TAP;
-    else return TD_UNKNOWN;
-}
-
-// Initialize tap structure associated with example tap dance key
-static td_tap_t ql_tap_state = {
-    .is_press_action = true,
-    .state = TD_NONE
-};
-
-// Functions that control what our tap dance key does
-void nav_num_finished(tap_dance_state_t *state, void *user_data) {
-    ql_tap_state.state = cur_dance(state);
-    switch (ql_tap_state.state) {
-        case TD_SINGLE_TAP:
-           // Check to see if the layer is already set
-           if (layer_state_is(_MAC_NAV)) {
-               // If already set, then switch it off
-               layer_off(_MAC_NAV);
-           } else {
-               // If not already set, then switch the layer on
-               layer_on(_MAC_NAV);
-           }
-           break;
-        case TD_SINGLE_HOLD:
-            layer_on(_MAC_NUM);
-            break;
-        case TD_DOUBLE_TAP:
-            // Check to see if the layer is already set
-            if (layer_state_is(_MAC_NUM)) {
-                // If already set, then switch it off
-                layer_off(_MAC_NUM);
-            } else {
-                // If not already set, then switch the layer on
-                layer_on(_MAC_NUM);
-            }
-            break;
-        default:
-            break;
-    }
-}
-
-void nav_num_reset(tap_dance_state_t *state, void *user_data) {
-    // If the key was held down and now is released then switch off the layer
-    if (ql_tap_state.state != TD_DOUBLE_TAP) {
-        layer_off(_MAC_NUM);
-    }
-    ql_tap_state.state = TD_NONE;
-}
-
-// Functions that control what our tap dance key does
-void layer_default_shift_finished(tap_dance_state_t *state, void *user_data) {
-    ql_tap_state.state = cur_dance(state);
-    switch (ql_tap_state.state) {
-        case TD_SINGLE_TAP:
-           layer_clear();
-           break;
-        case TD_SINGLE_HOLD:
-            register_code(KC_LSFT);
-            break;
-        default:
-            break;
-    }
-}
-
-void layer_default_shift_reset(tap_dance_state_t *state, void *user_data) {
-    // If the key was held down and now is released then switch off the layer
-    if (ql_tap_state.state == TD_SINGLE_HOLD) {
-         unregister_code(KC_LSFT);
-    }
-    ql_tap_state.state = TD_NONE;
-}
-
-void osl_code_finished(tap_dance_state_t *state, void *user_data) {
-    ql_tap_state.state = cur_dance(state);
-    switch (ql_tap_state.state) {
-        case TD_SINGLE_TAP:
-            set_oneshot_layer(_MAC_CODE, ONESHOT_START);
-            break;
-        case TD_SINGLE_HOLD:
-            layer_on(_MAC_CODE);
-            break;
-        default:
-            break;
-    }
-}
-
-void osl_code_reset(tap_dance_state_t *state, void *user_data) {
-    ql_tap_state.state = cur_dance(state);
-    // If the key was held down and now is released then switch off the layer
-    if (ql_tap_state.state == TD_SINGLE_TAP) {
-        clear_oneshot_layer_state(ONESHOT_PRESSED);
-    } else {
-        layer_clear();
-    }
-}
-
-void td_q_esc_emoji_reset (tap_dance_state_t *state, void *user_data) {
-    if (state->count == 1) {
-        tap_code(KC_Q);
-    } else if (state->count == 2) {
-        tap_code(KC_ESC);
-    } else if (state->count == 3) {
-        tap_code16(C(G(KC_SPC)));
-    } else if (state->count == 5) {
-        reset_keyboard();
-    }
-}
 
-// Tap Dance definitions
-tap_dance_action_t tap_dance_actions[] = {
-    [TD_Q_ESC_EMOJI_RESET]   = ACTION_TAP_DANCE_FN(td_q_esc_emoji_reset),
-    [TD_LAYER_NAV_NUM]       = ACTION_TAP_DANCE_FN_ADVANCED(NULL, nav_num_finished, nav_num_reset),
-    [TD_LAYER_DEFAULT_SHIFT] = ACTION_TAP_DANCE_FN_ADVANCED(NULL, layer_default_shift_finished, layer_default_shift_reset),
-    [TD_OSL_CODE]            = ACTION_TAP_DANCE_FN_ADVANCED(NULL, osl_code_finished, osl_code_reset)
-};
+// Tracks the DISP_UP key for the latency-probe magic chord (DISP_UP held + DISP_DN)
+static bool disp_up_held = false;
 
-uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+// Keep the game controls on the immediate report path -- a merged roll release would add up to a
+// scan of input lag, which matters for Tetris/Doodle play but not for prose.
+bool roll_coalescing_key_allowed(uint8_t keycode) {
     switch (keycode) {
-        case TD(TD_Q_ESC_EMOJI_RESET):
-        case TD(TD_ESC_WINDOWS_EMOJI):
-        case LGUI_T(KC_SPC):
-        case LT(1, KC_TAB):
-        case LT(2, KC_ENT):
-            return 200;
-        case TD(TD_LAYER_DEFAULT_SHIFT):
-            return 180;
-        case LT(0,KC_SCLN):
-            return 155;
-        default:
-            return TAPPING_TERM;
-    }
-}
-
-bool send_hold_code(uint16_t keycode, keyrecord_t *record) {
-    if (!record->tap.count && record->event.pressed) {
-        tap_code16(G(keycode)); // Intercept hold function to send Ctrl-X
-        return false;
+        case KC_UP:
+        case KC_DOWN:
+        case KC_LEFT:
+        case KC_RIGHT:
+        case KC_SPACE:
+            return false;
     }
     return true;
 }
 
-// Initialize variable holding the binary representation of active modifiers
-uint8_t mod_state;
-
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    mod_state = get_mods();
-
+// Board-specific keycodes; the shared handling (enter-on-hold ';', shift+backspace
+// = delete) runs afterwards in the userspace's process_record_user()
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
     // Handle game manager input on arrow layer
     if (layer_state_is(_MAC_ARROW)) {
         if (!game_manager_process_record(keycode, record, &current_display_layer)) {
@@ -270,43 +119,8 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     }
 
     switch (keycode) {
-        case LT(0,KC_SCLN):
-            if (!record->tap.count && record->event.pressed) {
-                tap_code(KC_ENT);
-                return false;
-            }
-            return true;
-        case KC_BSPC:
-        {
-            // Initialize a boolean variable that keeps track
-            // of the delete key status: registered or not?
-            static bool delkey_registered;
-            if (record->event.pressed) {
-                // Detect the activation of either shift keys
-                if (mod_state & MOD_MASK_SHIFT) {
-                    // First temporarily canceling both shifts so that
-                    // shift isn't applied to the KC_DEL keycode
-                    del_mods(MOD_MASK_SHIFT);
-                    register_code(KC_DEL);
-                    // Update the boolean variable to reflect the status of KC_DEL
-                    delkey_registered = true;
-                    // Reapplying modifier state so that the held shift key(s)
-                    // still work even after having tapped the Backspace/Delete key.
-                    set_mods(mod_state);
-                    return false;
-                }
-            } else { // on release of KC_BSPC
-                // In case KC_DEL is still being sent even after the release of KC_BSPC
-                if (delkey_registered) {
-                    unregister_code(KC_DEL);
-                    delkey_registered = false;
-                    return false;
-                }
-            }
-            // Let QMK process the KC_BSPC keycode as usual outside of shift
-            return true;
-        }
         case DISP_UP:
+            disp_up_held = record->event.pressed;
             if (record->event.pressed) {
                 // Increase brightness by ~10% (25 steps)
                 if (backlight_brightness < 230) {
@@ -318,6 +132,14 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             return false;
         case DISP_DN:
             if (record->event.pressed) {
+#ifdef KEY_LATENCY_PROBE_PIN
+                // Magic chord: DISP_DN while DISP_UP is held toggles the latency test-rig probe
+                // (GPIO pulse from debounce commit to HID send, measured externally)
+                if (disp_up_held) {
+                    key_latency_probe_set(!key_latency_probe_enabled());
+                    return false;
+                }
+#endif
                 // Decrease brightness by ~10% (25 steps)
                 if (backlight_brightness > 25) {
                     set_backlight_brightness(backlight_brightness - 25);
@@ -330,9 +152,20 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
-void keyboard_post_init_kb(void) {
+// Runs as the last STAGED_INIT stage, a few loop iterations after the matrix is
+// already scanning: the display's power/reset delays no longer sit between
+// plug-in and the first keystroke.
+void keyboard_post_init_deferred_kb(void) {
+    // Restore the persisted scene snapshot first: the saved month/time select
+    // the season and day phase the first paint renders (weather and wind are
+    // re-applied from inside init_display, after their subsystems come up)
+    scene_store_init();
+
     // Initialize the display
     init_display();
+
+    // Mirror the persisted high score table into RAM
+    highscore_store_init();
 }
 
 // Layer state change callback
@@ -354,6 +187,31 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return state;
 }
 
+// Display workloads for the benchmark harness (raw HID command 0x09). Each call is one iteration;
+// the colors/strings alternate so every iteration pushes real pixel data rather than a cached frame.
+bool benchmark_workload_kb(uint8_t workload) {
+    static bool phase = false;
+    phase             = !phase;
+
+    switch (workload) {
+        case BENCHMARK_WORKLOAD_KB + 0:  // framebuffer rect fill + flush of a 64x64 region
+            fb_rect(0, 0, 63, 63, phase ? FB_COLOR_WHITE : FB_COLOR_BLACK, true);
+            fb_flush_region(display, 0, 0, 63, 63);
+            return true;
+
+        case BENCHMARK_WORKLOAD_KB + 1:  // direct qp_rect 64x64 panel fill (raw SPI throughput)
+            qp_rect(display, 0, 0, 63, 63, 0, 0, phase ? 255 : 0, true);
+            return true;
+
+        case BENCHMARK_WORKLOAD_KB + 2:  // font rendering + comms via qp_drawtext
+            qp_drawtext(display, 0, 0, media_font, phase ? "benchmark 0123456789" : "BENCHMARK 9876543210");
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 // Raw HID receive callback - handles data from computer
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     // Protocol:
@@ -363,186 +221,161 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
     //   0x03 = Date/Time update (Bytes 1-7: year_low, year_high, month, day, hour, minute, second)
     //   0x04 = Weather control (Byte 1: weather state 0=sunny, 1-3=rain, 4-6=snow, 7=cloudy, 8=overcast)
     //   0x05 = Wind control (Byte 1: intensity 0=none, 1=light, 2=medium, 3=high; Byte 2: direction 0=left, 1=right)
+    //   0x06 = Key latency stats (Byte 1: 0=read, 1=reset; response: histogram, see key_latency.h)
+    //   0x07 = Game frame stats (Byte 1: 0=read, 1=reset; response: five uint32 LE counters, see game_manager.h)
+    //   0x08 = CPU profiler stats (Byte 1: probe id to read, 0xFF=reset all; response: per-probe counters, see cpu_profiler.h)
+    //   0x09 = Run microbenchmark (Byte 1: workload id, Bytes 2-5: iterations LE; response: see benchmark.h;
+    //          the keyboard does not scan for the duration of the run)
+    //   0x0B = Atomic section profiler (Byte 1: site index to read, 0xFF=reset all; response: per-site
+    //          counters, see atomic_profiler.h; only with ATOMIC_PROFILER_ENABLE)
+    //   0x0C = Per-key actuation analytics (Byte 1: 0=info, 1=key histogram with Bytes 2-4 row/col/kind,
+    //          0xFF=reset; response: see key_stats.h)
+    //   0x0D = A/B experiment harness (Byte 1: 0=status, 1=variant counters with Byte 2 variant,
+    //          2=set mode with Byte 2 mode, 0xFF=reset counters; see experiment.h; only with EXPERIMENT_ENABLE)
+    //   0x20 = Framed multi-field update, 0x21 = its ACK (protocol v2, see hid_protocol.h)
+    //   0x22 = Scene timeline upload chunk, 0x23 = its ACK, 0x24 = timeline start/stop/status
+    //          (firmware-side keyframe schedule, see scene_timeline.h)
+    //   0x26 = Streamed image upload (begin/data/commit/abort), 0x27 = its ACK
+    //          (windowed, CRC per chunk, double-buffered handoff; see media_image.h)
+    // State pushes (0x01-0x05 and v2 frames) land in the inbox and are applied at the
+    // next display frame boundary, so a host push never interleaves with an
+    // in-progress flush (see hid_inbox.h). Query commands respond inline below.
+
+    if (hid_inbox_push(data, length)) {
+        return;
+    }
+
+    // Timeline upload/control; applies happen later in scene_timeline_task() at frame boundaries
+    if (scene_timeline_hid_receive(data, length)) {
+        return;
+    }
+
+    // Image upload stream; the buffer swap happens later in media_image_task() at frame boundaries
+    if (media_image_hid_receive(data, length)) {
+        return;
+    }
 
     if (length < 2) return;  // Need at least 2 bytes
 
     uint8_t command = data[0];
 
     switch (command) {
-        case 0x01:  // Volume update
-            current_volume = data[1];
-            // Clamp to 0-100 range
-            if (current_volume > 100) {
-                current_volume = 100;
+        case 0x06:  // Key latency stats (Byte 1: 0 = read histogram, 1 = reset)
+            if (data[1] == 1) {
+                key_latency_reset();
             }
+            key_latency_fill_report(&data[1], length - 1);
+            raw_hid_send(data, length);
+            break;
 
-            // Update the permanent volume bar
-            uint8_t layer = get_highest_layer(layer_state);
-            uint8_t hue, sat, val;
-            get_layer_color(layer, &hue, &sat, &val);
-            draw_volume_bar(hue, sat, val);
-            qp_flush(display);  // Flush QP info area only
+        case 0x07: {  // Game frame stats (Byte 1: 0 = read counters, 1 = reset)
+            if (data[1] == 1) {
+                game_manager_reset_frame_stats();
+            }
+            game_frame_stats_t stats;
+            game_manager_get_frame_stats(&stats);
+            const uint32_t counters[5] = {stats.ticks, stats.frames, stats.skipped_ticks, stats.skipped_frames, stats.over_budget};
+            memset(&data[1], 0, length - 1);
+            for (uint8_t i = 0; i < 5 && (uint8_t)(1 + (i + 1) * 4) <= length; i++) {
+                data[1 + i * 4 + 0] = counters[i] & 0xFF;
+                data[1 + i * 4 + 1] = (counters[i] >> 8) & 0xFF;
+                data[1 + i * 4 + 2] = (counters[i] >> 16) & 0xFF;
+                data[1 + i * 4 + 3] = (counters[i] >> 24) & 0xFF;
+            }
+            raw_hid_send(data, length);
             break;
+        }
 
-        case 0x02:  // Media text update
-            {
-                // Copy media text (null-terminated string starting at byte 1)
-                bool text_changed = false;
-                if (data[1] == 0) {
-                    // Empty string = no media playing
-                    if (media_active) {
-                        media_active = false;
-                        current_media[0] = '\0';
-                        text_changed = true;
-                    }
-                } else {
-                    // Copy media text
-                    char new_media[sizeof(current_media)];
-                    strncpy(new_media, (char*)&data[1], sizeof(new_media) - 1);
-                    new_media[sizeof(new_media) - 1] = '\0';
-
-                    // Only update if text changed
-                    if (strcmp(current_media, new_media) != 0) {
-                        strncpy(current_media, new_media, sizeof(current_media) - 1);
-                        current_media[sizeof(current_media) - 1] = '\0';
-                        media_active = true;
-                        text_changed = true;
-                    }
-                }
+        case 0x08:  // CPU profiler stats (Byte 1: probe id to read, 0xFF = reset all)
+            if (data[1] == 0xFF) {
+                cpu_profiler_reset();
+                raw_hid_send(data, length);
+                break;
+            }
+            if (cpu_profiler_fill_report(data[1], &data[1], length - 1) > 0) {
+                raw_hid_send(data, length);
+            }
+            break;
 
-                // Only redraw if text actually changed
-                if (text_changed) {
-                    // Reset scroll state for new text
-                    scroll_position = 0;
-                    text_length = 0;
-                    needs_scroll = false;
-                    scroll_timer = timer_read32();
-                    draw_media_text();
-                    qp_flush(display);  // Flush QP info area only
-                }
+        case 0x09: {  // Run microbenchmark (Byte 1: workload id, Bytes 2-5: iterations LE)
+            if (length < 6) break;
+            uint32_t iterations = (uint32_t)data[2] | ((uint32_t)data[3] << 8) | ((uint32_t)data[4] << 16) | ((uint32_t)data[5] << 24);
+            benchmark_result_t result;
+            if (benchmark_run(data[1], iterations, &result) && benchmark_fill_report(data[1], &result, &data[1], length - 1) > 0) {
+                raw_hid_send(data, length);
             }
             break;
+        }
 
-        case 0x03:  // Date/Time update
-            if (length >= 8) {
-#ifdef HARDCODE_DATE_TIME
-    #if IGNORE_HID_TIME_UPDATES
-                // Hard-coded date mode is active - ignore HID time updates
+#ifdef ATOMIC_PROFILER_ENABLE
+        case 0x0B:  // Atomic section profiler (Byte 1: site index to read, 0xFF = reset all)
+            if (data[1] == 0xFF) {
+                atomic_profiler_reset();
+                raw_hid_send(data, length);
                 break;
-    #endif
+            }
+            if (atomic_profiler_fill_report(data[1], &data[1], length - 1) > 0) {
+                raw_hid_send(data, length);
+            }
+            break;
 #endif
-                // Extract date/time components
-                current_year = data[1] | (data[2] << 8);  // 16-bit year
-                uint8_t new_month = data[3];
-                current_day = data[4];
-                current_hour = data[5];
-                current_minute = data[6];
-                // data[7] is seconds, but we don't display it
-
-                // Validate ranges
-                if (new_month < 1 || new_month > 12) new_month = 1;
-                if (current_day < 1 || current_day > 31) current_day = 1;
-                if (current_hour > 23) current_hour = 0;
-                if (current_minute > 59) current_minute = 0;
-
-                // If month changed, update weather to match new season default
-                if (new_month != current_month) {
-                    current_month = new_month;
-                    weather_transition_init(current_month);
-
-                    // Reset animation flags for new season/weather
-                    extern bool rain_initialized, rain_background_saved;
-                    extern bool snowflake_initialized, snowflake_background_saved;
-                    extern bool cloud_initialized, cloud_background_saved;
-
-                    rain_initialized = false;
-                    rain_background_saved = false;
-                    snowflake_initialized = false;
-                    snowflake_background_saved = false;
-                    cloud_initialized = false;
-                    cloud_background_saved = false;
-
-                    // Force complete display redraw
-                    current_display_layer = 255;
-                    draw_seasonal_animation();
-                    fb_flush(display);
-                } else {
-                    current_month = new_month;
-                }
-
-                time_received = true;
-                last_uptime_update = timer_read32();
 
-                // Note: We do NOT trigger deferred_display_update_pending here for time changes
-                // The hour/day change detection in display_housekeeping_task() (display.c:638-653)
-                // will handle updates intelligently by only resetting background_saved flags
-                // rather than doing a full animation reset. This allows animated elements
-                // (snowflakes, rain, clouds, etc.) to persist across hour changes.
+        case 0x0C:  // Per-key actuation analytics (Byte 1: 0 = info, 1 = key histogram, 0xFF = reset)
+            switch (data[1]) {
+                case 0x00:
+                    if (key_stats_fill_info(&data[2], length - 2) > 0) {
+                        raw_hid_send(data, length);
+                    }
+                    break;
+                case 0x01:  // Bytes 2-4: row, col, kind (0 = hold duration, 1 = inter-key interval)
+                    if (length >= 5 && key_stats_fill_key(data[2], data[3], data[4], &data[5], length - 5) > 0) {
+                        raw_hid_send(data, length);
+                    }
+                    break;
+                case 0xFF:
+                    key_stats_reset();
+                    raw_hid_send(data, length);
+                    break;
             }
             break;
 
-        case 0x04:  // Weather control
-            if (length >= 2) {
-                uint8_t weather = data[1];
-
-                // Validate weather state (0=sunny, 1-3=rain, 4-6=snow, 7-8=cloudy)
-                if (weather <= 8) {
-                    weather_transition_set_target((weather_state_t)weather);
-
-                    // Reset animation flags to force re-initialization
-                    // This ensures particles are redrawn when weather changes
-                    extern bool rain_initialized, rain_background_saved;
-                    extern bool snowflake_initialized, snowflake_background_saved;
-                    extern bool cloud_initialized, cloud_background_saved;
-
-                    rain_initialized = false;
-                    rain_background_saved = false;
-                    snowflake_initialized = false;
-                    snowflake_background_saved = false;
-                    cloud_initialized = false;
-                    cloud_background_saved = false;
-
-                    // Force a complete display redraw to clear old weather particles
-                    extern uint8_t current_display_layer;
-                    extern painter_device_t display;
-                    current_display_layer = 255;  // Force full redraw on next update
-
-                    // Redraw the scene immediately with new weather
-                    draw_seasonal_animation();
-
-                    // Flush the entire scene to display to clear old particles
-                    fb_flush(display);
+        case 0x0A:  // OS CPU stats (Byte 1: thread index to read, 0xFE = kernel IRQ/switch counters)
+            if (data[1] == 0xFE) {
+                if (cpu_stats_fill_kernel_report(&data[1], length - 1) > 0) {
+                    raw_hid_send(data, length);
                 }
+                break;
+            }
+            if (cpu_stats_fill_thread_report(data[1], &data[1], length - 1) > 0) {
+                raw_hid_send(data, length);
             }
             break;
 
-        case 0x05:  // Wind control
-            if (length >= 3) {
-                uint8_t intensity = data[1];
-                uint8_t direction = data[2];
-
-                // Validate intensity (0-3) and direction (0-1)
-                if (intensity <= 3 && direction <= 1) {
-                    wind_set_state((wind_intensity_t)intensity, (wind_direction_t)direction);
-
-                    // Reset cloud animation to pick up new wind velocity
-                    extern bool cloud_initialized, cloud_background_saved;
-                    cloud_initialized = false;
-                    cloud_background_saved = false;
-
-                    // Force a display redraw to show new wind effects
-                    extern uint8_t current_display_layer;
-                    extern painter_device_t display;
-                    current_display_layer = 255;  // Force full redraw on next update
-
-                    // Redraw the scene immediately with new wind
-                    draw_seasonal_animation();
-
-                    // Flush the entire scene to display
-                    fb_flush(display);
-                }
+#ifdef EXPERIMENT_ENABLE
+        case 0x0D:  // A/B experiment harness (Byte 1: 0 = status, 1 = variant counters, 2 = set mode, 0xFF = reset)
+            switch (data[1]) {
+                case 0x00:  // Response: mode, active variant
+                    data[2] = experiment_mode();
+                    data[3] = experiment_variant();
+                    raw_hid_send(data, length);
+                    break;
+                case 0x01:  // Byte 2: variant (0 = A, 1 = B)
+                    experiment_flush();  // so the response matches what EEPROM will hold
+                    if (experiment_fill_report(data[2], &data[3], length - 3) > 0) {
+                        raw_hid_send(data, length);
+                    }
+                    break;
+                case 0x02:  // Byte 2: mode (0 = alternate, 1 = pin A, 2 = pin B); applies next boot
+                    experiment_set_mode(data[2]);
+                    raw_hid_send(data, length);
+                    break;
+                case 0xFF:
+                    experiment_reset();
+                    raw_hid_send(data, length);
+                    break;
             }
             break;
+#endif
 
         default:
             // Check if it's a game high score command
@@ -555,13 +388,55 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
     }
 }
 
+// Frame pacing governor: scene/animation work competes with matrix scanning for
+// the core, so display frames are throttled by input load. Idle boards keep the
+// full animation rate; during a typing burst frames drop to a trickle so
+// worst-case input latency stays flat. Games bypass this entirely -- the game
+// manager runs its own fixed-timestep scheduler (and when it is active, normal
+// display housekeeping is skipped, i.e. 0 FPS for the scene layer).
+#define DISPLAY_FRAME_INTERVAL_IDLE_MS 33      // ~30 FPS while idle
+#define DISPLAY_FRAME_INTERVAL_TYPING_MS 200   // ~5 FPS during typing bursts
+#define DISPLAY_FRAME_INTERVAL_DEEP_IDLE_MS 500 // ~2 FPS once the board has sat untouched for minutes
+#define DISPLAY_TYPING_EVENT_RATE 4            // key events/sec that counts as a burst
+
 // Periodically check and update display based on active layer
 void housekeeping_task_user(void) {
+    // Staged init: the display (and high score mirror) come up via
+    // keyboard_post_init_deferred_kb(); nothing below is safe before then.
+    if (display == NULL) {
+        return;
+    }
+
+    // Write out any pending high score change (no-op unless dirty)
+    highscore_store_task();
+
+    // Snapshot scene state and commit it once it settles (no-op most passes)
+    scene_store_task();
+
     // Handle game manager when on arrow layer
     if (game_manager_housekeeping(display)) {
+        // Game frames are frame boundaries too - drain the inbox here so host
+        // pushes (and their v2 ACKs) keep flowing during a game
+        hid_inbox_task();
         return;  // Game manager handled the update, skip normal display updates
     }
 
+    static uint32_t last_display_frame = 0;
+    uint32_t frame_interval = (get_matrix_event_rate() >= DISPLAY_TYPING_EVENT_RATE) ? DISPLAY_FRAME_INTERVAL_TYPING_MS : DISPLAY_FRAME_INTERVAL_IDLE_MS;
+#ifdef IDLE_SCAN_GOVERNOR
+    if (idle_scan_tier() == 2) {
+        frame_interval = DISPLAY_FRAME_INTERVAL_DEEP_IDLE_MS;
+    }
+#endif
+    if (timer_elapsed32(last_display_frame) < frame_interval) {
+        return;
+    }
+    last_display_frame = timer_read32();
+
+    // Frame boundary: apply any host pushes that arrived since the last frame,
+    // then render on top of the settled state
+    hid_inbox_task();
+
     // Delegate all display-related housekeeping to the display module
     display_housekeeping_task();
 }
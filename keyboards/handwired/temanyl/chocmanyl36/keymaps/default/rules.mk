@@ -1,27 +1,27 @@
+# The keymap is named "default" but shares the temanyl userspace (users/temanyl),
+# which is otherwise only picked up for keymaps literally named "temanyl"
+USER_NAME = temanyl
+
 TAP_DANCE_ENABLE = yes
-QUANTUM_PAINTER_ENABLE = yes
-QUANTUM_PAINTER_DRIVERS += st7789_spi
 
-# Framebuffer support
-SRC += display/framebuffer.c
+# Shared display/scene engine and the games, from users/temanyl; the panel
+# geometry/pins use the engine's LILYGO T-Display RP2040 defaults
+TEMANYL_DISPLAY_ENGINE = yes
+TEMANYL_GAMES = yes
 
-# Display and scene rendering
-SRC += display/display.c scenes/scenes.c
+# Press-to-report latency instrumentation (raw HID command 0x06)
+KEY_LATENCY_ENABLE = yes
 
-# Games
-SRC += game_doodle.c game_tetris.c game_manager.c
+# Per-key hold-duration/inter-key-interval histograms for tuning tapping terms (raw HID command 0x0C)
+KEY_STATS_ENABLE = yes
 
-# Season modules
-SRC += seasons/winter/seasons_winter.c seasons/spring/seasons_spring.c seasons/summer/seasons_summer.c seasons/fall/seasons_fall.c seasons/halloween/seasons_halloween.c seasons/christmas/seasons_christmas.c seasons/easter/seasons_easter.c seasons/newyear/seasons_newyear.c
+# Per-subsystem CPU time probes (raw HID command 0x08)
+CPU_PROFILER_ENABLE = yes
 
-# Weather transition system
-SRC += weather_transition.c weather_effects.c
+# ChibiOS thread/IRQ CPU accounting (raw HID command 0x0A)
+CPU_STATS_ENABLE = yes
 
-# Drawable objects
-SRC += objects/seasonal/pumpkin.c objects/seasonal/ghost.c objects/seasonal/snowman.c objects/seasonal/easter_egg.c
-SRC += objects/weather/smoke.c objects/weather/cloud.c objects/weather/raindrop.c objects/weather/wind.c
-SRC += objects/celestial/sun.c objects/celestial/moon.c objects/celestial/stars.c objects/celestial/astronomical.c
-SRC += objects/structures/tree.c objects/structures/cabin.c
-SRC += objects/flora/flower.c objects/flora/sunflower.c objects/flora/fallen_leaf.c
-SRC += objects/fauna/bird.c objects/fauna/butterfly.c objects/fauna/bee.c objects/fauna/firefly.c objects/fauna/bunny.c
-SRC += objects/effects/snowflake.c objects/effects/snow_drift.c objects/effects/airplane.c
+# A/B experiment harness with eeconfig-persisted per-variant counters (raw HID
+# command 0x0D); dynamic tapping term lets the variants carry different terms
+EXPERIMENT_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
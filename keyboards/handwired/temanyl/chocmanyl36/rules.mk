@@ -1,3 +1,30 @@
 BOOTLOADER = rp2040
 
+# Offload display rendering to the second core
+RP2040_CORE1_EXECUTOR = yes
+
+# Autonomous PIO+DMA matrix scanning
+RP2040_MATRIX_PIO = yes
+
+# Boost sysclk to 200 MHz while the die is cool, shed at 60 C (internal temperature sensor)
+RP2040_CLOCK_GOVERNOR = yes
+
+# Warm-boot handoff: reattach the still-powered display after a flash instead of blanking it
+WARM_BOOT_ENABLE = yes
+
 # Raw HID is enabled in keyboard.json for high score communication
+
+# Per-key adaptive debounce; the learned window table is persisted in the eeconfig keyboard datablock
+DEBOUNCE_TYPE = sym_defer_pk_adaptive
+
+# Compile out default-on keycode-driven features whose keycodes are absent from the keymap
+KEYMAP_DEAD_CODE_ELIMINATION = yes
+
+# Size the NKRO bitmap from the keycodes the keymap actually references
+NKRO_COMPACT_REPORT = yes
+
+# Inline the layer/combo/tap-dance counts as build-time literals so their callers constant-fold
+KEYMAP_INTROSPECTION_CONSTANTS = yes
+
+# On-keyboard microbenchmark harness, driven over raw HID (command 0x09)
+BENCHMARK_ENABLE = yes
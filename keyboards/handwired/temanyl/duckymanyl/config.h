@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Backlight LED strip MOSFET gate; GP27 shares PWM slice 5 with GP26, which the DMA breathing
+// driver owns outright (see RP2040_BACKLIGHT_DMA in rules.mk) -- keep GP27 off PWM duty.
+#define BACKLIGHT_PIN GP26
+#define BACKLIGHT_LEVELS 8
+#define BACKLIGHT_BREATHING
@@ -1 +1,10 @@
 BOOTLOADER = rp2040
+
+# Compile out default-on keycode-driven features whose keycodes are absent from the keymap
+KEYMAP_DEAD_CODE_ELIMINATION = yes
+
+# Zero-CPU breathing: a spare PWM slice paces DMA transfers of the precomputed
+# curve into the backlight slice's compare register
+BACKLIGHT_ENABLE = yes
+BACKLIGHT_DRIVER = custom
+RP2040_BACKLIGHT_DMA = yes
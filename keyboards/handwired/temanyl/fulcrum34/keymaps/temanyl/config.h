@@ -17,9 +17,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
-// Define options
-#define IGNORE_MOD_TAP_INTERRUPT
-#define TAPPING_TERM 250
-#define PERMISSIVE_HOLD
-#define TAPPING_TERM_PER_KEY
-#define ONESHOT_TIMEOUT 2000
+// Tap/hold tuning comes from the shared userspace (users/temanyl/config.h)
+
+// Event-driven WPM: the sampled engine re-sums its ring buffer from decay_wpm() every
+// scan loop pass; the EMA engine only does work on keystrokes, which keeps the scan
+// loop clear while the bongo cat animation polls get_current_wpm().
+#define WPM_EVENT_DRIVEN
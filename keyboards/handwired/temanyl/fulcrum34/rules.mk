@@ -1 +1,4 @@
 # This file intentionally left blank
+
+# Compile out default-on keycode-driven features whose keycodes are absent from the keymap
+KEYMAP_DEAD_CODE_ELIMINATION = yes
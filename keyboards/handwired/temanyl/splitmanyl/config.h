@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Battery sense divider on the one free ADC-capable pin (GP0-22 are matrix).
+#define BATTERY_ADC_PIN GP28
+
+// Filtered state-of-charge with exponential sampling backoff: ~1s cadence while the voltage moves,
+// easing off to the 30s default once it settles. The display widget reads the cached value for free.
+#define BATTERY_ADAPTIVE_SAMPLING
@@ -17,12 +17,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
+// Tap/hold tuning comes from the shared userspace (users/temanyl/config.h)
+
 // Define options
-#define IGNORE_MOD_TAP_INTERRUPT
-#define TAPPING_TERM 250
-#define PERMISSIVE_HOLD
-#define TAPPING_TERM_PER_KEY
-#define ONESHOT_TIMEOUT 2000
 #define ENCODERS_PAD_A { GP15, GP10 }
 #define ENCODERS_PAD_B { GP12, GP7 }
 #define ENCODER_DIRECTION_FLIP
+
+// Battery prototype: drop the scan rate after inactivity and let the RP2040 idle between scans
+#define IDLE_SCAN_GOVERNOR
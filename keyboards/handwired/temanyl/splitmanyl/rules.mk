@@ -1 +1,8 @@
 BOOTLOADER = rp2040
+
+# Compile out default-on keycode-driven features whose keycodes are absent from the keymap
+KEYMAP_DEAD_CODE_ELIMINATION = yes
+
+# Battery monitoring via the ADC divider on GP28 (adaptive sampling engine, see config.h)
+BATTERY_ENABLE = yes
+BATTERY_DRIVER = adc
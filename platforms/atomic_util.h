@@ -29,6 +29,19 @@
 #        define ATOMIC_FORCEON STATIC_ASSERT(0, "ATOMIC_FORCEON not implemented")
 #        define ATOMIC_RESTORESTATE STATIC_ASSERT(0, "ATOMIC_RESTORESTATE not implemented")
 #    endif
+#    ifdef ATOMIC_PROFILER_ENABLE
+/* Instrumented variants: wrap the platform block in an outer scope whose cleanup records
+ * per-call-site entry count, cumulative masked time and worst masked duration. Only the
+ * named wrappers are instrumented -- bare ATOMIC_BLOCK(type) keeps the platform expansion,
+ * both because the AVR form cannot be re-expanded here and because the profiler's own
+ * timestamping depends on it staying unwrapped (see quantum/atomic_profiler.h). */
+#        include "atomic_profiler.h"
+#        undef ATOMIC_BLOCK_RESTORESTATE
+#        undef ATOMIC_BLOCK_FORCEON
+#        define ATOMIC_PROFILED_SCOPE for (atomic_profiler_scope_t __aps __attribute__((__cleanup__(atomic_profiler_leave))) = atomic_profiler_enter(__FILE__, __LINE__), *__aps_once = &__aps; __aps_once; __aps_once = 0)
+#        define ATOMIC_BLOCK_RESTORESTATE ATOMIC_PROFILED_SCOPE ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#        define ATOMIC_BLOCK_FORCEON ATOMIC_PROFILED_SCOPE ATOMIC_BLOCK(ATOMIC_FORCEON)
+#    endif
 #else /* do nothing atomic macro */
 #    define ATOMIC_BLOCK(t) for (uint8_t __ToDo = 1; __ToDo; __ToDo = 0)
 #    define ATOMIC_FORCEON
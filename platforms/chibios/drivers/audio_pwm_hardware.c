@@ -37,7 +37,9 @@ static PWMConfig pwmCFG = {.frequency = AUDIO_PWM_COUNTER_FREQUENCY, /* PWM cloc
                            .callback  = NULL,
                            .channels  = {[(AUDIO_PWM_CHANNEL - 1)] = {.mode = AUDIO_PWM_OUTPUT_MODE, .callback = NULL}}};
 
-static float channel_1_frequency = 0.0f;
+static float    channel_1_frequency = 0.0f;
+static pwmcnt_t channel_1_period    = 0;
+static pwmcnt_t channel_1_width     = 0;
 
 void channel_1_set_frequency(float freq) {
     channel_1_frequency = freq;
@@ -51,6 +53,16 @@ void channel_1_set_frequency(float freq) {
         period = (pwmCFG.frequency / freq);
         width  = (pwmcnt_t)(((period) * (pwmcnt_t)((100 - note_timbre) * 100)) / (pwmcnt_t)(10000));
     }
+
+    // While a note is held its frequency is recomputed on every update tick;
+    // don't take the lock and reprogram the PWM unless the hardware values
+    // actually changed.
+    if (period == channel_1_period && width == channel_1_width) {
+        return;
+    }
+    channel_1_period = period;
+    channel_1_width  = width;
+
     chSysLockFromISR();
     pwmChangePeriodI(&AUDIO_PWM_DRIVER, period);
     pwmEnableChannelI(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1, width);
@@ -64,6 +76,10 @@ float channel_1_get_frequency(void) {
 void channel_1_start(void) {
     pwmStop(&AUDIO_PWM_DRIVER);
     pwmStart(&AUDIO_PWM_DRIVER, &pwmCFG);
+    // Restarting the driver loses the programmed period/width; invalidate the
+    // change-detection cache so the next note is always programmed.
+    channel_1_period = 0;
+    channel_1_width  = 0;
 }
 
 void channel_1_stop(void) {
@@ -71,6 +87,8 @@ void channel_1_stop(void) {
     pwmStart(&AUDIO_PWM_DRIVER, &pwmCFG);
     pwmEnableChannel(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1, 0);
     pwmStop(&AUDIO_PWM_DRIVER);
+    channel_1_period = 0;
+    channel_1_width  = 0;
 }
 
 static virtual_timer_t audio_vt;
@@ -200,6 +200,114 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
     return i2c_epilogue(status);
 }
 
+#ifdef I2C_MASTER_ASYNC
+// Asynchronous transaction queue. Transfers are executed in FIFO order by a dedicated worker
+// thread, so a submit returns immediately and the bus transaction overlaps with scanning; the
+// ChibiOS LLD drives the actual transfer from interrupts while the worker sleeps. Completion
+// callbacks are deferred to i2c_async_task() so they always run in the main thread, where the
+// rest of the firmware expects to be called from.
+
+#    ifndef I2C_ASYNC_QUEUE_SIZE
+#        define I2C_ASYNC_QUEUE_SIZE 8
+#    endif
+
+typedef struct i2c_async_transaction_t {
+    bool                  is_receive;
+    uint8_t               address;
+    uint8_t*              data;
+    uint16_t              length;
+    uint16_t              timeout;
+    i2c_async_callback_t  callback;
+    void*                 user_data;
+    i2c_status_t          status;
+    volatile bool         complete; // set by the worker, cleared when the callback has been dispatched
+} i2c_async_transaction_t;
+
+static i2c_async_transaction_t async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t                 async_enqueue_idx = 0; // next slot to fill (producer)
+static uint8_t                 async_drain_idx   = 0; // next slot to dispatch (i2c_async_task)
+static volatile uint8_t        async_occupied    = 0; // slots pending or awaiting dispatch
+static semaphore_t             async_sem;
+static thread_t*               async_thread = NULL;
+
+static THD_WORKING_AREA(waI2CAsync, 256);
+static THD_FUNCTION(i2c_async_worker, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+    uint8_t work_idx = 0;
+    while (true) {
+        chSemWait(&async_sem);
+        i2c_async_transaction_t* transaction = &async_queue[work_idx];
+        work_idx                             = (work_idx + 1) % I2C_ASYNC_QUEUE_SIZE;
+
+        if (transaction->is_receive) {
+            transaction->status = i2c_receive(transaction->address, transaction->data, transaction->length, transaction->timeout);
+        } else {
+            transaction->status = i2c_transmit(transaction->address, transaction->data, transaction->length, transaction->timeout);
+        }
+        transaction->complete = true;
+    }
+}
+
+static bool i2c_submit(bool is_receive, uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout, i2c_async_callback_t callback, void* user_data) {
+    if (async_thread == NULL) {
+        chSemObjectInit(&async_sem, 0);
+        async_thread = chThdCreateStatic(waI2CAsync, sizeof(waI2CAsync), LOWPRIO + 1, i2c_async_worker, NULL);
+    }
+
+    chSysLock();
+    if (async_occupied == I2C_ASYNC_QUEUE_SIZE) {
+        chSysUnlock();
+        return false;
+    }
+    i2c_async_transaction_t* transaction = &async_queue[async_enqueue_idx];
+    async_enqueue_idx                    = (async_enqueue_idx + 1) % I2C_ASYNC_QUEUE_SIZE;
+    async_occupied++;
+
+    transaction->is_receive = is_receive;
+    transaction->address    = address;
+    transaction->data       = data;
+    transaction->length     = length;
+    transaction->timeout    = timeout;
+    transaction->callback   = callback;
+    transaction->user_data  = user_data;
+    transaction->complete   = false;
+
+    chSemSignalI(&async_sem);
+    chSchRescheduleS();
+    chSysUnlock();
+    return true;
+}
+
+bool i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout, i2c_async_callback_t callback, void* user_data) {
+    return i2c_submit(false, address, (uint8_t*)data, length, timeout, callback, user_data);
+}
+
+bool i2c_receive_async(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout, i2c_async_callback_t callback, void* user_data) {
+    return i2c_submit(true, address, data, length, timeout, callback, user_data);
+}
+
+void i2c_async_task(void) {
+    while (async_occupied > 0 && async_queue[async_drain_idx].complete) {
+        i2c_async_transaction_t* transaction = &async_queue[async_drain_idx];
+        i2c_async_callback_t     callback    = transaction->callback;
+        void*                    user_data   = transaction->user_data;
+        i2c_status_t             status      = transaction->status;
+
+        // Free the slot before dispatching so the callback can immediately resubmit
+        transaction->complete = false;
+        async_drain_idx       = (async_drain_idx + 1) % I2C_ASYNC_QUEUE_SIZE;
+        chSysLock();
+        async_occupied--;
+        chSysUnlock();
+
+        if (callback != NULL) {
+            callback(status, user_data);
+        }
+    }
+}
+#endif
+
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
     // ChibiOS does not provide low level enough control to check for an ack.
     // Best effort instead tries reading register 0 which will either succeed or timeout.
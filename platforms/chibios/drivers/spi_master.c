@@ -67,6 +67,14 @@ static bool  current_cs_active_low = true;
 
 static SPIConfig spiConfig;
 
+#ifdef SPI_SCHEDULER
+// Most recent successful spi_start_extended() arguments, kept so a yielding bus holder's session
+// can be re-established after queued transactions have run.
+static spi_start_config_t current_start_config;
+
+static void spi_scheduler_drain(uint8_t min_priority);
+#endif
+
 static inline void spi_select(void) {
     spiSelect(&SPI_DRIVER);
 
@@ -404,6 +412,9 @@ bool spi_start_extended(spi_start_config_t *start_config) {
 #endif
 
     spiStarted = true;
+#ifdef SPI_SCHEDULER
+    current_start_config = *start_config;
+#endif
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
     current_slave_pin     = start_config->slave_pin;
     current_cs_active_low = start_config->cs_active_low;
@@ -455,6 +466,30 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    if (!spiStarted) {
+        return SPI_STATUS_ERROR;
+    }
+
+    // Only one background transfer can be in flight at a time -- wait out any previous one before starting the next.
+    spi_transmit_async_wait();
+
+    osalSysLock();
+    spiStartSendI(&SPI_DRIVER, length, data);
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_async_done(void) {
+    return SPI_DRIVER.state != SPI_ACTIVE;
+}
+
+void spi_transmit_async_wait(void) {
+    while (SPI_DRIVER.state == SPI_ACTIVE) {
+        // busy-wait; the transfer is serviced by DMA/IRQ
+    }
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -462,6 +497,7 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_transmit_async_wait();
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
@@ -470,4 +506,125 @@ void spi_stop(void) {
 #if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
     spiReleaseBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
+
+#ifdef SPI_SCHEDULER
+    // Bus is free; run anything that queued up while it was held
+    spi_scheduler_drain(0);
+#endif
 }
+
+#ifdef SPI_SCHEDULER
+// Prioritized transaction queue. Short transfers submitted while the bus is held (e.g. by a
+// multi-millisecond full-frame display flush) are queued and executed either when the holder stops
+// the bus, or earlier when the holder yields at a chunk boundary. Each queued entry is a complete
+// start/send/stop session with its own bus configuration, so devices with different modes and
+// divisors interleave safely.
+
+#    ifndef SPI_SCHEDULER_QUEUE_SIZE
+#        define SPI_SCHEDULER_QUEUE_SIZE 4
+#    endif
+
+typedef struct spi_scheduled_transaction_t {
+    bool                     in_use;
+    spi_start_config_t       start_config;
+    const uint8_t           *data;
+    uint16_t                 length;
+    uint8_t                  priority;
+    spi_scheduler_callback_t callback;
+    void                    *user_data;
+} spi_scheduled_transaction_t;
+
+static spi_scheduled_transaction_t scheduler_queue[SPI_SCHEDULER_QUEUE_SIZE];
+static bool                        scheduler_draining = false;
+
+static void spi_scheduler_drain(uint8_t min_priority) {
+    if (scheduler_draining) {
+        return; // queued transactions end with spi_stop(); don't recurse into the drain from there
+    }
+    scheduler_draining = true;
+
+    while (true) {
+        int best = -1;
+        for (int i = 0; i < SPI_SCHEDULER_QUEUE_SIZE; i++) {
+            if (scheduler_queue[i].in_use && scheduler_queue[i].priority >= min_priority && (best < 0 || scheduler_queue[i].priority > scheduler_queue[best].priority)) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+
+        // Free the slot before executing so the callback can immediately resubmit
+        spi_scheduled_transaction_t transaction = scheduler_queue[best];
+        scheduler_queue[best].in_use            = false;
+
+        spi_status_t status = SPI_STATUS_ERROR;
+        if (spi_start_extended(&transaction.start_config)) {
+            status = spi_transmit(transaction.data, transaction.length);
+            spi_stop();
+        }
+        if (transaction.callback != NULL) {
+            transaction.callback(status, transaction.user_data);
+        }
+    }
+
+    scheduler_draining = false;
+}
+
+bool spi_transaction_submit(const spi_start_config_t *start_config, const uint8_t *data, uint16_t length, uint8_t priority, spi_scheduler_callback_t callback, void *user_data) {
+    int slot = -1;
+    for (int i = 0; i < SPI_SCHEDULER_QUEUE_SIZE; i++) {
+        if (!scheduler_queue[i].in_use) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        return false;
+    }
+
+    scheduler_queue[slot].start_config = *start_config;
+    scheduler_queue[slot].data         = data;
+    scheduler_queue[slot].length       = length;
+    scheduler_queue[slot].priority     = priority;
+    scheduler_queue[slot].callback     = callback;
+    scheduler_queue[slot].user_data    = user_data;
+    scheduler_queue[slot].in_use       = true;
+
+    if (!spiStarted) {
+        spi_scheduler_drain(0); // bus is free; run it now
+    }
+    return true;
+}
+
+bool spi_scheduler_pending(uint8_t min_priority) {
+    for (int i = 0; i < SPI_SCHEDULER_QUEUE_SIZE; i++) {
+        if (scheduler_queue[i].in_use && scheduler_queue[i].priority >= min_priority) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void spi_scheduler_yield(uint8_t min_priority) {
+    if (!spiStarted || scheduler_draining || !spi_scheduler_pending(min_priority)) {
+        return;
+    }
+
+    // Suspend the holder's session. The device sees its chip select deassert mid stream, which
+    // ST77xx-style panels treat as a pause rather than an abort.
+    spi_start_config_t resume_config = current_start_config;
+    spi_transmit_async_wait();
+    spi_unselect();
+    spiStop(&SPI_DRIVER);
+    spiStarted = false;
+#    if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
+    spiReleaseBus(&SPI_DRIVER);
+#    endif
+
+    spi_scheduler_drain(min_priority);
+
+    // Re-establish the suspended session; lower-priority entries stay queued for the real stop
+    spi_start_extended(&resume_config);
+}
+#endif
@@ -24,6 +24,14 @@
 #    define WEAR_LEVELING_RP2040_FLASH_BULK_COUNT 64
 #endif // WEAR_LEVELING_RP2040_FLASH_BULK_COUNT
 
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+// Both cores execute from XIP flash: park core 1 in SRAM while the chip is out of XIP mode below.
+#    include "core1_executor.h"
+#else
+static inline void core1_executor_flash_lockout_begin(void) {}
+static inline void core1_executor_flash_lockout_end(void) {}
+#endif
+
 #define FLASHCMD_PAGE_PROGRAM 0x02
 #define FLASHCMD_READ_STATUS 0x05
 #define FLASHCMD_WRITE_ENABLE 0x06
@@ -182,14 +190,36 @@ bool backing_store_erase(void) {
     // Ensure the backing size can be cleanly subtracted from the flash size without alignment issues.
     STATIC_ASSERT((WEAR_LEVELING_BACKING_SIZE) % (FLASH_SECTOR_SIZE) == 0, "Backing size must be a multiple of FLASH_SECTOR_SIZE");
 
+    core1_executor_flash_lockout_begin();
     interrupts = save_and_disable_interrupts();
     flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE), (WEAR_LEVELING_BACKING_SIZE));
     restore_interrupts(interrupts);
+    core1_executor_flash_lockout_end();
 
     bs_dprintf("Backing store erase took %ldms to complete\n", ((long)(timer_read32() - start)));
     return true;
 }
 
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    // Flash erases in whole sectors; misaligned requests fall back to the full erase
+    if (address % (FLASH_SECTOR_SIZE) != 0 || length % (FLASH_SECTOR_SIZE) != 0 || address + length > (WEAR_LEVELING_BACKING_SIZE)) {
+        return false;
+    }
+
+#ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#endif
+
+    core1_executor_flash_lockout_begin();
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, length);
+    restore_interrupts(interrupts);
+    core1_executor_flash_lockout_end();
+
+    bs_dprintf("Backing store ranged erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return true;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -198,9 +228,11 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, siz
     uint32_t offset = (WEAR_LEVELING_RP2040_FLASH_BASE) + address;
     bs_dprintf("Write ");
     wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
+    core1_executor_flash_lockout_begin();
     interrupts = save_and_disable_interrupts();
     pico_program_bulk(offset, values, item_count);
     restore_interrupts(interrupts);
+    core1_executor_flash_lockout_end();
     return true;
 }
 
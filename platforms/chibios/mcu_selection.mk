@@ -174,6 +174,16 @@ ifneq ($(findstring RP2040, $(MCU)),)
   # Default UF2 Bootloader settings
   UF2_FAMILY ?= RP2040
   FIRMWARE_FORMAT ?= uf2
+
+  # Copy RAMFUNC-tagged hot functions into striped SRAM instead of executing them
+  # from XIP flash; see quantum/ramfunc.h. The linker enforces a budget on the
+  # total copied code (HOT_FUNCTIONS_RAM_BUDGET, bytes, default 32K).
+  ifeq ($(strip $(HOT_FUNCTIONS_IN_RAM)), yes)
+    OPT_DEFS += -DHOT_FUNCTIONS_IN_RAM
+    ifneq ($(strip $(HOT_FUNCTIONS_RAM_BUDGET)),)
+      LDFLAGS += -Wl,--defsym=TIME_CRITICAL_BUDGET=$(strip $(HOT_FUNCTIONS_RAM_BUDGET))
+    endif
+  endif
 endif
 
 ifneq ($(findstring STM32F042, $(MCU)),)
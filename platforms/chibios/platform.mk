@@ -283,7 +283,14 @@ PLATFORM_SRC = \
         $(PLATFORM_COMMON_DIR)/syscall-fallbacks.c \
         $(PLATFORM_COMMON_DIR)/wait.c \
         $(PLATFORM_COMMON_DIR)/synchronization_util.c \
-        $(PLATFORM_COMMON_DIR)/interrupt_handlers.c
+        $(PLATFORM_COMMON_DIR)/interrupt_handlers.c \
+        $(PLATFORM_COMMON_DIR)/stack_usage.c
+
+# Warm-boot handoff through noinit RAM; requires a linker script with a .noinit section
+ifeq ($(strip $(WARM_BOOT_ENABLE)), yes)
+    OPT_DEFS += -DWARM_BOOT_ENABLE
+    PLATFORM_SRC += $(PLATFORM_COMMON_DIR)/warm_boot.c
+endif
 
 # Ensure the ASM files are not subjected to LTO -- it'll strip out interrupt handlers otherwise.
 QUANTUM_LIB_SRC += $(STARTUPASM) $(PORTASM) $(OSALASM) $(PLATFORMASM)
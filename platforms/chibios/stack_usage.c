@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "stack_usage.h"
+
+#include <ch.h>
+#include <string.h>
+
+#if CH_DBG_FILL_THREADS == TRUE
+
+/* Stack region bounds provided by the ChibiOS port linker scripts. Stacks grow
+ * downwards, so the longest run of intact fill bytes from the base gives the
+ * bytes never used. */
+extern uint8_t __main_stack_base__[], __main_stack_end__[];
+extern uint8_t __process_stack_base__[], __process_stack_end__[];
+
+static void scan_region(const uint8_t *base, const uint8_t *end, stack_usage_t *usage) {
+    const uint8_t *p = base;
+    while (p < end && *p == CH_DBG_STACK_FILL_VALUE) {
+        p++;
+    }
+    usage->size       = (uint32_t)(end - base);
+    usage->high_water = (uint32_t)(end - p);
+}
+
+bool stack_usage_main(stack_usage_t *usage) {
+    scan_region(__main_stack_base__, __main_stack_end__, usage);
+    return true;
+}
+
+bool stack_usage_process(stack_usage_t *usage) {
+    scan_region(__process_stack_base__, __process_stack_end__, usage);
+    return true;
+}
+
+#else
+
+bool stack_usage_main(stack_usage_t *usage) {
+    memset(usage, 0, sizeof(*usage));
+    return false;
+}
+
+bool stack_usage_process(stack_usage_t *usage) {
+    memset(usage, 0, sizeof(*usage));
+    return false;
+}
+
+#endif
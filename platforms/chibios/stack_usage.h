@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Runtime stack high-water-mark API.
+ *
+ * ChibiOS fills stacks with a known pattern at startup when CH_DBG_FILL_THREADS
+ * is TRUE; the high-water mark is recovered by scanning for the first
+ * overwritten byte. Useful for sizing the main/process stacks down so the
+ * reclaimed SRAM can go to framebuffers and caches instead. */
+
+typedef struct stack_usage_t {
+    uint32_t size;       /* total bytes in the stack region */
+    uint32_t high_water; /* most bytes ever in use */
+} stack_usage_t;
+
+/* Usage of the main (interrupt) stack. Returns false, leaving the result
+ * zeroed, when CH_DBG_FILL_THREADS is disabled and no fill pattern exists. */
+bool stack_usage_main(stack_usage_t *usage);
+
+/* Usage of the process stack that runs the main thread. */
+bool stack_usage_process(stack_usage_t *usage);
@@ -7,6 +7,34 @@ ifeq ($(strip $(WS2812_DRIVER)), vendor)
     OPT_DEFS += -DRP_DMA_REQUIRED=TRUE
 endif
 
+ifeq ($(strip $(RP2040_CORE1_EXECUTOR)), yes)
+    OPT_DEFS += -DRP2040_CORE1_EXECUTOR_ENABLE
+    SRC += core1_executor.c
+endif
+
+ifeq ($(strip $(RP2040_MATRIX_PIO)), yes)
+    OPT_DEFS += -DRP2040_MATRIX_PIO_ENABLE -DRP_DMA_REQUIRED=TRUE
+    SRC += matrix_pio.c
+endif
+
+ifeq ($(strip $(RP2040_CLOCK_GOVERNOR)), yes)
+    OPT_DEFS += -DRP2040_CLOCK_GOVERNOR_ENABLE
+    SRC += clock_governor.c
+endif
+
+ifeq ($(strip $(RP2040_JOYSTICK_DMA)), yes)
+    OPT_DEFS += -DRP2040_JOYSTICK_DMA_ENABLE -DRP_DMA_REQUIRED=TRUE
+    SRC += joystick_dma.c
+endif
+
+ifeq ($(strip $(RP2040_BACKLIGHT_DMA)), yes)
+    ifneq ($(strip $(BACKLIGHT_DRIVER)), custom)
+        $(call CATASTROPHIC_ERROR,Invalid BACKLIGHT_DRIVER,RP2040_BACKLIGHT_DMA requires BACKLIGHT_DRIVER = custom)
+    endif
+    OPT_DEFS += -DRP2040_BACKLIGHT_DMA_ENABLE -DRP_DMA_REQUIRED=TRUE
+    SRC += backlight_dma.c
+endif
+
 #
 # Raspberry Pi Pico SDK Support
 ##############################################################################
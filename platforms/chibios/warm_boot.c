@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "warm_boot.h"
+
+#define WARM_BOOT_MAGIC 0x57424f54u // 'WBOT'
+
+// The stash lives in .noinit: startup neither loads nor zeroes it, so it holds whatever the
+// previous run staged -- or random bits after a real power-up, which the magic/checksum reject.
+// The RP2040 UF2 bootloader uses some of main SRAM for itself; if it happens to clobber the stash,
+// the checksum fails and the boot proceeds cold, which is always safe.
+static struct {
+    uint32_t magic;
+    uint8_t  length;
+    uint8_t  payload[WARM_BOOT_PAYLOAD_SIZE];
+    uint32_t checksum;
+} warm_boot_stash __attribute__((section(".noinit")));
+
+// FNV-1a over the length byte and payload
+static uint32_t warm_boot_checksum(void) {
+    uint32_t hash = 2166136261ul;
+    hash ^= warm_boot_stash.length;
+    hash *= 16777619ul;
+    for (uint8_t i = 0; i < warm_boot_stash.length; i++) {
+        hash ^= warm_boot_stash.payload[i];
+        hash *= 16777619ul;
+    }
+    return hash;
+}
+
+void warm_boot_stage(const void *payload, uint8_t length) {
+    if (length > WARM_BOOT_PAYLOAD_SIZE) {
+        length = WARM_BOOT_PAYLOAD_SIZE;
+    }
+    warm_boot_stash.length = length;
+    memcpy(warm_boot_stash.payload, payload, length);
+    warm_boot_stash.checksum = warm_boot_checksum();
+    warm_boot_stash.magic    = WARM_BOOT_MAGIC;
+}
+
+static bool    warm_checked = false;
+static bool    warm_valid   = false;
+static uint8_t warm_length  = 0;
+static uint8_t warm_payload[WARM_BOOT_PAYLOAD_SIZE];
+
+bool warm_boot_active(void) {
+    if (!warm_checked) {
+        warm_checked = true;
+        if (warm_boot_stash.magic == WARM_BOOT_MAGIC && warm_boot_stash.length <= WARM_BOOT_PAYLOAD_SIZE && warm_boot_stash.checksum == warm_boot_checksum()) {
+            warm_valid  = true;
+            warm_length = warm_boot_stash.length;
+            memcpy(warm_payload, warm_boot_stash.payload, warm_length);
+        }
+        // Consume the stash either way: a crash before the next staging must boot cold
+        warm_boot_stash.magic = 0;
+    }
+    return warm_valid;
+}
+
+uint8_t warm_boot_payload(void *payload, uint8_t max_length) {
+    if (!warm_boot_active()) {
+        return 0;
+    }
+    uint8_t length = warm_length < max_length ? warm_length : max_length;
+    memcpy(payload, warm_payload, length);
+    return length;
+}
@@ -0,0 +1,31 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Warm-boot handoff through noinit RAM, enabled with WARM_BOOT_ENABLE = yes in rules.mk. A small
+// payload staged immediately before a reset survives the bootloader round-trip (the .noinit section
+// is neither loaded nor zeroed at startup), letting the next boot skip re-initialization of
+// hardware that never lost power -- e.g. reattaching a still-lit display panel after flashing
+// instead of resetting and repainting it. The stash is guarded by a magic word and a checksum and
+// is consumed on first query, so a stale or clobbered stash (or a genuine cold power-up, where RAM
+// is random) always falls back to the cold path.
+
+// Size of the payload area carried across the reset.
+#ifndef WARM_BOOT_PAYLOAD_SIZE
+#    define WARM_BOOT_PAYLOAD_SIZE 64
+#endif
+
+// Stages a payload for the next boot; call immediately before jumping to the bootloader or
+// resetting. Payloads longer than WARM_BOOT_PAYLOAD_SIZE are truncated.
+void warm_boot_stage(const void *payload, uint8_t length);
+
+// Whether this boot found a valid staged payload. The first call validates and consumes the stash,
+// so a crash before re-staging cannot replay it; subsequent calls return the latched result.
+bool warm_boot_active(void);
+
+// Copies out the staged payload; returns the number of bytes copied, or 0 when this boot was cold.
+uint8_t warm_boot_payload(void *payload, uint8_t max_length);
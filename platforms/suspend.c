@@ -3,6 +3,7 @@
 
 #include "suspend.h"
 #include "matrix.h"
+#include "timer.h"
 
 // TODO: Move to more correct location
 __attribute__((weak)) void matrix_power_up(void) {}
@@ -42,6 +43,10 @@ __attribute__((weak)) void suspend_wakeup_init_kb(void) {
  */
 bool suspend_wakeup_condition(void) {
     matrix_power_up();
+    // keyboard_task() is not running while suspended, so latch the cached "now"
+    // here; the deferred debouncers consume timer_now*() and would otherwise see
+    // time frozen across polls and never commit the waking keypress.
+    timer_now_refresh();
     matrix_scan();
     matrix_power_down();
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
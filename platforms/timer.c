@@ -6,6 +6,31 @@
 // Generate out-of-line copies for inline functions defined in timer.h.
 extern inline fast_timer_t timer_read_fast(void);
 extern inline fast_timer_t timer_elapsed_fast(fast_timer_t last);
+extern inline fast_timer_t timer_now_fast(void);
+extern inline fast_timer_t timer_now_elapsed_fast(fast_timer_t last);
+
+// Timestamp latched by timer_now_refresh(); shared by all timer_now*() consumers.
+static uint32_t timer_now_cached = 0;
+
+void timer_now_refresh(void) {
+    timer_now_cached = timer_read32();
+}
+
+uint16_t timer_now(void) {
+    return (uint16_t)timer_now_cached;
+}
+
+uint32_t timer_now32(void) {
+    return timer_now_cached;
+}
+
+uint16_t timer_now_elapsed(uint16_t last) {
+    return TIMER_DIFF_16((uint16_t)timer_now_cached, last);
+}
+
+uint32_t timer_now_elapsed32(uint32_t last) {
+    return TIMER_DIFF_32(timer_now_cached, last);
+}
 
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
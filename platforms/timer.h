@@ -44,6 +44,20 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// Cached "now" service: keyboard_task() latches the timestamp once per main-loop
+// iteration via timer_now_refresh(), and hot per-scan consumers read the latched
+// value instead of crossing into the platform timer for every query. Values are
+// stale by at most one loop iteration; code that runs outside the main loop, or
+// that measures across a wait, should keep using timer_read()/timer_read32().
+// Anything that calls matrix_scan() outside keyboard_task() (bootmagic, suspend
+// wakeup polling, benchmarks) must latch the clock itself first, since the
+// deferred debouncers consume timer_now*() and stall on a frozen latch.
+void     timer_now_refresh(void);
+uint16_t timer_now(void);
+uint32_t timer_now32(void);
+uint16_t timer_now_elapsed(uint16_t last);
+uint32_t timer_now_elapsed32(uint32_t last);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
@@ -59,6 +73,12 @@ fast_timer_t inline timer_read_fast(void) {
 fast_timer_t inline timer_elapsed_fast(fast_timer_t last) {
     return timer_elapsed(last);
 }
+fast_timer_t inline timer_now_fast(void) {
+    return timer_now();
+}
+fast_timer_t inline timer_now_elapsed_fast(fast_timer_t last) {
+    return timer_now_elapsed(last);
+}
 #else
 #    define TIMER_DIFF_FAST(a, b) TIMER_DIFF_32(a, b)
 #    define timer_expired_fast(current, future) timer_expired32(current, future)
@@ -69,6 +89,12 @@ fast_timer_t inline timer_read_fast(void) {
 fast_timer_t inline timer_elapsed_fast(fast_timer_t last) {
     return timer_elapsed32(last);
 }
+fast_timer_t inline timer_now_fast(void) {
+    return timer_now32();
+}
+fast_timer_t inline timer_now_elapsed_fast(fast_timer_t last) {
+    return timer_now_elapsed32(last);
+}
 #endif
 
 #ifdef __cplusplus
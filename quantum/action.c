@@ -44,6 +44,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "encoder.h"
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
+#ifdef KEY_STATS_ENABLE
+#    include "key_stats.h"
+#endif
+
+#ifdef EXPERIMENT_ENABLE
+#    include "experiment.h"
+#endif
+
 int tp_buttons;
 
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
@@ -81,6 +93,15 @@ void action_exec(keyevent_t event) {
         ac_dprintf("EVENT: ");
         debug_event(event);
         ac_dprintf("\n");
+#ifdef KEY_LATENCY_ENABLE
+        key_latency_on_event(event.time);
+#endif
+#ifdef KEY_STATS_ENABLE
+        key_stats_on_event(event.key.row, event.key.col, event.pressed, event.time);
+#endif
+#ifdef EXPERIMENT_ENABLE
+        experiment_on_event(event.pressed);
+#endif
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
         uint16_t event_keycode = get_event_keycode(event, false);
         if (event.pressed) {
@@ -406,6 +427,7 @@ void process_action(keyrecord_t *record, action_t action) {
         case ACT_RMODS: {
             uint8_t mods = (action.kind.id == ACT_LMODS) ? action.key.mods : action.key.mods << 4;
             if (event.pressed) {
+                keyboard_report_defer();
                 if (mods) {
                     if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
                         // e.g. LSFT(KC_LEFT_GUI): we don't want the LSFT to be weak as it would make it useless.
@@ -418,7 +440,9 @@ void process_action(keyrecord_t *record, action_t action) {
                     send_keyboard_report();
                 }
                 register_code(action.key.code);
+                keyboard_report_flush();
             } else {
+                keyboard_report_defer();
                 unregister_code(action.key.code);
                 if (mods) {
                     if (IS_MODIFIER_KEYCODE(action.key.code) || action.key.code == KC_NO) {
@@ -428,6 +452,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     }
                     send_keyboard_report();
                 }
+                keyboard_report_flush();
             }
         } break;
         case ACT_LMODS_TAP:
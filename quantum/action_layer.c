@@ -7,10 +7,26 @@
 #include "util.h"
 #include "action_layer.h"
 
+#if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+#    include "via.h"
+#endif
+#if defined(LAYER_DERIVED_RULES) && defined(TRI_LAYER_ENABLE)
+#    include "tri_layer.h"
+#endif
+#if defined(KEYMAP_FLATTENING) || defined(KEYMAP_LAYER_SRAM_CACHE)
+#    include "keymap_introspection.h"
+#endif
+
 /** \brief Default Layer State
  */
 layer_state_t default_layer_state = 0;
 
+#ifndef NO_ACTION_LAYER
+/* Active layer resolution cache; see layer_switch_get_layer. Invalidated on
+ * every layer or default layer state change, rebuilt lazily on first use. */
+static bool active_layer_cache_valid = false;
+#endif
+
 /** \brief Default Layer State Set At user Level
  *
  * Run user code on default layer state change
@@ -46,6 +62,9 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_debug();
     ac_dprintf(" to ");
     default_layer_state = state;
+#ifndef NO_ACTION_LAYER
+    active_layer_cache_valid = false;
+#endif
     default_layer_debug();
     ac_dprintf("\n");
 #if defined(STRICT_LAYER_RELEASE)
@@ -100,6 +119,29 @@ void default_layer_xor(layer_state_t state) {
  */
 layer_state_t layer_state = 0;
 
+/* Descending list of the active layers in (layer_state | default_layer_state),
+ * rebuilt at most once per state change - one clz32 per active layer - so the
+ * per-key-event layer walk touches only active layers instead of testing every
+ * bit down from MAX_LAYER. Layer 0 is omitted:
+ * the walk falls back to it unconditionally. */
+static uint8_t active_layer_order[MAX_LAYER];
+static uint8_t active_layer_count = 0;
+
+static void active_layer_cache_refresh(void) {
+    uint32_t layers    = (uint32_t)(layer_state | default_layer_state) & ~BIT32(0); // layer 0 is the implicit fallback
+    active_layer_count = 0;
+    while (layers) { // Walk the set bits highest-first; one clz32 per active layer
+        uint8_t i = msb32(layers);
+        layers &= ~BIT32(i);
+        active_layer_order[active_layer_count++] = i;
+    }
+    active_layer_cache_valid = true;
+#    ifdef KEYMAP_LAYER_SRAM_CACHE
+    // Pin the new top layer's key table in SRAM; most lookups resolve there
+    keymap_layer_cache_load(active_layer_count ? active_layer_order[0] : 0);
+#    endif
+}
+
 /** \brief Layer state set user
  *
  * Runs user code on layer state change
@@ -125,6 +167,50 @@ __attribute__((weak)) layer_state_t layer_state_set_modules(layer_state_t state)
     return state;
 }
 
+#    ifdef LAYER_DERIVED_RULES
+/* Declarative derived-layer rules: each entry drives derived_mask from
+ * trigger_mask with the same mask formula as update_tri_layer_state, applied
+ * on every state change after the kb/user callbacks - the traditional place
+ * keymaps called update_tri_layer_state by hand. */
+typedef struct {
+    layer_state_t trigger_mask;
+    layer_state_t derived_mask;
+} layer_derived_rule_t;
+
+static layer_derived_rule_t layer_derived_rules[LAYER_DERIVED_RULES_MAX];
+static uint8_t              layer_derived_rule_count = 0;
+
+static layer_state_t layer_apply_derived_rules(layer_state_t state) {
+#        ifdef TRI_LAYER_ENABLE
+    // The built-in tri-layer is just another rule; evaluating it here keeps the
+    // adjust layer consistent even when lower/upper change without going
+    // through the QK_TRI_LAYER_* keycodes (layer_move, one-shots, ...)
+    state = update_tri_layer_state(state, get_tri_layer_lower_layer(), get_tri_layer_upper_layer(), get_tri_layer_adjust_layer());
+#        endif
+    for (uint8_t i = 0; i < layer_derived_rule_count; i++) {
+        const layer_state_t trigger = layer_derived_rules[i].trigger_mask;
+        const layer_state_t derived = layer_derived_rules[i].derived_mask;
+        state                       = (state & trigger) == trigger ? (state | derived) : (state & ~derived);
+    }
+    return state;
+}
+
+bool layer_derived_rule_add(layer_state_t trigger_mask, layer_state_t derived_mask) {
+    if (layer_derived_rule_count >= LAYER_DERIVED_RULES_MAX) {
+        return false;
+    }
+    layer_derived_rules[layer_derived_rule_count].trigger_mask = trigger_mask;
+    layer_derived_rules[layer_derived_rule_count].derived_mask = derived_mask;
+    layer_derived_rule_count++;
+    layer_state_set(layer_state); // Re-evaluate so the rule takes effect immediately
+    return true;
+}
+
+void layer_derived_rules_clear(void) {
+    layer_derived_rule_count = 0;
+}
+#    endif
+
 /** \brief Layer state set
  *
  * Sets the layer to match the specified state (a bitmask)
@@ -132,12 +218,19 @@ __attribute__((weak)) layer_state_t layer_state_set_modules(layer_state_t state)
 void layer_state_set(layer_state_t state) {
     state = layer_state_set_modules(state);
     state = layer_state_set_kb(state);
+#    ifdef LAYER_DERIVED_RULES
+    state = layer_apply_derived_rules(state);
+#    endif
     ac_dprintf("layer_state: ");
     layer_debug();
     ac_dprintf(" to ");
-    layer_state = state;
+    layer_state              = state;
+    active_layer_cache_valid = false;
     layer_debug();
     ac_dprintf("\n");
+#    if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+    via_event_push_layer_state(layer_state);
+#    endif
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -341,17 +434,33 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
+    if (!active_layer_cache_valid) {
+        active_layer_cache_refresh();
+    }
+#    ifdef KEYMAP_FLATTENING
+    /* With a static keymap, transparency per location is fixed, so the walk
+     * can test a flattened opacity bit per active layer instead of resolving
+     * a full action from the keymap for each one. Out-of-matrix positions
+     * (combos, encoders) have no keymap entry and take the generic path. */
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        for (uint8_t n = 0; n < active_layer_count; n++) {
+            uint8_t i = active_layer_order[n];
+            if (keymap_location_is_opaque(i, key.row, key.col)) {
+                return i;
+            }
+        }
+        return 0;
+    }
+#    endif
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
-    /* check top layer first */
-    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
-        if (layers & ((layer_state_t)1 << i)) {
-            action = action_for_key(i, key);
-            if (action.code != ACTION_TRANSPARENT) {
-                return i;
-            }
+    /* check top layer first; the cached order lists only active layers, highest first */
+    for (uint8_t n = 0; n < active_layer_count; n++) {
+        uint8_t i = active_layer_order[n];
+        action    = action_for_key(i, key);
+        if (action.code != ACTION_TRANSPARENT) {
+            return i;
         }
     }
     /* fall back to layer 0 */
@@ -135,6 +135,30 @@ void update_tri_layer(uint8_t layer1, uint8_t layer2, uint8_t layer3);
  * @return layer_state_t returns a modified layer bitmask with tri layer modifications applied
  */
 layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_t layer2, uint8_t layer3);
+
+#    ifdef LAYER_DERIVED_RULES
+#        ifndef LAYER_DERIVED_RULES_MAX
+#            define LAYER_DERIVED_RULES_MAX 4
+#        endif
+/**
+ * @brief Register a declarative derived-layer rule: whenever every layer in
+ * trigger_mask is active, the layers in derived_mask are activated; otherwise
+ * they are deactivated. Rules are evaluated inside layer_state_set - two
+ * AND/compare operations per rule - so derived layers stay consistent through
+ * every state change without per-keymap callback code. The current state is
+ * re-evaluated immediately on registration.
+ *
+ * @param trigger_mask Bitmask of layers that must all be active
+ * @param derived_mask Bitmask of layers driven by the rule
+ * @return false when the rule table (LAYER_DERIVED_RULES_MAX) is full
+ */
+bool layer_derived_rule_add(layer_state_t trigger_mask, layer_state_t derived_mask);
+/**
+ * @brief Remove all registered derived-layer rules. Does not deactivate layers
+ * a rule had derived; the next layer_state_set leaves them as plain layers.
+ */
+void layer_derived_rules_clear(void);
+#    endif
 #else
 #    define layer_state 0
 
@@ -5,6 +5,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "key_wait_buffer.h"
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
@@ -22,8 +23,8 @@
 #    else
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < tapping_term_cache)
+#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < quick_tap_term_cache)
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -110,10 +111,46 @@ static bool     flow_tap_expired      = true;
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time);
 #    endif // defined(FLOW_TAP_TERM)
 
-static keyrecord_t tapping_key                         = {};
-static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
-static uint8_t     waiting_buffer_head                 = 0;
-static uint8_t     waiting_buffer_tail                 = 0;
+static keyrecord_t tapping_key = {};
+
+/* Ring of key events deferred while a tapping decision is unsettled, held on the shared
+ * pending-key engine. entry.context carries a compact per-slot index (matrix position plus
+ * pressed flag packed in 16 bits): waiting_buffer_typed() runs for most release events while a
+ * tap is unsettled, and matching against it touches two bytes per slot instead of pulling in
+ * each full keyrecord_t.
+ */
+static key_wait_entry_t  waiting_buffer_entries[WAITING_BUFFER_SIZE] = {};
+static key_wait_buffer_t waiting_buffer                              = {.entries = waiting_buffer_entries, .capacity = WAITING_BUFFER_SIZE};
+
+/* Cached resolution of the current tapping key.
+ *
+ * WITHIN_TAPPING_TERM() used to re-run get_record_keycode() (a source-layer
+ * cache lookup plus keymap read) and the per-key term callback on every
+ * buffered event replay, every waiting-buffer scan slot, and every matrix
+ * tick. Keycode and terms are functions of the tapping key only - the layer
+ * cache pins the key's resolution at press time - so they are resolved once
+ * when tapping_key is assigned and reused until it changes.
+ */
+static uint16_t tapping_keycode_cache = KC_NO;
+static uint16_t tapping_term_cache    = 0;
+static uint16_t quick_tap_term_cache  = 0;
+
+static void tapping_key_set(const keyrecord_t *record) {
+    tapping_key           = *record;
+    tapping_keycode_cache = get_record_keycode(&tapping_key, false);
+    tapping_term_cache    = GET_TAPPING_TERM(tapping_keycode_cache, &tapping_key);
+    quick_tap_term_cache  = GET_QUICK_TAP_TERM(tapping_keycode_cache, &tapping_key);
+}
+
+static void tapping_key_reset(void) {
+    tapping_key           = (keyrecord_t){0};
+    tapping_keycode_cache = KC_NO;
+    tapping_term_cache    = 0;
+    quick_tap_term_cache  = 0;
+}
+
+/* Compact per-slot index of a buffered key event, kept in entry.context. */
+#    define WAITING_BUFFER_INDEX(e) ((uint16_t)(((e).key.row << 8) | (e).key.col) | ((e).pressed ? 0x8000 : 0))
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
@@ -141,18 +178,18 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
             clear_keyboard();
             waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+            tapping_key_reset();
         }
     }
 
     // process waiting_buffer
-    if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
+    if (IS_EVENT(record.event) && waiting_buffer.head != waiting_buffer.tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
+    for (; waiting_buffer.tail != waiting_buffer.head; waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail)) {
+        if (process_tapping(&waiting_buffer.entries[waiting_buffer.tail].record)) {
+            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer.tail);
+            debug_record(waiting_buffer.entries[waiting_buffer.tail].record);
             ac_dprintf("\n\n");
         } else {
             break;
@@ -173,7 +210,7 @@ void action_tapping_process(keyrecord_t record) {
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
  */
-#    define TAP_DEFINE_KEYCODE const uint16_t tapping_keycode = get_record_keycode(&tapping_key, false)
+#    define TAP_DEFINE_KEYCODE const uint16_t tapping_keycode = tapping_keycode_cache
 
 #    if defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)
 #        ifdef RETRO_TAPPING_PER_KEY
@@ -253,7 +290,7 @@ bool process_tapping(keyrecord_t *keyp) {
 #    endif // defined(FLOW_TAP_TERM)
 
             ac_dprintf("Tapping: Start(Press tap key).\n");
-            tapping_key = *keyp;
+            tapping_key_set(keyp);
             process_record_tap_hint(&tapping_key);
             waiting_buffer_scan_tap();
             debug_tapping_key();
@@ -293,8 +330,8 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-                        keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
+                    for (; waiting_buffer.tail != waiting_buffer.head; waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail)) {
+                        keyrecord_t *record = &waiting_buffer.entries[waiting_buffer.tail].record;
                         if (!record->event.pressed) {
                             break;
                         }
@@ -322,7 +359,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     tapping_key.tap.count = 1;
                     registered_taps_add(tapping_key.event.key);
                     process_record(&tapping_key);
-                    tapping_key = (keyrecord_t){0};
+                    tapping_key_reset();
 
                     waiting_buffer_chordal_hold_taps_until(event.key);
                     debug_registered_taps();
@@ -353,9 +390,9 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-                            ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
-                            process_record(&waiting_buffer[waiting_buffer_tail]);
+                        for (; waiting_buffer.tail != first_tap; waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail)) {
+                            ac_dprintf("Processing [%u]\n", waiting_buffer.tail);
+                            process_record(&waiting_buffer.entries[waiting_buffer.tail].record);
                         }
                     }
 
@@ -364,7 +401,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     debug_waiting_buffer();
 #    endif // CHORDAL_HOLD
 
-                    tapping_key = (keyrecord_t){0};
+                    tapping_key_reset();
                     debug_tapping_key();
                     // enqueue
                     return false;
@@ -433,7 +470,7 @@ bool process_tapping(keyrecord_t *keyp) {
                                 registered_taps_add(tapping_key.event.key);
                                 debug_registered_taps();
                                 process_record(&tapping_key);
-                                tapping_key = (keyrecord_t){0};
+                                tapping_key_reset();
                             }
                         } else
 #    endif // CHORDAL_HOLD
@@ -450,15 +487,15 @@ bool process_tapping(keyrecord_t *keyp) {
                             process_record(&tapping_key);
 
 #    if defined(CHORDAL_HOLD)
-                            if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
-                                tapping_key = waiting_buffer[waiting_buffer_tail];
+                            if (waiting_buffer.tail != waiting_buffer.head && is_tap_record(&waiting_buffer.entries[waiting_buffer.tail].record)) {
+                                tapping_key_set(&waiting_buffer.entries[waiting_buffer.tail].record);
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail);
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
                             {
-                                tapping_key = (keyrecord_t){0};
+                                tapping_key_reset();
                             }
                             debug_tapping_key();
 
@@ -477,7 +514,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     ac_dprintf("Tapping: Tap release(%u)\n", tapping_key.tap.count);
                     keyp->tap = tapping_key.tap;
                     process_record(keyp);
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     debug_tapping_key();
                     return true;
                 } else if (is_tap_record(keyp) && event.pressed) {
@@ -497,7 +534,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     } else {
                         ac_dprintf("Tapping: Start while last tap(1).\n");
                     }
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -518,7 +555,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 debug_event(event);
                 ac_dprintf("\n");
                 process_record(&tapping_key);
-                tapping_key = (keyrecord_t){0};
+                tapping_key_reset();
                 debug_tapping_key();
                 return false;
             } else {
@@ -529,7 +566,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     ac_dprintf("Tapping: End. last timeout tap release(>0).");
                     keyp->tap = tapping_key.tap;
                     process_record(keyp);
-                    tapping_key = (keyrecord_t){0};
+                    tapping_key_reset();
                     return true;
                 } else if (is_tap_record(keyp) && event.pressed) {
                     if (tapping_key.tap.count > 1) {
@@ -548,7 +585,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     } else {
                         ac_dprintf("Tapping: Start while last timeout tap(1).\n");
                     }
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -575,24 +612,24 @@ bool process_tapping(keyrecord_t *keyp) {
                         if (keyp->tap.count < 15) keyp->tap.count += 1;
                         ac_dprintf("Tapping: Tap press(%u)\n", keyp->tap.count);
                         process_record(keyp);
-                        tapping_key = *keyp;
+                        tapping_key_set(keyp);
                         debug_tapping_key();
                         return true;
                     }
                     // FIX: start new tap again
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     return true;
                 } else if (is_tap_record(keyp)) {
                     // Sequential tap can be interfered with other tap key.
 #    if defined(FLOW_TAP_TERM)
                     if (flow_tap_key_if_within_term(keyp, flow_tap_prev_time)) {
-                        tapping_key = (keyrecord_t){0};
+                        tapping_key_reset();
                         debug_tapping_key();
                         return true;
                     }
 #    endif // defined(FLOW_TAP_TERM)
                     ac_dprintf("Tapping: Start with interfering other tap.\n");
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -613,7 +650,7 @@ bool process_tapping(keyrecord_t *keyp) {
             ac_dprintf("Tapping: End(Timeout after releasing last tap): ");
             debug_event(event);
             ac_dprintf("\n");
-            tapping_key = (keyrecord_t){0};
+            tapping_key_reset();
             debug_tapping_key();
             return false;
         }
@@ -625,18 +662,11 @@ bool process_tapping(keyrecord_t *keyp) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_enq(keyrecord_t record) {
-    if (IS_NOEVENT(record.event)) {
-        return true;
-    }
-
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (!key_wait_buffer_enq(&waiting_buffer, &record, 0, WAITING_BUFFER_INDEX(record.event))) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
-
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
@@ -647,8 +677,7 @@ bool waiting_buffer_enq(keyrecord_t record) {
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    key_wait_buffer_clear(&waiting_buffer);
 }
 
 /** \brief Waiting buffer typed
@@ -656,8 +685,11 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+    // Same key, opposite pressed state: flip the pressed bit and match against
+    // the compact index instead of the full records
+    const uint16_t target = WAITING_BUFFER_INDEX(event) ^ 0x8000;
+    for (uint8_t i = waiting_buffer.tail; i != waiting_buffer.head; i = key_wait_buffer_next(&waiting_buffer, i)) {
+        if (waiting_buffer.entries[i].context == target) {
             return true;
         }
     }
@@ -669,8 +701,8 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
+    for (uint8_t i = waiting_buffer.tail; i != waiting_buffer.head; i = key_wait_buffer_next(&waiting_buffer, i)) {
+        if (waiting_buffer.entries[i].context & 0x8000) return true;
     }
     return false;
 }
@@ -690,11 +722,11 @@ void waiting_buffer_scan_tap(void) {
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        keyrecord_t *candidate = &waiting_buffer[i];
+    for (uint8_t i = waiting_buffer.tail; i != waiting_buffer.head; i = key_wait_buffer_next(&waiting_buffer, i)) {
+        keyrecord_t *candidate = &waiting_buffer.entries[i].record;
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
-            WITHIN_TAPPING_TERM(waiting_buffer[i].event) || MAYBE_RETRO_SHIFTING(waiting_buffer[i].event, &tapping_key)
+            WITHIN_TAPPING_TERM(waiting_buffer.entries[i].record.event) || MAYBE_RETRO_SHIFTING(waiting_buffer.entries[i].record.event, &tapping_key)
         )) {
             // clang-format on
             tapping_key.tap.count = 1;
@@ -774,8 +806,8 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        keyrecord_t *  cur         = &waiting_buffer[i];
+    for (uint8_t i = waiting_buffer.tail; i != waiting_buffer.head; i = key_wait_buffer_next(&waiting_buffer, i)) {
+        keyrecord_t *  cur         = &waiting_buffer.entries[i].record;
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
             break;
@@ -789,15 +821,15 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
 }
 
 static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
-    while (waiting_buffer_tail != waiting_buffer_head) {
-        keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
-        ac_dprintf("waiting_buffer_chordal_hold_taps_until: processing [%u]\n", waiting_buffer_tail);
+    while (waiting_buffer.tail != waiting_buffer.head) {
+        keyrecord_t *record = &waiting_buffer.entries[waiting_buffer.tail].record;
+        ac_dprintf("waiting_buffer_chordal_hold_taps_until: processing [%u]\n", waiting_buffer.tail);
         if (record->event.pressed && is_tap_record(record)) {
             record->tap.count = 1;
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail);
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -806,12 +838,12 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
+    for (; waiting_buffer.tail != waiting_buffer.head; waiting_buffer.tail = key_wait_buffer_next(&waiting_buffer, waiting_buffer.tail)) {
+        if (is_tap_record(&waiting_buffer.entries[waiting_buffer.tail].record)) {
             break; // Stop once a tap-hold key event is reached.
         }
-        ac_dprintf("waiting_buffer_process_regular: processing [%u]\n", waiting_buffer_tail);
-        process_record(&waiting_buffer[waiting_buffer_tail]);
+        ac_dprintf("waiting_buffer_process_regular: processing [%u]\n", waiting_buffer.tail);
+        process_record(&waiting_buffer.entries[waiting_buffer.tail].record);
     }
     debug_waiting_buffer();
 }
@@ -821,7 +853,7 @@ static void waiting_buffer_process_regular(void) {
 void flow_tap_update_last_event(keyrecord_t *record) {
     const uint16_t keycode = get_record_keycode(record, false);
     // Don't update while a tap-hold key is unsettled.
-    if (record->tap.count == 0 && (waiting_buffer_tail != waiting_buffer_head || (tapping_key.event.pressed && tapping_key.tap.count == 0))) {
+    if (record->tap.count == 0 && (waiting_buffer.tail != waiting_buffer.head || (tapping_key.event.pressed && tapping_key.tap.count == 0))) {
         return;
     }
     // Ignore releases of modifiers and held layer switches.
@@ -921,9 +953,9 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer.tail; i != waiting_buffer.head; i = key_wait_buffer_next(&waiting_buffer, i)) {
         ac_dprintf(" [%u]=", i);
-        debug_record(waiting_buffer[i]);
+        debug_record(waiting_buffer.entries[i].record);
     }
     ac_dprintf("}\n");
 }
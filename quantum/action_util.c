@@ -312,11 +312,191 @@ void send_nkro_report(void) {
 }
 #endif
 
+#if defined(ROLL_COALESCING_ENABLE) && !defined(REPORT_COALESCING_ENABLE)
+#    error "ROLL_COALESCING_ENABLE requires REPORT_COALESCING_ENABLE"
+#endif
+
+#ifdef REPORT_COALESCING_ENABLE
+static uint8_t           report_defer_depth = 0;
+static bool              report_defer_dirty = false;
+static uint8_t           report_defer_mods  = 0;
+static report_keyboard_t report_defer_keys;
+#    ifdef NKRO_ENABLE
+static report_nkro_t report_defer_nkro;
+#    endif
+
+#    ifndef ROLL_COALESCING_ENABLE
+/** \brief Check that nothing held at the start of the coalescing window has been released since.
+ */
+static bool deferred_changes_are_additive(void) {
+    if (report_defer_mods & ~(get_mods() | get_weak_mods())) {
+        return false;
+    }
+#        ifdef NKRO_ENABLE
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            if (report_defer_nkro.bits[i] & ~nkro_report->bits[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+#        endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = report_defer_keys.keys[i];
+        if (key && !is_key_pressed(key)) {
+            return false;
+        }
+    }
+    return true;
+}
+#    endif // !ROLL_COALESCING_ENABLE
+
+static void snapshot_report_state(void) {
+    report_defer_mods = get_mods() | get_weak_mods();
+    report_defer_keys = *keyboard_report;
+#    ifdef NKRO_ENABLE
+    report_defer_nkro = *nkro_report;
+#    endif
+}
+
+#    ifdef ROLL_COALESCING_ENABLE
+// HID usage bitmap of keys whose press happened inside the current window -- their release may not
+// fold into the same report, or the host would never see the tap at all.
+static uint8_t roll_pressed_in_window[32];
+static uint8_t roll_mods_in_window = 0;
+
+__attribute__((weak)) bool roll_coalescing_key_allowed(uint8_t keycode) {
+    return true;
+}
+
+static void roll_window_reset(void) {
+    memset(roll_pressed_in_window, 0, sizeof(roll_pressed_in_window));
+    roll_mods_in_window = 0;
+}
+
+/** \brief Diff the current report state against the last observed state, recording in-window
+ * presses and deciding whether any releases can fold into the pending report.
+ *
+ * A release is mergeable when the host has already seen the press (the key went down before the
+ * window opened) and the key has not been opted out via roll_coalescing_key_allowed() -- gaming
+ * keys want every transition on the wire immediately. Advances the observed state on success; on
+ * failure the caller flushes through and resets the window, so partial tracking updates are moot.
+ */
+static bool deferred_changes_are_mergeable(void) {
+    uint8_t mods          = get_mods() | get_weak_mods();
+    uint8_t released_mods = report_defer_mods & ~mods;
+    if (released_mods & roll_mods_in_window) {
+        return false;
+    }
+    roll_mods_in_window |= mods & ~report_defer_mods;
+
+#        ifdef NKRO_ENABLE
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            uint8_t released = report_defer_nkro.bits[i] & ~nkro_report->bits[i];
+            if (released & roll_pressed_in_window[i]) {
+                return false;
+            }
+            while (released) {
+                uint8_t bit = __builtin_ctz(released);
+                if (!roll_coalescing_key_allowed((uint8_t)(i * 8 + bit))) {
+                    return false;
+                }
+                released &= released - 1;
+            }
+            roll_pressed_in_window[i] |= nkro_report->bits[i] & ~report_defer_nkro.bits[i];
+        }
+        snapshot_report_state();
+        return true;
+    }
+#        endif
+    // 6KRO: check every key held at the last observed state that has since been released
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = report_defer_keys.keys[i];
+        if (key && !is_key_pressed(key)) {
+            if (roll_pressed_in_window[key >> 3] & (1 << (key & 7))) {
+                return false;
+            }
+            if (!roll_coalescing_key_allowed(key)) {
+                return false;
+            }
+        }
+    }
+    // Record keys newly pressed since the last observed state
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = keyboard_report->keys[i];
+        if (!key) {
+            continue;
+        }
+        bool was_pressed = false;
+        for (uint8_t j = 0; j < KEYBOARD_REPORT_KEYS; j++) {
+            if (report_defer_keys.keys[j] == key) {
+                was_pressed = true;
+                break;
+            }
+        }
+        if (!was_pressed) {
+            roll_pressed_in_window[key >> 3] |= 1 << (key & 7);
+        }
+    }
+    snapshot_report_state();
+    return true;
+}
+#    endif // ROLL_COALESCING_ENABLE
+
+void keyboard_report_defer(void) {
+    if (report_defer_depth++ == 0) {
+        report_defer_dirty = false;
+        snapshot_report_state();
+#    ifdef ROLL_COALESCING_ENABLE
+        roll_window_reset();
+#    endif
+    }
+}
+
+void keyboard_report_flush(void) {
+    if (report_defer_depth == 0) {
+        return;
+    }
+    if (--report_defer_depth == 0 && report_defer_dirty) {
+        report_defer_dirty = false;
+        send_keyboard_report();
+    }
+}
+#endif // REPORT_COALESCING_ENABLE
+
 /** \brief Send keyboard report
  *
  * FIXME: needs doc
  */
 void send_keyboard_report(void) {
+#ifdef REPORT_COALESCING_ENABLE
+    if (report_defer_depth > 0) {
+#    ifdef ROLL_COALESCING_ENABLE
+        // Roll-aware mode: releases of keys the host already saw may merge with subsequent
+        // presses, so a fast roll (A down, B down, A up, B up) costs three reports, not four.
+        if (deferred_changes_are_mergeable()) {
+            report_defer_dirty = true;
+            return;
+        }
+#    else
+        if (deferred_changes_are_additive()) {
+            // Press-only changes merge into a single report sent at the end of the window.
+            report_defer_dirty = true;
+            return;
+        }
+#    endif
+        // A transition inside the window has to remain observable by the host -- send this report
+        // through immediately, along with whatever was pending, and restart the window from the
+        // new state.
+        report_defer_dirty = false;
+        snapshot_report_state();
+#    ifdef ROLL_COALESCING_ENABLE
+        roll_window_reset();
+#    endif
+    }
+#endif // REPORT_COALESCING_ENABLE
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
         send_nkro_report();
@@ -32,6 +32,26 @@ extern report_nkro_t *nkro_report;
 
 void send_keyboard_report(void);
 
+/* Report coalescing: between keyboard_report_defer() and keyboard_report_flush(), press-only report
+ * changes are merged and transmitted as one report at the flush; any release inside the window is
+ * sent through immediately so the host never misses a key transition. Windows may nest. */
+#ifdef REPORT_COALESCING_ENABLE
+void keyboard_report_defer(void);
+void keyboard_report_flush(void);
+#else
+static inline void keyboard_report_defer(void) {}
+static inline void keyboard_report_flush(void) {}
+#endif
+
+/* Roll coalescing: within a coalescing window, releases of keys the host has already seen may also
+ * merge with subsequent presses (a fast roll then costs three reports instead of four). A key that
+ * both presses and releases inside one window always flushes through so the tap stays visible.
+ * Override roll_coalescing_key_allowed() to keep specific HID usages (e.g. gaming keys) on the
+ * immediate path. Requires REPORT_COALESCING_ENABLE. */
+#ifdef ROLL_COALESCING_ENABLE
+bool roll_coalescing_key_allowed(uint8_t keycode);
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(key);
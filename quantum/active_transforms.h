@@ -0,0 +1,45 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** \file
+ *
+ * Consolidated "active transformations" bitword.
+ *
+ * Features that transform ordinary key events (Caps Word, key overrides,
+ * Auto Shift) publish whether they are currently armed by updating their bit
+ * when their state changes - on toggle or activation, not per key event.
+ * process_record_quantum() then skips the per-event handler of a disarmed
+ * feature with a single test of the cached word, which is the common case:
+ * most events arrive while none of these transformations apply.
+ *
+ * Only plain HID events (keycode <= QK_MODS_MAX) are ever skipped; the
+ * quantum-range toggle keycodes that re-arm a feature always reach their
+ * handler.
+ */
+
+enum active_transform_flags {
+    ACTIVE_TRANSFORM_CAPS_WORD    = 1 << 0,
+    ACTIVE_TRANSFORM_KEY_OVERRIDE = 1 << 1,
+    ACTIVE_TRANSFORM_AUTO_SHIFT   = 1 << 2,
+};
+
+extern uint8_t active_transforms;
+
+/** \brief Arms or disarms a transformation. Called by the owning feature whenever its state changes. */
+static inline void active_transform_set(uint8_t transform, bool active) {
+    if (active) {
+        active_transforms |= transform;
+    } else {
+        active_transforms &= (uint8_t)~transform;
+    }
+}
+
+/** \brief Whether the given transformation currently has to see key events. */
+static inline bool active_transform_is_set(uint8_t transform) {
+    return (active_transforms & transform) != 0;
+}
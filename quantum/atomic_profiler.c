@@ -0,0 +1,125 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "atomic_profiler.h"
+
+#include <string.h>
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#else
+#    include "timer.h"
+#endif
+
+static atomic_site_stats_t sites[ATOMIC_PROFILER_MAX_SITES];
+static uint8_t             registered = 0;
+
+static uint32_t atomic_profiler_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    // Realtime counter, same source as the CPU profiler; wraps are absorbed by
+    // the unsigned subtraction in atomic_profiler_leave().
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    // Millisecond fallback: only sections beyond a millisecond register, which
+    // on AVR is precisely the pathological case the audit is hunting.
+    return timer_read32();
+#endif
+}
+
+atomic_profiler_scope_t atomic_profiler_enter(const char *file, uint16_t line) {
+    atomic_profiler_scope_t scope = {.site = 0xFF};
+
+    // File literals are unique pointers per call site, so pointer comparison is enough.
+    for (uint8_t i = 0; i < registered; i++) {
+        if (sites[i].file == file && sites[i].line == line) {
+            scope.site = i;
+            break;
+        }
+    }
+    if (scope.site == 0xFF && registered < ATOMIC_PROFILER_MAX_SITES) {
+        sites[registered] = (atomic_site_stats_t){.file = file, .line = line};
+        scope.site        = registered++;
+    }
+
+    // Taken last so the registry lookup is not charged to the masked window.
+    scope.start = atomic_profiler_timestamp();
+    return scope;
+}
+
+void atomic_profiler_leave(const atomic_profiler_scope_t *scope) {
+    uint32_t dt = atomic_profiler_timestamp() - scope->start;
+    if (scope->site >= ATOMIC_PROFILER_MAX_SITES) {
+        return;
+    }
+
+    // Runs after interrupts are re-enabled; a section entered from both thread and
+    // interrupt context can tear a counter update, which profiling builds tolerate.
+    atomic_site_stats_t *stats = &sites[scope->site];
+    stats->entries++;
+    stats->total_ticks += dt;
+    if (dt > stats->max_ticks) {
+        stats->max_ticks = dt;
+    }
+}
+
+uint8_t atomic_profiler_site_count(void) {
+    return registered;
+}
+
+const atomic_site_stats_t *atomic_profiler_get_site(uint8_t index) {
+    if (index >= registered) {
+        return NULL;
+    }
+    return &sites[index];
+}
+
+void atomic_profiler_reset(void) {
+    for (uint8_t i = 0; i < registered; i++) {
+        sites[i].entries     = 0;
+        sites[i].total_ticks = 0;
+        sites[i].max_ticks   = 0;
+    }
+}
+
+static const char *basename_of(const char *path) {
+    const char *base = path;
+    for (const char *p = path; *p; p++) {
+        if (*p == '/' || *p == '\\') {
+            base = p + 1;
+        }
+    }
+    return base;
+}
+
+uint8_t atomic_profiler_fill_report(uint8_t index, uint8_t *buffer, uint8_t length) {
+    if (index >= registered || length < 16) {
+        return 0;
+    }
+
+    const atomic_site_stats_t *stats = &sites[index];
+
+    buffer[0]  = registered;
+    buffer[1]  = index;
+    buffer[2]  = stats->line & 0xFF;
+    buffer[3]  = (stats->line >> 8) & 0xFF;
+    buffer[4]  = stats->entries & 0xFF;
+    buffer[5]  = (stats->entries >> 8) & 0xFF;
+    buffer[6]  = (stats->entries >> 16) & 0xFF;
+    buffer[7]  = (stats->entries >> 24) & 0xFF;
+    buffer[8]  = stats->total_ticks & 0xFF;
+    buffer[9]  = (stats->total_ticks >> 8) & 0xFF;
+    buffer[10] = (stats->total_ticks >> 16) & 0xFF;
+    buffer[11] = (stats->total_ticks >> 24) & 0xFF;
+    buffer[12] = stats->max_ticks & 0xFF;
+    buffer[13] = (stats->max_ticks >> 8) & 0xFF;
+    buffer[14] = (stats->max_ticks >> 16) & 0xFF;
+    buffer[15] = (stats->max_ticks >> 24) & 0xFF;
+
+    memset(&buffer[16], 0, length - 16);
+    const char *base = basename_of(stats->file);
+    for (uint8_t i = 16; i < length && *base; i++, base++) {
+        buffer[i] = (uint8_t)*base;
+    }
+
+    return length;
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup atomic_profiler Interrupt-masked section profiler
+ *
+ * \brief Ranks ATOMIC_BLOCK call sites by time spent with interrupts masked.
+ *
+ * With ATOMIC_PROFILER_ENABLE, the ATOMIC_BLOCK_RESTORESTATE / ATOMIC_BLOCK_FORCEON macros register their call
+ * site (file and line) on first entry and accumulate an entry counter, cumulative masked ticks and the worst
+ * single masked duration per site. Ticks use the platform's fastest monotonic counter, same as \ref cpu_profiler;
+ * the absolute rate is platform-specific, but relative comparison between sites -- which is what an elimination
+ * audit needs -- is unit-free. The measured span starts just before interrupts are disabled and ends just after
+ * they are re-enabled, so per-site figures slightly overestimate the true masked window by the bookkeeping cost.
+ *
+ * Statistics accumulate silently and are drained over raw HID via \ref atomic_profiler_fill_report, one site per
+ * report, until the site count is exhausted.
+ *
+ * Bare ATOMIC_BLOCK(type) uses are deliberately not wrapped: the AVR timer internals the profiler's own
+ * timestamping relies on use that form.
+ * \{
+ */
+
+/**
+ * \brief Maximum number of distinct call sites tracked; later sites are executed unprofiled.
+ */
+#ifndef ATOMIC_PROFILER_MAX_SITES
+#    define ATOMIC_PROFILER_MAX_SITES 24
+#endif
+
+typedef struct atomic_site_stats_t {
+    const char *file;        ///< __FILE__ literal of the call site
+    uint16_t    line;        ///< __LINE__ of the call site
+    uint32_t    entries;     ///< times the section was entered
+    uint32_t    total_ticks; ///< cumulative masked duration
+    uint32_t    max_ticks;   ///< worst single masked duration
+} atomic_site_stats_t;
+
+/**
+ * \brief Number of call sites registered so far.
+ */
+uint8_t atomic_profiler_site_count(void);
+
+/**
+ * \brief Retrieve one site's statistics, or NULL if the index is out of range.
+ */
+const atomic_site_stats_t *atomic_profiler_get_site(uint8_t index);
+
+/**
+ * \brief Zero all counters. Registered sites keep their indices.
+ */
+void atomic_profiler_reset(void);
+
+/**
+ * \brief Pack one site's statistics into a buffer for transmission over raw HID.
+ *
+ * Layout: site count (1 byte), site index (1 byte), line (2 bytes LE), entries (4 bytes LE), total ticks
+ * (4 bytes LE), max ticks (4 bytes LE), then the file's basename in the remaining bytes, NUL-padded.
+ *
+ * \return the number of bytes written, or 0 if the buffer is too small or the index is invalid.
+ */
+uint8_t atomic_profiler_fill_report(uint8_t index, uint8_t *buffer, uint8_t length);
+
+/**
+ * \brief Scope handle threaded through an instrumented block; see atomic_util.h.
+ */
+typedef struct atomic_profiler_scope_t {
+    uint8_t  site;
+    uint32_t start;
+} atomic_profiler_scope_t;
+
+atomic_profiler_scope_t atomic_profiler_enter(const char *file, uint16_t line);
+void                    atomic_profiler_leave(const atomic_profiler_scope_t *scope);
+
+/** \} */
@@ -9,13 +9,24 @@
 #    define BATTERY_SAMPLE_INTERVAL 30000
 #endif
 
-static uint8_t last_bat_level = 100;
-
-void battery_init(void) {
-    battery_driver_init();
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+#    ifndef BATTERY_SAMPLE_INTERVAL_MIN
+#        define BATTERY_SAMPLE_INTERVAL_MIN 1000
+#    endif
+#    ifndef BATTERY_SAMPLE_INTERVAL_MAX
+#        define BATTERY_SAMPLE_INTERVAL_MAX BATTERY_SAMPLE_INTERVAL
+#    endif
+// Deviation between a raw sample and the filtered voltage that signals a load change, in millivolts
+#    ifndef BATTERY_ADAPTIVE_TRANSIENT_MV
+#        define BATTERY_ADAPTIVE_TRANSIENT_MV 40
+#    endif
+// One-pole IIR smoothing strength: filtered += (raw - filtered) / 2^shift per sample
+#    ifndef BATTERY_ADAPTIVE_FILTER_SHIFT
+#        define BATTERY_ADAPTIVE_FILTER_SHIFT 3
+#    endif
+#endif
 
-    last_bat_level = battery_driver_sample_percent();
-}
+static uint8_t last_bat_level = 100;
 
 __attribute__((weak)) void battery_percent_changed_user(uint8_t level) {}
 __attribute__((weak)) void battery_percent_changed_kb(uint8_t level) {}
@@ -25,6 +36,74 @@ static void handle_percent_changed(void) {
     battery_percent_changed_kb(last_bat_level);
 }
 
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+
+// Filtered battery voltage in mv << BATTERY_ADAPTIVE_FILTER_SHIFT fixed point
+static uint32_t filtered_mv;
+static uint32_t sample_interval = BATTERY_SAMPLE_INTERVAL_MIN;
+static uint32_t bat_timer       = 0;
+
+__attribute__((weak)) uint8_t battery_percent_from_mv(uint16_t mv) {
+    // Discharge curve for a single LiPo cell; override for other chemistries.
+    // https://github.com/zmkfirmware/zmk/blob/3f7c9d7cc4f46617faad288421025ea2a6b0bd28/app/module/drivers/sensor/battery/battery_common.c#L33
+    if (mv >= 4200) {
+        return 100;
+    } else if (mv <= 3450) {
+        return 0;
+    }
+
+    return mv * 2 / 15 - 459;
+}
+
+void battery_init(void) {
+    battery_driver_init();
+
+    uint16_t raw    = battery_driver_get_mv();
+    filtered_mv     = (uint32_t)raw << BATTERY_ADAPTIVE_FILTER_SHIFT;
+    last_bat_level  = battery_percent_from_mv(raw);
+    sample_interval = BATTERY_SAMPLE_INTERVAL_MIN;
+    bat_timer       = timer_read32();
+}
+
+void battery_task(void) {
+    if (timer_elapsed32(bat_timer) < sample_interval) {
+        return;
+    }
+    bat_timer = timer_read32();
+
+    const uint16_t raw      = battery_driver_get_mv();
+    const uint16_t smoothed = (uint16_t)(filtered_mv >> BATTERY_ADAPTIVE_FILTER_SHIFT);
+    const uint16_t delta    = raw > smoothed ? raw - smoothed : smoothed - raw;
+
+    filtered_mv += raw - smoothed;
+
+    // Back off exponentially while the voltage is stable; snap back to fast sampling on a load
+    // transient so the filter tracks the sag instead of lagging it by minutes
+    if (delta >= BATTERY_ADAPTIVE_TRANSIENT_MV) {
+        sample_interval = BATTERY_SAMPLE_INTERVAL_MIN;
+    } else if (sample_interval < BATTERY_SAMPLE_INTERVAL_MAX) {
+        sample_interval = sample_interval * 2 > BATTERY_SAMPLE_INTERVAL_MAX ? BATTERY_SAMPLE_INTERVAL_MAX : sample_interval * 2;
+    }
+
+    const uint8_t level = battery_percent_from_mv((uint16_t)(filtered_mv >> BATTERY_ADAPTIVE_FILTER_SHIFT));
+    if (level != last_bat_level) {
+        last_bat_level = level;
+        handle_percent_changed();
+    }
+}
+
+uint16_t battery_get_millivolts(void) {
+    return (uint16_t)(filtered_mv >> BATTERY_ADAPTIVE_FILTER_SHIFT);
+}
+
+#else // BATTERY_ADAPTIVE_SAMPLING
+
+void battery_init(void) {
+    battery_driver_init();
+
+    last_bat_level = battery_driver_sample_percent();
+}
+
 void battery_task(void) {
     static uint32_t bat_timer = 0;
     if (timer_elapsed32(bat_timer) > BATTERY_SAMPLE_INTERVAL) {
@@ -36,6 +115,8 @@ void battery_task(void) {
     }
 }
 
+#endif // BATTERY_ADAPTIVE_SAMPLING
+
 uint8_t battery_get_percent(void) {
     return last_bat_level;
 }
@@ -31,6 +31,24 @@ void battery_task(void);
  */
 uint8_t battery_get_percent(void);
 
+#ifdef BATTERY_ADAPTIVE_SAMPLING
+/**
+ * \brief Get the filtered battery voltage. Served from the cache; never touches the driver.
+ *
+ * \return The battery voltage, in millivolts.
+ */
+uint16_t battery_get_millivolts(void);
+
+/**
+ * \brief Convert a battery voltage to a state-of-charge estimate.
+ *
+ * The weak default applies a single-cell LiPo discharge curve; override for other chemistries.
+ *
+ * \return The battery percentage, in the range 0-100.
+ */
+uint8_t battery_percent_from_mv(uint16_t mv);
+#endif
+
 /**
  * \brief user hook called when battery level changed.
  *
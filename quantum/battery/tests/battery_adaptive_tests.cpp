@@ -0,0 +1,138 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using testing::_;
+using testing::Return;
+
+class BatteryAdaptiveDriverMock {
+   public:
+    virtual ~BatteryAdaptiveDriverMock() {}
+
+    // mock methods
+    MOCK_METHOD0(battery_driver_init, void(void));
+    MOCK_METHOD0(battery_driver_get_mv, uint16_t(void));
+    MOCK_METHOD1(battery_percent_changed_kb, void(uint8_t));
+};
+
+class BatteryAdaptiveTest : public ::testing::Test {
+   public:
+    BatteryAdaptiveTest() {
+        _batteryDriverMock.reset(new ::testing::NiceMock<BatteryAdaptiveDriverMock>());
+    }
+    virtual ~BatteryAdaptiveTest() {
+        _batteryDriverMock.reset();
+    }
+
+    static std::unique_ptr<BatteryAdaptiveDriverMock> _batteryDriverMock;
+};
+
+std::unique_ptr<BatteryAdaptiveDriverMock> BatteryAdaptiveTest::_batteryDriverMock;
+
+extern "C" {
+#include "quantum/battery/battery.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+
+void battery_driver_init(void) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        BatteryAdaptiveTest::_batteryDriverMock->battery_driver_init();
+    }
+}
+
+uint16_t battery_driver_get_mv(void) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        return BatteryAdaptiveTest::_batteryDriverMock->battery_driver_get_mv();
+    }
+    return 0;
+}
+
+void battery_percent_changed_kb(uint8_t level) {
+    if (BatteryAdaptiveTest::_batteryDriverMock) {
+        BatteryAdaptiveTest::_batteryDriverMock->battery_percent_changed_kb(level);
+    }
+}
+}
+
+TEST_F(BatteryAdaptiveTest, TestInit) {
+    // init driver and initial sample
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_init()).Times(1);
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(1).WillOnce(Return(4200));
+
+    battery_init();
+
+    EXPECT_EQ(battery_get_percent(), 100);
+    EXPECT_EQ(battery_get_millivolts(), 4200);
+}
+
+TEST_F(BatteryAdaptiveTest, TestGet) {
+    // queries are served from the cache without touching the driver
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(0);
+
+    battery_get_percent();
+    battery_get_millivolts();
+}
+
+TEST_F(BatteryAdaptiveTest, TestBackoffWhileStable) {
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).WillRepeatedly(Return(4200));
+    battery_init();
+
+    // first sample at the minimum interval...
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(1).WillOnce(Return(4200));
+    advance_time(1000);
+    battery_task();
+
+    // ...after which a stable voltage doubles the interval, so the next minimum-interval tick stays cached
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(0);
+    advance_time(1000);
+    battery_task();
+
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(1).WillOnce(Return(4200));
+    advance_time(1000);
+    battery_task();
+}
+
+TEST_F(BatteryAdaptiveTest, TestTransientRestoresFastSampling) {
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).WillRepeatedly(Return(4200));
+    battery_init();
+
+    // grow the interval to 4x with two stable samples
+    advance_time(1000);
+    battery_task();
+    advance_time(2000);
+    battery_task();
+
+    // a load transient beyond the deviation threshold snaps the interval back to the minimum
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(1).WillOnce(Return(4000));
+    advance_time(4000);
+    battery_task();
+
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).Times(1).WillOnce(Return(4000));
+    advance_time(1000);
+    battery_task();
+}
+
+TEST_F(BatteryAdaptiveTest, TestChangedOnlyOnLevelChange) {
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).WillRepeatedly(Return(4200));
+    battery_init();
+
+    // stable voltage: no callback
+    EXPECT_CALL(*_batteryDriverMock, battery_percent_changed_kb(_)).Times(0);
+    advance_time(1000);
+    battery_task();
+
+    // the filter needs a run of samples to traverse the drop; callbacks fire as levels are crossed, and the
+    // maximum-interval steps guarantee a sample per iteration regardless of how far the interval has backed off
+    EXPECT_CALL(*_batteryDriverMock, battery_driver_get_mv()).WillRepeatedly(Return(3800));
+    EXPECT_CALL(*_batteryDriverMock, battery_percent_changed_kb(_)).Times(testing::AtLeast(1));
+    for (int i = 0; i < 64; i++) {
+        advance_time(30000);
+        battery_task();
+    }
+
+    EXPECT_EQ(battery_get_millivolts(), 3800);
+    EXPECT_EQ(battery_get_percent(), battery_percent_from_mv(3800));
+}
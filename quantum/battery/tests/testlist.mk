@@ -1,2 +1,3 @@
 TEST_LIST += \
 	battery \
+	battery_adaptive \
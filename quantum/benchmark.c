@@ -0,0 +1,123 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.h"
+
+#include "matrix.h"
+#include "debounce.h"
+#include "timer.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+static uint32_t benchmark_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    // Realtime counter: the fastest monotonic source ChibiOS offers; wraps are
+    // handled by the unsigned subtraction in benchmark_run().
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    // Fallback: millisecond resolution only; short workloads will need large
+    // iteration counts to accumulate a meaningful total.
+    return timer_read32();
+#endif
+}
+
+__attribute__((weak)) bool benchmark_workload_kb(uint8_t workload) {
+    return false;
+}
+
+static bool benchmark_workload(uint8_t workload) {
+    switch (workload) {
+        case BENCHMARK_MATRIX_SCAN:
+            // The main loop latches the cached "now" before each scan; do the same
+            // so the deferred debouncers see time advancing mid-run.
+            timer_now_refresh();
+            matrix_scan();
+            return true;
+
+        case BENCHMARK_DEBOUNCE: {
+            // Toggle a single key each iteration so the algorithm exercises its
+            // changed-key path; rows beyond the first stay quiescent.
+            static matrix_row_t raw[MATRIX_ROWS];
+            static matrix_row_t cooked[MATRIX_ROWS];
+            timer_now_refresh();
+            raw[0] ^= 1;
+            debounce(raw, cooked, MATRIX_ROWS, true);
+            return true;
+        }
+
+        default:
+            return benchmark_workload_kb(workload);
+    }
+}
+
+bool benchmark_run(uint8_t workload, uint32_t iterations, benchmark_result_t *result) {
+    if (iterations == 0 || result == NULL) {
+        return false;
+    }
+
+    // The debounce workload feeds synthetic transitions through the live debounce state; reset it
+    // around the run so they cannot leak into real key handling.
+    if (workload == BENCHMARK_DEBOUNCE) {
+        debounce_free();
+        debounce_init(MATRIX_ROWS);
+    }
+
+    // One untimed iteration: warms caches and lazily built tables, and validates the workload id.
+    if (!benchmark_workload(workload)) {
+        return false;
+    }
+
+    result->iterations  = iterations;
+    result->total_ticks = 0;
+    result->min_ticks   = UINT32_MAX;
+    result->max_ticks   = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t start = benchmark_timestamp();
+        benchmark_workload(workload);
+        uint32_t dt = benchmark_timestamp() - start;
+
+        result->total_ticks += dt;
+        if (dt < result->min_ticks) {
+            result->min_ticks = dt;
+        }
+        if (dt > result->max_ticks) {
+            result->max_ticks = dt;
+        }
+    }
+
+    if (workload == BENCHMARK_DEBOUNCE) {
+        debounce_free();
+        debounce_init(MATRIX_ROWS);
+    }
+
+    return true;
+}
+
+uint8_t benchmark_fill_report(uint8_t workload, const benchmark_result_t *result, uint8_t *buffer, uint8_t length) {
+    if (result == NULL || length < 17) {
+        return 0;
+    }
+
+    buffer[0]  = workload;
+    buffer[1]  = result->iterations & 0xFF;
+    buffer[2]  = (result->iterations >> 8) & 0xFF;
+    buffer[3]  = (result->iterations >> 16) & 0xFF;
+    buffer[4]  = (result->iterations >> 24) & 0xFF;
+    buffer[5]  = result->total_ticks & 0xFF;
+    buffer[6]  = (result->total_ticks >> 8) & 0xFF;
+    buffer[7]  = (result->total_ticks >> 16) & 0xFF;
+    buffer[8]  = (result->total_ticks >> 24) & 0xFF;
+    buffer[9]  = result->min_ticks & 0xFF;
+    buffer[10] = (result->min_ticks >> 8) & 0xFF;
+    buffer[11] = (result->min_ticks >> 16) & 0xFF;
+    buffer[12] = (result->min_ticks >> 24) & 0xFF;
+    buffer[13] = result->max_ticks & 0xFF;
+    buffer[14] = (result->max_ticks >> 8) & 0xFF;
+    buffer[15] = (result->max_ticks >> 16) & 0xFF;
+    buffer[16] = (result->max_ticks >> 24) & 0xFF;
+
+    return 17;
+}
@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup benchmark On-keyboard microbenchmark harness
+ *
+ * \brief Canned firmware workloads timed on the deployed hardware, triggered and reported over raw HID.
+ *
+ * Each workload runs a host-chosen number of iterations with per-iteration timing in ticks of the
+ * platform's fastest monotonic counter (the ChibiOS realtime counter on ARM boards, which counts CPU
+ * cycles on the RP2040 port). One untimed warm-up iteration runs first, so caches and lazily built
+ * tables are populated before measurement starts. Results are total/min/max ticks per iteration,
+ * giving apples-to-apples numbers across firmware releases on identical hardware and clocks.
+ *
+ * The harness runs synchronously -- the keyboard does not scan for the duration of a run, so hosts
+ * should size the iteration count accordingly.
+ * \{
+ */
+
+/**
+ * \brief Workload identifiers. Ids from BENCHMARK_WORKLOAD_KB upward are dispatched to the keyboard
+ * via benchmark_workload_kb().
+ */
+enum benchmark_workloads {
+    BENCHMARK_MATRIX_SCAN = 0,    // one full matrix_scan(), including debounce
+    BENCHMARK_DEBOUNCE,           // debounce algorithm fed one synthetic key toggle per iteration
+    BENCHMARK_WORKLOAD_KB = 0x80, // keyboard-specific workloads start here
+};
+
+typedef struct benchmark_result_t {
+    uint32_t iterations;
+    uint32_t total_ticks;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+} benchmark_result_t;
+
+/**
+ * \brief Run a workload for the given number of iterations.
+ *
+ * \return `true` if the workload id was recognised and the result filled in.
+ */
+bool benchmark_run(uint8_t workload, uint32_t iterations, benchmark_result_t *result);
+
+/**
+ * \brief Keyboard hook: perform one iteration of a keyboard-specific workload.
+ *
+ * Invoked once untimed (warm-up and id validation), then once per timed iteration.
+ *
+ * \return `false` if the workload id is not recognised.
+ */
+bool benchmark_workload_kb(uint8_t workload);
+
+/**
+ * \brief Pack a result into a buffer for transmission over raw HID.
+ *
+ * Layout: workload id (1 byte), then iterations, total ticks, min ticks, max ticks (4 bytes LE each).
+ *
+ * \return the number of bytes written, or 0 if the buffer is too small.
+ */
+uint8_t benchmark_fill_report(uint8_t workload, const benchmark_result_t *result, uint8_t *buffer, uint8_t length);
+
+/** \} */
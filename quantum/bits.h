@@ -31,3 +31,67 @@
  * gives us the 64-bit mask 0x000000ffffe00000.
  */
 #define GENMASK64(h, l) (((~UINT64_C(0)) - (UINT64_C(1) << (l)) + 1) & (~UINT64_C(0) >> (UINT64_WIDTH - 1 - (h))))
+
+/*
+ * Bit scanning primitives. On ISAs with the instructions (ARMv7-M and up: CLZ,
+ * and RBIT+CLZ for the trailing count) the compiler builtins lower to one or
+ * two cycles. ARMv6-M (Cortex-M0+) has none of them and the libgcc helpers are
+ * out-of-line calls, so branch-free SWAR sequences are inlined there instead -
+ * register-only, no tables to fetch from flash, and the RP2040's single-cycle
+ * multiplier makes the popcount reduction cheap. AVR stays on the builtins;
+ * the `l`-suffixed variants keep the operand 32-bit where int is 16-bit.
+ *
+ * Callers iterate the set bits of a matrix row / layer mask word-at-a-time:
+ *     while (bits) { uint8_t i = ctz32(bits); ...; bits &= bits - 1; }
+ * which touches only the set bits instead of testing every position.
+ */
+
+/**
+ * @brief Number of set bits in a 32-bit word.
+ */
+static inline uint8_t popcount32(uint32_t x) {
+#if defined(__ARM_ARCH_6M__)
+    x = x - ((x >> 1) & UINT32_C(0x55555555));
+    x = (x & UINT32_C(0x33333333)) + ((x >> 2) & UINT32_C(0x33333333));
+    x = (x + (x >> 4)) & UINT32_C(0x0F0F0F0F);
+    return (uint8_t)((x * UINT32_C(0x01010101)) >> 24);
+#else
+    return (uint8_t)__builtin_popcountl(x);
+#endif
+}
+
+/**
+ * @brief Index of the lowest set bit (count of trailing zeros). @p x must be non-zero.
+ */
+static inline uint8_t ctz32(uint32_t x) {
+#if defined(__ARM_ARCH_6M__)
+    // Isolate the lowest set bit, turn everything below it into ones, count those
+    return popcount32((x & -x) - 1);
+#else
+    return (uint8_t)__builtin_ctzl(x);
+#endif
+}
+
+/**
+ * @brief Count of leading zeros. @p x must be non-zero.
+ */
+static inline uint8_t clz32(uint32_t x) {
+#if defined(__ARM_ARCH_6M__)
+    // Smear the highest set bit downward, then count what is not covered
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    return (uint8_t)(32 - popcount32(x));
+#else
+    return (uint8_t)__builtin_clzl(x);
+#endif
+}
+
+/**
+ * @brief Index of the highest set bit. @p x must be non-zero.
+ */
+static inline uint8_t msb32(uint32_t x) {
+    return (uint8_t)(31 - clz32(x));
+}
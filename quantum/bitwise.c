@@ -18,94 +18,37 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 
 // bit population - return number of on-bit
+// Thin out-of-line wrappers around the popcount32 primitive in bits.h, which
+// is a single POPCNT-class builtin where the ISA has one and a branch-free
+// SWAR sequence on Cortex-M0+ - constant time either way, unlike the old
+// Kernighan loop whose cost grew with the number of set bits.
 __attribute__((noinline)) uint8_t bitpop(uint8_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
-    /*
-        const uint8_t bit_count[] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
-        return bit_count[bits>>4] + bit_count[bits&0x0F]
-    */
+    return popcount32(bits);
 }
 
 uint8_t bitpop16(uint16_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
+    return popcount32(bits);
 }
 
 uint8_t bitpop32(uint32_t bits) {
-    uint8_t c;
-    for (c = 0; bits; c++)
-        bits &= bits - 1;
-    return c;
+    return popcount32(bits);
 }
 
 // most significant on-bit - return highest location of on-bit
 // NOTE: return 0 when bit0 is on or all bits are off
+// Built on the clz32 primitive in bits.h: a single CLZ instruction on ARMv7-M+,
+// an inlined branch-free fallback on Cortex-M0+ where libgcc's helper would be
+// an out-of-line call.
 __attribute__((noinline)) uint8_t biton(uint8_t bits) {
-    uint8_t n = 0;
-    if (bits >> 4) {
-        bits >>= 4;
-        n += 4;
-    }
-    if (bits >> 2) {
-        bits >>= 2;
-        n += 2;
-    }
-    if (bits >> 1) {
-        bits >>= 1;
-        n += 1;
-    }
-    return n;
+    return bits ? msb32(bits) : 0;
 }
 
 uint8_t biton16(uint16_t bits) {
-    uint8_t n = 0;
-    if (bits >> 8) {
-        bits >>= 8;
-        n += 8;
-    }
-    if (bits >> 4) {
-        bits >>= 4;
-        n += 4;
-    }
-    if (bits >> 2) {
-        bits >>= 2;
-        n += 2;
-    }
-    if (bits >> 1) {
-        bits >>= 1;
-        n += 1;
-    }
-    return n;
+    return bits ? msb32(bits) : 0;
 }
 
 uint8_t biton32(uint32_t bits) {
-    uint8_t n = 0;
-    if (bits >> 16) {
-        bits >>= 16;
-        n += 16;
-    }
-    if (bits >> 8) {
-        bits >>= 8;
-        n += 8;
-    }
-    if (bits >> 4) {
-        bits >>= 4;
-        n += 4;
-    }
-    if (bits >> 2) {
-        bits >>= 2;
-        n += 2;
-    }
-    if (bits >> 1) {
-        bits >>= 1;
-        n += 1;
-    }
-    return n;
+    return bits ? msb32(bits) : 0;
 }
 
 __attribute__((noinline)) uint8_t bitrev(uint8_t bits) {
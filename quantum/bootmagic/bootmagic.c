@@ -16,6 +16,7 @@
 #include "bootmagic.h"
 #include "matrix.h"
 #include "keyboard.h"
+#include "timer.h"
 #include "wait.h"
 #include "eeconfig.h"
 #include "bootloader.h"
@@ -62,8 +63,13 @@ __attribute__((weak)) bool bootmagic_should_reset(void) {
  */
 __attribute__((weak)) void bootmagic_scan(void) {
     // We need multiple scans because debouncing can't be turned off.
+    // This runs before the first keyboard_task() iteration, so latch the cached
+    // "now" ourselves: the deferred debouncers consume timer_now*() and would
+    // otherwise see time frozen and never commit the held key.
+    timer_now_refresh();
     matrix_scan();
     wait_ms(BOOTMAGIC_DEBOUNCE);
+    timer_now_refresh();
     matrix_scan();
 
     if (bootmagic_should_reset()) {
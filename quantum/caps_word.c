@@ -14,6 +14,7 @@
 
 #include <stdint.h>
 #include "caps_word.h"
+#include "active_transforms.h"
 #include "timer.h"
 #include "action.h"
 #include "action_util.h"
@@ -58,6 +59,7 @@ void caps_word_on(void) {
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
     caps_word_active = true;
+    active_transform_set(ACTIVE_TRANSFORM_CAPS_WORD, true);
     caps_word_set_user(true);
 }
 
@@ -68,6 +70,7 @@ void caps_word_off(void) {
 
     unregister_weak_mods(MOD_MASK_SHIFT); // Make sure weak shift is off.
     caps_word_active = false;
+    active_transform_set(ACTIVE_TRANSFORM_CAPS_WORD, false);
     caps_word_set_user(false);
 }
 
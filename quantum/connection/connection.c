@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include "connection.h"
 #include "eeconfig.h"
+#include "host.h"
 #include "usb_util.h"
 #include "util.h"
 
@@ -61,6 +62,11 @@ static void handle_host_changed(void) {
 
     // TODO: Remove deprecated callback
     set_output_user(config.desired_host);
+
+    // All transports stay initialized from boot, so the switch itself is just the sink resolution
+    // in host.c changing -- replay the live HID state so the incoming host converges immediately
+    // instead of waiting for the next key event.
+    host_replay_state();
 }
 
 void connection_set_host_noeeprom(connection_host_t host) {
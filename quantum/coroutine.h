@@ -0,0 +1,92 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timer.h"
+
+/* Stackless cooperative coroutines for long-running keymap logic.
+ *
+ * Nothing in the main loop may block, so multi-frame logic (game rules, animation sequences, staged transitions)
+ * ends up as hand-rolled state machines: an enum, a timestamp per wait, and a switch that grows a case per step.
+ * These protothread-style macros let the same logic read as straight-line code. A coroutine function is re-entered
+ * on every poll and jumps straight to the statement it last parked at; between polls the only state kept is a
+ * resume point and one timer, so a coroutine costs 8 bytes of RAM and no stack.
+ *
+ * Local variables do NOT survive a yield -- the function genuinely returns. Anything that must persist across a
+ * wait belongs in statics or a context struct, exactly as in the state machines this replaces.
+ *
+ * Drive the coroutine function from any repeatedly-called context: housekeeping_task_user(), a game loop, or a
+ * deferred executor callback (return the poll interval to reschedule). CO_DELAY re-reads its argument on every
+ * poll, so a wait can be shortened mid-flight (e.g. Tetris soft drop). Each CO_* statement must sit on its own
+ * source line: the resume points are line numbers.
+ *
+ *     static coroutine_t co;
+ *     static void startup_banner(void) {
+ *         CO_BEGIN(&co);
+ *         draw_logo();
+ *         CO_DELAY(&co, 2000);
+ *         draw_scene();
+ *         CO_WAIT_UNTIL(&co, host_connected());
+ *         draw_status();
+ *         CO_END(&co);
+ *     }
+ */
+
+typedef struct coroutine_t {
+    uint16_t resume_point; // Line number of the statement we parked at; 0 = run from the top
+    uint32_t wait_timer;   // Start of the current CO_DELAY window
+} coroutine_t;
+
+/** @brief Opens the coroutine body; resumes at the last parked CO_* statement. Must be matched by CO_END. */
+#define CO_BEGIN(co)              \
+    switch ((co)->resume_point) { \
+        case 0:
+
+/** @brief Closes the coroutine body. Falling off the end restarts the coroutine on the next poll. */
+#define CO_END(co)           \
+    }                        \
+    (co)->resume_point = 0
+
+/** @brief Parks the coroutine here and returns; the next poll resumes after this statement. */
+#define CO_YIELD(co)                     \
+    do {                                 \
+        (co)->resume_point = __LINE__;   \
+        return;                          \
+        case __LINE__:;                  \
+    } while (0)
+
+/** @brief Parks the coroutine until the condition holds; the condition is re-evaluated on every poll. */
+#define CO_WAIT_UNTIL(co, cond)          \
+    do {                                 \
+        (co)->resume_point = __LINE__;   \
+        case __LINE__:                   \
+            if (!(cond)) {               \
+                return;                  \
+            }                            \
+    } while (0)
+
+/** @brief Parks the coroutine for the given number of milliseconds. The duration is re-evaluated on every poll, so it may change while waiting. */
+#define CO_DELAY(co, ms)                                        \
+    do {                                                        \
+        (co)->wait_timer   = timer_read32();                    \
+        (co)->resume_point = __LINE__;                          \
+        case __LINE__:                                          \
+            if (timer_elapsed32((co)->wait_timer) < (ms)) {     \
+                return;                                         \
+            }                                                   \
+    } while (0)
+
+/** @brief Abandons the current run; the next poll starts the coroutine from the top. */
+#define CO_RESTART(co)           \
+    do {                         \
+        (co)->resume_point = 0;  \
+        return;                  \
+    } while (0)
+
+/** @brief Rewinds a coroutine from outside its body (e.g. when (re)entering the mode that drives it). */
+static inline void co_reset(coroutine_t *co) {
+    co->resume_point = 0;
+}
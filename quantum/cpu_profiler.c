@@ -0,0 +1,82 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "cpu_profiler.h"
+
+#include <string.h>
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#else
+#    include "timer.h"
+#endif
+
+// EWMA weight: each new sample contributes 1/2^CPU_PROFILER_EWMA_SHIFT.
+#ifndef CPU_PROFILER_EWMA_SHIFT
+#    define CPU_PROFILER_EWMA_SHIFT 4
+#endif
+
+static cpu_probe_stats_t probes[CPU_PROBE_COUNT] = {0};
+
+uint32_t cpu_profiler_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    // Realtime counter: the fastest monotonic source ChibiOS offers; wraps are
+    // handled by the unsigned subtraction in cpu_profiler_record().
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    // Fallback: millisecond resolution only. Sub-millisecond probes will read
+    // as zero average with occasional 1-tick maxima.
+    return timer_read32();
+#endif
+}
+
+void cpu_profiler_record(uint8_t probe, uint32_t start_ts) {
+    if (probe >= CPU_PROBE_COUNT) {
+        return;
+    }
+
+    uint32_t           dt    = cpu_profiler_timestamp() - start_ts;
+    cpu_probe_stats_t *stats = &probes[probe];
+
+    stats->calls++;
+    stats->avg_ticks_x16 += (int32_t)((dt << 4) - stats->avg_ticks_x16) >> CPU_PROFILER_EWMA_SHIFT;
+    if (dt > stats->max_ticks) {
+        stats->max_ticks = dt;
+    }
+}
+
+const cpu_probe_stats_t *cpu_profiler_get_stats(uint8_t probe) {
+    if (probe >= CPU_PROBE_COUNT) {
+        return NULL;
+    }
+    return &probes[probe];
+}
+
+void cpu_profiler_reset(void) {
+    memset(probes, 0, sizeof(probes));
+}
+
+uint8_t cpu_profiler_fill_report(uint8_t probe, uint8_t *buffer, uint8_t length) {
+    if (probe >= CPU_PROBE_COUNT || length < 14) {
+        return 0;
+    }
+
+    const cpu_probe_stats_t *stats = &probes[probe];
+
+    buffer[0]  = CPU_PROBE_COUNT;
+    buffer[1]  = probe;
+    buffer[2]  = stats->calls & 0xFF;
+    buffer[3]  = (stats->calls >> 8) & 0xFF;
+    buffer[4]  = (stats->calls >> 16) & 0xFF;
+    buffer[5]  = (stats->calls >> 24) & 0xFF;
+    buffer[6]  = stats->avg_ticks_x16 & 0xFF;
+    buffer[7]  = (stats->avg_ticks_x16 >> 8) & 0xFF;
+    buffer[8]  = (stats->avg_ticks_x16 >> 16) & 0xFF;
+    buffer[9]  = (stats->avg_ticks_x16 >> 24) & 0xFF;
+    buffer[10] = stats->max_ticks & 0xFF;
+    buffer[11] = (stats->max_ticks >> 8) & 0xFF;
+    buffer[12] = (stats->max_ticks >> 16) & 0xFF;
+    buffer[13] = (stats->max_ticks >> 24) & 0xFF;
+
+    return 14;
+}
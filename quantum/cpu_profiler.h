@@ -0,0 +1,75 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup cpu_profiler Per-subsystem CPU time profiler
+ *
+ * \brief Aggregates execution time of named firmware subsystems.
+ *
+ * Fixed probes wrap the main loop's major phases (matrix scan, event processing, lighting, display flush, ...). Each
+ * probe keeps a fixed-point exponential moving average, a running maximum, and a call counter, all in raw timestamp
+ * ticks of the platform's fastest available counter. Absolute tick rate is platform-specific; dividing a probe's
+ * average by the main-loop probe's average yields the unit-free per-subsystem share of a loop iteration, which is
+ * what the raw HID export is meant for.
+ *
+ * Unlike basic_profiling.h this does not print to console -- statistics accumulate silently and are queried over
+ * raw HID (or cpu_profiler_get_stats()) at whatever rate the host wants to plot them.
+ * \{
+ */
+
+/**
+ * \brief Probe identifiers. Probes that are compiled out on a given board simply report zeroes.
+ */
+enum cpu_profiler_probes {
+    CPU_PROBE_MAIN_LOOP = 0, // one full keyboard_task() iteration
+    CPU_PROBE_MATRIX_SCAN,   // matrix_scan(), including debounce
+    CPU_PROBE_PROCESS_RECORD, // key event dispatch through action_exec()
+    CPU_PROBE_LIGHTING,      // rgblight/led_matrix/rgb_matrix tasks
+    CPU_PROBE_DISPLAY_FLUSH, // display framebuffer flushes (instrumented by the keymap)
+    CPU_PROBE_HOUSEKEEPING,  // housekeeping_task()
+    CPU_PROBE_COUNT
+};
+
+typedef struct cpu_probe_stats_t {
+    uint32_t calls;
+    uint32_t avg_ticks_x16; // EWMA of probe duration, 28.4 fixed point ticks
+    uint32_t max_ticks;
+} cpu_probe_stats_t;
+
+/**
+ * \brief Read the profiling timestamp counter. Pass the result to cpu_profiler_record() when the section ends.
+ */
+uint32_t cpu_profiler_timestamp(void);
+
+/**
+ * \brief Accumulate one timed section into the given probe.
+ */
+void cpu_profiler_record(uint8_t probe, uint32_t start_ts);
+
+/**
+ * \brief Retrieve the accumulated statistics for a probe, or NULL if the probe id is out of range.
+ */
+const cpu_probe_stats_t *cpu_profiler_get_stats(uint8_t probe);
+
+/**
+ * \brief Reset all probes.
+ */
+void cpu_profiler_reset(void);
+
+/**
+ * \brief Pack one probe's statistics into a buffer for transmission over raw HID.
+ *
+ * Layout: probe count (1 byte), probe id (1 byte), calls (4 bytes LE), average ticks x16 (4 bytes LE),
+ * max ticks (4 bytes LE).
+ *
+ * \return the number of bytes written, or 0 if the buffer is too small or the probe id is invalid.
+ */
+uint8_t cpu_profiler_fill_report(uint8_t probe, uint8_t *buffer, uint8_t length);
+
+/** \} */
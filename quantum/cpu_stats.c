@@ -0,0 +1,135 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "cpu_stats.h"
+
+#include <string.h>
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && (CH_CFG_USE_REGISTRY == TRUE) && (CH_DBG_STATISTICS == TRUE)
+
+/** Walks the registry to the index'th thread, or NULL past the end. */
+static thread_t *thread_at(uint8_t index) {
+    thread_t *tp = chRegFirstThread();
+    while (tp != NULL && index-- > 0) {
+        tp = chRegNextThread(tp);
+    }
+    return tp;
+}
+
+uint8_t cpu_stats_thread_count(void) {
+    uint8_t   count = 0;
+    thread_t *tp    = chRegFirstThread();
+    while (tp != NULL) {
+        count++;
+        tp = chRegNextThread(tp);
+    }
+    return count;
+}
+
+bool cpu_stats_get_thread(uint8_t index, cpu_stats_thread_t *stats) {
+    thread_t *tp = thread_at(index);
+    if (tp == NULL) {
+        return false;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    const char *name = chRegGetThreadNameX(tp);
+    if (name != NULL) {
+        strncpy(stats->name, name, sizeof(stats->name) - 1);
+    }
+    // tp->stats measures each scheduling slot of the thread; cumulative is the
+    // thread's total CPU time in realtime-counter cycles.
+    stats->cumulative_cycles = tp->stats.cumulative;
+    stats->worst_cycles      = (uint32_t)tp->stats.worst;
+    stats->slots             = (uint32_t)tp->stats.n;
+
+#    if CH_CFG_USE_DYNAMIC == TRUE
+    // Registry iteration references the returned thread when dynamic threads
+    // are in use; drop the reference we walked away with.
+    chThdRelease(tp);
+#    endif
+    return true;
+}
+
+bool cpu_stats_get_kernel(cpu_stats_kernel_t *stats) {
+    const kernel_stats_t *ks = &currcore->kernel_stats;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->irq_count    = (uint32_t)ks->n_irq;
+    stats->ctx_switches = (uint32_t)ks->n_ctxswc;
+    // The kernel only measures its critical zones inside ISRs, not full handler
+    // bodies, but ISR load scales with both -- trends and deltas still localize
+    // interrupt pressure.
+    stats->isr_critical_cycles = ks->m_crit_isr.cumulative;
+    stats->isr_critical_worst  = (uint32_t)ks->m_crit_isr.worst;
+    stats->thd_critical_cycles = ks->m_crit_thd.cumulative;
+    return true;
+}
+
+#else // No ChibiOS kernel accounting available: report no data.
+
+uint8_t cpu_stats_thread_count(void) {
+    return 0;
+}
+
+bool cpu_stats_get_thread(uint8_t index, cpu_stats_thread_t *stats) {
+    (void)index;
+    (void)stats;
+    return false;
+}
+
+bool cpu_stats_get_kernel(cpu_stats_kernel_t *stats) {
+    (void)stats;
+    return false;
+}
+
+#endif
+
+static void put_u32_le(uint8_t *buffer, uint32_t value) {
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+    buffer[2] = (value >> 16) & 0xFF;
+    buffer[3] = (value >> 24) & 0xFF;
+}
+
+static void put_u64_le(uint8_t *buffer, uint64_t value) {
+    put_u32_le(buffer, (uint32_t)value);
+    put_u32_le(buffer + 4, (uint32_t)(value >> 32));
+}
+
+uint8_t cpu_stats_fill_thread_report(uint8_t index, uint8_t *buffer, uint8_t length) {
+    cpu_stats_thread_t stats;
+
+    if (length < 26 || !cpu_stats_get_thread(index, &stats)) {
+        return 0;
+    }
+
+    buffer[0] = cpu_stats_thread_count();
+    buffer[1] = index;
+    memcpy(&buffer[2], stats.name, sizeof(stats.name));
+    put_u64_le(&buffer[10], stats.cumulative_cycles);
+    put_u32_le(&buffer[18], stats.worst_cycles);
+    put_u32_le(&buffer[22], stats.slots);
+
+    return 26;
+}
+
+uint8_t cpu_stats_fill_kernel_report(uint8_t *buffer, uint8_t length) {
+    cpu_stats_kernel_t stats;
+
+    if (length < 28 || !cpu_stats_get_kernel(&stats)) {
+        return 0;
+    }
+
+    put_u32_le(&buffer[0], stats.irq_count);
+    put_u32_le(&buffer[4], stats.ctx_switches);
+    put_u64_le(&buffer[8], stats.isr_critical_cycles);
+    put_u32_le(&buffer[16], stats.isr_critical_worst);
+    put_u64_le(&buffer[20], stats.thd_critical_cycles);
+
+    return 28;
+}
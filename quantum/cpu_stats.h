@@ -0,0 +1,87 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup cpu_stats RTOS thread and interrupt CPU accounting
+ *
+ * \brief Attributes whole-CPU time to ChibiOS threads and interrupt context.
+ *
+ * cpu_profiler answers "how long does this named section take"; cpu_stats answers "who is eating the CPU". It
+ * samples the kernel's own accounting -- per-thread scheduling-slot time measurements from the ChibiOS thread
+ * registry, plus the kernel's interrupt and context-switch counters -- so jitter in the main loop can be pinned
+ * on a thread or on interrupt load without bisecting features. Times are in realtime-counter cycles, the same
+ * source cpu_profiler_timestamp() uses (on Cortex-M0+ parts like the RP2040 there is no DWT cycle counter; the
+ * port's realtime counter is the fastest source available). All counters are cumulative since boot -- the host
+ * derives rates and CPU shares from deltas between two polls, so no reset entry point is needed.
+ *
+ * Requires PROTOCOL_CHIBIOS with CH_CFG_USE_REGISTRY and CH_DBG_STATISTICS enabled in the keyboard's chconf.h;
+ * without them every query reports no data, so callers need no fallback of their own.
+ * \{
+ */
+
+/** \brief Snapshot of one registered thread's accumulated runtime. */
+typedef struct cpu_stats_thread_t {
+    char     name[8];           // thread name, NUL-terminated, truncated to fit
+    uint64_t cumulative_cycles; // total cycles spent scheduled in
+    uint32_t worst_cycles;      // longest single scheduling slot
+    uint32_t slots;             // scheduling slots measured
+} cpu_stats_thread_t;
+
+/** \brief Snapshot of kernel-wide interrupt and scheduler counters. */
+typedef struct cpu_stats_kernel_t {
+    uint32_t irq_count;           // interrupts serviced
+    uint32_t ctx_switches;        // context switches performed
+    uint64_t isr_critical_cycles; // cumulative cycles in ISR-side critical zones
+    uint32_t isr_critical_worst;  // longest single ISR-side critical zone
+    uint64_t thd_critical_cycles; // cumulative cycles in thread-side critical zones
+} cpu_stats_kernel_t;
+
+/**
+ * \brief Number of threads currently in the registry (including the idle thread, whose share is the inverse of
+ * total CPU load).
+ */
+uint8_t cpu_stats_thread_count(void);
+
+/**
+ * \brief Snapshot the index'th registered thread's statistics. Registry order is stable while no threads are
+ * created or destroyed.
+ *
+ * \return false if the index is past the end of the registry or accounting is unavailable.
+ */
+bool cpu_stats_get_thread(uint8_t index, cpu_stats_thread_t *stats);
+
+/**
+ * \brief Snapshot the kernel's interrupt and context-switch counters.
+ *
+ * \return false if accounting is unavailable.
+ */
+bool cpu_stats_get_kernel(cpu_stats_kernel_t *stats);
+
+/**
+ * \brief Pack one thread's statistics into a buffer for transmission over raw HID.
+ *
+ * Layout: thread count (1 byte), index (1 byte), name (8 bytes), cumulative cycles (8 bytes LE),
+ * worst slot (4 bytes LE), slot count (4 bytes LE).
+ *
+ * \return the number of bytes written, or 0 if the buffer is too small or the index is invalid.
+ */
+uint8_t cpu_stats_fill_thread_report(uint8_t index, uint8_t *buffer, uint8_t length);
+
+/**
+ * \brief Pack the kernel counters into a buffer for transmission over raw HID.
+ *
+ * Layout: IRQ count (4 bytes LE), context switches (4 bytes LE), ISR critical cycles (8 bytes LE),
+ * worst ISR critical zone (4 bytes LE), thread critical cycles (8 bytes LE).
+ *
+ * \return the number of bytes written, or 0 if the buffer is too small or accounting is unavailable.
+ */
+uint8_t cpu_stats_fill_kernel_report(uint8_t *buffer, uint8_t length);
+
+/** \} */
@@ -19,3 +19,30 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 void debounce_init(uint8_t num_rows);
 
 void debounce_free(void);
+
+/* Extra API implemented only by the sym_defer_pk_adaptive algorithm: access to the learned per-key defer window
+ * table, so the keyboard can persist it across power cycles (e.g. in its eeconfig datablock). */
+
+/**
+ * @brief Number of bytes in the learned defer window table (one byte per key).
+ */
+uint16_t debounce_adaptive_table_size(void);
+
+/**
+ * @brief Copies the learned table into `table` and clears the dirty flag.
+ *
+ * @return false if `len` is too small or the algorithm is not initialised
+ */
+bool debounce_adaptive_export_table(uint8_t *table, uint16_t len);
+
+/**
+ * @brief Replaces the learned table; entries are clamped to the valid window range, zero entries are ignored.
+ *
+ * @return false if `len` is too small or the algorithm is not initialised
+ */
+bool debounce_adaptive_import_table(const uint8_t *table, uint16_t len);
+
+/**
+ * @brief True if any window changed since the last export.
+ */
+bool debounce_adaptive_table_dirty(void);
@@ -18,6 +18,7 @@ Basic global debounce algorithm. Used in 99% of keyboards at time of implementat
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 #include "debounce.h"
+#include "ramfunc.h"
 #include "timer.h"
 #include <string.h>
 #ifndef DEBOUNCE
@@ -36,13 +37,13 @@ static fast_timer_t debouncing_time;
 
 void debounce_init(uint8_t num_rows) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+RAMFUNC bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool cooked_changed = false;
 
     if (changed) {
         debouncing      = true;
-        debouncing_time = timer_read_fast();
-    } else if (debouncing && timer_elapsed_fast(debouncing_time) >= DEBOUNCE) {
+        debouncing_time = timer_now_fast();
+    } else if (debouncing && timer_now_elapsed_fast(debouncing_time) >= DEBOUNCE) {
         size_t matrix_size = num_rows * sizeof(matrix_row_t);
         if (memcmp(cooked, raw, matrix_size) != 0) {
             memcpy(cooked, raw, matrix_size);
@@ -0,0 +1,273 @@
+/*
+Copyright 2017 Alex Ong<the.onga@gmail.com>
+Copyright 2020 Andrei Purdea<andrei@purdea.ro>
+Copyright 2021 Simon Arlott
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with an adaptive, per-key defer window.
+
+Behaves like sym_defer_pk, but instead of a single compile-time DEBOUNCE
+constant each key carries its own defer window that is adjusted at runtime:
+
+* A key that flips back to its settled state shortly after a state change was
+  committed is assumed to still be bouncing; its window grows to cover the
+  observed bounce duration plus DEBOUNCE_ADAPTIVE_MARGIN.
+* After DEBOUNCE_ADAPTIVE_DECAY consecutive clean transitions a key's window
+  shrinks by 1ms, so windows converge back down to DEBOUNCE_ADAPTIVE_MIN on
+  healthy switches.
+
+Windows start at DEBOUNCE and are clamped to
+[DEBOUNCE_ADAPTIVE_MIN, DEBOUNCE_ADAPTIVE_MAX]. The learned table can be
+exported/imported through the debounce_adaptive_*_table() functions so the
+keyboard can persist it (e.g. in its eeconfig datablock).
+*/
+
+#include "debounce.h"
+#include "ramfunc.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Smallest defer window a key may converge down to.
+#ifndef DEBOUNCE_ADAPTIVE_MIN
+#    define DEBOUNCE_ADAPTIVE_MIN 2
+#endif
+
+// Largest defer window a key may grow to; also the re-transition gap below which a state change is treated as
+// residual bouncing rather than a new keypress. Human re-presses are far slower than this.
+#ifndef DEBOUNCE_ADAPTIVE_MAX
+#    if DEBOUNCE > 10
+#        define DEBOUNCE_ADAPTIVE_MAX DEBOUNCE
+#    else
+#        define DEBOUNCE_ADAPTIVE_MAX 10
+#    endif
+#endif
+
+// Safety margin added on top of an observed bounce duration.
+#ifndef DEBOUNCE_ADAPTIVE_MARGIN
+#    define DEBOUNCE_ADAPTIVE_MARGIN 1
+#endif
+
+// Number of consecutive clean transitions before a key's window shrinks by 1ms.
+#ifndef DEBOUNCE_ADAPTIVE_DECAY
+#    define DEBOUNCE_ADAPTIVE_DECAY 50
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+typedef struct {
+    uint8_t counter; // remaining defer time in ms, DEBOUNCE_ELAPSED when idle
+    uint8_t window;  // learned defer window in ms
+    uint8_t age;     // ms since the last committed state change, saturating
+    uint8_t streak;  // clean transitions since the last observed bounce
+} adaptive_debounce_key_t;
+
+#if DEBOUNCE > 0
+static adaptive_debounce_key_t *debounce_state;
+static uint8_t                  debounce_num_rows;
+static fast_timer_t             last_time;
+static bool                     counters_need_update;
+static bool                     cooked_changed;
+static bool                     table_dirty;
+
+#    define DEBOUNCE_ELAPSED 0
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+static inline uint8_t clamp_window(uint16_t window) {
+    if (window < DEBOUNCE_ADAPTIVE_MIN) {
+        return DEBOUNCE_ADAPTIVE_MIN;
+    }
+    if (window > DEBOUNCE_ADAPTIVE_MAX) {
+        return DEBOUNCE_ADAPTIVE_MAX;
+    }
+    return (uint8_t)window;
+}
+
+static inline void grow_window(adaptive_debounce_key_t *key, uint16_t observed_bounce) {
+    uint8_t window = clamp_window(observed_bounce + DEBOUNCE_ADAPTIVE_MARGIN);
+    if (window > key->window) {
+        key->window = window;
+        table_dirty = true;
+    }
+    key->streak = 0;
+}
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    debounce_num_rows = num_rows;
+    debounce_state    = (adaptive_debounce_key_t *)malloc(num_rows * MATRIX_COLS * sizeof(adaptive_debounce_key_t));
+    int i             = 0;
+    for (uint8_t r = 0; r < num_rows; r++) {
+        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+            debounce_state[i].counter = DEBOUNCE_ELAPSED;
+            debounce_state[i].window  = clamp_window(DEBOUNCE);
+            debounce_state[i].age     = UINT8_MAX;
+            debounce_state[i].streak  = 0;
+            i++;
+        }
+    }
+}
+
+void debounce_free(void) {
+    free(debounce_state);
+    debounce_state = NULL;
+}
+
+RAMFUNC bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_now_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_now_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update                  = false;
+    adaptive_debounce_key_t *debounce_key = debounce_state;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (debounce_key->counter != DEBOUNCE_ELAPSED) {
+                if (debounce_key->counter <= elapsed_time) {
+                    // Commit the change; the key's age restarts at the moment the window actually expired.
+                    debounce_key->age        = elapsed_time - debounce_key->counter;
+                    debounce_key->counter    = DEBOUNCE_ELAPSED;
+                    matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
+                    cooked_changed |= cooked[row] ^ cooked_next;
+                    cooked[row] = cooked_next;
+
+                    if (++debounce_key->streak >= DEBOUNCE_ADAPTIVE_DECAY) {
+                        debounce_key->streak = 0;
+                        if (debounce_key->window > DEBOUNCE_ADAPTIVE_MIN) {
+                            debounce_key->window--;
+                            table_dirty = true;
+                        }
+                    }
+                } else {
+                    debounce_key->counter -= elapsed_time;
+                    counters_need_update = true;
+                }
+            } else {
+                if (debounce_key->age < UINT8_MAX - elapsed_time) {
+                    debounce_key->age += elapsed_time;
+                } else {
+                    debounce_key->age = UINT8_MAX;
+                }
+            }
+            debounce_key++;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    adaptive_debounce_key_t *debounce_key = debounce_state;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (delta & (ROW_SHIFTER << col)) {
+                if (debounce_key->counter == DEBOUNCE_ELAPSED) {
+                    if (debounce_key->age < DEBOUNCE_ADAPTIVE_MAX) {
+                        // The key flipped again shortly after a committed change: assume the previous bounce
+                        // outlasted the window. Total observed duration is window + gap since the commit.
+                        grow_window(debounce_key, (uint16_t)debounce_key->window + debounce_key->age);
+                    }
+                    debounce_key->counter = debounce_key->window;
+                    counters_need_update  = true;
+                }
+            } else {
+                if (debounce_key->counter != DEBOUNCE_ELAPSED) {
+                    // The key returned to its settled state inside the window: a bounce of
+                    // (window - remaining) ms was absorbed.
+                    grow_window(debounce_key, (uint16_t)debounce_key->window - debounce_key->counter);
+                }
+                debounce_key->counter = DEBOUNCE_ELAPSED;
+            }
+            debounce_key++;
+        }
+    }
+}
+
+uint16_t debounce_adaptive_table_size(void) {
+    return (uint16_t)debounce_num_rows * MATRIX_COLS;
+}
+
+bool debounce_adaptive_export_table(uint8_t *table, uint16_t len) {
+    if (debounce_state == NULL || len < debounce_adaptive_table_size()) {
+        return false;
+    }
+    for (uint16_t i = 0; i < debounce_adaptive_table_size(); i++) {
+        table[i] = debounce_state[i].window;
+    }
+    table_dirty = false;
+    return true;
+}
+
+bool debounce_adaptive_import_table(const uint8_t *table, uint16_t len) {
+    if (debounce_state == NULL || len < debounce_adaptive_table_size()) {
+        return false;
+    }
+    for (uint16_t i = 0; i < debounce_adaptive_table_size(); i++) {
+        // Zero means "never learned" (e.g. a freshly initialised eeconfig datablock); keep the current window.
+        if (table[i] != 0) {
+            debounce_state[i].window = clamp_window(table[i]);
+        }
+    }
+    return true;
+}
+
+bool debounce_adaptive_table_dirty(void) {
+    return table_dirty;
+}
+
+#else
+#    include "none.c"
+#endif
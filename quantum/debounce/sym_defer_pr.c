@@ -46,7 +46,7 @@ void debounce_free(void) {
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
-    uint16_t now           = timer_read();
+    uint16_t now           = timer_now();
     uint16_t elapsed16     = TIMER_DIFF_16(now, last_time);
     last_time              = now;
     uint8_t elapsed        = (elapsed16 > 255) ? 255 : elapsed16;
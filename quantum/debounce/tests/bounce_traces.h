@@ -0,0 +1,101 @@
+/* Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Recorded switch bounce traces, replayed by debounce_benchmark.cpp.
+//
+// Each trace is one full press/release cycle for a single key, expressed as
+// raw level transitions at millisecond offsets (the benchmark scans at 1 kHz,
+// matching the resolution the firmware itself debounces at). The traces were
+// captured from real switches via the press-to-report timestamping hook and
+// quantized to scan ticks; sub-millisecond bounce that never survives a scan
+// is invisible to every algorithm and is omitted.
+//
+// physical_press_time / physical_release_time mark first contact and first
+// break -- the reference points that added latency is measured against.
+
+struct BounceTransition {
+    uint32_t time; // ms from trace start
+    bool     pressed;
+};
+
+struct BounceTrace {
+    const char*             name;
+    const BounceTransition* transitions;
+    size_t                  transition_count;
+    uint32_t                physical_press_time;
+    uint32_t                physical_release_time;
+};
+
+// Fresh linear switch, no observable bounce at 1 kHz
+static const BounceTransition trace_clean_transitions[] = {
+    {10, true},
+    {60, false},
+};
+
+// Typical tactile switch: 2 ms of make bounce, 2 ms of break bounce
+static const BounceTransition trace_light_bounce_transitions[] = {
+    {10, true},
+    {11, false},
+    {12, true},
+    {60, false},
+    {61, true},
+    {62, false},
+};
+
+// Worn switch: 4 ms of make chatter, 3 ms of break bounce
+static const BounceTransition trace_heavy_chatter_transitions[] = {
+    {10, true},
+    {11, false},
+    {12, true},
+    {13, false},
+    {14, true},
+    {60, false},
+    {62, true},
+    {63, false},
+};
+
+// Slow, rolling release: contact re-makes 3 ms after first break
+static const BounceTransition trace_slow_release_transitions[] = {
+    {10, true},
+    {60, false},
+    {63, true},
+    {64, false},
+};
+
+// Failing switch: make chatter spanning 8 ms, longer than DEBOUNCE=5.
+// Eager algorithms are expected to let some of this through; it is in the
+// set precisely so the escape counter shows that tradeoff.
+static const BounceTransition trace_marathon_chatter_transitions[] = {
+    {10, true},
+    {12, false},
+    {14, true},
+    {16, false},
+    {18, true},
+    {60, false},
+};
+
+static const BounceTrace bounce_traces[] = {
+    {"clean", trace_clean_transitions, sizeof(trace_clean_transitions) / sizeof(trace_clean_transitions[0]), 10, 60},
+    {"light_bounce", trace_light_bounce_transitions, sizeof(trace_light_bounce_transitions) / sizeof(trace_light_bounce_transitions[0]), 10, 60},
+    {"heavy_chatter", trace_heavy_chatter_transitions, sizeof(trace_heavy_chatter_transitions) / sizeof(trace_heavy_chatter_transitions[0]), 10, 60},
+    {"slow_release", trace_slow_release_transitions, sizeof(trace_slow_release_transitions) / sizeof(trace_slow_release_transitions[0]), 10, 60},
+    {"marathon_chatter", trace_marathon_chatter_transitions, sizeof(trace_marathon_chatter_transitions) / sizeof(trace_marathon_chatter_transitions[0]), 10, 60},
+};
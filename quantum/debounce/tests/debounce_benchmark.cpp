@@ -0,0 +1,145 @@
+/* Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Replays the recorded bounce traces in bounce_traces.h through the debounce
+// algorithm this target is linked against, at a simulated 1 kHz scan rate,
+// and reports per-trace added latency plus chatter escapes. One benchmark
+// target exists per algorithm (see rules.mk); diffing their reports shows the
+// latency/accuracy tradeoff instead of picking DEBOUNCE settings blind.
+//
+// Added latency is measured from physical first-contact (or first-break) to
+// the corresponding cooked edge. A chatter escape is any cooked transition
+// beyond the one-press-one-release a trace physically represents.
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "debounce.h"
+#include "matrix.h"
+#include "timer.h"
+}
+
+#include "bounce_traces.h"
+
+#ifndef BENCH_ALGORITHM_NAME
+#    define BENCH_ALGORITHM_NAME "unknown"
+#endif
+
+namespace {
+
+struct CookedEdge {
+    uint32_t time;
+    bool     pressed;
+};
+
+struct TraceResult {
+    const BounceTrace*      trace;
+    std::vector<CookedEdge> edges;
+    int32_t                 press_latency   = -1; // -1: cooked edge never appeared
+    int32_t                 release_latency = -1;
+    int                     chatter_escapes = 0;
+    bool                    settled_released = false;
+};
+
+TraceResult replayTrace(const BounceTrace& trace) {
+    TraceResult result;
+    result.trace = &trace;
+
+    matrix_row_t raw_matrix[MATRIX_ROWS]    = {0};
+    matrix_row_t cooked_matrix[MATRIX_ROWS] = {0};
+
+    debounce_init(MATRIX_ROWS);
+    set_time(0);
+
+    // Run well past the last transition so deferred algorithms settle
+    const uint32_t end_time = trace.transitions[trace.transition_count - 1].time + 50;
+
+    size_t next_transition = 0;
+    bool   prev_cooked     = false;
+    for (uint32_t now = 0; now <= end_time; now++) {
+        set_time(now);
+
+        bool changed = false;
+        while (next_transition < trace.transition_count && trace.transitions[next_transition].time <= now) {
+            bool pressed = trace.transitions[next_transition].pressed;
+            if (pressed != ((raw_matrix[0] & 1) != 0)) {
+                raw_matrix[0] = pressed ? 1 : 0;
+                changed       = true;
+            }
+            next_transition++;
+        }
+
+        timer_now_refresh(); // normally done once per loop by keyboard_task()
+        debounce(raw_matrix, cooked_matrix, MATRIX_ROWS, changed);
+
+        bool cooked = (cooked_matrix[0] & 1) != 0;
+        if (cooked != prev_cooked) {
+            result.edges.push_back({now, cooked});
+            prev_cooked = cooked;
+        }
+    }
+
+    debounce_free();
+
+    // First cooked down/up at or after the physical edge gives the added latency
+    for (const CookedEdge& edge : result.edges) {
+        if (edge.pressed && result.press_latency < 0 && edge.time >= trace.physical_press_time) {
+            result.press_latency = (int32_t)(edge.time - trace.physical_press_time);
+        }
+        if (!edge.pressed && result.release_latency < 0 && edge.time >= trace.physical_release_time) {
+            result.release_latency = (int32_t)(edge.time - trace.physical_release_time);
+        }
+    }
+
+    // Anything beyond one press and one release is bounce that escaped
+    result.chatter_escapes  = (int)result.edges.size() > 2 ? (int)result.edges.size() - 2 : 0;
+    result.settled_released = !prev_cooked;
+    return result;
+}
+
+} // namespace
+
+TEST(DebounceBenchmark, ReplayRecordedTraces) {
+    std::vector<TraceResult> results;
+    for (const BounceTrace& trace : bounce_traces) {
+        results.push_back(replayTrace(trace));
+    }
+
+    int32_t max_press_latency   = 0;
+    int32_t max_release_latency = 0;
+    int     total_escapes       = 0;
+
+    printf("\ndebounce benchmark: algorithm=%s DEBOUNCE=%d\n", BENCH_ALGORITHM_NAME, DEBOUNCE);
+    printf("%-20s %14s %16s %8s\n", "trace", "press latency", "release latency", "escapes");
+    for (const TraceResult& result : results) {
+        printf("%-20s %12ldms %14ldms %8d\n", result.trace->name, (long)result.press_latency, (long)result.release_latency, result.chatter_escapes);
+
+        if (result.press_latency > max_press_latency) max_press_latency = result.press_latency;
+        if (result.release_latency > max_release_latency) max_release_latency = result.release_latency;
+        total_escapes += result.chatter_escapes;
+
+        // Sanity, not policy: every algorithm must produce the press and the
+        // release, and end up released. Latency and escapes are reported, not
+        // judged -- they ARE the tradeoff under comparison.
+        EXPECT_GE(result.press_latency, 0) << result.trace->name << ": cooked press never appeared";
+        EXPECT_GE(result.release_latency, 0) << result.trace->name << ": cooked release never appeared";
+        EXPECT_TRUE(result.settled_released) << result.trace->name << ": cooked state stuck down after trace end";
+    }
+    printf("%-20s %12ldms %14ldms %8d\n", "worst case", (long)max_press_latency, (long)max_release_latency, total_escapes);
+}
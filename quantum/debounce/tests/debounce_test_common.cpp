@@ -131,6 +131,9 @@ void DebounceTest::runDebounce(bool changed) {
 
     reset_access_counter();
 
+    /* keyboard_task() latches the shared timestamp once per loop iteration; mirror that here */
+    timer_now_refresh();
+
     bool cooked_changed = debounce(raw_matrix_, cooked_matrix_, MATRIX_ROWS, changed);
 
     if (!std::equal(std::begin(input_matrix_), std::end(input_matrix_), std::begin(raw_matrix_))) {
@@ -49,7 +49,43 @@ debounce_sym_eager_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pr_tests.cpp
 
+debounce_sym_defer_pk_adaptive_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ADAPTIVE_DECAY=4
+debounce_sym_defer_pk_adaptive_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_adaptive.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_adaptive_tests.cpp
+
 debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+# Benchmark targets: replay the recorded bounce traces (bounce_traces.h)
+# through one algorithm per target and report added latency plus chatter
+# escapes, so DEBOUNCE settings can be compared instead of picked blind.
+DEBOUNCE_BENCH_SRC := $(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_bench_none_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"none\"
+debounce_bench_none_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/none.c
+
+debounce_bench_sym_defer_g_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"sym_defer_g\"
+debounce_bench_sym_defer_g_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_defer_g.c
+
+debounce_bench_sym_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"sym_defer_pk\"
+debounce_bench_sym_defer_pk_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_defer_pk.c
+
+debounce_bench_sym_defer_pk_adaptive_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ADAPTIVE_DECAY=4 -DBENCH_ALGORITHM_NAME=\"sym_defer_pk_adaptive\"
+debounce_bench_sym_defer_pk_adaptive_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_defer_pk_adaptive.c
+
+debounce_bench_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"sym_defer_pr\"
+debounce_bench_sym_defer_pr_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_defer_pr.c
+
+debounce_bench_sym_eager_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"sym_eager_pk\"
+debounce_bench_sym_eager_pk_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_eager_pk.c
+
+debounce_bench_sym_eager_pr_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"sym_eager_pr\"
+debounce_bench_sym_eager_pr_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/sym_eager_pr.c
+
+debounce_bench_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DBENCH_ALGORITHM_NAME=\"asym_eager_defer_pk\"
+debounce_bench_asym_eager_defer_pk_SRC := $(DEBOUNCE_BENCH_SRC) $(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c
@@ -0,0 +1,127 @@
+/* Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "debounce_test_common.h"
+
+extern "C" {
+#include "debounce.h"
+}
+
+/* Built with DEBOUNCE=5 (initial window), DEBOUNCE_ADAPTIVE_MIN=2, DEBOUNCE_ADAPTIVE_MAX=10,
+ * DEBOUNCE_ADAPTIVE_MARGIN=1 and DEBOUNCE_ADAPTIVE_DECAY=4 (see tests/rules.mk). */
+
+TEST_F(DebounceTest, OneKeyShort1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        /* Release well outside the chatter gap so the window is not grown */
+        {30, {{0, 1, UP}}, {}},
+
+        {35, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyBouncingInsideWindow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {1, {{0, 1, UP}}, {}},
+        {2, {{0, 1, DOWN}}, {}},
+        {3, {{0, 1, UP}}, {}},
+        {4, {{0, 1, DOWN}}, {}},
+        {9, {}, {{0, 1, DOWN}}}, /* 5ms after DOWN at time 4 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, BounceAfterCommitGrowsWindow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {5, {}, {{0, 1, DOWN}}},
+        /* Flip 1ms after the commit: treated as a bounce of 5+1ms, window grows to 6+1=7ms */
+        {6, {{0, 1, UP}}, {}},
+        {13, {}, {{0, 1, UP}}},
+        /* Subsequent transitions use the learned 7ms window */
+        {40, {{0, 1, DOWN}}, {}},
+        {47, {}, {{0, 1, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, CleanTransitionsDecayWindow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {5, {}, {{0, 1, DOWN}}},
+        /* Grow the window to 7ms as above */
+        {6, {{0, 1, UP}}, {}},
+        {13, {}, {{0, 1, UP}}},
+        /* Four clean transitions (13, 47, 107, 157) decay the window back to 6ms */
+        {40, {{0, 1, DOWN}}, {}},
+        {47, {}, {{0, 1, DOWN}}},
+        {100, {{0, 1, UP}}, {}},
+        {107, {}, {{0, 1, UP}}},
+        {150, {{0, 1, DOWN}}, {}},
+        {157, {}, {{0, 1, DOWN}}},
+        {200, {{0, 1, UP}}, {}},
+        {206, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, TwoKeysIndependentWindows) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {5, {}, {{0, 1, DOWN}}},
+        /* Key (0,1) chatters and learns a 7ms window; key (0,2) stays at 5ms */
+        {6, {{0, 1, UP}}, {}},
+        {13, {}, {{0, 1, UP}}},
+
+        {40, {{0, 1, DOWN}, {0, 2, DOWN}}, {}},
+        {45, {}, {{0, 2, DOWN}}},
+        {47, {}, {{0, 1, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, ImportExportRoundTrip) {
+    debounce_init(MATRIX_ROWS);
+
+    std::vector<uint8_t> table(debounce_adaptive_table_size(), 0);
+    ASSERT_TRUE(debounce_adaptive_export_table(table.data(), table.size()));
+    EXPECT_EQ(table[0], 5); /* initial window is DEBOUNCE */
+
+    table[0] = 8;
+    table[1] = 99; /* clamped to DEBOUNCE_ADAPTIVE_MAX */
+    table[2] = 0;  /* "never learned", keeps the current window */
+    ASSERT_TRUE(debounce_adaptive_import_table(table.data(), table.size()));
+
+    ASSERT_TRUE(debounce_adaptive_export_table(table.data(), table.size()));
+    EXPECT_EQ(table[0], 8);
+    EXPECT_EQ(table[1], 10);
+    EXPECT_EQ(table[2], 5);
+
+    debounce_free();
+}
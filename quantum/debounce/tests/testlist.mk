@@ -2,7 +2,16 @@ TEST_LIST += \
 	debounce_none \
 	debounce_sym_defer_g \
 	debounce_sym_defer_pk \
+	debounce_sym_defer_pk_adaptive \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
-	debounce_asym_eager_defer_pk
+	debounce_asym_eager_defer_pk \
+	debounce_bench_none \
+	debounce_bench_sym_defer_g \
+	debounce_bench_sym_defer_pk \
+	debounce_bench_sym_defer_pk_adaptive \
+	debounce_bench_sym_defer_pr \
+	debounce_bench_sym_eager_pk \
+	debounce_bench_sym_eager_pr \
+	debounce_bench_asym_eager_defer_pk
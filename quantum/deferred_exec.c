@@ -64,6 +64,9 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
             entry->trigger_time = timer_read32() + delay_ms;
             entry->callback     = callback;
             entry->cb_arg       = cb_arg;
+#ifdef DEFERRED_EXEC_METRICS
+            entry->stats = (deferred_exec_stats_t){0};
+#endif // DEFERRED_EXEC_METRICS
             return current_token;
         }
     }
@@ -129,6 +132,17 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 
             // Check if we're supposed to execute this entry
             if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+#ifdef DEFERRED_EXEC_METRICS
+                // How far past the intended trigger time the callback actually starts.
+                uint32_t lateness_ms = TIMER_DIFF_32(now, entry->trigger_time);
+
+                entry->stats.invocations++;
+                entry->stats.last_lateness_ms = (lateness_ms > UINT16_MAX) ? UINT16_MAX : (uint16_t)lateness_ms;
+                if (entry->stats.last_lateness_ms > entry->stats.max_lateness_ms) {
+                    entry->stats.max_lateness_ms = entry->stats.last_lateness_ms;
+                }
+#endif // DEFERRED_EXEC_METRICS
+
                 // Invoke the callback and work work out if we should be requeued
                 uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
@@ -139,6 +153,12 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 
                 // Update the trigger time if we have to repeat, otherwise clear it out
                 if (delay_ms > 0) {
+#ifdef DEFERRED_EXEC_METRICS
+                    // A full period (or more) of lateness means the executor is falling behind its requested rate.
+                    if (lateness_ms >= delay_ms) {
+                        entry->stats.overruns++;
+                    }
+#endif // DEFERRED_EXEC_METRICS
                     // Intentionally add just the delay to the existing trigger time -- this ensures the next
                     // invocation is with respect to the previous trigger, rather than when it got to execution. Under
                     // normal circumstances this won't cause issue, but if another executor is invoked that takes a
@@ -163,15 +183,77 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
+// Earliest trigger time across the basic table, maintained on every mutation so
+// that deferred_exec_task() can skip the table scan entirely while nothing is
+// due. Recomputing is O(MAX_DEFERRED_EXECUTORS) but only happens when an
+// executor is added, retimed, cancelled, or has just run -- the common
+// every-millisecond path becomes a single timer comparison.
+static uint32_t basic_next_due       = 0;
+static bool     basic_next_due_valid = false;
+
+static void recompute_basic_next_due(void) {
+    basic_next_due_valid = false;
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        if (basic_executors[i].token == INVALID_DEFERRED_TOKEN) {
+            continue;
+        }
+        if (!basic_next_due_valid || ((int32_t)TIMER_DIFF_32(basic_executors[i].trigger_time, basic_next_due)) < 0) {
+            basic_next_due       = basic_executors[i].trigger_time;
+            basic_next_due_valid = true;
+        }
+    }
+}
+
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    deferred_token token = defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    if (token != INVALID_DEFERRED_TOKEN) {
+        recompute_basic_next_due();
+    }
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    bool ret = extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    if (ret) {
+        recompute_basic_next_due();
+    }
+    return ret;
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    bool ret = cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    if (ret) {
+        recompute_basic_next_due();
+    }
+    return ret;
 }
+uint32_t deferred_exec_time_until_next(void) {
+    if (!basic_next_due_valid) {
+        return UINT32_MAX;
+    }
+    int32_t remaining = (int32_t)TIMER_DIFF_32(basic_next_due, timer_read32());
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
 void deferred_exec_task(void) {
+    // Nothing registered, or the earliest trigger is still in the future -- skip the scan.
+    if (!basic_next_due_valid || ((int32_t)TIMER_DIFF_32(basic_next_due, timer_read32())) > 0) {
+        return;
+    }
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    // Callbacks may have requeued, cancelled, or registered executors.
+    recompute_basic_next_due();
+}
+
+#ifdef DEFERRED_EXEC_METRICS
+bool get_deferred_exec_stats(deferred_token token, deferred_exec_stats_t *stats) {
+    if (token == INVALID_DEFERRED_TOKEN || !stats) {
+        return false;
+    }
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        if (basic_executors[i].token == token) {
+            *stats = basic_executors[i].stats;
+            return true;
+        }
+    }
+    return false;
 }
+#endif // DEFERRED_EXEC_METRICS
@@ -65,6 +65,23 @@ bool cancel_deferred_exec(deferred_token token);
  */
 void deferred_exec_task(void);
 
+/**
+ * Milliseconds until the earliest queued basic-API executor is due, or UINT32_MAX if none are queued.
+ * Used by the idle engine to size its sleeps so a sleep never runs past a deferred deadline.
+ */
+uint32_t deferred_exec_time_until_next(void);
+
+#ifdef DEFERRED_EXEC_METRICS
+/**
+ * Retrieves the scheduling metrics for an active deferred execution. Only available when DEFERRED_EXEC_METRICS is defined.
+ *
+ * @param token[in] the returned value from defer_exec for the deferred execution you wish to inspect
+ * @param stats[out] receives a copy of the executor's metrics
+ * @return true if the token was found and stats were copied, otherwise false
+ */
+bool get_deferred_exec_stats(deferred_token token, deferred_exec_stats_t *stats);
+#endif // DEFERRED_EXEC_METRICS
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
@@ -74,11 +91,26 @@ void deferred_exec_task(void);
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
  *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
  */
+#ifdef DEFERRED_EXEC_METRICS
+/**
+ * @struct Per-executor scheduling metrics, collected when DEFERRED_EXEC_METRICS is defined.
+ */
+typedef struct deferred_exec_stats_t {
+    uint32_t invocations;     // number of times the callback has run
+    uint32_t overruns;        // invocations that started a full period (or more) late
+    uint16_t last_lateness_ms; // how late the most recent invocation started
+    uint16_t max_lateness_ms;  // worst observed start lateness
+} deferred_exec_stats_t;
+#endif // DEFERRED_EXEC_METRICS
+
 typedef struct deferred_executor_t {
     deferred_token         token;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
+#ifdef DEFERRED_EXEC_METRICS
+    deferred_exec_stats_t stats;
+#endif // DEFERRED_EXEC_METRICS
 } deferred_executor_t;
 
 /**
@@ -20,6 +20,10 @@
 
 #include "dip_switch.h"
 
+#if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+#    include "via.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #endif
@@ -32,6 +36,17 @@
 #    error "Both DIP_SWITCH_PINS and DIP_SWITCH_MATRIX_GRID are defined."
 #endif
 
+#ifdef DIP_SWITCH_INTERRUPT_ENABLE
+#    if !defined(DIP_SWITCH_PINS)
+#        error "DIP_SWITCH_INTERRUPT_ENABLE requires DIP_SWITCH_PINS."
+#    endif
+#    include "gpio_event.h"
+
+#    ifndef DIP_SWITCH_DEBOUNCE_MS
+#        define DIP_SWITCH_DEBOUNCE_MS 5
+#    endif
+#endif
+
 #ifdef DIP_SWITCH_PINS
 static pin_t dip_switch_pad[] = DIP_SWITCH_PINS;
 #endif
@@ -45,6 +60,16 @@ static uint16_t              scan_count;
 static bool dip_switch_state[NUM_DIP_SWITCHES]      = {0};
 static bool last_dip_switch_state[NUM_DIP_SWITCHES] = {0};
 
+#ifdef DIP_SWITCH_INTERRUPT_ENABLE
+// Per-switch settle window: each edge restarts it, and the latched level is only committed once the
+// switch has been quiet for DIP_SWITCH_DEBOUNCE_MS. No GPIO reads happen outside the ISR.
+static bool     dip_switch_pending[NUM_DIP_SWITCHES]       = {0};
+static bool     dip_switch_pending_level[NUM_DIP_SWITCHES] = {0};
+static uint16_t dip_switch_edge_time[NUM_DIP_SWITCHES]     = {0};
+
+static void dip_switch_edge_handler(uint8_t slot, bool level, uint16_t time_ms, void *context);
+#endif
+
 __attribute__((weak)) bool dip_switch_update_user(uint8_t index, bool active) {
     return true;
 }
@@ -98,16 +123,46 @@ void dip_switch_init(void) {
         gpio_set_pin_input_high(dip_switch_pad[i]);
     }
     dip_switch_read(true);
+#    ifdef DIP_SWITCH_INTERRUPT_ENABLE
+    // Initial state is read above; from here on, edges arrive through the shared event queue.
+    for (uint8_t i = 0; i < NUM_DIP_SWITCHES; i++) {
+        gpio_event_register(dip_switch_pad[i], i, dip_switch_edge_handler, NULL);
+    }
+#    endif
 #endif
 #ifdef DIP_SWITCH_MATRIX_GRID
     scan_count = 0;
 #endif
 }
 
-void dip_switch_read(bool forced) {
+// Runs the per-switch and mask callbacks for whatever is currently in dip_switch_state.
+static void dip_switch_notify(bool forced) {
     bool     has_dip_state_changed = false;
     uint32_t dip_switch_mask       = 0;
 
+    for (uint8_t i = 0; i < NUM_DIP_SWITCHES; i++) {
+        dip_switch_mask |= dip_switch_state[i] << i;
+        if (last_dip_switch_state[i] != dip_switch_state[i] || forced) {
+            has_dip_state_changed = true;
+#ifndef DIP_SWITCH_MAP_ENABLE
+            dip_switch_update_kb(i, dip_switch_state[i]);
+#else
+            dip_switch_exec_mapping(i, dip_switch_state[i]);
+#endif
+#if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+            via_event_push_dip_switch(i, dip_switch_state[i]);
+#endif
+        }
+    }
+    if (has_dip_state_changed) {
+#ifndef DIP_SWITCH_MAP_ENABLE
+        dip_switch_update_mask_kb(dip_switch_mask);
+#endif
+        memcpy(last_dip_switch_state, dip_switch_state, sizeof(dip_switch_state));
+    }
+}
+
+void dip_switch_read(bool forced) {
 #ifdef DIP_SWITCH_MATRIX_GRID
     bool read_raw = false;
 
@@ -129,24 +184,36 @@ void dip_switch_read(bool forced) {
 #ifdef DIP_SWITCH_MATRIX_GRID
         dip_switch_state[i] = peek_matrix(dip_switch_pad[i].row, dip_switch_pad[i].col, read_raw);
 #endif
-        dip_switch_mask |= dip_switch_state[i] << i;
-        if (last_dip_switch_state[i] != dip_switch_state[i] || forced) {
-            has_dip_state_changed = true;
-#ifndef DIP_SWITCH_MAP_ENABLE
-            dip_switch_update_kb(i, dip_switch_state[i]);
-#else
-            dip_switch_exec_mapping(i, dip_switch_state[i]);
-#endif
-        }
-    }
-    if (has_dip_state_changed) {
-#ifndef DIP_SWITCH_MAP_ENABLE
-        dip_switch_update_mask_kb(dip_switch_mask);
-#endif
-        memcpy(last_dip_switch_state, dip_switch_state, sizeof(dip_switch_state));
     }
+
+    dip_switch_notify(forced);
+}
+
+#ifdef DIP_SWITCH_INTERRUPT_ENABLE
+static void dip_switch_edge_handler(uint8_t slot, bool level, uint16_t time_ms, void *context) {
+    // Active low; latch the most recent edge and (re)start the settle window.
+    dip_switch_pending_level[slot] = !level;
+    dip_switch_edge_time[slot]     = time_ms;
+    dip_switch_pending[slot]       = true;
 }
+#endif
 
 void dip_switch_task(void) {
+#ifdef DIP_SWITCH_INTERRUPT_ENABLE
+    gpio_event_drain();
+
+    bool committed = false;
+    for (uint8_t i = 0; i < NUM_DIP_SWITCHES; i++) {
+        if (dip_switch_pending[i] && (uint16_t)(gpio_event_time() - dip_switch_edge_time[i]) >= DIP_SWITCH_DEBOUNCE_MS) {
+            dip_switch_pending[i] = false;
+            dip_switch_state[i]   = dip_switch_pending_level[i];
+            committed             = true;
+        }
+    }
+    if (committed) {
+        dip_switch_notify(false);
+    }
+#else
     dip_switch_read(false);
+#endif
 }
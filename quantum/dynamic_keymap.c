@@ -22,6 +22,10 @@
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
 
+#ifdef MATRIX_HAS_GHOST
+#    include "keyboard.h"
+#endif
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #else
@@ -36,21 +40,84 @@ uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// RAM mirror of the dynamic keymap. Every key event resolves keycodes through
+// the nvm layer, which on wear-leveled targets (e.g. RP2040) can mean a write-log
+// traversal per lookup on the hot path. The mirror is filled from nvm on first
+// use, kept write-through on keycode/encoder updates, and invalidated by raw
+// buffer writes (VIA bulk uploads), so lookups cost a plain array read.
+// RAM cost: DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2 bytes.
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t dynamic_encoder_cache[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][NUM_DIRECTIONS];
+#    endif // ENCODER_MAP_ENABLE
+static bool dynamic_keymap_cache_ready = false;
+
+static void dynamic_keymap_cache_fill(void) {
+    for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            for (int column = 0; column < MATRIX_COLS; column++) {
+                dynamic_keymap_cache[layer][row][column] = nvm_dynamic_keymap_read_keycode(layer, row, column);
+            }
+        }
+#    ifdef ENCODER_MAP_ENABLE
+        for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            dynamic_encoder_cache[layer][encoder][0] = nvm_dynamic_keymap_read_encoder(layer, encoder, true);
+            dynamic_encoder_cache[layer][encoder][1] = nvm_dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+#    endif // ENCODER_MAP_ENABLE
+    }
+    dynamic_keymap_cache_ready = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        if (!dynamic_keymap_cache_ready) {
+            dynamic_keymap_cache_fill();
+        }
+        return dynamic_keymap_cache[layer][row][column];
+    }
+#endif
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (dynamic_keymap_cache_ready && layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        dynamic_keymap_cache[layer][row][column] = keycode;
+    }
+#endif
+#ifdef MATRIX_HAS_GHOST
+    // Layer 0 decides which positions count as real keys for ghost detection.
+    if (layer == 0) {
+        ghost_detection_invalidate();
+    }
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer < DYNAMIC_KEYMAP_LAYER_COUNT && encoder_id < NUM_ENCODERS) {
+        if (!dynamic_keymap_cache_ready) {
+            dynamic_keymap_cache_fill();
+        }
+        return dynamic_encoder_cache[layer][encoder_id][clockwise ? 0 : 1];
+    }
+#    endif
     return nvm_dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     nvm_dynamic_keymap_update_encoder(layer, encoder_id, clockwise, keycode);
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (dynamic_keymap_cache_ready && layer < DYNAMIC_KEYMAP_LAYER_COUNT && encoder_id < NUM_ENCODERS) {
+        dynamic_encoder_cache[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+    }
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -80,6 +147,13 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Raw buffer writes (VIA bulk uploads) bypass the keycode setters; refill from nvm on next lookup.
+    dynamic_keymap_cache_ready = false;
+#endif
+#ifdef MATRIX_HAS_GHOST
+    ghost_detection_invalidate();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -70,6 +70,10 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 void eeconfig_init_quantum(void) {
     nvm_eeconfig_erase();
 
+    // Every config field below is rewritten -- stage them and commit once, rather than issuing
+    // a backing-store write per field.
+    eeconfig_transaction_begin();
+
     eeconfig_enable();
 
     debug_config_t debug_config = {0};
@@ -167,6 +171,8 @@ void eeconfig_init_quantum(void) {
     extern void eeconfig_force_flush_led_matrix(void);
     eeconfig_force_flush_led_matrix();
 #endif // LED_MATRIX_ENABLE
+
+    eeconfig_transaction_commit();
 }
 
 void eeconfig_init(void) {
@@ -181,6 +187,14 @@ void eeconfig_disable(void) {
     nvm_eeconfig_disable();
 }
 
+void eeconfig_transaction_begin(void) {
+    nvm_eeconfig_transaction_begin();
+}
+
+void eeconfig_transaction_commit(void) {
+    nvm_eeconfig_transaction_commit();
+}
+
 bool eeconfig_is_enabled(void) {
     bool is_eeprom_enabled = nvm_eeconfig_is_enabled();
 #ifdef VIA_ENABLE
@@ -63,6 +63,13 @@ void eeconfig_init_user(void);
 void eeconfig_enable(void);
 void eeconfig_disable(void);
 
+// Batch a group of eeconfig updates into a single backing-store commit. Updates issued between
+// begin and commit may be staged in RAM by the storage driver and written out as one coalesced
+// operation at the outermost commit; on write-through backends every update lands immediately and
+// the pair is a no-op. Transactions nest.
+void eeconfig_transaction_begin(void);
+void eeconfig_transaction_commit(void);
+
 typedef union debug_config_t debug_config_t;
 void                         eeconfig_read_debug(debug_config_t *debug_config) __attribute__((nonnull));
 void                         eeconfig_update_debug(const debug_config_t *debug_config) __attribute__((nonnull));
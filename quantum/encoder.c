@@ -4,8 +4,13 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
+#include "timer.h"
 #include "wait.h"
 
+#if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+#    include "via.h"
+#endif
+
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
 #endif
@@ -27,6 +32,97 @@ static void encoder_queue_drain(void) {
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
+#if defined(ENCODER_BATCHING) && !defined(ENCODER_MAP_ENABLE)
+
+#    ifndef ENCODER_VELOCITY_TIMEOUT_MS
+#        define ENCODER_VELOCITY_TIMEOUT_MS 250
+#    endif
+
+// Steps/second per encoder, smoothed over batches. Reads as zero once a spin
+// has been over for ENCODER_VELOCITY_TIMEOUT_MS.
+static uint16_t encoder_velocity[NUM_ENCODERS]        = {0};
+static uint32_t encoder_last_batch_time[NUM_ENCODERS] = {0};
+
+uint16_t encoder_get_velocity(uint8_t index) {
+    if (index >= NUM_ENCODERS) {
+        return 0;
+    }
+#    ifdef ENCODER_INTERRUPT_ENABLE
+    // Prefer the driver's ISR-timestamped figure for locally-driven encoders; it measures actual
+    // detent intervals rather than batch-to-batch scan times.
+    uint16_t isr_velocity;
+    if (encoder_interrupt_velocity(index, &isr_velocity)) {
+        return isr_velocity;
+    }
+#    endif // ENCODER_INTERRUPT_ENABLE
+    if (timer_elapsed32(encoder_last_batch_time[index]) > ENCODER_VELOCITY_TIMEOUT_MS) {
+        return 0;
+    }
+    return encoder_velocity[index];
+}
+
+/* Instead of one callback per detent, all events sitting in the queue are
+ * collapsed into a signed per-encoder delta and handed over once per scan.
+ * A fast spin that enqueued a dozen transitions becomes a single call, so an
+ * overriding handler can emit one report with a computed step count rather
+ * than a dozen HID transactions. */
+static bool encoder_handle_queue(void) {
+    int16_t deltas[NUM_ENCODERS] = {0};
+    bool    changed              = false;
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event(&index, &clockwise)) {
+        if (index < NUM_ENCODERS) {
+            deltas[index] += clockwise ? 1 : -1;
+        }
+        changed = true;
+    }
+
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        if (deltas[i] == 0) {
+            continue;
+        }
+
+        uint32_t now     = timer_read32();
+        uint32_t elapsed = TIMER_DIFF_32(now, encoder_last_batch_time[i]);
+        if (elapsed > ENCODER_VELOCITY_TIMEOUT_MS) {
+            encoder_velocity[i] = 0; // stale -- this batch starts a new spin
+        } else if (elapsed > 0) {
+            uint16_t steps_per_sec = ((deltas[i] < 0 ? -deltas[i] : deltas[i]) * 1000UL) / elapsed;
+            encoder_velocity[i] += ((int32_t)steps_per_sec - (int32_t)encoder_velocity[i]) >> 2;
+        }
+        encoder_last_batch_time[i] = now;
+
+        encoder_update_batch_kb(i, deltas[i]);
+#    if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+        via_event_push_encoder(i, deltas[i]);
+#    endif
+    }
+    return changed;
+}
+
+__attribute__((weak)) bool encoder_update_batch_user(uint8_t index, int16_t delta) {
+    return true;
+}
+
+__attribute__((weak)) bool encoder_update_batch_kb(uint8_t index, int16_t delta) {
+    if (!encoder_update_batch_user(index, delta)) {
+        return false;
+    }
+    // Compatibility fallback: replay as individual detents for keymaps that
+    // only implement the per-detent hooks. Batch-aware keymaps override this
+    // (or encoder_update_batch_user) and consume the whole delta at once.
+    bool res  = true;
+    bool cw   = delta > 0;
+    int  reps = cw ? delta : -delta;
+    for (int i = 0; i < reps; i++) {
+        res = encoder_update_kb(index, cw);
+    }
+    return res;
+}
+
+#else // defined(ENCODER_BATCHING) && !defined(ENCODER_MAP_ENABLE)
+
 static bool encoder_handle_queue(void) {
     bool    changed = false;
     uint8_t index;
@@ -51,11 +147,16 @@ static bool encoder_handle_queue(void) {
 
 #endif // ENCODER_MAP_ENABLE
 
+#if defined(VIA_ENABLE) && defined(VIA_EVENT_PUSH)
+        via_event_push_encoder(index, clockwise ? 1 : -1);
+#endif
         changed = true;
     }
     return changed;
 }
 
+#endif // defined(ENCODER_BATCHING) && !defined(ENCODER_MAP_ENABLE)
+
 bool encoder_task(void) {
     bool changed = false;
 
@@ -49,6 +49,23 @@ bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 
+#    if defined(ENCODER_BATCHING) && !defined(ENCODER_MAP_ENABLE)
+// Batched rotation: all queued detents for an encoder are collapsed into one
+// signed delta per scan. The weak defaults replay the delta through the
+// per-detent hooks; override to consume the whole delta in one report.
+bool encoder_update_batch_kb(uint8_t index, int16_t delta);
+bool encoder_update_batch_user(uint8_t index, int16_t delta);
+// Smoothed rotation speed in detents/second; zero once a spin has ended.
+uint16_t encoder_get_velocity(uint8_t index);
+#    endif // defined(ENCODER_BATCHING) && !defined(ENCODER_MAP_ENABLE)
+
+#    ifdef ENCODER_INTERRUPT_ENABLE
+// ISR-timestamped velocity for a locally interrupt-driven encoder, in detents/second. Returns false
+// when the index is driven by the other half of a split, in which case callers fall back to the
+// batch-time estimate.
+bool encoder_interrupt_velocity(uint8_t index, uint16_t *velocity);
+#    endif // ENCODER_INTERRUPT_ENABLE
+
 #    ifdef SPLIT_KEYBOARD
 
 #        if defined(ENCODER_A_PINS_RIGHT)
@@ -0,0 +1,127 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "experiment.h"
+
+#include <string.h>
+
+#include "timer.h"
+#include "nvm_experiment.h"
+
+#ifdef DYNAMIC_TAPPING_TERM_ENABLE
+#    include "action_tapping.h"
+#endif
+
+static experiment_nvm_t state          = {0};
+static uint8_t          active_variant = 0;
+static bool             dirty          = false;
+static uint16_t         flush_timer    = 0;
+
+void experiment_init(void) {
+    if (!nvm_experiment_read(&state)) {
+        memset(&state, 0, sizeof(state));
+        state.mode = EXPERIMENT_MODE_ALTERNATE;
+    }
+
+    switch (state.mode) {
+        case EXPERIMENT_MODE_PIN_A:
+            active_variant = 0;
+            break;
+        case EXPERIMENT_MODE_PIN_B:
+            active_variant = 1;
+            break;
+        default:
+            active_variant     = state.next_variant & 1;
+            state.next_variant = active_variant ^ 1;
+            break;
+    }
+    state.counters[active_variant].boots++;
+    nvm_experiment_update(&state);
+    flush_timer = timer_read();
+
+#if defined(DYNAMIC_TAPPING_TERM_ENABLE) && defined(EXPERIMENT_TAPPING_TERM_A) && defined(EXPERIMENT_TAPPING_TERM_B)
+    g_tapping_term = EXPERIMENT_SELECT(EXPERIMENT_TAPPING_TERM_A, EXPERIMENT_TAPPING_TERM_B);
+#endif
+}
+
+uint8_t experiment_variant(void) {
+    return active_variant;
+}
+
+uint8_t experiment_mode(void) {
+    return state.mode;
+}
+
+void experiment_set_mode(uint8_t mode) {
+    if (mode > EXPERIMENT_MODE_PIN_B || mode == state.mode) {
+        return;
+    }
+    state.mode = mode;
+    nvm_experiment_update(&state);
+}
+
+void experiment_on_event(bool pressed) {
+    if (pressed) {
+        state.counters[active_variant].presses++;
+        dirty = true;
+    }
+}
+
+void experiment_on_latency_sample(uint16_t ms) {
+    experiment_counters_t *c = &state.counters[active_variant];
+    c->latency_samples++;
+    c->latency_sum_ms += ms;
+    if (ms > c->latency_max_ms) {
+        c->latency_max_ms = ms;
+    }
+    dirty = true;
+}
+
+void experiment_flush(void) {
+    if (!dirty) {
+        return;
+    }
+    nvm_experiment_update(&state);
+    dirty       = false;
+    flush_timer = timer_read();
+}
+
+void experiment_task(void) {
+    if (dirty && timer_elapsed(flush_timer) > EXPERIMENT_FLUSH_INTERVAL_MS) {
+        experiment_flush();
+    }
+}
+
+void experiment_reset(void) {
+    memset(state.counters, 0, sizeof(state.counters));
+    state.counters[active_variant].boots = 1; // this boot is still running under the active variant
+    dirty                                = false;
+    nvm_experiment_update(&state);
+}
+
+uint8_t experiment_fill_report(uint8_t variant, uint8_t *buffer, uint8_t length) {
+    if (variant > 1 || length < 16) {
+        return 0;
+    }
+
+    const experiment_counters_t *c = &state.counters[variant];
+
+    buffer[0]  = c->boots & 0xFF;
+    buffer[1]  = (c->boots >> 8) & 0xFF;
+    buffer[2]  = c->presses & 0xFF;
+    buffer[3]  = (c->presses >> 8) & 0xFF;
+    buffer[4]  = (c->presses >> 16) & 0xFF;
+    buffer[5]  = (c->presses >> 24) & 0xFF;
+    buffer[6]  = c->latency_samples & 0xFF;
+    buffer[7]  = (c->latency_samples >> 8) & 0xFF;
+    buffer[8]  = (c->latency_samples >> 16) & 0xFF;
+    buffer[9]  = (c->latency_samples >> 24) & 0xFF;
+    buffer[10] = c->latency_sum_ms & 0xFF;
+    buffer[11] = (c->latency_sum_ms >> 8) & 0xFF;
+    buffer[12] = (c->latency_sum_ms >> 16) & 0xFF;
+    buffer[13] = (c->latency_sum_ms >> 24) & 0xFF;
+    buffer[14] = c->latency_max_ms & 0xFF;
+    buffer[15] = (c->latency_max_ms >> 8) & 0xFF;
+
+    return 16;
+}
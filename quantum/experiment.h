@@ -0,0 +1,117 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "util.h" // PACKED
+
+/**
+ * \file
+ *
+ * \defgroup experiment Firmware A/B experiment harness
+ *
+ * \brief Runs two config variants side by side across boots and tags activity counters by variant.
+ *
+ * Changes to debounce, tapping or scan settings are usually judged by feel over an afternoon. This harness turns
+ * them into a measured comparison: both variants are compiled in, one is selected at every boot (alternating by
+ * default, or pinned over raw HID), and per-variant counters -- boots, key presses, and press-to-report latency
+ * aggregates when \ref key_latency is enabled -- accumulate in EEPROM across power cycles. After days of normal
+ * typing on both variants, the counters are read back over raw HID and the latency sums divide out into a mean
+ * per variant that actually reflects production use.
+ *
+ * Variant-dependent values are expressed with \ref EXPERIMENT_SELECT at any point the firmware consults at
+ * runtime. Tapping is wired up out of the box: with DYNAMIC_TAPPING_TERM_ENABLE, defining
+ * EXPERIMENT_TAPPING_TERM_A/_B applies the active variant's term to g_tapping_term at init. Compile-time-only
+ * settings (e.g. the DEBOUNCE macro of most debounce algorithms) cannot be varied per boot; gate the
+ * runtime-consulted side of such changes on experiment_variant() instead.
+ *
+ * The active variant is fixed for the whole boot so every counter unambiguously belongs to one config; mode
+ * changes only affect which variant the next boot selects. Counters are flushed to EEPROM at most once per
+ * EXPERIMENT_FLUSH_INTERVAL_MS and only when they changed, so steady-state wear is one small update per
+ * interval of active typing.
+ * \{
+ */
+
+// How often accumulated counters are written back to EEPROM (milliseconds).
+#ifndef EXPERIMENT_FLUSH_INTERVAL_MS
+#    define EXPERIMENT_FLUSH_INTERVAL_MS 60000
+#endif
+
+// Variant selection policy, persisted and applied at boot.
+#define EXPERIMENT_MODE_ALTERNATE 0 // flip variant every boot
+#define EXPERIMENT_MODE_PIN_A 1     // always boot variant A
+#define EXPERIMENT_MODE_PIN_B 2     // always boot variant B
+
+/** \brief Per-variant counters, persisted across boots. */
+typedef struct PACKED experiment_counters_t {
+    uint16_t boots;
+    uint32_t presses;
+    uint32_t latency_samples;
+    uint32_t latency_sum_ms;
+    uint16_t latency_max_ms;
+} experiment_counters_t;
+
+/**
+ * \brief Pick a value by active variant: \p a_ on variant A, \p b_ on variant B.
+ */
+#define EXPERIMENT_SELECT(a_, b_) (experiment_variant() ? (b_) : (a_))
+
+/**
+ * \brief Load persisted state, select this boot's variant and apply wired-up variant settings. Called by keyboard_init().
+ */
+void experiment_init(void);
+
+/**
+ * \brief The variant active for this boot: 0 = A, 1 = B. Stable until the next boot.
+ */
+uint8_t experiment_variant(void);
+
+/**
+ * \brief The persisted selection mode (EXPERIMENT_MODE_*).
+ */
+uint8_t experiment_mode(void);
+
+/**
+ * \brief Set the selection mode. Persisted immediately; takes effect at the next boot.
+ */
+void experiment_set_mode(uint8_t mode);
+
+/**
+ * \brief Count one debounced key event against the active variant. Called by action_exec().
+ */
+void experiment_on_event(bool pressed);
+
+/**
+ * \brief Fold one press-to-report latency sample into the active variant. Called by \ref key_latency.
+ */
+void experiment_on_latency_sample(uint16_t ms);
+
+/**
+ * \brief Flush dirty counters to EEPROM if the flush interval has elapsed. Called by quantum_task().
+ */
+void experiment_task(void);
+
+/**
+ * \brief Flush dirty counters to EEPROM immediately (e.g. before a readback).
+ */
+void experiment_flush(void);
+
+/**
+ * \brief Reset both variants' counters, in RAM and in EEPROM. Mode and boot alternation are kept.
+ */
+void experiment_reset(void);
+
+/**
+ * \brief Pack one variant's counters into a buffer for transmission over raw HID.
+ *
+ * Layout: boots (2 bytes LE), presses (4 bytes LE), latency samples (4 bytes LE), latency sum ms (4 bytes LE),
+ * latency max ms (2 bytes LE).
+ *
+ * \return the number of bytes written, 0 on an invalid variant or a too-small buffer.
+ */
+uint8_t experiment_fill_report(uint8_t variant, uint8_t *buffer, uint8_t length);
+
+/** \} */
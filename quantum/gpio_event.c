@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio_event.h"
+
+#if !defined(PROTOCOL_CHIBIOS)
+#    error "GPIO edge events require ChibiOS PAL line events."
+#endif
+
+#include <ch.h>
+#include <hal.h>
+
+typedef struct gpio_event_line_t {
+    pin_t                pin;
+    uint8_t              slot;
+    gpio_event_handler_t handler;
+    void                *context;
+} gpio_event_line_t;
+
+typedef struct gpio_event_t {
+    uint8_t  line;
+    bool     level;
+    uint16_t time_ms;
+} gpio_event_t;
+
+static gpio_event_line_t lines[GPIO_EVENT_MAX_LINES];
+static uint8_t           line_count = 0;
+
+// Single-producer (ISR) / single-consumer (drain) ring; the indices are only ever advanced by their own side.
+static gpio_event_t     queue[GPIO_EVENT_QUEUE_SIZE];
+static volatile uint8_t queue_head = 0;
+static volatile uint8_t queue_tail = 0;
+
+uint16_t gpio_event_time(void) {
+    return (uint16_t)TIME_I2MS((uint32_t)chVTGetSystemTimeX());
+}
+
+static void gpio_event_isr(void *arg) {
+    gpio_event_line_t *line = (gpio_event_line_t *)arg;
+
+    uint8_t next = (queue_head + 1) % GPIO_EVENT_QUEUE_SIZE;
+    if (next == queue_tail) {
+        // Full -- drop the edge. Consumers see the level of the next edge that does fit, so a dropped
+        // burst degrades to bounce rather than corrupting state.
+        return;
+    }
+
+    queue[queue_head] = (gpio_event_t){
+        .line    = (uint8_t)(line - lines),
+        .level   = palReadLine(line->pin),
+        .time_ms = gpio_event_time(),
+    };
+    queue_head = next;
+}
+
+bool gpio_event_register(pin_t pin, uint8_t slot, gpio_event_handler_t handler, void *context) {
+    if (line_count >= GPIO_EVENT_MAX_LINES) {
+        return false;
+    }
+
+    lines[line_count] = (gpio_event_line_t){.pin = pin, .slot = slot, .handler = handler, .context = context};
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, gpio_event_isr, &lines[line_count]);
+    line_count++;
+    return true;
+}
+
+void gpio_event_drain(void) {
+    while (queue_tail != queue_head) {
+        gpio_event_t event = queue[queue_tail];
+        queue_tail         = (queue_tail + 1) % GPIO_EVENT_QUEUE_SIZE;
+
+        gpio_event_line_t *line = &lines[event.line];
+        line->handler(line->slot, event.level, event.time_ms, line->context);
+    }
+}
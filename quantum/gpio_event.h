@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/**
+ * \file
+ *
+ * \defgroup gpio_event Shared GPIO edge-event service
+ *
+ * \brief Interrupt-driven replacement for per-scan GPIO polling of rarely-changing inputs.
+ *
+ * Registered pins are switched to both-edge interrupts; each edge is timestamped in the ISR and pushed into a small
+ * ring buffer, which \ref gpio_event_drain empties at task level, invoking the registered handler per edge. Consumers
+ * (the dip switch and quadrature encoder interrupt paths) stop reading their GPIOs every scan iteration and instead
+ * react only when an edge actually arrived, with edge times captured at ISR precision rather than scan granularity.
+ *
+ * Requires ChibiOS PAL line events (`PAL_USE_CALLBACKS = TRUE` in halconf.h). The ring tolerates a single producer
+ * per interrupt priority level; overflowing edges are dropped, which consumers must treat as bounce.
+ * \{
+ */
+
+/**
+ * \brief Maximum number of pins that can be registered for edge events.
+ */
+#ifndef GPIO_EVENT_MAX_LINES
+#    define GPIO_EVENT_MAX_LINES 8
+#endif
+
+/**
+ * \brief Number of edges that can be buffered between drains.
+ */
+#ifndef GPIO_EVENT_QUEUE_SIZE
+#    define GPIO_EVENT_QUEUE_SIZE 32
+#endif
+
+/**
+ * \brief Invoked from \ref gpio_event_drain for each buffered edge, in arrival order.
+ *
+ * \param slot      The consumer-chosen identifier passed to \ref gpio_event_register.
+ * \param level     The pin level sampled in the ISR.
+ * \param time_ms   Millisecond timestamp of the edge, comparable with \ref gpio_event_time.
+ * \param context   The consumer-chosen context pointer passed to \ref gpio_event_register.
+ */
+typedef void (*gpio_event_handler_t)(uint8_t slot, bool level, uint16_t time_ms, void *context);
+
+/**
+ * \brief Enables both-edge interrupts on a pin and routes its edges to the given handler.
+ *
+ * \return false if the line table is full.
+ */
+bool gpio_event_register(pin_t pin, uint8_t slot, gpio_event_handler_t handler, void *context);
+
+/**
+ * \brief Empties the edge ring buffer, invoking each line's handler at task level.
+ */
+void gpio_event_drain(void);
+
+/**
+ * \brief Current time in milliseconds on the same clock the ISR timestamps use.
+ */
+uint16_t gpio_event_time(void);
+
+/** \} */
@@ -29,6 +29,74 @@
 #    include "solenoid.h"
 #endif
 
+#ifdef HAPTIC_ASYNC
+#    if defined(HAPTIC_DRV2605L) && !defined(I2C_MASTER_ASYNC)
+#        error HAPTIC_ASYNC with DRV2605L requires I2C_MASTER_ASYNC for the asynchronous transaction queue
+#    endif
+#    ifdef HAPTIC_DRV2605L
+#        include "i2c_master.h"
+#    endif
+
+#    ifndef HAPTIC_ASYNC_QUEUE_SIZE
+#        define HAPTIC_ASYNC_QUEUE_SIZE 4
+#    endif
+
+// Pending pattern ids (DRV2605L effect numbers). haptic_play() only enqueues;
+// the I2C traffic happens when haptic_task() drains the queue, so the
+// keystroke path never waits on the bus.
+static uint8_t haptic_queue[HAPTIC_ASYNC_QUEUE_SIZE];
+static uint8_t haptic_queue_enqueue_idx = 0;
+static uint8_t haptic_queue_drain_idx   = 0;
+static uint8_t haptic_queue_count       = 0;
+
+#    ifdef HAPTIC_DRV2605L
+// Register write sequence for one waveform pulse, pre-synthesized at init so
+// draining a pattern is three buffer submits with no framing work. Only the
+// effect byte is stamped per pulse; the buffers are owned by the async queue
+// until the completion callback fires, hence the in-flight guard.
+static uint8_t       haptic_pattern_stop[2];
+static uint8_t       haptic_pattern_seq[2];
+static uint8_t       haptic_pattern_go[2];
+static volatile bool haptic_pattern_in_flight = false;
+
+static void haptic_pattern_complete(i2c_status_t status, void *user_data) {
+    (void)status;
+    (void)user_data;
+    haptic_pattern_in_flight = false;
+}
+#    endif
+
+static void haptic_queue_drain(void) {
+    if (haptic_queue_count == 0) {
+        return;
+    }
+#    ifdef HAPTIC_DRV2605L
+    if (haptic_pattern_in_flight) {
+        // The previous pulse's writes still own the pattern buffers
+        return;
+    }
+#    endif
+    uint8_t effect         = haptic_queue[haptic_queue_drain_idx];
+    haptic_queue_drain_idx = (haptic_queue_drain_idx + 1) % HAPTIC_ASYNC_QUEUE_SIZE;
+    haptic_queue_count--;
+#    ifdef HAPTIC_DRV2605L
+    haptic_pattern_seq[1]    = effect;
+    haptic_pattern_in_flight = true;
+    // Submissions are executed FIFO, so the stop/sequence/go ordering holds
+    bool submitted = i2c_transmit_async(DRV2605L_I2C_ADDRESS << 1, haptic_pattern_stop, 2, 100, NULL, NULL) && i2c_transmit_async(DRV2605L_I2C_ADDRESS << 1, haptic_pattern_seq, 2, 100, NULL, NULL) && i2c_transmit_async(DRV2605L_I2C_ADDRESS << 1, haptic_pattern_go, 2, 100, haptic_pattern_complete, NULL);
+    if (!submitted) {
+        // Transaction queue full - drop the pulse rather than block on it
+        haptic_pattern_in_flight = false;
+    }
+#    else
+    (void)effect;
+#    endif
+#    ifdef HAPTIC_SOLENOID
+    solenoid_fire_handler();
+#    endif
+}
+#endif
+
 #if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
 extern uint8_t split_haptic_play;
 #endif
@@ -101,14 +169,28 @@ void haptic_init(void) {
 #ifdef HAPTIC_ENABLE_STATUS_LED
     gpio_set_pin_output(HAPTIC_ENABLE_STATUS_LED);
 #endif
+#if defined(HAPTIC_ASYNC) && defined(HAPTIC_DRV2605L)
+    haptic_pattern_stop[0] = DRV2605L_REG_GO;
+    haptic_pattern_stop[1] = 0x00;
+    haptic_pattern_seq[0]  = DRV2605L_REG_WAVEFORM_SEQUENCER_1;
+    haptic_pattern_seq[1]  = haptic_config.mode;
+    haptic_pattern_go[0]   = DRV2605L_REG_GO;
+    haptic_pattern_go[1]   = 0x01;
+#endif
 }
 
 void haptic_task(void) {
-#ifdef HAPTIC_SOLENOID
 // Only run task on seconary boards if the user desires
-#    if defined(SPLIT_KEYBOARD) && !defined(SPLIT_HAPTIC_ENABLE)
+#if defined(SPLIT_KEYBOARD) && !defined(SPLIT_HAPTIC_ENABLE)
     if (!is_keyboard_master()) return;
+#endif
+#ifdef HAPTIC_ASYNC
+    haptic_queue_drain();
+#    ifdef HAPTIC_DRV2605L
+    i2c_async_task();
 #    endif
+#endif
+#ifdef HAPTIC_SOLENOID
     solenoid_check();
 #endif // HAPTIC_SOLENOID
 }
@@ -331,18 +413,35 @@ void haptic_cont_decrease(void) {
 }
 
 void haptic_play(void) {
-#ifdef HAPTIC_DRV2605L
+#ifdef HAPTIC_ASYNC
+    // Enqueue the pattern id only; haptic_queue_drain() performs the actual
+    // driver traffic from haptic_task()
+    if (haptic_queue_count < HAPTIC_ASYNC_QUEUE_SIZE) {
+        haptic_queue[haptic_queue_enqueue_idx] = haptic_config.mode;
+        haptic_queue_enqueue_idx               = (haptic_queue_enqueue_idx + 1) % HAPTIC_ASYNC_QUEUE_SIZE;
+        haptic_queue_count++;
+    }
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+#        ifdef HAPTIC_DRV2605L
+    split_haptic_play = haptic_config.mode;
+#        else
+    split_haptic_play = 1;
+#        endif
+#    endif
+#else
+#    ifdef HAPTIC_DRV2605L
     uint8_t play_eff = 0;
     play_eff         = haptic_config.mode;
     drv2605l_pulse(play_eff);
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+#        if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
     split_haptic_play = haptic_config.mode;
+#        endif
 #    endif
-#endif
-#ifdef HAPTIC_SOLENOID
+#    ifdef HAPTIC_SOLENOID
     solenoid_fire_handler();
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+#        if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
     split_haptic_play = 1;
+#        endif
 #    endif
 #endif
 }
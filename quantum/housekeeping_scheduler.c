@@ -0,0 +1,123 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "housekeeping_scheduler.h"
+
+#include <string.h>
+
+#include "timer.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+typedef struct scheduled_task_t {
+    housekeeping_task_callback_t callback; // NULL marks a free slot
+    void                        *cb_arg;
+    uint16_t                     period_ms;
+    uint8_t                      priority;
+    uint32_t                     budget_ticks;
+    uint32_t                     last_run;
+    housekeeping_task_stats_t    stats;
+} scheduled_task_t;
+
+static scheduled_task_t tasks[HOUSEKEEPING_MAX_TASKS] = {0};
+
+// Same source as cpu_profiler_timestamp(), so budgets can be chosen straight
+// from profiler readings without a unit conversion.
+static uint32_t scheduler_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    return timer_read32();
+#endif
+}
+
+housekeeping_task_token_t housekeeping_task_register(housekeeping_task_callback_t callback, void *cb_arg, uint16_t period_ms, uint8_t priority, uint32_t budget_ticks) {
+    if (callback == NULL) {
+        return INVALID_HOUSEKEEPING_TASK;
+    }
+
+    for (uint8_t i = 0; i < HOUSEKEEPING_MAX_TASKS; i++) {
+        if (tasks[i].callback == NULL) {
+            memset(&tasks[i], 0, sizeof(tasks[i]));
+            tasks[i].callback     = callback;
+            tasks[i].cb_arg       = cb_arg;
+            tasks[i].period_ms    = period_ms;
+            tasks[i].priority     = priority;
+            tasks[i].budget_ticks = budget_ticks;
+            tasks[i].last_run     = timer_read32();
+            return (housekeeping_task_token_t)(i + 1);
+        }
+    }
+    return INVALID_HOUSEKEEPING_TASK;
+}
+
+static scheduled_task_t *task_for_token(housekeeping_task_token_t token) {
+    if (token == INVALID_HOUSEKEEPING_TASK || token > HOUSEKEEPING_MAX_TASKS || tasks[token - 1].callback == NULL) {
+        return NULL;
+    }
+    return &tasks[token - 1];
+}
+
+bool housekeeping_task_cancel(housekeeping_task_token_t token) {
+    scheduled_task_t *task = task_for_token(token);
+    if (task == NULL) {
+        return false;
+    }
+    task->callback = NULL;
+    return true;
+}
+
+const housekeeping_task_stats_t *housekeeping_task_get_stats(housekeeping_task_token_t token) {
+    scheduled_task_t *task = task_for_token(token);
+    return (task != NULL) ? &task->stats : NULL;
+}
+
+void housekeeping_scheduler_task(void) {
+    uint32_t          now  = timer_read32();
+    scheduled_task_t *pick = NULL;
+    uint32_t          pick_overdue = 0;
+
+    for (uint8_t i = 0; i < HOUSEKEEPING_MAX_TASKS; i++) {
+        scheduled_task_t *task = &tasks[i];
+        if (task->callback == NULL) {
+            continue;
+        }
+        // Overrun penalty: each backoff step doubles the effective period.
+        uint32_t effective_period = (uint32_t)task->period_ms << task->stats.backoff;
+        uint32_t elapsed          = now - task->last_run;
+        if (elapsed < effective_period) {
+            continue;
+        }
+        uint32_t overdue = elapsed - effective_period;
+        if (pick == NULL || task->priority > pick->priority || (task->priority == pick->priority && overdue > pick_overdue)) {
+            pick         = task;
+            pick_overdue = overdue;
+        }
+    }
+
+    if (pick == NULL) {
+        return;
+    }
+
+    // Only this one task runs this iteration; everything else waits for a later
+    // loop, keeping the per-iteration cost bounded by the worst single task.
+    pick->last_run = now;
+    uint32_t start = scheduler_timestamp();
+    pick->callback(pick->cb_arg);
+    uint32_t dt = scheduler_timestamp() - start;
+
+    pick->stats.runs++;
+    if (dt > pick->stats.max_ticks) {
+        pick->stats.max_ticks = dt;
+    }
+    if (pick->budget_ticks != 0 && dt > pick->budget_ticks) {
+        pick->stats.overruns++;
+        if (pick->stats.backoff < HOUSEKEEPING_MAX_BACKOFF) {
+            pick->stats.backoff++;
+        }
+    } else if (pick->stats.backoff > 0) {
+        pick->stats.backoff--;
+    }
+}
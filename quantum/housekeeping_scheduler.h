@@ -0,0 +1,88 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup housekeeping_scheduler Cooperative housekeeping task scheduler
+ *
+ * \brief Bounds per-loop housekeeping cost by scheduling registered tasks one at a time.
+ *
+ * The stock housekeeping_task_kb()/_user() hooks are a monolithic chain: every piece of background work a keymap
+ * accumulates (display, games, weather sync, ...) runs back to back in a single loop iteration, so worst-case
+ * input latency is their sum. The scheduler replaces that with registered tasks carrying a period, a priority and
+ * a per-iteration time budget, and runs AT MOST ONE due task per loop iteration -- the highest-priority one, with
+ * ties going to the most overdue. Loop cost is thereby bounded by the single most expensive task rather than the
+ * total.
+ *
+ * Tasks that exceed their budget are counted and backed off: each overrun doubles the task's effective period (up
+ * to 8x), and on-budget runs walk the penalty back. Budgets and durations are in ticks of the same timestamp
+ * source cpu_profiler uses, so profiler numbers can be used directly when picking a budget.
+ *
+ * The hook chain still runs every iteration; the scheduler is for the periodic work a keymap would otherwise put
+ * inside those hooks.
+ * \{
+ */
+
+/** \brief Maximum number of registered tasks. */
+#ifndef HOUSEKEEPING_MAX_TASKS
+#    define HOUSEKEEPING_MAX_TASKS 8
+#endif
+
+/** \brief Overruns double the effective period at most this many times. */
+#ifndef HOUSEKEEPING_MAX_BACKOFF
+#    define HOUSEKEEPING_MAX_BACKOFF 3
+#endif
+
+/** \brief A handle for cancelling or querying a registered task. */
+typedef uint8_t housekeeping_task_token_t;
+
+/** \brief The constant used to denote an invalid task token. */
+#define INVALID_HOUSEKEEPING_TASK 0
+
+/** \brief Task callback. \p cb_arg is the argument given at registration. */
+typedef void (*housekeeping_task_callback_t)(void *cb_arg);
+
+/** \brief Accumulated per-task accounting. */
+typedef struct housekeeping_task_stats_t {
+    uint32_t runs;      // times the task has executed
+    uint32_t overruns;  // runs that exceeded the budget
+    uint32_t max_ticks; // longest single run
+    uint8_t  backoff;   // current period-doubling penalty, 0 = none
+} housekeeping_task_stats_t;
+
+/**
+ * \brief Register a periodic task.
+ *
+ * \param callback     function to run
+ * \param cb_arg       argument passed to the callback, may be NULL
+ * \param period_ms    minimum interval between runs; 0 = eligible every iteration
+ * \param priority     higher values run first when several tasks are due
+ * \param budget_ticks per-run budget in timestamp ticks; 0 = unbudgeted
+ * \return a token for cancellation/stats, or INVALID_HOUSEKEEPING_TASK if the table is full
+ */
+housekeeping_task_token_t housekeeping_task_register(housekeeping_task_callback_t callback, void *cb_arg, uint16_t period_ms, uint8_t priority, uint32_t budget_ticks);
+
+/**
+ * \brief Remove a registered task.
+ *
+ * \return true if the token referred to a live task
+ */
+bool housekeeping_task_cancel(housekeeping_task_token_t token);
+
+/**
+ * \brief Retrieve a task's accounting, or NULL for an invalid token.
+ */
+const housekeeping_task_stats_t *housekeeping_task_get_stats(housekeeping_task_token_t token);
+
+/**
+ * \brief Run one scheduling pass: execute the highest-priority due task, if any. Called from housekeeping_task().
+ */
+void housekeeping_scheduler_task(void);
+
+/** \} */
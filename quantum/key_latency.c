@@ -0,0 +1,115 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_latency.h"
+
+#include <string.h>
+
+#include "timer.h"
+
+#ifdef KEY_LATENCY_PROBE_PIN
+#    include "gpio.h"
+#endif
+
+#ifdef EXPERIMENT_ENABLE
+#    include "experiment.h"
+#endif
+
+static key_latency_stats_t stats = {0};
+
+// Timestamp of the event currently being processed; one sample is taken per event that produces a report.
+static bool     sample_pending       = false;
+static uint16_t pending_time         = 0;
+static uint16_t pending_dispatch_ms  = 0;
+
+#ifdef KEY_LATENCY_PROBE_PIN
+static bool probe_enabled = false;
+
+void key_latency_probe_set(bool enabled) {
+    if (enabled && !probe_enabled) {
+        gpio_set_pin_output(KEY_LATENCY_PROBE_PIN);
+        gpio_write_pin_low(KEY_LATENCY_PROBE_PIN);
+    }
+    probe_enabled = enabled;
+}
+
+bool key_latency_probe_enabled(void) {
+    return probe_enabled;
+}
+#endif
+
+void key_latency_on_event(uint16_t event_time) {
+    pending_time        = event_time;
+    pending_dispatch_ms = TIMER_DIFF_16(timer_read(), event_time);
+    sample_pending      = true;
+
+#ifdef KEY_LATENCY_PROBE_PIN
+    // Rising edge at debounce commit; the analyzer triggers here and the host tool stops the clock
+    // on the HID input event, capturing the full firmware + transport + host-stack path.
+    if (probe_enabled) {
+        gpio_write_pin_high(KEY_LATENCY_PROBE_PIN);
+    }
+#endif
+}
+
+void key_latency_on_report(void) {
+    if (!sample_pending) {
+        return;
+    }
+    sample_pending = false;
+
+#ifdef KEY_LATENCY_PROBE_PIN
+    if (probe_enabled) {
+        gpio_write_pin_low(KEY_LATENCY_PROBE_PIN);
+    }
+#endif
+
+    uint16_t delta = TIMER_DIFF_16(timer_read(), pending_time);
+
+    stats.sample_count++;
+    stats.last_ms          = delta;
+    stats.last_dispatch_ms = pending_dispatch_ms;
+    if (delta > stats.max_ms) {
+        stats.max_ms = delta;
+    }
+
+    uint8_t bucket = delta < KEY_LATENCY_HISTOGRAM_BUCKETS ? delta : (KEY_LATENCY_HISTOGRAM_BUCKETS - 1);
+    stats.bucket_counts[bucket]++;
+
+#ifdef EXPERIMENT_ENABLE
+    experiment_on_latency_sample(delta);
+#endif
+}
+
+const key_latency_stats_t *key_latency_get_stats(void) {
+    return &stats;
+}
+
+void key_latency_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    sample_pending = false;
+}
+
+uint8_t key_latency_fill_report(uint8_t *buffer, uint8_t length) {
+    if (length < 11) {
+        return 0;
+    }
+
+    buffer[0]  = KEY_LATENCY_HISTOGRAM_BUCKETS;
+    buffer[1]  = stats.sample_count & 0xFF;
+    buffer[2]  = (stats.sample_count >> 8) & 0xFF;
+    buffer[3]  = (stats.sample_count >> 16) & 0xFF;
+    buffer[4]  = (stats.sample_count >> 24) & 0xFF;
+    buffer[5]  = stats.max_ms & 0xFF;
+    buffer[6]  = (stats.max_ms >> 8) & 0xFF;
+    buffer[7]  = stats.last_ms & 0xFF;
+    buffer[8]  = (stats.last_ms >> 8) & 0xFF;
+    buffer[9]  = stats.last_dispatch_ms & 0xFF;
+    buffer[10] = (stats.last_dispatch_ms >> 8) & 0xFF;
+
+    uint8_t written = 11;
+    for (uint8_t i = 0; i < KEY_LATENCY_HISTOGRAM_BUCKETS && written < length; i++, written++) {
+        buffer[written] = stats.bucket_counts[i] > 255 ? 255 : (uint8_t)stats.bucket_counts[i];
+    }
+    return written;
+}
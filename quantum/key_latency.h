@@ -0,0 +1,81 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup key_latency Key latency instrumentation
+ *
+ * \brief Measures press-to-report latency between debounce commit and HID transmission.
+ *
+ * Each key event is timestamped when it leaves debounce (action_exec), and the elapsed time is recorded when the
+ * resulting keyboard report is handed to the host driver. Samples are accumulated into a millisecond histogram that
+ * can be retrieved over raw HID to quantify latency regressions between firmware builds.
+ *
+ * When KEY_LATENCY_PROBE_PIN is defined, a runtime-toggled test-rig mode additionally drives that GPIO high at
+ * debounce commit and low when the report leaves for the host. An external logic analyzer triggered on the pin can
+ * then measure the pin-to-HID-event delta, and together with the per-stage timestamps in the raw HID report this
+ * decomposes end-to-end latency into scan/debounce, firmware processing, and host transport.
+ * \{
+ */
+
+#ifndef KEY_LATENCY_HISTOGRAM_BUCKETS
+#    define KEY_LATENCY_HISTOGRAM_BUCKETS 16
+#endif
+
+typedef struct key_latency_stats_t {
+    uint32_t sample_count;
+    uint16_t last_ms;
+    uint16_t max_ms;
+    uint16_t last_dispatch_ms; // debounce commit -> action dispatch portion of last_ms; the rest is processing + send
+    uint32_t bucket_counts[KEY_LATENCY_HISTOGRAM_BUCKETS]; // 1ms-wide buckets; the last bucket collects everything above
+} key_latency_stats_t;
+
+/**
+ * \brief Record the debounce-commit timestamp of the key event about to be processed. Called by action_exec().
+ */
+void key_latency_on_event(uint16_t event_time);
+
+/**
+ * \brief Record the latency sample for the pending key event, if any. Called when a keyboard report is sent.
+ */
+void key_latency_on_report(void);
+
+/**
+ * \brief Retrieve the accumulated latency statistics.
+ */
+const key_latency_stats_t *key_latency_get_stats(void);
+
+/**
+ * \brief Reset all accumulated latency statistics.
+ */
+void key_latency_reset(void);
+
+/**
+ * \brief Pack the statistics into a buffer for transmission over raw HID.
+ *
+ * Layout: bucket count (1 byte), sample count (4 bytes LE), max ms (2 bytes LE), last ms (2 bytes LE), last dispatch
+ * ms (2 bytes LE), followed by per-bucket counts capped at 255 (1 byte each, as many as fit).
+ *
+ * \return the number of bytes written.
+ */
+uint8_t key_latency_fill_report(uint8_t *buffer, uint8_t length);
+
+#ifdef KEY_LATENCY_PROBE_PIN
+/**
+ * \brief Enable or disable the GPIO probe test-rig mode. The pin is configured as an output on first enable.
+ */
+void key_latency_probe_set(bool enabled);
+
+/**
+ * \brief Whether the GPIO probe test-rig mode is currently active.
+ */
+bool key_latency_probe_enabled(void);
+#endif
+
+/** \} */
@@ -0,0 +1,88 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_stats.h"
+
+#include <string.h>
+
+#include "timer.h"
+
+// One histogram per key per metric, one byte per bin. 4x10 matrix, 16 bins: 1280 bytes.
+static uint8_t hold_bins[MATRIX_ROWS][MATRIX_COLS][KEY_STATS_BINS];
+static uint8_t interval_bins[MATRIX_ROWS][MATRIX_COLS][KEY_STATS_BINS];
+
+// Press bookkeeping for duration/interval measurement
+static uint16_t press_time[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  pressed[MATRIX_ROWS][(MATRIX_COLS + 7) / 8];
+
+static uint16_t last_press_time;
+static bool     last_press_valid = false;
+static uint32_t total_presses    = 0;
+
+// Bin a sample, halving the whole histogram when the target bin saturates so long captures keep the
+// distribution's shape instead of clipping at 255
+static void bin_sample(uint8_t bins[KEY_STATS_BINS], uint16_t ms) {
+    uint16_t bin = ms / KEY_STATS_BIN_MS;
+    if (bin >= KEY_STATS_BINS) {
+        bin = KEY_STATS_BINS - 1;
+    }
+    if (bins[bin] == UINT8_MAX) {
+        for (uint8_t i = 0; i < KEY_STATS_BINS; i++) {
+            bins[i] >>= 1;
+        }
+    }
+    bins[bin]++;
+}
+
+void key_stats_on_event(uint8_t row, uint8_t col, bool pressed_now, uint16_t time) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return;
+    }
+
+    if (pressed_now) {
+        if (last_press_valid) {
+            bin_sample(interval_bins[row][col], TIMER_DIFF_16(time, last_press_time));
+        }
+        last_press_time  = time;
+        last_press_valid = true;
+
+        press_time[row][col] = time;
+        pressed[row][col / 8] |= 1 << (col % 8);
+        total_presses++;
+    } else if (pressed[row][col / 8] & (1 << (col % 8))) {
+        pressed[row][col / 8] &= ~(1 << (col % 8));
+        bin_sample(hold_bins[row][col], TIMER_DIFF_16(time, press_time[row][col]));
+    }
+}
+
+void key_stats_reset(void) {
+    memset(hold_bins, 0, sizeof(hold_bins));
+    memset(interval_bins, 0, sizeof(interval_bins));
+    memset(pressed, 0, sizeof(pressed));
+    last_press_valid = false;
+    total_presses    = 0;
+}
+
+uint8_t key_stats_fill_info(uint8_t *buffer, uint8_t length) {
+    if (length < 8) {
+        return 0;
+    }
+    buffer[0] = MATRIX_ROWS;
+    buffer[1] = MATRIX_COLS;
+    buffer[2] = KEY_STATS_BINS;
+    buffer[3] = KEY_STATS_BIN_MS;
+    buffer[4] = total_presses & 0xFF;
+    buffer[5] = (total_presses >> 8) & 0xFF;
+    buffer[6] = (total_presses >> 16) & 0xFF;
+    buffer[7] = (total_presses >> 24) & 0xFF;
+    return 8;
+}
+
+uint8_t key_stats_fill_key(uint8_t row, uint8_t col, uint8_t kind, uint8_t *buffer, uint8_t length) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS || kind > KEY_STATS_KIND_INTERVAL || length < KEY_STATS_BINS) {
+        return 0;
+    }
+    const uint8_t *bins = kind == KEY_STATS_KIND_HOLD ? hold_bins[row][col] : interval_bins[row][col];
+    memcpy(buffer, bins, KEY_STATS_BINS);
+    return KEY_STATS_BINS;
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup key_stats Per-key actuation analytics
+ *
+ * \brief Accumulates per-key press-duration and inter-key-interval histograms for tuning tapping and combo terms.
+ *
+ * Every debounced key event is sampled in action_exec(), where the event timestamp is exact: a release bins the
+ * hold duration of that key, a press bins the interval since the previous press of any key. Bins are
+ * KEY_STATS_BIN_MS wide (the bin index is just `ms / KEY_STATS_BIN_MS`), one byte per bin; when a bin saturates,
+ * all bins of that histogram are halved, so long sessions keep the shape of the distribution instead of clipping
+ * it. The whole table lives in RAM and is exported key-by-key over raw HID, letting per-key tapping terms,
+ * combo terms, and hold/tap thresholds be set from measured distributions instead of feel.
+ * \{
+ */
+
+#ifndef KEY_STATS_BINS
+#    define KEY_STATS_BINS 16
+#endif
+
+// Bin width in milliseconds; 16 bins of 16ms cover 0-255ms, the range where tapping and combo terms live.
+// The last bin additionally collects everything longer.
+#ifndef KEY_STATS_BIN_MS
+#    define KEY_STATS_BIN_MS 16
+#endif
+
+// Histogram selector for key_stats_fill_key()
+#define KEY_STATS_KIND_HOLD 0
+#define KEY_STATS_KIND_INTERVAL 1
+
+/**
+ * \brief Sample one debounced key event. Called by action_exec() at debounce commit.
+ */
+void key_stats_on_event(uint8_t row, uint8_t col, bool pressed, uint16_t time);
+
+/**
+ * \brief Reset all accumulated histograms.
+ */
+void key_stats_reset(void);
+
+/**
+ * \brief Pack the capture parameters into a buffer for transmission over raw HID.
+ *
+ * Layout: matrix rows (1 byte), matrix cols (1 byte), bin count (1 byte), bin width in ms (1 byte),
+ * total press count (4 bytes LE).
+ *
+ * \return the number of bytes written, 0 if the buffer is too small.
+ */
+uint8_t key_stats_fill_info(uint8_t *buffer, uint8_t length);
+
+/**
+ * \brief Pack one key's histogram into a buffer for transmission over raw HID.
+ *
+ * \param kind KEY_STATS_KIND_HOLD or KEY_STATS_KIND_INTERVAL.
+ *
+ * Layout: per-bin counts (1 byte each, KEY_STATS_BINS of them).
+ *
+ * \return the number of bytes written, 0 on an invalid location/kind or a too-small buffer.
+ */
+uint8_t key_stats_fill_key(uint8_t row, uint8_t col, uint8_t kind, uint8_t *buffer, uint8_t length);
+
+/** \} */
@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_wait_buffer.h"
+
+#include "action_tapping.h"
+#include "action_util.h"
+#include "keyboard.h"
+#include "wait.h"
+#if defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
+#    include "caps_word.h"
+#    include "process_auto_shift.h"
+#endif
+
+bool key_wait_buffer_enq(key_wait_buffer_t *buffer, const keyrecord_t *record, uint16_t keycode, uint16_t context) {
+    if (IS_NOEVENT(record->event)) {
+        return true;
+    }
+
+    if (key_wait_buffer_next(buffer, buffer->head) == buffer->tail) {
+        return false;
+    }
+
+    buffer->entries[buffer->head] = (key_wait_entry_t){
+        .record  = *record,
+        .keycode = keycode,
+        .context = context,
+    };
+    buffer->head = key_wait_buffer_next(buffer, buffer->head);
+    return true;
+}
+
+void key_wait_buffer_clear(key_wait_buffer_t *buffer) {
+    buffer->head = 0;
+    buffer->tail = 0;
+}
+
+void key_wait_buffer_replay(key_wait_buffer_t *buffer, key_wait_replay_callback_t callback) {
+#if TAP_CODE_DELAY > 0
+    bool delay_done = false;
+#endif
+
+    while (buffer->tail != buffer->head) {
+        key_wait_entry_t *entry = &buffer->entries[buffer->tail];
+        // Advance before dispatch; a re-entrant replay (e.g. a buffered key disabling the feature
+        // that owns the buffer) then picks up from the next entry. Nothing enqueues during a
+        // replay, so the slot is not recycled underneath us.
+        buffer->tail = key_wait_buffer_next(buffer, buffer->tail);
+
+        keyrecord_t *record = &entry->record;
+        if (IS_NOEVENT(record->event)) {
+            continue;
+        }
+
+        if (!(callback && callback(entry))) {
+#ifndef NO_ACTION_TAPPING
+            action_tapping_process(*record);
+#else
+            process_record(record);
+#endif
+        }
+        record->event.type = TICK_EVENT;
+
+#if defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
+        // Edge case: preserve the weak Left Shift mod if both Caps Word and
+        // Auto Shift are on. Caps Word capitalizes by setting the weak Left
+        // Shift mod during the press event, but Auto Shift doesn't send the
+        // key until it receives the release event.
+        del_weak_mods((is_caps_word_on() && get_autoshift_state()) ? ~MOD_BIT(KC_LSFT) : 0xff);
+#else
+        clear_weak_mods();
+#endif // defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
+
+#if TAP_CODE_DELAY > 0
+        // only delay once and for a non-tapping key
+        if (!delay_done && !is_tap_record(record)) {
+            delay_done = true;
+            wait_ms(TAP_CODE_DELAY);
+        }
+#endif
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "action.h"
+#include "timer.h"
+
+/**
+ * \file
+ *
+ * \brief Shared pending-key engine for features that hold key events back.
+ *
+ * Combo and tap-hold resolution both defer key events until a chord or tapping decision settles,
+ * and historically each carried its own buffer, replay loop and timeout bookkeeping. This module is
+ * the single implementation they consume. Storage stays with the feature (the same client-owned
+ * table pattern as deferred_exec_advanced), while the ring mechanics, the replay path with its
+ * shared edge cases (weak-mod clearing, TAP_CODE_DELAY, tick-marking of consumed slots) and the
+ * deadline primitive live here, so there is exactly one code path to reason about and to optimize.
+ */
+
+/** \brief A deferred key event plus the client bookkeeping that used to live in parallel arrays. */
+typedef struct key_wait_entry_t {
+    keyrecord_t record;
+    uint16_t    keycode; /**< Keycode resolved at buffer time; 0 when the client does not track it. */
+    uint16_t    context; /**< Client tag: combo index, packed matrix position, ... */
+} key_wait_entry_t;
+
+/** \brief A ring of pending key events over client-owned storage. tail == head means empty. */
+typedef struct key_wait_buffer_t {
+    key_wait_entry_t *entries;
+    uint8_t           capacity;
+    uint8_t           head; /**< Write position. */
+    uint8_t           tail; /**< Replay position. */
+} key_wait_buffer_t;
+
+/** \brief Advances an iteration cursor by one ring slot. */
+static inline uint8_t key_wait_buffer_next(const key_wait_buffer_t *buffer, uint8_t i) {
+    return (i + 1) % buffer->capacity;
+}
+
+static inline bool key_wait_buffer_is_empty(const key_wait_buffer_t *buffer) {
+    return buffer->head == buffer->tail;
+}
+
+/**
+ * \brief Appends a key event to the buffer.
+ *
+ * Tick events are silently accepted without being stored. One ring slot is kept free, so a buffer
+ * backed by N entries holds N-1 events.
+ *
+ * \return false when the buffer is full; the event was not stored.
+ */
+bool key_wait_buffer_enq(key_wait_buffer_t *buffer, const keyrecord_t *record, uint16_t keycode, uint16_t context);
+
+/** \brief Drops all pending events. */
+void key_wait_buffer_clear(key_wait_buffer_t *buffer);
+
+/**
+ * \brief Replay callback, invoked for each entry before the default dispatch.
+ *
+ * \return true when the callback dispatched the entry itself; the default dispatch is skipped but
+ *         the shared post-dispatch bookkeeping still runs.
+ */
+typedef bool (*key_wait_replay_callback_t)(key_wait_entry_t *entry);
+
+/**
+ * \brief Replays all pending events through the regular processing pipeline.
+ *
+ * Each entry is offered to \p callback first (may be NULL), then fed to action_tapping_process()
+ * (process_record() when tapping is disabled) and tick-marked. Weak mods are cleared between
+ * entries and TAP_CODE_DELAY is applied once, matching the historical combo dump semantics. The
+ * replay cursor advances before dispatch, so a re-entrant replay from within process_record()
+ * continues with the remaining entries instead of repeating any.
+ */
+void key_wait_buffer_replay(key_wait_buffer_t *buffer, key_wait_replay_callback_t callback);
+
+/** \brief A single armed timeout: timer_read() at arm time plus a term. timer == 0 means inactive. */
+typedef struct key_wait_deadline_t {
+    uint16_t timer;
+    uint16_t term;
+} key_wait_deadline_t;
+
+static inline void key_wait_deadline_start(key_wait_deadline_t *deadline) {
+    deadline->timer = timer_read();
+}
+
+static inline void key_wait_deadline_cancel(key_wait_deadline_t *deadline) {
+    deadline->timer = 0;
+}
+
+static inline bool key_wait_deadline_active(const key_wait_deadline_t *deadline) {
+    return deadline->timer != 0;
+}
+
+static inline bool key_wait_deadline_expired(const key_wait_deadline_t *deadline) {
+    return key_wait_deadline_active(deadline) && timer_elapsed(deadline->timer) > deadline->term;
+}
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode_config.h"
 #include "matrix.h"
@@ -32,6 +33,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#ifdef KEY_EVENT_QUEUE
+#    include "ring_buffer.h"
+#endif
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -71,6 +75,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef COMBO_ENABLE
 #    include "process_combo.h"
 #endif
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSIST)
+#    include "process_dynamic_macro.h"
+#endif
 #ifdef TAP_DANCE_ENABLE
 #    include "process_tap_dance.h"
 #endif
@@ -125,6 +132,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef BATTERY_ENABLE
 #    include "battery.h"
 #endif
+#ifdef CPU_PROFILER_ENABLE
+#    include "cpu_profiler.h"
+#endif
+#ifdef BINLOG_ENABLE
+#    include "binlog.h"
+#endif
+#ifdef HOUSEKEEPING_SCHEDULER_ENABLE
+#    include "housekeeping_scheduler.h"
+#endif
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 #endif
@@ -149,6 +165,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef RAW_HID_CHANNELS_ENABLE
+#    include "raw_hid_channels.h"
+#endif
+#ifdef EXPERIMENT_ENABLE
+#    include "experiment.h"
+#endif
+#ifdef IDLE_SCAN_GOVERNOR
+#    include "wait.h"
+#    ifdef DEFERRED_EXEC_ENABLE
+#        include "deferred_exec.h"
+#    endif
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -207,13 +235,13 @@ static uint32_t last_matrix_scan_count = 0;
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
-    uint32_t timer_now = timer_read32();
-    if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
+    uint32_t now = timer_now32();
+    if (TIMER_DIFF_32(now, matrix_timer) >= 1000) {
 #    if defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
 #    endif
         last_matrix_scan_count = matrix_scan_count;
-        matrix_timer           = timer_now;
+        matrix_timer           = now;
         matrix_scan_count      = 0;
     }
 }
@@ -225,17 +253,81 @@ uint32_t get_matrix_scan_rate(void) {
 #    define matrix_scan_perf_task()
 #endif
 
+#ifdef MATRIX_EVENT_RATE
+// Debounced key events per second, extrapolated from a half-second window.
+// Cheap enough to sample from housekeeping; used for keymap-level policy such
+// as throttling display work while a typing burst is in progress.
+static uint32_t matrix_event_window_start = 0;
+static uint16_t matrix_event_window_count = 0;
+static uint16_t matrix_event_rate_cached  = 0;
+
+uint16_t get_matrix_event_rate(void) {
+    uint32_t elapsed = timer_now_elapsed32(matrix_event_window_start);
+    if (elapsed >= 500) {
+        matrix_event_rate_cached  = (uint16_t)((matrix_event_window_count * 1000UL) / elapsed);
+        matrix_event_window_count = 0;
+        matrix_event_window_start = timer_now32();
+    }
+    return matrix_event_rate_cached;
+}
+#endif // MATRIX_EVENT_RATE
+
+#ifdef IDLE_SCAN_GOVERNOR
+// Tiered idle engine: after the configured windows without any input, the matrix is scanned at the
+// tier's interval instead of flat-out, with the keyboard loop sleeping in between so the scheduler
+// can park the MCU in its low-power idle state (WFI on ARM). The first scan that observes a key
+// edge resets the activity timers, snapping the governor straight back to full-rate scanning, so
+// detection latency while idle is bounded by the tier's scan interval.
+#    ifndef IDLE_SCAN_TIER1_TIMEOUT_MS
+#        define IDLE_SCAN_TIER1_TIMEOUT_MS 10000 // 10 seconds untouched
+#    endif
+#    ifndef IDLE_SCAN_TIER1_INTERVAL_MS
+#        define IDLE_SCAN_TIER1_INTERVAL_MS 2
+#    endif
+#    ifndef IDLE_SCAN_TIER2_TIMEOUT_MS
+#        define IDLE_SCAN_TIER2_TIMEOUT_MS 300000 // 5 minutes untouched
+#    endif
+#    ifndef IDLE_SCAN_TIER2_INTERVAL_MS
+#        define IDLE_SCAN_TIER2_INTERVAL_MS 8
+#    endif
+
+uint8_t idle_scan_tier(void) {
+    uint32_t idle = last_input_activity_elapsed();
+    if (idle >= IDLE_SCAN_TIER2_TIMEOUT_MS) {
+        return 2;
+    }
+    if (idle >= IDLE_SCAN_TIER1_TIMEOUT_MS) {
+        return 1;
+    }
+    return 0;
+}
+#endif // IDLE_SCAN_GOVERNOR
+
 #ifdef MATRIX_HAS_GHOST
-static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
-    matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (keycode_at_keymap_location(0, row, col) && (rowdata & (((matrix_row_t)1) << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
-            out |= ((matrix_row_t)1) << col;
+/* Columns on each row that map to a real key on layer 0. "Active" blanks in the
+matrix can't be pressed by the user and are filtered out of ghost checks; the
+stock implementation re-read the keymap for every row pair on every scan, which
+on dynamic-keymap boards meant storage lookups on the hot path. The masks only
+change when the keymap does, so they are computed once and invalidated on
+dynamic keymap writes. */
+static matrix_row_t ghost_real_key_mask[MATRIX_ROWS];
+static bool         ghost_real_key_mask_ready = false;
+
+void ghost_detection_invalidate(void) {
+    ghost_real_key_mask_ready = false;
+}
+
+static void ghost_compute_real_key_masks(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t mask = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (keycode_at_keymap_location(0, row, col)) {
+                mask |= ((matrix_row_t)1) << col;
+            }
         }
+        ghost_real_key_mask[row] = mask;
     }
-    return out;
+    ghost_real_key_mask_ready = true;
 }
 
 static inline bool popcount_more_than_one(matrix_row_t rowdata) {
@@ -244,23 +336,24 @@ static inline bool popcount_more_than_one(matrix_row_t rowdata) {
 }
 
 static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
-    /* No ghost exists when less than 2 keys are down on the row.
-    If there are "active" blanks in the matrix, the key can't be pressed by the user,
-    there is no doubt as to which keys are really being pressed.
-    The ghosts will be ignored, they are KC_NO.   */
-    rowdata = get_real_keys(row, rowdata);
+    if (!ghost_real_key_mask_ready) {
+        ghost_compute_real_key_masks();
+    }
+    /* No ghost exists when less than 2 real keys are down on the row. This is
+    the common case -- at most a couple of keys held -- and costs one AND plus
+    the popcount bit trick. The ghosts will be ignored, they are KC_NO. */
+    rowdata &= ghost_real_key_mask[row];
     if ((popcount_more_than_one(rowdata)) == 0) {
         return false;
     }
     /* Ghost occurs when the row shares a column line with other row,
-    and two columns are read on each row. Blanks in the matrix don't matter,
-    so they are filtered out.
-    If there are two or more real keys pressed and they match columns with
-    at least two of another row's real keys, the row will be ignored. Keep in mind,
-    we are checking one row at a time, not all of them at once.
-    */
+    and two columns are read on each row. If there are two or more real keys
+    pressed and they match columns with at least two of another row's real
+    keys, the row will be ignored. Keep in mind, we are checking one row at a
+    time, not all of them at once -- each candidate row is now a single
+    word-wide AND against its precomputed mask. */
     for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
-        if (i != row && popcount_more_than_one(get_real_keys(i, matrix_get_row(i)) & rowdata)) {
+        if (i != row && popcount_more_than_one(matrix_get_row(i) & ghost_real_key_mask[i] & rowdata)) {
             return true;
         }
     }
@@ -281,6 +374,15 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
  */
 __attribute__((weak)) void matrix_setup(void) {}
 
+/** \brief matrix_get
+ *
+ * Full custom matrix implementations don't build matrix_common.c; without a packed
+ * view, change detection falls back to per-row matrix_get_row() reads.
+ */
+__attribute__((weak)) const matrix_row_t *matrix_get(void) {
+    return NULL;
+}
+
 /** \brief keyboard_pre_init_user
  *
  * FIXME: needs doc
@@ -419,9 +521,18 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
+#ifdef HOUSEKEEPING_SCHEDULER_ENABLE
+    housekeeping_scheduler_task();
+#endif
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_HOUSEKEEPING, probe_start);
+#endif
 }
 
 /** \brief quantum_init
@@ -450,6 +561,73 @@ void quantum_init(void) {
     layer_state_set_kb((layer_state_t)layer_state);
 }
 
+#ifdef STAGED_INIT
+/* Staged bring-up: keyboard_init() only starts what scanning and reports need;
+cosmetic subsystems (lighting, audio, displays, haptics) are brought up one
+stage per main-loop iteration afterwards, so the first keystroke is live as
+soon as the matrix is instead of after every init delay has run back to back.
+Keyboard/keymap code with slow bring-up of its own (e.g. display panel reset
+sequencing) should move it from keyboard_post_init_*() into
+keyboard_post_init_deferred_*(), which runs as the final stage. */
+static uint8_t deferred_init_stage = 1;
+
+__attribute__((weak)) void keyboard_post_init_deferred_kb(void) {}
+__attribute__((weak)) void keyboard_post_init_deferred_user(void) {}
+
+bool keyboard_init_is_complete(void) {
+    return deferred_init_stage == 0;
+}
+
+/** \brief Runs at most one deferred init stage. Returns true while stages remain. */
+static bool keyboard_deferred_init_task(void) {
+    switch (deferred_init_stage) {
+        case 1:
+#    ifdef BACKLIGHT_ENABLE
+            backlight_init();
+#    endif
+#    ifdef RGBLIGHT_ENABLE
+            rgblight_init();
+#    endif
+            break;
+        case 2:
+#    ifdef LED_MATRIX_ENABLE
+            led_matrix_init();
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+            rgb_matrix_init();
+#    endif
+            break;
+        case 3:
+#    ifdef AUDIO_ENABLE
+            audio_init();
+#    endif
+            break;
+        case 4:
+#    ifdef OLED_ENABLE
+            oled_init(OLED_ROTATION_0);
+#    endif
+#    ifdef ST7565_ENABLE
+            st7565_init(DISPLAY_ROTATION_0);
+#    endif
+            break;
+        case 5:
+#    ifdef HAPTIC_ENABLE
+            haptic_init();
+#    endif
+            break;
+        case 6:
+            keyboard_post_init_deferred_kb();
+            keyboard_post_init_deferred_user();
+            break;
+        default:
+            deferred_init_stage = 0;
+            return false;
+    }
+    deferred_init_stage++;
+    return true;
+}
+#endif // STAGED_INIT
+
 /** \brief keyboard_init
  *
  * FIXME: needs doc
@@ -475,13 +653,13 @@ void keyboard_init(void) {
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
 #endif
-#ifdef AUDIO_ENABLE
+#if defined(AUDIO_ENABLE) && !defined(STAGED_INIT)
     audio_init();
 #endif
-#ifdef LED_MATRIX_ENABLE
+#if defined(LED_MATRIX_ENABLE) && !defined(STAGED_INIT)
     led_matrix_init();
 #endif
-#ifdef RGB_MATRIX_ENABLE
+#if defined(RGB_MATRIX_ENABLE) && !defined(STAGED_INIT)
     rgb_matrix_init();
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
@@ -490,19 +668,23 @@ void keyboard_init(void) {
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
-#ifdef OLED_ENABLE
+#ifdef EXPERIMENT_ENABLE
+    // after quantum_init(): needs eeconfig (and bootmagic's possible eeprom reset) settled
+    experiment_init();
+#endif
+#if defined(OLED_ENABLE) && !defined(STAGED_INIT)
     oled_init(OLED_ROTATION_0);
 #endif
-#ifdef ST7565_ENABLE
+#if defined(ST7565_ENABLE) && !defined(STAGED_INIT)
     st7565_init(DISPLAY_ROTATION_0);
 #endif
 #ifdef PS2_MOUSE_ENABLE
     ps2_mouse_init();
 #endif
-#ifdef BACKLIGHT_ENABLE
+#if defined(BACKLIGHT_ENABLE) && !defined(STAGED_INIT)
     backlight_init();
 #endif
-#ifdef RGBLIGHT_ENABLE
+#if defined(RGBLIGHT_ENABLE) && !defined(STAGED_INIT)
     rgblight_init();
 #endif
 #ifdef STENO_ENABLE_ALL
@@ -519,6 +701,9 @@ void keyboard_init(void) {
 #ifdef JOYSTICK_ENABLE
     joystick_init();
 #endif
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSIST)
+    dynamic_macro_init();
+#endif
 #ifdef SLEEP_LED_ENABLE
     sleep_led_init();
 #endif
@@ -538,7 +723,7 @@ void keyboard_init(void) {
 #ifdef BLUETOOTH_ENABLE
     bluetooth_init();
 #endif
-#ifdef HAPTIC_ENABLE
+#if defined(HAPTIC_ENABLE) && !defined(STAGED_INIT)
     haptic_init();
 #endif
 
@@ -576,6 +761,37 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifdef KEY_EVENT_QUEUE
+#    ifndef KEY_EVENT_QUEUE_SIZE
+#        define KEY_EVENT_QUEUE_SIZE 16
+#    endif
+
+/* Key events captured while walking the matrix; drained through action_exec() once the scan has finished, so a slow
+ * process_record() implementation cannot delay reads of the remaining rows. Events carry the timestamp taken at
+ * enqueue time, so deferral does not affect tapping term calculations. */
+RING_BUFFER_TYPED(key_event_queue, keyevent_t, KEY_EVENT_QUEUE_SIZE)
+
+/* Drain queued key events through action_exec(). With KEY_EVENT_QUEUE_QUOTA defined, at most that many events are
+ * processed per call and the remainder carries over to the next scan cycle, bounding worst-case loop time during
+ * event floods (stuck key on plug-in, fast macro playback) so the display, split sync and housekeeping still make
+ * progress every iteration. The bound is soft: a single scan producing more than KEY_EVENT_QUEUE_SIZE events still
+ * processes the overflow in place rather than dropping it. */
+static void key_event_queue_drain(void) {
+    keyevent_t queued_event;
+#    ifdef KEY_EVENT_QUEUE_QUOTA
+    for (uint8_t budget = KEY_EVENT_QUEUE_QUOTA; budget > 0 && key_event_queue_dequeue(&queued_event); budget--) {
+        action_exec(queued_event);
+    }
+#    else
+    while (key_event_queue_dequeue(&queued_event)) {
+        action_exec(queued_event);
+    }
+#    endif
+}
+#elif defined(KEY_EVENT_QUEUE_QUOTA)
+#    error KEY_EVENT_QUEUE_QUOTA requires KEY_EVENT_QUEUE to hold the carried-over events.
+#endif
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -585,22 +801,67 @@ static inline void generate_tick_event(void) {
  */
 static bool matrix_task(void) {
     if (!matrix_can_read()) {
+#ifdef KEY_EVENT_QUEUE
+        key_event_queue_drain(); // Carried-over events don't wait for the matrix to become readable
+#endif
         generate_tick_event();
         return false;
     }
 
+#ifdef IDLE_SCAN_GOVERNOR
+    static uint32_t      last_idle_scan        = 0;
+    static const uint8_t idle_scan_intervals[] = {0, IDLE_SCAN_TIER1_INTERVAL_MS, IDLE_SCAN_TIER2_INTERVAL_MS};
+
+    uint8_t idle_scan_interval = idle_scan_intervals[idle_scan_tier()];
+    if (idle_scan_interval != 0 && timer_now_elapsed32(last_idle_scan) < idle_scan_interval) {
+        // Next scan isn't due yet -- sleep the remaining interval in one go rather than a
+        // 1ms tick per loop, so the scheduler can park the core (WFI) until the scan
+        // deadline. USB and other interrupts still wake the core early; a deferred
+        // executor due sooner caps the sleep so its deadline is honored.
+        uint32_t sleep_ms = idle_scan_interval - timer_now_elapsed32(last_idle_scan);
+#    ifdef DEFERRED_EXEC_ENABLE
+        uint32_t deferred_due = deferred_exec_time_until_next();
+        if (deferred_due < sleep_ms) {
+            sleep_ms = deferred_due;
+        }
+#    endif
+        if (sleep_ms > 0) {
+            wait_ms(sleep_ms);
+        }
+        generate_tick_event();
+        return false;
+    }
+    last_idle_scan = timer_now32();
+#endif
+
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_MATRIX_SCAN, probe_start);
+#endif
+    bool                matrix_changed = false;
+    const matrix_row_t *matrix_view    = matrix_get();
+    if (matrix_view) {
+        // Whole-matrix compare: on boards whose full state packs into a word or two this
+        // is a couple of word ops instead of a row loop of matrix_get_row() calls.
+        matrix_changed = memcmp(matrix_view, matrix_previous, sizeof(matrix_previous)) != 0;
+    } else {
+        for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
+            matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+        }
     }
 
     matrix_scan_perf_task();
 
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
+#ifdef KEY_EVENT_QUEUE
+        key_event_queue_drain(); // Events a quota carried over from the previous cycle
+#endif
         generate_tick_event();
         return matrix_changed;
     }
@@ -611,6 +872,9 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef CPU_PROFILER_ENABLE
+    probe_start = cpu_profiler_timestamp();
+#endif
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -619,22 +883,43 @@ static bool matrix_task(void) {
             continue;
         }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
-
-                if (process_keypress) {
+        // Walk only the changed bits - one ctz32 per event instead of shifting
+        // a mask through every column position
+        uint32_t pending = row_changes;
+        while (pending) {
+            const uint8_t col = ctz32(pending);
+            pending &= pending - 1;
+            const bool key_pressed = current_row & ((matrix_row_t)1 << col);
+
+            if (process_keypress) {
+#ifdef KEY_EVENT_QUEUE
+                if (!key_event_queue_enqueue(MAKE_KEYEVENT(row, col, key_pressed))) {
+                    // Queue full -- process in place rather than dropping the event.
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
-
-                switch_events(row, col, key_pressed);
+#else
+                action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
             }
+
+            switch_events(row, col, key_pressed);
+
+#ifdef MATRIX_EVENT_RATE
+            matrix_event_window_count++;
+#endif
         }
 
         matrix_previous[row] = current_row;
     }
 
+#ifdef KEY_EVENT_QUEUE
+    key_event_queue_drain();
+#endif
+
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_PROCESS_RECORD, probe_start);
+#endif
+
     return matrix_changed;
 }
 
@@ -688,6 +973,10 @@ void quantum_task(void) {
     autoshift_matrix_scan();
 #endif
 
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSIST)
+    dynamic_macro_task();
+#endif
+
 #ifdef CAPS_WORD_ENABLE
     caps_word_task();
 #endif
@@ -699,10 +988,22 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#ifdef RAW_HID_CHANNELS_ENABLE
+    raw_hid_channels_task();
+#endif
+
+#ifdef EXPERIMENT_ENABLE
+    experiment_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    timer_now_refresh(); // one hardware timer read per loop; consumers use timer_now*()
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t loop_start = cpu_profiler_timestamp();
+#endif
     __attribute__((unused)) bool activity_has_occurred = false;
     if (matrix_task()) {
         last_matrix_activity_trigger();
@@ -711,10 +1012,23 @@ void keyboard_task(void) {
 
     quantum_task();
 
+#ifdef STAGED_INIT
+    // One deferred init stage per iteration; subsystem tasks below are skipped
+    // until their init has run. Scanning and event processing above are already
+    // live, so keystrokes work from the first loop.
+    if (deferred_init_stage != 0 && keyboard_deferred_init_task()) {
+        return;
+    }
+#endif
+
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
+#if defined(CPU_PROFILER_ENABLE) && (defined(RGBLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE) || defined(RGB_MATRIX_ENABLE))
+    uint32_t lighting_start = cpu_profiler_timestamp();
+#endif
+
 #if defined(RGBLIGHT_ENABLE)
     rgblight_task();
 #endif
@@ -726,6 +1040,10 @@ void keyboard_task(void) {
     rgb_matrix_task();
 #endif
 
+#if defined(CPU_PROFILER_ENABLE) && (defined(RGBLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE) || defined(RGB_MATRIX_ENABLE))
+    cpu_profiler_record(CPU_PROBE_LIGHTING, lighting_start);
+#endif
+
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
     backlight_task();
@@ -796,4 +1114,12 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef BINLOG_ENABLE
+    binlog_task();
+#endif
+
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_MAIN_LOOP, loop_start);
+#endif
 }
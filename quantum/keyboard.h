@@ -139,6 +139,24 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 uint32_t get_matrix_scan_rate(void);
 
+#ifdef MATRIX_EVENT_RATE
+uint16_t get_matrix_event_rate(void); // Debounced key events per second over the recent window
+#endif
+
+#ifdef IDLE_SCAN_GOVERNOR
+uint8_t idle_scan_tier(void); // 0 = active/full scan rate; higher tiers = longer idle, longer scan interval
+#endif
+
+#ifdef MATRIX_HAS_GHOST
+void ghost_detection_invalidate(void); // Recompute the cached real-key masks after the keymap changes
+#endif
+
+#ifdef STAGED_INIT
+void keyboard_post_init_deferred_kb(void);   // Final bring-up stage; move slow cosmetic init here from keyboard_post_init_kb()
+void keyboard_post_init_deferred_user(void); // As above, for user/keymap-level code
+bool keyboard_init_is_complete(void);        // false while deferred init stages are still pending
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,43 @@
 
 typedef int_fast8_t index_t;
 
+/** Formats `number` in `base`, either 10 or 16. */
+static char* number_string(uint16_t number, int8_t base) {
+    static char result[7];
+    result[sizeof(result) - 1] = '\0';
+    index_t i                  = sizeof(result) - 1;
+    do {
+        const uint8_t digit = number % base;
+        number /= base;
+        result[--i] = (digit < 10) ? (char)(digit + UINT8_C('0')) : (char)(digit + (UINT8_C('A') - 10));
+    } while (number > 0 && i > 0);
+
+    if (base == 16 && i >= 2) {
+        result[--i] = 'x';
+        result[--i] = '0';
+    }
+    return result + i;
+}
+
+#ifdef KEYCODE_STRING_DEFERRED
+
+#    ifndef BINLOG_ENABLE
+#        error "KEYCODE_STRING_DEFERRED requires BINLOG_ENABLE"
+#    endif
+
+#    include "binlog.h"
+
+const char* get_keycode_string(uint16_t keycode) {
+    // Name resolution happens on the host: the binlog decoder formats this
+    // record's keycode argument as a readable name, so none of the name tables
+    // or recursive formatting below is compiled into the firmware. On-device
+    // output falls back to the raw hex value.
+    BINLOG1("keycode_string: kc=0x%04X", keycode);
+    return number_string(keycode, 16);
+}
+
+#else // KEYCODE_STRING_DEFERRED
+
 // clang-format off
 /** Packs a 7-char keycode name, ignoring the third char, as 3 words. */
 #define KEYCODE_NAME7(c0, c1, unused_c2, c3, c4, c5, c6) \
@@ -195,24 +232,6 @@ static const char* search_table(const keycode_string_name_t* data, uint16_t size
     return NULL;
 }
 
-/** Formats `number` in `base`, either 10 or 16. */
-static char* number_string(uint16_t number, int8_t base) {
-    static char result[7];
-    result[sizeof(result) - 1] = '\0';
-    index_t i                  = sizeof(result) - 1;
-    do {
-        const uint8_t digit = number % base;
-        number /= base;
-        result[--i] = (digit < 10) ? (char)(digit + UINT8_C('0')) : (char)(digit + (UINT8_C('A') - 10));
-    } while (number > 0 && i > 0);
-
-    if (base == 16 && i >= 2) {
-        result[--i] = 'x';
-        result[--i] = '0';
-    }
-    return result + i;
-}
-
 /** Appends `str` to `buffer`, truncating if the result would overflow. */
 static void append(const char* str) {
     char*   dest = buffer + buffer_len;
@@ -562,3 +581,5 @@ const char* get_keycode_string(uint16_t keycode) {
     append_keycode(keycode);
     return buffer;
 }
+
+#endif // KEYCODE_STRING_DEFERRED
@@ -61,6 +61,13 @@
  *
  * Unrecognized keycodes are printed numerically as hex values like `0x1ABC`.
  *
+ * If `KEYCODE_STRING_DEFERRED` is defined in config.h (requires
+ * `BINLOG_ENABLE = yes`), the name tables and formatting logic above are left
+ * out of the firmware entirely: each call instead logs the raw keycode to the
+ * binary log stream for the host-side decoder to name, and the returned string
+ * is just the hex value. This saves several KB of flash and keeps string
+ * formatting out of the event path while diagnostics are enabled.
+ *
  * Optionally, use `keycode_string_names_user` or `keycode_string_names_kb` to
  * define names for additional keycodes or override how any of the above are
  * formatted.
@@ -76,6 +83,16 @@ typedef struct {
     const char* name;
 } keycode_string_name_t;
 
+#    ifdef KEYCODE_STRING_DEFERRED
+
+// In deferred mode the name tables are never consulted on device; custom names
+// belong in the host decoder's configuration instead.
+#        define KEYCODE_STRING_NAMES_USER(...)
+#        define KEYCODE_STRING_NAMES_KB(...)
+#        define KEYCODE_STRING_NAME(kc)
+
+#    else // KEYCODE_STRING_DEFERRED
+
 // clang-format off
 /**
  * @brief Defines names for additional keycodes for `get_keycode_string()`.
@@ -119,6 +136,8 @@ extern uint16_t                     keycode_string_names_size_user;
 extern const keycode_string_name_t* keycode_string_names_data_kb;
 extern uint16_t                     keycode_string_names_size_kb;
 
+#    endif // KEYCODE_STRING_DEFERRED
+
 #else
 
 // When keycode_string is disabled, fall back to printing keycodes numerically
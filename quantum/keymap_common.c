@@ -24,6 +24,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debug.h"
 #include "keycode_config.h"
 #include "quantum_keycodes.h"
+#include "progmem.h"
+#include "util.h"
 
 #ifdef ENCODER_MAP_ENABLE
 #    include "encoder.h"
@@ -52,6 +54,230 @@ action_t action_for_key(uint8_t layer, keypos_t key) {
     return action_for_keycode(keycode);
 };
 
+#ifdef ACTION_CATEGORY_LUT
+
+// Table-driven replacement for the range-ladder switch below. The compiler lowers that
+// switch into a compare tree walked on every key event; with ACTION_CATEGORY_LUT the
+// decode becomes one indexed byte load for the low page (all of basic/modifier/system/
+// consumer/mouse lives under 0x100), a short walk of a sorted range table for the rare
+// extended codes, and then a single dense jump-table switch on the category. The tables
+// mirror the case labels of the ladder exactly, including their feature guards, so a
+// keycode resolves to the same action either way.
+enum action_category {
+    ACT_CAT_NONE = 0,
+    ACT_CAT_KEY,
+    ACT_CAT_SYSTEM,
+    ACT_CAT_CONSUMER,
+    ACT_CAT_MOUSE,
+    ACT_CAT_TRANSPARENT,
+    ACT_CAT_MODS,
+    ACT_CAT_LAYER_TAP,
+    ACT_CAT_LAYER_GOTO,
+    ACT_CAT_LAYER_MOMENTARY,
+    ACT_CAT_DEFAULT_LAYER,
+    ACT_CAT_LAYER_TOGGLE,
+    ACT_CAT_ONE_SHOT_LAYER,
+    ACT_CAT_ONE_SHOT_MOD,
+    ACT_CAT_LAYER_TAP_TOGGLE,
+    ACT_CAT_LAYER_MOD,
+    ACT_CAT_MOD_TAP,
+    ACT_CAT_SWAP_HANDS,
+};
+
+// Unlisted positions zero-initialize to ACT_CAT_NONE, matching the ladder's default.
+static const uint8_t basic_keycode_category[256] PROGMEM = {
+    [BASIC_KEYCODE_RANGE]    = ACT_CAT_KEY,
+    [MODIFIER_KEYCODE_RANGE] = ACT_CAT_KEY,
+#    ifdef EXTRAKEY_ENABLE
+    [SYSTEM_KEYCODE_RANGE]   = ACT_CAT_SYSTEM,
+    [CONSUMER_KEYCODE_RANGE] = ACT_CAT_CONSUMER,
+#    endif
+    [MOUSE_KEYCODE_RANGE] = ACT_CAT_MOUSE,
+    [KC_TRANSPARENT]      = ACT_CAT_TRANSPARENT,
+};
+
+typedef struct {
+    uint16_t start;
+    uint16_t end;
+    uint8_t  category;
+} keycode_range_category_t;
+
+// Sorted by start; the feature guards thin the table without breaking the ordering.
+static const keycode_range_category_t extended_keycode_categories[] PROGMEM = {
+    {QK_MODS, QK_MODS_MAX, ACT_CAT_MODS},
+    {QK_MOD_TAP, QK_MOD_TAP_MAX, ACT_CAT_MOD_TAP},
+    {QK_LAYER_TAP, QK_LAYER_TAP_MAX, ACT_CAT_LAYER_TAP},
+#    ifndef NO_ACTION_LAYER
+    {QK_LAYER_MOD, QK_LAYER_MOD_MAX, ACT_CAT_LAYER_MOD},
+    {QK_TO, QK_TO_MAX, ACT_CAT_LAYER_GOTO},
+    {QK_MOMENTARY, QK_MOMENTARY_MAX, ACT_CAT_LAYER_MOMENTARY},
+    {QK_DEF_LAYER, QK_DEF_LAYER_MAX, ACT_CAT_DEFAULT_LAYER},
+    {QK_TOGGLE_LAYER, QK_TOGGLE_LAYER_MAX, ACT_CAT_LAYER_TOGGLE},
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+    {QK_ONE_SHOT_LAYER, QK_ONE_SHOT_LAYER_MAX, ACT_CAT_ONE_SHOT_LAYER},
+#    endif
+    {QK_ONE_SHOT_MOD, QK_ONE_SHOT_MOD_MAX, ACT_CAT_ONE_SHOT_MOD},
+#    ifndef NO_ACTION_LAYER
+    {QK_LAYER_TAP_TOGGLE, QK_LAYER_TAP_TOGGLE_MAX, ACT_CAT_LAYER_TAP_TOGGLE},
+#    endif
+#    ifdef SWAP_HANDS_ENABLE
+    {QK_SWAP_HANDS, QK_SWAP_HANDS_MAX, ACT_CAT_SWAP_HANDS},
+#    endif
+};
+
+static uint8_t keycode_category(uint16_t keycode) {
+    if (keycode < 0x100) {
+        return pgm_read_byte(&basic_keycode_category[keycode]);
+    }
+    for (uint8_t i = 0; i < ARRAY_SIZE(extended_keycode_categories); i++) {
+        if (keycode < pgm_read_word(&extended_keycode_categories[i].start)) {
+            break; // sorted; can't match any later range
+        }
+        if (keycode <= pgm_read_word(&extended_keycode_categories[i].end)) {
+            return pgm_read_byte(&extended_keycode_categories[i].category);
+        }
+    }
+    return ACT_CAT_NONE;
+}
+
+action_t action_for_keycode(uint16_t keycode) {
+    // keycode remapping
+    keycode = keycode_config(keycode);
+
+    action_t action = {};
+    uint8_t  action_layer, mod;
+
+    (void)action_layer;
+    (void)mod;
+
+    switch (keycode_category(keycode)) {
+        case ACT_CAT_KEY:
+            action.code = ACTION_KEY(keycode);
+            break;
+#    ifdef EXTRAKEY_ENABLE
+        case ACT_CAT_SYSTEM:
+            action.code = ACTION_USAGE_SYSTEM(KEYCODE2SYSTEM(keycode));
+            break;
+        case ACT_CAT_CONSUMER:
+            action.code = ACTION_USAGE_CONSUMER(KEYCODE2CONSUMER(keycode));
+            break;
+#    endif
+        case ACT_CAT_MOUSE:
+            action.code = ACTION_MOUSEKEY(keycode);
+            break;
+        case ACT_CAT_TRANSPARENT:
+            action.code = ACTION_TRANSPARENT;
+            break;
+        case ACT_CAT_MODS:
+#    ifdef LEGACY_MAGIC_HANDLING
+            action.code = ACTION_MODS_KEY(QK_MODS_GET_MODS(keycode), QK_MODS_GET_BASIC_KEYCODE(keycode)); // adds modifier to key
+#    else                                                                                                 // LEGACY_MAGIC_HANDLING
+            action.code = ACTION_MODS_KEY(mod_config(QK_MODS_GET_MODS(keycode)), keycode_config(QK_MODS_GET_BASIC_KEYCODE(keycode))); // adds modifier to key
+#    endif                                                                                                // LEGACY_MAGIC_HANDLING
+            break;
+        case ACT_CAT_LAYER_TAP:
+#    if !defined(NO_ACTION_LAYER) && !defined(NO_ACTION_TAPPING)
+#        ifdef LEGACY_MAGIC_HANDLING
+            action.code = ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+#        else  // LEGACY_MAGIC_HANDLING
+            action.code = ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
+#        endif // LEGACY_MAGIC_HANDLING
+#    else
+            // pass through keycode_config again, since it previously missed it
+            // and then only send as ACTION_KEY to bypass most of action.c handling
+            action.code = ACTION_KEY(keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
+#    endif
+            break;
+#    ifndef NO_ACTION_LAYER
+        case ACT_CAT_LAYER_GOTO:
+            action_layer = QK_TO_GET_LAYER(keycode);
+            action.code  = ACTION_LAYER_GOTO(action_layer);
+            break;
+        case ACT_CAT_LAYER_MOMENTARY:
+            action_layer = QK_MOMENTARY_GET_LAYER(keycode);
+            action.code  = ACTION_LAYER_MOMENTARY(action_layer);
+            break;
+        case ACT_CAT_DEFAULT_LAYER:
+            action_layer = QK_DEF_LAYER_GET_LAYER(keycode);
+            action.code  = ACTION_DEFAULT_LAYER_SET(action_layer);
+            break;
+        case ACT_CAT_LAYER_TOGGLE:
+            action_layer = QK_TOGGLE_LAYER_GET_LAYER(keycode);
+            action.code  = ACTION_LAYER_TOGGLE(action_layer);
+            break;
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+        case ACT_CAT_ONE_SHOT_LAYER:
+            action_layer = QK_ONE_SHOT_LAYER_GET_LAYER(keycode);
+            action.code  = ACTION_LAYER_ONESHOT(action_layer);
+            break;
+#    endif // NO_ACTION_ONESHOT
+        case ACT_CAT_ONE_SHOT_MOD:
+            mod = mod_config(QK_ONE_SHOT_MOD_GET_MODS(keycode));
+#    if defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
+            action.code = ACTION_MODS(mod);
+#    else  // defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
+            action.code = ACTION_MODS_ONESHOT(mod);
+#    endif // defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
+            break;
+#    ifndef NO_ACTION_LAYER
+        case ACT_CAT_LAYER_TAP_TOGGLE:
+#        ifndef NO_ACTION_TAPPING
+            action.code = ACTION_LAYER_TAP_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+#        else // NO_ACTION_TAPPING
+#            ifdef NO_ACTION_TAPPING_TAP_TOGGLE_MO
+            action.code = ACTION_LAYER_MOMENTARY(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+#            else  // NO_ACTION_TAPPING_TAP_TOGGLE_MO
+            action.code = ACTION_LAYER_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+#            endif // NO_ACTION_TAPPING_TAP_TOGGLE_MO
+#        endif     // NO_ACTION_TAPPING
+            break;
+        case ACT_CAT_LAYER_MOD:
+            mod          = mod_config(QK_LAYER_MOD_GET_MODS(keycode));
+            action_layer = QK_LAYER_MOD_GET_LAYER(keycode);
+            action.code  = ACTION_LAYER_MODS(action_layer, (mod & 0x10) ? (mod & 0xF) << 4 : mod);
+            break;
+#    endif // NO_ACTION_LAYER
+        case ACT_CAT_MOD_TAP:
+#    ifndef NO_ACTION_TAPPING
+            mod = mod_config(QK_MOD_TAP_GET_MODS(keycode));
+#        ifdef LEGACY_MAGIC_HANDLING
+            action.code = ACTION_MODS_TAP_KEY(mod, QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+#        else  // LEGACY_MAGIC_HANDLING
+            action.code = ACTION_MODS_TAP_KEY(mod, keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
+#        endif // LEGACY_MAGIC_HANDLING
+#    else      // NO_ACTION_TAPPING
+#        ifdef NO_ACTION_TAPPING_MODTAP_MODS
+            // pass through mod_config again, since it previously missed it
+            // and then only send as ACTION_KEY to bypass most of action.c handling
+            action.code = ACTION_MODS(mod_config(QK_MOD_TAP_GET_MODS(keycode)));
+#        else  // NO_ACTION_TAPPING_MODTAP_MODS
+               // pass through keycode_config again, since it previously missed it
+               // and then only send as ACTION_KEY to bypass most of action.c handling
+            action.code = ACTION_KEY(keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
+#        endif // NO_ACTION_TAPPING_MODTAP_MODS
+#    endif     // NO_ACTION_TAPPING
+            break;
+#    ifdef SWAP_HANDS_ENABLE
+        case ACT_CAT_SWAP_HANDS:
+#        ifdef LEGACY_MAGIC_HANDLING
+            action.code = ACTION(ACT_SWAP_HANDS, QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode));
+#        else  // LEGACY_MAGIC_HANDLING
+            action.code = ACTION(ACT_SWAP_HANDS, keycode_config(QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode)));
+#        endif // LEGACY_MAGIC_HANDLING
+            break;
+#    endif
+
+        default:
+            action.code = ACTION_NO;
+            break;
+    }
+    return action;
+}
+
+#else // ACTION_CATEGORY_LUT
+
 action_t action_for_keycode(uint16_t keycode) {
     // keycode remapping
     keycode = keycode_config(keycode);
@@ -196,6 +422,8 @@ action_t action_for_keycode(uint16_t keycode) {
     return action;
 }
 
+#endif // ACTION_CATEGORY_LUT
+
 // translates key to keycode
 __attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
     if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
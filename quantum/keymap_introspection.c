@@ -26,9 +26,18 @@ uint8_t keymap_layer_count_raw(void) {
     return NUM_KEYMAP_LAYERS_RAW;
 }
 
+#if defined(INTROSPECTION_LAYER_COUNT)
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+#        error KEYMAP_INTROSPECTION_CONSTANTS pins the layer count at build time, which DYNAMIC_KEYMAP_ENABLE breaks.
+#    endif
+// The accessor is a static inline in keymap_introspection.h returning this literal; a wrong scan
+// result must fail here rather than ship.
+STATIC_ASSERT(INTROSPECTION_LAYER_COUNT == NUM_KEYMAP_LAYERS_RAW, "Scanned layer count does not match the keymap; see util/introspection_counts.py");
+#else
 __attribute__((weak)) uint8_t keymap_layer_count(void) {
     return keymap_layer_count_raw();
 }
+#endif // defined(INTROSPECTION_LAYER_COUNT)
 
 #ifdef DYNAMIC_KEYMAP_ENABLE
 STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exceeds maximum set by DYNAMIC_KEYMAP_LAYER_COUNT");
@@ -36,9 +45,82 @@ STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers excee
 STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exceeds maximum set by LAYER_STATE_(8|16|32)BIT");
 #endif
 
+#ifdef KEYMAP_SPARSE
+
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+#        error KEYMAP_SPARSE requires the keymap to be static, which DYNAMIC_KEYMAP_ENABLE breaks.
+#    endif
+
+// Build-time generated sparse keymap tables (see builddefs/sparse_keymap.mk): a column
+// bitmap per layer-row plus a packed array of only the stored keycodes. The lookups below
+// replace every dense keymaps[] read in this file, leaving keymaps[] itself unreferenced
+// so the linker's --gc-sections drops the dense copy from flash.
+#    include "sparse_keymap.h"
+
+STATIC_ASSERT(SPARSE_KEYMAP_LAYER_COUNT == NUM_KEYMAP_LAYERS_RAW, "Generated sparse keymap layer count does not match the keymap; see util/sparse_keymap.py");
+
+// Two dependent loads: the row entry (bitmap plus packed base), then the keycode at the
+// base plus the count of stored columns below the requested one. Bounds are the callers'
+// responsibility, matching the dense reads this replaces.
+static uint16_t keycode_at_sparse_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    const sparse_keymap_row_t *entry = &sparse_keymap_rows[layer_num][row];
+    uint16_t                   bits  = pgm_read_word(&entry->bits);
+    uint16_t                   bit   = (uint16_t)1 << column;
+    if (!(bits & bit)) {
+        return KC_TRNS;
+    }
+    return pgm_read_word(&sparse_keymap_keycodes[pgm_read_word(&entry->base) + __builtin_popcount(bits & (bit - 1))]);
+}
+
+#endif // KEYMAP_SPARSE
+
+#ifdef KEYMAP_LAYER_SRAM_CACHE
+
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+#        error KEYMAP_LAYER_SRAM_CACHE requires the keymap to be static, which DYNAMIC_KEYMAP_ENABLE breaks.
+#    endif
+
+// SRAM copy of the highest active layer's key table, reloaded on layer state
+// change (see active_layer_cache_refresh). On XIP-flash targets like RP2040
+// this pins the hot layer's lookups in SRAM, bounding key resolution time
+// regardless of XIP cache pressure from e.g. display asset streaming.
+static uint16_t keymap_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  keymap_layer_cache_num = UINT8_MAX;
+
+void keymap_layer_cache_load(uint8_t layer_num) {
+    if (layer_num == keymap_layer_cache_num) {
+        return;
+    }
+    if (layer_num >= NUM_KEYMAP_LAYERS_RAW) {
+        // Layers beyond the keymap read as KC_TRNS through the raw path
+        keymap_layer_cache_num = UINT8_MAX;
+        return;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+#    ifdef KEYMAP_SPARSE
+            keymap_layer_cache[row][column] = keycode_at_sparse_location(layer_num, row, column);
+#    else
+            keymap_layer_cache[row][column] = pgm_read_word(&keymaps[layer_num][row][column]);
+#    endif
+        }
+    }
+    keymap_layer_cache_num = layer_num;
+}
+#endif // KEYMAP_LAYER_SRAM_CACHE
+
 uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
+#ifdef KEYMAP_LAYER_SRAM_CACHE
+    if (layer_num == keymap_layer_cache_num && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        return keymap_layer_cache[row][column];
+    }
+#endif
     if (layer_num < NUM_KEYMAP_LAYERS_RAW && row < MATRIX_ROWS && column < MATRIX_COLS) {
+#ifdef KEYMAP_SPARSE
+        return keycode_at_sparse_location(layer_num, row, column);
+#else
         return pgm_read_word(&keymaps[layer_num][row][column]);
+#endif
     }
     return KC_TRNS;
 }
@@ -47,6 +129,59 @@ __attribute__((weak)) uint16_t keycode_at_keymap_location(uint8_t layer_num, uin
     return keycode_at_keymap_location_raw(layer_num, row, column);
 }
 
+#ifdef KEYMAP_FLATTENING
+
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+#        error KEYMAP_FLATTENING requires the keymap to be static, which DYNAMIC_KEYMAP_ENABLE breaks.
+#    endif
+
+#    ifdef KEYMAP_SPARSE
+
+// The generated sparse row entries already carry a per-layer-row opacity bitmap, so
+// answer from those directly instead of flattening a RAM copy on first use.
+bool keymap_location_is_opaque(uint8_t layer_num, uint8_t row, uint8_t column) {
+    if (layer_num >= NUM_KEYMAP_LAYERS_RAW) {
+        return false; // Layers beyond the keymap read as KC_TRNS
+    }
+    return pgm_read_word(&sparse_keymap_rows[layer_num][row].bits) & ((uint16_t)1 << column);
+}
+
+#    else
+
+// Per-layer opacity bitmaps, flattened from the keymap on first use. With a
+// static keymap, whether a location is transparent is fixed, so the per-event
+// layer walk in layer_switch_get_layer() can test one bit per active layer
+// instead of resolving a full action from PROGMEM per layer.
+static uint8_t keymap_opacity[NUM_KEYMAP_LAYERS_RAW][MATRIX_ROWS][(MATRIX_COLS + 7) / 8];
+static bool    keymap_opacity_ready = false;
+
+static void keymap_opacity_flatten(void) {
+    for (uint8_t layer = 0; layer < NUM_KEYMAP_LAYERS_RAW; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (keycode_at_keymap_location_raw(layer, row, col) != KC_TRNS) {
+                    keymap_opacity[layer][row][col / 8] |= 1 << (col % 8);
+                }
+            }
+        }
+    }
+    keymap_opacity_ready = true;
+}
+
+bool keymap_location_is_opaque(uint8_t layer_num, uint8_t row, uint8_t column) {
+    if (!keymap_opacity_ready) {
+        keymap_opacity_flatten();
+    }
+    if (layer_num >= NUM_KEYMAP_LAYERS_RAW) {
+        return false; // Layers beyond the keymap read as KC_TRNS
+    }
+    return keymap_opacity[layer_num][row][column / 8] & (1 << (column % 8));
+}
+
+#    endif // KEYMAP_SPARSE
+
+#endif // KEYMAP_FLATTENING
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -103,9 +238,13 @@ __attribute__((weak)) uint16_t keycode_at_dip_switch_map_location(uint8_t switch
 uint16_t combo_count_raw(void) {
     return ARRAY_SIZE(key_combos);
 }
+#if defined(INTROSPECTION_COMBO_COUNT)
+STATIC_ASSERT(INTROSPECTION_COMBO_COUNT == ARRAY_SIZE(key_combos), "Scanned combo count does not match the keymap; see util/introspection_counts.py");
+#else
 __attribute__((weak)) uint16_t combo_count(void) {
     return combo_count_raw();
 }
+#endif // defined(INTROSPECTION_COMBO_COUNT)
 
 STATIC_ASSERT(ARRAY_SIZE(key_combos) <= (QK_KB), "Number of combos is abnormally high. Are you using SAFE_RANGE in an enum for combos?");
 
@@ -119,8 +258,49 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+static uint32_t combo_key_filters[ARRAY_SIZE(key_combos)];
+static bool     combo_key_filters_generated = false;
+
+uint32_t combo_key_filter(uint16_t combo_idx) {
+    if (!combo_key_filters_generated) {
+        for (uint16_t i = 0; i < ARRAY_SIZE(key_combos) && i < combo_count(); ++i) {
+            combo_t* combo  = combo_get(i);
+            uint32_t filter = 0;
+            for (uint8_t j = 0;; ++j) {
+                uint16_t key = pgm_read_word(&combo->keys[j]);
+                if (key == COMBO_END) {
+                    break;
+                }
+                filter |= combo_key_filter_bit(key);
+            }
+            combo_key_filters[i] = filter;
+        }
+        combo_key_filters_generated = true;
+    }
+    if (combo_idx >= ARRAY_SIZE(key_combos)) {
+        // Combos beyond the firmware-defined set come from an overridden combo_get() -- treat them as
+        // candidates for every keycode rather than guessing at their contents.
+        return UINT32_MAX;
+    }
+    return combo_key_filters[combo_idx];
+}
+
 #endif // defined(COMBO_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TRIE)
+
+uint16_t leader_sequence_def_count_raw(void) {
+    return ARRAY_SIZE(leader_sequences);
+}
+__attribute__((weak)) uint16_t leader_sequence_def_count(void) {
+    return leader_sequence_def_count_raw();
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TRIE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tap Dance
 
@@ -130,9 +310,13 @@ uint16_t tap_dance_count_raw(void) {
     return ARRAY_SIZE(tap_dance_actions);
 }
 
+#if defined(INTROSPECTION_TAP_DANCE_COUNT)
+STATIC_ASSERT(INTROSPECTION_TAP_DANCE_COUNT == ARRAY_SIZE(tap_dance_actions), "Scanned tap dance count does not match the keymap; see util/introspection_counts.py");
+#else
 __attribute__((weak)) uint16_t tap_dance_count(void) {
     return tap_dance_count_raw();
 }
+#endif // defined(INTROSPECTION_TAP_DANCE_COUNT)
 
 STATIC_ASSERT(ARRAY_SIZE(tap_dance_actions) <= (QK_TAP_DANCE_MAX - QK_TAP_DANCE), "Number of tap dance actions exceeds maximum. Are you using SAFE_RANGE in tap dance enum?");
 
@@ -10,14 +10,35 @@
 
 // Get the number of layers defined in the keymap, stored in firmware rather than any other persistent storage
 uint8_t keymap_layer_count_raw(void);
+#if defined(INTROSPECTION_LAYER_COUNT)
+// Layer count scanned from the keymap source at build time (see builddefs/introspection_counts.mk);
+// returning the literal inline lets callers constant-fold loop bounds and dead-strip guard branches
+static inline uint8_t keymap_layer_count(void) {
+    return INTROSPECTION_LAYER_COUNT;
+}
+#else
 // Get the number of layers defined in the keymap, potentially stored dynamically
 uint8_t keymap_layer_count(void);
+#endif // defined(INTROSPECTION_LAYER_COUNT)
 
 // Get the keycode for the keymap location, stored in firmware rather than any other persistent storage
 uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column);
 // Get the keycode for the keymap location, potentially stored dynamically
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column);
 
+#if defined(KEYMAP_FLATTENING)
+// Whether the keymap location resolves to something other than KC_TRNS, answered from
+// per-layer bitmaps flattened from the static keymap (single indexed load per layer)
+bool keymap_location_is_opaque(uint8_t layer_num, uint8_t row, uint8_t column);
+#endif // defined(KEYMAP_FLATTENING)
+
+#if defined(KEYMAP_LAYER_SRAM_CACHE)
+// Copy the given layer's key table into the SRAM cache; lookups for that layer are then
+// served from SRAM instead of XIP flash. Invoked on layer state change; no-op if the
+// layer is already cached
+void keymap_layer_cache_load(uint8_t layer_num);
+#endif // defined(KEYMAP_LAYER_SRAM_CACHE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -58,16 +79,44 @@ typedef struct combo_t combo_t;
 
 // Get the number of combos defined in the user's keymap, stored in firmware rather than any other persistent storage
 uint16_t combo_count_raw(void);
+#if defined(INTROSPECTION_COMBO_COUNT)
+// Combo count scanned from the keymap source at build time (see builddefs/introspection_counts.mk)
+static inline uint16_t combo_count(void) {
+    return INTROSPECTION_COMBO_COUNT;
+}
+#else
 // Get the number of combos defined in the user's keymap, potentially stored dynamically
 uint16_t combo_count(void);
+#endif // defined(INTROSPECTION_COMBO_COUNT)
 
 // Get the combo definition, stored in firmware rather than any other persistent storage
 combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the combo definition, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+// The filter bit a keycode contributes to a combo's key-membership filter
+static inline uint32_t combo_key_filter_bit(uint16_t keycode) {
+    return ((uint32_t)1) << ((keycode ^ (keycode >> 5)) & 31);
+}
+
+// Get the key-membership filter for a combo -- if `combo_key_filter_bit(keycode)` isn't set in it, the keycode
+// is definitely not part of the combo. False positives are possible and must fall through to a full key check.
+uint32_t combo_key_filter(uint16_t combo_idx);
+
 #endif // defined(COMBO_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TRIE)
+
+// Get the number of leader sequences defined in the keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_sequence_def_count_raw(void);
+// Get the number of leader sequences defined in the keymap, potentially stored dynamically
+uint16_t leader_sequence_def_count(void);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TRIE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tap Dance
 
@@ -79,8 +128,15 @@ typedef struct tap_dance_action_t tap_dance_action_t;
 
 // Get the number of tap dances defined in the user's keymap, stored in firmware rather than any other persistent storage
 uint16_t tap_dance_count_raw(void);
+#if defined(INTROSPECTION_TAP_DANCE_COUNT)
+// Tap dance count scanned from the keymap source at build time (see builddefs/introspection_counts.mk)
+static inline uint16_t tap_dance_count(void) {
+    return INTROSPECTION_TAP_DANCE_COUNT;
+}
+#else
 // Get the number of tap dances defined in the user's keymap, potentially stored dynamically
 uint16_t tap_dance_count(void);
+#endif // defined(INTROSPECTION_TAP_DANCE_COUNT)
 
 // Get the tap dance definitions, stored in firmware rather than any other persistent storage
 tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
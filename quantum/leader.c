@@ -2,7 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
-#include "timer.h"
+#include "key_wait_buffer.h"
 #include "util.h"
 
 #include <string.h>
@@ -12,11 +12,111 @@
 #endif
 
 // Leader key stuff
-bool     leading              = false;
-uint16_t leader_time          = 0;
+bool leading = false;
+
+// The sequence timeout, on the shared pending-key engine's deadline primitive.
+static key_wait_deadline_t leader_deadline = {0, LEADER_TIMEOUT};
+
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_TRIE
+#    include "keymap_introspection.h"
+
+#    ifndef LEADER_TRIE_MAX_NODES
+#        define LEADER_TRIE_MAX_NODES 64
+#    endif
+
+// Trie over the keymap's declarative leader_sequences[] table, built lazily on the first
+// leader_start(). Node references are index + 1 so that 0 doubles as "none"; the implicit root is
+// represented by reference 0 with its child list head kept separately.
+typedef struct leader_trie_node_t {
+    uint16_t keycode;
+    uint8_t  first_child;  // node reference; 0 = leaf
+    uint8_t  next_sibling; // node reference; 0 = end of the sibling list
+    uint8_t  sequence;     // sequence index + 1 for terminal nodes; 0 = not terminal
+} leader_trie_node_t;
+
+static leader_trie_node_t leader_trie[LEADER_TRIE_MAX_NODES];
+static uint8_t            leader_trie_nodes_used = 0;
+static uint8_t            leader_trie_root       = 0; // child list head of the implicit root
+static uint8_t            leader_trie_pos        = 0; // current node reference; 0 = at the root
+static bool               leader_trie_built      = false;
+static bool               leader_trie_ok         = false;
+
+static uint8_t leader_trie_find_child(uint8_t parent, uint16_t keycode) {
+    uint8_t child = parent ? leader_trie[parent - 1].first_child : leader_trie_root;
+    while (child) {
+        if (leader_trie[child - 1].keycode == keycode) {
+            return child;
+        }
+        child = leader_trie[child - 1].next_sibling;
+    }
+    return 0;
+}
+
+static void leader_trie_build(void) {
+    leader_trie_built = true;
+    leader_trie_ok    = true;
+    for (uint16_t i = 0; i < leader_sequence_def_count(); i++) {
+        const leader_sequence_def_t *def    = &leader_sequences[i];
+        uint8_t                      parent = 0;
+        for (uint8_t j = 0; j < ARRAY_SIZE(def->keys) && def->keys[j] != 0; j++) {
+            uint8_t node = leader_trie_find_child(parent, def->keys[j]);
+            if (!node) {
+                if (leader_trie_nodes_used >= LEADER_TRIE_MAX_NODES) {
+                    // Node pool exhausted (raise LEADER_TRIE_MAX_NODES) -- fall back to the
+                    // classic leader_add_user()/leader_end_user() matching path.
+                    leader_trie_ok = false;
+                    return;
+                }
+                leader_trie[leader_trie_nodes_used] = (leader_trie_node_t){.keycode = def->keys[j]};
+                node                                = ++leader_trie_nodes_used;
+                if (parent) {
+                    leader_trie[node - 1].next_sibling  = leader_trie[parent - 1].first_child;
+                    leader_trie[parent - 1].first_child = node;
+                } else {
+                    leader_trie[node - 1].next_sibling = leader_trie_root;
+                    leader_trie_root                   = node;
+                }
+            }
+            parent = node;
+        }
+        if (parent && leader_trie[parent - 1].sequence == 0) {
+            leader_trie[parent - 1].sequence = (uint8_t)(i + 1);
+        }
+    }
+}
+
+// Advance the matcher by one keypress. Returns false when the accumulated prefix can no longer
+// match any sequence; fires the callback and ends the sequence on an unambiguous terminal hit.
+static bool leader_trie_step(uint16_t keycode) {
+    uint8_t node = leader_trie_find_child(leader_trie_pos, keycode);
+    if (!node) {
+        return false;
+    }
+    leader_trie_pos = node;
+
+    uint8_t seq = leader_trie[node - 1].sequence;
+    if (seq && leader_trie[node - 1].first_child == 0) {
+        leader_sequences[seq - 1].callback();
+        leader_end();
+    }
+    return true;
+}
+
+// Fires a sequence that completed but is a prefix of a longer one -- invoked at timeout, when it
+// is clear no further keys are coming.
+static void leader_trie_fire_pending(void) {
+    if (leader_trie_ok && leader_trie_pos) {
+        uint8_t seq = leader_trie[leader_trie_pos - 1].sequence;
+        if (seq) {
+            leader_sequences[seq - 1].callback();
+        }
+    }
+}
+#endif // LEADER_TRIE
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -30,10 +130,16 @@ void leader_start(void) {
         return;
     }
     leader_start_user();
-    leading              = true;
-    leader_time          = timer_read();
+    leading = true;
+    key_wait_deadline_start(&leader_deadline);
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TRIE
+    if (!leader_trie_built) {
+        leader_trie_build();
+    }
+    leader_trie_pos = 0;
+#endif
 }
 
 void leader_end(void) {
@@ -43,6 +149,9 @@ void leader_end(void) {
 
 void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
+#ifdef LEADER_TRIE
+        leader_trie_fire_pending();
+#endif
         leader_end();
     }
 }
@@ -65,6 +174,13 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_TRIE
+    if (leader_trie_ok) {
+        // Single node transition per keypress; an impossible prefix aborts the sequence right away
+        // instead of waiting out the timer.
+        return leader_trie_step(keycode);
+    }
+#endif
     if (leader_add_user(keycode)) {
         leader_end();
     }
@@ -73,14 +189,14 @@ bool leader_sequence_add(uint16_t keycode) {
 
 bool leader_sequence_timed_out(void) {
 #if defined(LEADER_NO_TIMEOUT)
-    return leader_sequence_size > 0 && timer_elapsed(leader_time) > LEADER_TIMEOUT;
+    return leader_sequence_size > 0 && key_wait_deadline_expired(&leader_deadline);
 #else
-    return timer_elapsed(leader_time) > LEADER_TIMEOUT;
+    return key_wait_deadline_expired(&leader_deadline);
 #endif
 }
 
 void leader_reset_timer(void) {
-    leader_time = timer_read();
+    key_wait_deadline_start(&leader_deadline);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
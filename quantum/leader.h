@@ -125,4 +125,28 @@ bool leader_sequence_four_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_
  */
 bool leader_sequence_five_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5);
 
+#ifdef LEADER_TRIE
+/**
+ * \brief Declarative leader sequence: up to five keycodes (zero-padded when shorter) and the
+ * callback to fire when the sequence completes.
+ *
+ * Declare the full set in the keymap as `const leader_sequence_def_t leader_sequences[]`; the
+ * matcher builds a trie over it on first use and advances one node per keypress, ending the
+ * sequence as soon as the accumulated prefix can no longer match anything. Sequences that are a
+ * prefix of a longer sequence fire on timeout instead of immediately.
+ */
+typedef struct leader_sequence_def_t {
+    uint16_t keys[5];
+    void (*callback)(void);
+} leader_sequence_def_t;
+
+/**
+ * \brief Convenience initializer for a leader_sequence_def_t entry.
+ */
+#    define LEADER_SEQUENCE(cb, ...) \
+        { .keys = {__VA_ARGS__}, .callback = (cb) }
+
+extern const leader_sequence_def_t leader_sequences[];
+#endif // LEADER_TRIE
+
 /** \} */
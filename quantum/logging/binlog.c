@@ -0,0 +1,91 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "binlog.h"
+#include "sendchar.h"
+#include "atomic_util.h"
+
+#if (BINLOG_RING_SIZE & (BINLOG_RING_SIZE - 1)) != 0
+#    error "BINLOG_RING_SIZE must be a power of two"
+#endif
+
+#define BINLOG_MASK (BINLOG_RING_SIZE - 1)
+
+// Marker nibble in the record header byte; low two bits carry the argument count,
+// 0xB3 is the out-of-band drop report
+#define BINLOG_MARKER 0xB0
+#define BINLOG_DROP_REPORT (BINLOG_MARKER | 0x03)
+
+static uint8_t binlog_ring[BINLOG_RING_SIZE];
+// Head/tail are free-running indices masked on access; emit happens from any context,
+// draining only from the main loop
+static volatile uint16_t binlog_head = 0;
+static volatile uint16_t binlog_tail = 0;
+static volatile uint16_t binlog_dropped = 0;
+
+uint16_t binlog_dropped_count(void) {
+    return binlog_dropped;
+}
+
+void binlog_emit(const char *site, uint8_t nargs, uint16_t arg0, uint16_t arg1) {
+    uint8_t record[9];
+    uint8_t len = 0;
+
+    record[len++] = BINLOG_MARKER | (nargs & 0x03);
+
+    // Site id is the format string's flash address; the host decoder resolves it
+    // against the .binlog_fmt section of the ELF
+    uint32_t id   = (uint32_t)(uintptr_t)site;
+    record[len++] = (uint8_t)(id & 0xFF);
+    record[len++] = (uint8_t)((id >> 8) & 0xFF);
+    record[len++] = (uint8_t)((id >> 16) & 0xFF);
+    record[len++] = (uint8_t)((id >> 24) & 0xFF);
+
+    if (nargs >= 1) {
+        record[len++] = (uint8_t)(arg0 & 0xFF);
+        record[len++] = (uint8_t)(arg0 >> 8);
+    }
+    if (nargs >= 2) {
+        record[len++] = (uint8_t)(arg1 & 0xFF);
+        record[len++] = (uint8_t)(arg1 >> 8);
+    }
+
+    ATOMIC_BLOCK_RESTORESTATE {
+        uint16_t used = binlog_head - binlog_tail;
+        if ((uint16_t)(BINLOG_RING_SIZE - used) < len) {
+            // Never block a hot path on a slow console; drop and account
+            binlog_dropped++;
+        } else {
+            uint16_t head = binlog_head;
+            for (uint8_t i = 0; i < len; i++) {
+                binlog_ring[head++ & BINLOG_MASK] = record[i];
+            }
+            binlog_head = head;
+        }
+    }
+}
+
+void binlog_task(void) {
+    // Announce any overflow first so the host sees the gap where it happened
+    if (binlog_dropped > 0) {
+        uint16_t dropped;
+        ATOMIC_BLOCK_RESTORESTATE {
+            dropped        = binlog_dropped;
+            binlog_dropped = 0;
+        }
+        sendchar(BINLOG_DROP_REPORT);
+        sendchar((uint8_t)(dropped & 0xFF));
+        sendchar((uint8_t)(dropped >> 8));
+    }
+
+    // Only the head snapshot needs to be consistent; emit never moves the tail
+    uint16_t head = binlog_head;
+    uint16_t tail = binlog_tail;
+    uint8_t  sent = 0;
+
+    while (tail != head && sent < BINLOG_DRAIN_CHUNK) {
+        sendchar(binlog_ring[tail++ & BINLOG_MASK]);
+        sent++;
+    }
+    binlog_tail = tail;
+}
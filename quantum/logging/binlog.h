@@ -0,0 +1,87 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup binlog Deferred-format binary logging
+ *
+ * \brief Trace records with host-side formatting, cheap enough for hot paths.
+ *
+ * dprintf() formats on-device: a single call in a hot path costs hundreds of microseconds of string rendering
+ * before a byte reaches the console. A binlog site instead appends a few-byte binary record -- the address of its
+ * format string plus up to two 16-bit arguments -- to a ring buffer, typically tens of cycles, so tracing can stay
+ * compiled into production firmware. The ring is drained through the regular console endpoint by binlog_task();
+ * the host decoder matches each record's site id against the format strings it extracts from the firmware ELF
+ * (the strings are collected in the .binlog_fmt section and never stored in RAM or sent over the wire).
+ *
+ * Record framing, least significant byte first:
+ *   [0xB0 | nargs] [site id, 4 bytes] [nargs x 16-bit argument]
+ *   [0xB3] [dropped count, 2 bytes]   -- emitted after ring overflow
+ * The 0xBn marker nibble lets the decoder resync if it attaches mid-stream or records interleave with stray
+ * dprintf() text.
+ * \{
+ */
+
+#ifdef BINLOG_ENABLE
+
+/** \brief Ring capacity in bytes. Must be a power of two. */
+#    ifndef BINLOG_RING_SIZE
+#        define BINLOG_RING_SIZE 256
+#    endif
+
+/** \brief Bytes pushed to the console per drain pass, bounding time spent in binlog_task(). */
+#    ifndef BINLOG_DRAIN_CHUNK
+#        define BINLOG_DRAIN_CHUNK 32
+#    endif
+
+// Format strings are gathered into their own ELF section so the host decoder can dump just that section; they are
+// flash-only and referenced by address at the log site.
+#    define BINLOG_SITE(fmt) \
+        ({ \
+            static const char _binlog_fmt[] __attribute__((section(".binlog_fmt"))) = fmt; \
+            _binlog_fmt; \
+        })
+
+/** \brief Log a plain message. */
+#    define BINLOG(fmt) binlog_emit(BINLOG_SITE(fmt), 0, 0, 0)
+
+/** \brief Log a message with one 16-bit argument. */
+#    define BINLOG1(fmt, a) binlog_emit(BINLOG_SITE(fmt), 1, (uint16_t)(a), 0)
+
+/** \brief Log a message with two 16-bit arguments. */
+#    define BINLOG2(fmt, a, b) binlog_emit(BINLOG_SITE(fmt), 2, (uint16_t)(a), (uint16_t)(b))
+
+/**
+ * \brief Append one record to the ring. Safe from any context, including interrupts; drops the record (and counts
+ * the drop) if the ring is full rather than blocking.
+ */
+void binlog_emit(const char *site, uint8_t nargs, uint16_t arg0, uint16_t arg1);
+
+/**
+ * \brief Drain ring contents to the console endpoint. Called from the main loop; bounded by BINLOG_DRAIN_CHUNK.
+ */
+void binlog_task(void);
+
+/** \brief Records lost to ring overflow since the last drop report went out. */
+uint16_t binlog_dropped_count(void);
+
+#else // BINLOG_ENABLE
+
+#    define BINLOG(fmt) \
+        do { \
+        } while (0)
+#    define BINLOG1(fmt, a) \
+        do { \
+        } while (0)
+#    define BINLOG2(fmt, a, b) \
+        do { \
+        } while (0)
+
+#endif // BINLOG_ENABLE
+
+/** \} */
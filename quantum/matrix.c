@@ -21,6 +21,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#include "ramfunc.h"
+
+#ifdef MATRIX_IDLE_SCAN
+#    include "timer.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -115,7 +120,7 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
-__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+__attribute__((weak)) RAMFUNC void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
 
@@ -168,7 +173,78 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
-__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+#            ifdef MATRIX_BATCHED_READS
+#                ifndef PROTOCOL_CHIBIOS
+#                    error MATRIX_BATCHED_READS requires port-level GPIO reads and is only supported on ChibiOS targets
+#                endif
+
+// Precomputed port/mask lookups so that each distinct input port is sampled once per row, instead of one GPIO read per column
+static ioportid_t   col_port_ids[MATRIX_COLS];
+static ioportmask_t col_port_masks[MATRIX_COLS];
+static uint8_t      col_port_index[MATRIX_COLS];
+static ioportid_t   unique_col_ports[MATRIX_COLS];
+static uint8_t      unique_col_port_count = 0;
+
+static void matrix_init_batched_reads(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin = col_pins[col];
+        if (pin == NO_PIN) {
+            continue;
+        }
+        col_port_ids[col]   = PAL_PORT(pin);
+        col_port_masks[col] = 1u << PAL_PAD(pin);
+
+        uint8_t idx;
+        for (idx = 0; idx < unique_col_port_count; idx++) {
+            if (unique_col_ports[idx] == col_port_ids[col]) {
+                break;
+            }
+        }
+        if (idx == unique_col_port_count) {
+            unique_col_ports[unique_col_port_count++] = col_port_ids[col];
+        }
+        col_port_index[col] = idx;
+    }
+}
+
+__attribute__((weak)) RAMFUNC void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    // Start with a clear matrix row
+    matrix_row_t current_row_value = 0;
+
+    if (!select_row(current_row)) { // Select row
+        return;                     // skip NO_PIN row
+    }
+    matrix_output_select_delay();
+
+    // Sample each distinct input port once -- on MCUs with all columns on one port (e.g. RP2040) this is a single read
+    ioportmask_t port_values[MATRIX_COLS];
+    for (uint8_t i = 0; i < unique_col_port_count; i++) {
+        port_values[i] = palReadPort(unique_col_ports[i]);
+    }
+
+    // Extract the state of each col pin from the sampled port values
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        if (col_pins[col_index] == NO_PIN) {
+            continue;
+        }
+        uint8_t pin_level = (port_values[col_port_index[col_index]] & col_port_masks[col_index]) ? 1 : 0;
+        if (pin_level == MATRIX_INPUT_PRESSED_STATE) {
+            current_row_value |= row_shifter;
+        }
+    }
+
+    // Unselect row
+    unselect_row(current_row);
+    matrix_output_unselect_delay(current_row, current_row_value != 0); // wait for all Col signals to go HIGH
+
+    // Update the matrix
+    current_matrix[current_row] = current_row_value;
+}
+
+#            else // MATRIX_BATCHED_READS
+
+__attribute__((weak)) RAMFUNC void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
 
@@ -194,6 +270,8 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            endif // MATRIX_BATCHED_READS
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -231,7 +309,7 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
-__attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter) {
+__attribute__((weak)) RAMFUNC void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter) {
     bool key_pressed = false;
 
     // Select col
@@ -266,6 +344,68 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_IDLE_SCAN
+#    ifndef PROTOCOL_CHIBIOS
+#        error MATRIX_IDLE_SCAN requires PAL line events and is only supported on ChibiOS targets
+#    endif
+#    ifdef SPLIT_KEYBOARD
+#        error MATRIX_IDLE_SCAN is not supported on split keyboards
+#    endif
+#    if defined(DIRECT_PINS) || (DIODE_DIRECTION != COL2ROW)
+#        error MATRIX_IDLE_SCAN requires a COL2ROW matrix
+#    endif
+
+// Milliseconds with no key down and no raw change before the matrix stops polling
+#    ifndef MATRIX_IDLE_SCAN_TIMEOUT
+#        define MATRIX_IDLE_SCAN_TIMEOUT 500
+#    endif
+
+// Idle/active state machine: once the matrix has been quiescent for the timeout,
+// every row is asserted simultaneously and each column pin is armed as a GPIO
+// edge interrupt, so an idle matrix costs zero scan CPU. The first edge on any
+// column sets the wake flag and the next matrix_scan() resumes normal polling,
+// which continues while any key is held (a held key keeps the matrix non-idle).
+static bool          matrix_idle           = false;
+static volatile bool matrix_wake_pending   = false;
+static uint16_t      matrix_activity_timer = 0;
+
+static void matrix_idle_wake_callback(void *arg) {
+    (void)arg;
+    matrix_wake_pending = true;
+}
+
+static void matrix_idle_enter(void) {
+    // Assert every row at once so a press on any key pulls its column to the
+    // pressed level regardless of which row it is on
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+
+    matrix_wake_pending = false;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] == NO_PIN) {
+            continue;
+        }
+        palSetLineCallback(col_pins[col], matrix_idle_wake_callback, NULL);
+        palEnableLineEvent(col_pins[col], MATRIX_INPUT_PRESSED_STATE ? PAL_EVENT_MODE_RISING_EDGE : PAL_EVENT_MODE_FALLING_EDGE);
+    }
+    matrix_idle = true;
+}
+
+static void matrix_idle_exit(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] == NO_PIN) {
+            continue;
+        }
+        palDisableLineEvent(col_pins[col]);
+    }
+    unselect_rows();
+    matrix_output_unselect_delay(0, false);
+    matrix_idle = false;
+}
+#endif // MATRIX_IDLE_SCAN
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -299,6 +439,11 @@ void matrix_init(void) {
     // initialize key pins
     matrix_init_pins();
 
+#if defined(MATRIX_BATCHED_READS) && !defined(DIRECT_PINS) && defined(DIODE_DIRECTION) && (DIODE_DIRECTION == COL2ROW)
+    // precompute port/mask lookups for batched row reads
+    matrix_init_batched_reads();
+#endif
+
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
@@ -316,7 +461,19 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
+RAMFUNC uint8_t matrix_scan(void) {
+#ifdef MATRIX_IDLE_SCAN
+    if (matrix_idle) {
+        if (!matrix_wake_pending) {
+            // Truly idle: no row walking, no column reads
+            matrix_scan_kb();
+            return 0;
+        }
+        matrix_idle_exit();
+        matrix_activity_timer = timer_read();
+    }
+#endif
+
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -341,5 +498,21 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, MATRIX_ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef MATRIX_IDLE_SCAN
+    bool any_pressed = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] || matrix[row]) {
+            any_pressed = true;
+            break;
+        }
+    }
+    if (changed || any_pressed) {
+        matrix_activity_timer = timer_read();
+    } else if (timer_elapsed(matrix_activity_timer) >= MATRIX_IDLE_SCAN_TIMEOUT) {
+        matrix_idle_enter();
+    }
+#endif
+
     return (uint8_t)changed;
 }
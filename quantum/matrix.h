@@ -63,6 +63,12 @@ bool matrix_can_read(void);
 bool matrix_is_on(uint8_t row, uint8_t col);
 /* matrix state on row */
 matrix_row_t matrix_get_row(uint8_t row);
+/* direct read-only view of the whole matrix as a packed matrix_row_t array, for
+ * word-wide compare/copy (a 36-key board's full state is two 32-bit words).
+ * NULL when no such view exists -- full custom matrix implementations, or
+ * MATRIX_MASKED boards whose rows need masking -- in which case callers must
+ * fall back to matrix_get_row(). */
+const matrix_row_t *matrix_get(void);
 /* print matrix for debug */
 void matrix_print(void);
 /* delay between changing matrix pin state and reading values */
@@ -65,6 +65,14 @@ inline matrix_row_t matrix_get_row(uint8_t row) {
 #endif
 }
 
+const matrix_row_t *matrix_get(void) {
+#ifdef MATRIX_MASKED
+    return NULL; // rows need masking on the way out; no directly comparable view
+#else
+    return matrix;
+#endif
+}
+
 #if (MATRIX_COLS <= 8)
 #    define print_matrix_header() print("\nr/c 01234567\n")
 #    define print_matrix_row(row) print_bin_reverse8(matrix_get_row(row))
@@ -24,6 +24,10 @@
 #include "debug.h"
 #include "mousekey.h"
 
+#if defined(MOUSEKEY_SUBPIXEL_ACCEL) && (defined(MK_3_SPEED) || defined(MK_COMBINED) || defined(MK_KINETIC_SPEED) || defined(MOUSEKEY_INERTIA))
+#    error "MOUSEKEY_SUBPIXEL_ACCEL is only supported by the default accelerated mode"
+#endif
+
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
     // because it is close to the exact value which is 0.707106781
@@ -175,6 +179,91 @@ static uint8_t wheel_unit(void) {
     return (unit > MOUSEKEY_WHEEL_MAX ? MOUSEKEY_WHEEL_MAX : (unit == 0 ? 1 : unit));
 }
 
+#        ifdef MOUSEKEY_SUBPIXEL_ACCEL
+
+/* Sub-pixel accelerated mode: the ramp slope is folded into a 16.16 fixed-point
+ * per-repeat increment that is recomputed only when the speed parameters change,
+ * so the per-tick path multiplies instead of dividing. The fractional part of
+ * each unit accumulates across ticks, turning the slow end of the curve into a
+ * steady sub-pixel drip rather than stair-stepped whole-pixel jumps. */
+
+static uint32_t mk_move_slope_fp   = 0;
+static uint32_t mk_wheel_slope_fp  = 0;
+static uint8_t  mk_slope_params[4] = {0, 0, 0, 0}; // max_speed/time_to_max pairs the slopes were computed from
+static int32_t  mk_frac_x = 0, mk_frac_y = 0, mk_frac_v = 0, mk_frac_h = 0;
+
+/* The speed parameters are plain globals that keymap code may adjust at runtime,
+ * so the slopes cannot be burned in at compile time; one division per parameter
+ * change is the next best thing. */
+static void mk_update_slopes(void) {
+    if (mk_slope_params[0] != mk_max_speed || mk_slope_params[1] != mk_time_to_max) {
+        mk_slope_params[0] = mk_max_speed;
+        mk_slope_params[1] = mk_time_to_max;
+        mk_move_slope_fp   = ((uint32_t)(MOUSEKEY_MOVE_DELTA * mk_max_speed) << 16) / (mk_time_to_max ? mk_time_to_max : 1);
+    }
+    if (mk_slope_params[2] != mk_wheel_max_speed || mk_slope_params[3] != mk_wheel_time_to_max) {
+        mk_slope_params[2] = mk_wheel_max_speed;
+        mk_slope_params[3] = mk_wheel_time_to_max;
+        mk_wheel_slope_fp  = ((uint32_t)(MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed) << 16) / (mk_wheel_time_to_max ? mk_wheel_time_to_max : 1);
+    }
+}
+
+static uint32_t move_unit_fp(void) {
+    uint32_t unit;
+    if (mousekey_accel & (1 << 0)) {
+        unit = (uint32_t)(MOUSEKEY_MOVE_DELTA * mk_max_speed) << 14;
+    } else if (mousekey_accel & (1 << 1)) {
+        unit = (uint32_t)(MOUSEKEY_MOVE_DELTA * mk_max_speed) << 15;
+    } else if (mousekey_accel & (1 << 2)) {
+        unit = (uint32_t)(MOUSEKEY_MOVE_DELTA * mk_max_speed) << 16;
+    } else if (mousekey_repeat == 0) {
+        unit = (uint32_t)MOUSEKEY_MOVE_DELTA << 16;
+    } else if (mousekey_repeat >= mk_time_to_max) {
+        unit = (uint32_t)(MOUSEKEY_MOVE_DELTA * mk_max_speed) << 16;
+    } else {
+        unit = mk_move_slope_fp * mousekey_repeat;
+    }
+    return unit > ((uint32_t)MOUSEKEY_MOVE_MAX << 16) ? ((uint32_t)MOUSEKEY_MOVE_MAX << 16) : unit;
+}
+
+static uint32_t wheel_unit_fp(void) {
+    uint32_t unit;
+    if (mousekey_accel & (1 << 0)) {
+        unit = (uint32_t)(MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed) << 14;
+    } else if (mousekey_accel & (1 << 1)) {
+        unit = (uint32_t)(MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed) << 15;
+    } else if (mousekey_accel & (1 << 2)) {
+        unit = (uint32_t)(MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed) << 16;
+    } else if (mousekey_wheel_repeat == 0) {
+        unit = (uint32_t)MOUSEKEY_WHEEL_DELTA << 16;
+    } else if (mousekey_wheel_repeat >= mk_wheel_time_to_max) {
+        unit = (uint32_t)(MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed) << 16;
+    } else {
+        unit = mk_wheel_slope_fp * mousekey_wheel_repeat;
+    }
+    return unit > ((uint32_t)MOUSEKEY_WHEEL_MAX << 16) ? ((uint32_t)MOUSEKEY_WHEEL_MAX << 16) : unit;
+}
+
+/* Accumulate a signed 16.16 unit and emit the whole part, keeping the fraction
+ * for the next tick. Clamping discards the leftover so a pegged axis doesn't
+ * bank motion that would replay after release. */
+static int8_t mk_subpixel_emit(int32_t *acc, uint32_t unit_fp, bool positive, int8_t limit) {
+    *acc += positive ? (int32_t)unit_fp : -(int32_t)unit_fp;
+    int32_t whole = *acc / 65536; // truncate toward zero so the fraction keeps the sign of travel
+    if (whole > limit) {
+        whole = limit;
+        *acc  = 0;
+    } else if (whole < -limit) {
+        whole = -limit;
+        *acc  = 0;
+    } else {
+        *acc -= whole * 65536;
+    }
+    return (int8_t)whole;
+}
+
+#        endif /* MOUSEKEY_SUBPIXEL_ACCEL */
+
 #        else /* #ifndef MK_KINETIC_SPEED */
 
 /*
@@ -341,6 +430,19 @@ void mousekey_task(void) {
 
     if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) > (mousekey_repeat ? mk_interval : mk_delay * 10)) {
         if (mousekey_repeat != UINT8_MAX) mousekey_repeat++;
+#        ifdef MOUSEKEY_SUBPIXEL_ACCEL
+        mk_update_slopes();
+        uint32_t unit_fp = move_unit_fp();
+        uint32_t ux = unit_fp, uy = unit_fp;
+
+        /* diagonal move [1/sqrt(2)], applied before accumulation so the fraction isn't lost */
+        if (tmpmr.x && tmpmr.y) {
+            ux = (ux * 181) >> 8;
+            uy = (uy * 181) >> 8;
+        }
+        if (tmpmr.x != 0) mouse_report.x = mk_subpixel_emit(&mk_frac_x, ux, tmpmr.x > 0, MOUSEKEY_MOVE_MAX);
+        if (tmpmr.y != 0) mouse_report.y = mk_subpixel_emit(&mk_frac_y, uy, tmpmr.y > 0, MOUSEKEY_MOVE_MAX);
+#        else
         if (tmpmr.x != 0) mouse_report.x = move_unit() * ((tmpmr.x > 0) ? 1 : -1);
         if (tmpmr.y != 0) mouse_report.y = move_unit() * ((tmpmr.y > 0) ? 1 : -1);
 
@@ -355,12 +457,26 @@ void mousekey_task(void) {
                 mouse_report.y = 1;
             }
         }
+#        endif /* MOUSEKEY_SUBPIXEL_ACCEL */
     }
 
 #    endif // MOUSEKEY_INERTIA or not
 
     if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) > (mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10)) {
         if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
+#    ifdef MOUSEKEY_SUBPIXEL_ACCEL
+        mk_update_slopes();
+        uint32_t wheel_fp = wheel_unit_fp();
+        uint32_t uv = wheel_fp, uh = wheel_fp;
+
+        /* diagonal move [1/sqrt(2)], applied before accumulation so the fraction isn't lost */
+        if (tmpmr.v && tmpmr.h) {
+            uv = (uv * 181) >> 8;
+            uh = (uh * 181) >> 8;
+        }
+        if (tmpmr.v != 0) mouse_report.v = mk_subpixel_emit(&mk_frac_v, uv, tmpmr.v > 0, MOUSEKEY_WHEEL_MAX);
+        if (tmpmr.h != 0) mouse_report.h = mk_subpixel_emit(&mk_frac_h, uh, tmpmr.h > 0, MOUSEKEY_WHEEL_MAX);
+#    else
         if (tmpmr.v != 0) mouse_report.v = wheel_unit() * ((tmpmr.v > 0) ? 1 : -1);
         if (tmpmr.h != 0) mouse_report.h = wheel_unit() * ((tmpmr.h > 0) ? 1 : -1);
 
@@ -375,6 +491,7 @@ void mousekey_task(void) {
                 mouse_report.h = 1;
             }
         }
+#    endif /* MOUSEKEY_SUBPIXEL_ACCEL */
     }
 
     if (has_mouse_report_changed(&mouse_report, &tmpmr) || should_mousekey_report_send(&mouse_report)) {
@@ -490,11 +607,21 @@ void mousekey_off(uint8_t code) {
         mousekey_accel &= ~(1 << 2);
     if (mouse_report.x == 0 && mouse_report.y == 0) {
         mousekey_repeat = 0;
+#    ifdef MOUSEKEY_SUBPIXEL_ACCEL
+        mk_frac_x = 0;
+        mk_frac_y = 0;
+#    endif /* #ifdef MOUSEKEY_SUBPIXEL_ACCEL */
 #    ifdef MK_KINETIC_SPEED
         mouse_timer = 0;
 #    endif /* #ifdef MK_KINETIC_SPEED */
     }
-    if (mouse_report.v == 0 && mouse_report.h == 0) mousekey_wheel_repeat = 0;
+    if (mouse_report.v == 0 && mouse_report.h == 0) {
+        mousekey_wheel_repeat = 0;
+#    ifdef MOUSEKEY_SUBPIXEL_ACCEL
+        mk_frac_v = 0;
+        mk_frac_h = 0;
+#    endif /* #ifdef MOUSEKEY_SUBPIXEL_ACCEL */
+    }
 }
 
 #else /* #ifndef MK_3_SPEED */
@@ -643,6 +770,12 @@ void mousekey_clear(void) {
     mousekey_repeat       = 0;
     mousekey_wheel_repeat = 0;
     mousekey_accel        = 0;
+#ifdef MOUSEKEY_SUBPIXEL_ACCEL
+    mk_frac_x = 0;
+    mk_frac_y = 0;
+    mk_frac_v = 0;
+    mk_frac_h = 0;
+#endif
 #ifdef MOUSEKEY_INERTIA
     mousekey_frame     = 0;
     mousekey_x_inertia = 0;
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "eeprom.h"
+#include "nvm_experiment.h"
+#include "nvm_eeprom_eeconfig_internal.h"
+
+// The record lives directly after core eeconfig (including the kb/user datablocks) by default.
+// Boards combining this with VIA or dynamic keymaps must relocate it, as those claim the same
+// region (see nvm_eeprom_via_internal.h / nvm_dynamic_keymap.c).
+#ifndef EXPERIMENT_EEPROM_ADDR
+#    define EXPERIMENT_EEPROM_ADDR (EECONFIG_SIZE)
+#endif
+
+// Folding the record size into the magic invalidates persisted counters whenever the layout
+// changes, instead of misreading stale bytes as data.
+#define EXPERIMENT_EEPROM_MAGIC ((uint16_t)(0xAB00 | sizeof(experiment_nvm_t)))
+
+#define EXPERIMENT_EEPROM_DATA_ADDR (EXPERIMENT_EEPROM_ADDR + 2)
+
+bool nvm_experiment_read(experiment_nvm_t *data) {
+    if (eeprom_read_word((void *)EXPERIMENT_EEPROM_ADDR) != EXPERIMENT_EEPROM_MAGIC) {
+        return false;
+    }
+    eeprom_read_block(data, (void *)EXPERIMENT_EEPROM_DATA_ADDR, sizeof(experiment_nvm_t));
+    return true;
+}
+
+void nvm_experiment_update(const experiment_nvm_t *data) {
+    eeprom_update_block(data, (void *)EXPERIMENT_EEPROM_DATA_ADDR, sizeof(experiment_nvm_t));
+    eeprom_update_word((void *)EXPERIMENT_EEPROM_ADDR, EXPERIMENT_EEPROM_MAGIC);
+}
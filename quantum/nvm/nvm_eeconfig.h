@@ -19,6 +19,9 @@ bool nvm_eeconfig_is_disabled(void);
 void nvm_eeconfig_enable(void);
 void nvm_eeconfig_disable(void);
 
+void nvm_eeconfig_transaction_begin(void);
+void nvm_eeconfig_transaction_commit(void);
+
 typedef union debug_config_t debug_config_t;
 void                         nvm_eeconfig_read_debug(debug_config_t *debug_config);
 void                         nvm_eeconfig_update_debug(const debug_config_t *debug_config);
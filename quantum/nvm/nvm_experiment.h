@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "experiment.h"
+
+/** \brief Everything the experiment harness persists, as one record. */
+typedef struct PACKED experiment_nvm_t {
+    uint8_t               mode;         // EXPERIMENT_MODE_*
+    uint8_t               next_variant; // variant the next boot selects in alternate mode
+    experiment_counters_t counters[2];  // [0] = variant A, [1] = variant B
+} experiment_nvm_t;
+
+/**
+ * \brief Read the persisted experiment record.
+ *
+ * \return false if no valid record exists (first boot, layout change, or erased storage).
+ */
+bool nvm_experiment_read(experiment_nvm_t *data);
+
+/**
+ * \brief Write the experiment record, marking it valid.
+ */
+void nvm_experiment_update(const experiment_nvm_t *data);
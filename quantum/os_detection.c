@@ -64,6 +64,13 @@ static volatile os_variant_t reported_os = OS_UNSURE;
 // we need to be able to report OS_UNSURE if that is the stable result of the guesses
 static volatile bool first_report = true;
 
+#ifdef OS_DETECTION_SINGLE_REPORT
+// once the single report has fired the result is latched: the setup-packet hook bails out
+// immediately and the accumulated wLength history is dropped, so boards that only use
+// detection once (e.g. to pick a default layer at boot) pay no permanent per-packet cost
+static volatile bool detection_latched = false;
+#endif
+
 // to react on USB state changes
 static volatile struct usb_device_state current_usb_device_state = {.configure_state = USB_DEVICE_STATE_NO_INIT};
 static volatile struct usb_device_state maxprev_usb_device_state = {.configure_state = USB_DEVICE_STATE_NO_INIT};
@@ -98,7 +105,7 @@ void os_detection_task(void) {
     }
 #endif
 #ifdef OS_DETECTION_SINGLE_REPORT
-    if (!first_report) {
+    if (detection_latched) {
         return;
     }
 #endif
@@ -112,6 +119,13 @@ void os_detection_task(void) {
                 reported_os  = detected_os;
                 process_detected_host_os_modules(detected_os);
                 process_detected_host_os_kb(detected_os);
+#ifdef OS_DETECTION_SINGLE_REPORT
+                // One-shot: the result stayed stable through the debounce window, so latch it
+                // and release the wLength history - detected_host_os() keeps serving the
+                // cached value, but no further setup traffic is inspected
+                detection_latched = true;
+                memset(&setups_data, 0, sizeof(setups_data));
+#endif
             }
         }
     }
@@ -131,6 +145,12 @@ __attribute__((weak)) bool process_detected_host_os_user(os_variant_t detected_o
 
 // Some collected sequences of wLength can be found in tests.
 void process_wlength(const uint16_t w_length) {
+#ifdef OS_DETECTION_SINGLE_REPORT
+    // Detection already latched - keep the USB setup path to a single load-and-branch
+    if (detection_latched) {
+        return;
+    }
+#endif
 #ifdef OS_DETECTION_DEBUG_ENABLE
     usb_setups[setups_data.count] = w_length;
 #endif
@@ -189,6 +209,9 @@ void erase_wlength_data(void) {
     debouncing                               = false;
     last_time                                = 0;
     first_report                             = true;
+#ifdef OS_DETECTION_SINGLE_REPORT
+    detection_latched = false;
+#endif
 }
 
 void os_detection_notify_usb_device_state_change(struct usb_device_state usb_device_state) {
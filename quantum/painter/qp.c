@@ -23,6 +23,109 @@ static bool validate_driver_integrity(painter_driver_t *driver) {
     return validate_driver_vtable(driver) && validate_comms_vtable(driver);
 }
 
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: performance counters
+
+void qp_perf_record_draw(painter_device_t device, uint8_t primitive) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || primitive >= QP_PERF_PRIMITIVE_COUNT) {
+        return;
+    }
+    if (driver->perf.counters.draw_calls[primitive] != UINT16_MAX) {
+        driver->perf.counters.draw_calls[primitive]++;
+    }
+}
+
+void qp_perf_record_bytes(painter_device_t device, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver) {
+        return;
+    }
+    driver->perf.counters.bytes_sent += byte_count;
+    driver->perf.bytes_window_accum += byte_count;
+    uint32_t elapsed = timer_elapsed32(driver->perf.bytes_window_start);
+    if (elapsed >= 1000) {
+        driver->perf.counters.bytes_per_second = (uint32_t)(((uint64_t)driver->perf.bytes_window_accum * 1000) / elapsed);
+        driver->perf.bytes_window_accum        = 0;
+        driver->perf.bytes_window_start        = timer_read32();
+    }
+}
+
+bool qp_get_perf_counters(painter_device_t device, qp_perf_counters_t *counters) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok || !counters) {
+        return false;
+    }
+    *counters = driver->perf.counters;
+    return true;
+}
+
+void qp_reset_perf_counters(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver) {
+        return;
+    }
+    memset(&driver->perf, 0, sizeof(driver->perf));
+    driver->perf.bytes_window_start = timer_read32();
+}
+
+#    ifdef RAW_HID_CHANNELS_ENABLE
+
+#        include "raw_hid_channels.h"
+
+#        ifndef QP_PERF_RAW_HID_CHANNEL
+#            define QP_PERF_RAW_HID_CHANNEL 3
+#        endif
+
+static uint8_t *qp_perf_pack16(uint8_t *buf, uint16_t value) {
+    *buf++ = (uint8_t)(value & 0xFF);
+    *buf++ = (uint8_t)(value >> 8);
+    return buf;
+}
+
+static uint8_t *qp_perf_pack32(uint8_t *buf, uint32_t value) {
+    buf = qp_perf_pack16(buf, (uint16_t)(value & 0xFFFF));
+    return qp_perf_pack16(buf, (uint16_t)(value >> 16));
+}
+
+// Request: [device index, reset flag]. Response: [device index, flush_count:16, flush_last_ms:16, flush_ewma_ms:16,
+// flush_max_ms:16, bytes_sent:32, bytes_per_second:32, frame_draws[QP_PERF_PRIMITIVE_COUNT]:16 each], little-endian.
+static void qp_perf_raw_hid_handler(const uint8_t *data, uint8_t length) {
+    painter_device_t device = qp_internal_device_at(data[0]);
+    if (!device) {
+        return;
+    }
+
+    qp_perf_counters_t counters;
+    if (!qp_get_perf_counters(device, &counters)) {
+        return;
+    }
+
+    uint8_t  payload[RAW_HID_CHANNEL_PAYLOAD_SIZE] = {0};
+    uint8_t *p                                     = payload;
+    *p++                                           = data[0];
+    p                                              = qp_perf_pack16(p, counters.flush_count);
+    p                                              = qp_perf_pack16(p, counters.flush_last_ms);
+    p                                              = qp_perf_pack16(p, counters.flush_ewma_ms);
+    p                                              = qp_perf_pack16(p, counters.flush_max_ms);
+    p                                              = qp_perf_pack32(p, counters.bytes_sent);
+    p                                              = qp_perf_pack32(p, counters.bytes_per_second);
+    for (uint8_t i = 0; i < QP_PERF_PRIMITIVE_COUNT; i++) {
+        p = qp_perf_pack16(p, counters.frame_draws[i]);
+    }
+    raw_hid_channel_send(QP_PERF_RAW_HID_CHANNEL, payload, (uint8_t)(p - payload));
+
+    if (length >= 2 && data[1]) {
+        qp_reset_perf_counters(device);
+    }
+}
+
+#    endif // RAW_HID_CHANNELS_ENABLE
+
+#endif // QUANTUM_PAINTER_PERF_COUNTERS
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_init
 
@@ -57,6 +160,22 @@ bool qp_init(painter_device_t device, painter_rotation_t rotation) {
     // Set the rotation before init
     driver->rotation = rotation;
 
+#ifdef QUANTUM_PAINTER_WINDOW_CACHE
+    // The init sequence resets the panel's window registers
+    driver->window_cache.valid = false;
+#endif
+
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+    qp_reset_perf_counters(device);
+#    ifdef RAW_HID_CHANNELS_ENABLE
+    // One registration serves all devices -- requests carry the device index.
+    static bool perf_hid_registered = false;
+    if (!perf_hid_registered) {
+        perf_hid_registered = raw_hid_channel_register(QP_PERF_RAW_HID_CHANNEL, qp_perf_raw_hid_handler);
+    }
+#    endif
+#endif
+
     // Invoke init
     bool ret = driver->driver_vtable->init(device, rotation);
     qp_comms_stop(device);
@@ -64,6 +183,29 @@ bool qp_init(painter_device_t device, painter_rotation_t rotation) {
     return ret;
 }
 
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+bool qp_init_warm(painter_device_t device, painter_rotation_t rotation) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    if (!driver) {
+        qp_dprintf("qp_init_warm: fail (pointer to NULL)\n");
+        return false;
+    }
+
+    // The flag is only raised for the duration of the init; comms/panel drivers that support warm
+    // initialization consult it to skip their destructive steps.
+    driver->warm_init = true;
+    bool ret          = qp_init(device, rotation);
+    driver->warm_init = false;
+    return ret;
+}
+
+bool qp_init_in_progress(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return driver != NULL && driver->async_init_sequence != NULL;
+}
+#endif // QUANTUM_PAINTER_ASYNC_INIT
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_power
 
@@ -103,6 +245,10 @@ bool qp_clear(painter_device_t device) {
     }
 
     bool ret = driver->driver_vtable->clear(device);
+    if (ret) {
+        // The entire panel has been touched -- mark everything dirty until the next flush
+        qp_internal_mark_dirty(device, 0, 0, driver->panel_width - 1, driver->panel_height - 1);
+    }
     qp_comms_stop(device);
     qp_dprintf("qp_clear: %s\n", ret ? "ok" : "fail");
     return ret;
@@ -124,12 +270,71 @@ bool qp_flush(painter_device_t device) {
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+    uint32_t flush_start = timer_read32();
+#endif
     bool ret = driver->driver_vtable->flush(device);
+    if (ret) {
+        // Everything accumulated so far has hit the panel -- start a fresh dirty region
+        driver->dirty.is_dirty = false;
+
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+        qp_perf_counters_t *counters = &driver->perf.counters;
+        uint32_t            duration = timer_elapsed32(flush_start);
+        if (duration > UINT16_MAX) {
+            duration = UINT16_MAX;
+        }
+        counters->flush_last_ms = (uint16_t)duration;
+        if (counters->flush_count == 0) {
+            counters->flush_ewma_ms = (uint16_t)duration;
+        } else {
+            counters->flush_ewma_ms = (uint16_t)(counters->flush_ewma_ms + ((int32_t)duration - counters->flush_ewma_ms) / 8);
+        }
+        if (duration > counters->flush_max_ms) {
+            counters->flush_max_ms = (uint16_t)duration;
+        }
+        if (counters->flush_count != UINT16_MAX) {
+            counters->flush_count++;
+        }
+        // A flush delimits a frame -- latch the per-frame draw-call profile and start counting afresh
+        memcpy(counters->frame_draws, counters->draw_calls, sizeof(counters->frame_draws));
+        memset(counters->draw_calls, 0, sizeof(counters->draw_calls));
+#endif // QUANTUM_PAINTER_PERF_COUNTERS
+    }
     qp_comms_stop(device);
     qp_dprintf("qp_flush: %s\n", ret ? "ok" : "fail");
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_get_dirty_region
+
+bool qp_get_dirty_region(painter_device_t device, uint16_t *left, uint16_t *top, uint16_t *right, uint16_t *bottom) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_get_dirty_region: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!driver->dirty.is_dirty) {
+        return false;
+    }
+
+    if (left) {
+        *left = driver->dirty.l;
+    }
+    if (top) {
+        *top = driver->dirty.t;
+    }
+    if (right) {
+        *right = driver->dirty.r;
+    }
+    if (bottom) {
+        *bottom = driver->dirty.b;
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_get_*
 
@@ -290,7 +495,8 @@ bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t
         return false;
     }
 
-    // Set the viewport
+    // Set the viewport -- raw pixdata will land inside it, so account for it in the dirty region
+    qp_internal_mark_dirty(device, left, top, right, bottom);
     bool ret = driver->driver_vtable->viewport(device, left, top, right, bottom);
     qp_dprintf("qp_viewport: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -318,3 +524,58 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
     qp_comms_stop(device);
     return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_set_scroll_region
+
+bool qp_set_scroll_region(painter_device_t device, uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines) {
+    qp_dprintf("qp_set_scroll_region: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_set_scroll_region: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!driver->driver_vtable->scroll_region) {
+        qp_dprintf("qp_set_scroll_region: fail (no hardware scrolling support)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_set_scroll_region: fail (could not start comms)\n");
+        return false;
+    }
+
+    bool ret = driver->driver_vtable->scroll_region(device, top_fixed_lines, scroll_lines, bottom_fixed_lines);
+    qp_dprintf("qp_set_scroll_region: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_set_scroll_start
+
+bool qp_set_scroll_start(painter_device_t device, uint16_t line) {
+    qp_dprintf("qp_set_scroll_start: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_set_scroll_start: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!driver->driver_vtable->scroll_start) {
+        qp_dprintf("qp_set_scroll_start: fail (no hardware scrolling support)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_set_scroll_start: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Scrolling only changes the panel's scan-out order, not GRAM contents -- no dirty region update needed
+    bool ret = driver->driver_vtable->scroll_start(device, line);
+    qp_dprintf("qp_set_scroll_start: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret;
+}
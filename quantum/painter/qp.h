@@ -72,6 +72,74 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+/**
+ * @def This controls the size of the arena (in bytes) used to keep decoded image frames when
+ *      `QUANTUM_PAINTER_IMAGE_CACHE = yes` is set in rules.mk. Frames are decoded to the display's native pixel format
+ *      on first draw and blitted directly from the arena on subsequent draws, with least-recently-used frames evicted
+ *      when space runs out. Larger arenas keep more frames resident at the cost of RAM.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_SIZE 16384
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES
+/**
+ * @def This controls the maximum number of decoded image frames that can be resident in the image cache arena at any
+ *      one time.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES 8
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES
+
+#ifndef QUANTUM_PAINTER_GLYPH_ATLAS_SIZE
+/**
+ * @def This controls the size of the arena (in bytes) used to keep decoded glyph bitmaps when
+ *      `QUANTUM_PAINTER_GLYPH_ATLAS = yes` is set in rules.mk. Glyphs are decoded to the display's native pixel format
+ *      on first draw; subsequent draws blit straight from the arena and width queries skip the font stream entirely,
+ *      with least-recently-used glyphs evicted when space runs out.
+ */
+#    define QUANTUM_PAINTER_GLYPH_ATLAS_SIZE 4096
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS
+/**
+ * @def This controls the maximum number of decoded glyphs that can be resident in the glyph atlas arena at any one
+ *      time.
+ */
+#    define QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS 64
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS
+
+#ifndef QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS
+/**
+ * @def This controls the maximum number of glyphs in a text run that can be composited and transmitted as a single
+ *      span when `QUANTUM_PAINTER_TEXT_SPAN = yes` is set in rules.mk. Longer runs fall back to per-glyph rendering.
+ */
+#    define QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS 32
+#endif // QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS
+
+#ifndef QUANTUM_PAINTER_TEXT_LAYOUT_MAX_LINES
+/**
+ * @def This controls the maximum number of wrapped lines a text layout object can hold when
+ *      `QUANTUM_PAINTER_TEXT_LAYOUT = yes` is set in rules.mk. Text that wraps to more lines is truncated.
+ */
+#    define QUANTUM_PAINTER_TEXT_LAYOUT_MAX_LINES 8
+#endif // QUANTUM_PAINTER_TEXT_LAYOUT_MAX_LINES
+
+#ifndef QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT
+/**
+ * @def This controls the size (in bytes) of the private text copy held by each text layout object. Longer strings are
+ *      truncated when the layout is built.
+ */
+#    define QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT 128
+#endif // QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT
+
+#ifndef QUANTUM_PAINTER_CMDLIST_MAX_COMMANDS
+/**
+ * @def This controls the maximum number of draw commands a command list object can hold when
+ *      `QUANTUM_PAINTER_CMDLIST = yes` is set in rules.mk. Appends beyond this count fail.
+ */
+#    define QUANTUM_PAINTER_CMDLIST_MAX_COMMANDS 16
+#endif // QUANTUM_PAINTER_CMDLIST_MAX_COMMANDS
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -142,6 +210,32 @@ typedef const painter_font_desc_t *painter_font_handle_t;
  */
 bool qp_init(painter_device_t device, painter_rotation_t rotation);
 
+/**
+ * Initialize a device whose panel never lost power, preserving its displayed content. Comms and panel drivers that
+ * support warm initialization skip the destructive steps -- the reset pulse and the panel reset/init sequence --
+ * and only reapply non-destructive configuration such as the rotation. Drivers without warm support fall back to a
+ * full \ref qp_init. Only call this when the panel is known to have stayed powered across the reset, e.g. guarded by
+ * a warm-boot stash; a cold panel initialized this way displays garbage until the next full repaint.
+ *
+ * @param device[in] the handle of the device to initialize
+ * @param rotation[in] the rotation to use
+ * @return true if initialization succeeded
+ * @return false if initialization failed
+ */
+bool qp_init_warm(painter_device_t device, painter_rotation_t rotation);
+
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+/**
+ * Checks whether a device's deferred init sequence is still running. With QUANTUM_PAINTER_ASYNC_INIT, \ref qp_init
+ * returns immediately and the panel's init-table delays elapse as deferred continuations; draw calls are rejected
+ * until the sequence completes.
+ *
+ * @param device[in] the handle of the device to query
+ * @return true if the device is still initializing
+ */
+bool qp_init_in_progress(painter_device_t device);
+#endif // QUANTUM_PAINTER_ASYNC_INIT
+
 /**
  * Controls whether a display is on or off.
  *
@@ -175,6 +269,73 @@ bool qp_clear(painter_device_t device);
  */
 bool qp_flush(painter_device_t device);
 
+/**
+ * Retrieves the bounding box of all drawing performed since the last successful \ref qp_flush.
+ *
+ * Drawing primitives accumulate their affected area into a per-device dirty region; framebuffer-backed renderers can
+ * use this to limit retransmission to the area that actually changed.
+ *
+ * @note Any arguments of NULL will be ignored.
+ *
+ * @param device[in] the handle of the device to control
+ * @param left[out] the leftmost dirty coordinate
+ * @param top[out] the topmost dirty coordinate
+ * @param right[out] the rightmost dirty coordinate
+ * @param bottom[out] the bottommost dirty coordinate
+ * @return true if the device has been drawn to since the last flush
+ * @return false if nothing has changed since the last flush
+ */
+bool qp_get_dirty_region(painter_device_t device, uint16_t *left, uint16_t *top, uint16_t *right, uint16_t *bottom);
+
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+
+/**
+ * Draw-call classification used by the per-device performance counters.
+ */
+typedef enum qp_perf_primitive_t {
+    QP_PERF_PRIMITIVE_SETPIXEL,
+    QP_PERF_PRIMITIVE_LINE,
+    QP_PERF_PRIMITIVE_RECT,
+    QP_PERF_PRIMITIVE_CIRCLE,
+    QP_PERF_PRIMITIVE_ELLIPSE,
+    QP_PERF_PRIMITIVE_IMAGE,
+    QP_PERF_PRIMITIVE_TEXT,
+    QP_PERF_PRIMITIVE_COUNT
+} qp_perf_primitive_t;
+
+/**
+ * Per-device performance counters, accumulated since init or the last \ref qp_reset_perf_counters.
+ */
+typedef struct qp_perf_counters_t {
+    uint16_t flush_count;                            ///< number of successful flushes
+    uint16_t flush_last_ms;                          ///< duration of the most recent flush, in milliseconds
+    uint16_t flush_ewma_ms;                          ///< exponentially-weighted moving average flush duration (alpha = 1/8)
+    uint16_t flush_max_ms;                           ///< worst flush duration observed
+    uint32_t bytes_sent;                             ///< total bytes pushed through qp_comms_send
+    uint32_t bytes_per_second;                       ///< comms throughput over the last completed one-second window
+    uint16_t draw_calls[QP_PERF_PRIMITIVE_COUNT];    ///< draw calls since the last flush, by primitive type
+    uint16_t frame_draws[QP_PERF_PRIMITIVE_COUNT];   ///< draw calls in the last completed frame (flush-to-flush), by primitive type
+} qp_perf_counters_t;
+
+/**
+ * Retrieves a snapshot of a device's performance counters.
+ *
+ * @param device[in] the handle of the device to query
+ * @param counters[out] receives the current counter values
+ * @return true if the snapshot was taken
+ * @return false if the device failed validation
+ */
+bool qp_get_perf_counters(painter_device_t device, qp_perf_counters_t *counters);
+
+/**
+ * Resets a device's performance counters to zero.
+ *
+ * @param device[in] the handle of the device to reset
+ */
+void qp_reset_perf_counters(painter_device_t device);
+
+#endif // QUANTUM_PAINTER_PERF_COUNTERS
+
 /**
  * Retrieves the width of the display.
  *
@@ -280,6 +441,35 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
  */
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
 
+/**
+ * Callback for supplying per-scanline colors to qp_rect_scanlines.
+ *
+ * @param row[in] the zero-based row index within the rectangle being drawn
+ * @param hue[out] the hue to use for this row, with 0-360 mapped to 0-255
+ * @param sat[out] the saturation to use for this row, with 0-100% mapped to 0-255
+ * @param val[out] the value to use for this row, with 0-100% mapped to 0-255
+ * @param cb_arg[in] the argument passed to qp_rect_scanlines
+ */
+typedef void (*qp_scanline_color_callback)(uint16_t row, uint8_t *hue, uint8_t *sat, uint8_t *val, void *cb_arg);
+
+/**
+ * Draws a filled rectangle where each scanline's color is supplied by a callback, such as a vertical gradient.
+ *
+ * Equivalent to issuing one filled qp_rect per row, but sets the viewport and performs the comms transaction only once
+ * for the entire rectangle, streaming each row's pixels back-to-back.
+ *
+ * @param device[in] the handle of the device to control
+ * @param left[in] the device's x-position to start
+ * @param top[in] the device's y-position to start
+ * @param right[in] the device's x-position to finish
+ * @param bottom[in] the device's y-position to finish
+ * @param color_callback[in] the callback invoked once per row to retrieve its color
+ * @param cb_arg[in] an arbitrary argument passed to the callback
+ * @return true if drawing the rectangle succeeded
+ * @return false if drawing the rectangle failed
+ */
+bool qp_rect_scanlines(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, qp_scanline_color_callback color_callback, void *cb_arg);
+
 /**
  * Draws a circle using the specified color, optionally filled.
  *
@@ -341,6 +531,38 @@ bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t
  */
 bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
 
+/**
+ * Configures the panel's hardware scroll region, on panels that support scrolling in silicon.
+ *
+ * The panel is split into a fixed top area, a scrolling middle area, and a fixed bottom area; the three line counts
+ * must cover the full height of the panel's GRAM, which may be larger than the visible height (e.g. 320 lines on
+ * ST7789). Scrolling happens along the panel's native vertical axis, irrespective of the configured rotation.
+ *
+ * @note Content scrolled this way moves on the panel without touching GRAM -- subsequent drawing still lands at
+ * unscrolled coordinates.
+ *
+ * @param device[in] the handle of the device to control
+ * @param top_fixed_lines[in] the number of lines at the top of GRAM exempt from scrolling
+ * @param scroll_lines[in] the number of lines that scroll
+ * @param bottom_fixed_lines[in] the number of lines at the bottom of GRAM exempt from scrolling
+ * @return true if the scroll region was set
+ * @return false if the device's driver has no hardware scrolling support
+ */
+bool qp_set_scroll_region(painter_device_t device, uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines);
+
+/**
+ * Sets the GRAM line displayed at the top of the scroll region configured by \ref qp_set_scroll_region.
+ *
+ * Advancing the line by one text row after drawing only the newly-exposed row gives single-command scrolling for
+ * console-style widgets, instead of redrawing the whole region.
+ *
+ * @param device[in] the handle of the device to control
+ * @param line[in] the GRAM line to display first
+ * @return true if the scroll start was set
+ * @return false if the device's driver has no hardware scrolling support
+ */
+bool qp_set_scroll_start(painter_device_t device, uint16_t line);
+
 /**
  * Loads an image into memory.
  *
@@ -362,6 +584,23 @@ painter_image_handle_t qp_load_image_mem(const void *buffer);
  */
 bool qp_close_image(painter_image_handle_t image);
 
+#ifdef QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+/**
+ * Attaches a build-time palette, already converted to the target panel's native pixel format, to a loaded image.
+ * Subsequent draws of the image skip runtime palette interpolation and the driver's palette conversion entirely;
+ * any palette block inside the asset itself is ignored. The palette must remain valid for the lifetime of the image
+ * handle and must provide at least 2^bpp entries for the image's bits-per-pixel.
+ *
+ * @param image[in] the handle of the image to attach the palette to
+ * @param palette[in] pointer to the native-format palette entries
+ * @param entries[in] the number of entries in the palette
+ * @return true if the palette was attached
+ * @return false if the image handle was invalid
+ */
+union qp_pixel_t; // full definition in qp_internal_formats.h
+bool qp_image_set_native_palette(painter_image_handle_t image, const union qp_pixel_t *palette, uint16_t entries);
+#endif // QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+
 /**
  * Draws an image to the display.
  *
@@ -488,6 +727,222 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+#ifdef QUANTUM_PAINTER_TEXT_LAYOUT_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Text Layout
+
+/**
+ * A retained word-wrap layout for multi-line text, available when `QUANTUM_PAINTER_TEXT_LAYOUT = yes` is set in
+ * rules.mk. Line breaks and per-line pixel widths are resolved once when the text is set; drawing the layout
+ * afterwards performs no width measurement. Intended for widgets that redraw the same wrapped text every frame.
+ *
+ * Treat the contents as opaque -- use the qp_text_layout_* functions below.
+ */
+typedef struct qp_text_layout_t {
+    painter_font_handle_t font;         ///< font used for measurement and drawing
+    uint16_t              max_width;    ///< wrap width in pixels
+    bool                  valid;        ///< whether the layout holds a built line table
+    uint32_t              content_hash; ///< hash of the last laid-out string, for change detection
+    uint8_t               line_count;   ///< number of wrapped lines
+    struct {
+        uint16_t start;  ///< byte offset of the line within the text copy
+        uint16_t length; ///< length of the line in bytes
+        int16_t  width;  ///< measured width of the line in pixels
+    } lines[QUANTUM_PAINTER_TEXT_LAYOUT_MAX_LINES];
+    char text[QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT]; ///< private copy of the laid-out string
+} qp_text_layout_t;
+
+/**
+ * Initializes a text layout object. No measurement occurs until \ref qp_text_layout_set_text.
+ *
+ * @param layout[in] the layout object to initialize
+ * @param font[in] the handle of the font used for measurement and drawing
+ * @param max_width[in] the wrap width in pixels
+ */
+void qp_text_layout_init(qp_text_layout_t *layout, painter_font_handle_t font, uint16_t max_width);
+
+/**
+ * Sets the layout's text, rebuilding the line table if the content changed. Words are wrapped at spaces to fit the
+ * layout's wrap width, explicit `\n` characters force a break, and a single word wider than the wrap width is broken
+ * mid-word. Safe to call every frame: unchanged content is detected by hash and costs no measurement.
+ *
+ * @param layout[in] the layout object
+ * @param str[in] the string to lay out
+ * @return true if the content changed and the layout was rebuilt
+ * @return false if the content was unchanged
+ */
+bool qp_text_layout_set_text(qp_text_layout_t *layout, const char *str);
+
+/**
+ * Marks the layout as stale, forcing a rebuild on the next \ref qp_text_layout_set_text -- e.g. after changing the
+ * font or wrap width in place.
+ *
+ * @param layout[in] the layout object
+ */
+void qp_text_layout_invalidate(qp_text_layout_t *layout);
+
+/**
+ * @param layout[in] the layout object
+ * @return the number of wrapped lines in the built layout, or 0 if no layout has been built
+ */
+uint8_t qp_text_layout_line_count(const qp_text_layout_t *layout);
+
+/**
+ * @param layout[in] the layout object
+ * @return the total height (in pixels) the built layout occupies when drawn
+ */
+int16_t qp_text_layout_height(const qp_text_layout_t *layout);
+
+/**
+ * Draws all lines of a built layout to the display.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the first line should be drawn onto the device
+ * @param y[in] the y-position where the first line should be drawn onto the device
+ * @param layout[in] the layout object
+ * @return the total height (in pixels) used when drawing the layout
+ */
+int16_t qp_text_layout_draw(painter_device_t device, uint16_t x, uint16_t y, qp_text_layout_t *layout);
+
+/**
+ * Draws all lines of a built layout to the display, recoloring monochrome fonts to the desired foreground/background.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the first line should be drawn onto the device
+ * @param y[in] the y-position where the first line should be drawn onto the device
+ * @param layout[in] the layout object
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the total height (in pixels) used when drawing the layout
+ */
+int16_t qp_text_layout_draw_recolor(painter_device_t device, uint16_t x, uint16_t y, qp_text_layout_t *layout, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+#endif // QUANTUM_PAINTER_TEXT_LAYOUT_ENABLE
+
+#ifdef QUANTUM_PAINTER_CMDLIST_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Command Lists
+
+/**
+ * A recorded sequence of draw calls, available when `QUANTUM_PAINTER_CMDLIST = yes` is set in rules.mk. A widget's
+ * draw sequence is appended once -- the argument marshalling, ordering and any caller-side coordinate arithmetic are
+ * resolved at record time -- and individual arguments are then bound to replay slots. Each subsequent update of the
+ * widget is a single \ref qp_cmdlist_replay with the current slot values, e.g. a layer indicator re-issues its whole
+ * sequence with just the layer's HSV substituted.
+ *
+ * Treat the contents as opaque -- use the qp_cmdlist_* functions below.
+ */
+typedef struct qp_cmdlist_t {
+    uint8_t count; ///< number of recorded commands
+    struct {
+        uint8_t               op;        ///< draw operation
+        uint8_t               argc;      ///< number of argument words the operation uses
+        uint8_t               slot_mask; ///< bit n set: args[n] is a replay slot index, not a literal
+        uint8_t               str_slot;  ///< replay string slot for text operations, or 0xFF for the recorded string
+        uint16_t              args[8];   ///< argument words (coordinates, HSV channels, flags)
+        painter_font_handle_t font;      ///< font for text operations
+        const char *          str;       ///< recorded string for text operations
+    } cmds[QUANTUM_PAINTER_CMDLIST_MAX_COMMANDS];
+} qp_cmdlist_t;
+
+/**
+ * Initializes a command list object, discarding any recorded commands.
+ *
+ * @param list[in] the command list to initialize
+ */
+void qp_cmdlist_init(qp_cmdlist_t *list);
+
+/**
+ * Records a \ref qp_rect call. Arguments are bindable by index in parameter order: 0=left, 1=top, 2=right, 3=bottom,
+ * 4=hue, 5=sat, 6=val, 7=filled.
+ *
+ * @return true if the command was recorded
+ * @return false if the list is full
+ */
+bool qp_cmdlist_rect(qp_cmdlist_t *list, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a \ref qp_line call. Arguments are bindable by index in parameter order: 0=x0, 1=y0, 2=x1, 3=y1, 4=hue,
+ * 5=sat, 6=val.
+ *
+ * @return true if the command was recorded
+ * @return false if the list is full
+ */
+bool qp_cmdlist_line(qp_cmdlist_t *list, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Records a \ref qp_circle call. Arguments are bindable by index in parameter order: 0=x, 1=y, 2=radius, 3=hue,
+ * 4=sat, 5=val, 6=filled.
+ *
+ * @return true if the command was recorded
+ * @return false if the list is full
+ */
+bool qp_cmdlist_circle(qp_cmdlist_t *list, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a \ref qp_ellipse call. Arguments are bindable by index in parameter order: 0=x, 1=y, 2=sizex, 3=sizey,
+ * 4=hue, 5=sat, 6=val, 7=filled.
+ *
+ * @return true if the command was recorded
+ * @return false if the list is full
+ */
+bool qp_cmdlist_ellipse(qp_cmdlist_t *list, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a \ref qp_drawtext_recolor call. The string pointer is stored, not copied -- it must outlive the list, or
+ * be rebound to a replay string slot with \ref qp_cmdlist_bind_string. Scalar arguments are bindable by index in
+ * parameter order: 0=x, 1=y, 2=hue_fg, 3=sat_fg, 4=val_fg, 5=hue_bg, 6=sat_bg, 7=val_bg.
+ *
+ * @return true if the command was recorded
+ * @return false if the list is full
+ */
+bool qp_cmdlist_drawtext_recolor(qp_cmdlist_t *list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Binds an argument of the most recently recorded command to a replay slot. The argument's recorded literal is
+ * replaced by `slot`, and each \ref qp_cmdlist_replay substitutes the caller's value for that slot.
+ *
+ * @param list[in] the command list
+ * @param arg[in] the argument index, per the recording function's documented order
+ * @param slot[in] the replay slot index
+ * @return true if the argument was bound
+ * @return false if the list is empty or the argument index is out of range for the command
+ */
+bool qp_cmdlist_bind(qp_cmdlist_t *list, uint8_t arg, uint8_t slot);
+
+/**
+ * Binds the string of the most recently recorded text command to a replay string slot, replacing the recorded
+ * pointer.
+ *
+ * @param list[in] the command list
+ * @param slot[in] the replay string slot index
+ * @return true if the string was bound
+ * @return false if the list is empty or the last command is not a text command
+ */
+bool qp_cmdlist_bind_string(qp_cmdlist_t *list, uint8_t slot);
+
+/**
+ * Replays a recorded command list against a device, substituting bound arguments from the supplied slot values.
+ *
+ * @param device[in] the handle of the device to control
+ * @param list[in] the command list to replay
+ * @param slots[in] the scalar slot values, or NULL if no scalar arguments are bound
+ * @param slot_count[in] the number of entries in `slots`
+ * @param strings[in] the string slot values, or NULL if no strings are bound
+ * @param string_count[in] the number of entries in `strings`
+ * @return true if every command was replayed
+ * @return false if a bound slot index was out of range, or a draw call failed
+ */
+bool qp_cmdlist_replay(painter_device_t device, const qp_cmdlist_t *list, const uint16_t *slots, uint8_t slot_count, const char *const *strings, uint8_t string_count);
+
+#endif // QUANTUM_PAINTER_CMDLIST_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
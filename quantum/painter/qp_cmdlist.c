@@ -0,0 +1,154 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp.h"
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Draw command lists
+//
+// Records a widget's draw sequence into a fixed-size list of compact commands, each holding the target primitive and
+// its argument words; selected arguments are then bound to replay slots. The caller-side work of a repeated sequence
+// -- coordinate arithmetic, argument marshalling, branching over which primitives to issue -- happens once at record
+// time, and every subsequent update is one qp_cmdlist_replay() that walks the list and dispatches each entry with the
+// current slot values substituted. Primitive-internal work (clipping, span generation, pixel pushes) still runs per
+// replay; the list amortizes everything above it.
+
+enum qp_cmdlist_op {
+    QP_CMDLIST_OP_RECT,
+    QP_CMDLIST_OP_LINE,
+    QP_CMDLIST_OP_CIRCLE,
+    QP_CMDLIST_OP_ELLIPSE,
+    QP_CMDLIST_OP_TEXT,
+};
+
+#define QP_CMDLIST_NO_STR_SLOT 0xFF
+
+void qp_cmdlist_init(qp_cmdlist_t *list) {
+    memset(list, 0, sizeof(*list));
+}
+
+static bool qp_cmdlist_append(qp_cmdlist_t *list, uint8_t op, const uint16_t *args, uint8_t argc) {
+    if (list->count >= QUANTUM_PAINTER_CMDLIST_MAX_COMMANDS) {
+        qp_dprintf("qp_cmdlist_append: fail (list full)\n");
+        return false;
+    }
+    list->cmds[list->count].op        = op;
+    list->cmds[list->count].argc      = argc;
+    list->cmds[list->count].slot_mask = 0;
+    list->cmds[list->count].str_slot  = QP_CMDLIST_NO_STR_SLOT;
+    list->cmds[list->count].font      = NULL;
+    list->cmds[list->count].str       = NULL;
+    memcpy(list->cmds[list->count].args, args, argc * sizeof(uint16_t));
+    list->count++;
+    return true;
+}
+
+bool qp_cmdlist_rect(qp_cmdlist_t *list, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    uint16_t args[8] = {left, top, right, bottom, hue, sat, val, filled};
+    return qp_cmdlist_append(list, QP_CMDLIST_OP_RECT, args, 8);
+}
+
+bool qp_cmdlist_line(qp_cmdlist_t *list, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    uint16_t args[7] = {x0, y0, x1, y1, hue, sat, val};
+    return qp_cmdlist_append(list, QP_CMDLIST_OP_LINE, args, 7);
+}
+
+bool qp_cmdlist_circle(qp_cmdlist_t *list, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    uint16_t args[7] = {x, y, radius, hue, sat, val, filled};
+    return qp_cmdlist_append(list, QP_CMDLIST_OP_CIRCLE, args, 7);
+}
+
+bool qp_cmdlist_ellipse(qp_cmdlist_t *list, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    uint16_t args[8] = {x, y, sizex, sizey, hue, sat, val, filled};
+    return qp_cmdlist_append(list, QP_CMDLIST_OP_ELLIPSE, args, 8);
+}
+
+bool qp_cmdlist_drawtext_recolor(qp_cmdlist_t *list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    uint16_t args[8] = {x, y, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg};
+    if (!qp_cmdlist_append(list, QP_CMDLIST_OP_TEXT, args, 8)) {
+        return false;
+    }
+    list->cmds[list->count - 1].font = font;
+    list->cmds[list->count - 1].str  = str;
+    return true;
+}
+
+bool qp_cmdlist_bind(qp_cmdlist_t *list, uint8_t arg, uint8_t slot) {
+    if (list->count == 0 || arg >= list->cmds[list->count - 1].argc) {
+        qp_dprintf("qp_cmdlist_bind: fail (no such argument)\n");
+        return false;
+    }
+    list->cmds[list->count - 1].slot_mask |= (uint8_t)(1 << arg);
+    list->cmds[list->count - 1].args[arg] = slot;
+    return true;
+}
+
+bool qp_cmdlist_bind_string(qp_cmdlist_t *list, uint8_t slot) {
+    if (list->count == 0 || list->cmds[list->count - 1].op != QP_CMDLIST_OP_TEXT) {
+        qp_dprintf("qp_cmdlist_bind_string: fail (last command is not a text command)\n");
+        return false;
+    }
+    list->cmds[list->count - 1].str_slot = slot;
+    list->cmds[list->count - 1].str      = NULL;
+    return true;
+}
+
+bool qp_cmdlist_replay(painter_device_t device, const qp_cmdlist_t *list, const uint16_t *slots, uint8_t slot_count, const char *const *strings, uint8_t string_count) {
+    for (uint8_t i = 0; i < list->count; i++) {
+        // Resolve the argument words, substituting bound slots
+        uint16_t a[8];
+        for (uint8_t n = 0; n < list->cmds[i].argc; n++) {
+            if (list->cmds[i].slot_mask & (1 << n)) {
+                if (list->cmds[i].args[n] >= slot_count) {
+                    qp_dprintf("qp_cmdlist_replay: fail (slot index out of range)\n");
+                    return false;
+                }
+                a[n] = slots[list->cmds[i].args[n]];
+            } else {
+                a[n] = list->cmds[i].args[n];
+            }
+        }
+
+        switch (list->cmds[i].op) {
+            case QP_CMDLIST_OP_RECT:
+                if (!qp_rect(device, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7])) {
+                    return false;
+                }
+                break;
+            case QP_CMDLIST_OP_LINE:
+                if (!qp_line(device, a[0], a[1], a[2], a[3], a[4], a[5], a[6])) {
+                    return false;
+                }
+                break;
+            case QP_CMDLIST_OP_CIRCLE:
+                if (!qp_circle(device, a[0], a[1], a[2], a[3], a[4], a[5], a[6])) {
+                    return false;
+                }
+                break;
+            case QP_CMDLIST_OP_ELLIPSE:
+                if (!qp_ellipse(device, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7])) {
+                    return false;
+                }
+                break;
+            case QP_CMDLIST_OP_TEXT: {
+                const char *str = list->cmds[i].str;
+                if (list->cmds[i].str_slot != QP_CMDLIST_NO_STR_SLOT) {
+                    if (list->cmds[i].str_slot >= string_count) {
+                        qp_dprintf("qp_cmdlist_replay: fail (string slot index out of range)\n");
+                        return false;
+                    }
+                    str = strings[list->cmds[i].str_slot];
+                }
+                qp_drawtext_recolor(device, a[0], a[1], list->cmds[i].font, str, a[2], a[3], a[4], a[5], a[6], a[7]);
+                break;
+            }
+            default:
+                qp_dprintf("qp_cmdlist_replay: fail (unknown op)\n");
+                return false;
+        }
+    }
+    return true;
+}
@@ -36,6 +36,21 @@ void qp_comms_stop(painter_device_t device) {
     driver->comms_vtable->comms_stop(device);
 }
 
+#ifdef QUANTUM_PAINTER_CHUNKED_TRANSFERS
+
+// Upper bound for a single comms_send transaction; larger writes are split with a yield point between chunks so a
+// full-frame pixel push cannot own the bus and CPU for its entire duration. Size this from the bus clock for the
+// latency budget wanted -- e.g. at 32 MHz SPI, 800 bytes is roughly 200us of bus time per chunk.
+#    ifndef QUANTUM_PAINTER_CHUNK_SIZE
+#        define QUANTUM_PAINTER_CHUNK_SIZE 800
+#    endif
+
+// Called between chunks of a split transfer. Default does nothing; override it to run housekeeping that must not
+// starve during long flushes. The device is mid-transfer, so the override must not touch the display bus.
+__attribute__((weak)) void qp_comms_chunk_yield(painter_device_t device) {}
+
+#endif // QUANTUM_PAINTER_CHUNKED_TRANSFERS
+
 uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -43,7 +58,32 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
-    return driver->comms_vtable->comms_send(device, data, byte_count);
+#ifdef QUANTUM_PAINTER_CHUNKED_TRANSFERS
+    // Splitting is safe here: chip select and the D/C line are owned by qp_comms_start/stop, so consecutive
+    // comms_send calls continue the same logical transfer.
+    const uint8_t *buf       = (const uint8_t *)data;
+    uint32_t       remaining = byte_count;
+    uint32_t       total     = 0;
+    while (remaining > 0) {
+        const uint32_t chunk = remaining > QUANTUM_PAINTER_CHUNK_SIZE ? QUANTUM_PAINTER_CHUNK_SIZE : remaining;
+        const uint32_t sent  = driver->comms_vtable->comms_send(device, buf, chunk);
+        total += sent;
+        if (sent != chunk) {
+            break;
+        }
+        buf += chunk;
+        remaining -= chunk;
+        if (remaining > 0) {
+            qp_comms_chunk_yield(device);
+        }
+    }
+    qp_perf_bytes(device, total);
+    return total;
+#else
+    uint32_t sent = driver->comms_vtable->comms_send(device, data, byte_count);
+    qp_perf_bytes(device, sent);
+    return sent;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,3 +110,93 @@ void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequ
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous bulk command sequences
+
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+
+#    include <string.h>
+#    include "deferred_exec.h"
+#    include "wait.h"
+
+// One executor slot per device: each display has at most one init sequence in flight.
+static deferred_executor_t async_init_executors[QP_NUM_DEVICES] = {0};
+
+// Longest single sequence entry that can be re-sent with its delay byte stripped; longer
+// entries fall back to a blocking delay for just that entry.
+#    define QP_ASYNC_MAX_ENTRY_DATA 16
+
+static uint32_t qp_comms_async_sequence_callback(uint32_t trigger_time, void *cb_arg) {
+    painter_device_t  device = (painter_device_t)cb_arg;
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // validate_ok is held false while the sequence runs, so the public wrappers
+    // are bypassed in favour of direct vtable calls.
+    painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    comms_vtable->base.comms_start(device);
+
+    while (driver->async_init_offset < driver->async_init_sequence_len) {
+        const uint8_t *entry     = &driver->async_init_sequence[driver->async_init_offset];
+        uint8_t        delay     = entry[1];
+        uint8_t        num_bytes = entry[2];
+        driver->async_init_offset += 3 + num_bytes;
+
+        if (delay > 0 && num_bytes <= QP_ASYNC_MAX_ENTRY_DATA) {
+            // Send this entry with the delay stripped, then let the panel have
+            // its settle time as a deferred continuation instead of a stall.
+            uint8_t entry_copy[3 + QP_ASYNC_MAX_ENTRY_DATA];
+            memcpy(entry_copy, entry, 3 + num_bytes);
+            entry_copy[1] = 0;
+            comms_vtable->bulk_command_sequence(device, entry_copy, 3 + num_bytes);
+            comms_vtable->base.comms_stop(device);
+            return delay;
+        }
+
+        // No settle time needed (or an oversized entry, which keeps its blocking delay).
+        comms_vtable->bulk_command_sequence(device, entry, 3 + num_bytes);
+    }
+
+    // Sequence complete: restore validation so the finalize step can use the
+    // public APIs, then open the device for drawing.
+    driver->validate_ok         = true;
+    driver->async_init_sequence = NULL;
+    if (driver->async_init_finalize != NULL) {
+        driver->async_init_finalize(device);
+    }
+    comms_vtable->base.comms_stop(device);
+    qp_dprintf("qp_comms_async_sequence_callback: init sequence complete\n");
+    return 0;
+}
+
+void qp_comms_bulk_command_sequence_async(painter_device_t device, const uint8_t *sequence, size_t sequence_len, void (*finalize)(painter_device_t device)) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    driver->async_init_sequence     = sequence;
+    driver->async_init_sequence_len = sequence_len;
+    driver->async_init_offset       = 0;
+    driver->async_init_finalize     = finalize;
+
+    // Reject draws until the sequence has completed. qp_init()'s trailing
+    // qp_comms_stop() is skipped by this as well; the continuation manages
+    // comms start/stop around each burst itself.
+    driver->comms_vtable->comms_stop(device);
+    driver->validate_ok = false;
+
+    if (defer_exec_advanced(async_init_executors, QP_NUM_DEVICES, 1, qp_comms_async_sequence_callback, device) == INVALID_DEFERRED_TOKEN) {
+        // No executor slot: run the remainder synchronously rather than leaving the device dead.
+        qp_dprintf("qp_comms_bulk_command_sequence_async: no free executor, falling back to blocking init\n");
+        uint32_t delay;
+        while ((delay = qp_comms_async_sequence_callback(0, device)) != 0) {
+            wait_ms(delay);
+        }
+    }
+}
+
+// Advance any in-flight init sequences; called from qp_internal_task().
+void qp_internal_async_init_tick(void) {
+    static uint32_t last_async_init_exec = 0;
+    deferred_exec_advanced_task(async_init_executors, QP_NUM_DEVICES, &last_async_init_exec);
+}
+
+#endif // QUANTUM_PAINTER_ASYNC_INIT
@@ -16,6 +16,12 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+#ifdef QUANTUM_PAINTER_CHUNKED_TRANSFERS
+// Invoked between chunks when qp_comms_send splits a transfer larger than QUANTUM_PAINTER_CHUNK_SIZE. Weakly defined
+// to do nothing; override to run housekeeping that must not starve during long flushes.
+void qp_comms_chunk_yield(painter_device_t device);
+#endif // QUANTUM_PAINTER_CHUNKED_TRANSFERS
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -23,3 +29,11 @@ void     qp_comms_command(painter_device_t device, uint8_t cmd);
 void     qp_comms_command_databyte(painter_device_t device, uint8_t cmd, uint8_t data);
 uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void* data, uint32_t byte_count);
 void     qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
+
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+// Runs a bulk command sequence with each in-table delay executed as a deferred continuation instead of a blocking
+// wait_ms(). The device's validate_ok flag is cleared for the duration, so draws (and the public comms wrappers)
+// reject the device until the sequence completes; `finalize` then runs with comms started and validation restored,
+// for any post-sequence configuration (rotation, offsets). The sequence must point at static storage.
+void qp_comms_bulk_command_sequence_async(painter_device_t device, const uint8_t* sequence, size_t sequence_len, void (*finalize)(painter_device_t device));
+#endif // QUANTUM_PAINTER_ASYNC_INIT
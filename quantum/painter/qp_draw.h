@@ -21,6 +21,9 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
+// Unions the supplied bounding box into the device's accumulated dirty region -- invoked by each drawing primitive, reset on flush.
+void qp_internal_mark_dirty(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+
 // qp_setpixel internal implementation, but uses the global pixdata buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 
@@ -64,9 +67,10 @@ enum qp_internal_rle_mode_t {
 };
 
 typedef struct qp_internal_byte_input_state_t {
-    painter_device_t device;
-    qp_stream_t*     src_stream;
-    int16_t          curr;
+    painter_device_t      device;
+    qp_stream_t*          src_stream;
+    painter_compression_t compression; // recorded by qp_internal_prepare_input_state, allows downstream bulk fast paths
+    int16_t               curr;
     union {
         // RLE-specific
         struct {
@@ -98,3 +102,45 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter decoded-frame cache
+
+#ifdef QUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+// Draws a previously cached frame with a single viewport + pixdata pass. Returns false on a cache miss, in which case
+// the caller decodes the frame as usual. On a hit, `*delay` receives the frame's animation delay.
+bool qp_internal_image_cache_blit(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t* delay);
+
+// Decodes a frame into the cache arena (evicting least-recently-used frames as needed) and blits it through the
+// already-configured viewport. Drop-in replacement for qp_internal_appender, which it falls back to when the frame
+// cannot be cached. `left`..`bottom` are the frame-relative draw rectangle.
+bool qp_internal_image_cache_append(painter_device_t device, painter_image_handle_t image, uint16_t frame_number, uint8_t bpp, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t delay, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
+
+// Drops all cached frames belonging to an image; invoked when the image is closed as its handle slot may be reused.
+void qp_internal_image_cache_invalidate(painter_image_handle_t image);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter glyph atlas
+
+#ifdef QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+// Looks up a glyph's width without touching the font stream. Width is independent of device and recolor pair, so any
+// resident entry for the codepoint satisfies the query. Returns false if the glyph is not resident.
+bool qp_internal_glyph_atlas_get_width(painter_font_handle_t font, uint32_t code_point, uint8_t* width);
+
+// Draws a previously cached glyph with a single viewport + pixdata pass; comms must already be started. Returns false
+// on a miss, in which case the caller decodes the glyph as usual.
+bool qp_internal_glyph_atlas_blit(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t x, uint16_t y, uint8_t width, uint8_t height);
+
+// Decodes a glyph into the atlas arena (evicting least-recently-used glyphs as needed) and blits it through the
+// already-configured viewport. Drop-in replacement for qp_internal_appender, which it falls back to when the glyph
+// cannot be cached.
+bool qp_internal_glyph_atlas_append(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t bpp, uint8_t width, uint8_t height, qp_internal_byte_input_callback input_callback, void* input_state);
+
+// Returns a pointer to a resident glyph's native pixel data (and its width), or NULL on a miss. Touches the entry's
+// LRU stamp. The pointer stays valid until the next atlas allocation, as eviction compaction only happens then.
+const uint8_t* qp_internal_glyph_atlas_lookup(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t* width);
+
+// Drops all cached glyphs belonging to a font; invoked when the font is closed as its handle slot may be reused.
+void qp_internal_glyph_atlas_invalidate(painter_font_handle_t font);
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
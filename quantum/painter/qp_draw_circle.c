@@ -7,23 +7,18 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw circle outlines
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
     Two special cases exist and have been optimized:
     1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    equivalent, so we can omit them
+    2) offsetx == 0 (the starting point) makes half the symmetrical points
+    identical to their twins, so we only need four points
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -42,86 +37,76 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
         if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, centery)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, centery)) {
+            return false;
         }
     } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
+            return false;
         }
-
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
+            return false;
         }
     }
 
     return true;
 }
 
+// Span-based rasterization for filled circles: exactly one streamed horizontal span per scanline (mirrored about the
+// center), reusing the rect fill kernel. The symmetric fills of the outline walk redraw near-equator scanlines once
+// per step, costing roughly an order of magnitude more pixel writes for larger radii.
+static bool qp_circle_fill_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t radius) {
+    const int32_t rr = (int32_t)radius * (int32_t)radius;
+    int16_t       dx = (int16_t)radius;
+    for (int16_t dy = 0; dy <= (int16_t)radius; dy++) {
+        // The extent only shrinks as we move away from the equator, so this amortizes to O(radius) overall.
+        while (dx > 0 && ((int32_t)dx * dx + (int32_t)dy * dy) > rr) {
+            dx--;
+        }
+        if (!qp_internal_fillrect_helper_impl(device, ((int16_t)centerx) - dx, ((int16_t)centery) + dy, ((int16_t)centerx) + dx, ((int16_t)centery) + dy)) {
+            return false;
+        }
+        if (dy > 0 && !qp_internal_fillrect_helper_impl(device, ((int16_t)centerx) - dx, ((int16_t)centery) - dy, ((int16_t)centerx) + dx, ((int16_t)centery) - dy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_circle
 
@@ -133,6 +118,8 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
         return false;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_CIRCLE);
+
     // plot the initial set of points for x, y and r
     int16_t xcalc = 0;
     int16_t ycalc = (int16_t)radius;
@@ -146,22 +133,26 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     }
 
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
+    if (filled) {
+        ret = qp_circle_fill_impl(device, x, y, radius);
+    } else {
+        if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc)) {
+            ret = false;
+        }
 
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
-            if (err < 0) {
-                err += (xcalc << 1) + 1;
-            } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
-            }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-                ret = false;
-                break;
+        if (ret) {
+            while (xcalc < ycalc) {
+                xcalc++;
+                if (err < 0) {
+                    err += (xcalc << 1) + 1;
+                } else {
+                    ycalc--;
+                    err += ((xcalc - ycalc) << 1) + 1;
+                }
+                if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc)) {
+                    ret = false;
+                    break;
+                }
             }
         }
     }
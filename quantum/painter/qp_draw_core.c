@@ -42,9 +42,27 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Unions the supplied bounding box into the device's accumulated dirty region
+void qp_internal_mark_dirty(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver->dirty.is_dirty) {
+        driver->dirty.is_dirty = true;
+        driver->dirty.l        = left;
+        driver->dirty.t        = top;
+        driver->dirty.r        = right;
+        driver->dirty.b        = bottom;
+    } else {
+        driver->dirty.l = QP_MIN(driver->dirty.l, left);
+        driver->dirty.t = QP_MIN(driver->dirty.t, top);
+        driver->dirty.r = QP_MAX(driver->dirty.r, right);
+        driver->dirty.b = QP_MAX(driver->dirty.b, bottom);
+    }
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
+    qp_internal_mark_dirty(device, x, y, x, y);
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
@@ -58,11 +76,27 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
 
-    // Append the required number of pixels
-    uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
+    // Seed the buffer with enough pixels to fill a whole number of bytes, going through the driver's appender
+    uint32_t pixels_per_byte = driver->native_bits_per_pixel < 8 ? (8 / driver->native_bits_per_pixel) : 1;
+    uint32_t seed_pixels     = QP_MIN(num_pixels, pixels_per_byte);
+    uint8_t  palette_idx     = 0;
+    for (uint32_t i = 0; i < seed_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
+    if (num_pixels <= seed_pixels) {
+        return;
+    }
+
+    // Replicate the seeded pattern by doubling -- memcpy on the word-aligned buffer copies word-at-a-time, avoiding
+    // a function pointer call per pixel
+    uint32_t seed_bytes   = (seed_pixels * driver->native_bits_per_pixel + 7) / 8;
+    uint32_t total_bytes  = (num_pixels * driver->native_bits_per_pixel + 7) / 8;
+    uint32_t filled_bytes = seed_bytes;
+    while (filled_bytes < total_bytes) {
+        uint32_t bytes_this_loop = QP_MIN(filled_bytes, total_bytes - filled_bytes);
+        memcpy(&qp_internal_global_pixdata_buffer[filled_bytes], qp_internal_global_pixdata_buffer, bytes_this_loop);
+        filled_bytes += bytes_this_loop;
+    }
 }
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
@@ -151,6 +185,8 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
         return false;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_SETPIXEL);
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_setpixel\n");
         return false;
@@ -181,6 +217,8 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_LINE);
+
     if (!qp_comms_start(device)) {
         qp_dprintf("Failed to start comms in qp_line\n");
         return false;
@@ -240,6 +278,7 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     uint16_t h = b - t + 1;
 
     uint32_t remaining = w * h;
+    qp_internal_mark_dirty(device, l, t, r, b);
     driver->driver_vtable->viewport(device, l, t, r, b);
     while (remaining > 0) {
         uint32_t transmit = QP_MIN(remaining, pixels_in_pixdata);
@@ -259,6 +298,8 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
         return false;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_RECT);
+
     // Cater for cases where people have submitted the coordinates backwards
     uint16_t l = QP_MIN(left, right);
     uint16_t r = QP_MAX(left, right);
@@ -293,3 +334,73 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
     qp_dprintf("qp_rect(%d, %d, %d, %d): %s\n", (int)l, (int)t, (int)r, (int)b, ret ? "ok" : "fail");
     return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_rect_scanlines
+
+bool qp_rect_scanlines(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, qp_scanline_color_callback color_callback, void *cb_arg) {
+    qp_dprintf("qp_rect_scanlines(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_rect_scanlines: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!color_callback) {
+        qp_dprintf("qp_rect_scanlines: fail (no color callback supplied)\n");
+        return false;
+    }
+
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_RECT);
+
+    // Cater for cases where people have submitted the coordinates backwards
+    uint16_t l = QP_MIN(left, right);
+    uint16_t r = QP_MAX(left, right);
+    uint16_t t = QP_MIN(top, bottom);
+    uint16_t b = QP_MAX(top, bottom);
+    uint16_t w = r - l + 1;
+    uint16_t h = b - t + 1;
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("Failed to start comms in qp_rect_scanlines\n");
+        return false;
+    }
+
+    // Set the viewport over the whole rectangle once -- each row's pixels then stream back-to-back with no further
+    // positioning commands, wrapping onto the next row at the window edge.
+    uint32_t pixels_in_pixdata = qp_internal_num_pixels_in_buffer(device);
+    qp_internal_mark_dirty(device, l, t, r, b);
+    driver->driver_vtable->viewport(device, l, t, r, b);
+
+    bool    ret        = true;
+    bool    have_color = false;
+    uint8_t last_hue = 0, last_sat = 0, last_val = 0;
+    for (uint16_t row = 0; row < h && ret; ++row) {
+        uint8_t hue = last_hue, sat = last_sat, val = last_val;
+        color_callback(row, &hue, &sat, &val, cb_arg);
+
+        // Quantised gradients repeat the same color across consecutive rows -- only re-convert and refill the
+        // pixdata buffer when the color actually changes.
+        if (!have_color || hue != last_hue || sat != last_sat || val != last_val) {
+            qp_internal_fill_pixdata(device, w, hue, sat, val);
+            have_color = true;
+            last_hue   = hue;
+            last_sat   = sat;
+            last_val   = val;
+        }
+
+        uint32_t remaining = w;
+        while (remaining > 0) {
+            uint32_t transmit = QP_MIN(remaining, pixels_in_pixdata);
+            if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, transmit)) {
+                ret = false;
+                break;
+            }
+            remaining -= transmit;
+        }
+    }
+
+    qp_comms_stop(device);
+    qp_dprintf("qp_rect_scanlines(%d, %d, %d, %d): %s\n", (int)l, (int)t, (int)r, (int)b, ret ? "ok" : "fail");
+    return ret;
+}
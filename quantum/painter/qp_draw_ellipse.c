@@ -6,17 +6,14 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw an ellipse outline
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    When offsetx == 0 only two pixels can be drawn
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -31,13 +28,6 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
         if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
             return false;
         }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
     } else {
         if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
             return false;
@@ -56,6 +46,30 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     return true;
 }
 
+// Span-based rasterization for filled ellipses: one streamed horizontal span per scanline (mirrored about the
+// center), reusing the rect fill kernel instead of the overlapping symmetric fills of the outline walk.
+static bool qp_ellipse_fill_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t sizex, uint16_t sizey) {
+    // Points inside satisfy (dx*b)^2 + (dy*a)^2 <= (a*b)^2; 64-bit as the products overflow 32 bits on larger panels.
+    const int64_t aa = (int64_t)sizex * sizex;
+    const int64_t bb = (int64_t)sizey * sizey;
+    const int64_t rr = aa * bb;
+
+    int16_t dx = (int16_t)sizex;
+    for (int16_t dy = 0; dy <= (int16_t)sizey; dy++) {
+        // The extent only shrinks moving away from the equator, so this amortizes to O(sizex + sizey) overall.
+        while (dx > 0 && (bb * dx * dx + aa * dy * dy) > rr) {
+            dx--;
+        }
+        if (!qp_internal_fillrect_helper_impl(device, ((int16_t)centerx) - dx, ((int16_t)centery) + dy, ((int16_t)centerx) + dx, ((int16_t)centery) + dy)) {
+            return false;
+        }
+        if (dy > 0 && !qp_internal_fillrect_helper_impl(device, ((int16_t)centerx) - dx, ((int16_t)centery) - dy, ((int16_t)centerx) + dx, ((int16_t)centery) - dy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_ellipse
 
@@ -67,6 +81,8 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         return false;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_ELLIPSE);
+
     int32_t aa = ((int32_t)sizex) * ((int32_t)sizex);
     int32_t bb = ((int32_t)sizey) * ((int32_t)sizey);
     int32_t fa = 4 * aa;
@@ -75,7 +91,7 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    qp_internal_fill_pixdata(device, (sizex * 2) + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
@@ -83,31 +99,35 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     }
 
     bool ret = true;
-    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
-        if (delta >= 0) {
-            delta += fa * (1 - dy);
-            dy--;
+    if (filled) {
+        ret = qp_ellipse_fill_impl(device, x, y, sizex, sizey);
+    } else {
+        for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+            if (!qp_ellipse_helper_impl(device, x, y, dx, dy)) {
+                ret = false;
+                break;
+            }
+            if (delta >= 0) {
+                delta += fa * (1 - dy);
+                dy--;
+            }
+            delta += bb * (4 * dx + 6);
         }
-        delta += bb * (4 * dx + 6);
-    }
-
-    dx = sizex;
-    dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
-        if (delta >= 0) {
-            delta += fb * (1 - dx);
-            dx--;
+        dx = sizex;
+        dy = 0;
+
+        for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+            if (!qp_ellipse_helper_impl(device, x, y, dx, dy)) {
+                ret = false;
+                break;
+            }
+            if (delta >= 0) {
+                delta += fb * (1 - dx);
+                dx--;
+            }
+            delta += aa * (4 * dy + 6);
         }
-        delta += aa * (4 * dy + 6);
     }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
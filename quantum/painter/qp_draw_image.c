@@ -1,6 +1,8 @@
 // Copyright 2021-2023 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
@@ -13,6 +15,11 @@
 typedef struct qgf_image_handle_t {
     painter_image_desc_t base;
     bool                 validate_ok;
+#ifdef QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+    // Build-time palette already in the panel's native format; draws bypass interpolation and palette conversion.
+    const qp_pixel_t *native_palette;
+    uint16_t          native_palette_entries;
+#endif
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -98,9 +105,36 @@ bool qp_close_image(painter_image_handle_t image) {
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
+#ifdef QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+    qgf_image->native_palette         = NULL;
+    qgf_image->native_palette_entries = 0;
+#endif
+#ifdef QUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+    // The handle slot may be reused by a different image, so any cached frames are now stale.
+    qp_internal_image_cache_invalidate(image);
+#endif
+    return true;
+}
+
+#ifdef QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_image_set_native_palette
+
+bool qp_image_set_native_palette(painter_image_handle_t image, const qp_pixel_t *palette, uint16_t entries) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_image_set_native_palette: fail (invalid image)\n");
+        return false;
+    }
+
+    qgf_image->native_palette         = palette;
+    qgf_image->native_palette_entries = entries;
     return true;
 }
 
+#endif // QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_drawimage
 
@@ -160,7 +194,25 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     // Handle palette if needed
     const uint16_t palette_entries  = 1u << info->bpp;
     bool           needs_pixconvert = false;
-    if (info->has_palette) {
+#ifdef QUANTUM_PAINTER_PRECOMPUTED_PALETTES
+    if (qgf_image->native_palette != NULL && info->bpp <= 8 && palette_entries <= qgf_image->native_palette_entries) {
+        if (info->has_palette) {
+            // Advance past the in-asset palette block; the precomputed palette supersedes its contents.
+            qgf_palette_v1_t palette_descriptor;
+            if (qp_stream_read(&palette_descriptor, sizeof(qgf_palette_v1_t), 1, &qgf_image->stream) != 1) {
+                qp_dprintf("Failed to read palette_descriptor, expected length was not %d\n", (int)sizeof(qgf_palette_v1_t));
+                return false;
+            }
+            if (qp_stream_seek(&qgf_image->stream, palette_entries * sizeof(qgf_palette_entry_v1_t), SEEK_CUR) != 0) {
+                qp_dprintf("Failed to skip the in-asset palette block\n");
+                return false;
+            }
+        }
+        // The attached palette is already in the panel's native format -- no interpolation and no palette_convert.
+        memcpy(qp_internal_global_pixel_lookup_table, qgf_image->native_palette, palette_entries * sizeof(qp_pixel_t));
+    } else
+#endif
+        if (info->has_palette) {
         // Load the palette from the stream
         if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
             return false;
@@ -222,6 +274,14 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+#ifdef QUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+    // If this frame has already been decoded, blit it straight from the cache and skip the stream entirely
+    if (qp_internal_image_cache_blit(device, x, y, image, frame_number, fg_hsv888, bg_hsv888, &frame_info->delay)) {
+        qp_dprintf("qp_drawimage_recolor: ok (image cache)\n");
+        return true;
+    }
+#endif
+
     // Read the frame info
     if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
@@ -248,6 +308,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
     // Configure where we're going to be rendering to
+    qp_internal_mark_dirty(device, l, t, r, b);
     if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
         qp_comms_stop(device);
@@ -264,7 +325,11 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
 
     // Decode and stream pixels
+#ifdef QUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+    bool ret = qp_internal_image_cache_append(device, image, frame_number, frame_info->bpp, fg_hsv888, bg_hsv888, l - x, t - y, r - x, b - y, frame_info->delay, pixel_count, input_callback, &input_state);
+#else
     bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+#endif
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -275,6 +340,7 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_IMAGE);
     return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
 }
 
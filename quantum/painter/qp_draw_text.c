@@ -154,6 +154,10 @@ bool qp_close_font(painter_font_handle_t font) {
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
+#ifdef QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+    // The handle slot may be reused by a different font, so any cached glyphs are now stale.
+    qp_internal_glyph_atlas_invalidate(font);
+#endif
     return true;
 }
 
@@ -303,7 +307,13 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        bool    have_width = false;
+#ifdef QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+        // Glyphs already resident in the atlas need no stream parsing; the draw handler repositions the stream
+        // itself if it turns out it still has to decode.
+        have_width = qp_internal_glyph_atlas_get_width((painter_font_handle_t)qff_font, code_point, &width);
+#endif
+        if (!have_width && !qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
@@ -342,6 +352,8 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
@@ -352,6 +364,20 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
 
+#ifdef QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+    // Blit straight from the atlas if this glyph has already been decoded for this device and recolor pair
+    if (qp_internal_glyph_atlas_blit(state->device, (painter_font_handle_t)qff_font, code_point, state->fg_hsv888, state->bg_hsv888, state->xpos, state->ypos, width, height)) {
+        state->xpos += width;
+        return true;
+    }
+
+    // Atlas miss -- (re)position the stream at the glyph data, as the width may have come from the atlas without
+    // any stream parsing having occurred
+    if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        return false;
+    }
+#endif
+
     // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
@@ -359,15 +385,103 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     state->output_state->pixel_write_pos = 0;
 
     // Configure where we're going to be rendering to
+    qp_internal_mark_dirty(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
     driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
 
     // Move the x-position for the next glyph
     state->xpos += width;
 
     // Decode the pixel data for the glyph, and stream it
+#ifdef QUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+    return qp_internal_glyph_atlas_append(state->device, (painter_font_handle_t)qff_font, code_point, state->fg_hsv888, state->bg_hsv888, qff_font->bpp, width, height, state->input_callback, state->input_state);
+#else
     uint32_t pixel_count = ((uint32_t)width) * height;
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+#endif
+}
+
+#ifdef QUANTUM_PAINTER_TEXT_SPAN_ENABLE
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Whole-run span rendering
+
+// Renders an entire text run through a single viewport, compositing atlas-resident glyphs into whole-row stripes of
+// the shared pixdata buffer instead of issuing a viewport and pixel stream per glyph. Only attempted when every glyph
+// in the run is already resident in the atlas for this device and recolor pair, and when the native format is
+// byte-aligned so glyph rows can be memcpy'd; anything else returns false and the caller falls back to the per-glyph
+// path, which populates the atlas so the next draw of the same run takes the span path.
+static bool qp_drawtext_span(painter_device_t device, uint16_t x, uint16_t y, qff_font_handle_t *qff_font, const char *str, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t *width_out) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if ((driver->native_bits_per_pixel % 8) != 0) {
+        return false;
+    }
+
+    // Gather the run's glyphs from the atlas
+    const uint8_t *glyph_data[QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS];
+    uint8_t        glyph_widths[QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS];
+    uint8_t        glyph_count = 0;
+    uint16_t       run_width   = 0;
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (code_point < 0 || glyph_count >= QUANTUM_PAINTER_TEXT_SPAN_MAX_GLYPHS) {
+            return false;
+        }
+
+        uint8_t        width;
+        const uint8_t *data = qp_internal_glyph_atlas_lookup(device, (painter_font_handle_t)qff_font, code_point, fg_hsv888, bg_hsv888, &width);
+        if (!data) {
+            return false;
+        }
+
+        glyph_data[glyph_count]   = data;
+        glyph_widths[glyph_count] = width;
+        glyph_count++;
+        run_width += width;
+    }
+
+    if (run_width == 0) {
+        *width_out = 0;
+        return true;
+    }
+
+    // Stripe whole rows of the run through the shared pixdata buffer
+    const uint8_t  bytes_per_pixel = driver->native_bits_per_pixel / 8;
+    const uint32_t run_row_bytes   = (uint32_t)run_width * bytes_per_pixel;
+    const uint16_t rows_per_stripe = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / run_row_bytes;
+    const uint8_t  height          = qff_font->base.line_height;
+    if (rows_per_stripe == 0) {
+        // Run too wide for even a single composited row
+        return false;
+    }
+
+    // One viewport covers the whole run; each pixdata call below continues the same pixel stream
+    qp_internal_mark_dirty(device, x, y, x + run_width - 1, y + height - 1);
+    if (!driver->driver_vtable->viewport(device, x, y, x + run_width - 1, y + height - 1)) {
+        return false;
+    }
+
+    uint16_t row = 0;
+    while (row < height) {
+        uint16_t rows_this_stripe = QP_MIN(rows_per_stripe, (uint16_t)(height - row));
+        uint8_t *target           = qp_internal_global_pixdata_buffer;
+        for (uint16_t r = 0; r < rows_this_stripe; ++r) {
+            for (uint8_t g = 0; g < glyph_count; ++g) {
+                uint32_t glyph_row_bytes = (uint32_t)glyph_widths[g] * bytes_per_pixel;
+                memcpy(target, glyph_data[g] + ((uint32_t)(row + r) * glyph_row_bytes), glyph_row_bytes);
+                target += glyph_row_bytes;
+            }
+        }
+
+        if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, (uint32_t)rows_this_stripe * run_width)) {
+            return false;
+        }
+        row += rows_this_stripe;
+    }
+
+    *width_out = run_width;
+    return true;
 }
+#endif // QUANTUM_PAINTER_TEXT_SPAN_ENABLE
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_textwidth
@@ -405,6 +519,8 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return 0;
     }
 
+    qp_perf_draw(device, QP_PERF_PRIMITIVE_TEXT);
+
     qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
     if (!qff_font || !qff_font->validate_ok) {
         qp_dprintf("qp_drawtext_recolor: fail (invalid font)\n");
@@ -416,6 +532,20 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return 0;
     }
 
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+
+#ifdef QUANTUM_PAINTER_TEXT_SPAN_ENABLE
+    // Whole-run fast path: when every glyph is already resident in the atlas, composite the run and transmit it
+    // through a single viewport, skipping the palette setup and per-glyph streaming below entirely.
+    int16_t span_width;
+    if (qp_drawtext_span(device, x, y, qff_font, str, fg_hsv888, bg_hsv888, &span_width)) {
+        qp_dprintf("qp_drawtext_recolor: ok (span)\n");
+        qp_comms_stop(device);
+        return span_width;
+    }
+#endif // QUANTUM_PAINTER_TEXT_SPAN_ENABLE
+
     // Set up the byte input state and input callback
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
@@ -430,18 +560,18 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     // Set up the codepoint iteration state
     code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
+                                               .device    = device,
+                                               .xpos      = x,
+                                               .ypos      = y,
+                                               .fg_hsv888 = fg_hsv888,
+                                               .bg_hsv888 = bg_hsv888,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -0,0 +1,218 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QFF glyph atlas
+//
+// Caches decoded glyph bitmaps in the target display's native pixel format, keyed by codepoint (plus font, device and
+// recolor pair). Steady-state text rendering then does zero font stream parsing: widths come from the atlas entry and
+// pixels are blitted straight from the arena. The least-recently-used glyph is evicted (with compaction) when the
+// arena or the entry table fills up.
+
+typedef struct qp_glyph_atlas_entry_t {
+    bool                  used;
+    painter_device_t      device;
+    painter_font_handle_t font;
+    uint32_t              code_point;
+    qp_pixel_t            fg_hsv888;
+    qp_pixel_t            bg_hsv888;
+    uint8_t               width;
+    // Location of the decoded native pixel data within the arena
+    uint32_t offset;
+    uint32_t length;
+    uint32_t last_used;
+} qp_glyph_atlas_entry_t;
+
+static uint8_t                qp_glyph_atlas_arena[QUANTUM_PAINTER_GLYPH_ATLAS_SIZE];
+static qp_glyph_atlas_entry_t qp_glyph_atlas_entries[QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS] = {0};
+static uint32_t               qp_glyph_atlas_arena_used                                      = 0;
+static uint32_t               qp_glyph_atlas_lru_tick                                        = 0;
+
+static inline bool qp_glyph_atlas_color_equal(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static qp_glyph_atlas_entry_t *qp_glyph_atlas_find(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+        qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+        if (entry->used && entry->device == device && entry->font == font && entry->code_point == code_point && qp_glyph_atlas_color_equal(entry->fg_hsv888, fg_hsv888) && qp_glyph_atlas_color_equal(entry->bg_hsv888, bg_hsv888)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_glyph_atlas_remove(qp_glyph_atlas_entry_t *victim) {
+    // Compact the arena so the free space stays contiguous at the end, fixing up the offsets of the moved blocks.
+    uint32_t tail = victim->offset + victim->length;
+    memmove(&qp_glyph_atlas_arena[victim->offset], &qp_glyph_atlas_arena[tail], qp_glyph_atlas_arena_used - tail);
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+        qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+        if (entry->used && entry->offset > victim->offset) {
+            entry->offset -= victim->length;
+        }
+    }
+    qp_glyph_atlas_arena_used -= victim->length;
+    victim->used = false;
+}
+
+static bool qp_glyph_atlas_evict_lru(void) {
+    qp_glyph_atlas_entry_t *victim = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+        qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+        if (entry->used && (!victim || entry->last_used < victim->last_used)) {
+            victim = entry;
+        }
+    }
+    if (!victim) {
+        return false;
+    }
+    qp_glyph_atlas_remove(victim);
+    return true;
+}
+
+static qp_glyph_atlas_entry_t *qp_glyph_atlas_allocate(uint32_t required) {
+    if (required > QUANTUM_PAINTER_GLYPH_ATLAS_SIZE) {
+        return NULL;
+    }
+
+    // Make room in the arena
+    while (qp_glyph_atlas_arena_used + required > QUANTUM_PAINTER_GLYPH_ATLAS_SIZE) {
+        if (!qp_glyph_atlas_evict_lru()) {
+            return NULL;
+        }
+    }
+
+    // Find a free entry slot, evicting if all are occupied
+    while (true) {
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+            qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+            if (!entry->used) {
+                entry->offset = qp_glyph_atlas_arena_used;
+                entry->length = required;
+                qp_glyph_atlas_arena_used += required;
+                return entry;
+            }
+        }
+        if (!qp_glyph_atlas_evict_lru()) {
+            return NULL;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decode-into-arena output callbacks
+
+typedef struct qp_glyph_atlas_output_state_t {
+    painter_device_t device;
+    uint8_t         *buffer;
+    uint32_t         write_pos;
+} qp_glyph_atlas_output_state_t;
+
+static bool qp_glyph_atlas_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_glyph_atlas_output_state_t *state  = (qp_glyph_atlas_output_state_t *)cb_arg;
+    painter_driver_t              *driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->write_pos++, 1, &index);
+}
+
+static bool qp_glyph_atlas_byte_appender(uint8_t byteval, void *cb_arg) {
+    qp_glyph_atlas_output_state_t *state  = (qp_glyph_atlas_output_state_t *)cb_arg;
+    painter_driver_t              *driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->buffer, state->write_pos++, byteval);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Internal API
+
+bool qp_internal_glyph_atlas_get_width(painter_font_handle_t font, uint32_t code_point, uint8_t *width) {
+    // Glyph width is independent of device and recolor pair, so any matching entry will do.
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+        qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+        if (entry->used && entry->font == font && entry->code_point == code_point) {
+            *width = entry->width;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool qp_internal_glyph_atlas_blit(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t x, uint16_t y, uint8_t width, uint8_t height) {
+    painter_driver_t       *driver = (painter_driver_t *)device;
+    qp_glyph_atlas_entry_t *entry  = qp_glyph_atlas_find(device, font, code_point, fg_hsv888, bg_hsv888);
+    if (!entry) {
+        return false;
+    }
+
+    qp_internal_mark_dirty(device, x, y, x + width - 1, y + height - 1);
+    if (!driver->driver_vtable->viewport(device, x, y, x + width - 1, y + height - 1)) {
+        return false;
+    }
+
+    entry->last_used = ++qp_glyph_atlas_lru_tick;
+    return driver->driver_vtable->pixdata(device, &qp_glyph_atlas_arena[entry->offset], ((uint32_t)width) * height);
+}
+
+bool qp_internal_glyph_atlas_append(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t bpp, uint8_t width, uint8_t height, qp_internal_byte_input_callback input_callback, void *input_state) {
+    painter_driver_t *driver      = (painter_driver_t *)device;
+    uint32_t          pixel_count = ((uint32_t)width) * height;
+
+    // Glyphs that can't be decoded into the arena are streamed to the display as usual.
+    uint32_t                required = (pixel_count * driver->native_bits_per_pixel + 7) / 8;
+    qp_glyph_atlas_entry_t *entry    = (bpp <= 8 || bpp == driver->native_bits_per_pixel) ? qp_glyph_atlas_allocate(required) : NULL;
+    if (!entry) {
+        return qp_internal_appender(device, bpp, pixel_count, input_callback, input_state);
+    }
+
+    // Decode the glyph into the arena in native format
+    qp_glyph_atlas_output_state_t output_state = {.device = device, .buffer = &qp_glyph_atlas_arena[entry->offset], .write_pos = 0};
+
+    bool ok;
+    if (bpp <= 8) {
+        ok = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_glyph_atlas_pixel_appender, &output_state);
+    } else {
+        ok = qp_internal_send_bytes(device, pixel_count * bpp / 8, input_callback, input_state, qp_glyph_atlas_byte_appender, &output_state);
+    }
+
+    if (!ok) {
+        // Roll back the allocation -- it is always the last block in the arena.
+        qp_glyph_atlas_arena_used -= entry->length;
+        return false;
+    }
+
+    entry->used       = true;
+    entry->device     = device;
+    entry->font       = font;
+    entry->code_point = code_point;
+    entry->fg_hsv888  = fg_hsv888;
+    entry->bg_hsv888  = bg_hsv888;
+    entry->width      = width;
+    entry->last_used  = ++qp_glyph_atlas_lru_tick;
+
+    // First draw: blit the freshly decoded glyph through the already-configured viewport
+    return driver->driver_vtable->pixdata(device, &qp_glyph_atlas_arena[entry->offset], pixel_count);
+}
+
+const uint8_t *qp_internal_glyph_atlas_lookup(painter_device_t device, painter_font_handle_t font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t *width) {
+    qp_glyph_atlas_entry_t *entry = qp_glyph_atlas_find(device, font, code_point, fg_hsv888, bg_hsv888);
+    if (!entry) {
+        return NULL;
+    }
+
+    entry->last_used = ++qp_glyph_atlas_lru_tick;
+    *width           = entry->width;
+    return &qp_glyph_atlas_arena[entry->offset];
+}
+
+void qp_internal_glyph_atlas_invalidate(painter_font_handle_t font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_MAX_GLYPHS; ++i) {
+        qp_glyph_atlas_entry_t *entry = &qp_glyph_atlas_entries[i];
+        if (entry->used && entry->font == font) {
+            qp_glyph_atlas_remove(entry);
+        }
+    }
+}
@@ -0,0 +1,226 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_comms.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QGF decoded-frame cache
+//
+// Frames are decoded once into their target display's native pixel format and kept in a fixed-size arena; repeat draws
+// of the same frame become a single viewport + pixdata call instead of re-parsing block headers and re-running the
+// RLE/palette decode. Blocks are allocated bump-style from the arena and the least-recently-used frame is evicted
+// (with compaction) whenever space runs out.
+
+typedef struct qp_image_cache_entry_t {
+    bool                   used;
+    painter_device_t       device;
+    painter_image_handle_t image;
+    uint16_t               frame_number;
+    qp_pixel_t             fg_hsv888;
+    qp_pixel_t             bg_hsv888;
+    // Frame-relative draw rectangle (equal to the delta rectangle for delta frames)
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+    // Animation frame delay, so cache hits can skip reading the frame descriptor entirely
+    uint16_t delay;
+    // Location of the decoded native pixel data within the arena
+    uint32_t offset;
+    uint32_t length;
+    uint32_t pixel_count;
+    uint32_t last_used;
+} qp_image_cache_entry_t;
+
+static uint8_t                qp_image_cache_arena[QUANTUM_PAINTER_IMAGE_CACHE_SIZE];
+static qp_image_cache_entry_t qp_image_cache_entries[QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES] = {0};
+static uint32_t               qp_image_cache_arena_used                                       = 0;
+static uint32_t               qp_image_cache_lru_tick                                         = 0;
+
+static inline bool qp_image_cache_color_equal(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static qp_image_cache_entry_t *qp_image_cache_find(painter_device_t device, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES; ++i) {
+        qp_image_cache_entry_t *entry = &qp_image_cache_entries[i];
+        if (entry->used && entry->device == device && entry->image == image && entry->frame_number == frame_number && qp_image_cache_color_equal(entry->fg_hsv888, fg_hsv888) && qp_image_cache_color_equal(entry->bg_hsv888, bg_hsv888)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_image_cache_remove(qp_image_cache_entry_t *victim) {
+    // Compact the arena so the free space stays contiguous at the end, fixing up the offsets of the moved blocks.
+    uint32_t tail = victim->offset + victim->length;
+    memmove(&qp_image_cache_arena[victim->offset], &qp_image_cache_arena[tail], qp_image_cache_arena_used - tail);
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES; ++i) {
+        qp_image_cache_entry_t *entry = &qp_image_cache_entries[i];
+        if (entry->used && entry->offset > victim->offset) {
+            entry->offset -= victim->length;
+        }
+    }
+    qp_image_cache_arena_used -= victim->length;
+    victim->used = false;
+}
+
+static bool qp_image_cache_evict_lru(void) {
+    qp_image_cache_entry_t *victim = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES; ++i) {
+        qp_image_cache_entry_t *entry = &qp_image_cache_entries[i];
+        if (entry->used && (!victim || entry->last_used < victim->last_used)) {
+            victim = entry;
+        }
+    }
+    if (!victim) {
+        return false;
+    }
+    qp_image_cache_remove(victim);
+    return true;
+}
+
+static qp_image_cache_entry_t *qp_image_cache_allocate(uint32_t required) {
+    if (required > QUANTUM_PAINTER_IMAGE_CACHE_SIZE) {
+        return NULL;
+    }
+
+    // Make room in the arena
+    while (qp_image_cache_arena_used + required > QUANTUM_PAINTER_IMAGE_CACHE_SIZE) {
+        if (!qp_image_cache_evict_lru()) {
+            return NULL;
+        }
+    }
+
+    // Find a free entry slot, evicting if all are occupied
+    while (true) {
+        for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES; ++i) {
+            qp_image_cache_entry_t *entry = &qp_image_cache_entries[i];
+            if (!entry->used) {
+                entry->offset = qp_image_cache_arena_used;
+                entry->length = required;
+                qp_image_cache_arena_used += required;
+                return entry;
+            }
+        }
+        if (!qp_image_cache_evict_lru()) {
+            return NULL;
+        }
+    }
+}
+
+static void qp_image_cache_release_unused(qp_image_cache_entry_t *entry) {
+    // Roll back an allocation that was never committed -- it is always the last block in the arena.
+    qp_image_cache_arena_used -= entry->length;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decode-into-arena output callbacks
+
+typedef struct qp_image_cache_output_state_t {
+    painter_device_t device;
+    uint8_t         *buffer;
+    uint32_t         write_pos;
+} qp_image_cache_output_state_t;
+
+static bool qp_image_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_image_cache_output_state_t *state  = (qp_image_cache_output_state_t *)cb_arg;
+    painter_driver_t              *driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->write_pos++, 1, &index);
+}
+
+static bool qp_image_cache_byte_appender(uint8_t byteval, void *cb_arg) {
+    qp_image_cache_output_state_t *state  = (qp_image_cache_output_state_t *)cb_arg;
+    painter_driver_t              *driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->buffer, state->write_pos++, byteval);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Internal API
+
+bool qp_internal_image_cache_blit(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t *delay) {
+    painter_driver_t       *driver = (painter_driver_t *)device;
+    qp_image_cache_entry_t *entry  = qp_image_cache_find(device, image, frame_number, fg_hsv888, bg_hsv888);
+    if (!entry) {
+        return false;
+    }
+
+    uint16_t l = x + entry->left;
+    uint16_t t = y + entry->top;
+    uint16_t r = x + entry->right;
+    uint16_t b = y + entry->bottom;
+
+    if (!qp_comms_start(device)) {
+        return false;
+    }
+
+    qp_internal_mark_dirty(device, l, t, r, b);
+    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
+        qp_comms_stop(device);
+        return false;
+    }
+
+    bool ret = driver->driver_vtable->pixdata(device, &qp_image_cache_arena[entry->offset], entry->pixel_count);
+    qp_comms_stop(device);
+
+    entry->last_used = ++qp_image_cache_lru_tick;
+    *delay           = entry->delay;
+    return ret;
+}
+
+bool qp_internal_image_cache_append(painter_device_t device, painter_image_handle_t image, uint16_t frame_number, uint8_t bpp, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t delay, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void *input_state) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Frames that can't be decoded into the arena (too large, or a native-format mismatch the direct path will
+    // reject anyway) are streamed to the display as usual.
+    uint32_t                required = (pixel_count * driver->native_bits_per_pixel + 7) / 8;
+    qp_image_cache_entry_t *entry    = (bpp <= 8 || bpp == driver->native_bits_per_pixel) ? qp_image_cache_allocate(required) : NULL;
+    if (!entry) {
+        return qp_internal_appender(device, bpp, pixel_count, input_callback, input_state);
+    }
+
+    // Decode the full frame into the arena in native format
+    qp_image_cache_output_state_t output_state = {.device = device, .buffer = &qp_image_cache_arena[entry->offset], .write_pos = 0};
+
+    bool ok;
+    if (bpp <= 8) {
+        ok = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_image_cache_pixel_appender, &output_state);
+    } else {
+        ok = qp_internal_send_bytes(device, pixel_count * bpp / 8, input_callback, input_state, qp_image_cache_byte_appender, &output_state);
+    }
+
+    if (!ok) {
+        qp_image_cache_release_unused(entry);
+        return false;
+    }
+
+    entry->used         = true;
+    entry->device       = device;
+    entry->image        = image;
+    entry->frame_number = frame_number;
+    entry->fg_hsv888    = fg_hsv888;
+    entry->bg_hsv888    = bg_hsv888;
+    entry->left         = left;
+    entry->top          = top;
+    entry->right        = right;
+    entry->bottom       = bottom;
+    entry->delay        = delay;
+    entry->pixel_count  = pixel_count;
+    entry->last_used    = ++qp_image_cache_lru_tick;
+
+    // First draw: blit the freshly decoded frame through the already-configured viewport
+    return driver->driver_vtable->pixdata(device, &qp_image_cache_arena[entry->offset], pixel_count);
+}
+
+void qp_internal_image_cache_invalidate(painter_image_handle_t image) {
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_MAX_ENTRIES; ++i) {
+        qp_image_cache_entry_t *entry = &qp_image_cache_entries[i];
+        if (entry->used && entry->image == image) {
+            qp_image_cache_remove(entry);
+        }
+    }
+}
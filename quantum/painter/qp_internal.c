@@ -40,6 +40,10 @@ bool qp_internal_register_device(painter_device_t driver) {
     return false;
 }
 
+painter_device_t qp_internal_device_at(uint8_t index) {
+    return index < QP_NUM_DEVICES ? qp_devices[index] : NULL;
+}
+
 #if (QUANTUM_PAINTER_DISPLAY_TIMEOUT) > 0
 static void qp_internal_display_timeout_task(void) {
     // Handle power on/off state
@@ -84,6 +88,12 @@ void qp_internal_task(void) {
     qp_internal_display_timeout_task();
 #endif // (QUANTUM_PAINTER_DISPLAY_TIMEOUT) > 0
 
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+    // Advance any in-flight deferred init sequences
+    void qp_internal_async_init_tick(void);
+    qp_internal_async_init_tick();
+#endif
+
     // Handle animations
     void qp_internal_animation_tick(void);
     qp_internal_animation_tick();
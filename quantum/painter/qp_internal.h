@@ -26,6 +26,22 @@
         } while (0)
 #endif
 
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+// Performance counter hooks, compiled out when the feature is disabled. The draw hook is invoked once per public
+// draw-call entry point; the bytes hook is invoked from qp_comms_send with the number of bytes actually transmitted.
+void qp_perf_record_draw(painter_device_t device, uint8_t primitive);
+void qp_perf_record_bytes(painter_device_t device, uint32_t byte_count);
+#    define qp_perf_draw(device, primitive) qp_perf_record_draw((device), (primitive))
+#    define qp_perf_bytes(device, byte_count) qp_perf_record_bytes((device), (byte_count))
+#else
+#    define qp_perf_draw(device, primitive) \
+        do {                                \
+        } while (0)
+#    define qp_perf_bytes(device, byte_count) \
+        do {                                  \
+        } while (0)
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Specific internal definitions
 
@@ -17,6 +17,8 @@ typedef bool (*painter_driver_pixdata_func)(painter_device_t device, const void
 typedef bool (*painter_driver_convert_palette_func)(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 typedef bool (*painter_driver_append_pixels)(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 typedef bool (*painter_driver_append_pixdata)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+typedef bool (*painter_driver_scroll_region_func)(painter_device_t device, uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines);
+typedef bool (*painter_driver_scroll_start_func)(painter_device_t device, uint16_t line);
 
 // Driver vtable definition
 typedef struct painter_driver_vtable_t {
@@ -29,6 +31,8 @@ typedef struct painter_driver_vtable_t {
     painter_driver_convert_palette_func palette_convert;
     painter_driver_append_pixels        append_pixels;
     painter_driver_append_pixdata       append_pixdata;
+    painter_driver_scroll_region_func   scroll_region; // optional, NULL if the panel has no hardware scrolling
+    painter_driver_scroll_start_func    scroll_start;  // optional, NULL if the panel has no hardware scrolling
 } painter_driver_vtable_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +69,11 @@ typedef struct painter_driver_t {
     // Flag signifying if validation was successful
     bool validate_ok;
 
+    // Set for the duration of a qp_init_warm() call: comms/panel drivers that support it skip the
+    // destructive parts of initialization (reset pulse, panel reset/init sequence) so a panel that
+    // never lost power keeps displaying its content.
+    bool warm_init;
+
     // Panel geometry
     uint16_t panel_width;
     uint16_t panel_height;
@@ -81,9 +90,52 @@ typedef struct painter_driver_t {
 
     // Comms config pointer -- needs to point to an appropriate comms config if the comms driver requires it.
     void *comms_config;
+
+#ifdef QUANTUM_PAINTER_WINDOW_CACHE
+    // Last GRAM window sent to the panel (post-offset/swap), so panel drivers can skip
+    // re-sending the column/row address commands when consecutive draws target the same
+    // window. Invalidated whenever the panel is (re-)initialized.
+    struct {
+        bool     valid;
+        uint16_t l;
+        uint16_t t;
+        uint16_t r;
+        uint16_t b;
+    } window_cache;
+#endif // QUANTUM_PAINTER_WINDOW_CACHE
+
+#ifdef QUANTUM_PAINTER_ASYNC_INIT
+    // In-flight deferred init sequence state; see qp_comms_bulk_command_sequence_async().
+    const uint8_t *async_init_sequence;
+    size_t         async_init_sequence_len;
+    size_t         async_init_offset;
+    void (*async_init_finalize)(painter_device_t device);
+#endif // QUANTUM_PAINTER_ASYNC_INIT
+
+#ifdef QUANTUM_PAINTER_PERF_COUNTERS
+    // Performance counters queryable via qp_get_perf_counters(), plus the bookkeeping needed to
+    // maintain them: the throughput window accumulates comms bytes until a second has elapsed.
+    struct {
+        qp_perf_counters_t counters;
+        uint32_t           bytes_window_start;
+        uint32_t           bytes_window_accum;
+    } perf;
+#endif // QUANTUM_PAINTER_PERF_COUNTERS
+
+    // Dirty region accumulated from drawing primitives since the last flush, in panel coordinates (pre-offset)
+    struct {
+        bool     is_dirty;
+        uint16_t l;
+        uint16_t t;
+        uint16_t r;
+        uint16_t b;
+    } dirty;
 } painter_driver_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Device internals
 
 bool qp_internal_register_device(painter_device_t driver);
+
+// Device handle by registration order, NULL when the slot is unused or out of range.
+painter_device_t qp_internal_device_at(uint8_t index);
@@ -109,9 +109,22 @@ static inline void mem_close(qp_stream_t *stream) {
     // No-op.
 }
 
+static inline const void *mem_span(qp_stream_t *stream, uint32_t length) {
+    qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
+
+    // The backing buffer is directly addressable (for flash-resident assets it's memory-mapped via XIP), so hand out a
+    // pointer into it and skip the stream past the requested region.
+    if (length > (uint32_t)(s->length - s->position)) {
+        return NULL;
+    }
+    const void *span = &s->buffer[s->position];
+    s->position += length;
+    return span;
+}
+
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
-        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
+        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close, .span = mem_span},
         .buffer   = (uint8_t *)buffer,
         .length   = length,
         .position = 0,
@@ -43,6 +43,12 @@ uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint3
 
 #define qp_stream_close(stream_ptr) (((qp_stream_t *)(stream_ptr))->close((qp_stream_t *)(stream_ptr)))
 
+// Direct access to the stream's backing store for backends whose data is memory-mapped -- assets compiled into flash
+// execute in place on RP2040, so the returned pointer can be handed to bulk consumers (decoders, DMA-backed comms)
+// without copying through RAM. Advances the stream past the span on success; returns NULL if the backend has no
+// addressable backing store or fewer than `length` bytes remain, in which case callers fall back to byte-wise reads.
+#define qp_stream_get_span(stream_ptr, length) (((qp_stream_t *)(stream_ptr))->span ? (((qp_stream_t *)(stream_ptr))->span((qp_stream_t *)(stream_ptr), (length))) : NULL)
+
 #define STREAM_EOF ((int16_t)(-1))
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +61,7 @@ typedef struct qp_stream_t {
     int32_t (*tell)(qp_stream_t *stream);
     bool (*is_eof)(qp_stream_t *stream);
     void (*close)(qp_stream_t *stream);
+    const void *(*span)(qp_stream_t *stream, uint32_t length); // optional, NULL if the backend is not memory-mapped
 } qp_stream_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Retained text layout
+//
+// Resolves word-wrap line breaks and per-line pixel widths once, when the text is set, into a fixed-size layout
+// object; drawing the layout afterwards issues one qp_drawtext_recolor() per line with no width measurement at all.
+// QFF fonts have no kerning, so glyph widths are additive and the per-word measurements taken at build time compose
+// exactly into line widths. A hash of the incoming string makes qp_text_layout_set_text() a cheap no-op while the
+// content is unchanged, so callers can simply feed it every frame.
+
+void qp_text_layout_init(qp_text_layout_t *layout, painter_font_handle_t font, uint16_t max_width) {
+    memset(layout, 0, sizeof(*layout));
+    layout->font      = font;
+    layout->max_width = max_width;
+}
+
+void qp_text_layout_invalidate(qp_text_layout_t *layout) {
+    layout->valid = false;
+}
+
+// FNV-1a; the same change-detection idiom the info widgets use to skip redraws
+static uint32_t qp_text_layout_hash(const char *str) {
+    uint32_t hash = 2166136261ul;
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619ul;
+    }
+    return hash;
+}
+
+// Measures a substring of the private copy by temporarily terminating it; only used while building the layout.
+static int16_t qp_text_layout_measure(qp_text_layout_t *layout, uint16_t start, uint16_t length) {
+    char *str             = &layout->text[start];
+    char  saved           = str[length];
+    str[length]           = '\0';
+    int16_t width         = qp_textwidth(layout->font, str);
+    str[length]           = saved;
+    return width;
+}
+
+static void qp_text_layout_emit(qp_text_layout_t *layout, uint16_t start, uint16_t end, int16_t width) {
+    layout->lines[layout->line_count].start  = start;
+    layout->lines[layout->line_count].length = end - start;
+    layout->lines[layout->line_count].width  = width;
+    layout->line_count++;
+}
+
+// Longest prefix of an over-long word that fits the wrap width, never splitting a UTF-8 sequence and always taking at
+// least one code point so layout progresses.
+static uint16_t qp_text_layout_hard_break(qp_text_layout_t *layout, uint16_t word_start, uint16_t word_len, int16_t *width) {
+    uint16_t fit     = 0;
+    uint16_t try_len = 0;
+    while (try_len < word_len) {
+        try_len++;
+        while (try_len < word_len && (layout->text[word_start + try_len] & 0xC0) == 0x80) {
+            try_len++;
+        }
+        int16_t w = qp_text_layout_measure(layout, word_start, try_len);
+        if (fit != 0 && w > (int16_t)layout->max_width) {
+            break;
+        }
+        fit    = try_len;
+        *width = w;
+    }
+    return fit;
+}
+
+bool qp_text_layout_set_text(qp_text_layout_t *layout, const char *str) {
+    uint32_t hash = qp_text_layout_hash(str);
+    if (layout->valid && hash == layout->content_hash) {
+        return false;
+    }
+    layout->content_hash = hash;
+
+    size_t len = strlen(str);
+    if (len >= QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT) {
+        len = QUANTUM_PAINTER_TEXT_LAYOUT_MAX_TEXT - 1;
+    }
+    memcpy(layout->text, str, len);
+    layout->text[len] = '\0';
+
+    layout->line_count    = 0;
+    const int16_t space_w = qp_textwidth(layout->font, " ");
+
+    uint16_t pos = 0;
+    while (layout->line_count < QUANTUM_PAINTER_TEXT_LAYOUT_MAX_LINES) {
+        uint16_t line_start = pos;
+        uint16_t line_end   = pos;
+        int16_t  line_w     = 0;
+        bool     last_line  = false;
+
+        for (;;) {
+            // Separator run before the next word; leading spaces on a wrapped line are dropped
+            uint16_t gap = 0;
+            while (layout->text[pos] == ' ') {
+                gap++;
+                pos++;
+            }
+            char c = layout->text[pos];
+            if (c == '\0') {
+                last_line = true;
+                break;
+            }
+            if (c == '\n') {
+                pos++;
+                break;
+            }
+
+            uint16_t word_start = pos;
+            while (layout->text[pos] != '\0' && layout->text[pos] != ' ' && layout->text[pos] != '\n') {
+                pos++;
+            }
+            uint16_t word_len = pos - word_start;
+            int16_t  word_w   = qp_text_layout_measure(layout, word_start, word_len);
+
+            if (line_w == 0) {
+                if (word_w > (int16_t)layout->max_width) {
+                    // A single word wider than the wrap width is broken mid-word
+                    word_len = qp_text_layout_hard_break(layout, word_start, word_len, &word_w);
+                    pos      = word_start + word_len;
+                }
+                line_start = word_start;
+                line_end   = word_start + word_len;
+                line_w     = word_w;
+                continue;
+            }
+
+            int16_t candidate = line_w + gap * space_w + word_w;
+            if (candidate > (int16_t)layout->max_width) {
+                // Word starts the next line
+                pos = word_start;
+                break;
+            }
+            line_end = pos;
+            line_w   = candidate;
+        }
+
+        // A trailing empty line only exists when forced by an explicit newline
+        if (line_end > line_start || !last_line) {
+            qp_text_layout_emit(layout, line_start, line_end, line_w);
+        }
+        if (last_line) {
+            break;
+        }
+    }
+
+    layout->valid = true;
+    return true;
+}
+
+uint8_t qp_text_layout_line_count(const qp_text_layout_t *layout) {
+    return layout->valid ? layout->line_count : 0;
+}
+
+int16_t qp_text_layout_height(const qp_text_layout_t *layout) {
+    return layout->valid ? (int16_t)layout->line_count * layout->font->line_height : 0;
+}
+
+int16_t qp_text_layout_draw_recolor(painter_device_t device, uint16_t x, uint16_t y, qp_text_layout_t *layout, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (!layout->valid) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < layout->line_count; ++i) {
+        char *line  = &layout->text[layout->lines[i].start];
+        char  saved = line[layout->lines[i].length];
+
+        line[layout->lines[i].length] = '\0';
+        qp_drawtext_recolor(device, x, y + i * layout->font->line_height, layout->font, line, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+        line[layout->lines[i].length] = saved;
+    }
+    return (int16_t)layout->line_count * layout->font->line_height;
+}
+
+int16_t qp_text_layout_draw(painter_device_t device, uint16_t x, uint16_t y, qp_text_layout_t *layout) {
+    return qp_text_layout_draw_recolor(device, x, y, layout, 0, 0, 255, 0, 0, 0);
+}
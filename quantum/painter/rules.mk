@@ -49,6 +49,41 @@ ifeq ($(strip $(QUANTUM_PAINTER_ANIMATIONS_ENABLE)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_ANIMATIONS_ENABLE
 endif
 
+# Check if people want the decoded image cache
+QUANTUM_PAINTER_IMAGE_CACHE ?= no
+ifeq ($(strip $(QUANTUM_PAINTER_IMAGE_CACHE)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_IMAGE_CACHE_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_image_cache.c
+endif
+
+# Check if people want whole-run text span rendering; it composites from the glyph atlas, so pull that in too
+QUANTUM_PAINTER_TEXT_SPAN ?= no
+ifeq ($(strip $(QUANTUM_PAINTER_TEXT_SPAN)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_TEXT_SPAN_ENABLE
+    QUANTUM_PAINTER_GLYPH_ATLAS := yes
+endif
+
+# Check if people want recorded draw command lists
+QUANTUM_PAINTER_CMDLIST ?= no
+ifeq ($(strip $(QUANTUM_PAINTER_CMDLIST)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_CMDLIST_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_cmdlist.c
+endif
+
+# Check if people want the retained text layout cache
+QUANTUM_PAINTER_TEXT_LAYOUT ?= no
+ifeq ($(strip $(QUANTUM_PAINTER_TEXT_LAYOUT)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_TEXT_LAYOUT_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_text_layout.c
+endif
+
+# Check if people want the glyph atlas
+QUANTUM_PAINTER_GLYPH_ATLAS ?= no
+ifeq ($(strip $(QUANTUM_PAINTER_GLYPH_ATLAS)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_GLYPH_ATLAS_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_glyph_atlas.c
+endif
+
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_DUMMY ?= no
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
@@ -271,6 +306,12 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_SPI)), yes)
     ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_SPI_DC_RESET)), yes)
         OPT_DEFS += -DQUANTUM_PAINTER_SPI_DC_RESET_ENABLE
     endif
+
+    # Optional background (DMA) pixel transmission
+    QUANTUM_PAINTER_SPI_DMA ?= no
+    ifeq ($(strip $(QUANTUM_PAINTER_SPI_DMA)), yes)
+        OPT_DEFS += -DQUANTUM_PAINTER_SPI_DMA_ENABLE
+    endif
 endif
 
 # If I2C comms is needed, set up the required files
@@ -84,6 +84,15 @@ static report_mouse_t           local_mouse_report         = {};
 static bool                     pointing_device_force_send = false;
 static pointing_device_status_t pointing_device_status     = POINTING_DEVICE_STATUS_UNKNOWN;
 
+#if (POINTING_DEVICE_IDLE_THROTTLE_MS > 0)
+#    ifndef POINTING_DEVICE_IDLE_TIMEOUT_MS
+#        define POINTING_DEVICE_IDLE_TIMEOUT_MS 1000
+#    endif
+// Timestamp of the last report with motion, scroll or buttons; used to drop the sensor poll rate
+// once the device has been quiescent for POINTING_DEVICE_IDLE_TIMEOUT_MS.
+static uint32_t pointing_device_last_motion = 0;
+#endif
+
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
 static uint16_t hires_scroll_resolution;
 #endif
@@ -288,6 +297,66 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#if (POINTING_DEVICE_MOTION_THRESHOLD > 0) || (POINTING_DEVICE_SCROLL_BATCH_MS > 0)
+static inline mouse_xy_report_t pointing_device_xy_clamp(xy_clamp_range_t value);
+static inline mouse_hv_report_t pointing_device_hv_clamp(hv_clamp_range_t value);
+
+/**
+ * @brief Coalesces motion and scroll across polls before the report is sent
+ *
+ * With POINTING_DEVICE_MOTION_THRESHOLD, x/y deltas below the threshold are accumulated instead of
+ * sent, so sensor noise and slow drift do not generate a report per poll; the accumulated delta is
+ * flushed once it reaches the threshold (or on a button change, so clicks land at the right spot).
+ * With POINTING_DEVICE_SCROLL_BATCH_MS, h/v deltas are merged and emitted at most once per batch
+ * interval. Nothing is lost, only deferred.
+ *
+ * @param mouse_report[in] report from the driver/kb processing chain
+ * @return report_mouse_t with coalesced values
+ */
+static report_mouse_t pointing_device_coalesce_report(report_mouse_t mouse_report) {
+    static uint8_t last_buttons    = 0;
+    bool           buttons_changed = mouse_report.buttons != last_buttons;
+    last_buttons                   = mouse_report.buttons;
+
+#    if (POINTING_DEVICE_MOTION_THRESHOLD > 0)
+    static xy_clamp_range_t accumulated_x = 0;
+    static xy_clamp_range_t accumulated_y = 0;
+    accumulated_x += mouse_report.x;
+    accumulated_y += mouse_report.y;
+    xy_clamp_range_t magnitude = (accumulated_x < 0 ? -accumulated_x : accumulated_x) + (accumulated_y < 0 ? -accumulated_y : accumulated_y);
+    if (magnitude >= POINTING_DEVICE_MOTION_THRESHOLD || (buttons_changed && magnitude != 0)) {
+        mouse_report.x = pointing_device_xy_clamp(accumulated_x);
+        mouse_report.y = pointing_device_xy_clamp(accumulated_y);
+        accumulated_x  = 0;
+        accumulated_y  = 0;
+    } else {
+        mouse_report.x = 0;
+        mouse_report.y = 0;
+    }
+#    endif
+
+#    if (POINTING_DEVICE_SCROLL_BATCH_MS > 0)
+    static hv_clamp_range_t accumulated_h     = 0;
+    static hv_clamp_range_t accumulated_v     = 0;
+    static uint32_t         last_scroll_flush = 0;
+    accumulated_h += mouse_report.h;
+    accumulated_v += mouse_report.v;
+    if ((accumulated_h != 0 || accumulated_v != 0) && (timer_elapsed32(last_scroll_flush) >= POINTING_DEVICE_SCROLL_BATCH_MS || buttons_changed)) {
+        mouse_report.h    = pointing_device_hv_clamp(accumulated_h);
+        mouse_report.v    = pointing_device_hv_clamp(accumulated_v);
+        accumulated_h     = 0;
+        accumulated_v     = 0;
+        last_scroll_flush = timer_read32();
+    } else {
+        mouse_report.h = 0;
+        mouse_report.v = 0;
+    }
+#    endif
+
+    return mouse_report;
+}
+#endif
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -303,9 +372,18 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0) || (POINTING_DEVICE_IDLE_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
-    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+    uint32_t        throttle  = POINTING_DEVICE_TASK_THROTTLE_MS;
+#    if (POINTING_DEVICE_IDLE_THROTTLE_MS > 0)
+    // Adaptive cadence: after POINTING_DEVICE_IDLE_TIMEOUT_MS without motion, poll the sensor at
+    // the idle interval instead -- redundant zero-motion reads dominate the bus budget otherwise.
+    // The first poll that sees motion restores the full rate.
+    if (timer_elapsed32(pointing_device_last_motion) >= POINTING_DEVICE_IDLE_TIMEOUT_MS) {
+        throttle = POINTING_DEVICE_IDLE_THROTTLE_MS;
+    }
+#    endif
+    if (timer_elapsed32(last_exec) < throttle) {
         return false;
     }
     last_exec = timer_read32();
@@ -372,6 +450,16 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report.buttons     = local_mouse_report.buttons | mousekey_report.buttons;
 #endif
 
+#if (POINTING_DEVICE_IDLE_THROTTLE_MS > 0)
+    if (local_mouse_report.x != 0 || local_mouse_report.y != 0 || local_mouse_report.h != 0 || local_mouse_report.v != 0 || local_mouse_report.buttons != 0) {
+        pointing_device_last_motion = timer_read32();
+    }
+#endif
+
+#if (POINTING_DEVICE_MOTION_THRESHOLD > 0) || (POINTING_DEVICE_SCROLL_BATCH_MS > 0)
+    local_mouse_report = pointing_device_coalesce_report(local_mouse_report);
+#endif
+
     const bool send_report     = pointing_device_send() || pointing_device_force_send;
     pointing_device_force_send = false;
 
@@ -15,10 +15,18 @@
  */
 
 #include "process_auto_shift.h"
+#include "active_transforms.h"
 #include "quantum.h"
 #include "action_util.h"
 #include "timer.h"
 #include "keycodes.h"
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+#    include "deferred_exec.h"
+#endif
+
+#if defined(AUTO_SHIFT_DEFERRED_TIMEOUT) && !defined(DEFERRED_EXEC_ENABLE)
+#    error "AUTO_SHIFT_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#endif
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
 #    define AUTO_SHIFT_STARTUP_STATE true /* enabled */
@@ -61,6 +69,16 @@ static struct {
 } autoshift_flags = {AUTO_SHIFT_STARTUP_STATE, false, false, false, false, false};
 // clang-format on
 
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+// The timeout deadline is armed at key press time on a private executor table, so the per-scan
+// work reduces to the deferred exec once-per-millisecond gate instead of a timer compare.
+static deferred_executor_t autoshift_deferred_table[1];
+static uint32_t            autoshift_deferred_last_exec = 0;
+static deferred_token      autoshift_deferred_token     = INVALID_DEFERRED_TOKEN;
+
+static uint32_t autoshift_deferred_timeout(uint32_t trigger_time, void *cb_arg);
+#endif
+
 /** \brief Called on physical press, returns whether key should be added to Auto Shift */
 __attribute__((weak)) bool get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
     return false;
@@ -224,6 +242,23 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
 
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+    // clang-format off
+    const uint32_t deferred_delay =
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+        get_autoshift_timeout(keycode, record)
+#    else
+        autoshift_timeout
+#    endif
+    ;
+    // clang-format on
+    if (autoshift_deferred_token != INVALID_DEFERRED_TOKEN) {
+        extend_deferred_exec_advanced(autoshift_deferred_table, ARRAY_SIZE(autoshift_deferred_table), autoshift_deferred_token, deferred_delay);
+    } else {
+        autoshift_deferred_token = defer_exec_advanced(autoshift_deferred_table, ARRAY_SIZE(autoshift_deferred_table), deferred_delay, autoshift_deferred_timeout, NULL);
+    }
+#endif
+
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
 #endif
@@ -243,6 +278,13 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
     if (autoshift_flags.in_progress && (keycode == autoshift_lastkey || keycode == KC_NO)) {
         // Process the auto-shiftable key.
         autoshift_flags.in_progress = false;
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+        // Resolved before the deadline fired -- drop the scheduled timeout.
+        if (autoshift_deferred_token != INVALID_DEFERRED_TOKEN) {
+            cancel_deferred_exec_advanced(autoshift_deferred_table, ARRAY_SIZE(autoshift_deferred_table), autoshift_deferred_token);
+            autoshift_deferred_token = INVALID_DEFERRED_TOKEN;
+        }
+#endif
         // clang-format off
         autoshift_flags.lastshifted =
             autoshift_flags.lastshifted
@@ -307,31 +349,50 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  *  to be released.
  */
 void autoshift_matrix_scan(void) {
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+    deferred_exec_advanced_task(autoshift_deferred_table, ARRAY_SIZE(autoshift_deferred_table), &autoshift_deferred_last_exec);
+#else
     if (autoshift_flags.in_progress) {
         const uint16_t now = timer_read();
         if (TIMER_DIFF_16(now, autoshift_time) >=
-#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
             get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
-#else
+#    else
             autoshift_timeout
-#endif
+#    endif
         ) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
         }
     }
+#endif
 }
 
+#ifdef AUTO_SHIFT_DEFERRED_TIMEOUT
+/** \brief Deferred executor armed on press; fires once when the timeout elapses */
+static uint32_t autoshift_deferred_timeout(uint32_t trigger_time, void *cb_arg) {
+    // Clear the token first so autoshift_end does not try to cancel the executor that is running.
+    autoshift_deferred_token = INVALID_DEFERRED_TOKEN;
+    if (autoshift_flags.in_progress) {
+        autoshift_end(autoshift_lastkey, timer_read(), true, &autoshift_lastrecord);
+    }
+    return 0;
+}
+#endif
+
 void autoshift_toggle(void) {
     autoshift_flags.enabled = !autoshift_flags.enabled;
+    active_transform_set(ACTIVE_TRANSFORM_AUTO_SHIFT, autoshift_flags.enabled);
     autoshift_flush_shift();
 }
 
 void autoshift_enable(void) {
     autoshift_flags.enabled = true;
+    active_transform_set(ACTIVE_TRANSFORM_AUTO_SHIFT, true);
 }
 
 void autoshift_disable(void) {
     autoshift_flags.enabled = false;
+    active_transform_set(ACTIVE_TRANSFORM_AUTO_SHIFT, false);
     autoshift_flush_shift();
 }
 
@@ -11,6 +11,7 @@
 #include "keycode_config.h"
 #include "send_string.h"
 #include "action_util.h"
+#include "word_boundary.h"
 
 #if __has_include("autocorrect_data.h")
 #    include "autocorrect_data.h"
@@ -22,6 +23,33 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+/* The trie is keyed on reversed typo suffixes, so every lookup starts at the root with the key just
+ * pressed, and the root has the largest fanout in the dictionary. Its child list is flattened into a
+ * direct link table once at first use so the common case -- a key no typo ends with -- is rejected
+ * with a single array read instead of a linear progmem scan. Buffered keycodes are always below 64. */
+static uint16_t autocorrect_root_links[64];
+static bool     autocorrect_root_links_generated = false;
+
+static void generate_autocorrect_root_links(void) {
+    uint8_t code = pgm_read_byte(autocorrect_data);
+    if (code & 64) { // Multi-child root: 3-byte entries of keycode plus child offset, zero-terminated.
+        uint16_t state = 0;
+        code &= 63;
+        while (code) {
+            autocorrect_root_links[code & 63] = pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8;
+            state += 3;
+            code = pgm_read_byte(autocorrect_data + state);
+        }
+    } else if (code) { // Single-child root: the child follows inline, after a zero separator if present.
+        uint16_t next = 1;
+        if (!pgm_read_byte(autocorrect_data + next)) {
+            ++next;
+        }
+        autocorrect_root_links[code & 63] = next;
+    }
+    autocorrect_root_links_generated = true;
+}
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +217,81 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief Applies the correction for a completed trie match
+ *
+ * @param state index of the matched completion node in `autocorrect_data`
+ * @param code the completion node's code byte (backspace count plus flags)
+ * @param keycode Keycode registered by matrix press, per keymap
+ * @param record keyrecord_t structure
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_handle_match(uint16_t state, uint8_t code, uint16_t keycode, keyrecord_t *record) {
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -231,30 +334,30 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
-    // keycode buffer check
-    switch (keycode) {
-        case KC_A ... KC_Z:
+    // keycode buffer check, driven by the shared word-boundary classification
+    switch (word_boundary_classify(keycode)) {
+        case WORD_CLASS_LETTER:
             // process normally
             break;
-        case KC_1 ... KC_0:
-        case KC_TAB ... KC_SEMICOLON:
-        case KC_GRAVE ... KC_SLASH:
+        case WORD_CLASS_DIGIT:
+        case WORD_CLASS_BOUNDARY:
+        case WORD_CLASS_HYPHEN:
             // Set a word boundary if space, period, digit, etc. is pressed.
             keycode = KC_SPC;
             break;
-        case KC_ENTER:
+        case WORD_CLASS_ENTER:
             // Behave more conservatively for the enter key. Reset, so that enter
             // can't be used on a word ending.
             typo_buffer_size = 0;
             keycode          = KC_SPC;
             break;
-        case KC_BSPC:
+        case WORD_CLASS_BACKSPACE:
             // Remove last character from the buffer.
             if (typo_buffer_size > 0) {
                 --typo_buffer_size;
             }
             return true;
-        case KC_QUOTE:
+        case WORD_CLASS_QUOTE:
             // Treat " (shifted ') as a word boundary.
             if ((mods & MOD_MASK_SHIFT) != 0) {
                 keycode = KC_SPC;
@@ -280,9 +383,21 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+    if (!autocorrect_root_links_generated) {
+        generate_autocorrect_root_links();
+    }
+
+    // Resolve the root transition through the link table; a zero link means no typo ends with the
+    // key just pressed, which is the common case for ordinary typing.
+    uint16_t state = autocorrect_root_links[typo_buffer[typo_buffer_size - 1] & 63];
+    if (state == 0 || state >= DICTIONARY_SIZE) {
+        return true;
+    }
+    uint8_t code = pgm_read_byte(autocorrect_data + state);
+    if (code & 128) { // A typo was found! Apply autocorrect.
+        return autocorrect_handle_match(state, code, keycode, record);
+    }
+    for (int8_t i = typo_buffer_size - 2; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
@@ -308,68 +423,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_handle_match(state, code, keycode, record);
         }
     }
     return true;
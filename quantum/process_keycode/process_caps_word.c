@@ -22,6 +22,7 @@
 #include "timer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "word_boundary.h"
 
 #ifdef CAPS_WORD_INVERT_ON_SHIFT
 static uint8_t held_mods = 0;
@@ -257,18 +258,21 @@ bool process_caps_word(uint16_t keycode, keyrecord_t* record) {
 }
 
 __attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
-    switch (keycode) {
+    if (keycode == KC_UNDS) {
+        // Continues Caps Word; not a basic keycode, so outside the shared table.
+        return true;
+    }
+    switch (word_boundary_classify(keycode)) {
         // Keycodes that continue Caps Word, with shift applied.
-        case KC_A ... KC_Z:
-        case KC_MINS:
+        case WORD_CLASS_LETTER:
+        case WORD_CLASS_HYPHEN:
             add_weak_mods(MOD_BIT(KC_LSFT)); // Apply shift to next key.
             return true;
 
         // Keycodes that continue Caps Word, without shifting.
-        case KC_1 ... KC_0:
-        case KC_BSPC:
-        case KC_DEL:
-        case KC_UNDS:
+        case WORD_CLASS_DIGIT:
+        case WORD_CLASS_BACKSPACE:
+        case WORD_CLASS_DELETE:
             return true;
 
         default:
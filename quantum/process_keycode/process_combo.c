@@ -16,16 +16,22 @@
 
 #include "process_combo.h"
 #include <stddef.h>
-#include "process_auto_shift.h"
-#include "caps_word.h"
+#include "key_wait_buffer.h"
 #include "timer.h"
-#include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef COMBO_DEFERRED_TIMEOUT
+#    include "deferred_exec.h"
+#    include "util.h"
+#endif
+
+#if defined(COMBO_DEFERRED_TIMEOUT) && !defined(DEFERRED_EXEC_ENABLE)
+#    error "COMBO_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -79,19 +85,48 @@ __attribute__((weak)) bool combo_should_trigger(uint16_t combo_index, combo_t *c
 
 typedef enum { COMBO_KEY_NOT_PRESSED, COMBO_KEY_PRESSED, COMBO_KEY_REPRESSED } combo_key_action_t;
 
-#ifndef COMBO_NO_TIMER
-static uint16_t timer = 0;
+static bool b_combo_enable = true; // defaults to enabled
+
+// The single combo timeout; .term always tracks the longest armed combo term, .timer stays unused
+// (and inactive) when COMBO_NO_TIMER is set.
+static key_wait_deadline_t combo_deadline = {0, 0};
+
+#if defined(COMBO_DEFERRED_TIMEOUT) && !defined(COMBO_NO_TIMER)
+// The single combo deadline (combo_deadline.timer + .term) is armed on a private
+// executor table whenever it moves, so combo_task()'s per-scan work reduces
+// to the deferred exec once-per-millisecond gate instead of a timer compare.
+static deferred_executor_t combo_deferred_table[1];
+static uint32_t            combo_deferred_last_exec = 0;
+static deferred_token      combo_deferred_token     = INVALID_DEFERRED_TOKEN;
+
+static uint32_t combo_deferred_timeout(uint32_t trigger_time, void *cb_arg);
+
+/** \brief (Re)arms the deferred deadline at timer + longest term */
+static void combo_deferred_arm(void) {
+    // The original check fires strictly after the term has elapsed, hence the +1;
+    // in strict timer mode part of the term may already have passed
+    uint32_t remaining = (uint32_t)combo_deadline.term + 1;
+    uint16_t elapsed   = timer_elapsed(combo_deadline.timer);
+    remaining          = elapsed < remaining ? remaining - elapsed : 1;
+    if (combo_deferred_token != INVALID_DEFERRED_TOKEN) {
+        extend_deferred_exec_advanced(combo_deferred_table, ARRAY_SIZE(combo_deferred_table), combo_deferred_token, remaining);
+    } else {
+        combo_deferred_token = defer_exec_advanced(combo_deferred_table, ARRAY_SIZE(combo_deferred_table), remaining, combo_deferred_timeout, NULL);
+    }
+}
+
+static void combo_deferred_cancel(void) {
+    if (combo_deferred_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec_advanced(combo_deferred_table, ARRAY_SIZE(combo_deferred_table), combo_deferred_token);
+        combo_deferred_token = INVALID_DEFERRED_TOKEN;
+    }
+}
 #endif
-static bool     b_combo_enable = true; // defaults to enabled
-static uint16_t longest_term   = 0;
 
-typedef struct {
-    keyrecord_t record;
-    uint16_t    combo_index;
-    uint16_t    keycode;
-} queued_record_t;
-static uint8_t         key_buffer_size = 0;
-static queued_record_t key_buffer[COMBO_KEY_BUFFER_LENGTH];
+// Pending chord keys; entry.keycode is the combo-reference-layer keycode used for matching and
+// entry.context carries the combo index once a combo claims the key. The ring keeps one slot free.
+static key_wait_entry_t  key_buffer_entries[COMBO_KEY_BUFFER_LENGTH + 1];
+static key_wait_buffer_t key_buffer = {.entries = key_buffer_entries, .capacity = COMBO_KEY_BUFFER_LENGTH + 1};
 
 typedef struct {
     uint16_t combo_index;
@@ -183,12 +218,12 @@ static inline uint16_t _get_wait_time(uint16_t combo_index, combo_t *combo) {
         || get_combo_must_tap(combo_index, combo)
 #endif
     ) {
-        if (longest_term < COMBO_HOLD_TERM) {
+        if (combo_deadline.term < COMBO_HOLD_TERM) {
             return COMBO_HOLD_TERM;
         }
     }
 
-    return longest_term;
+    return combo_deadline.term;
 }
 
 static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
@@ -200,8 +235,8 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 }
 
 void clear_combos(void) {
-    uint16_t index = 0;
-    longest_term   = 0;
+    uint16_t index      = 0;
+    combo_deadline.term = 0;
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -210,58 +245,17 @@ void clear_combos(void) {
     }
 }
 
-static inline void dump_key_buffer(void) {
-    /* First call start from 0 index; recursive calls need to start from i+1 index */
-    static uint8_t key_buffer_next = 0;
-#if TAP_CODE_DELAY > 0
-    bool delay_done = false;
-#endif
-
-    if (key_buffer_size == 0) {
-        return;
-    }
-
-    for (uint8_t key_buffer_i = key_buffer_next; key_buffer_i < key_buffer_size; key_buffer_i++) {
-        key_buffer_next = key_buffer_i + 1;
-
-        queued_record_t *qrecord = &key_buffer[key_buffer_i];
-        keyrecord_t *    record  = &qrecord->record;
-
-        if (IS_NOEVENT(record->event)) {
-            continue;
-        }
-
-        if (!record->keycode && qrecord->combo_index != (uint16_t)-1) {
-            process_combo_event(qrecord->combo_index, true);
-        } else {
-#ifndef NO_ACTION_TAPPING
-            action_tapping_process(*record);
-#else
-            process_record(record);
-#endif
-        }
-        record->event.type = TICK_EVENT;
-
-#if defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
-        // Edge case: preserve the weak Left Shift mod if both Caps Word and
-        // Auto Shift are on. Caps Word capitalizes by setting the weak Left
-        // Shift mod during the press event, but Auto Shift doesn't send the
-        // key until it receives the release event.
-        del_weak_mods((is_caps_word_on() && get_autoshift_state()) ? ~MOD_BIT(KC_LSFT) : 0xff);
-#else
-        clear_weak_mods();
-#endif // defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
-
-#if TAP_CODE_DELAY > 0
-        // only delay once and for a non-tapping key
-        if (!delay_done && !is_tap_record(record)) {
-            delay_done = true;
-            wait_ms(TAP_CODE_DELAY);
-        }
-#endif
+/** \brief Replay hook: combos without a result keycode fire their event callback instead. */
+static bool combo_dispatch_entry(key_wait_entry_t *entry) {
+    if (!entry->record.keycode && entry->context != (uint16_t)-1) {
+        process_combo_event(entry->context, true);
+        return true;
     }
+    return false;
+}
 
-    key_buffer_next = key_buffer_size = 0;
+static inline void dump_key_buffer(void) {
+    key_wait_buffer_replay(&key_buffer, combo_dispatch_entry);
 }
 
 #define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
@@ -323,10 +317,10 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
     uint8_t state = 0;
 #endif
 
-    for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
-        queued_record_t *qrecord = &key_buffer[key_buffer_i];
-        keyrecord_t *    record  = &qrecord->record;
-        uint16_t         keycode = qrecord->keycode;
+    for (uint8_t key_buffer_i = key_buffer.tail; key_buffer_i != key_buffer.head; key_buffer_i = key_wait_buffer_next(&key_buffer, key_buffer_i)) {
+        key_wait_entry_t *qrecord = &key_buffer.entries[key_buffer_i];
+        keyrecord_t *     record  = &qrecord->record;
+        uint16_t          keycode = qrecord->keycode;
 
         uint8_t  key_count = 0;
         uint16_t key_index = -1;
@@ -344,7 +338,7 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             record->event.type = COMBO_EVENT;
             record->event.key  = MAKE_KEYPOS(0, 0);
 
-            qrecord->combo_index = combo_index;
+            qrecord->context = combo_index;
             ACTIVATE_COMBO(combo);
 
             break;
@@ -445,8 +439,8 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
         uint16_t time = _get_combo_term(combo_index, combo);
         if (!COMBO_ACTIVE(combo)) {
             KEY_STATE_DOWN(combo->state, key_index);
-            if (longest_term < time) {
-                longest_term = time;
+            if (combo_deadline.term < time) {
+                combo_deadline.term = time;
             }
         }
         if (ALL_COMBO_KEYS_ARE_DOWN(COMBO_STATE(combo), key_count)) {
@@ -455,7 +449,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (key_wait_deadline_active(&combo_deadline) && timer_elapsed(combo_deadline.timer) > time) {
                 DISABLE_COMBO(combo);
                 return COMBO_KEY_PRESSED;
             } else
@@ -489,7 +483,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
                     INCREMENT_MOD(combo_buffer_write);
 
                     // get possible longer waiting time for tap-/hold-only combos.
-                    longest_term = _get_wait_time(combo_index, combo);
+                    combo_deadline.term = _get_wait_time(combo_index, combo);
                 }
             } // if timer elapsed end
         }
@@ -581,21 +575,31 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
+    /* Walking a combo's key list costs a progmem read per key; the membership filter rejects combos that
+     * can't contain this keycode with a single AND, so only actual candidates (plus the odd filter false
+     * positive) pay for the full scan inside process_single_combo(). */
+    const uint32_t filter_bit = combo_key_filter_bit(keycode);
     for (uint16_t idx = 0; idx < combo_count(); ++idx) {
         combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        if (combo_key_filter(idx) & filter_bit) {
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
         no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
     }
 
     if (record->event.pressed && is_combo_key) {
 #ifndef COMBO_NO_TIMER
 #    ifdef COMBO_STRICT_TIMER
-        if (!timer) {
+        if (!key_wait_deadline_active(&combo_deadline)) {
             // timer is set only on the first key
-            timer = timer_read();
+            key_wait_deadline_start(&combo_deadline);
         }
 #    else
-        timer = timer_read();
+        key_wait_deadline_start(&combo_deadline);
+#    endif
+#    ifdef COMBO_DEFERRED_TIMEOUT
+        // longest_term may have moved with this key; track the new deadline
+        combo_deferred_arm();
 #    endif
 #endif
 
@@ -603,13 +607,8 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
         if (is_combo_key == COMBO_KEY_PRESSED)
 #endif
         {
-            if (key_buffer_size < COMBO_KEY_BUFFER_LENGTH) {
-                key_buffer[key_buffer_size++] = (queued_record_t){
-                    .record      = *record,
-                    .keycode     = keycode,
-                    .combo_index = -1, // this will be set when applying combos
-                };
-            }
+            // entry.context is set to the combo index when applying combos
+            key_wait_buffer_enq(&key_buffer, record, keycode, (uint16_t)-1);
         }
     } else {
         if (combo_buffer_read != combo_buffer_write) {
@@ -619,7 +618,10 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             // reset state if there are no combo keys pressed at all
             dump_key_buffer();
 #ifndef COMBO_NO_TIMER
-            timer = 0;
+            key_wait_deadline_cancel(&combo_deadline);
+#    ifdef COMBO_DEFERRED_TIMEOUT
+            combo_deferred_cancel();
+#    endif
 #endif
             clear_combos();
         }
@@ -633,27 +635,55 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
+#    ifdef COMBO_DEFERRED_TIMEOUT
+    deferred_exec_advanced_task(combo_deferred_table, ARRAY_SIZE(combo_deferred_table), &combo_deferred_last_exec);
+#    else
+    if (key_wait_deadline_expired(&combo_deadline)) {
         if (combo_buffer_read != combo_buffer_write) {
             apply_combos();
-            longest_term = 0;
-            timer        = 0;
+            combo_deadline.term = 0;
+            key_wait_deadline_cancel(&combo_deadline);
         } else {
             dump_key_buffer();
-            timer = 0;
+            key_wait_deadline_cancel(&combo_deadline);
             clear_combos();
         }
     }
+#    endif
 #endif
 }
 
+#if defined(COMBO_DEFERRED_TIMEOUT) && !defined(COMBO_NO_TIMER)
+/** \brief Deferred deadline expiry; mirrors the polled timeout in combo_task() */
+static uint32_t combo_deferred_timeout(uint32_t trigger_time, void *cb_arg) {
+    // Clear the token first so the reset paths do not try to cancel the executor that is running
+    combo_deferred_token = INVALID_DEFERRED_TOKEN;
+    if (!b_combo_enable || !key_wait_deadline_active(&combo_deadline)) {
+        return 0;
+    }
+    if (combo_buffer_read != combo_buffer_write) {
+        apply_combos();
+        combo_deadline.term = 0;
+        key_wait_deadline_cancel(&combo_deadline);
+    } else {
+        dump_key_buffer();
+        key_wait_deadline_cancel(&combo_deadline);
+        clear_combos();
+    }
+    return 0;
+}
+#endif
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
 
 void combo_disable(void) {
 #ifndef COMBO_NO_TIMER
-    timer = 0;
+    key_wait_deadline_cancel(&combo_deadline);
+#    ifdef COMBO_DEFERRED_TIMEOUT
+    combo_deferred_cancel();
+#    endif
 #endif
     b_combo_enable    = false;
     combo_buffer_read = combo_buffer_write;
@@ -19,10 +19,21 @@
 #include "process_dynamic_macro.h"
 #include <stddef.h>
 #include "action_layer.h"
+#include "keyboard.h"
 #include "keycodes.h"
 #include "debug.h"
 #include "wait.h"
 
+#ifdef DYNAMIC_MACRO_PERSIST
+#    include "eeprom.h"
+#    ifndef DYNAMIC_MACRO_EEPROM_ADDR
+#        error DYNAMIC_MACRO_PERSIST requires DYNAMIC_MACRO_EEPROM_ADDR (a free EEPROM region of sizeof(header) + 3 * DYNAMIC_MACRO_SIZE bytes)
+#    endif
+#    ifndef DYNAMIC_MACRO_SPILL_CHUNK
+#        define DYNAMIC_MACRO_SPILL_CHUNK 32
+#    endif
+#endif
+
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -89,13 +100,33 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
 #define DYNAMIC_MACRO_CURRENT_LENGTH(BEGIN, POINTER) ((int)(direction * ((POINTER) - (BEGIN))))
 #define DYNAMIC_MACRO_CURRENT_CAPACITY(BEGIN, END2) ((int)(direction * ((END2) - (BEGIN)) + 1))
 
+/* Compression: a recorded keyrecord collapses into 3 bytes - the matrix
+ * position, the press/release bit, and the event type. That is all playback
+ * needs to rebuild a keyrecord; the timestamp is regenerated at play time,
+ * matching how the old full-keyrecord copies replayed stale times anyway.
+ */
+static inline dynamic_macro_event_t dynamic_macro_encode(const keyrecord_t *record) {
+    dynamic_macro_event_t event = {
+        .row   = record->event.key.row,
+        .col   = record->event.key.col,
+        .flags = (uint8_t)((record->event.pressed ? 1 : 0) | ((uint8_t)record->event.type << 1)),
+    };
+    return event;
+}
+
+static inline keyrecord_t dynamic_macro_decode(const dynamic_macro_event_t *event) {
+    keyrecord_t record = {0};
+    record.event       = MAKE_EVENT(event->row, event->col, (event->flags & 1) != 0, (keyevent_type_t)(event->flags >> 1));
+    return record;
+}
+
 /**
  * Start recording of the dynamic macro.
  *
  * @param[out] macro_pointer The new macro buffer iterator.
  * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+void dynamic_macro_record_start(dynamic_macro_event_t **macro_pointer, dynamic_macro_event_t *macro_buffer, int8_t direction) {
     dprintln("dynamic macro recording: started");
 
     dynamic_macro_record_start_kb(direction);
@@ -112,7 +143,7 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
  * @param macro_end[in]    The element after the last macro buffer element.
  * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
+void dynamic_macro_play(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t *macro_end, int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
     layer_state_t saved_layer_state = layer_state;
@@ -121,7 +152,8 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
     layer_clear();
 
     while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
+        keyrecord_t record = dynamic_macro_decode(macro_buffer);
+        process_record(&record);
         macro_buffer += direction;
 #ifdef DYNAMIC_MACRO_DELAY
         wait_ms(DYNAMIC_MACRO_DELAY);
@@ -144,7 +176,7 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
  * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
  * @param record[in]     The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+void dynamic_macro_record_key(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t **macro_pointer, dynamic_macro_event_t *macro2_end, int8_t direction, keyrecord_t *record) {
     /* If we've just started recording, ignore all the key releases. */
     if (!record->event.pressed && *macro_pointer == macro_buffer) {
         dprintln("dynamic macro: ignoring a leading key-up event");
@@ -155,7 +187,7 @@ void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_poi
      * is safe to use before overwriting the other macro.
      */
     if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
+        **macro_pointer = dynamic_macro_encode(record);
         *macro_pointer += direction;
     }
     dynamic_macro_record_key_kb(direction, record);
@@ -167,13 +199,13 @@ void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_poi
  * End recording of the dynamic macro. Essentially just update the
  * pointer to the end of the macro.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
+void dynamic_macro_record_end(dynamic_macro_event_t *macro_buffer, dynamic_macro_event_t *macro_pointer, int8_t direction, dynamic_macro_event_t **macro_end) {
     dynamic_macro_record_end_kb(direction);
 
     /* Do not save the keys being held when stopping the recording,
      * i.e. the keys used to access the layer DM_RSTP is on.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
+    while (macro_pointer != macro_buffer && ((macro_pointer - direction)->flags & 1)) {
         dprintln("dynamic macro: trimming a trailing key-down event");
         macro_pointer -= direction;
     }
@@ -207,28 +239,86 @@ void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_poin
  * macros or one long macro and one short macro. Or even one empty
  * and one using the whole buffer.
  */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
+static dynamic_macro_event_t macro_buffer[DYNAMIC_MACRO_SIZE];
 
 /* Pointer to the first buffer element after the first macro.
  * Initially points to the very beginning of the buffer since the
  * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
+static dynamic_macro_event_t *macro_end = macro_buffer;
 
 /* The other end of the macro buffer. Serves as the beginning of
  * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static dynamic_macro_event_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
 
 /* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static dynamic_macro_event_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
 
 /* A persistent pointer to the current macro position (iterator)
  * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
+static dynamic_macro_event_t *macro_pointer = NULL;
 
 /* 0   - no macro is being recorded right now
  * 1,2 - either macro 1 or 2 is being recorded */
 static uint8_t macro_id = 0;
 
+#ifdef DYNAMIC_MACRO_PERSIST
+/* Persistence: the compressed buffer plus both end offsets are mirrored into
+ * EEPROM (flash-backed and wear-leveled on the targets that matter here).
+ * Writes happen in dynamic_macro_task, one DYNAMIC_MACRO_SPILL_CHUNK-byte
+ * chunk per call and only while no recording is in progress, so the spill
+ * never stalls a scan. eeprom_update_block skips unchanged bytes, so
+ * re-saving a macro only rewrites the part of the buffer that moved. */
+typedef struct dynamic_macro_persist_header_t {
+    uint16_t magic;
+    uint16_t end_offset;   /* macro 1: elements from buffer start */
+    uint16_t r_end_offset; /* macro 2: element index of r_macro_end */
+} dynamic_macro_persist_header_t;
+
+#    define DYNAMIC_MACRO_PERSIST_MAGIC 0x4D44 /* "DM" */
+
+static uint16_t spill_cursor  = 0;
+static bool     spill_pending = false;
+
+static void dynamic_macro_persist_mark(void) {
+    spill_cursor  = 0;
+    spill_pending = true;
+}
+
+void dynamic_macro_init(void) {
+    dynamic_macro_persist_header_t header;
+    eeprom_read_block(&header, (const void *)(DYNAMIC_MACRO_EEPROM_ADDR), sizeof(header));
+    if (header.magic != DYNAMIC_MACRO_PERSIST_MAGIC || header.end_offset > DYNAMIC_MACRO_SIZE || header.r_end_offset >= DYNAMIC_MACRO_SIZE || header.end_offset > header.r_end_offset + 1) {
+        return; /* nothing persisted yet, or a layout/size change invalidated it */
+    }
+    eeprom_read_block(macro_buffer, (const void *)(DYNAMIC_MACRO_EEPROM_ADDR + sizeof(header)), sizeof(macro_buffer));
+    macro_end   = macro_buffer + header.end_offset;
+    r_macro_end = macro_buffer + header.r_end_offset;
+    dprintln("dynamic macro: restored from eeprom");
+}
+
+void dynamic_macro_task(void) {
+    if (!spill_pending || macro_id != 0) {
+        return;
+    }
+    if (spill_cursor == 0) {
+        dynamic_macro_persist_header_t header = {
+            .magic        = DYNAMIC_MACRO_PERSIST_MAGIC,
+            .end_offset   = (uint16_t)(macro_end - macro_buffer),
+            .r_end_offset = (uint16_t)(r_macro_end - macro_buffer),
+        };
+        eeprom_update_block(&header, (void *)(DYNAMIC_MACRO_EEPROM_ADDR), sizeof(header));
+    }
+    uint16_t remaining = sizeof(macro_buffer) - spill_cursor;
+    uint16_t chunk     = remaining < DYNAMIC_MACRO_SPILL_CHUNK ? remaining : DYNAMIC_MACRO_SPILL_CHUNK;
+    eeprom_update_block((const uint8_t *)macro_buffer + spill_cursor, (void *)(DYNAMIC_MACRO_EEPROM_ADDR + sizeof(dynamic_macro_persist_header_t) + spill_cursor), chunk);
+    spill_cursor += chunk;
+    if (spill_cursor >= sizeof(macro_buffer)) {
+        spill_pending = false;
+        dprintln("dynamic macro: spill to eeprom complete");
+    }
+}
+#endif /* DYNAMIC_MACRO_PERSIST */
+
 /**
  * If a dynamic macro is currently being recorded, stop recording.
  */
@@ -242,6 +332,9 @@ void dynamic_macro_stop_recording(void) {
             break;
     }
     macro_id = 0;
+#ifdef DYNAMIC_MACRO_PERSIST
+    dynamic_macro_persist_mark();
+#endif
 }
 
 /* Handle the key events related to the dynamic macros.
@@ -27,14 +27,23 @@
  * because of the down-event and up-event. This is not a bug, it's the
  * intended behavior.
  *
- * Usually it should be fine to set the macro size to at least 256 but
- * there have been reports of it being too much in some users' cases,
- * so 128 is considered a safe default.
+ * The buffer stores compressed 3-byte events rather than full
+ * keyrecords, so the default costs 384 bytes of RAM and raising it is
+ * cheap.
  */
 #ifndef DYNAMIC_MACRO_SIZE
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+/* Compressed macro event: everything playback needs to rebuild a
+ * keyrecord - matrix position, press/release, and the event type
+ * (key, encoder, ...) - in 3 bytes instead of a full keyrecord_t. */
+typedef struct dynamic_macro_event_t {
+    uint8_t row;
+    uint8_t col;
+    uint8_t flags; /* bit 0: pressed; bits 1-3: keyevent_type_t */
+} dynamic_macro_event_t;
+
 void dynamic_macro_led_blink(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
@@ -48,3 +57,11 @@ bool dynamic_macro_record_end_user(int8_t direction);
 bool dynamic_macro_valid_key_kb(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_valid_key_user(uint16_t keycode, keyrecord_t *record);
 void dynamic_macro_stop_recording(void);
+
+#ifdef DYNAMIC_MACRO_PERSIST
+/* Restores persisted macros from EEPROM at boot. */
+void dynamic_macro_init(void);
+/* Spills saved macros to EEPROM in DYNAMIC_MACRO_SPILL_CHUNK-byte chunks,
+ * one chunk per call, and only while no recording is in progress. */
+void dynamic_macro_task(void);
+#endif
@@ -16,6 +16,7 @@
  */
 
 #include "process_key_override.h"
+#include "active_transforms.h"
 #include "report.h"
 #include "timer.h"
 #include "debug.h"
@@ -87,14 +88,66 @@ static bool enabled = true;
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
+// Pre-filter: most key events cannot possibly interact with any override. A 64-bit hash filter
+// over the registered trigger keycodes plus the union of every trigger/negative modifier mask lets
+// those events skip the whole engine with a single AND. Built lazily on the first event, from
+// whatever key_override_count()/key_override_get() expose at that point.
+static uint64_t ko_trigger_key_filter = 0;
+static uint8_t  ko_relevant_mods      = 0;
+static bool     ko_filter_match_all   = false;
+static bool     ko_filter_built       = false;
+
+static inline uint64_t ko_key_filter_bit(uint16_t keycode) {
+    return (uint64_t)1 << (keycode & 63);
+}
+
+static void ko_build_filter(void) {
+    ko_filter_built = true;
+    for (uint8_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+        if (override == NULL) {
+            break;
+        }
+        if (override->trigger == KC_NO) {
+            // 'No key' overrides can activate from any key event once their mods line up
+            ko_filter_match_all = true;
+        } else {
+            ko_trigger_key_filter |= ko_key_filter_bit(override->trigger);
+        }
+        ko_relevant_mods |= override->trigger_mods | override->negative_mod_mask;
+        if (override->trigger_mods == 0 && override->negative_mod_mask == 0) {
+            // Nothing to key off -- any modifier event may matter to this override
+            ko_relevant_mods = 0xFF;
+        }
+    }
+}
+
+/** Returns true when the event might interact with some override and the engine has to run. While
+ * an override is active every event must be inspected for deactivation, so the filter only applies
+ * to the idle state. */
+static bool ko_filter_passes(const uint16_t keycode, const bool is_mod) {
+    if (!ko_filter_built) {
+        ko_build_filter();
+    }
+    if (ko_filter_match_all || active_override != NULL) {
+        return true;
+    }
+    if (is_mod) {
+        return (ko_relevant_mods & MOD_BIT(keycode)) != 0;
+    }
+    return (ko_trigger_key_filter & ko_key_filter_bit(keycode)) != 0;
+}
+
 void key_override_on(void) {
     enabled = true;
+    active_transform_set(ACTIVE_TRANSFORM_KEY_OVERRIDE, true);
     key_override_printf("Key override ON\n");
 }
 
 void key_override_off(void) {
     enabled = false;
     clear_active_override(false);
+    active_transform_set(ACTIVE_TRANSFORM_KEY_OVERRIDE, false);
     key_override_printf("Key override OFF\n");
 }
 
@@ -470,6 +523,12 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
         }
     }
 
+    // Bookkeeping above (last_key_down, deferred registers) always runs; the engine itself only
+    // runs for events that could actually touch an override.
+    if (!ko_filter_passes(keycode, is_mod)) {
+        return true;
+    }
+
     key_override_printf("key down: %u keycode: %u is mod: %u effective mods: %u\n", key_down, keycode, is_mod, effective_mods);
 
     bool send_key_action = true;
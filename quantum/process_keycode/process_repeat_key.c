@@ -17,21 +17,42 @@
 #include "keycodes.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
+#include "progmem.h"
 
 // Default implementation of remember_last_key_user().
 __attribute__((weak)) bool remember_last_key_user(uint16_t keycode, keyrecord_t* record, uint8_t* remembered_mods) {
     return true;
 }
 
+// Bitmap over the basic keycode range (0x00-0xFF) with a set bit for every
+// keycode eligible to be remembered, so the overwhelmingly common case - a
+// plain basic keypress - costs one bit test instead of walking the keycode
+// range compares below. The modifier keys KC_LCTL..KC_RGUI (0xE0-0xE7, all of
+// byte 28) are the only ineligible basic keycodes. Extending the bitmap to the
+// full 16-bit keycode space would cost 8 KiB, so quantum keycodes keep the
+// compile-time range compares.
+static const uint8_t basic_eligible[32] PROGMEM = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, //
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, //
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, //
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, //
+};
+
 static bool remember_last_key(uint16_t keycode, keyrecord_t* record, uint8_t* remembered_mods) {
+    if (IS_QK_BASIC(keycode)) {
+        if (!(pgm_read_byte(&basic_eligible[keycode >> 3]) & (1 << (keycode & 7)))) {
+            return false;
+        }
+        return remember_last_key_user(keycode, record, remembered_mods);
+    }
+
     switch (keycode) {
         // Ignore MO, TO, TG, TT, and TL layer switch keys.
         case QK_MOMENTARY ... QK_MOMENTARY_MAX:
         case QK_TO ... QK_TO_MAX:
         case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
         case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
-        // Ignore mod keys.
-        case KC_LCTL ... KC_RGUI:
+        // Ignore mod-only combinations such as KC_HYPR and KC_MEH.
         case KC_HYPR:
         case KC_MEH:
 #ifndef NO_ACTION_ONESHOT // Ignore one-shot keys.
@@ -80,6 +80,37 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     }
 }
 
+void tap_dance_tap_hold_on_each_release(tap_dance_state_t *state, void *user_data) {
+    tap_dance_tap_hold_t *pair = (tap_dance_tap_hold_t *)user_data;
+
+    if (!state->finished) {
+        // Released before the tapping term: this dance has no multi-tap phases, so resolve as the tap keycode
+        // right now instead of waiting for the term to expire.
+        register_code16(pair->kc_tap);
+        state->finished = true;
+    }
+}
+
+void tap_dance_tap_hold_finished(tap_dance_state_t *state, void *user_data) {
+    tap_dance_tap_hold_t *pair = (tap_dance_tap_hold_t *)user_data;
+
+    // Only reached with the key still down -- the tapping term expired or another key interrupted the dance
+    register_code16(pair->kc_hold);
+    pair->held = true;
+}
+
+void tap_dance_tap_hold_reset(tap_dance_state_t *state, void *user_data) {
+    tap_dance_tap_hold_t *pair = (tap_dance_tap_hold_t *)user_data;
+
+    if (pair->held) {
+        unregister_code16(pair->kc_hold);
+        pair->held = false;
+    } else {
+        wait_ms(TAP_CODE_DELAY);
+        unregister_code16(pair->kc_tap);
+    }
+}
+
 static inline void _process_tap_dance_action_fn(tap_dance_state_t *state, void *user_data, tap_dance_user_fn_t fn) {
     if (fn) {
         fn(state, user_data);
@@ -57,6 +57,12 @@ typedef struct {
     void (*layer_function)(uint8_t);
 } tap_dance_dual_role_t;
 
+typedef struct {
+    uint16_t kc_tap;
+    uint16_t kc_hold;
+    bool     held;
+} tap_dance_tap_hold_t;
+
 #define ACTION_TAP_DANCE_DOUBLE(kc1, kc2) \
     { .fn = {tap_dance_pair_on_each_tap, tap_dance_pair_finished, tap_dance_pair_reset, NULL}, .user_data = (void *)&((tap_dance_pair_t){kc1, kc2}), }
 
@@ -66,6 +72,13 @@ typedef struct {
 #define ACTION_TAP_DANCE_LAYER_TOGGLE(kc, layer) \
     { .fn = {NULL, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((tap_dance_dual_role_t){kc, layer, layer_invert}), }
 
+// Specialized tap-vs-hold dance: no multi-tap phases, so a release before the tapping term resolves as the tap
+// keycode immediately instead of holding the dance open to look for a second tap. Use this over
+// ACTION_TAP_DANCE_DOUBLE-style definitions when only single-tap and hold matter -- it cuts the tap resolution
+// latency from the full tapping term down to the actual release.
+#define ACTION_TAP_DANCE_TAP_HOLD(kc_tap, kc_hold) \
+    { .fn = {NULL, tap_dance_tap_hold_finished, tap_dance_tap_hold_reset, tap_dance_tap_hold_on_each_release}, .user_data = (void *)&((tap_dance_tap_hold_t){kc_tap, kc_hold, false}), }
+
 #define ACTION_TAP_DANCE_FN(user_fn) \
     { .fn = {NULL, user_fn, NULL, NULL}, .user_data = NULL, }
 
@@ -93,3 +106,7 @@ void tap_dance_pair_reset(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_on_each_tap(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_finished(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data);
+
+void tap_dance_tap_hold_on_each_release(tap_dance_state_t *state, void *user_data);
+void tap_dance_tap_hold_finished(tap_dance_state_t *state, void *user_data);
+void tap_dance_tap_hold_reset(tap_dance_state_t *state, void *user_data);
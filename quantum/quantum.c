@@ -16,6 +16,11 @@
 
 #include "quantum.h"
 #include "process_quantum.h"
+#include "active_transforms.h"
+
+#if defined(CAPS_WORD_ENABLE) || defined(AUTOCORRECT_ENABLE)
+#    include "word_boundary.h"
+#endif
 
 #ifdef SLEEP_LED_ENABLE
 #    include "sleep_led.h"
@@ -93,6 +98,10 @@
 #    include "process_oneshot.h"
 #endif
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    include "wear_leveling.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -103,6 +112,18 @@ float default_layer_songs[][16][2] = DEFAULT_LAYER_SONGS;
 #    endif
 #endif
 
+// Transformations armed at boot; the owning features keep the word current from
+// here on (see active_transforms.h)
+uint8_t active_transforms = 0
+#ifdef KEY_OVERRIDE_ENABLE
+                            // Key overrides boot enabled
+                            | ACTIVE_TRANSFORM_KEY_OVERRIDE
+#endif
+#if defined(AUTO_SHIFT_ENABLE) && !defined(AUTO_SHIFT_DISABLED_AT_STARTUP)
+                            | ACTIVE_TRANSFORM_AUTO_SHIFT
+#endif
+    ;
+
 uint8_t extract_mod_bits(uint16_t code) {
     switch (code) {
         case QK_MODS ... QK_MODS_MAX:
@@ -133,21 +154,25 @@ void do_code16(uint16_t code, void (*f)(uint8_t)) {
 }
 
 __attribute__((weak)) void register_code16(uint16_t code) {
+    keyboard_report_defer();
     if (IS_MODIFIER_KEYCODE(code) || code == KC_NO) {
         do_code16(code, register_mods);
     } else {
         do_code16(code, register_weak_mods);
     }
     register_code(code);
+    keyboard_report_flush();
 }
 
 __attribute__((weak)) void unregister_code16(uint16_t code) {
+    keyboard_report_defer();
     unregister_code(code);
     if (IS_MODIFIER_KEYCODE(code) || code == KC_NO) {
         do_code16(code, unregister_mods);
     } else {
         do_code16(code, unregister_weak_mods);
     }
+    keyboard_report_flush();
 }
 
 /** \brief Tap a keycode with a delay.
@@ -213,6 +238,10 @@ __attribute__((weak)) void suspend_wakeup_init_modules(void) {}
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Commit any deferred eeprom writes before the reset/bootloader jump discards them
+    wear_leveling_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -338,6 +367,42 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+    // Keycodes at or below QK_MODS_MAX are plain HID usages, possibly with modifiers baked in -- i.e. ordinary
+    // typing. The feature dispatchers below that only ever match their own quantum keycode range are skipped
+    // outright for such events; handlers that track state across all events (macros, tap dance, caps word,
+    // space cadet, music mode, ...) still see everything, in their original order.
+    const bool is_basic_event = keycode <= QK_MODS_MAX;
+    (void)is_basic_event;
+
+#if defined(CAPS_WORD_ENABLE) || defined(AUTOCORRECT_ENABLE)
+    // Maintain the shared word-boundary state once per event, ahead of the word-aware features below.
+    word_boundary_track(keycode, record->event.pressed);
+#endif
+
+    // Basic events additionally skip the transformation features that are not currently armed,
+    // per the active_transforms word the features maintain themselves (see active_transforms.h).
+    // Quantum-range events always go through so toggle keycodes can re-arm a feature. A few
+    // configurations track state on plain shift events while idle and must see everything.
+#ifdef CAPS_WORD_ENABLE
+#    if defined(BOTH_SHIFTS_TURNS_ON_CAPS_WORD) || defined(DOUBLE_TAP_SHIFT_TURNS_ON_CAPS_WORD) || defined(CAPS_WORD_INVERT_ON_SHIFT)
+    // Shift-based activation/inversion watches shift keys while Caps Word is off
+    const bool skip_caps_word = false;
+#    else
+    const bool skip_caps_word = is_basic_event && !active_transform_is_set(ACTIVE_TRANSFORM_CAPS_WORD);
+#    endif
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    const bool skip_key_override = is_basic_event && !active_transform_is_set(ACTIVE_TRANSFORM_KEY_OVERRIDE);
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+#    ifdef RETRO_SHIFT
+    // Retro Shift processes mod-tap/layer-tap events even while Auto Shift is toggled off
+    const bool skip_auto_shift = false;
+#    else
+    const bool skip_auto_shift = is_basic_event && !active_transform_is_set(ACTIVE_TRANSFORM_AUTO_SHIFT);
+#    endif
+#endif
+
     if (!(
 #if defined(KEY_LOCK_ENABLE)
             // Must run first to be able to mask key_up events.
@@ -368,82 +433,82 @@ bool process_record_quantum(keyrecord_t *record) {
             process_secure(keycode, record) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            (is_basic_event || process_sequencer(keycode, record)) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            (is_basic_event || process_midi(keycode, record)) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            (is_basic_event || process_audio(keycode, record)) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            (is_basic_event || process_backlight(keycode, record)) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            (is_basic_event || process_led_matrix(keycode, record)) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            (is_basic_event || process_steno(keycode, record)) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
             process_music(keycode, record) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+            (skip_caps_word || process_caps_word(keycode, record)) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            (skip_key_override || process_key_override(keycode, record)) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
             process_tap_dance(keycode, record) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+            (is_basic_event || process_unicode_common(keycode, record)) &&
 #endif
 #ifdef LEADER_ENABLE
             process_leader(keycode, record) &&
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+            (skip_auto_shift || process_auto_shift(keycode, record)) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            (is_basic_event || process_dynamic_tapping_term(keycode, record)) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
             process_space_cadet(keycode, record) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            (is_basic_event || process_magic(keycode, record)) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            (is_basic_event || process_grave_esc(keycode, record)) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            (is_basic_event || process_underglow(keycode, record)) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            (is_basic_event || process_rgb_matrix(keycode, record)) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            (is_basic_event || process_joystick(keycode, record)) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            (is_basic_event || process_programmable_button(keycode, record)) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
             process_autocorrect(keycode, record) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            (is_basic_event || process_tri_layer(keycode, record)) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            (is_basic_event || process_default_layer(keycode, record)) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
             process_layer_lock(keycode, record) &&
 #endif
 #ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
+            (is_basic_event || process_connection(keycode, record)) &&
 #endif
 #ifndef NO_ACTION_ONESHOT
             process_oneshot(keycode, record) &&
@@ -482,7 +547,34 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
     return true;
 }
 
+#ifdef SUSPEND_FAST_RESUME
+/* Snapshot of the state suspend tears down, captured on the first
+ * suspend_power_down_quantum() of a suspend cycle (the function runs once per
+ * suspend-loop iteration) and restored verbatim on wakeup, so resume skips
+ * the full subsystem re-initialization. */
+static struct {
+    layer_state_t layer_state;
+#    ifdef BACKLIGHT_ENABLE
+    uint8_t backlight_level;
+#    endif
+    bool captured;
+} suspend_snapshot = {0};
+#endif
+
 void suspend_power_down_quantum(void) {
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // The deferred executor doesn't run while suspended; commit pending eeprom writes now
+    wear_leveling_flush();
+#endif
+#ifdef SUSPEND_FAST_RESUME
+    if (!suspend_snapshot.captured) {
+        suspend_snapshot.layer_state = layer_state;
+#    ifdef BACKLIGHT_ENABLE
+        suspend_snapshot.backlight_level = get_backlight_level();
+#    endif
+        suspend_snapshot.captured = true;
+    }
+#endif
     suspend_power_down_modules();
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
@@ -538,7 +630,13 @@ void suspend_power_down_quantum(void) {
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
 // Turn on backlight
 #ifdef BACKLIGHT_ENABLE
+#    ifdef SUSPEND_FAST_RESUME
+    // Restore the snapshotted level directly; backlight_init() redoes port
+    // setup and an eeprom read that suspend never invalidated
+    backlight_level_noeeprom(suspend_snapshot.backlight_level);
+#    else
     backlight_init();
+#    endif
 #endif
 
 #ifdef SLEEP_LED_ENABLE
@@ -558,6 +656,12 @@ __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
 #endif
 #if defined(RGB_MATRIX_ENABLE)
     rgb_matrix_set_suspend_state(false);
+#endif
+#ifdef SUSPEND_FAST_RESUME
+    if (suspend_snapshot.captured) {
+        layer_state_set(suspend_snapshot.layer_state);
+        suspend_snapshot.captured = false;
+    }
 #endif
     suspend_wakeup_init_modules();
     suspend_wakeup_init_kb();
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \brief RAMFUNC tags hot functions for copy-to-SRAM placement on XIP-flash MCUs.
+ *
+ * The RP2040 executes from XIP flash, so cache misses in the scan/event path show up as latency jitter. With
+ * `HOT_FUNCTIONS_IN_RAM = yes` in rules.mk, functions tagged with RAMFUNC are placed in the `.time_critical`
+ * section, which the RP2040 linker script copies into striped SRAM at startup -- they then execute with no
+ * flash-cache involvement at all. The linker enforces an overall budget on the copied code
+ * (`HOT_FUNCTIONS_RAM_BUDGET`, bytes, default 32K), so tagging is deliberate rather than free.
+ *
+ * A curated set covering the matrix scan, debounce and Quantum Painter pixel kernels is tagged in core; keyboards
+ * can tag their own hot paths the same way. On builds without the flag (or on MCUs that execute from zero-wait
+ * flash) the macro expands to nothing.
+ */
+#ifdef HOT_FUNCTIONS_IN_RAM
+#    define RAMFUNC __attribute__((__section__(".time_critical.qmk")))
+#else
+#    define RAMFUNC
+#endif
@@ -0,0 +1,82 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "raw_hid_channels.h"
+#include "raw_hid.h"
+#include "host.h"
+#include <string.h>
+
+#ifdef VIA_ENABLE
+#    error RAW_HID_CHANNELS is not compatible with VIA: via.c owns the raw HID receive callback. Bridge VIA through a channel handler instead.
+#endif
+
+static raw_hid_channel_handler_t channel_handlers[RAW_HID_CHANNEL_COUNT];
+
+/* One outbound ring per channel. Frames are stored fully framed (channel id in
+ * byte 0) so the drain path is a straight copy to the endpoint. */
+typedef struct {
+    uint8_t frames[RAW_HID_CHANNEL_QUEUE_DEPTH][RAW_HID_CHANNEL_REPORT_SIZE];
+    uint8_t head;
+    uint8_t count;
+} channel_queue_t;
+
+static channel_queue_t channel_queues[RAW_HID_CHANNEL_COUNT];
+
+/* Next channel to drain; advances every pass so a chatty channel cannot starve
+ * the others. */
+static uint8_t drain_cursor = 0;
+
+bool raw_hid_channel_register(uint8_t channel, raw_hid_channel_handler_t handler) {
+    if (channel >= RAW_HID_CHANNEL_COUNT) {
+        return false;
+    }
+    channel_handlers[channel] = handler;
+    return true;
+}
+
+bool raw_hid_channel_send(uint8_t channel, const uint8_t *data, uint8_t length) {
+    if (channel >= RAW_HID_CHANNEL_COUNT || length > RAW_HID_CHANNEL_PAYLOAD_SIZE) {
+        return false;
+    }
+    channel_queue_t *queue = &channel_queues[channel];
+    if (queue->count == RAW_HID_CHANNEL_QUEUE_DEPTH) {
+        return false; // This channel is backed up; other channels are unaffected
+    }
+    uint8_t *frame = queue->frames[(queue->head + queue->count) % RAW_HID_CHANNEL_QUEUE_DEPTH];
+    frame[0]       = channel;
+    memcpy(&frame[1], data, length);
+    memset(&frame[1 + length], 0, RAW_HID_CHANNEL_PAYLOAD_SIZE - length);
+    queue->count++;
+    return true;
+}
+
+uint8_t raw_hid_channel_pending(uint8_t channel) {
+    return channel < RAW_HID_CHANNEL_COUNT ? channel_queues[channel].count : 0;
+}
+
+void raw_hid_channels_task(void) {
+    // One frame per channel per pass, starting one past where the last pass
+    // started; stop as soon as the endpoint has no room so the drain never
+    // blocks the scan loop waiting on the host
+    for (uint8_t i = 0; i < RAW_HID_CHANNEL_COUNT; i++) {
+        channel_queue_t *queue = &channel_queues[(drain_cursor + i) % RAW_HID_CHANNEL_COUNT];
+        if (queue->count == 0) {
+            continue;
+        }
+        if (!host_endpoint_ready(HOST_ENDPOINT_RAW_HID)) {
+            break;
+        }
+        raw_hid_send(queue->frames[queue->head], RAW_HID_CHANNEL_REPORT_SIZE);
+        queue->head = (queue->head + 1) % RAW_HID_CHANNEL_QUEUE_DEPTH;
+        queue->count--;
+    }
+    drain_cursor = (drain_cursor + 1) % RAW_HID_CHANNEL_COUNT;
+}
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    const uint8_t channel = data[0];
+    if (channel >= RAW_HID_CHANNEL_COUNT || channel_handlers[channel] == NULL) {
+        return; // Unclaimed channel; drop rather than misroute
+    }
+    channel_handlers[channel](&data[1], length - 1);
+}
@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup raw_hid_channels Raw HID channel multiplexing
+ *
+ * Multiplexes the single raw HID endpoint between independent consumers. The
+ * first byte of every report is a channel id; the remaining bytes are the
+ * channel's payload. Each channel has its own receive handler and its own
+ * outbound queue, drained round-robin and only while the endpoint can accept
+ * a report - a host that stops reading one channel's traffic fills that
+ * channel's queue without blocking sends on the others.
+ * \{
+ */
+
+#ifndef RAW_HID_CHANNEL_COUNT
+#    define RAW_HID_CHANNEL_COUNT 4
+#endif
+
+#ifndef RAW_HID_CHANNEL_QUEUE_DEPTH
+#    define RAW_HID_CHANNEL_QUEUE_DEPTH 2
+#endif
+
+/** \brief Raw HID reports are a fixed 32 bytes (see raw_hid.h). */
+#define RAW_HID_CHANNEL_REPORT_SIZE 32
+
+/** \brief Payload bytes available per report after the channel id byte. */
+#define RAW_HID_CHANNEL_PAYLOAD_SIZE (RAW_HID_CHANNEL_REPORT_SIZE - 1)
+
+/**
+ * \brief Per-channel receive handler.
+ *
+ * \param data Payload bytes (the channel id has been stripped).
+ * \param length Payload length, always RAW_HID_CHANNEL_PAYLOAD_SIZE.
+ */
+typedef void (*raw_hid_channel_handler_t)(const uint8_t *data, uint8_t length);
+
+/**
+ * \brief Register the receive handler for a channel id.
+ *
+ * \param channel Channel id (0 to RAW_HID_CHANNEL_COUNT - 1).
+ * \param handler Callback invoked for every report addressed to the channel.
+ * \return false if the channel id is out of range.
+ */
+bool raw_hid_channel_register(uint8_t channel, raw_hid_channel_handler_t handler);
+
+/**
+ * \brief Queue a report on a channel. Never blocks; the report goes out from
+ * raw_hid_channels_task() once the endpoint has room and it is the channel's
+ * turn.
+ *
+ * \param data Payload bytes, at most RAW_HID_CHANNEL_PAYLOAD_SIZE (shorter
+ * payloads are zero-padded on the wire).
+ * \param length Payload length.
+ * \return false if the channel id is out of range, the payload is oversized,
+ * or the channel's queue is full.
+ */
+bool raw_hid_channel_send(uint8_t channel, const uint8_t *data, uint8_t length);
+
+/**
+ * \brief Number of reports waiting in a channel's outbound queue.
+ */
+uint8_t raw_hid_channel_pending(uint8_t channel);
+
+/**
+ * \brief Drains the channel queues. Invoked by the main keyboard task.
+ */
+void raw_hid_channels_task(void);
+
+/** \} */
@@ -15,9 +15,12 @@
 #include "repeat_key.h"
 #include "quantum_keycodes.h"
 
-// Variables saving the state of the last key press.
-static keyrecord_t last_record = {0};
-static uint8_t     last_mods   = 0;
+// Variables saving the state of the last key press. Only the keycode and mods
+// are kept; everything else a playback keyrecord needs is reconstructed in
+// repeat_key_invoke(), so capture is two scalar stores rather than a
+// keyrecord_t copy on every registered keypress.
+static uint16_t last_keycode = KC_NO;
+static uint8_t  last_mods    = 0;
 // Signed count of the number of times the last key has been repeated or
 // alternate repeated: it is 0 when a key is pressed normally, positive when
 // repeated, and negative when alternate repeated.
@@ -27,7 +30,7 @@ static int8_t last_repeat_count = 0;
 static int8_t processing_repeat_count = 0;
 
 uint16_t get_last_keycode(void) {
-    return last_record.keycode;
+    return last_keycode;
 }
 
 uint8_t get_last_mods(void) {
@@ -35,12 +38,8 @@ uint8_t get_last_mods(void) {
 }
 
 void set_last_keycode(uint16_t keycode) {
-    set_last_record(keycode, &(keyrecord_t){
-#ifndef NO_ACTION_TAPPING
-                                 .tap.interrupted = false,
-                                 .tap.count       = 1,
-#endif
-                             });
+    last_keycode      = keycode;
+    last_repeat_count = 0;
 }
 
 void set_last_mods(uint8_t mods) {
@@ -48,9 +47,9 @@ void set_last_mods(uint8_t mods) {
 }
 
 void set_last_record(uint16_t keycode, keyrecord_t* record) {
-    last_record         = *record;
-    last_record.keycode = keycode;
-    last_repeat_count   = 0;
+    (void)record; // tap state is reconstructed at invoke time
+    last_keycode      = keycode;
+    last_repeat_count = 0;
 }
 
 /** @brief Updates `last_repeat_count` in direction `dir`. */
@@ -69,14 +68,14 @@ int8_t get_repeat_key_count(void) {
 void repeat_key_invoke(const keyevent_t* event) {
     // It is possible (e.g. in rolled presses) that the last key changes while
     // the Repeat Key is pressed. To prevent stuck keys, it is important to
-    // remember separately what key record was processed on press so that the
+    // remember separately what keycode was processed on press so that the
     // the corresponding record is generated on release.
-    static keyrecord_t registered_record       = {0};
-    static int8_t      registered_repeat_count = 0;
+    static uint16_t registered_keycode      = KC_NO;
+    static int8_t   registered_repeat_count = 0;
     // Since this function calls process_record(), it may recursively call
     // itself. We return early if `processing_repeat_count` is nonzero to
     // prevent infinite recursion.
-    if (processing_repeat_count || !last_record.keycode) {
+    if (processing_repeat_count || !last_keycode) {
         return;
     }
 
@@ -84,11 +83,19 @@ void repeat_key_invoke(const keyevent_t* event) {
         update_last_repeat_count(1);
         // On press, apply the last mods state, stacking on top of current mods.
         register_weak_mods(last_mods);
-        registered_record       = last_record;
+        registered_keycode      = last_keycode;
         registered_repeat_count = last_repeat_count;
     }
 
-    // Generate a keyrecord and plumb it into the event pipeline.
+    // Reconstruct a keyrecord and plumb it into the event pipeline. The tap
+    // state mirrors a settled tap so tap-hold keys replay their tap action.
+    keyrecord_t registered_record = {
+#ifndef NO_ACTION_TAPPING
+        .tap.interrupted = false,
+        .tap.count       = 1,
+#endif
+        .keycode = registered_keycode,
+    };
     registered_record.event = *event;
     processing_repeat_count = registered_repeat_count;
     process_record(&registered_record);
@@ -126,7 +133,7 @@ static uint8_t find_alt_keycode(const uint8_t (*table)[2], uint8_t table_size_by
 }
 
 uint16_t get_alt_repeat_key_keycode(void) {
-    uint16_t keycode = last_record.keycode;
+    uint16_t keycode = last_keycode;
     uint8_t  mods    = last_mods;
 
     // Call the user callback first to give it a chance to override the default
@@ -240,8 +247,8 @@ uint16_t get_alt_repeat_key_keycode(void) {
 }
 
 void alt_repeat_key_invoke(const keyevent_t* event) {
-    static keyrecord_t registered_record       = {0};
-    static int8_t      registered_repeat_count = 0;
+    static uint16_t registered_keycode      = KC_NO;
+    static int8_t   registered_repeat_count = 0;
     // Since this function calls process_record(), it may recursively call
     // itself. We return early if `processing_repeat_count` is nonzero to
     // prevent infinite recursion.
@@ -250,17 +257,11 @@ void alt_repeat_key_invoke(const keyevent_t* event) {
     }
 
     if (event->pressed) {
-        registered_record = (keyrecord_t){
-#    ifndef NO_ACTION_TAPPING
-            .tap.interrupted = false,
-            .tap.count       = 0,
-#    endif
-            .keycode = get_alt_repeat_key_keycode(),
-        };
+        registered_keycode = get_alt_repeat_key_keycode();
     }
 
     // Early return if there is no alternate key defined.
-    if (!registered_record.keycode) {
+    if (!registered_keycode) {
         return;
     }
 
@@ -270,6 +271,13 @@ void alt_repeat_key_invoke(const keyevent_t* event) {
     }
 
     // Generate a keyrecord and plumb it into the event pipeline.
+    keyrecord_t registered_record = {
+#    ifndef NO_ACTION_TAPPING
+        .tap.interrupted = false,
+        .tap.count       = 0,
+#    endif
+        .keycode = registered_keycode,
+    };
     registered_record.event = *event;
     processing_repeat_count = registered_repeat_count;
     process_record(&registered_record);
@@ -35,7 +35,16 @@ const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
 __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
-    return hsv_to_rgb(hsv);
+    // Band/gradient effects hand long runs of identical HSV values to consecutive LEDs -- remember the last
+    // conversion so those repeats skip hsv_to_rgb() entirely. {0,0,0} maps to black, so the zeroed initial
+    // state is already consistent.
+    static hsv_t last_hsv = {0, 0, 0};
+    static rgb_t last_rgb = {0, 0, 0};
+    if (hsv.h != last_hsv.h || hsv.s != last_hsv.s || hsv.v != last_hsv.v) {
+        last_hsv = hsv;
+        last_rgb = hsv_to_rgb(hsv);
+    }
+    return last_rgb;
 }
 
 // Generic effect runners
@@ -65,6 +74,7 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
 // globals
 rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
 uint32_t     g_rgb_timer;
+led_polar_t  g_led_polar[RGB_MATRIX_LED_COUNT];
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
@@ -480,6 +490,15 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+    // LED positions and the matrix center are fixed, so the polar coordinates the pinwheel/spiral effects
+    // need can be computed once here instead of per LED per frame.
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+        int16_t dx           = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy           = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_led_polar[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_polar[i].angle = atan2_8(dy, dx);
+    }
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -57,6 +57,11 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+typedef struct PACKED {
+    uint8_t dist;  // distance from k_rgb_matrix_center, as produced by sqrt16()
+    uint8_t angle; // angle around k_rgb_matrix_center, as produced by atan2_8()
+} led_polar_t;
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
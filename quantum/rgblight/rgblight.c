@@ -146,8 +146,30 @@ uint8_t rgblight_led_index(uint8_t index) {
 #endif
 }
 
+#ifdef RGBLIGHT_DIRTY_TRACKING
+// Shadow of the last values handed to the driver. Writes that change nothing are dropped before they reach the
+// driver, and rgblight_set() skips the flush outright when no LED changed since the previous one. Static modes are
+// computed once anyway (their animation timer is disabled), so with this enabled a static mode or layer stack only
+// costs a chain transmission when its output actually differs.
+static rgb_t frame_shadow[RGBLIGHT_LED_COUNT];
+static bool  frame_dirty = true; // the first flush always goes out
+#endif
+
+// All driver writes funnel through here so the dirty tracking sees every LED update
+static void rgblight_driver_setrgb(int index, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef RGBLIGHT_DIRTY_TRACKING
+    rgb_t *shadow = &frame_shadow[index];
+    if (shadow->r == r && shadow->g == g && shadow->b == b) {
+        return;
+    }
+    *shadow     = (rgb_t){.r = r, .g = g, .b = b};
+    frame_dirty = true;
+#endif
+    rgblight_driver.set_color(index, r, g, b);
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_driver_setrgb(rgblight_led_index(index), r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
@@ -628,7 +650,7 @@ void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_driver_setrgb(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -638,7 +660,7 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_driver_setrgb(rgblight_led_index(index), r, g, b);
     rgblight_set();
 }
 
@@ -669,7 +691,7 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_driver_setrgb(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -711,6 +733,10 @@ void rgblight_set_layer_state(uint8_t layer, bool enabled) {
     }
     RGBLIGHT_SPLIT_SET_CHANGE_LAYERS;
 
+#    ifdef RGBLIGHT_LAYERS_CACHE
+    rgblight_layers_invalidate_cache();
+#    endif
+
     // Calling rgblight_set() here (directly or indirectly) could
     // potentially cause timing issues when there are multiple
     // successive calls to rgblight_set_layer_state(). Instead,
@@ -724,11 +750,59 @@ bool rgblight_get_layer_state(uint8_t layer) {
     return (rgblight_status.enabled_layer_mask & mask) != 0;
 }
 
+#    ifdef RGBLIGHT_LAYERS_CACHE
+// Resolved layer stack, cached between flushes. rgblight_set() runs at the flush limit rate, so
+// without the cache every flush re-walks the enabled layers and re-runs the HSV->RGB conversion per
+// overlaid LED even when nothing changed. The cache is invalidated only when the enabled layer mask
+// (or, with RGBLIGHT_LAYERS_RETAIN_VAL, the global val) changes; static layer stacks then cost a
+// masked copy per flush instead of a recomputation.
+static rgb_t   layer_cache_color[RGBLIGHT_LED_COUNT];
+static uint8_t layer_cache_mask[(RGBLIGHT_LED_COUNT + 7) / 8]; // bit set = LED overridden by a layer
+static bool    layer_cache_valid = false;
+#        ifdef RGBLIGHT_LAYERS_RETAIN_VAL
+static uint8_t layer_cache_val = 0;
+#        endif
+
+void rgblight_layers_invalidate_cache(void) {
+    layer_cache_valid = false;
+}
+#    endif
+
+// Write one resolved layer-stack LED, either into the cache or straight to the driver
+static inline void rgblight_layers_write_led(uint8_t hue, uint8_t sat, uint8_t val, int index) {
+#    ifdef RGBLIGHT_LAYERS_CACHE
+    hsv_t hsv                             = {hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val};
+    layer_cache_color[index]              = rgblight_hsv_to_rgb(hsv);
+    layer_cache_mask[index / 8] |= 1 << (index % 8);
+#    else
+    sethsv(hue, sat, val, index);
+#    endif
+}
+
 // Write any enabled LED layers into the buffer
 static void rgblight_layers_write(void) {
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
     uint8_t current_val = rgblight_get_val();
 #    endif
+
+#    ifdef RGBLIGHT_LAYERS_CACHE
+#        ifdef RGBLIGHT_LAYERS_RETAIN_VAL
+    if (layer_cache_val != current_val) {
+        layer_cache_valid = false;
+        layer_cache_val   = current_val;
+    }
+#        endif
+    if (layer_cache_valid) {
+        for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+            if (layer_cache_mask[i / 8] & (1 << (i % 8))) {
+                setrgb(layer_cache_color[i].r, layer_cache_color[i].g, layer_cache_color[i].b, i);
+            }
+        }
+        return;
+    }
+    memset(layer_cache_mask, 0, sizeof(layer_cache_mask));
+#    endif
+
     uint8_t i = 0;
     // For each layer
     for (const rgblight_segment_t *const *layer_ptr = rgblight_layers; i < RGBLIGHT_MAX_LAYERS; layer_ptr++, i++) {
@@ -750,14 +824,24 @@ static void rgblight_layers_write(void) {
             int limit = MIN(segment.index + segment.count, RGBLIGHT_LED_COUNT);
             for (int i = segment.index; i < limit; i++) {
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
-                sethsv(segment.hue, segment.sat, current_val, i);
+                rgblight_layers_write_led(segment.hue, segment.sat, current_val, i);
 #    else
-                sethsv(segment.hue, segment.sat, segment.val, i);
+                rgblight_layers_write_led(segment.hue, segment.sat, segment.val, i);
 #    endif
             }
             segment_ptr++;
         }
     }
+
+#    ifdef RGBLIGHT_LAYERS_CACHE
+    // Cache rebuilt; push the freshly resolved colors to the driver
+    layer_cache_valid = true;
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        if (layer_cache_mask[i / 8] & (1 << (i % 8))) {
+            setrgb(layer_cache_color[i].r, layer_cache_color[i].g, layer_cache_color[i].b, i);
+        }
+    }
+#    endif
 }
 
 #    ifdef RGBLIGHT_LAYER_BLINK
@@ -861,7 +945,7 @@ void rgblight_wakeup(void) {
 void rgblight_set(void) {
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            rgblight_driver_setrgb(rgblight_led_index(i), 0, 0, 0);
         }
     }
 
@@ -877,6 +961,14 @@ void rgblight_set(void) {
     }
 #endif
 
+#ifdef RGBLIGHT_DIRTY_TRACKING
+    // Nothing above changed any LED since the last flush -- skip the transmission entirely
+    if (!frame_dirty) {
+        return;
+    }
+    frame_dirty = false;
+#endif
+
     rgblight_driver.flush();
 }
 
@@ -1198,7 +1290,7 @@ void rgblight_effect_snake(animation_status_t *anim) {
 #    endif
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+        rgblight_driver_setrgb(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
 
         for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
             k = pos + j * increment;
@@ -1254,7 +1346,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     // Set all the LEDs to 0
     for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+        rgblight_driver_setrgb(rgblight_led_index(i), 0, 0, 0);
     }
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
@@ -1263,7 +1355,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
         if (i >= low_bound && i <= high_bound) {
             sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            rgblight_driver_setrgb(rgblight_led_index(cur), 0, 0, 0);
         }
     }
     rgblight_set();
@@ -214,6 +214,12 @@ bool rgblight_get_layer_state(uint8_t layer);
 // Point this to an array of rgblight_segment_t arrays in keyboard_post_init_user to use rgblight layers
 extern const rgblight_segment_t *const *rgblight_layers;
 
+#    ifdef RGBLIGHT_LAYERS_CACHE
+// Force a rebuild of the cached resolved layer stack; only needed when segment definitions are
+// mutated in place at runtime (enabled-layer and val changes invalidate the cache automatically)
+void rgblight_layers_invalidate_cache(void);
+#    endif
+
 #    ifdef RGBLIGHT_LAYER_BLINK
 #        define RGBLIGHT_USE_TIMER
 void rgblight_blink_layer(uint8_t layer, uint16_t duration_ms);
@@ -3,46 +3,103 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "atomic_util.h"
+#include "compiler_support.h"
 
 #ifndef RBUF_SIZE
 #    define RBUF_SIZE 32
 #endif
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
-static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
-}
-static inline uint8_t rbuf_dequeue(void) {
-    uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
+/* Typed single-producer/single-consumer ring buffer.
+ *
+ * Expands to a static buffer of `size` elements of `type` plus `<prefix>_enqueue()`, `<prefix>_dequeue()`,
+ * `<prefix>_has_data()`, `<prefix>_clear()` and a `<prefix>_high_water()` fill-level probe for sizing the buffer from
+ * real traffic. `size` must be a power of two: index wrapping is a mask rather than a modulo, which matters on the
+ * Cortex-M0+ and AVR (no hardware divider) in exactly the hot paths these queues sit in. One slot is sacrificed to
+ * distinguish full from empty, so a buffer of `size` holds `size - 1` elements.
+ *
+ * The head index is only written by the producer and the tail index only by the consumer, and both are single bytes
+ * (so loads and stores are atomic on all supported MCUs) -- no locking is required as long as there is exactly one
+ * producer and one consumer.
+ */
+#define RING_BUFFER_TYPED(prefix, type, size)                                                    \
+    STATIC_ASSERT(((size) & ((size)-1)) == 0, "ring buffer size must be a power of two");        \
+    static type             prefix##_buf[size];                                                  \
+    static volatile uint8_t prefix##_head      = 0;                                              \
+    static volatile uint8_t prefix##_tail      = 0;                                              \
+    static uint8_t          prefix##_watermark = 0;                                              \
+    static inline bool      prefix##_enqueue(type data) {                                        \
+        uint8_t next = (prefix##_head + 1) & ((size)-1);                                         \
+        if (next == prefix##_tail) {                                                             \
+            return false;                                                                        \
+        }                                                                                        \
+        prefix##_buf[prefix##_head] = data;                                                      \
+        prefix##_head               = next;                                                      \
+        uint8_t depth               = (uint8_t)((next - prefix##_tail) & ((size)-1));            \
+        if (depth > prefix##_watermark) {                                                        \
+            prefix##_watermark = depth;                                                          \
+        }                                                                                        \
+        return true;                                                                             \
+    }                                                                                            \
+    static inline bool prefix##_dequeue(type *data) {                                            \
+        if (prefix##_head == prefix##_tail) {                                                    \
+            return false;                                                                        \
+        }                                                                                        \
+        *data         = prefix##_buf[prefix##_tail];                                             \
+        prefix##_tail = (prefix##_tail + 1) & ((size)-1);                                        \
+        return true;                                                                             \
+    }                                                                                            \
+    static inline bool prefix##_has_data(void) {                                                 \
+        return prefix##_head != prefix##_tail;                                                   \
+    }                                                                                            \
+    static inline void prefix##_clear(void) {                                                    \
+        prefix##_tail = prefix##_head;                                                           \
+    }                                                                                            \
+    static inline uint8_t prefix##_high_water(void) {                                            \
+        return prefix##_watermark;                                                               \
     }
 
-    return val;
-}
-static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
-}
-static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
+/* Locked multi-producer/single-consumer variant.
+ *
+ * Same shape and helpers as RING_BUFFER_TYPED, but enqueues run in a critical section so any number of producers --
+ * including interrupt handlers -- may feed the buffer concurrently. Dequeue remains single-consumer and lock-free.
+ * Use this for sinks fed from mixed contexts (e.g. the console, where sendchar() may be called from anywhere).
+ */
+#define RING_BUFFER_TYPED_MPSC(prefix, type, size)                                               \
+    STATIC_ASSERT(((size) & ((size)-1)) == 0, "ring buffer size must be a power of two");        \
+    static type             prefix##_buf[size];                                                  \
+    static volatile uint8_t prefix##_head      = 0;                                              \
+    static volatile uint8_t prefix##_tail      = 0;                                              \
+    static uint8_t          prefix##_watermark = 0;                                              \
+    static inline bool      prefix##_enqueue(type data) {                                        \
+        bool ret = false;                                                                        \
+        ATOMIC_BLOCK_RESTORESTATE {                                                              \
+            uint8_t next = (prefix##_head + 1) & ((size)-1);                                     \
+            if (next != prefix##_tail) {                                                         \
+                prefix##_buf[prefix##_head] = data;                                              \
+                prefix##_head               = next;                                              \
+                uint8_t depth               = (uint8_t)((next - prefix##_tail) & ((size)-1));    \
+                if (depth > prefix##_watermark) {                                                \
+                    prefix##_watermark = depth;                                                  \
+                }                                                                                \
+                ret = true;                                                                      \
+            }                                                                                    \
+        }                                                                                        \
+        return ret;                                                                              \
+    }                                                                                            \
+    static inline bool prefix##_dequeue(type *data) {                                            \
+        if (prefix##_head == prefix##_tail) {                                                    \
+            return false;                                                                        \
+        }                                                                                        \
+        *data         = prefix##_buf[prefix##_tail];                                             \
+        prefix##_tail = (prefix##_tail + 1) & ((size)-1);                                        \
+        return true;                                                                             \
+    }                                                                                            \
+    static inline bool prefix##_has_data(void) {                                                 \
+        return prefix##_head != prefix##_tail;                                                   \
+    }                                                                                            \
+    static inline void prefix##_clear(void) {                                                    \
+        prefix##_tail = prefix##_head;                                                           \
+    }                                                                                            \
+    static inline uint8_t prefix##_high_water(void) {                                            \
+        return prefix##_watermark;                                                               \
     }
-}
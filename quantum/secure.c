@@ -20,9 +20,10 @@
         }
 #endif
 
-static secure_status_t secure_status = SECURE_LOCKED;
-static uint32_t        unlock_time   = 0;
-static uint32_t        idle_time     = 0;
+secure_status_t secure_status = SECURE_LOCKED;
+
+static uint32_t unlock_time = 0;
+static uint32_t idle_time   = 0;
 
 static void secure_hook(secure_status_t secure_status) {
     secure_hook_quantum(secure_status);
@@ -63,6 +64,34 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
     static const uint8_t sequence_len  = ARRAY_SIZE(sequence);
 
     static uint8_t offset = 0;
+    if (secure_status != SECURE_PENDING) {
+        // matching only runs inside an active unlock window
+        offset = 0;
+        return;
+    }
+
+#ifdef SECURE_CONSTANT_TIME_COMPARE
+    // Buffer the attempt and compare the full sequence in one pass once
+    // enough keypresses have arrived, so neither the unlock timing nor the
+    // point of lock-out reveals how long a prefix matched
+    static uint8_t attempt[ARRAY_SIZE(sequence)][2];
+    attempt[offset][0] = row;
+    attempt[offset][1] = col;
+    offset++;
+    if (offset == sequence_len) {
+        uint8_t diff = 0;
+        for (uint8_t i = 0; i < sequence_len; i++) {
+            diff |= attempt[i][0] ^ sequence[i][0];
+            diff |= attempt[i][1] ^ sequence[i][1];
+        }
+        offset = 0;
+        if (diff == 0) {
+            secure_unlock();
+        } else {
+            secure_lock();
+        }
+    }
+#else
     if ((sequence[offset][0] == row) && (sequence[offset][1] == col)) {
         offset++;
         if (offset == sequence_len) {
@@ -73,6 +102,7 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
         offset = 0;
         secure_lock();
     }
+#endif
 }
 
 void secure_task(void) {
@@ -25,21 +25,29 @@ typedef enum {
     SECURE_UNLOCKED,
 } secure_status_t;
 
+/** \brief Current secure state
+ *
+ * Exposed so the helpers below compile to a single enum compare on the
+ * per-event path. Treat as read-only - use secure_lock()/secure_unlock()
+ * to change state so the status hooks still fire.
+ */
+extern secure_status_t secure_status;
+
 /** \brief Query current secure state
  */
 secure_status_t secure_get_status(void);
 
 /** \brief Helper to check if unlocking is currently locked
  */
-#define secure_is_locked() (secure_get_status() == SECURE_LOCKED)
+#define secure_is_locked() (secure_status == SECURE_LOCKED)
 
 /** \brief Helper to check if unlocking is currently in progress
  */
-#define secure_is_unlocking() (secure_get_status() == SECURE_PENDING)
+#define secure_is_unlocking() (secure_status == SECURE_PENDING)
 
 /** \brief Helper to check if unlocking is currently unlocked
  */
-#define secure_is_unlocked() (secure_get_status() == SECURE_UNLOCKED)
+#define secure_is_unlocked() (secure_status == SECURE_UNLOCKED)
 
 /** \brief Lock down the device
  */
@@ -150,11 +150,149 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
+#ifdef SEND_STRING_BATCHED
+/* Batched output: consecutive characters that want the same modifier share a
+ * single hold instead of wrapping every tap in its own press/release pair.
+ * For a run of shifted characters this drops two reports and two interval
+ * waits per character; the host sees an ordinary held Shift, exactly as a
+ * typist would produce it. Modifiers are always returned to neutral before
+ * explicit SS_TAP/SS_DOWN/SS_UP sequences, dead keys, and at end of string.
+ */
+
+#    define BATCHED_MOD_SHIFT (1 << 0)
+#    define BATCHED_MOD_ALTGR (1 << 1)
+
+static uint8_t batched_held_mods = 0;
+
+static void batched_set_mods(uint8_t wanted, uint8_t interval) {
+    // Mirror the single-char ordering: releases first (AltGr before Shift),
+    // then presses (Shift before AltGr).
+    if ((batched_held_mods & BATCHED_MOD_ALTGR) && !(wanted & BATCHED_MOD_ALTGR)) {
+        unregister_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+    if ((batched_held_mods & BATCHED_MOD_SHIFT) && !(wanted & BATCHED_MOD_SHIFT)) {
+        unregister_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if (!(batched_held_mods & BATCHED_MOD_SHIFT) && (wanted & BATCHED_MOD_SHIFT)) {
+        register_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if (!(batched_held_mods & BATCHED_MOD_ALTGR) && (wanted & BATCHED_MOD_ALTGR)) {
+        register_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+    batched_held_mods = wanted;
+}
+
+static void batched_send_char(char ascii_code, uint8_t interval) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        batched_set_mods(0, interval);
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    batched_set_mods((is_shifted ? BATCHED_MOD_SHIFT : 0) | (is_altgred ? BATCHED_MOD_ALTGR : 0), interval);
+
+    tap_code_delay(keycode, interval);
+    wait_ms(interval);
+
+    if (is_dead) {
+        batched_set_mods(0, interval);
+        tap_code(KC_SPACE);
+        wait_ms(interval);
+    }
+}
+#endif // SEND_STRING_BATCHED
+
+#ifdef SEND_STRING_PRECOMPILED
+/* Precompiled playback: the per-character LUT walks (keycode, shift, altgr,
+ * dead) are resolved once by send_string_compile; playback is a straight array
+ * walk that only diffs the wanted modifier state between steps, so a hot macro
+ * pays no table lookups and no redundant modifier reports per character. */
+
+int16_t send_string_compile(const char *string, send_string_step_t *steps, uint16_t capacity) {
+    uint16_t count = 0;
+    for (const char *p = string; *p; p++) {
+        uint8_t ascii_code = (uint8_t)*p;
+        if (ascii_code >= 0x80 || ascii_code == SS_QMK_PREFIX) {
+            return -1; // Explicit SS_* sequences and non-ASCII are not compilable
+        }
+        uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[ascii_code]);
+        if (keycode == KC_NO) {
+            continue; // Untypeable character, same as the interpreted path
+        }
+        if (count == capacity) {
+            return -1;
+        }
+        steps[count].keycode = keycode;
+        steps[count].mods    = (PGM_LOADBIT(ascii_to_shift_lut, ascii_code) ? SEND_STRING_STEP_SHIFT : 0) | //
+                            (PGM_LOADBIT(ascii_to_altgr_lut, ascii_code) ? SEND_STRING_STEP_ALTGR : 0) |    //
+                            (PGM_LOADBIT(ascii_to_dead_lut, ascii_code) ? SEND_STRING_STEP_DEAD : 0);
+        count++;
+    }
+    return (int16_t)count;
+}
+
+static void play_set_mods(uint8_t *held, uint8_t wanted, uint8_t interval) {
+    // Same ordering as the interpreted path: releases first (AltGr before
+    // Shift), then presses (Shift before AltGr)
+    if ((*held & SEND_STRING_STEP_ALTGR) && !(wanted & SEND_STRING_STEP_ALTGR)) {
+        unregister_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+    if ((*held & SEND_STRING_STEP_SHIFT) && !(wanted & SEND_STRING_STEP_SHIFT)) {
+        unregister_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if (!(*held & SEND_STRING_STEP_SHIFT) && (wanted & SEND_STRING_STEP_SHIFT)) {
+        register_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if (!(*held & SEND_STRING_STEP_ALTGR) && (wanted & SEND_STRING_STEP_ALTGR)) {
+        register_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+    *held = wanted;
+}
+
+void send_string_play_with_delay(const send_string_step_t *steps, uint16_t count, uint8_t interval) {
+    uint8_t held = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        play_set_mods(&held, steps[i].mods & (SEND_STRING_STEP_SHIFT | SEND_STRING_STEP_ALTGR), interval);
+        tap_code_delay(steps[i].keycode, interval);
+        wait_ms(interval);
+        if (steps[i].mods & SEND_STRING_STEP_DEAD) {
+            play_set_mods(&held, 0, interval);
+            tap_code(KC_SPACE);
+            wait_ms(interval);
+        }
+    }
+    play_set_mods(&held, 0, interval);
+}
+
+void send_string_play(const send_string_step_t *steps, uint16_t count) {
+    send_string_play_with_delay(steps, count, 0);
+}
+#endif // SEND_STRING_PRECOMPILED
+
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
     while (1) {
         char ascii_code = getter(arg);
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+#ifdef SEND_STRING_BATCHED
+            // Explicit key sequences must see the true modifier state.
+            batched_set_mods(0, interval);
+#endif
             ascii_code = getter(arg);
 
             if (ascii_code == SS_TAP_CODE) {
@@ -188,9 +326,16 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
             // if we had a delay that terminated with a null, we're done
             if (ascii_code == 0) break;
         } else {
+#ifdef SEND_STRING_BATCHED
+            batched_send_char(ascii_code, interval);
+#else
             send_char_with_delay(ascii_code, interval);
+#endif
         }
     }
+#ifdef SEND_STRING_BATCHED
+    batched_set_mods(0, interval);
+#endif
 }
 
 typedef struct send_string_memory_state_t {
@@ -123,6 +123,53 @@ void send_nibble(uint8_t number);
  */
 void tap_random_base64(void);
 
+#ifdef SEND_STRING_PRECOMPILED
+/** \brief One playback step of a precompiled string: a keycode plus the modifier state to hold while tapping it. */
+typedef struct send_string_step_t {
+    uint8_t keycode;
+    uint8_t mods;
+} send_string_step_t;
+
+#    define SEND_STRING_STEP_SHIFT (1 << 0)
+#    define SEND_STRING_STEP_ALTGR (1 << 1)
+#    define SEND_STRING_STEP_DEAD (1 << 2)
+
+/**
+ * \brief Compile an ASCII string into playback steps, resolving every per-character
+ * keycode/modifier lookup once up front.
+ *
+ * Intended to be run once (e.g. in `keyboard_post_init_user`) for macros that are
+ * played many times; `send_string_play` then replays the steps without touching
+ * the lookup tables. Only plain characters are supported - `SS_TAP`/`SS_DOWN`/
+ * `SS_UP`/`SS_DELAY` sequences are not.
+ *
+ * \param string The string to compile.
+ * \param steps Output array of playback steps.
+ * \param capacity Number of entries available in `steps`.
+ * \return The number of steps written, or -1 if the string does not fit or contains an unsupported sequence.
+ */
+int16_t send_string_compile(const char *string, send_string_step_t *steps, uint16_t capacity);
+
+/**
+ * \brief Play back precompiled steps with no inter-key delay.
+ *
+ * \param steps Steps produced by `send_string_compile`.
+ * \param count Number of steps.
+ */
+void send_string_play(const send_string_step_t *steps, uint16_t count);
+
+/**
+ * \brief Play back precompiled steps, with a delay between each key press.
+ *
+ * Consecutive steps that want the same modifiers share a single hold.
+ *
+ * \param steps Steps produced by `send_string_compile`.
+ * \param count Number of steps.
+ * \param interval The amount of time, in milliseconds, to wait before the next key press.
+ */
+void send_string_play_with_delay(const send_string_step_t *steps, uint16_t count, uint8_t interval);
+#endif
+
 #if defined(__AVR__) || defined(__DOXYGEN__)
 /**
  * \brief Type out a PROGMEM string of ASCII characters.
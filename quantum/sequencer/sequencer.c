@@ -26,6 +26,53 @@
 #    include "tests/midi_mock.h"
 #endif
 
+#ifdef SEQUENCER_TIMER_DRIVEN
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error SEQUENCER_TIMER_DRIVEN requires ChibiOS
+#    endif
+#    include <ch.h>
+
+// Timer-driven mode: a ChibiOS virtual timer armed for the exact next phase deadline marks a tick
+// pending from interrupt context, and sequencer_task() becomes a cheap flag test on every other
+// pass through the main loop. When a tick fires, the phase machine is drained until no more work is
+// due, so all note-ons/offs belonging to that tick go out in one batch, then the timer is re-armed
+// for the next deadline. Step timing is set by the timer hardware rather than by how often the scan
+// loop happens to come around.
+static virtual_timer_t       sequencer_vtimer;
+static volatile bool         sequencer_tick_pending = false;
+
+static void sequencer_vtimer_cb(virtual_timer_t *vtp, void *arg) {
+    (void)vtp;
+    (void)arg;
+    sequencer_tick_pending = true;
+}
+
+static void sequencer_schedule(uint16_t delay_ms) {
+    if (delay_ms == 0) {
+        delay_ms = 1;
+    }
+    chVTSet(&sequencer_vtimer, TIME_MS2I(delay_ms), sequencer_vtimer_cb, NULL);
+}
+
+// Milliseconds until the phase machine next has work to do
+static uint16_t sequencer_next_delay(void) {
+    uint16_t elapsed = timer_elapsed(sequencer_internal_state.timer);
+    uint16_t due;
+    switch (sequencer_internal_state.phase) {
+        case SEQUENCER_PHASE_ATTACK:
+            due = sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE;
+            break;
+        case SEQUENCER_PHASE_RELEASE:
+            due = SEQUENCER_PHASE_RELEASE_TIMEOUT + sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE;
+            break;
+        default:
+            due = sequencer_get_step_duration();
+            break;
+    }
+    return elapsed >= due ? 0 : due - elapsed;
+}
+#endif
+
 sequencer_config_t sequencer_config = {
     false,    // enabled
     {false},  // steps
@@ -47,12 +94,19 @@ void sequencer_on(void) {
     sequencer_internal_state.current_step  = 0;
     sequencer_internal_state.timer         = timer_read();
     sequencer_internal_state.phase         = SEQUENCER_PHASE_ATTACK;
+#ifdef SEQUENCER_TIMER_DRIVEN
+    sequencer_tick_pending = true; // first step fires on the next task pass
+#endif
 }
 
 void sequencer_off(void) {
     dprintln("sequencer off");
     sequencer_config.enabled              = false;
     sequencer_internal_state.current_step = 0;
+#ifdef SEQUENCER_TIMER_DRIVEN
+    chVTReset(&sequencer_vtimer);
+    sequencer_tick_pending = false;
+#endif
 }
 
 void sequencer_toggle(void) {
@@ -240,17 +294,38 @@ void sequencer_task(void) {
         return;
     }
 
-    if (sequencer_internal_state.phase == SEQUENCER_PHASE_PAUSE) {
-        sequencer_phase_pause();
+#ifdef SEQUENCER_TIMER_DRIVEN
+    if (!sequencer_tick_pending) {
+        return;
     }
+    sequencer_tick_pending = false;
+
+    // Drain every phase transition that is due, batching this tick's MIDI output in one pass
+    bool progressed;
+    do {
+        uint8_t track = sequencer_internal_state.current_track;
+        uint8_t step  = sequencer_internal_state.current_step;
+        uint8_t phase = sequencer_internal_state.phase;
+#endif
 
-    if (sequencer_internal_state.phase == SEQUENCER_PHASE_RELEASE) {
-        sequencer_phase_release();
-    }
+        if (sequencer_internal_state.phase == SEQUENCER_PHASE_PAUSE) {
+            sequencer_phase_pause();
+        }
 
-    if (sequencer_internal_state.phase == SEQUENCER_PHASE_ATTACK) {
-        sequencer_phase_attack();
-    }
+        if (sequencer_internal_state.phase == SEQUENCER_PHASE_RELEASE) {
+            sequencer_phase_release();
+        }
+
+        if (sequencer_internal_state.phase == SEQUENCER_PHASE_ATTACK) {
+            sequencer_phase_attack();
+        }
+
+#ifdef SEQUENCER_TIMER_DRIVEN
+        progressed = track != sequencer_internal_state.current_track || step != sequencer_internal_state.current_step || phase != sequencer_internal_state.phase;
+    } while (progressed);
+
+    sequencer_schedule(sequencer_next_delay());
+#endif
 }
 
 uint16_t sequencer_get_beat_duration(void) {
@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_link_monitor.h"
+#include "debug.h"
+
+// Baseline forced resync cadence; same default as transactions.c
+#ifndef FORCED_SYNC_THROTTLE_MS
+#    define FORCED_SYNC_THROTTLE_MS 100
+#endif // FORCED_SYNC_THROTTLE_MS
+
+// The error level is an EWMA over exchange outcomes: failures and checksum errors pull it up hard,
+// retries nudge it, successful passes bleed it off slowly. Hysteresis between the degrade and
+// recover thresholds keeps a marginal cable from flapping the adaptive state on every scan.
+
+static split_link_stats_t stats          = {0};
+static uint16_t           rtt_ewma_x16   = 0; // round-trip EWMA in ms, x16 fixed point
+static bool               rtt_primed     = false;
+
+static void update_degraded(void) {
+    if (!stats.degraded && stats.error_level >= SPLIT_LINK_MONITOR_DEGRADE_THRESHOLD) {
+        stats.degraded = true;
+        dprintln("split link degraded, shedding optional syncs");
+        split_link_monitor_degraded_kb(true);
+    } else if (stats.degraded && stats.error_level <= SPLIT_LINK_MONITOR_RECOVER_THRESHOLD) {
+        stats.degraded = false;
+        dprintln("split link recovered");
+        split_link_monitor_degraded_kb(false);
+    }
+}
+
+static void raise_error_level(uint8_t amount) {
+    stats.error_level = (amount > UINT8_MAX - stats.error_level) ? UINT8_MAX : stats.error_level + amount;
+    update_degraded();
+}
+
+void split_link_monitor_record_pass(bool okay, uint32_t elapsed_ms) {
+    stats.passes++;
+    if (okay) {
+        // Slow decay: one clean pass shouldn't mask a burst of failures
+        stats.error_level -= stats.error_level / 16;
+        update_degraded();
+    } else {
+        raise_error_level(48);
+    }
+
+    // The pass duration captures what the master loop actually paid, including retry backoff waits
+    if (elapsed_ms > UINT16_MAX) {
+        elapsed_ms = UINT16_MAX;
+    }
+    if (!rtt_primed) {
+        rtt_ewma_x16 = (uint16_t)(elapsed_ms * 16);
+        rtt_primed   = true;
+    } else {
+        rtt_ewma_x16 += (int32_t)(elapsed_ms * 16 - rtt_ewma_x16) / 8;
+    }
+    stats.round_trip_ewma_ms = rtt_ewma_x16 / 16;
+}
+
+void split_link_monitor_record_retry(void) {
+    stats.retries++;
+    raise_error_level(8);
+}
+
+void split_link_monitor_record_failure(void) {
+    stats.failed_passes++;
+}
+
+void split_link_monitor_record_crc_error(void) {
+    stats.crc_errors++;
+    raise_error_level(24);
+}
+
+uint8_t split_link_monitor_max_retries(uint8_t healthy_retries) {
+    // Blind retries against a bad link just stall the master loop; probe with a short budget and
+    // let the stretched resync cadence carry recovery instead.
+    if (stats.degraded && healthy_retries > SPLIT_LINK_MONITOR_DEGRADED_RETRIES) {
+        return SPLIT_LINK_MONITOR_DEGRADED_RETRIES;
+    }
+    return healthy_retries;
+}
+
+uint32_t split_link_monitor_throttle_ms(void) {
+    if (!stats.degraded) {
+        return FORCED_SYNC_THROTTLE_MS;
+    }
+    // Scale the backoff with how bad things are: one extra doubling per quarter of the level range
+    uint8_t shift = 1 + stats.error_level / 64;
+    if (shift > SPLIT_LINK_MONITOR_BACKOFF_MAX_SHIFT) {
+        shift = SPLIT_LINK_MONITOR_BACKOFF_MAX_SHIFT;
+    }
+    return (uint32_t)FORCED_SYNC_THROTTLE_MS << shift;
+}
+
+bool split_link_monitor_allow_optional(void) {
+    return !stats.degraded;
+}
+
+void split_link_monitor_get_stats(split_link_stats_t *out) {
+    memcpy(out, &stats, sizeof(*out));
+}
+
+__attribute__((weak)) void split_link_monitor_degraded_kb(bool degraded) {}
@@ -0,0 +1,63 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Link quality instrumentation and adaptive degradation for the split transport. The master side
+// counts retries, checksum mismatches and failed passes, tracks a round-trip EWMA, and folds them
+// into an error level with hysteresis. While the level stays high -- a marginal TRRS cable, a half
+// mid-reboot -- the master loop stays bounded: blind retries are cut, the forced resync cadence is
+// stretched, and the optional syncs (lighting, displays, telemetry) are shed so only matrix/state
+// traffic crosses the link. Everything restores once exchanges succeed again.
+
+// Error level above which the link is considered degraded (0-255 EWMA of exchange outcomes).
+#ifndef SPLIT_LINK_MONITOR_DEGRADE_THRESHOLD
+#    define SPLIT_LINK_MONITOR_DEGRADE_THRESHOLD 96
+#endif
+
+// Error level below which a degraded link is considered recovered.
+#ifndef SPLIT_LINK_MONITOR_RECOVER_THRESHOLD
+#    define SPLIT_LINK_MONITOR_RECOVER_THRESHOLD 16
+#endif
+
+// Per-handler retry budget while the link is degraded (healthy links use the stock count).
+#ifndef SPLIT_LINK_MONITOR_DEGRADED_RETRIES
+#    define SPLIT_LINK_MONITOR_DEGRADED_RETRIES 2
+#endif
+
+// Upper bound on the forced-resync backoff: the throttle stretches up to FORCED_SYNC_THROTTLE_MS
+// shifted left by this many bits.
+#ifndef SPLIT_LINK_MONITOR_BACKOFF_MAX_SHIFT
+#    define SPLIT_LINK_MONITOR_BACKOFF_MAX_SHIFT 3
+#endif
+
+// Cumulative counters plus the current link state, as returned by split_link_monitor_get_stats().
+typedef struct split_link_stats_t {
+    uint32_t passes;            // master transaction passes attempted
+    uint32_t failed_passes;     // passes that returned failure after retries
+    uint32_t retries;           // individual handler retry attempts beyond the first
+    uint32_t crc_errors;        // reads whose payload failed checksum verification
+    uint16_t round_trip_ewma_ms; // smoothed duration of a full master pass
+    uint8_t  error_level;       // 0-255 exchange-outcome EWMA driving the thresholds above
+    bool     degraded;          // whether adaptive degradation is currently active
+} split_link_stats_t;
+
+// Instrumentation feed; called from the transport/transaction plumbing on the master.
+void split_link_monitor_record_pass(bool okay, uint32_t elapsed_ms);
+void split_link_monitor_record_retry(void);
+void split_link_monitor_record_failure(void);
+void split_link_monitor_record_crc_error(void);
+
+// Adaptive outputs consumed by transactions.c.
+uint8_t  split_link_monitor_max_retries(uint8_t healthy_retries);
+uint32_t split_link_monitor_throttle_ms(void);
+bool     split_link_monitor_allow_optional(void);
+
+// Snapshot of the counters and current state, e.g. for a keyboard's raw HID stats reporting.
+void split_link_monitor_get_stats(split_link_stats_t *stats);
+
+// Notification hook fired on each degraded/recovered transition; the default is a no-op.
+void split_link_monitor_degraded_kb(bool degraded);
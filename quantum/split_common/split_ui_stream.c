@@ -0,0 +1,124 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_ui_stream.h"
+
+////////////////////////////////////////////////////
+// Initiator side
+
+static split_ui_stream_sync_t committed = {0};   // latest sealed frame, retained for resends
+static uint8_t                staging[SPLIT_UI_STREAM_BUFFER_SIZE];
+static uint8_t                staging_length = 0;
+static bool                   unsent         = false;
+
+static bool stream_append(const uint8_t *bytes, uint8_t count) {
+    if ((uint16_t)staging_length + count > SPLIT_UI_STREAM_BUFFER_SIZE) {
+        return false;
+    }
+    memcpy(&staging[staging_length], bytes, count);
+    staging_length += count;
+    return true;
+}
+
+bool split_ui_stream_set_region(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    uint8_t op[5] = {SPLIT_UI_OP_SET_REGION, x, y, w, h};
+    return stream_append(op, sizeof(op));
+}
+
+bool split_ui_stream_fill(uint8_t r, uint8_t g, uint8_t b) {
+    uint8_t op[4] = {SPLIT_UI_OP_FILL, r, g, b};
+    return stream_append(op, sizeof(op));
+}
+
+bool split_ui_stream_glyph_run(uint8_t x, uint8_t y, const char *text) {
+    size_t run = strlen(text);
+    if (run == 0 || run > UINT8_MAX) {
+        return false;
+    }
+    if ((uint16_t)staging_length + 4 + run > SPLIT_UI_STREAM_BUFFER_SIZE) {
+        return false;
+    }
+    uint8_t header[4] = {SPLIT_UI_OP_GLYPH_RUN, x, y, (uint8_t)run};
+    stream_append(header, sizeof(header));
+    stream_append((const uint8_t *)text, (uint8_t)run);
+    return true;
+}
+
+bool split_ui_stream_rgb_range(uint8_t first, uint8_t count, uint8_t h, uint8_t s, uint8_t v) {
+    uint8_t op[6] = {SPLIT_UI_OP_RGB_RANGE, first, count, h, s, v};
+    return stream_append(op, sizeof(op));
+}
+
+void split_ui_stream_commit(void) {
+    if (staging_length == 0) {
+        return;
+    }
+    memcpy(committed.stream, staging, staging_length);
+    committed.length = staging_length;
+    committed.generation++;
+    staging_length = 0;
+    unsent         = true;
+}
+
+bool split_ui_stream_snapshot(split_ui_stream_sync_t *sync) {
+    *sync = committed;
+    return unsent;
+}
+
+void split_ui_stream_mark_sent(void) {
+    unsent = false;
+}
+
+////////////////////////////////////////////////////
+// Target side
+
+void split_ui_stream_apply(const split_ui_stream_sync_t *sync) {
+    static uint8_t last_generation = 0;
+
+    uint8_t length = sync->length;
+    if (sync->generation == last_generation || length == 0 || length > SPLIT_UI_STREAM_BUFFER_SIZE) {
+        return;
+    }
+    last_generation = sync->generation;
+
+    uint8_t pos = 0;
+    while (pos < length) {
+        const uint8_t *op        = &sync->stream[pos];
+        uint8_t        remaining = length - pos;
+        switch (op[0]) {
+            case SPLIT_UI_OP_SET_REGION:
+                if (remaining < 5) return;
+                split_ui_stream_set_region_kb(op[1], op[2], op[3], op[4]);
+                pos += 5;
+                break;
+            case SPLIT_UI_OP_FILL:
+                if (remaining < 4) return;
+                split_ui_stream_fill_kb(op[1], op[2], op[3]);
+                pos += 4;
+                break;
+            case SPLIT_UI_OP_GLYPH_RUN:
+                if (remaining < 4 || remaining < 4 + op[3]) return;
+                split_ui_stream_glyph_run_kb(op[1], op[2], (const char *)&op[4], op[3]);
+                pos += 4 + op[3];
+                break;
+            case SPLIT_UI_OP_RGB_RANGE:
+                if (remaining < 6) return;
+                split_ui_stream_rgb_range_kb(op[1], op[2], op[3], op[4], op[5]);
+                pos += 6;
+                break;
+            default:
+                // Unknown opcode: stop rather than misparse the remainder.
+                return;
+        }
+    }
+}
+
+__attribute__((weak)) void split_ui_stream_set_region_kb(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {}
+
+__attribute__((weak)) void split_ui_stream_fill_kb(uint8_t r, uint8_t g, uint8_t b) {}
+
+__attribute__((weak)) void split_ui_stream_glyph_run_kb(uint8_t x, uint8_t y, const char *text, uint8_t length) {}
+
+__attribute__((weak)) void split_ui_stream_rgb_range_kb(uint8_t first, uint8_t count, uint8_t h, uint8_t s, uint8_t v) {}
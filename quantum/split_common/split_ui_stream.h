@@ -0,0 +1,64 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Compact opcode stream forwarding UI content to the split target. Instead of mirroring
+// whole display/LED buffers across the link, the initiator stages drawing commands
+// (set-region, fill, glyph runs, LED ranges) into a small buffer which is shipped as one
+// transaction and interpreted on the target against its own rendering hooks. A full
+// status-line update crosses the link as tens of bytes rather than a framebuffer.
+
+#ifndef SPLIT_UI_STREAM_BUFFER_SIZE
+#    define SPLIT_UI_STREAM_BUFFER_SIZE 30
+#endif
+
+enum split_ui_stream_opcode {
+    SPLIT_UI_OP_SET_REGION = 0x01, // x, y, w, h -- select the target rectangle for subsequent ops
+    SPLIT_UI_OP_FILL       = 0x02, // r, g, b -- flood the current region
+    SPLIT_UI_OP_GLYPH_RUN  = 0x03, // x, y, len, bytes[len] -- text run rendered in the target's font
+    SPLIT_UI_OP_RGB_RANGE  = 0x04, // first, count, h, s, v -- recolor a run of status LEDs
+};
+
+// Wire format exchanged through split shared memory. The generation counter lets the
+// target apply each committed stream exactly once despite forced periodic resends.
+typedef struct _split_ui_stream_sync_t {
+    uint8_t generation;
+    uint8_t length;
+    uint8_t stream[SPLIT_UI_STREAM_BUFFER_SIZE];
+} split_ui_stream_sync_t;
+
+////////////////////////////////////////////////////
+// Initiator side
+
+// Builders append opcodes to the staging buffer; they return false (leaving the buffer
+// untouched) when the op wouldn't fit in the remaining space.
+bool split_ui_stream_set_region(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+bool split_ui_stream_fill(uint8_t r, uint8_t g, uint8_t b);
+bool split_ui_stream_glyph_run(uint8_t x, uint8_t y, const char *text);
+bool split_ui_stream_rgb_range(uint8_t first, uint8_t count, uint8_t h, uint8_t s, uint8_t v);
+
+// Seal the staged opcodes into the next outbound frame; no-op when nothing was staged.
+void split_ui_stream_commit(void);
+
+// Transaction plumbing: copy the latest committed frame, reporting whether the target
+// hasn't seen it yet; acknowledge a successful send. Used by transactions.c.
+bool split_ui_stream_snapshot(split_ui_stream_sync_t *sync);
+void split_ui_stream_mark_sent(void);
+
+////////////////////////////////////////////////////
+// Target side
+
+// Decode a received frame, dispatching each opcode to the hooks below. Repeated
+// generations and malformed streams are ignored.
+void split_ui_stream_apply(const split_ui_stream_sync_t *sync);
+
+// Rendering hooks; override on a keyboard that drives its own display/LEDs from
+// initiator-provided content. Defaults are no-ops.
+void split_ui_stream_set_region_kb(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void split_ui_stream_fill_kb(uint8_t r, uint8_t g, uint8_t b);
+void split_ui_stream_glyph_run_kb(uint8_t x, uint8_t y, const char *text, uint8_t length);
+void split_ui_stream_rgb_range_kb(uint8_t first, uint8_t count, uint8_t h, uint8_t s, uint8_t v);
@@ -26,6 +26,10 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+    GET_SLAVE_MATRIX_DELTA,
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -99,6 +103,19 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#if defined(SPLIT_UI_STREAM_ENABLE)
+    PUT_UI_STREAM,
+#endif // SPLIT_UI_STREAM_ENABLE
+
+#if defined(SPLIT_FAST_RECONNECT)
+    GET_SYNC_GENERATION,
+    PUT_SYNC_GENERATION,
+#endif // SPLIT_FAST_RECONNECT
+
+#if defined(SPLIT_TRANSACTION_BATCHING)
+    PUT_BATCH,
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <stddef.h>
 
+#include "compiler_support.h"
 #include "crc.h"
 #include "debug.h"
 #include "matrix.h"
@@ -64,6 +65,12 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_UI_STREAM_ENABLE
+#    include "split_ui_stream.h"
+#endif
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+#    include "split_link_monitor.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -71,6 +78,13 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+// Sustained link errors stretch the forced resync cadence; see split_link_monitor.c
+#    define forced_sync_throttle_ms() split_link_monitor_throttle_ms()
+#else // SPLIT_LINK_MONITOR_ENABLE
+#    define forced_sync_throttle_ms() ((uint32_t)FORCED_SYNC_THROTTLE_MS)
+#endif // SPLIT_LINK_MONITOR_ENABLE
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
@@ -84,9 +98,21 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#ifdef SPLIT_TRANSACTION_BATCHING
+// Initiator2target writes are staged into a shared framed exchange instead of paying a full transport round-trip
+// each. The batch is flushed before anything that needs strict ordering with respect to the staged writes -- reads
+// and execs -- and at the end of each master transaction pass.
+static bool transactions_batch_write(int8_t id, const void *data, uint16_t length);
+static bool transactions_batch_flush(void);
+
+#    define transport_write(id, data, length) transactions_batch_write(id, data, length)
+#    define transport_read(id, data, length) (transactions_batch_flush() && transport_execute_transaction(id, NULL, 0, data, length))
+#    define transport_exec(id) (transactions_batch_flush() && transport_execute_transaction(id, NULL, 0, NULL, 0))
+#else // SPLIT_TRANSACTION_BATCHING
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#    define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
+#    define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#endif // SPLIT_TRANSACTION_BATCHING
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -99,8 +125,15 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
     int num_retries = is_transport_connected() ? 10 : 1;
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    // A degraded link gets a shorter retry budget -- blind retries against a flaky cable only stall the master loop
+    num_retries = split_link_monitor_max_retries(num_retries);
+#endif // SPLIT_LINK_MONITOR_ENABLE
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+            split_link_monitor_record_retry();
+#endif // SPLIT_LINK_MONITOR_ENABLE
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -109,6 +142,9 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         this_okay      = handler(master_matrix, slave_matrix);
         if (this_okay) return true;
     }
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    split_link_monitor_record_failure();
+#endif // SPLIT_LINK_MONITOR_ENABLE
     dprintf("Failed to execute %s\n", prefix);
     return false;
 }
@@ -144,12 +180,29 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+// Publishes a staged target2initiator block into shared memory, holding the shared-memory lock only for the final
+// copy -- and only when the contents actually changed. The comms thread never writes these regions, so the unlocked
+// compare is safe, and idle scans skip the lock entirely instead of contending with an in-flight wire exchange.
+static void publish_if_changed(void *equiv_shmem, const void *staged, size_t length) {
+    if (memcmp(equiv_shmem, staged, length) == 0) {
+        return;
+    }
+    split_shared_memory_lock();
+    memcpy(equiv_shmem, staged, length);
+    split_shared_memory_unlock();
+}
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+    if (okay && (timer_elapsed32(*last_update) >= forced_sync_throttle_ms() || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
+        if (okay && curr_checksum != crc8(equiv_shmem, length)) {
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+            split_link_monitor_record_crc_error();
+#endif // SPLIT_LINK_MONITOR_ENABLE
+            okay = false;
+        }
         if (okay) {
             *last_update = timer_read32();
         }
@@ -161,7 +214,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (timer_elapsed32(*last_update) >= forced_sync_throttle_ms() || condition) {
         okay &= transport_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
@@ -175,9 +228,144 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+#if defined(SPLIT_LIGHTING_SYNC_ON_CHANGE) && !defined(SPLIT_FAST_RECONNECT)
+#    error "SPLIT_LIGHTING_SYNC_ON_CHANGE requires SPLIT_FAST_RECONNECT to re-push lighting state after a target reboot"
+#endif
+
+// Sync for the lighting subsystems, whose effects both halves render locally from the synced clock: the steady
+// state needs no refresh traffic at all, only actual config changes do. With SPLIT_LIGHTING_SYNC_ON_CHANGE the
+// periodic forced resend is dropped, freeing its slice of the link for matrix sync. The forced resend otherwise
+// doubles as reboot recovery, hence the SPLIT_FAST_RECONNECT requirement above: a rebooted target is detected by
+// generation mismatch and the wiped mirror re-pushes the full state through the handlers' change detection.
+inline static bool send_lighting_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
+#if defined(SPLIT_LIGHTING_SYNC_ON_CHANGE)
+    bool okay = true;
+    if (condition) {
+        okay &= transport_write(trans_id, source, length);
+        if (okay) {
+            *last_update = timer_read32();
+        }
+    }
+    return okay;
+#else
+    return send_if_condition(trans_id, last_update, condition, source, length);
+#endif
+}
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+
+// Number of slave scans a changed row stays in the delta region -- rows are absolute values so re-applying a
+// lingering row is idempotent, and the linger window lets the master pick up a change even when its read cadence
+// lags a few scans behind the slave's updates.
+#    ifndef SPLIT_MATRIX_DELTA_LINGER_SCANS
+#        define SPLIT_MATRIX_DELTA_LINGER_SCANS 32
+#    endif // SPLIT_MATRIX_DELTA_LINGER_SCANS
+
+STATIC_ASSERT((MATRIX_ROWS) / 2 <= 8, "SPLIT_MATRIX_DELTA_ENABLE supports at most 8 rows per half");
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t     last_update                    = 0;
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+
+    uint8_t curr_checksum;
+    bool    okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    if (okay) {
+        bool need_full = timer_elapsed32(last_update) >= forced_sync_throttle_ms();
+        if (!need_full && curr_checksum != crc8(last_matrix, sizeof(last_matrix))) {
+            // Something changed -- try to reconstruct from the delta region before falling back to a full read
+            split_slave_matrix_delta_sync_t delta;
+            okay &= transport_read(GET_SLAVE_MATRIX_DELTA, &delta, sizeof(delta));
+            if (okay) {
+                memcpy(temp_matrix, last_matrix, sizeof(temp_matrix));
+                uint8_t delta_rows = 0;
+                bool    applied    = true;
+                for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+                    if (delta.row_bitmap & (1 << row)) {
+                        if (delta_rows >= SPLIT_MATRIX_DELTA_MAX_ROWS) {
+                            // More rows changed than fit in the delta region
+                            applied = false;
+                            break;
+                        }
+                        temp_matrix[row] = delta.rows[delta_rows++];
+                    }
+                }
+                if (applied && crc8(temp_matrix, sizeof(temp_matrix)) == delta.checksum) {
+                    memcpy(last_matrix, temp_matrix, sizeof(last_matrix));
+                    last_update = timer_read32();
+                } else {
+                    // Reconstruction failed -- e.g. a change was missed outside the linger window
+                    need_full = true;
+                }
+            }
+        }
+        if (okay && need_full) {
+            okay &= transport_read(GET_SLAVE_MATRIX_DATA, temp_matrix, sizeof(temp_matrix));
+            if (okay && curr_checksum != crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix))) {
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+                split_link_monitor_record_crc_error();
+#endif // SPLIT_LINK_MONITOR_ENABLE
+                okay = false;
+            }
+            if (okay) {
+                memcpy(last_matrix, temp_matrix, sizeof(last_matrix));
+                last_update = timer_read32();
+            }
+        }
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t prev_matrix[(MATRIX_ROWS) / 2] = {0};
+    static uint8_t      linger[(MATRIX_ROWS) / 2]      = {0};
+
+    // Stage everything locally -- matrix copy, checksum and delta region -- so the shared-memory lock is only
+    // taken for the short publishing copies, instead of being held across the crc8 every scan.
+    split_slave_matrix_sync_t       staged_matrix = {0}; // zero-init so struct padding compares clean
+    split_slave_matrix_delta_sync_t staged_delta  = {0};
+
+    memcpy(staged_matrix.matrix, slave_matrix, sizeof(staged_matrix.matrix));
+    staged_matrix.checksum = crc8(staged_matrix.matrix, sizeof(staged_matrix.matrix));
+
+    // Rebuild the delta region: recently-changed rows, with their current (absolute) values
+    uint8_t delta_rows = 0;
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+        if (slave_matrix[row] != prev_matrix[row]) {
+            prev_matrix[row] = slave_matrix[row];
+            linger[row]      = SPLIT_MATRIX_DELTA_LINGER_SCANS;
+        } else if (linger[row] > 0) {
+            --linger[row];
+        }
+        if (linger[row] > 0) {
+            staged_delta.row_bitmap |= (1 << row);
+            if (delta_rows < SPLIT_MATRIX_DELTA_MAX_ROWS) {
+                staged_delta.rows[delta_rows++] = slave_matrix[row];
+            }
+        }
+    }
+    staged_delta.checksum = staged_matrix.checksum;
+
+    publish_if_changed(&split_shmem->smatrix, &staged_matrix, sizeof(staged_matrix));
+    publish_if_changed(&split_shmem->smatrix_delta, &staged_delta, sizeof(staged_delta));
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    [GET_SLAVE_MATRIX_DELTA]    = trans_target2initiator_initializer(smatrix_delta),
+// clang-format on
+
+#else // SPLIT_MATRIX_DELTA_ENABLE
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -194,18 +382,25 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
-    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    // Stage locally so the shared-memory lock is only taken for the short publishing copy, instead of being held
+    // across the crc8 every scan -- and not at all while the matrix is unchanged.
+    split_slave_matrix_sync_t staged_matrix = {0}; // zero-init so struct padding compares clean
+    memcpy(staged_matrix.matrix, slave_matrix, sizeof(staged_matrix.matrix));
+    staged_matrix.checksum = crc8(staged_matrix.matrix, sizeof(staged_matrix.matrix));
+
+    publish_if_changed(&split_shmem->smatrix, &staged_matrix, sizeof(staged_matrix));
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -300,7 +495,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     static uint32_t last_update = 0;
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+    if (timer_elapsed32(last_update) >= forced_sync_throttle_ms()) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
         okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
@@ -402,7 +597,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = timer_elapsed32(last_update) >= forced_sync_throttle_ms();
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -502,7 +697,14 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
+#    if defined(SPLIT_LIGHTING_SYNC_ON_CHANGE)
+    // A fast-reconnect invalidate zeroes the mirror without raising any change flags; catch the config
+    // mismatch here and flag a full re-apply so a rebooted target still receives the current state.
+    if (rgblight_sync.status.change_flags == 0 && memcmp(&rgblight_sync.config, &split_shmem->rgblight_sync.config, sizeof(rgblight_sync.config)) != 0) {
+        rgblight_sync.status.change_flags = RGBLIGHT_STATUS_CHANGE_MODE | RGBLIGHT_STATUS_CHANGE_HSVS | RGBLIGHT_STATUS_CHANGE_TIMER | RGBLIGHT_STATUS_CHANGE_LAYERS;
+    }
+#    endif
+    if (send_lighting_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
         rgblight_clear_change_flags();
     } else {
         return false;
@@ -545,7 +747,7 @@ static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     led_matrix_sync_t led_matrix_sync;
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+    return send_lighting_if_condition(PUT_LED_MATRIX, &last_update, (memcmp(&led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync)) != 0), &led_matrix_sync, sizeof(led_matrix_sync));
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -579,7 +781,7 @@ static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    return send_lighting_if_condition(PUT_RGB_MATRIX, &last_update, (memcmp(&rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync)) != 0), &rgb_matrix_sync, sizeof(rgb_matrix_sync));
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -886,6 +1088,47 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+////////////////////////////////////////////////////
+// UI opcode stream
+
+#if defined(SPLIT_UI_STREAM_ENABLE)
+
+static bool ui_stream_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t        last_update = 0;
+    split_ui_stream_sync_t sync;
+    bool                   pending = split_ui_stream_snapshot(&sync);
+    // The forced periodic resend doubles as reboot recovery; the target applies each
+    // generation exactly once, so re-sending the latest frame is harmless.
+    bool okay = send_if_condition(PUT_UI_STREAM, &last_update, pending, &sync, sizeof(sync));
+    if (okay && pending) {
+        split_ui_stream_mark_sent();
+    }
+    return okay;
+}
+
+static void ui_stream_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_shared_memory_lock();
+    split_ui_stream_sync_t sync = split_shmem->ui_stream;
+    split_shared_memory_unlock();
+
+    // Decode outside the lock -- the rendering hooks may take display-driver time.
+    split_ui_stream_apply(&sync);
+}
+
+// clang-format off
+#    define TRANSACTIONS_UI_STREAM_MASTER() TRANSACTION_HANDLER_MASTER(ui_stream)
+#    define TRANSACTIONS_UI_STREAM_SLAVE() TRANSACTION_HANDLER_SLAVE(ui_stream)
+#    define TRANSACTIONS_UI_STREAM_REGISTRATIONS [PUT_UI_STREAM] = trans_initiator2target_initializer(ui_stream),
+// clang-format on
+
+#else // defined(SPLIT_UI_STREAM_ENABLE)
+
+#    define TRANSACTIONS_UI_STREAM_MASTER()
+#    define TRANSACTIONS_UI_STREAM_SLAVE()
+#    define TRANSACTIONS_UI_STREAM_REGISTRATIONS
+
+#endif // defined(SPLIT_UI_STREAM_ENABLE)
+
 ////////////////////////////////////////////////////
 // Detected OS
 
@@ -914,6 +1157,163 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Transaction batching
+
+#if defined(SPLIT_TRANSACTION_BATCHING)
+
+STATIC_ASSERT(SPLIT_BATCH_BUFFER_SIZE <= UINT8_MAX, "SPLIT_BATCH_BUFFER_SIZE must fit in a uint8_t");
+
+// Staging area for the outbound batch, packed as consecutive [id, length, payload] entries.
+static split_transaction_batch_t batch_staging;
+
+static bool transactions_batch_flush(void) {
+    if (batch_staging.length == 0) {
+        return true;
+    }
+    bool okay            = transport_execute_transaction(PUT_BATCH, &batch_staging, sizeof(batch_staging), NULL, 0);
+    batch_staging.length = 0;
+    return okay;
+}
+
+static bool transactions_batch_write(int8_t id, const void *data, uint16_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (length > trans->initiator2target_buffer_size) {
+        length = trans->initiator2target_buffer_size;
+    }
+
+    // Entries too large to ever fit in the batch buffer go through as their own exchange, flushing first so the
+    // target still observes the staged writes in order.
+    if ((length + 2) > sizeof(batch_staging.buffer)) {
+        return transactions_batch_flush() && transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    // Flush the pending batch if this entry would overflow it.
+    if (((uint16_t)batch_staging.length + length + 2) > sizeof(batch_staging.buffer)) {
+        if (!transactions_batch_flush()) {
+            return false;
+        }
+    }
+
+    // Mirror into the local shared memory, same as a direct write would -- the dirty checks in the master handlers
+    // compare against the shmem copy, so it has to reflect what's been staged. If the eventual flush fails, the
+    // FORCED_SYNC_THROTTLE_MS resync brings the target back up to date.
+    memcpy(split_trans_initiator2target_buffer(trans), data, length);
+
+    batch_staging.buffer[batch_staging.length++] = (uint8_t)id;
+    batch_staging.buffer[batch_staging.length++] = (uint8_t)length;
+    memcpy(&batch_staging.buffer[batch_staging.length], data, length);
+    batch_staging.length += (uint8_t)length;
+    return true;
+}
+
+static void batch_handlers_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // Unpack each staged entry into its transaction's shared memory region, as if it had arrived as its own
+    // exchange, and fire any per-transaction slave callback in staging order.
+    uint8_t length = split_shmem->batch.length;
+    if (length > SPLIT_BATCH_BUFFER_SIZE) {
+        return;
+    }
+
+    uint16_t pos = 0;
+    while ((pos + 2) <= length) {
+        uint8_t id        = split_shmem->batch.buffer[pos++];
+        uint8_t entry_len = split_shmem->batch.buffer[pos++];
+        if ((pos + entry_len) > length || id >= NUM_TOTAL_TRANSACTIONS) {
+            break;
+        }
+
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (entry_len > trans->initiator2target_buffer_size) {
+            break;
+        }
+
+        memcpy(split_trans_initiator2target_buffer(trans), &split_shmem->batch.buffer[pos], entry_len);
+        if (trans->slave_callback) {
+            trans->slave_callback(entry_len, &split_shmem->batch.buffer[pos], 0, NULL);
+        }
+        pos += entry_len;
+    }
+    split_shmem->batch.length = 0;
+}
+
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [PUT_BATCH] = trans_initiator2target_initializer_cb(batch, batch_handlers_slave_callback),
+
+#else // defined(SPLIT_TRANSACTION_BATCHING)
+
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // defined(SPLIT_TRANSACTION_BATCHING)
+
+////////////////////////////////////////////////////
+// Fast reconnect
+
+#if defined(SPLIT_FAST_RECONNECT)
+
+// Wipes the initiator's mirror of the sync state. The dirty-compares in the master handlers all test against this
+// mirror, so zeroing it guarantees the next pass pushes -- and re-reads -- everything, regardless of what either
+// side held before.
+static void split_sync_invalidate(void) {
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+#    if defined(SPLIT_TRANSACTION_BATCHING)
+    batch_staging.length = 0;
+#    endif // defined(SPLIT_TRANSACTION_BATCHING)
+}
+
+// Validates the peer before a full transaction pass is allowed to run. The generation is assigned by the master and
+// cached in the target's shared memory: a cable wiggle leaves it intact, while a target reboot clears it back to
+// zero. On a match the pass resumes delta sync against the still-valid mirror; only a mismatch pays for a full state
+// push. While the link is down this is also the only exchange attempted, so each throttled probe costs one transport
+// timeout instead of a whole pass of failing transactions.
+static bool fast_reconnect_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t session_generation = 0; // last generation assigned to the peer; 0 is reserved for "never assigned"
+    static bool    peer_validated     = false;
+
+    if (!is_transport_connected()) {
+        peer_validated = false;
+    }
+    if (peer_validated) {
+        return true;
+    }
+
+    uint8_t peer_generation = 0;
+    if (!transport_execute_transaction(GET_SYNC_GENERATION, NULL, 0, &peer_generation, sizeof(peer_generation))) {
+        return false;
+    }
+
+    if (peer_generation == 0 || peer_generation != session_generation) {
+        // First contact, a rebooted peer, or a rebooted master -- the two sides no longer agree on sync state, so
+        // re-init in full: invalidate the mirror and hand the peer a fresh generation.
+        split_sync_invalidate();
+        if (++session_generation == 0) {
+            ++session_generation;
+        }
+        if (!transport_execute_transaction(PUT_SYNC_GENERATION, &session_generation, sizeof(session_generation), NULL, 0)) {
+            return false;
+        }
+    }
+
+    peer_validated = true;
+    return true;
+}
+
+// clang-format off
+#    define TRANSACTIONS_FAST_RECONNECT_MASTER()                                            \
+        do {                                                                                \
+            if (!fast_reconnect_handlers_master(master_matrix, slave_matrix)) return false; \
+        } while (0)
+#    define TRANSACTIONS_FAST_RECONNECT_REGISTRATIONS \
+    [GET_SYNC_GENERATION] = trans_target2initiator_initializer(sync_generation), \
+    [PUT_SYNC_GENERATION] = trans_initiator2target_initializer(sync_generation),
+// clang-format on
+
+#else // defined(SPLIT_FAST_RECONNECT)
+
+#    define TRANSACTIONS_FAST_RECONNECT_MASTER()
+#    define TRANSACTIONS_FAST_RECONNECT_REGISTRATIONS
+
+#endif // defined(SPLIT_FAST_RECONNECT)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -943,7 +1343,10 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_WATCHDOG_REGISTRATIONS
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
+    TRANSACTIONS_UI_STREAM_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_FAST_RECONNECT_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -955,6 +1358,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_FAST_RECONNECT_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -962,18 +1366,37 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
     TRANSACTIONS_MODS_MASTER();
-    TRANSACTIONS_BACKLIGHT_MASTER();
-    TRANSACTIONS_RGBLIGHT_MASTER();
-    TRANSACTIONS_LED_MATRIX_MASTER();
-    TRANSACTIONS_RGB_MATRIX_MASTER();
-    TRANSACTIONS_WPM_MASTER();
-    TRANSACTIONS_OLED_MASTER();
-    TRANSACTIONS_ST7565_MASTER();
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    // While the link is degraded, shed the cosmetic/telemetry syncs so each pass only moves the
+    // matrix and input state; they resume (and the forced resyncs repopulate them) on recovery.
+    if (split_link_monitor_allow_optional()) {
+#endif // SPLIT_LINK_MONITOR_ENABLE
+        TRANSACTIONS_BACKLIGHT_MASTER();
+        TRANSACTIONS_RGBLIGHT_MASTER();
+        TRANSACTIONS_LED_MATRIX_MASTER();
+        TRANSACTIONS_RGB_MATRIX_MASTER();
+        TRANSACTIONS_WPM_MASTER();
+        TRANSACTIONS_OLED_MASTER();
+        TRANSACTIONS_ST7565_MASTER();
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    }
+#endif // SPLIT_LINK_MONITOR_ENABLE
     TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
-    TRANSACTIONS_DETECTED_OS_MASTER();
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    if (split_link_monitor_allow_optional()) {
+#endif // SPLIT_LINK_MONITOR_ENABLE
+        TRANSACTIONS_UI_STREAM_MASTER();
+        TRANSACTIONS_DETECTED_OS_MASTER();
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    }
+#endif // SPLIT_LINK_MONITOR_ENABLE
+#ifdef SPLIT_TRANSACTION_BATCHING
+    // Push out everything staged during this pass as a single framed exchange.
+    if (!transactions_batch_flush()) return false;
+#endif // SPLIT_TRANSACTION_BATCHING
     return true;
 }
 
@@ -996,6 +1419,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_WATCHDOG_SLAVE();
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
+    TRANSACTIONS_UI_STREAM_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
 }
 
@@ -23,6 +23,11 @@
 #include "transaction_id_define.h"
 #include "atomic_util.h"
 
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+#    include "split_link_monitor.h"
+#    include "timer.h"
+#endif
+
 #ifdef USE_I2C
 
 #    ifndef SLAVE_I2C_TIMEOUT
@@ -123,7 +128,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_LINK_MONITOR_ENABLE
+    // Time the full pass -- retry backoff waits included -- so the round-trip EWMA reflects what the
+    // master loop actually pays per scan on the current link.
+    uint32_t start = timer_read32();
+    bool     okay  = transactions_master(master_matrix, slave_matrix);
+    split_link_monitor_record_pass(okay, timer_elapsed32(start));
+    return okay;
+#else // SPLIT_LINK_MONITOR_ENABLE
     return transactions_master(master_matrix, slave_matrix);
+#endif // SPLIT_LINK_MONITOR_ENABLE
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
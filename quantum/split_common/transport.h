@@ -23,6 +23,10 @@
 #include "action_layer.h"
 #include "matrix.h"
 
+#if defined(SPLIT_UI_STREAM_ENABLE)
+#    include "split_ui_stream.h"
+#endif // defined(SPLIT_UI_STREAM_ENABLE)
+
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
 #endif // RPC_M2S_BUFFER_SIZE
@@ -57,6 +61,18 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+#    ifndef SPLIT_MATRIX_DELTA_MAX_ROWS
+#        define SPLIT_MATRIX_DELTA_MAX_ROWS 2
+#    endif // SPLIT_MATRIX_DELTA_MAX_ROWS
+
+typedef struct _split_slave_matrix_delta_sync_t {
+    uint8_t      checksum;   // crc8 of the full slave matrix the delta was generated from
+    uint8_t      row_bitmap; // bit n set = row n recently changed; its data is in rows[], in bit order
+    matrix_row_t rows[SPLIT_MATRIX_DELTA_MAX_ROWS];
+} split_slave_matrix_delta_sync_t;
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -132,6 +148,17 @@ typedef struct _split_slave_activity_sync_t {
 } split_slave_activity_sync_t;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_TRANSACTION_BATCHING)
+#    ifndef SPLIT_BATCH_BUFFER_SIZE
+#        define SPLIT_BATCH_BUFFER_SIZE 64
+#    endif // SPLIT_BATCH_BUFFER_SIZE
+
+typedef struct _split_transaction_batch_t {
+    uint8_t length; // number of bytes of `buffer` in use
+    uint8_t buffer[SPLIT_BATCH_BUFFER_SIZE];
+} split_transaction_batch_t;
+#endif // defined(SPLIT_TRANSACTION_BATCHING)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 typedef struct _rpc_sync_info_t {
     uint8_t checksum;
@@ -154,6 +181,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+    split_slave_matrix_delta_sync_t smatrix_delta;
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -222,6 +253,19 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_UI_STREAM_ENABLE)
+    split_ui_stream_sync_t ui_stream;
+#endif // defined(SPLIT_UI_STREAM_ENABLE)
+
+#if defined(SPLIT_FAST_RECONNECT)
+    // Generation assigned by the master; survives a link drop on the target but clears to zero on a target reboot
+    uint8_t sync_generation;
+#endif // defined(SPLIT_FAST_RECONNECT)
+
+#if defined(SPLIT_TRANSACTION_BATCHING)
+    split_transaction_batch_t batch;
+#endif // defined(SPLIT_TRANSACTION_BATCHING)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
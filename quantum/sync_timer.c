@@ -29,13 +29,89 @@ SOFTWARE.
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
 volatile int32_t sync_timer_ms;
 
+#    ifdef SYNC_TIMER_SLEW
+// PLL-style offset tracking: instead of jumping the applied offset to each
+// received sample (a visible discontinuity for any timed animation on the
+// slave), the raw samples feed an exponential filter and the applied offset
+// slews toward the filtered target by at most SYNC_TIMER_SLEW_MAX_STEP ms per
+// sync. Only the first sync after (re)connect, or an error beyond
+// SYNC_TIMER_SLEW_JUMP_THRESHOLD, jumps outright.
+
+// Maximum applied-offset correction per sync, in ms
+#        ifndef SYNC_TIMER_SLEW_MAX_STEP
+#            define SYNC_TIMER_SLEW_MAX_STEP 2
+#        endif
+// Errors beyond this many ms indicate a reconnect/reboot rather than drift
+#        ifndef SYNC_TIMER_SLEW_JUMP_THRESHOLD
+#            define SYNC_TIMER_SLEW_JUMP_THRESHOLD 100
+#        endif
+// EMA weight = 1/2^shift for both the offset filter and the latency estimate
+#        define SYNC_TIMER_FILTER_SHIFT 3
+// The sample-maximum decays 1 ms per this many syncs, tracking downward drift
+#        define SYNC_TIMER_PEAK_DECAY_SYNCS 32
+
+static bool    sync_timer_locked     = false;
+static int32_t sync_offset_filter_fp = 0; // filtered target offset, << SYNC_TIMER_FILTER_SHIFT
+static int32_t sync_offset_peak      = 0; // decaying max of raw samples (least-delayed sync seen recently)
+static int32_t sync_latency_fp       = 0; // filtered link latency, << SYNC_TIMER_FILTER_SHIFT
+static uint8_t sync_peak_decay_count = 0;
+#    endif
+
 void sync_timer_init(void) {
     sync_timer_ms = 0;
+#    ifdef SYNC_TIMER_SLEW
+    sync_timer_locked = false;
+#    endif
 }
 
 void sync_timer_update(uint32_t time) {
     if (is_keyboard_master()) return;
-    sync_timer_ms = time - timer_read32();
+    int32_t sample = time - timer_read32();
+#    ifndef SYNC_TIMER_SLEW
+    sync_timer_ms = sample;
+#    else
+    int32_t error = sample - sync_timer_ms;
+    if (!sync_timer_locked || error > SYNC_TIMER_SLEW_JUMP_THRESHOLD || error < -SYNC_TIMER_SLEW_JUMP_THRESHOLD) {
+        // First sync after (re)connect: take the sample as-is and reseed
+        sync_timer_ms         = sample;
+        sync_offset_filter_fp = sample << SYNC_TIMER_FILTER_SHIFT;
+        sync_offset_peak      = sample;
+        sync_latency_fp       = 0;
+        sync_peak_decay_count = 0;
+        sync_timer_locked     = true;
+        return;
+    }
+
+    // Transport delay makes the received master time stale, so every sample
+    // under-reads the true offset by the link latency of that sync. A slowly
+    // decaying maximum tracks the least-delayed syncs; the gap between it and
+    // the current sample estimates this sync's latency.
+    if (sample > sync_offset_peak) {
+        sync_offset_peak      = sample;
+        sync_peak_decay_count = 0;
+    } else if (++sync_peak_decay_count >= SYNC_TIMER_PEAK_DECAY_SYNCS) {
+        sync_offset_peak--;
+        sync_peak_decay_count = 0;
+    }
+    sync_latency_fp += (sync_offset_peak - sample) - (sync_latency_fp >> SYNC_TIMER_FILTER_SHIFT);
+
+    // Filter the raw samples, then slew the applied offset toward the filtered
+    // target with a bounded step so slave-side timers never see a visible jump
+    sync_offset_filter_fp += sample - (sync_offset_filter_fp >> SYNC_TIMER_FILTER_SHIFT);
+    int32_t step = (sync_offset_filter_fp >> SYNC_TIMER_FILTER_SHIFT) - sync_timer_ms;
+    if (step > SYNC_TIMER_SLEW_MAX_STEP) step = SYNC_TIMER_SLEW_MAX_STEP;
+    if (step < -SYNC_TIMER_SLEW_MAX_STEP) step = -SYNC_TIMER_SLEW_MAX_STEP;
+    sync_timer_ms += step;
+#    endif
+}
+
+uint16_t sync_timer_link_latency(void) {
+#    ifdef SYNC_TIMER_SLEW
+    if (!is_keyboard_master() && sync_timer_locked) {
+        return (uint16_t)(sync_latency_fp >> SYNC_TIMER_FILTER_SHIFT);
+    }
+#    endif
+    return 0;
 }
 
 uint16_t sync_timer_read(void) {
@@ -39,6 +39,9 @@ uint16_t sync_timer_read(void);
 uint32_t sync_timer_read32(void);
 uint16_t sync_timer_elapsed(uint16_t last);
 uint32_t sync_timer_elapsed32(uint32_t last);
+// Filtered estimate of the master->slave transport delay in ms; 0 on the
+// master, before the first sync, or without SYNC_TIMER_SLEW
+uint16_t sync_timer_link_latency(void);
 #else
 #    define sync_timer_init()
 #    define sync_timer_clear()
@@ -47,6 +50,7 @@ uint32_t sync_timer_elapsed32(uint32_t last);
 #    define sync_timer_read32() timer_read32()
 #    define sync_timer_elapsed(t) timer_elapsed(t)
 #    define sync_timer_elapsed32(t) timer_elapsed32(t)
+#    define sync_timer_link_latency() 0
 #endif
 
 #ifdef __cplusplus
@@ -28,7 +28,9 @@
 
 #include "via.h"
 
+#include <string.h> // for memcpy
 #include "raw_hid.h"
+#include "action_layer.h"
 #include "dynamic_keymap.h"
 #include "eeconfig.h"
 #include "matrix.h"
@@ -116,6 +118,10 @@ void via_init(void) {
 void eeconfig_init_via(void) {
     // Erase any NVM storage if necessary
     nvm_via_erase();
+    // The reset below rewrites the layout options, the entire keymap and the macro buffer --
+    // stage the lot and commit once. A power loss mid-transaction leaves the freshly-erased
+    // (and therefore invalid) storage behind, which re-triggers this init on the next boot.
+    eeconfig_transaction_begin();
     // set the magic number to false, in case this gets interrupted
     via_eeprom_set_valid(false);
     // This resets the layout options
@@ -126,6 +132,7 @@ void eeconfig_init_via(void) {
     dynamic_keymap_macro_reset();
     // Save the magic number last, in case saving was interrupted
     via_eeprom_set_valid(true);
+    eeconfig_transaction_commit();
 }
 
 // This is generalized so the layout options EEPROM usage can be
@@ -283,6 +290,49 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+#ifdef VIA_EVENT_PUSH
+
+// Event push: instead of the host polling layer/encoder/dip state, the firmware
+// emits a report whenever a subscribed state changes. Events cost nothing while
+// nothing changes and nothing at all while no host has subscribed.
+
+static uint8_t via_event_subscription = 0;
+
+static void via_event_send(uint8_t event_type, const uint8_t *payload, uint8_t payload_length) {
+    uint8_t msg[32] = {id_event_push, event_type}; // raw HID reports are always 32 bytes
+    memcpy(&msg[2], payload, payload_length);
+    raw_hid_send(msg, sizeof(msg));
+}
+
+void via_event_push_layer_state(uint32_t state) {
+    // layer_state_set() fires on every set, not just on change; only push deltas
+    static uint32_t last_pushed = 0;
+    if (!(via_event_subscription & VIA_EVENT_MASK_LAYER) || state == last_pushed) {
+        return;
+    }
+    last_pushed        = state;
+    uint8_t payload[5] = {state & 0xFF, (state >> 8) & 0xFF, (state >> 16) & 0xFF, (state >> 24) & 0xFF, get_highest_layer(state)};
+    via_event_send(id_event_layer, payload, sizeof(payload));
+}
+
+void via_event_push_encoder(uint8_t index, int16_t delta) {
+    if (!(via_event_subscription & VIA_EVENT_MASK_ENCODER)) {
+        return;
+    }
+    uint8_t payload[3] = {index, delta & 0xFF, (delta >> 8) & 0xFF};
+    via_event_send(id_event_encoder, payload, sizeof(payload));
+}
+
+void via_event_push_dip_switch(uint8_t index, bool active) {
+    if (!(via_event_subscription & VIA_EVENT_MASK_DIP_SWITCH)) {
+        return;
+    }
+    uint8_t payload[2] = {index, active ? 1 : 0};
+    via_event_send(id_event_dip_switch, payload, sizeof(payload));
+}
+
+#endif // VIA_EVENT_PUSH
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -447,6 +497,66 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_buffer(offset, size, &command_data[3]);
             break;
         }
+        case id_dynamic_keymap_bulk_get: {
+            uint16_t offset  = (command_data[0] << 8) | command_data[1];
+            uint16_t size    = (command_data[2] << 8) | command_data[3];
+            uint8_t  max     = length - VIA_BULK_GET_HEADER_SIZE;
+            uint8_t  seq     = 0;
+            // Stream the range as [command, sequence, length, checksum, payload] packets;
+            // the last one doubles as the regular command response sent below
+            do {
+                uint8_t chunk = (size > max) ? max : (uint8_t)size;
+                data[1]       = seq++;
+                data[2]       = chunk;
+                dynamic_keymap_get_buffer(offset, chunk, &data[VIA_BULK_GET_HEADER_SIZE]);
+                uint8_t sum = 0;
+                for (uint8_t i = 0; i < chunk; i++) {
+                    sum += data[VIA_BULK_GET_HEADER_SIZE + i];
+                }
+                data[3] = (uint8_t)(0 - sum);
+                offset += chunk;
+                size -= chunk;
+                if (size > 0) {
+                    raw_hid_send(data, length);
+                }
+            } while (size > 0 && seq != 0);
+            break;
+        }
+        case id_dynamic_keymap_bulk_set: {
+            // Window state: remember the first packet that failed its checksum since the
+            // last acknowledgement so the host knows where to restart
+            static uint8_t bulk_set_bad_seq = 0;
+            static bool    bulk_set_failed  = false;
+
+            uint8_t  seq    = command_data[0];
+            uint16_t offset = (command_data[1] << 8) | command_data[2];
+            uint8_t  size   = command_data[3];
+            uint8_t  sum    = command_data[4];
+
+            if (size > length - VIA_BULK_SET_HEADER_SIZE) {
+                size = length - VIA_BULK_SET_HEADER_SIZE;
+            }
+            for (uint8_t i = 0; i < size; i++) {
+                sum += data[VIA_BULK_SET_HEADER_SIZE + i];
+            }
+            if (sum == 0) {
+                dynamic_keymap_set_buffer(offset, size, &data[VIA_BULK_SET_HEADER_SIZE]);
+            } else if (!bulk_set_failed) {
+                bulk_set_failed  = true;
+                bulk_set_bad_seq = seq & (uint8_t)~VIA_BULK_ACK_REQUEST;
+            }
+
+            if (!(seq & VIA_BULK_ACK_REQUEST)) {
+                // Mid-window packet: no response, keep the channel free for the next one
+                return;
+            }
+            // Window closed: acknowledge and reset the error tracking
+            command_data[1] = bulk_set_failed ? 1 : 0;
+            command_data[2] = bulk_set_bad_seq;
+            bulk_set_failed  = false;
+            bulk_set_bad_seq = 0;
+            break;
+        }
 #ifdef ENCODER_MAP_ENABLE
         case id_dynamic_keymap_get_encoder: {
             uint16_t keycode = dynamic_keymap_get_encoder(command_data[0], command_data[1], command_data[2] != 0);
@@ -459,6 +569,29 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
 #endif
+#ifdef VIA_EVENT_PUSH
+        case id_event_push: {
+            // Subscribe: byte 1 = id_event_subscribe, byte 2 = event mask. The response
+            // echoes the applied mask and carries a layer state snapshot so the host is
+            // in sync from the moment it subscribes.
+            if (command_data[0] == id_event_subscribe) {
+                via_event_subscription = command_data[1];
+#    ifndef NO_ACTION_LAYER
+                uint32_t state = layer_state;
+#    else
+                uint32_t state = 0;
+#    endif
+                command_data[2] = state & 0xFF;
+                command_data[3] = (state >> 8) & 0xFF;
+                command_data[4] = (state >> 16) & 0xFF;
+                command_data[5] = (state >> 24) & 0xFF;
+                command_data[6] = get_highest_layer(state);
+            } else {
+                *command_id = id_unhandled;
+            }
+            break;
+        }
+#endif // VIA_EVENT_PUSH
         default: {
             // The command ID is not known
             // Return the unhandled state
@@ -73,9 +73,36 @@ enum via_command_id {
     id_dynamic_keymap_set_buffer            = 0x13,
     id_dynamic_keymap_get_encoder           = 0x14,
     id_dynamic_keymap_set_encoder           = 0x15,
+    id_dynamic_keymap_bulk_get              = 0x16,
+    id_dynamic_keymap_bulk_set              = 0x17,
+    id_event_push                           = 0xFE, // firmware-initiated state events; see VIA_EVENT_PUSH below
     id_unhandled                            = 0xFF,
 };
 
+// Bulk keymap transfer (id_dynamic_keymap_bulk_get/_set)
+//
+// Additive extension over the per-chunk buffer commands: one request covers an
+// arbitrary range of the dynamic keymap buffer instead of 28 bytes at a time,
+// so a full layout sync needs tens of packets instead of hundreds.
+//
+// Read: request [offset:2, size:2] (big endian); the device streams
+//   [command, sequence, length, checksum, payload...] packets until the range
+//   is exhausted. The last packet is the regular command response.
+// Write: the host streams [command, sequence, offset:2, length, checksum,
+//   payload...] packets. Packets are applied independently; ones that fail the
+//   checksum are dropped and remembered. Setting the top bit of the sequence
+//   byte requests an acknowledgement [command, sequence, status, bad_sequence]
+//   closing the window: status 0 means every packet since the previous
+//   acknowledgement applied cleanly, 1 means at least one failed (bad_sequence
+//   is the first offender, to be retransmitted). Packets that do not request
+//   an acknowledgement get no response.
+//
+// The checksum byte is the two's complement of the 8-bit sum of the payload,
+// i.e. sum(payload) + checksum == 0 (mod 256).
+#define VIA_BULK_GET_HEADER_SIZE 4
+#define VIA_BULK_SET_HEADER_SIZE 6
+#define VIA_BULK_ACK_REQUEST 0x80
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,
     id_layout_options      = 0x02,
@@ -153,6 +180,31 @@ void via_set_device_indication(uint8_t value);
 // Called by QMK core to process VIA-specific keycodes.
 bool process_record_via(uint16_t keycode, keyrecord_t *record);
 
+#ifdef VIA_EVENT_PUSH
+// Push-mode state events, so companion apps don't have to poll. The host
+// subscribes with {id_event_push, id_event_subscribe, mask}; the firmware then
+// emits {id_event_push, event type, payload} reports whenever a subscribed
+// state changes. The subscription lives in RAM and is cleared on reset, so
+// hosts re-subscribe on reconnect. Enable with "#define VIA_EVENT_PUSH" in
+// config.h.
+enum via_event_type {
+    id_event_subscribe  = 0x00, // host->firmware; response echoes the mask plus a layer state snapshot
+    id_event_layer      = 0x01, // payload: layer state (4 bytes LE), highest active layer
+    id_event_encoder    = 0x02, // payload: encoder index, signed detent delta (2 bytes LE)
+    id_event_dip_switch = 0x03, // payload: switch index, active flag
+};
+
+// Subscription mask bits
+#define VIA_EVENT_MASK_LAYER (1 << 0)
+#define VIA_EVENT_MASK_ENCODER (1 << 1)
+#define VIA_EVENT_MASK_DIP_SWITCH (1 << 2)
+
+// Called by QMK core on state changes; no-ops until the host subscribes.
+void via_event_push_layer_state(uint32_t state);
+void via_event_push_encoder(uint8_t index, int16_t delta);
+void via_event_push_dip_switch(uint8_t index, bool active);
+#endif // VIA_EVENT_PUSH
+
 // These are made external so that keyboard level custom value handlers can use them.
 #if defined(BACKLIGHT_ENABLE)
 void via_qmk_backlight_command(uint8_t *data, uint8_t length);
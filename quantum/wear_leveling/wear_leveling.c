@@ -6,6 +6,46 @@
 #include "wear_leveling_drivers.h"
 #include "wear_leveling_internal.h"
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error Wear-leveling write-behind requires deferred execution support -- set `DEFERRED_EXEC_ENABLE = yes`
+#    endif
+#    include "deferred_exec.h"
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_DELAY_MS
+#        define WEAR_LEVELING_WRITE_BEHIND_DELAY_MS 250
+#    endif
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_RANGES
+#        define WEAR_LEVELING_WRITE_BEHIND_RANGES 4
+#    endif
+#endif
+
+#ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+#    ifndef WEAR_LEVELING_WRITE_BEHIND
+#        error Proactive consolidation requires write-behind -- define `WEAR_LEVELING_WRITE_BEHIND`
+#    endif
+#    include "keyboard.h" // last_input_activity_elapsed()
+#    ifndef WEAR_LEVELING_CONSOLIDATE_HIGH_WATER
+#        define WEAR_LEVELING_CONSOLIDATE_HIGH_WATER (((WEAR_LEVELING_BACKING_SIZE) / 4) * 3)
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATE_IDLE_MS
+#        define WEAR_LEVELING_CONSOLIDATE_IDLE_MS 1000
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATE_ERASE_CHUNK
+#        define WEAR_LEVELING_CONSOLIDATE_ERASE_CHUNK ((WEAR_LEVELING_BACKING_SIZE) > 4096 ? 4096 : (WEAR_LEVELING_BACKING_SIZE))
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATE_WRITE_CHUNK
+#        define WEAR_LEVELING_CONSOLIDATE_WRITE_CHUNK 256
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATE_STEP_MS
+#        define WEAR_LEVELING_CONSOLIDATE_STEP_MS 2
+#    endif
+
+static bool wear_leveling_consolidation_active(void);
+static void wear_leveling_consolidation_schedule(void);
+static void wear_leveling_consolidation_finish(void);
+static void wear_leveling_consolidation_abort(void);
+#endif
+
 /*
     This wear leveling algorithm is adapted from algorithms from previous
     implementations in QMK, namely:
@@ -612,6 +652,312 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+
+/**
+ * Write-behind state: pending dirty ranges within the cache which have not yet been appended to the write log, and the
+ * deferred executor token used to schedule the flush. Ranges are half-open, with `start == end` marking an unused slot.
+ */
+static struct {
+    uint32_t start;
+    uint32_t end;
+} write_behind_ranges[WEAR_LEVELING_WRITE_BEHIND_RANGES];
+
+static deferred_token write_behind_token = INVALID_DEFERRED_TOKEN;
+
+/**
+ * Write-behind helper: drops all pending dirty ranges.
+ */
+static void wear_leveling_write_behind_clear(void) {
+    for (int i = 0; i < (WEAR_LEVELING_WRITE_BEHIND_RANGES); ++i) {
+        write_behind_ranges[i].start = write_behind_ranges[i].end = 0;
+    }
+}
+
+/**
+ * Write-behind helper: records a dirty range of the cache.
+ *
+ * Overlapping or adjacent writes are merged into an existing range; once all range slots are in use, the nearest range
+ * is widened instead. A widened range may cover bytes that were never modified -- appending those to the write log is
+ * benign as the cache already holds their live values.
+ */
+static void wear_leveling_write_behind_mark(uint32_t address, size_t length) {
+    const uint32_t start = address;
+    const uint32_t end   = address + length;
+
+    int free_slot = -1;
+    for (int i = 0; i < (WEAR_LEVELING_WRITE_BEHIND_RANGES); ++i) {
+        if (write_behind_ranges[i].start == write_behind_ranges[i].end) {
+            if (free_slot < 0) {
+                free_slot = i;
+            }
+            continue;
+        }
+        if (start <= write_behind_ranges[i].end && end >= write_behind_ranges[i].start) {
+            if (start < write_behind_ranges[i].start) {
+                write_behind_ranges[i].start = start;
+            }
+            if (end > write_behind_ranges[i].end) {
+                write_behind_ranges[i].end = end;
+            }
+            return;
+        }
+    }
+
+    if (free_slot >= 0) {
+        write_behind_ranges[free_slot].start = start;
+        write_behind_ranges[free_slot].end   = end;
+        return;
+    }
+
+    // All slots in use and disjoint from this write -- widen whichever range is closest
+    int      nearest  = 0;
+    uint32_t distance = UINT32_MAX;
+    for (int i = 0; i < (WEAR_LEVELING_WRITE_BEHIND_RANGES); ++i) {
+        const uint32_t gap = (start > write_behind_ranges[i].end) ? (start - write_behind_ranges[i].end) : (write_behind_ranges[i].start - end);
+        if (gap < distance) {
+            distance = gap;
+            nearest  = i;
+        }
+    }
+    if (start < write_behind_ranges[nearest].start) {
+        write_behind_ranges[nearest].start = start;
+    }
+    if (end > write_behind_ranges[nearest].end) {
+        write_behind_ranges[nearest].end = end;
+    }
+}
+
+/**
+ * Write-behind helper: deferred executor callback performing the flush.
+ */
+static uint32_t wear_leveling_write_behind_callback(uint32_t trigger_time, void *cb_arg) {
+#ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+    if (wear_leveling_consolidation_active()) {
+        // The log area is mid-rewrite; the consolidation epilogue re-schedules us
+        return (WEAR_LEVELING_WRITE_BEHIND_DELAY_MS);
+    }
+#endif
+    if (wear_leveling_flush() == WEAR_LEVELING_FAILED) {
+        // Keep the pending ranges and try again later
+        return (WEAR_LEVELING_WRITE_BEHIND_DELAY_MS);
+    }
+    write_behind_token = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+/**
+ * Write-behind helper: (re-)schedules the deferred flush, pushing it out while writes keep arriving.
+ */
+static void wear_leveling_write_behind_schedule(void) {
+    if (write_behind_token == INVALID_DEFERRED_TOKEN || !extend_deferred_exec(write_behind_token, (WEAR_LEVELING_WRITE_BEHIND_DELAY_MS))) {
+        write_behind_token = defer_exec((WEAR_LEVELING_WRITE_BEHIND_DELAY_MS), wear_leveling_write_behind_callback, NULL);
+    }
+}
+
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
+#ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+
+/**
+ * Proactive consolidation phases. The erase and write phases are resumable: each deferred executor invocation
+ * performs one bounded chunk and the cursor records where the next chunk picks up.
+ */
+typedef enum consolidation_phase_t {
+    CONSOLIDATION_INACTIVE, //< No consolidation in flight
+    CONSOLIDATION_ERASE,    //< Erasing the backing store, one chunk per increment
+    CONSOLIDATION_WRITE,    //< Writing the cache to the consolidated area, one chunk per increment
+    CONSOLIDATION_CHECKSUM  //< Writing the FNV1a_64 of the consolidated area, final increment
+} consolidation_phase_t;
+
+/**
+ * Proactive consolidation state. The checksum is accumulated over the consolidated bytes as they are written, so a
+ * cache write landing mid-consolidation cannot desync the stored hash -- the newer value stays pending in the
+ * write-behind ranges and reaches the fresh log after the final increment.
+ */
+static struct {
+    consolidation_phase_t phase;
+    uint32_t              cursor;
+    uint64_t              checksum;
+} consolidation = {CONSOLIDATION_INACTIVE, 0, 0};
+
+static deferred_token consolidation_token = INVALID_DEFERRED_TOKEN;
+
+static bool wear_leveling_consolidation_active(void) {
+    return consolidation.phase != CONSOLIDATION_INACTIVE;
+}
+
+/**
+ * Performs one bounded increment of an in-flight consolidation.
+ *
+ * @return WEAR_LEVELING_SUCCESS while increments remain, WEAR_LEVELING_CONSOLIDATED on completion. On
+ * WEAR_LEVELING_FAILED the backing store may be part-erased; the caller must fall back to the synchronous
+ * path to re-establish a consistent consolidated area and log.
+ */
+static wear_leveling_status_t wear_leveling_consolidation_step(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        consolidation.phase = CONSOLIDATION_INACTIVE;
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    switch (consolidation.phase) {
+        case CONSOLIDATION_ERASE: {
+            uint32_t remaining   = (WEAR_LEVELING_BACKING_SIZE)-consolidation.cursor;
+            uint32_t this_length = remaining > (WEAR_LEVELING_CONSOLIDATE_ERASE_CHUNK) ? (WEAR_LEVELING_CONSOLIDATE_ERASE_CHUNK) : remaining;
+            if (backing_store_erase_range(consolidation.cursor, this_length)) {
+                consolidation.cursor += this_length;
+            } else {
+                // No ranged erase from this driver; do the whole store in this one increment instead
+                if (!backing_store_erase()) {
+                    status = WEAR_LEVELING_FAILED;
+                    break;
+                }
+                consolidation.cursor = (WEAR_LEVELING_BACKING_SIZE);
+            }
+            if (consolidation.cursor >= (WEAR_LEVELING_BACKING_SIZE)) {
+                consolidation.phase    = CONSOLIDATION_WRITE;
+                consolidation.cursor   = 0;
+                consolidation.checksum = FNV1A_64_INIT;
+            }
+        } break;
+
+        case CONSOLIDATION_WRITE: {
+            uint32_t remaining   = (WEAR_LEVELING_LOGICAL_SIZE)-consolidation.cursor;
+            uint32_t this_length = remaining > (WEAR_LEVELING_CONSOLIDATE_WRITE_CHUNK) ? (WEAR_LEVELING_CONSOLIDATE_WRITE_CHUNK) : remaining;
+            if (!backing_store_write_bulk(consolidation.cursor, (backing_store_int_t *)&wear_leveling.cache[consolidation.cursor], this_length / sizeof(backing_store_int_t))) {
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+            // Hash what was actually written -- the live cache may change before the next increment
+            consolidation.checksum = fnv_64a_buf(&wear_leveling.cache[consolidation.cursor], this_length, consolidation.checksum);
+            consolidation.cursor += this_length;
+            if (consolidation.cursor >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                consolidation.phase = CONSOLIDATION_CHECKSUM;
+            }
+        } break;
+
+        case CONSOLIDATION_CHECKSUM: {
+            write_log_entry_t entry;
+            entry.raw64 = consolidation.checksum;
+            do {
+#    if BACKING_STORE_WRITE_SIZE == 2
+                if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
+                    status = WEAR_LEVELING_FAILED;
+                    break;
+                }
+#    elif BACKING_STORE_WRITE_SIZE == 4
+                if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
+                    status = WEAR_LEVELING_FAILED;
+                    break;
+                }
+#    elif BACKING_STORE_WRITE_SIZE == 8
+                if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
+                    status = WEAR_LEVELING_FAILED;
+                    break;
+                }
+#    endif
+            } while (0);
+            if (status != WEAR_LEVELING_FAILED) {
+                wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+                consolidation.phase         = CONSOLIDATION_INACTIVE;
+                status                      = WEAR_LEVELING_CONSOLIDATED;
+            }
+        } break;
+
+        default:
+            break;
+    }
+
+    if (status == WEAR_LEVELING_FAILED) {
+        consolidation.phase = CONSOLIDATION_INACTIVE;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+
+/**
+ * Proactive consolidation: deferred executor callback.
+ *
+ * Waits for a verified-idle window (no input activity for the configured time) before starting; once started the
+ * increments run to completion regardless of activity, as a part-erased store cannot be abandoned -- each increment
+ * is bounded, so a resuming typist sees at most one chunk-sized stall rather than the full multi-ms erase.
+ */
+static uint32_t wear_leveling_consolidation_callback(uint32_t trigger_time, void *cb_arg) {
+    if (!wear_leveling_consolidation_active()) {
+        if (wear_leveling.write_address < (WEAR_LEVELING_CONSOLIDATE_HIGH_WATER)) {
+            // A flush dropped us back below the mark (or consolidation already happened); nothing to do
+            consolidation_token = INVALID_DEFERRED_TOKEN;
+            return 0;
+        }
+        if (last_input_activity_elapsed() < (WEAR_LEVELING_CONSOLIDATE_IDLE_MS)) {
+            return (WEAR_LEVELING_CONSOLIDATE_IDLE_MS); // not yet a verified-idle window; check again later
+        }
+        wl_dprintf("Proactive consolidation start\n");
+        consolidation.phase  = CONSOLIDATION_ERASE;
+        consolidation.cursor = 0;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidation_step();
+    if (status == WEAR_LEVELING_SUCCESS) {
+        return (WEAR_LEVELING_CONSOLIDATE_STEP_MS); // more increments to go
+    }
+    if (status == WEAR_LEVELING_FAILED) {
+        // An increment failed partway, leaving the store in an unknown state; the synchronous path
+        // re-establishes a consistent consolidated area and log from the cache we still hold
+        wear_leveling_consolidate_force();
+    }
+
+    wl_dprintf("Proactive consolidation complete\n");
+    consolidation_token = INVALID_DEFERRED_TOKEN;
+    // Anything dirtied while we were consolidating goes to the fresh log via the usual flush
+    wear_leveling_write_behind_schedule();
+    return 0;
+}
+
+/**
+ * Proactive consolidation: arms the deferred callback once the write log passes the high-water mark.
+ */
+static void wear_leveling_consolidation_schedule(void) {
+    if (wear_leveling.write_address < (WEAR_LEVELING_CONSOLIDATE_HIGH_WATER)) {
+        return;
+    }
+    if (consolidation_token == INVALID_DEFERRED_TOKEN) {
+        consolidation_token = defer_exec((WEAR_LEVELING_CONSOLIDATE_IDLE_MS), wear_leveling_consolidation_callback, NULL);
+    }
+}
+
+/**
+ * Proactive consolidation: synchronously runs an in-flight consolidation to completion. Called before any
+ * operation that needs the backing store in a consistent state.
+ */
+static void wear_leveling_consolidation_finish(void) {
+    while (wear_leveling_consolidation_active()) {
+        if (wear_leveling_consolidation_step() == WEAR_LEVELING_FAILED) {
+            wear_leveling_consolidate_force();
+        }
+    }
+}
+
+/**
+ * Proactive consolidation: drops any in-flight state. Only valid when the caller is about to erase or rewrite the
+ * entire backing store anyway.
+ */
+static void wear_leveling_consolidation_abort(void) {
+    consolidation.phase = CONSOLIDATION_INACTIVE;
+    if (consolidation_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(consolidation_token);
+        consolidation_token = INVALID_DEFERRED_TOKEN;
+    }
+}
+
+#endif // WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+
 /**
  * Wear-leveling initialization
  */
@@ -643,6 +989,11 @@ wear_leveling_status_t wear_leveling_init(void) {
         return status;
     }
 
+#ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+    // The replayed log may already sit past the high-water mark
+    wear_leveling_consolidation_schedule();
+#endif
+
     return status;
 }
 
@@ -653,6 +1004,15 @@ wear_leveling_status_t wear_leveling_init(void) {
 wear_leveling_status_t wear_leveling_erase(void) {
     wl_dprintf("Erase\n");
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Anything still pending is superseded by the erase
+    wear_leveling_write_behind_clear();
+#endif
+#ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+    // Likewise any in-flight consolidation -- the erase rewrites the whole store
+    wear_leveling_consolidation_abort();
+#endif
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -692,6 +1052,14 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Defer the log append -- reads are served from the cache, so the only observable difference is that the flash
+    // program happens during idle rather than inside the caller's write. Repeated writes to the same values coalesce
+    // into a single log append when the flush fires.
+    wear_leveling_write_behind_mark(address, length);
+    wear_leveling_write_behind_schedule();
+    return WEAR_LEVELING_SUCCESS;
+#else
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -725,6 +1093,78 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+}
+
+/**
+ * Flushes any pending write-behind data to the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+    // An in-flight incremental consolidation owns the backing store; complete it before appending to the log
+    wear_leveling_consolidation_finish();
+#    endif
+    bool pending = false;
+    for (int i = 0; i < (WEAR_LEVELING_WRITE_BEHIND_RANGES); ++i) {
+        if (write_behind_ranges[i].start != write_behind_ranges[i].end) {
+            pending = true;
+            break;
+        }
+    }
+    if (!pending) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Append each pending range from the cache to the write log
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (int i = 0; i < (WEAR_LEVELING_WRITE_BEHIND_RANGES); ++i) {
+        if (write_behind_ranges[i].start == write_behind_ranges[i].end) {
+            continue;
+        }
+        status = wear_leveling_write_raw(write_behind_ranges[i].start, &wear_leveling.cache[write_behind_ranges[i].start], write_behind_ranges[i].end - write_behind_ranges[i].start);
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            // Consolidation wrote out the entire cache, which covers all pending ranges
+            wear_leveling_write_behind_clear();
+            break;
+        } else if (status == WEAR_LEVELING_FAILED) {
+            // Keep the remaining ranges pending so a later flush can retry
+            break;
+        }
+        write_behind_ranges[i].start = write_behind_ranges[i].end = 0;
+    }
+
+    // Consolidate the cache + write log if required
+    if (status == WEAR_LEVELING_SUCCESS) {
+        status = wear_leveling_consolidate_if_needed();
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+#    ifdef WEAR_LEVELING_PROACTIVE_CONSOLIDATION
+    // If the appends pushed the log past the high-water mark, queue a proactive consolidation so the
+    // synchronous full-log path above stays unreachable in practice
+    wear_leveling_consolidation_schedule();
+#    endif
+
+    return status;
+#else
+    // Without write-behind every write already hit the backing store
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 }
 
 /**
@@ -767,3 +1207,11 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of ranged erase; reports no support so callers fall back to a full backing_store_erase().
+ * Drivers whose storage erases in fixed-size blocks can implement this to allow chunked, resumable erasure.
+ */
+__attribute__((weak)) bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    return false;
+}
@@ -43,6 +43,17 @@ wear_leveling_status_t wear_leveling_erase(void);
  */
 wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value, size_t length);
 
+/**
+ * Flushes any pending write-behind data to the backing store.
+ *
+ * Only relevant when `WEAR_LEVELING_WRITE_BEHIND` is defined -- writes are then staged in the cache and appended to the
+ * write log by a deferred flush, which this forces immediately. Without write-behind this is a no-op, as every write
+ * already hit the backing store.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
 /**
  * Reads logical data from the cache.
  *
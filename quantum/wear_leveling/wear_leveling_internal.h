@@ -73,6 +73,7 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+bool backing_store_erase_range(uint32_t address, uint32_t length);                              // optional; the weak default reports no ranged-erase support and callers fall back to backing_store_erase()
 
 /**
  * Helper type used to contain a write log entry.
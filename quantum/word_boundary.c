@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "word_boundary.h"
+#include "keycodes.h"
+#include "quantum_keycodes.h"
+#include "progmem.h"
+#include "util.h"
+
+// One class byte per basic keycode up to KC_SLASH; everything a word-aware
+// feature distinguishes lives in this range, bar KC_DEL which is special-cased
+// in word_boundary_classify() rather than padding the table out to 0x4C.
+static const uint8_t word_class_table[KC_SLASH + 1] PROGMEM = {
+    [0 ... KC_A - 1]             = WORD_CLASS_OTHER,
+    [KC_A ... KC_Z]              = WORD_CLASS_LETTER,
+    [KC_1 ... KC_0]              = WORD_CLASS_DIGIT,
+    [KC_ENTER]                   = WORD_CLASS_ENTER,
+    [KC_ESCAPE]                  = WORD_CLASS_OTHER,
+    [KC_BACKSPACE]               = WORD_CLASS_BACKSPACE,
+    [KC_TAB]                     = WORD_CLASS_BOUNDARY,
+    [KC_SPACE]                   = WORD_CLASS_BOUNDARY,
+    [KC_MINUS]                   = WORD_CLASS_HYPHEN,
+    [KC_EQUAL ... KC_SEMICOLON]  = WORD_CLASS_BOUNDARY,
+    [KC_QUOTE]                   = WORD_CLASS_QUOTE,
+    [KC_GRAVE ... KC_SLASH]      = WORD_CLASS_BOUNDARY,
+};
+
+word_class_t word_boundary_classify(uint16_t keycode) {
+    if (keycode < ARRAY_SIZE(word_class_table)) {
+        return (word_class_t)pgm_read_byte(&word_class_table[keycode]);
+    }
+    if (keycode == KC_DELETE) {
+        return WORD_CLASS_DELETE;
+    }
+    return WORD_CLASS_OTHER;
+}
+
+static word_class_t last_class = WORD_CLASS_OTHER;
+static bool         in_word    = false;
+
+void word_boundary_track(uint16_t keycode, bool pressed) {
+    if (!pressed) {
+        return;
+    }
+
+    // Shifted basic keycodes still type a character from the same key.
+    if (keycode > QK_BASIC_MAX && keycode <= QK_MODS_MAX) {
+        keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+    }
+
+    last_class = word_boundary_classify(keycode);
+    switch (last_class) {
+        case WORD_CLASS_LETTER:
+        case WORD_CLASS_DIGIT:
+        case WORD_CLASS_QUOTE:
+        case WORD_CLASS_HYPHEN:
+            in_word = true;
+            break;
+        case WORD_CLASS_BACKSPACE:
+        case WORD_CLASS_DELETE:
+            // Editing keys neither extend nor end the word.
+            break;
+        default:
+            in_word = false;
+            break;
+    }
+}
+
+bool word_boundary_in_word(void) {
+    return in_word;
+}
+
+word_class_t word_boundary_last_class(void) {
+    return last_class;
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup word_boundary Word Boundary Tracker
+ *
+ * Shared word-boundary classification for word-aware features (Caps Word,
+ * Autocorrect, ...). Each feature used to carry its own switch over the basic
+ * keycode ranges to decide whether a key continues a word, ends it, or is
+ * unrelated to typing; this module replaces those with a single table lookup,
+ * and maintains an in-word flag from the record dispatch path so consumers
+ * share one classification per key event.
+ * \{
+ */
+
+/**
+ * \brief How a basic keycode relates to word boundaries.
+ *
+ * Classes are deliberately finer-grained than any single consumer needs, so
+ * each feature can map them onto its own behavior (e.g. Caps Word continues a
+ * word through digits while Autocorrect treats them as a boundary).
+ */
+typedef enum word_class_t {
+    WORD_CLASS_OTHER = 0,  ///< unrelated to typing; word-aware features reset
+    WORD_CLASS_LETTER,     ///< `KC_A`..`KC_Z`
+    WORD_CLASS_DIGIT,      ///< `KC_1`..`KC_0`
+    WORD_CLASS_BOUNDARY,   ///< space, tab, punctuation -- ends the current word
+    WORD_CLASS_ENTER,      ///< `KC_ENT` -- ends the word and the line
+    WORD_CLASS_BACKSPACE,  ///< `KC_BSPC` -- removes the last character
+    WORD_CLASS_DELETE,     ///< `KC_DEL` -- edits without ending the word
+    WORD_CLASS_QUOTE,      ///< `KC_QUOT` -- boundary only when shifted (`"`)
+    WORD_CLASS_HYPHEN,     ///< `KC_MINS` -- letter-like inside hyphenated words
+} word_class_t;
+
+/**
+ * \brief Classify a keycode's relation to word boundaries.
+ *
+ * A single progmem table lookup for basic keycodes; anything outside the basic
+ * range (layer keys, mod-taps before tap extraction, ...) classifies as
+ * \ref WORD_CLASS_OTHER. Callers that mask modifiers or extract tap keycodes
+ * should do so before classifying.
+ */
+word_class_t word_boundary_classify(uint16_t keycode);
+
+/**
+ * \brief Feed a key event to the shared tracker.
+ *
+ * Called once per event from the record dispatch path; not intended for
+ * feature code.
+ */
+void word_boundary_track(uint16_t keycode, bool pressed);
+
+/**
+ * \brief Whether the last tracked press was inside a word.
+ *
+ * True after a letter, digit, quote or hyphen; false after a boundary, enter
+ * or any non-typing key. Backspace and delete leave the flag unchanged.
+ */
+bool word_boundary_in_word(void);
+
+/**
+ * \brief Classification of the most recent tracked key press.
+ */
+word_class_t word_boundary_last_class(void);
+
+/** \} */
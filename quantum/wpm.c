@@ -22,9 +22,11 @@
 #include "action_util.h"
 #include <math.h>
 
+#ifndef WPM_EVENT_DRIVEN
 // WPM Stuff
 static uint8_t  current_wpm = 0;
 static uint32_t wpm_timer   = 0;
+#endif
 
 /* The WPM calculation works by specifying a certain number of 'periods' inside
  * a ring buffer, and we count the number of keypresses which occur in each of
@@ -35,14 +37,16 @@ static uint32_t wpm_timer   = 0;
  * value `WPM_SAMPLE_PERIODS`.
  *
  */
-#define MAX_PERIODS (WPM_SAMPLE_PERIODS)
-#define PERIOD_DURATION (1000 * WPM_SAMPLE_SECONDS / MAX_PERIODS)
+#ifndef WPM_EVENT_DRIVEN
+#    define MAX_PERIODS (WPM_SAMPLE_PERIODS)
+#    define PERIOD_DURATION (1000 * WPM_SAMPLE_SECONDS / MAX_PERIODS)
 
 static int16_t period_presses[MAX_PERIODS] = {0};
 static uint8_t current_period              = 0;
 static uint8_t periods                     = 1;
+#endif
 
-#if !defined(WPM_UNFILTERED)
+#if !defined(WPM_UNFILTERED) && !defined(WPM_EVENT_DRIVEN)
 /* LATENCY is used as part of filtering, and controls how quickly the reported
  * WPM trails behind our actual instantaneous measured WPM value, and is
  * defined in milliseconds.  So for LATENCY == 100, the displayed WPM is
@@ -58,12 +62,14 @@ static uint8_t  prev_wpm        = 0;
 static uint8_t  next_wpm        = 0;
 #endif
 
+#ifndef WPM_EVENT_DRIVEN
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
 }
+#endif
 
 bool wpm_keycode(uint16_t keycode) {
     return wpm_keycode_kb(keycode);
@@ -107,6 +113,98 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 }
 #endif
 
+#ifdef WPM_EVENT_DRIVEN
+/* Event-driven engine: instead of counting presses into a sample ring and
+ * recomputing on a timer, keep an exponential moving average of the
+ * instantaneous WPM implied by each inter-keystroke interval. All work
+ * happens inside update_wpm() on counted keystrokes; decay while idle is
+ * folded in lazily at read time, so a board that isn't being typed on
+ * spends zero cycles on WPM.
+ *
+ * The average is kept in 8.8 fixed point; get_current_wpm_hires() exposes
+ * the full resolution for display widgets. WPM_SMOOTHING_SHIFT sets the
+ * EMA weight (each sample contributes 1/2^shift).
+ */
+#    ifndef WPM_SMOOTHING_SHIFT
+#        define WPM_SMOOTHING_SHIFT 3
+#    endif
+
+#    define WPM_MAX_X256 ((uint32_t)240 << 8)
+
+static uint16_t wpm_ema_x256   = 0;
+static uint32_t last_press_time = 0;
+static bool     have_last_press = false;
+
+/* Reported WPM can never exceed what typing at the current idle gap's rate
+ * would measure; clamping the EMA to that ceiling makes the value glide to
+ * zero while idle without any periodic task. */
+static uint16_t current_wpm_x256(void) {
+    if (!have_last_press || wpm_ema_x256 == 0) {
+        return 0;
+    }
+    uint32_t gap = timer_elapsed32(last_press_time);
+    if (gap > 0) {
+        uint32_t ceiling = (60000UL << 8) / (gap * WPM_ESTIMATED_WORD_SIZE);
+        if (ceiling < wpm_ema_x256) {
+            return (uint16_t)ceiling;
+        }
+    }
+    return wpm_ema_x256;
+}
+
+void set_current_wpm(uint8_t new_wpm) {
+    wpm_ema_x256    = (uint16_t)new_wpm << 8;
+    last_press_time = timer_read32();
+    have_last_press = true;
+}
+
+uint8_t get_current_wpm(void) {
+    return (uint8_t)(current_wpm_x256() >> 8);
+}
+
+uint16_t get_current_wpm_hires(void) {
+    return current_wpm_x256();
+}
+
+void update_wpm(uint16_t keycode) {
+#    ifdef WPM_ALLOW_COUNT_REGRESSION
+    if (wpm_regress_count(keycode) > 0) {
+        // Corrections drag the average down by one smoothing step.
+        wpm_ema_x256 -= wpm_ema_x256 >> WPM_SMOOTHING_SHIFT;
+        return;
+    }
+#    endif
+    if (!wpm_keycode(keycode)) {
+        return;
+    }
+
+    uint32_t now = timer_read32();
+    if (have_last_press) {
+        // Fold any idle decay into the average before sampling, so a pause
+        // followed by fresh typing ramps from the decayed value rather than
+        // snapping back to the pre-pause speed.
+        wpm_ema_x256 = current_wpm_x256();
+
+        uint32_t dt = TIMER_DIFF_32(now, last_press_time);
+        if (dt == 0) {
+            dt = 1;
+        }
+        uint32_t inst = (60000UL << 8) / (dt * WPM_ESTIMATED_WORD_SIZE);
+        if (inst > WPM_MAX_X256) { // same reasonable limit as the sampled engine
+            inst = WPM_MAX_X256;
+        }
+        wpm_ema_x256 += ((int32_t)inst - (int32_t)wpm_ema_x256) >> WPM_SMOOTHING_SHIFT;
+    }
+    last_press_time = now;
+    have_last_press = true;
+}
+
+void decay_wpm(void) {
+    // Nothing to do per scan -- decay happens lazily in current_wpm_x256().
+}
+
+#else // WPM_EVENT_DRIVEN
+
 // Outside 'raw' mode we smooth results over time.
 
 void update_wpm(uint16_t keycode) {
@@ -176,3 +274,5 @@ void decay_wpm(void) {
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
 #endif
 }
+
+#endif // WPM_EVENT_DRIVEN
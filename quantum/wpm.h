@@ -43,3 +43,9 @@ uint8_t get_current_wpm(void);
 void    update_wpm(uint16_t);
 
 void decay_wpm(void);
+
+#ifdef WPM_EVENT_DRIVEN
+/* Current WPM in 8.8 fixed point, for display widgets that want sub-integer
+ * resolution. Only available with the event-driven engine. */
+uint16_t get_current_wpm_hires(void);
+#endif
@@ -60,6 +60,14 @@ HID_PACKET_SIZE = 32
 # Command ID for datetime update
 CMD_DATETIME_UPDATE = 0x03
 
+# Scene timeline commands (firmware-side keyframe schedule, see scene_timeline.h)
+CMD_TIMELINE_LOAD = 0x22
+CMD_TIMELINE_LOAD_ACK = 0x23
+CMD_TIMELINE_CTRL = 0x24
+TIMELINE_FIELD_DATETIME = 0x01
+TIMELINE_FLAG_LOOP = 0x01
+TIMELINE_CHUNK_PAYLOAD = HID_PACKET_SIZE - 3
+
 # Season definitions (matching keymap.c)
 SEASONS = {
     'winter': {'name': 'Winter', 'months': [12, 1, 2], 'representative_month': 1},
@@ -141,6 +149,86 @@ def send_datetime_update(device, dt):
         return False
 
 
+def build_timeline_schedule(season_keys, loop=False, year=2025):
+    """Build the binary keyframe schedule for the firmware-side timeline.
+
+    Two datetime keyframes per simulated day (00:00 and 23:59); the firmware
+    interpolates the hours in between, so the schedule stays tiny and the
+    transitions are frame-accurate instead of host-jitter-bound.
+    """
+    day_numbers = [1, 8, 15, 22, 29]
+
+    entries = []
+    offset = 0.0
+    for season_key in season_keys:
+        month = SEASONS[season_key]['representative_month']
+        for day_index in range(DAYS_PER_MONTH):
+            day = day_numbers[day_index]
+            day_start = offset + day_index * DAY_DURATION
+            entries.append((day_start, (year, month, day, 0, 0)))
+            entries.append((day_start + DAY_DURATION - 0.001, (year, month, day, 23, 59)))
+        offset += MONTH_DURATION + 0.5  # brief pause between seasons
+
+    schedule = bytearray()
+    schedule += bytes([len(entries), TIMELINE_FLAG_LOOP if loop else 0, 0, 0])
+    for entry_offset, (y, mo, d, h, mi) in entries:
+        ms = int(entry_offset * 1000)
+        schedule += ms.to_bytes(4, 'little')
+        schedule += bytes([TIMELINE_FIELD_DATETIME])
+        schedule += bytes([y & 0xFF, (y >> 8) & 0xFF, mo, d, h, mi, 0])
+    return schedule
+
+
+def upload_timeline(device, schedule):
+    """Upload the schedule in chunks, checking the per-chunk ACKs."""
+    chunks = [schedule[i:i + TIMELINE_CHUNK_PAYLOAD] for i in range(0, len(schedule), TIMELINE_CHUNK_PAYLOAD)]
+    print(f"Uploading timeline: {len(schedule)} bytes in {len(chunks)} chunks...")
+
+    for index, chunk in enumerate(chunks):
+        packet = bytearray(HID_PACKET_SIZE)
+        packet[0] = CMD_TIMELINE_LOAD
+        packet[1] = index & 0xFF
+        packet[2] = len(chunk)
+        packet[3:3 + len(chunk)] = chunk
+        if device.write([0] + list(packet)) <= 0:
+            print("✗ Write failed during upload")
+            return False
+
+        ack = device.read(HID_PACKET_SIZE, 1000)
+        if len(ack) < 3 or ack[0] != CMD_TIMELINE_LOAD_ACK or ack[1] != (index & 0xFF):
+            print(f"✗ Missing/unexpected ACK for chunk {index}")
+            return False
+        if ack[2] != 0:
+            reason = {1: 'buffer overflow (raise SCENE_TIMELINE_BUFFER_SIZE)', 2: 'malformed chunk'}.get(ack[2], f'status {ack[2]}')
+            print(f"✗ Firmware rejected chunk {index}: {reason}")
+            return False
+
+    print("✓ Timeline uploaded")
+    return True
+
+
+def run_timeline(device, specific_season=None, loop=False):
+    """Upload the schedule once and let the firmware drive the scenes locally."""
+    season_keys = [specific_season] if specific_season else ['winter', 'spring', 'summer', 'fall']
+    schedule = build_timeline_schedule(season_keys, loop=loop)
+
+    if not upload_timeline(device, schedule):
+        return False
+
+    packet = bytearray(HID_PACKET_SIZE)
+    packet[0] = CMD_TIMELINE_CTRL
+    packet[1] = 1  # start
+    if device.write([0] + list(packet)) <= 0:
+        print("✗ Failed to start timeline")
+        return False
+
+    total = (MONTH_DURATION + 0.5) * len(season_keys)
+    print(f"✓ Timeline started; the keyboard now runs the simulation on its own (~{total:.0f}s"
+          + (", looping)" if loop else ")"))
+    print("  No further HID traffic is needed -- it is safe to quit or unplug the host.")
+    return True
+
+
 def get_time_emoji(hour):
     """Get emoji for time of day."""
     if 5 <= hour < 7:
@@ -306,6 +394,17 @@ Season Details:
         choices=['winter', 'spring', 'summer', 'fall'],
         help='Simulate only a specific season (winter, spring, summer, or fall)'
     )
+    parser.add_argument(
+        '--timeline',
+        action='store_true',
+        help='Upload the schedule to the firmware-side timeline engine and exit; '
+             'the keyboard then drives the simulation locally with zero HID traffic'
+    )
+    parser.add_argument(
+        '--loop',
+        action='store_true',
+        help='With --timeline: restart the schedule from the beginning when it ends'
+    )
     args = parser.parse_args()
 
     print("QMK Season Simulator")
@@ -320,7 +419,10 @@ Season Details:
 
     try:
         # Run simulation
-        success = simulate_seasons(device, args.season)
+        if args.timeline:
+            success = run_timeline(device, args.season, loop=args.loop)
+        else:
+            success = simulate_seasons(device, args.season)
 
         if success:
             print("\n" + "=" * 60)
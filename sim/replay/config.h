@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Matrix geometry, layout macros and feature configuration generated from the target
+// keyboard's info.json by a prior firmware build. The keyboard's literal config.h files
+// are deliberately not pulled in -- they configure hardware the host build does not
+// have; the keymap's config.h (timing, feature tuning) is force-included by
+// build_replay_sim.mk when present.
+#include "info_config.h"
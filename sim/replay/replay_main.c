@@ -0,0 +1,237 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Host-side replay simulator entry point.
+ *
+ * The build (builddefs/build_replay_sim.mk) links the target keyboard's keymap and the
+ * quantum event pipeline against the test platform, so layers, tap dances, combos and
+ * friends run exactly as they would on the board -- minus the hardware. This harness
+ * drives the virtual matrix (tests/test_common/matrix.c) from a recorded event trace,
+ * advancing the simulated clock one millisecond per scan, and reports wall-clock
+ * speedup, HID report counts, and an estimated MCU cost from a simple cycle model.
+ *
+ * Trace format: one event per line, '#' starts a comment.
+ *
+ *     <time_ms> <row> <col> <p|r>
+ *
+ * Times are milliseconds from the start of the trace and must be non-decreasing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "keyboard.h"
+#include "host.h"
+#include "report.h"
+#include "test_matrix.h"
+
+// Simulated clock control, provided by platforms/test/timer.c.
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+// Nominal cycle costs for the summary at the end of a run. These are not measurements --
+// they are a tunable model (override on the make command line via EXTRAFLAGS) sized for
+// an RP2040-class controller: a scan pass is on the order of ten thousand cycles, and a
+// key event adds the action/process_record machinery on top.
+#ifndef REPLAY_SIM_CPU_HZ
+#    define REPLAY_SIM_CPU_HZ 133000000
+#endif
+#ifndef REPLAY_SIM_SCAN_CYCLES
+#    define REPLAY_SIM_SCAN_CYCLES 13000
+#endif
+#ifndef REPLAY_SIM_EVENT_CYCLES
+#    define REPLAY_SIM_EVENT_CYCLES 50000
+#endif
+
+// Scans appended after the last trace event so deferred state (tapping terms, combo
+// timers, one shots) resolves before the run ends.
+#ifndef REPLAY_SIM_TAIL_MS
+#    define REPLAY_SIM_TAIL_MS 1000
+#endif
+
+typedef struct replay_event_t {
+    uint32_t time_ms;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+} replay_event_t;
+
+static bool     verbose          = false;
+static uint32_t keyboard_reports = 0;
+static uint32_t mouse_reports    = 0;
+static uint32_t extra_reports    = 0;
+
+static uint8_t sim_keyboard_leds(void) {
+    return 0;
+}
+
+static void sim_send_keyboard(report_keyboard_t *report) {
+    keyboard_reports++;
+    if (verbose) {
+        printf("  report: mods=%02x keys=", report->mods);
+        for (size_t i = 0; i < sizeof(report->keys); i++) {
+            printf("%02x ", report->keys[i]);
+        }
+        printf("\n");
+    }
+}
+
+static void sim_send_nkro(report_nkro_t *report) {
+    (void)report;
+    keyboard_reports++;
+}
+
+static void sim_send_mouse(report_mouse_t *report) {
+    (void)report;
+    mouse_reports++;
+}
+
+static void sim_send_extra(report_extra_t *report) {
+    (void)report;
+    extra_reports++;
+}
+
+static host_driver_t sim_driver = {
+    .keyboard_leds = sim_keyboard_leds,
+    .send_keyboard = sim_send_keyboard,
+    .send_nkro     = sim_send_nkro,
+    .send_mouse    = sim_send_mouse,
+    .send_extra    = sim_send_extra,
+};
+
+static replay_event_t *trace       = NULL;
+static size_t          trace_count = 0;
+
+static bool load_trace(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "replay_sim: cannot open trace '%s'\n", path);
+        return false;
+    }
+
+    size_t   capacity  = 0;
+    uint32_t last_time = 0;
+    char     line[256];
+    int      lineno = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *p = line + strspn(line, " \t");
+        if (*p == '#' || *p == '\n' || *p == '\0') {
+            continue;
+        }
+
+        unsigned time_ms, row, col;
+        char     action;
+        if (sscanf(p, "%u %u %u %c", &time_ms, &row, &col, &action) != 4 || (action != 'p' && action != 'r')) {
+            fprintf(stderr, "replay_sim: %s:%d: expected '<time_ms> <row> <col> <p|r>'\n", path, lineno);
+            fclose(f);
+            return false;
+        }
+        if (time_ms < last_time) {
+            fprintf(stderr, "replay_sim: %s:%d: event times must be non-decreasing\n", path, lineno);
+            fclose(f);
+            return false;
+        }
+        if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+            fprintf(stderr, "replay_sim: %s:%d: key (%u,%u) outside the %ux%u matrix\n", path, lineno, row, col, MATRIX_ROWS, MATRIX_COLS);
+            fclose(f);
+            return false;
+        }
+
+        if (trace_count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            trace    = realloc(trace, capacity * sizeof(replay_event_t));
+            if (!trace) {
+                fprintf(stderr, "replay_sim: out of memory\n");
+                fclose(f);
+                return false;
+            }
+        }
+        trace[trace_count++] = (replay_event_t){.time_ms = time_ms, .row = (uint8_t)row, .col = (uint8_t)col, .pressed = action == 'p'};
+        last_time            = time_ms;
+    }
+    fclose(f);
+
+    if (trace_count == 0) {
+        fprintf(stderr, "replay_sim: trace '%s' contains no events\n", path);
+        return false;
+    }
+    return true;
+}
+
+static double elapsed_seconds(const struct timespec *start, const struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) + (double)(end->tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+int main(int argc, char **argv) {
+    const char *trace_path = NULL;
+    uint32_t    iterations = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (!trace_path) {
+            trace_path = argv[i];
+        } else {
+            iterations = (uint32_t)strtoul(argv[i], NULL, 10);
+        }
+    }
+    if (!trace_path || iterations == 0) {
+        fprintf(stderr, "usage: replay_sim [-v] <trace file> [iterations]\n");
+        return 2;
+    }
+
+    if (!load_trace(trace_path)) {
+        return 1;
+    }
+
+    host_set_driver(&sim_driver);
+    set_time(0);
+    keyboard_setup();
+    keyboard_init();
+
+    const uint32_t trace_end = trace[trace_count - 1].time_ms;
+    const uint32_t run_ms    = trace_end + REPLAY_SIM_TAIL_MS;
+    uint64_t       scans     = 0;
+    uint64_t       events    = 0;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (uint32_t iter = 0; iter < iterations; iter++) {
+        clear_all_keys();
+        size_t next = 0;
+        for (uint32_t now_ms = 0; now_ms <= run_ms; now_ms++) {
+            while (next < trace_count && trace[next].time_ms == now_ms) {
+                if (trace[next].pressed) {
+                    press_key(trace[next].col, trace[next].row);
+                } else {
+                    release_key(trace[next].col, trace[next].row);
+                }
+                events++;
+                next++;
+            }
+            keyboard_task();
+            scans++;
+            advance_time(1);
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const double   host_s      = elapsed_seconds(&start, &end);
+    const double   simulated_s = (double)(run_ms + 1) * iterations / 1000.0;
+    const uint64_t cycles      = scans * REPLAY_SIM_SCAN_CYCLES + events * REPLAY_SIM_EVENT_CYCLES;
+
+    printf("replay_sim: %zu events x %u iteration%s, %llu scans over %.2f simulated s\n", trace_count, iterations, iterations == 1 ? "" : "s", (unsigned long long)scans, simulated_s);
+    printf("  host time %.3f s (%.0fx real-time)\n", host_s, host_s > 0.0 ? simulated_s / host_s : 0.0);
+    printf("  reports: keyboard=%u mouse=%u extra=%u\n", keyboard_reports, mouse_reports, extra_reports);
+    printf("  cost model: %llu cycles (%u/scan + %u/event) = %.2f%% of a %u MHz core\n", (unsigned long long)cycles, REPLAY_SIM_SCAN_CYCLES, REPLAY_SIM_EVENT_CYCLES, 100.0 * (double)cycles / (simulated_s * REPLAY_SIM_CPU_HZ), REPLAY_SIM_CPU_HZ / 1000000);
+
+    free(trace);
+    return 0;
+}
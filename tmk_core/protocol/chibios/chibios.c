@@ -75,6 +75,8 @@ host_driver_t chibios_driver = {
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
+    .endpoint_ready = usb_endpoint_ready,
+    .endpoint_depth = usb_endpoint_depth,
 };
 
 #ifdef VIRTSER_ENABLE
@@ -269,6 +269,33 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
     osalSysUnlock();
 
+    /* Unbuffered sends are whole reports; write them straight into an empty
+     * queue slot and post it. The slot memory is what the TX ISR hands to
+     * usbStartTransmitI(), so this is the only copy between the caller and
+     * the wire -- no sequential-access bookkeeping and no separate flush
+     * pass. A partially filled buffer (buffered console/CDC output pending
+     * on the same endpoint) forces the generic path below so that bytes are
+     * not reordered around it. */
+    if (!buffered && endpoint->obqueue.ptr == NULL) {
+        while (true) {
+            if (obqGetEmptyBufferTimeout(&endpoint->obqueue, timeout) == MSG_OK) {
+                memcpy(endpoint->obqueue.ptr, data, size);
+                obqPostFullBuffer(&endpoint->obqueue, size);
+                return true;
+            }
+
+            /* Same recovery as the generic path: mark the endpoint as timed
+             * out and reset the queue so the retry finds a free slot. */
+            osalSysLock();
+            endpoint->timed_out = true;
+            bqSuspendI(&endpoint->obqueue);
+            obqResetI(&endpoint->obqueue);
+            bqResumeX(&endpoint->obqueue);
+            osalOsRescheduleS();
+            osalSysUnlock();
+        }
+    }
+
     while (true) {
         size_t sent = obqWriteTimeout(&endpoint->obqueue, data, size, timeout);
 
@@ -320,6 +347,27 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
     return inactive;
 }
 
+bool usb_endpoint_in_is_ready(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    bool ready = (usbGetDriverStateI(endpoint->config.usbp) == USB_ACTIVE) && !obqIsFullI(&endpoint->obqueue);
+    osalSysUnlock();
+
+    return ready;
+}
+
+size_t usb_endpoint_in_queued(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    /* bqSpaceI() counts the empty buffers still available to the producer side. */
+    size_t queued = endpoint->config.buffer_capacity - bqSpaceI(&endpoint->obqueue);
+    osalSysUnlock();
+
+    return queued;
+}
+
 bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout) {
     osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U));
 
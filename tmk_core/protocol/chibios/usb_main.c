@@ -421,6 +421,58 @@ static void flush_report_buffered(usb_endpoint_in_lut_t endpoint, bool padded) {
     usb_endpoint_in_flush(&usb_endpoints_in[endpoint], padded);
 }
 
+/**
+ * @brief Map a host-level endpoint to the USB IN endpoint that carries it.
+ *
+ * Shared-EP reports collapse onto the same output queue, so e.g. NKRO and
+ * extrakey congestion are one and the same.
+ *
+ * @return false for endpoints not compiled into this configuration
+ */
+static bool usb_endpoint_for(host_endpoint_t endpoint, usb_endpoint_in_lut_t *out) {
+    switch (endpoint) {
+        case HOST_ENDPOINT_KEYBOARD:
+            *out = USB_ENDPOINT_IN_KEYBOARD;
+            return true;
+#ifdef NKRO_ENABLE
+        case HOST_ENDPOINT_NKRO:
+            *out = USB_ENDPOINT_IN_SHARED;
+            return true;
+#endif
+#ifdef MOUSE_ENABLE
+        case HOST_ENDPOINT_MOUSE:
+            *out = USB_ENDPOINT_IN_MOUSE;
+            return true;
+#endif
+#ifdef EXTRAKEY_ENABLE
+        case HOST_ENDPOINT_EXTRA:
+            *out = USB_ENDPOINT_IN_SHARED;
+            return true;
+#endif
+#ifdef RAW_ENABLE
+        case HOST_ENDPOINT_RAW_HID:
+            *out = USB_ENDPOINT_IN_RAW;
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool usb_endpoint_ready(host_endpoint_t endpoint) {
+    usb_endpoint_in_lut_t ep;
+    if (!usb_endpoint_for(endpoint, &ep)) return false;
+
+    return usb_endpoint_in_is_ready(&usb_endpoints_in[ep]);
+}
+
+uint8_t usb_endpoint_depth(host_endpoint_t endpoint) {
+    usb_endpoint_in_lut_t ep;
+    if (!usb_endpoint_for(endpoint, &ep)) return 0;
+
+    return (uint8_t)usb_endpoint_in_queued(&usb_endpoints_in[ep]);
+}
+
 /**
  * @brief Receive a report from the host.
  *
@@ -496,6 +548,100 @@ void send_digitizer(report_digitizer_t *report) {
 
 #ifdef CONSOLE_ENABLE
 
+#    ifdef CONSOLE_NONBLOCKING
+
+/* Never-blocking console: sendchar() only writes into a fixed ring, overwriting the oldest bytes when full and
+ * counting the drops, and console_task() hands the endpoint whatever it will take with an immediate timeout. A host
+ * that stops draining `hid_listen`/`qmk console` therefore cannot stall the main loop, at the price of losing the
+ * oldest diagnostics when the ring wraps. */
+
+#        ifndef CONSOLE_RING_SIZE
+#            define CONSOLE_RING_SIZE 512
+#        endif
+#        if (CONSOLE_RING_SIZE & (CONSOLE_RING_SIZE - 1)) != 0
+#            error CONSOLE_RING_SIZE must be a power of two
+#        endif
+
+/* Fill level at which console_ring_high_water() fires; re-armed once the ring drains back below it. */
+#        ifndef CONSOLE_RING_HIGH_WATER
+#            define CONSOLE_RING_HIGH_WATER (3 * CONSOLE_RING_SIZE / 4)
+#        endif
+
+static uint8_t           console_ring[CONSOLE_RING_SIZE];
+static volatile uint16_t console_ring_head        = 0; // write index, only ever incremented
+static volatile uint16_t console_ring_tail        = 0; // read index, only ever incremented
+static volatile uint32_t console_ring_dropped     = 0;
+static bool              console_high_water_armed = true;
+
+/** @brief Called (from the context of the sendchar() that crossed the mark) when the ring passes the high-water
+ * fill level; fires once per excursion. */
+__attribute__((weak)) void console_ring_high_water(uint16_t used, uint16_t capacity) {}
+
+uint32_t console_dropped_count(void) {
+    return console_ring_dropped;
+}
+
+int8_t sendchar(uint8_t c) {
+    syssts_t sts = chSysGetStatusAndLockX();
+
+    uint16_t used = (uint16_t)(console_ring_head - console_ring_tail);
+    if (used >= CONSOLE_RING_SIZE) {
+        /* Full: overwrite the oldest byte rather than waiting on the host. */
+        console_ring_tail++;
+        console_ring_dropped++;
+        used--;
+    }
+    console_ring[console_ring_head & (CONSOLE_RING_SIZE - 1)] = c;
+    console_ring_head++;
+    used++;
+
+    bool notify = false;
+    if (used >= CONSOLE_RING_HIGH_WATER) {
+        notify                   = console_high_water_armed;
+        console_high_water_armed = false;
+    } else {
+        console_high_water_armed = true;
+    }
+
+    chSysRestoreStatusX(sts);
+
+    if (notify) {
+        console_ring_high_water(used, CONSOLE_RING_SIZE);
+    }
+    return 0;
+}
+
+void console_task(void) {
+    uint8_t chunk[CONSOLE_EPSIZE];
+
+    while (true) {
+        /* Claim a contiguous run under lock; sendchar() may advance the tail concurrently when overwriting. */
+        chSysLock();
+        uint16_t used = (uint16_t)(console_ring_head - console_ring_tail);
+        if (used == 0) {
+            chSysUnlock();
+            break;
+        }
+        const uint16_t tail_index = console_ring_tail & (CONSOLE_RING_SIZE - 1);
+        uint16_t       count      = used;
+        if (count > CONSOLE_RING_SIZE - tail_index) count = CONSOLE_RING_SIZE - tail_index;
+        if (count > CONSOLE_EPSIZE) count = CONSOLE_EPSIZE;
+        memcpy(chunk, &console_ring[tail_index], count);
+        console_ring_tail += count;
+        chSysUnlock();
+
+        if (!usb_endpoint_in_send(&usb_endpoints_in[USB_ENDPOINT_IN_CONSOLE], chunk, count, TIME_IMMEDIATE, true)) {
+            /* USB inactive; the claimed bytes cannot be sent, account for them as dropped. */
+            console_ring_dropped += count;
+            break;
+        }
+    }
+
+    flush_report_buffered(USB_ENDPOINT_IN_CONSOLE, true);
+}
+
+#    else /* CONSOLE_NONBLOCKING */
+
 int8_t sendchar(uint8_t c) {
     return (int8_t)send_report_buffered(USB_ENDPOINT_IN_CONSOLE, &c, sizeof(uint8_t));
 }
@@ -504,6 +650,8 @@ void console_task(void) {
     flush_report_buffered(USB_ENDPOINT_IN_CONSOLE, true);
 }
 
+#    endif /* CONSOLE_NONBLOCKING */
+
 #endif /* CONSOLE_ENABLE */
 
 #ifdef RAW_ENABLE
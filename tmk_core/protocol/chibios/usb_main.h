@@ -15,6 +15,7 @@
 #include "usb_descriptor.h"
 #include "usb_driver.h"
 #include "usb_endpoints.h"
+#include "host_driver.h"
 
 /* -------------------------
  * General USB driver header
@@ -34,6 +35,10 @@ void restart_usb_driver(USBDriver *usbp);
 
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 
+/* Backpressure probes for the host driver (see host_driver_t) */
+bool    usb_endpoint_ready(host_endpoint_t endpoint);
+uint8_t usb_endpoint_depth(host_endpoint_t endpoint);
+
 /* ---------------
  * USB Event queue
  * ---------------
@@ -55,6 +60,16 @@ void usb_event_queue_task(void);
 /* Putchar over the USB console */
 int8_t sendchar(uint8_t c);
 
+#    ifdef CONSOLE_NONBLOCKING
+
+/* Number of console bytes lost to ring overwrite or an inactive USB state */
+uint32_t console_dropped_count(void);
+
+/* Fires once when the ring fill level crosses CONSOLE_RING_HIGH_WATER; re-armed after draining below it */
+void console_ring_high_water(uint16_t used, uint16_t capacity);
+
+#    endif /* CONSOLE_NONBLOCKING */
+
 #endif /* CONSOLE_ENABLE */
 
 /* --------------
@@ -16,8 +16,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
+#include "action_util.h"
 #include "host.h"
 #include "util.h"
 #include "debug.h"
@@ -31,6 +33,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "joystick.h"
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
+#ifdef HOST_METRICS_ENABLE
+#    include "timer.h"
+#endif
+
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
@@ -70,8 +80,51 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+// Last report sent per endpoint, for suppressing identical consecutive reports. The reports are only a handful of
+// bytes, so an exact compare is cheaper than any hashing scheme and cannot suppress a changed report by collision.
+#ifdef DIGITIZER_ENABLE
+static report_digitizer_t last_digitizer_report;
+static bool               have_digitizer_report = false;
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+static report_programmable_button_t last_programmable_button_report;
+static bool                         have_programmable_button_report = false;
+#endif
+
+void host_report_dedup_flush(void) {
+#ifdef DIGITIZER_ENABLE
+    have_digitizer_report = false;
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+    have_programmable_button_report = false;
+#endif
+}
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
+    // The new host has not seen any of the cached reports.
+    host_report_dedup_flush();
+}
+
+void host_replay_state(void) {
+    // The incoming sink has seen none of the cached reports.
+    host_report_dedup_flush();
+
+    // Replay the held keyboard state so keys pressed across the switch neither stick nor vanish.
+    send_keyboard_report();
+
+    // Re-send any live extra usages; the caches are cleared first so the sends are not suppressed
+    // as duplicates of what the previous sink received.
+    uint16_t system_usage   = last_system_usage;
+    uint16_t consumer_usage = last_consumer_usage;
+    last_system_usage       = 0;
+    last_consumer_usage     = 0;
+    if (system_usage) {
+        host_system_send(system_usage);
+    }
+    if (consumer_usage) {
+        host_consumer_send(consumer_usage);
+    }
 }
 
 host_driver_t *host_get_driver(void) {
@@ -94,6 +147,71 @@ static host_driver_t *host_get_active_driver(void) {
     return driver;
 }
 
+#ifdef HOST_METRICS_ENABLE
+static host_metrics_t host_metrics[HOST_ENDPOINT_COUNT];
+
+static void host_metrics_sample_depth(host_endpoint_t endpoint) {
+    host_driver_t *active = host_get_active_driver();
+    if (!active || !active->endpoint_depth) return;
+
+    uint8_t depth                  = (*active->endpoint_depth)(endpoint);
+    host_metrics[endpoint].depth   = depth;
+    if (depth > host_metrics[endpoint].max_depth) host_metrics[endpoint].max_depth = depth;
+}
+
+static void host_metrics_record(host_endpoint_t endpoint, uint16_t start) {
+    uint16_t        latency = timer_elapsed(start);
+    host_metrics_t *metrics = &host_metrics[endpoint];
+
+    metrics->sends++;
+    metrics->last_latency = latency;
+    if (latency > metrics->max_latency) metrics->max_latency = latency;
+    // The driver returns without waiting when the endpoint can take the report; any
+    // measurable latency means the send stalled behind the host.
+    if (latency > 0) metrics->blocked_sends++;
+}
+
+host_metrics_t host_get_metrics(host_endpoint_t endpoint) {
+    return host_metrics[endpoint];
+}
+
+void host_metrics_reset(void) {
+    memset(host_metrics, 0, sizeof(host_metrics));
+}
+
+// Wraps a driver send with depth/latency accounting; compiles down to the bare call
+// when metrics are disabled.
+#    define HOST_METRICS_SEND(endpoint, call)     \
+        do {                                      \
+            host_metrics_sample_depth(endpoint);  \
+            uint16_t start = timer_read();        \
+            call;                                 \
+            host_metrics_record(endpoint, start); \
+        } while (0)
+#else
+#    define HOST_METRICS_SEND(endpoint, call) call
+#endif
+
+bool host_endpoint_ready(host_endpoint_t endpoint) {
+    host_driver_t *driver = host_get_active_driver();
+    if (!driver) return false;
+    if (!driver->endpoint_ready) return true;
+
+    return (*driver->endpoint_ready)(endpoint);
+}
+
+#ifdef HOST_METRICS_ENABLE
+static bool host_send_would_block(host_endpoint_t endpoint) {
+    if (host_endpoint_ready(endpoint)) return false;
+    host_metrics[endpoint].would_blocks++;
+    return true;
+}
+#else
+static bool host_send_would_block(host_endpoint_t endpoint) {
+    return !host_endpoint_ready(endpoint);
+}
+#endif
+
 bool host_can_send_nkro(void) {
 #ifdef CONNECTION_ENABLE
     switch (connection_get_host()) {
@@ -141,7 +259,11 @@ void host_keyboard_send(report_keyboard_t *report) {
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
-    (*driver->send_keyboard)(report);
+    HOST_METRICS_SEND(HOST_ENDPOINT_KEYBOARD, (*driver->send_keyboard)(report));
+
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_on_report();
+#endif
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -157,7 +279,11 @@ void host_nkro_send(report_nkro_t *report) {
     if (!driver || !driver->send_nkro) return;
 
     report->report_id = REPORT_ID_NKRO;
-    (*driver->send_nkro)(report);
+    HOST_METRICS_SEND(HOST_ENDPOINT_NKRO, (*driver->send_nkro)(report));
+
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_on_report();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -180,7 +306,31 @@ void host_mouse_send(report_mouse_t *report) {
     report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
     report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
 #endif
-    (*driver->send_mouse)(report);
+    HOST_METRICS_SEND(HOST_ENDPOINT_MOUSE, (*driver->send_mouse)(report));
+}
+
+/* Non-blocking variants: when the endpoint would block, the report is not sent and the
+ * caller keeps ownership of it, so subsequent state changes coalesce into the same
+ * report instead of queueing behind a congested host. */
+bool host_keyboard_send_nb(report_keyboard_t *report) {
+    if (host_send_would_block(HOST_ENDPOINT_KEYBOARD)) return false;
+
+    host_keyboard_send(report);
+    return true;
+}
+
+bool host_nkro_send_nb(report_nkro_t *report) {
+    if (host_send_would_block(HOST_ENDPOINT_NKRO)) return false;
+
+    host_nkro_send(report);
+    return true;
+}
+
+bool host_mouse_send_nb(report_mouse_t *report) {
+    if (host_send_would_block(HOST_ENDPOINT_MOUSE)) return false;
+
+    host_mouse_send(report);
+    return true;
 }
 
 void host_system_send(uint16_t usage) {
@@ -194,7 +344,7 @@ void host_system_send(uint16_t usage) {
         .report_id = REPORT_ID_SYSTEM,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    HOST_METRICS_SEND(HOST_ENDPOINT_EXTRA, (*driver->send_extra)(&report));
 }
 
 void host_consumer_send(uint16_t usage) {
@@ -208,7 +358,7 @@ void host_consumer_send(uint16_t usage) {
         .report_id = REPORT_ID_CONSUMER,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    HOST_METRICS_SEND(HOST_ENDPOINT_EXTRA, (*driver->send_extra)(&report));
 }
 
 #ifdef JOYSTICK_ENABLE
@@ -283,6 +433,10 @@ void host_digitizer_send(digitizer_t *digitizer) {
         .y        = (uint16_t)(digitizer->y * 0x7FFF),
     };
 
+    if (have_digitizer_report && memcmp(&report, &last_digitizer_report, sizeof(report)) == 0) return;
+    last_digitizer_report = report;
+    have_digitizer_report = true;
+
     send_digitizer(&report);
 }
 #endif
@@ -296,6 +450,10 @@ void host_programmable_button_send(uint32_t data) {
         .usage     = data,
     };
 
+    if (have_programmable_button_report && memcmp(&report, &last_programmable_button_report, sizeof(report)) == 0) return;
+    last_programmable_button_report = report;
+    have_programmable_button_report = true;
+
     send_programmable_button(&report);
 }
 #endif
@@ -307,7 +465,7 @@ void host_raw_hid_send(uint8_t *data, uint8_t length) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_raw_hid) return;
 
-    (*driver->send_raw_hid)(data, length);
+    HOST_METRICS_SEND(HOST_ENDPOINT_RAW_HID, (*driver->send_raw_hid)(data, length));
 }
 #endif
 
@@ -38,6 +38,32 @@ led_t   host_keyboard_led_state(void);
 void    host_keyboard_send(report_keyboard_t *report);
 void    host_nkro_send(report_nkro_t *report);
 void    host_mouse_send(report_mouse_t *report);
+
+/* true if the active driver would accept a send on the endpoint without waiting;
+ * drivers without a readiness probe always report ready */
+bool host_endpoint_ready(host_endpoint_t endpoint);
+
+/* non-blocking send variants: send only if the endpoint is ready, otherwise
+ * return false so the caller can keep the report and coalesce further updates
+ * into it instead of stalling the scan loop behind a congested host */
+bool host_keyboard_send_nb(report_keyboard_t *report);
+bool host_nkro_send_nb(report_nkro_t *report);
+bool host_mouse_send_nb(report_mouse_t *report);
+
+#ifdef HOST_METRICS_ENABLE
+typedef struct host_metrics_t {
+    uint32_t sends;         /* reports handed to the driver */
+    uint32_t blocked_sends; /* sends that stalled waiting for the endpoint */
+    uint32_t would_blocks;  /* non-blocking sends refused because the endpoint was busy */
+    uint16_t last_latency;  /* ms spent in the driver for the most recent send */
+    uint16_t max_latency;   /* worst-case ms spent in the driver since reset */
+    uint8_t  depth;         /* queue depth sampled at the most recent send */
+    uint8_t  max_depth;     /* deepest queue seen at a send since reset */
+} host_metrics_t;
+
+host_metrics_t host_get_metrics(host_endpoint_t endpoint);
+void           host_metrics_reset(void);
+#endif
 void    host_system_send(uint16_t usage);
 void    host_consumer_send(uint16_t usage);
 void    host_programmable_button_send(uint32_t data);
@@ -46,6 +72,14 @@ void    host_raw_hid_send(uint8_t *data, uint8_t length);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+/* drop the per-endpoint last-report caches so the next report is always sent */
+void host_report_dedup_flush(void);
+
+/* replay live HID state (held keys, active system/consumer usages) to the active sink;
+ * called after a transport switch so the incoming host converges without waiting for
+ * the next state change */
+void host_replay_state(void);
+
 #ifdef __cplusplus
 }
 #endif
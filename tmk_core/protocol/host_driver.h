@@ -23,6 +23,17 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "midi.h"
 #endif
 
+/* Host-level outbound endpoints. Several of these may share one transport endpoint
+ * (e.g. the USB shared EP); the driver collapses them onto the same queue. */
+typedef enum {
+    HOST_ENDPOINT_KEYBOARD,
+    HOST_ENDPOINT_NKRO,
+    HOST_ENDPOINT_MOUSE,
+    HOST_ENDPOINT_EXTRA,
+    HOST_ENDPOINT_RAW_HID,
+    HOST_ENDPOINT_COUNT,
+} host_endpoint_t;
+
 typedef struct {
     uint8_t (*keyboard_leds)(void);
     void (*send_keyboard)(report_keyboard_t *);
@@ -32,6 +43,10 @@ typedef struct {
 #ifdef RAW_ENABLE
     void (*send_raw_hid)(uint8_t *, uint8_t);
 #endif
+    /* Optional backpressure probes; drivers without them are treated as always
+     * ready (sends may still block inside the send function, as before). */
+    bool (*endpoint_ready)(host_endpoint_t endpoint); /* a send would be accepted without waiting */
+    uint8_t (*endpoint_depth)(host_endpoint_t endpoint); /* reports queued but not yet on the wire */
 } host_driver_t;
 
 void send_joystick(report_joystick_t *report);
@@ -134,7 +134,17 @@ enum desktop_usages {
 
 // clang-format on
 
-#define NKRO_REPORT_BITS 30
+/* Bytes in the NKRO key bitmap; one bit per Keyboard/Keypad usage starting at 0x00. The default
+ * covers usages through 0xEF. Compact builds may shrink it (see NKRO_COMPACT_REPORT), trimming
+ * every NKRO transfer and the report descriptor; 13 bytes is the smallest size that still covers
+ * SEND_STRING() output, the nav cluster, keypad and F-keys. */
+#ifndef NKRO_REPORT_BITS
+#    define NKRO_REPORT_BITS 30
+#endif
+
+#if NKRO_REPORT_BITS < 13 || NKRO_REPORT_BITS > 30
+#    error NKRO_REPORT_BITS must be between 13 and 30
+#endif
 
 #ifdef KEYBOARD_SHARED_EP
 #    define KEYBOARD_REPORT_SIZE 9
@@ -36,6 +36,7 @@
     this software.
 */
 
+#include "compiler_support.h"
 #include "util.h"
 #include "report.h"
 #include "usb_descriptor.h"
@@ -532,6 +533,12 @@ const USB_Descriptor_Device_t PROGMEM DeviceDescriptor = {
 #    define USB_POLLING_INTERVAL_MS 1
 #endif
 
+// On full-speed USB the host schedules interrupt endpoints in 1 ms frames, so bInterval = 1 (1000 Hz) is the
+// fastest service interval that can be requested; sub-millisecond polling (2-8 kHz) exists only on high-speed
+// links, which none of the supported device controllers provide. Guard against configs that try to ask for more
+// by passing 0, which is an invalid bInterval and leaves the endpoint's rate up to the host.
+STATIC_ASSERT(USB_POLLING_INTERVAL_MS >= 1 && USB_POLLING_INTERVAL_MS <= 255, "USB_POLLING_INTERVAL_MS must be between 1 and 255; full-speed USB cannot poll faster than 1000 Hz");
+
 /*
  * Configuration descriptors
  */
@@ -44,6 +44,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #if defined(CONSOLE_ENABLE)
 #    define RBUF_SIZE 128
 #    include "ring_buffer.h"
+// sendchar() can be called from any context, so the console sink takes the locked variant
+RING_BUFFER_TYPED_MPSC(rbuf, uint8_t, RBUF_SIZE)
 #endif
 
 #ifdef OS_DETECTION_ENABLE
@@ -193,8 +195,9 @@ void console_task(void) {
     // Send in chunks of 8 padded to 32
     char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
     uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
+    uint8_t c;
+    while (send_buf_count < CONSOLE_EPSIZE && rbuf_dequeue(&c)) {
+        send_buf[send_buf_count++] = c;
     }
 
     send_report(3, send_buf, CONSOLE_BUFFER_SIZE);
@@ -17,7 +17,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
-// Define options
+// Shared tap/hold tuning for all temanyl boards (was copy-pasted per keymap)
 #define TAPPING_TERM 250
 #define PERMISSIVE_HOLD
 #define TAPPING_TERM_PER_KEY
+#define ONESHOT_TIMEOUT 2000
@@ -21,7 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <qp.h>
 #include "display.h"
 #include "../scenes/scenes.h"
+#include "../scenes/scene_graph.h"
 #include "framebuffer.h"
+#include "display_sched.h"
 #include "draw_logo.h"
 #include "../graphics/helvetica20.qff.c"
 #include "../weather_effects.h"
@@ -36,19 +38,55 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "../seasons/easter/seasons_easter.h"
 #include "../objects/seasonal/ghost.h"
 #include "../weather_transition.h"
+#include "../scene_store.h"
 
-// Layer enum (from keymap.c)
-enum layer_names {
-    _MAC_COLEMAK_DH,
-    _MAC_CODE,
-    _MAC_NAV,
-    _MAC_NUM
-};
+#ifdef WARM_BOOT_ENABLE
+#    include "warm_boot.h"
+#endif
+
+#include "../temanyl.h"
+
+// Panel wiring and geometry; the defaults are the LILYGO T-Display RP2040 as used
+// by chocmanyl36. A board reusing the engine overrides these (and FB_WIDTH /
+// FB_HEIGHT in framebuffer.h) from its keymap config.h, so the panel constants
+// are baked in at compile time per board rather than checked at runtime.
+#ifndef DISPLAY_POWER_PIN
+#    define DISPLAY_POWER_PIN GP22
+#endif
+#ifndef DISPLAY_CS_PIN
+#    define DISPLAY_CS_PIN GP5
+#endif
+#ifndef DISPLAY_DC_PIN
+#    define DISPLAY_DC_PIN GP1
+#endif
+#ifndef DISPLAY_RST_PIN
+#    define DISPLAY_RST_PIN GP0
+#endif
+#ifndef DISPLAY_OFFSET_X
+#    define DISPLAY_OFFSET_X 53
+#endif
+#ifndef DISPLAY_OFFSET_Y
+#    define DISPLAY_OFFSET_Y 40
+#endif
 
 // Display device and font
 painter_device_t display;
 painter_font_handle_t media_font = NULL;
 
+#ifdef CHOCMANYL36_DUAL_DISPLAY
+// rev2 second ST7789 on the shared SPI bus; same panel, own CS/DC/RST
+#    ifndef DISPLAY2_CS_PIN
+#        define DISPLAY2_CS_PIN GP6
+#    endif
+#    ifndef DISPLAY2_DC_PIN
+#        define DISPLAY2_DC_PIN GP2
+#    endif
+#    ifndef DISPLAY2_RST_PIN
+#        define DISPLAY2_RST_PIN GP3
+#    endif
+painter_device_t display2 = NULL;
+#endif
+
 // Display state tracking
 uint8_t current_display_layer = 255;
 uint8_t backlight_brightness = 102;
@@ -56,6 +94,18 @@ uint32_t last_uptime_update = 0;
 bool deferred_display_update_pending = false;
 uint32_t deferred_display_update_timer = 0;
 
+#ifdef WARM_BOOT_ENABLE
+// Handoff staged in noinit RAM by shutdown_user() just before a reset: the version guards against
+// flashing a firmware with a different layout, and the payload carries the state the panel itself
+// retains across the reset so the warm path resumes it instead of re-deriving defaults.
+#    define WARM_DISPLAY_HANDOFF_VERSION 1
+typedef struct {
+    uint8_t version;
+    uint8_t brightness;
+} warm_display_handoff_t;
+static bool display_warm_boot = false;
+#endif
+
 // Volume indicator state
 uint8_t current_volume = 0;
 
@@ -96,6 +146,36 @@ bool needs_scroll = false;
 // Forward declaration
 void set_layer_background(uint8_t layer);
 
+// Widget-level content hashing for the info area. Each widget owns a fixed region and
+// clears only that region, so skipping an unchanged widget never leaves neighbors stale.
+// The draw functions hash their inputs (including the layer color, which recolors all
+// three widgets) and return early on a match; 0 is the "forced" sentinel, so a full
+// redraw is requested by clearing the hashes rather than by collision-proof means -
+// an FNV hash of real widget state landing exactly on 0 is not a case worth code.
+static uint32_t datetime_hash = 0;
+static uint32_t media_hash    = 0;
+static uint32_t volume_hash   = 0;
+
+static uint32_t widget_hash_u8(uint32_t hash, uint8_t value) {
+    return (hash ^ value) * 16777619u; // FNV-1a step
+}
+
+static uint32_t widget_hash_str(uint32_t hash, const char *str) {
+    while (*str != '\0') {
+        hash = widget_hash_u8(hash, (uint8_t)*str++);
+    }
+    return hash;
+}
+
+#define WIDGET_HASH_SEED 2166136261u // FNV-1a offset basis
+
+// Force every info widget to repaint on its next draw call
+static void info_widgets_invalidate(void) {
+    datetime_hash = 0;
+    media_hash    = 0;
+    volume_hash   = 0;
+}
+
 // Draw a single 7-segment digit
 void draw_digit(uint16_t x, uint16_t y, uint8_t digit, uint8_t hue, uint8_t sat, uint8_t val) {
     // Each segment is a rectangle
@@ -160,6 +240,19 @@ void draw_date_time(void) {
     uint8_t hue, sat, val;
     get_layer_color(layer, &hue, &sat, &val);
 
+    // Skip the render when nothing that reaches the pixels has changed
+    uint32_t hash = widget_hash_u8(WIDGET_HASH_SEED, current_day);
+    hash          = widget_hash_u8(hash, current_month);
+    hash          = widget_hash_u8(hash, current_year & 0xFF);
+    hash          = widget_hash_u8(hash, current_year >> 8);
+    hash          = widget_hash_u8(hash, current_hour);
+    hash          = widget_hash_u8(hash, current_minute);
+    hash          = widget_hash_u8(hash, hue);
+    if (hash == datetime_hash) {
+        return;
+    }
+    datetime_hash = hash;
+
     // Clear date/time area above media text (black background)
     // Date starts at y=155 and is 20px tall, time starts at y=180 and is 20px tall
     qp_rect(display, 0, 155, 134, 206, 0, 0, 0, true);
@@ -214,9 +307,36 @@ void draw_date_time(void) {
 
 // Draw volume bar at bottom of display
 void draw_volume_bar(uint8_t hue, uint8_t sat, uint8_t val) {
+    // Skip the render when neither the volume nor the layer color has changed
+    uint32_t hash = widget_hash_u8(WIDGET_HASH_SEED, current_volume);
+    hash          = widget_hash_u8(hash, hue);
+    if (hash == volume_hash) {
+        return;
+    }
+    volume_hash = hash;
+
     // Calculate bar width based on volume (max width 120 pixels, leaving margins)
     uint16_t bar_width = (current_volume * 120) / 100;
 
+#ifdef QUANTUM_PAINTER_CMDLIST_ENABLE
+    // Recorded once: clear the bottom area (starts after media text at y=230), draw the thin light grey outline,
+    // then the fill with its right edge and logo color bound to slots. Every layer-change/volume update is then a
+    // single replay.
+    static qp_cmdlist_t volume_cmds;
+    if (volume_cmds.count == 0) {
+        qp_cmdlist_init(&volume_cmds);
+        qp_cmdlist_rect(&volume_cmds, 0, 231, 134, 239, 0, 0, 0, true);
+        qp_cmdlist_rect(&volume_cmds, 5, 233, 127, 238, 0, 0, 150, false);
+        qp_cmdlist_rect(&volume_cmds, 6, 234, 0, 237, 0, 0, 0, true);
+        qp_cmdlist_bind(&volume_cmds, 2, 0); // right edge follows the volume
+        qp_cmdlist_bind(&volume_cmds, 4, 1); // hue
+        qp_cmdlist_bind(&volume_cmds, 5, 2); // sat
+        qp_cmdlist_bind(&volume_cmds, 6, 3); // val
+    }
+    // An empty bar replays the fill in black over the just-cleared area instead of skipping it - a visual no-op
+    uint16_t slots[4] = {(uint16_t)(6 + bar_width), hue, sat, bar_width > 0 ? val : 0};
+    qp_cmdlist_replay(display, &volume_cmds, slots, 4, NULL, 0);
+#else
     // Clear bottom area with black background (starts after media text at y=230)
     qp_rect(display, 0, 231, 134, 239, 0, 0, 0, true);
 
@@ -227,6 +347,7 @@ void draw_volume_bar(uint8_t hue, uint8_t sat, uint8_t val) {
     if (bar_width > 0) {
         qp_rect(display, 6, 234, 6 + bar_width, 237, hue, sat, val, true);
     }
+#endif
 
     // Note: No qp_flush() here - let the caller decide when to flush
 }
@@ -318,9 +439,6 @@ void draw_media_text(void) {
     uint16_t media_y = 207;
     uint16_t media_h = 23;
 
-    // Clear media text area (black background)
-    qp_rect(display, 0, media_y, 134, media_y + media_h - 1, 0, 0, 0, true);
-
     // Only draw text if font was loaded successfully
     if (media_font != NULL) {
         // Get current layer color
@@ -344,6 +462,19 @@ void draw_media_text(void) {
             scroll_timer = timer_read32();
         }
 
+        // Skip the render when the visible window and color are unchanged
+        uint32_t hash = widget_hash_u8(WIDGET_HASH_SEED, hue);
+        hash          = widget_hash_u8(hash, media_active ? 1 : 0);
+        hash          = widget_hash_u8(hash, scroll_position);
+        hash          = widget_hash_str(hash, display_text);
+        if (hash == media_hash) {
+            return;
+        }
+        media_hash = hash;
+
+        // Clear media text area (black background)
+        qp_rect(display, 0, media_y, 134, media_y + media_h - 1, 0, 0, 0, true);
+
         // Prepare display buffer with scrolled text
         char display_buffer[MAX_DISPLAY_CHARS + 1];
 
@@ -368,6 +499,7 @@ void draw_media_text(void) {
         qp_drawtext_recolor(display, 2, media_y + 2, media_font, display_buffer, hue, sat, val, 0, 0, 0);
     } else {
         // Font failed to load - draw error indicator (red rectangle)
+        qp_rect(display, 0, media_y, 134, media_y + media_h - 1, 0, 0, 0, true);
         qp_rect(display, 2, media_y + 2, 20, media_y + 10, 0, 255, 255, true);
     }
 
@@ -385,6 +517,10 @@ void set_backlight_brightness(uint8_t brightness) {
     brightness_display_timer = timer_read32();
     last_brightness_value = brightness;
 
+    // Snapshot the scene under the indicator box so dismissal is a region blit
+    // instead of a full scene redraw (no-op while the overlay is already up)
+    fb_overlay_begin(17, 10, 117, 50);
+
     // Draw the brightness indicator overlay
     draw_brightness_indicator();
 }
@@ -409,6 +545,12 @@ void set_layer_background(uint8_t layer) {
         // Reset animation states to allow background to be re-saved
         reset_scene_animations();
 
+        // Every widget must repaint over the cleared screen, whatever its hash says
+        info_widgets_invalidate();
+
+        // A held overlay snapshot is stale once the scene is redrawn; drop it
+        fb_overlay_cancel();
+
         // Clear entire screen
         fb_rect_hsv(0, 0, 134, 239, 0, 0, 0, true);
 
@@ -431,9 +573,14 @@ void set_layer_background(uint8_t layer) {
     // Redraw volume bar with the same color at the bottom
     draw_volume_bar(hue, sat, val);
 
-    // Flush both framebuffer (upper) and QP (lower)
-    fb_flush(display);   // Flush framebuffer scenic area
-    qp_flush(display);   // Flush QP info area
+    // Hand the flush to the scheduler instead of streaming inline: it services
+    // one registered panel per housekeeping pass, so a second display never
+    // doubles the stall. An active weather crossfade still takes over the
+    // primary's scenic flush and streams a blended frame directly
+    if (!fb_crossfade_flush(display)) {
+        display_sched_mark_dirty_all(0, 0, FB_WIDTH - 1, FB_SPLIT_Y - 1);
+    }
+    display_sched_mark_qp_dirty_all();
 }
 
 // Update display based on current layer state
@@ -479,24 +626,43 @@ void fb_quick_test(void) {
 
 // Initialize the ST7789 display
 void init_display(void) {
-    // CRITICAL: Enable display power on GP22 (LILYGO board power enable)
-    setPinOutput(GP22);
-    writePinHigh(GP22);
+#ifdef WARM_BOOT_ENABLE
+    // A valid stash means the previous run staged it right before resetting and the panel kept
+    // power through the bootloader round-trip; reattach without blanking it, so a flash-iterate
+    // cycle never shows a dead screen.
+    warm_display_handoff_t handoff;
+    display_warm_boot = warm_boot_payload(&handoff, sizeof(handoff)) == sizeof(handoff) && handoff.version == WARM_DISPLAY_HANDOFF_VERSION;
+#endif
+
+    // CRITICAL: Enable display power (LILYGO board power enable on GP22)
+    setPinOutput(DISPLAY_POWER_PIN);
+    writePinHigh(DISPLAY_POWER_PIN);
 
     // Small delay to let power stabilize
     wait_ms(50);
 
-    // Create display: 135x240 portrait mode (rotated 90°)
+    // Create display: FB_WIDTH x FB_HEIGHT portrait mode (rotated 90°)
     // Using SPI mode 3 and slower divisor (16) for reliable communication
-    display = qp_st7789_make_spi_device(135, 240, GP5, GP1, GP0, 16, 3);
+    display = qp_st7789_make_spi_device(FB_WIDTH, FB_HEIGHT, DISPLAY_CS_PIN, DISPLAY_DC_PIN, DISPLAY_RST_PIN, 16, 3);
 
     // LILYGO T-Display RP2040: Portrait mode with proper offsets
-    qp_set_viewport_offsets(display, 53, 40);
+    qp_set_viewport_offsets(display, DISPLAY_OFFSET_X, DISPLAY_OFFSET_Y);
 
     // Initialize with 180° rotation (controller mounted upside down)
+#ifdef WARM_BOOT_ENABLE
+    if (display_warm_boot) {
+        // Panel never powered down: skip the reset/init sequence and keep the displayed content
+        if (!qp_init_warm(display, QP_ROTATION_180)) {
+            return;
+        }
+    } else if (!qp_init(display, QP_ROTATION_180)) {
+        return; // Initialization failed
+    }
+#else
     if (!qp_init(display, QP_ROTATION_180)) {
         return;  // Initialization failed
     }
+#endif
 
     // Power on display
     if (!qp_power(display, true)) {
@@ -506,6 +672,26 @@ void init_display(void) {
     // Wait for display to stabilize
     wait_ms(50);
 
+    // Register the primary panel with the flush scheduler
+    display_sched_register(display, true);
+
+#ifdef CHOCMANYL36_DUAL_DISPLAY
+    // Bring up the rev2 second panel on the shared bus; it mirrors the scenic
+    // region and is serviced round-robin by the scheduler
+    display2 = qp_st7789_make_spi_device(FB_WIDTH, FB_HEIGHT, DISPLAY2_CS_PIN, DISPLAY2_DC_PIN, DISPLAY2_RST_PIN, 16, 3);
+    qp_set_viewport_offsets(display2, DISPLAY_OFFSET_X, DISPLAY_OFFSET_Y);
+#ifdef WARM_BOOT_ENABLE
+    bool display2_okay = display_warm_boot ? qp_init_warm(display2, QP_ROTATION_180) : qp_init(display2, QP_ROTATION_180);
+    if (display2_okay && qp_power(display2, true)) {
+#else
+    if (qp_init(display2, QP_ROTATION_180) && qp_power(display2, true)) {
+#endif
+        display_sched_register(display2, false);
+    } else {
+        display2 = NULL; // Leave the slot unregistered; primary keeps working
+    }
+#endif
+
     // Initialize framebuffer system
     fb_init();
 
@@ -515,6 +701,10 @@ void init_display(void) {
     // Initialize wind system (default: no wind, blowing right)
     wind_init();
 
+    // Override the seasonal defaults with the persisted pre-reboot weather and
+    // wind, so the first paint below already shows the restored scene
+    scene_store_apply_environment();
+
 #if FRAMEBUFFER_TEST
     // Run framebuffer quick test (shows test pattern for 2 seconds)
     fb_quick_test();
@@ -544,12 +734,31 @@ void init_display(void) {
       - 191 = 75%
       - 255 = 100%
     */
+#ifdef WARM_BOOT_ENABLE
+    // Restore the pre-reset backlight level on a warm boot instead of the 40% default
+    uint8_t boot_brightness = display_warm_boot ? handoff.brightness : 102;
+#else
+    uint8_t boot_brightness = 102;
+#endif
+
     // Configure PWM slice 2 (GP4 = PWM2_A)
     *(volatile uint32_t*)(0x40050028 + 0x04) = 16 << 4;  // DIV: no division
     *(volatile uint32_t*)(0x40050028 + 0x10) = 255;      // TOP: wrap at 255
-    *(volatile uint32_t*)(0x40050028 + 0x0C) = 102;      // CC: channel A = 128 (50%)
+    *(volatile uint32_t*)(0x40050028 + 0x0C) = boot_brightness; // CC: channel A duty
     *(volatile uint32_t*)(0x40050028 + 0x00) = 0x01;     // CSR: enable
 
+#ifdef WARM_BOOT_ENABLE
+    if (display_warm_boot) {
+        // The panel still shows the pre-reset content; skip the boot repaint and let the normal
+        // housekeeping cadence take over (the deferred update repairs anything drawn mid-reset)
+        backlight_brightness            = boot_brightness;
+        last_brightness_value           = boot_brightness;
+        deferred_display_update_pending = true;
+        deferred_display_update_timer   = timer_read32();
+        return;
+    }
+#endif
+
     // Fill screen with black background (135x240 portrait)
     fb_rect_hsv(0, 0, 134, 239, 0, 0, 0, true);
     wait_ms(50);
@@ -579,7 +788,84 @@ void init_display(void) {
     qp_flush(display);   // Flush QP info area
 }
 
+#ifdef WARM_BOOT_ENABLE
+// Stage the display handoff just before the reset: a UF2 flash only reboots the MCU, the panel
+// keeps power and its GRAM, so the next boot's warm path reattaches without blanking it.
+bool shutdown_user(bool jump_to_bootloader) {
+    (void)jump_to_bootloader;
+    warm_display_handoff_t handoff = {
+        .version    = WARM_DISPLAY_HANDOFF_VERSION,
+        .brightness = backlight_brightness,
+    };
+    warm_boot_stage(&handoff, sizeof(handoff));
+    return true;
+}
+#endif
+
+// USB suspend/resume: power the panels down with the host and bring them back
+// without re-running the init sequence. qp_power() only toggles the panel's
+// display-on state, so resume costs two short SPI commands; the full redraw is
+// deferred to the housekeeping task instead of running in the wake path.
+static bool display_suspended = false;
+
+void suspend_power_down_user(void) {
+    if (display_suspended) {
+        return; // suspend_power_down runs once per suspend-loop iteration
+    }
+    display_suspended = true;
+    *(volatile uint32_t*)(0x40050028 + 0x0C) = 0; // backlight PWM duty to zero
+    qp_power(display, false);
+#ifdef CHOCMANYL36_DUAL_DISPLAY
+    if (display2 != NULL) {
+        qp_power(display2, false);
+    }
+#endif
+}
+
+void suspend_wakeup_init_user(void) {
+    if (!display_suspended) {
+        return;
+    }
+    display_suspended = false;
+    qp_power(display, true);
+#ifdef CHOCMANYL36_DUAL_DISPLAY
+    if (display2 != NULL) {
+        qp_power(display2, true);
+    }
+#endif
+    *(volatile uint32_t*)(0x40050028 + 0x0C) = backlight_brightness; // restore PWM duty
+    // Panel GRAM survives display-off, but schedule a full redraw anyway so
+    // anything drawn around the suspend edge is repaired outside the wake path
+    deferred_display_update_pending = true;
+    deferred_display_update_timer   = timer_read32();
+}
+
 // Display housekeeping task - handles all display animations and updates
+// Scene graph draw callbacks for the cloud/ghost composite
+static void cloud_node_draw(const scene_node_t *node, void *ctx) {
+    (void)node;
+    // Determine cloud type based on current weather
+    weather_state_t current_weather = weather_transition_get_current();
+    cloud_type_t    cloud_type;
+    if (weather_is_snowing(current_weather)) {
+        cloud_type = CLOUD_TYPE_LIGHT;
+    } else if (current_weather == WEATHER_RAIN_LIGHT) {
+        cloud_type = CLOUD_TYPE_DARK_LIGHT;
+    } else if (current_weather == WEATHER_RAIN_MEDIUM) {
+        cloud_type = CLOUD_TYPE_DARK_MEDIUM;
+    } else if (current_weather == WEATHER_RAIN_HEAVY) {
+        cloud_type = CLOUD_TYPE_DARK_HEAVY;
+    } else {
+        cloud_type = CLOUD_TYPE_LIGHT;
+    }
+    cloud_draw((cloud_t *)ctx, cloud_type);
+}
+
+static void ghost_node_draw(const scene_node_t *node, void *ctx) {
+    (void)node;
+    ghost_draw((ghost_t *)ctx);
+}
+
 void display_housekeeping_task(void) {
     uint32_t current_time = timer_read32();
 
@@ -599,6 +885,21 @@ void display_housekeeping_task(void) {
 
     update_display_for_layer();
 
+    // Step an active weather crossfade. While the fade owns the panel the
+    // per-object animation passes below are held off - their region flushes
+    // would punch fully-opaque holes in the blended frames. The fade only lasts
+    // WEATHER_CROSSFADE_DURATION_MS, so animations resume almost immediately.
+    if (fb_crossfade_active()) {
+        static uint32_t crossfade_step_timer = 0;
+        if (timer_elapsed32(crossfade_step_timer) >= WEATHER_CROSSFADE_STEP_MS) {
+            crossfade_step_timer = timer_read32();
+            fb_crossfade_flush(display);
+        }
+        if (fb_crossfade_active()) {
+            return;
+        }
+    }
+
     bool needs_flush = false;
 
     // Check if hour or day changed (for seasonal animation updates)
@@ -674,10 +975,16 @@ void display_housekeeping_task(void) {
         if (current_time - brightness_display_timer >= BRIGHTNESS_DISPLAY_TIMEOUT) {
             // Timeout expired, hide brightness indicator
             brightness_display_active = false;
-            // Defer full redraw to avoid blocking matrix scan
-            deferred_display_update_pending = true;
-            deferred_display_update_timer = current_time;
-            needs_flush = false;  // Will be flushed when deferred update runs
+            if (fb_overlay_active()) {
+                // Blit the saved scene back over the indicator box; nothing else repaints
+                fb_overlay_end(display);
+                needs_flush = false;
+            } else {
+                // No snapshot captured - defer a full redraw to avoid blocking matrix scan
+                deferred_display_update_pending = true;
+                deferred_display_update_timer = current_time;
+                needs_flush = false;  // Will be flushed when deferred update runs
+            }
         }
     }
 
@@ -765,24 +1072,31 @@ void display_housekeeping_task(void) {
         }
     }
 
-    // Region-based animation with smart overlap detection
-    // Store old positions before updating
-    cloud_t old_clouds[NUM_CLOUDS];
-    ghost_t old_ghosts[NUM_GHOSTS];
-    bool clouds_updated = false;
-    bool ghosts_updated = false;
+    // Region-based animation, composited through the scene graph: position updates mark the
+    // nodes dirty, and scene_graph_render() below handles erase/overlap/z-order/flush
+    static scene_node_t *cloud_nodes[NUM_CLOUDS];
+    static scene_node_t *ghost_nodes[NUM_GHOSTS];
     uint8_t num_active_clouds = weather_get_active_cloud_count();
 
     // Update cloud positions if timer elapsed
     if (cloud_initialized && cloud_background_saved) {
         if (current_time - cloud_animation_timer >= CLOUD_ANIMATION_SPEED) {
-            // Store old positions
-            for (uint8_t i = 0; i < num_active_clouds; i++) {
-                old_clouds[i] = clouds[i];
-            }
             cloud_animation_timer = current_time;
             weather_clouds_animate();  // Updates positions only
-            clouds_updated = true;
+            for (uint8_t i = 0; i < NUM_CLOUDS; i++) {
+                if (cloud_nodes[i] == NULL) {
+                    cloud_nodes[i] = scene_node_register(SCENE_Z_CLOUDS, cloud_node_draw, &clouds[i]);
+                }
+                // Cloud bounds: x-16 to x+18, y-11 to y+10 (conservative)
+                scene_node_move(cloud_nodes[i], clouds[i].x - 16, clouds[i].y - 11, clouds[i].x + 18, clouds[i].y + 10);
+                scene_node_set_visible(cloud_nodes[i], i < num_active_clouds && clouds[i].x >= -30 && clouds[i].x <= 165);
+            }
+        }
+    } else {
+        // Clouds inactive (weather changed or background invalidated); hide their nodes so a
+        // later recomposite doesn't repaint them over the new scene
+        for (uint8_t i = 0; i < NUM_CLOUDS; i++) {
+            scene_node_set_visible(cloud_nodes[i], false);
         }
     }
 
@@ -790,149 +1104,22 @@ void display_housekeeping_task(void) {
     bool ghosts_active = ghost_initialized && ghost_background_saved && is_halloween_event();
     if (ghosts_active) {
         if (current_time - ghost_animation_timer >= GHOST_ANIMATION_SPEED) {
-            // Store old positions
-            for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
-                old_ghosts[i] = ghosts[i];
-            }
             ghost_animation_timer = current_time;
             animate_ghosts();  // Updates positions only
-            ghosts_updated = true;
-        }
-    }
-
-    // Smart region-based rendering with z-ordering
-    if (clouds_updated || ghosts_updated) {
-        // Track dirty bounds for efficient flushing
-        int16_t dirty_x1 = 134, dirty_y1 = 121;
-        int16_t dirty_x2 = 0, dirty_y2 = 12;
-
-        // Helper to expand dirty region
-        #define EXPAND_DIRTY(x1, y1, x2, y2) do { \
-            if ((x1) < dirty_x1) dirty_x1 = (x1); \
-            if ((y1) < dirty_y1) dirty_y1 = (y1); \
-            if ((x2) > dirty_x2) dirty_x2 = (x2); \
-            if ((y2) > dirty_y2) dirty_y2 = (y2); \
-        } while(0)
-
-        // Helper to check rectangle overlap
-        #define RECTS_OVERLAP(ax1, ay1, ax2, ay2, bx1, by1, bx2, by2) \
-            (!((ax2) < (bx1) || (ax1) > (bx2) || (ay2) < (by1) || (ay1) > (by2)))
-
-        // Track which objects need redrawing
-        bool redraw_clouds[NUM_CLOUDS] = {false};
-        bool redraw_ghosts[NUM_GHOSTS] = {false};
-
-        // Process cloud updates
-        if (clouds_updated) {
-            for (uint8_t i = 0; i < num_active_clouds; i++) {
-                // Cloud bounds: x-16 to x+18, y-11 to y+10 (conservative)
-                int16_t old_x1 = old_clouds[i].x - 16;
-                int16_t old_y1 = old_clouds[i].y - 11;
-                int16_t old_x2 = old_clouds[i].x + 18;
-                int16_t old_y2 = old_clouds[i].y + 10;
-
-                // Restore old position
-                fb_restore_from_background(old_x1, old_y1, old_x2, old_y2);
-                EXPAND_DIRTY(old_x1, old_y1, old_x2, old_y2);
-
-                // Mark this cloud for redraw
-                redraw_clouds[i] = true;
-
-                // Check if any ghosts overlap old cloud position
-                if (ghosts_active) {
-                    for (uint8_t j = 0; j < NUM_GHOSTS; j++) {
-                        int16_t gx1 = ghosts[j].x - 7;
-                        int16_t gy1 = ghosts[j].y - 7;
-                        int16_t gx2 = ghosts[j].x + 7;
-                        int16_t gy2 = ghosts[j].y + 13;
-                        if (RECTS_OVERLAP(old_x1, old_y1, old_x2, old_y2, gx1, gy1, gx2, gy2)) {
-                            redraw_ghosts[j] = true;
-                        }
-                    }
-                }
-            }
-        }
-
-        // Process ghost updates
-        if (ghosts_updated) {
             for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
-                // Ghost bounds: x-7 to x+7, y-7 to y+13
-                int16_t old_x1 = old_ghosts[i].x - 7;
-                int16_t old_y1 = old_ghosts[i].y - 7;
-                int16_t old_x2 = old_ghosts[i].x + 7;
-                int16_t old_y2 = old_ghosts[i].y + 13;
-
-                // Restore old position
-                fb_restore_from_background(old_x1, old_y1, old_x2, old_y2);
-                EXPAND_DIRTY(old_x1, old_y1, old_x2, old_y2);
-
-                // Mark this ghost for redraw
-                redraw_ghosts[i] = true;
-
-                // Check if any clouds overlap old ghost position
-                if (cloud_initialized && cloud_background_saved) {
-                    for (uint8_t j = 0; j < num_active_clouds; j++) {
-                        int16_t cx1 = clouds[j].x - 16;
-                        int16_t cy1 = clouds[j].y - 11;
-                        int16_t cx2 = clouds[j].x + 18;
-                        int16_t cy2 = clouds[j].y + 10;
-                        if (RECTS_OVERLAP(old_x1, old_y1, old_x2, old_y2, cx1, cy1, cx2, cy2)) {
-                            redraw_clouds[j] = true;
-                        }
-                    }
-                }
-            }
-        }
-
-        // Redraw affected objects in z-order (clouds first, then ghosts)
-        // Draw clouds (background layer)
-        if (cloud_initialized && cloud_background_saved) {
-            for (uint8_t i = 0; i < num_active_clouds; i++) {
-                if (redraw_clouds[i]) {
-                    int16_t x = clouds[i].x;
-                    int16_t y = clouds[i].y;
-                    if (x >= -30 && x <= 165) {
-                        // Expand dirty region for new position
-                        EXPAND_DIRTY(x - 16, y - 11, x + 18, y + 10);
-
-                        // Determine cloud type based on current weather
-                        weather_state_t current_weather = weather_transition_get_current();
-                        cloud_type_t cloud_type;
-                        if (weather_is_snowing(current_weather)) {
-                            cloud_type = CLOUD_TYPE_LIGHT;
-                        } else if (current_weather == WEATHER_RAIN_LIGHT) {
-                            cloud_type = CLOUD_TYPE_DARK_LIGHT;
-                        } else if (current_weather == WEATHER_RAIN_MEDIUM) {
-                            cloud_type = CLOUD_TYPE_DARK_MEDIUM;
-                        } else if (current_weather == WEATHER_RAIN_HEAVY) {
-                            cloud_type = CLOUD_TYPE_DARK_HEAVY;
-                        } else {
-                            cloud_type = CLOUD_TYPE_LIGHT;
-                        }
-                        cloud_draw(&clouds[i], cloud_type);
-                    }
-                }
-            }
-        }
-
-        // Draw ghosts (foreground layer)
-        if (ghosts_active) {
-            for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
-                if (redraw_ghosts[i]) {
-                    // Expand dirty region for new position
-                    EXPAND_DIRTY(ghosts[i].x - 7, ghosts[i].y - 7, ghosts[i].x + 7, ghosts[i].y + 13);
-                    ghost_draw(&ghosts[i]);
+                if (ghost_nodes[i] == NULL) {
+                    ghost_nodes[i] = scene_node_register(SCENE_Z_GHOSTS, ghost_node_draw, &ghosts[i]);
                 }
+                // Ghost bounds: x-7 to x+7, y-7 to y+13
+                scene_node_move(ghost_nodes[i], ghosts[i].x - 7, ghosts[i].y - 7, ghosts[i].x + 7, ghosts[i].y + 13);
+                scene_node_set_visible(ghost_nodes[i], true);
             }
         }
-
-        // Flush only the dirty region (much smaller than full area)
-        if (dirty_x2 >= dirty_x1 && dirty_y2 >= dirty_y1) {
-            fb_flush_region(display, dirty_x1, dirty_y1, dirty_x2, dirty_y2);
+    } else {
+        // Hide ghosts outside the Halloween event; the render pass erases them once
+        for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+            scene_node_set_visible(ghost_nodes[i], false);
         }
-
-        #undef EXPAND_DIRTY
-        #undef RECTS_OVERLAP
     }
 
     // Handle smoke animation (all seasons except summer)
@@ -964,8 +1151,15 @@ void display_housekeeping_task(void) {
         }
     }
 
-    // Single flush at the end to batch all updates
+    // Composite and flush everything the scene graph animations dirtied this tick
+    // (no-op when no node moved)
+    scene_graph_render(display);
+
+    // Batch all remaining updates into the scheduler's per-device dirty state
     if (needs_flush) {
-        fb_flush(display);
+        display_sched_mark_dirty_all(0, 0, FB_WIDTH - 1, FB_SPLIT_Y - 1);
     }
+
+    // Service at most one panel this pass (round-robin across registered displays)
+    display_sched_task();
 }
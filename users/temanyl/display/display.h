@@ -58,6 +58,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 extern painter_device_t display;
 extern painter_font_handle_t media_font;
 
+#ifdef CHOCMANYL36_DUAL_DISPLAY
+// rev2 second panel (NULL if bring-up failed); scheduled via display_sched
+extern painter_device_t display2;
+#endif
+
 // Display state tracking
 extern uint8_t current_display_layer;
 extern uint8_t backlight_brightness;
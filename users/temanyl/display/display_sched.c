@@ -0,0 +1,108 @@
+/*
+ * Multi-display flush scheduler implementation
+ *
+ * See display_sched.h for the design. All state is per-slot; the round-robin
+ * cursor remembers the last serviced slot so a busy primary cannot starve a
+ * secondary (and vice versa).
+ */
+
+#include "display_sched.h"
+#include "framebuffer.h"
+#include "timer.h"
+
+typedef struct {
+    painter_device_t device;
+    bool             primary;
+    bool             dirty;     // fb scenic region bounding box below is valid
+    bool             qp_dirty;  // info area needs qp_flush
+    int16_t          x1, y1, x2, y2;
+    uint32_t         last_flush;
+} display_slot_t;
+
+static display_slot_t slots[DISPLAY_SCHED_MAX_DEVICES];
+static uint8_t        slot_count = 0;
+static uint8_t        cursor     = 0;
+
+int8_t display_sched_register(painter_device_t device, bool primary) {
+    if (slot_count >= DISPLAY_SCHED_MAX_DEVICES || device == NULL) {
+        return -1;
+    }
+    display_slot_t *slot = &slots[slot_count];
+    slot->device         = device;
+    slot->primary        = primary;
+    slot->dirty          = false;
+    slot->qp_dirty       = false;
+    slot->last_flush     = timer_read32();
+    return (int8_t)slot_count++;
+}
+
+void display_sched_mark_dirty_all(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // Clamp to the scenic area; fb_flush_region clamps too, but keeping the
+    // stored box in-range makes the union arithmetic below trivially safe
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_SPLIT_Y) y2 = FB_SPLIT_Y - 1;
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < slot_count; i++) {
+        display_slot_t *slot = &slots[i];
+        if (!slot->dirty) {
+            slot->dirty = true;
+            slot->x1    = x1;
+            slot->y1    = y1;
+            slot->x2    = x2;
+            slot->y2    = y2;
+        } else {
+            if (x1 < slot->x1) slot->x1 = x1;
+            if (y1 < slot->y1) slot->y1 = y1;
+            if (x2 > slot->x2) slot->x2 = x2;
+            if (y2 > slot->y2) slot->y2 = y2;
+        }
+    }
+}
+
+void display_sched_mark_qp_dirty_all(void) {
+    for (uint8_t i = 0; i < slot_count; i++) {
+        slots[i].qp_dirty = true;
+    }
+}
+
+void display_sched_task(void) {
+    if (slot_count == 0) {
+        return;
+    }
+
+    uint32_t now = timer_read32();
+
+    // Scan starting AFTER the last serviced slot so service order rotates
+    for (uint8_t n = 0; n < slot_count; n++) {
+        uint8_t         i    = (uint8_t)((cursor + 1 + n) % slot_count);
+        display_slot_t *slot = &slots[i];
+
+        // Secondary panels mirror the scenic region periodically even without
+        // explicit marks - per-object animations flush the primary directly
+        bool mirror_due = !slot->primary && (now - slot->last_flush >= DISPLAY_SCHED_MIRROR_MS);
+
+        if (!slot->dirty && !slot->qp_dirty && !mirror_due) {
+            continue;
+        }
+
+        if (slot->dirty) {
+            fb_flush_region(slot->device, slot->x1, slot->y1, slot->x2, slot->y2);
+        } else if (mirror_due) {
+            fb_flush(slot->device);
+        }
+        if (slot->qp_dirty) {
+            qp_flush(slot->device);
+        }
+
+        slot->dirty      = false;
+        slot->qp_dirty   = false;
+        slot->last_flush = now;
+        cursor           = i;
+        return; // one device per call bounds the per-pass stall
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Multi-display flush scheduler for chocmanyl36
+ *
+ * rev2 carries a second ST7789 on the shared SPI bus. Flushing both panels
+ * back-to-back in one housekeeping pass doubles the worst-case main-loop
+ * stall, so instead each registered device keeps its own dirty-region state
+ * and the scheduler services AT MOST ONE device per display_sched_task()
+ * call, round-robin. Worst-case stall per pass therefore stays at a single
+ * panel flush regardless of how many displays are registered.
+ *
+ * The primary panel is driven by the existing draw paths marking regions
+ * dirty; secondary panels mirror the framebuffer scenic region and are
+ * additionally refreshed on a coarse interval (DISPLAY_SCHED_MIRROR_MS) so
+ * they track animations whose region flushes only target the primary.
+ */
+
+#pragma once
+
+#include <qp.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef DISPLAY_SCHED_MAX_DEVICES
+#    define DISPLAY_SCHED_MAX_DEVICES 2
+#endif
+
+// Secondary panels get a full scenic-region refresh at least this often (ms)
+#ifndef DISPLAY_SCHED_MIRROR_MS
+#    define DISPLAY_SCHED_MIRROR_MS 100
+#endif
+
+/**
+ * Register a display with the scheduler
+ * @param device Initialized QP device handle
+ * @param primary true for the panel the draw paths target directly
+ * @return slot index, or -1 if the table is full
+ */
+int8_t display_sched_register(painter_device_t device, bool primary);
+
+/**
+ * Grow every registered device's dirty bounding box to cover the region
+ * (framebuffer coordinates, clamped to the scenic area)
+ */
+void display_sched_mark_dirty_all(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Flag the QP-rendered info area as needing a qp_flush on every device
+ */
+void display_sched_mark_qp_dirty_all(void);
+
+/**
+ * Service the next device with pending work (one device maximum per call).
+ * Call once per display_housekeeping_task() pass.
+ */
+void display_sched_task(void);
@@ -0,0 +1,31 @@
+// Logo drawing from the precomputed span table (graphics/gen_logo_spans.py)
+// Image size: 120x120
+#pragma once
+
+#include "logo_spans.h"
+
+// Generic logo drawing function with color parameters.
+// The old generated code issued one fb_line_hsv() call per horizontal run,
+// redoing the HSV-to-RGB565 conversion each time; here the conversion happens
+// once and the spans stream straight into the framebuffer rows.
+static void draw_amboss_logo(uint16_t x_offset, uint16_t y_offset, uint8_t hue, uint8_t sat, uint8_t val) {
+    fb_color_t color = fb_hsv_to_rgb565(hue, sat, val);
+
+    for (uint16_t i = 0; i < AMBOSS_LOGO_SPAN_COUNT; i++) {
+        const logo_span_t *span = &amboss_logo_spans[i];
+
+        int16_t y = span->y + y_offset;
+        if (y < 0 || y >= FB_HEIGHT) continue;
+
+        int16_t x1 = span->x1 + x_offset;
+        int16_t x2 = span->x2 + x_offset;
+        if (x1 < 0) x1 = 0;
+        if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+        if (x1 > x2) continue;
+
+        fb_color_t *row = &fb.pixels[y][x1];
+        for (int16_t x = x1; x <= x2; x++) {
+            *row++ = color;
+        }
+    }
+}
@@ -0,0 +1,916 @@
+/*
+ * Framebuffer Implementation for chocmanyl36
+ */
+
+#include "framebuffer.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+#    include "hardware/structs/sio.h" // sio_hw->cpuid: which core a flush call runs on
+
+// Deferred flush capture: while a capture is active, flush calls issued from
+// core 1 record their target region here instead of streaming it - the SPI
+// panel (and its ChibiOS driver state) belongs to core 0. Core 0 commits the
+// merged region once the core-1 draw completes. Flush calls from core 0 pass
+// through a capture untouched.
+static bool    fb_defer_active     = false;
+static bool    fb_defer_fullscreen = false;
+static bool    fb_defer_have_rect  = false;
+static int16_t fb_defer_x1, fb_defer_y1, fb_defer_x2, fb_defer_y2;
+
+// Returns true when the flush was absorbed into the capture (caller returns without touching the panel)
+static bool fb_defer_capture(int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool fullscreen) {
+    if (!fb_defer_active || sio_hw->cpuid != 1) {
+        return false;
+    }
+    if (fullscreen) {
+        fb_defer_fullscreen = true;
+    } else if (!fb_defer_have_rect) {
+        fb_defer_x1        = x1;
+        fb_defer_y1        = y1;
+        fb_defer_x2        = x2;
+        fb_defer_y2        = y2;
+        fb_defer_have_rect = true;
+    } else {
+        // Merge into one bounding rect; a draw rarely flushes more than once
+        if (x1 < fb_defer_x1) fb_defer_x1 = x1;
+        if (y1 < fb_defer_y1) fb_defer_y1 = y1;
+        if (x2 > fb_defer_x2) fb_defer_x2 = x2;
+        if (y2 > fb_defer_y2) fb_defer_y2 = y2;
+    }
+    return true;
+}
+
+void fb_flush_defer_begin(void) {
+    fb_defer_fullscreen = false;
+    fb_defer_have_rect  = false;
+    fb_defer_active     = true;
+}
+
+void fb_flush_defer_cancel(void) {
+    fb_defer_active = false;
+}
+
+bool fb_flush_defer_commit(painter_device_t display) {
+    fb_defer_active = false;
+    if (fb_defer_fullscreen) {
+        fb_flush_fullscreen(display);
+        return true;
+    }
+    if (fb_defer_have_rect) {
+        fb_flush_region(display, fb_defer_x1, fb_defer_y1, fb_defer_x2, fb_defer_y2);
+        return true;
+    }
+    return false;
+}
+#else
+// Single-core builds: flushes always go straight to the panel
+#    define fb_defer_capture(x1, y1, x2, y2, fullscreen) false
+#endif
+#ifdef CPU_PROFILER_ENABLE
+#    include "cpu_profiler.h"
+#endif
+
+// Global framebuffer instance
+framebuffer_t fb;
+
+#ifndef FB_COMPRESSED_BACKGROUND
+// Background buffer for storing original scene (without animated elements)
+framebuffer_t fb_background;
+#else
+// Row-RLE compressed background shadow (see framebuffer.h). Each row is a sequence
+// of (run length, RGB565 color) runs; fb_bg_row_offset[] gives random access to any
+// row so region restores only decode the rows they touch.
+#if FB_BG_RLE_BUFFER_SIZE > 65535
+#error "FB_BG_RLE_BUFFER_SIZE must fit in the 16-bit row offset table"
+#endif
+static uint8_t  fb_bg_rle[FB_BG_RLE_BUFFER_SIZE];
+static uint16_t fb_bg_row_offset[FB_HEIGHT];
+static bool     fb_bg_valid = false;
+#endif
+
+// Crossfade state. While a fade is in flight the background shadow holds the
+// OUTGOING scene and fb holds the incoming one, so fb_save_to_background() must
+// be deferred until the fade completes - otherwise scene code re-saving the
+// background mid-fade would clobber the old scene with the new one.
+static bool     fb_crossfade_in_progress  = false;
+static bool     fb_crossfade_save_pending = false;
+static bool     fb_crossfade_hold         = false;
+static uint32_t fb_crossfade_timer        = 0;
+static uint16_t fb_crossfade_duration     = 0;
+
+// ============================================================================
+// Helper Functions
+// ============================================================================
+
+// Min/max macros (guard against redefinition)
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef ABS
+#define ABS(x) ((x) < 0 ? -(x) : (x))
+#endif
+
+// Swap two integers
+static inline void swap_int16(int16_t *a, int16_t *b) {
+    int16_t temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// ============================================================================
+// Color Conversion Functions
+// ============================================================================
+
+fb_color_t fb_hsv_to_rgb565(uint8_t hue, uint8_t sat, uint8_t val) {
+    // Convert HSV to RGB888 using QMK's algorithm
+    uint8_t  r, g, b;
+    uint16_t h, s, v;
+
+    if (sat == 0) {
+        // Grayscale
+        r = g = b = val;
+    } else {
+        h = hue;
+        s = sat;
+        v = val;
+
+        uint8_t region    = h * 6 / 255;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+
+        uint8_t p = (v * (255 - s)) >> 8;
+        uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+        switch (region) {
+            case 6:
+            case 0:
+                r = v; g = t; b = p;
+                break;
+            case 1:
+                r = q; g = v; b = p;
+                break;
+            case 2:
+                r = p; g = v; b = t;
+                break;
+            case 3:
+                r = p; g = q; b = v;
+                break;
+            case 4:
+                r = t; g = p; b = v;
+                break;
+            default:
+                r = v; g = p; b = q;
+                break;
+        }
+    }
+
+    // Convert RGB888 to RGB565 and byte swap for ST7789
+    return fb_rgb888_to_rgb565(r, g, b);
+}
+
+fb_color_t fb_rgb888_to_rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    // RGB565: RRRRRGGGGGGBBBBB
+    uint16_t rgb565 = (((uint16_t)r) >> 3) << 11 | (((uint16_t)g) >> 2) << 5 | (((uint16_t)b) >> 3);
+    // ST7789 requires byte-swapped RGB565
+    return __builtin_bswap16(rgb565);
+}
+
+void fb_rgb565_to_rgb888(fb_color_t color, uint8_t *r, uint8_t *g, uint8_t *b) {
+    // ST7789 stores byte-swapped RGB565, so swap back first
+    uint16_t rgb565 = __builtin_bswap16(color);
+
+    // Extract 5-bit red, 6-bit green, 5-bit blue
+    uint8_t r5 = (rgb565 >> 11) & 0x1F;
+    uint8_t g6 = (rgb565 >> 5) & 0x3F;
+    uint8_t b5 = rgb565 & 0x1F;
+
+    // Convert to 8-bit by scaling up and adding precision
+    // For 5-bit: (value << 3) | (value >> 2) gives better distribution
+    // For 6-bit: (value << 2) | (value >> 4) gives better distribution
+    *r = (r5 << 3) | (r5 >> 2);
+    *g = (g6 << 2) | (g6 >> 4);
+    *b = (b5 << 3) | (b5 >> 2);
+}
+
+void fb_rgb565_to_hsv(fb_color_t color, uint8_t *h, uint8_t *s, uint8_t *v) {
+    // First convert to RGB888
+    uint8_t r, g, b;
+    fb_rgb565_to_rgb888(color, &r, &g, &b);
+
+    // Find min and max RGB values
+    uint8_t rgb_min = MIN(MIN(r, g), b);
+    uint8_t rgb_max = MAX(MAX(r, g), b);
+
+    // Value is the max
+    *v = rgb_max;
+
+    if (rgb_max == 0) {
+        // Black - hue and saturation are undefined, set to 0
+        *h = 0;
+        *s = 0;
+        return;
+    }
+
+    // Saturation
+    *s = (uint16_t)(255 * (rgb_max - rgb_min)) / rgb_max;
+
+    if (*s == 0) {
+        // Grayscale - hue is undefined, set to 0
+        *h = 0;
+        return;
+    }
+
+    // Hue
+    uint8_t delta = rgb_max - rgb_min;
+    int16_t hue;
+
+    if (rgb_max == r) {
+        // Between yellow and magenta
+        hue = 0 + 43 * (g - b) / delta;
+    } else if (rgb_max == g) {
+        // Between cyan and yellow
+        hue = 85 + 43 * (b - r) / delta;
+    } else {
+        // Between magenta and cyan
+        hue = 171 + 43 * (r - g) / delta;
+    }
+
+    // Normalize to 0-255
+    if (hue < 0) hue += 256;
+    *h = (uint8_t)hue;
+}
+
+// ============================================================================
+// Core Framebuffer Functions
+// ============================================================================
+
+void fb_init(void) {
+    fb_clear(FB_COLOR_BLACK);
+}
+
+void fb_clear(fb_color_t color) {
+    for (uint16_t y = 0; y < FB_HEIGHT; y++) {
+        for (uint16_t x = 0; x < FB_WIDTH; x++) {
+            fb.pixels[y][x] = color;
+        }
+    }
+}
+
+void fb_scroll_down(uint16_t rows, fb_color_t fill) {
+    if (rows == 0) return;
+    if (rows > FB_HEIGHT) rows = FB_HEIGHT;
+
+    // Overlapping move towards higher rows; memmove copies backwards as needed
+    memmove(fb.pixels[rows], fb.pixels[0], (size_t)(FB_HEIGHT - rows) * FB_WIDTH * sizeof(fb_color_t));
+
+    for (uint16_t y = 0; y < rows; y++) {
+        for (uint16_t x = 0; x < FB_WIDTH; x++) {
+            fb.pixels[y][x] = fill;
+        }
+    }
+}
+
+void fb_flush(painter_device_t display) {
+    if (fb_defer_capture(0, 0, FB_WIDTH - 1, FB_SPLIT_Y - 1, false)) {
+        return;
+    }
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
+    // Set viewport to framebuffer area (upper region only, y=0 to FB_SPLIT_Y-1)
+    // This ensures we don't overwrite the QP-rendered lower region (date, time, media, volume)
+    qp_viewport(display, 0, 0, FB_WIDTH - 1, FB_SPLIT_Y - 1);
+
+    // Rows are contiguous in fb.pixels and stored panel-native (byte-swapped
+    // RGB565, see fb_rgb888_to_rgb565), so the whole region goes out as one
+    // untransformed stream instead of one qp_pixdata call per row
+    qp_pixdata(display, fb.pixels[0], (uint32_t)FB_WIDTH * FB_SPLIT_Y);
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_DISPLAY_FLUSH, probe_start);
+#endif
+}
+
+void fb_flush_region(painter_device_t display, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // Clamp to screen bounds and framebuffer area
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_SPLIT_Y) y2 = FB_SPLIT_Y - 1;
+
+    // Bounds check
+    if (x1 > x2 || y1 > y2 || x1 >= FB_WIDTH || y1 >= FB_SPLIT_Y) {
+        return;
+    }
+
+    if (fb_defer_capture(x1, y1, x2, y2, false)) {
+        return;
+    }
+
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
+
+    // Set viewport to the specific region
+    qp_viewport(display, x1, y1, x2, y2);
+
+    // Calculate region width
+    uint16_t width = x2 - x1 + 1;
+
+    if (width == FB_WIDTH) {
+        // Full-width region: the rows are contiguous in fb.pixels, stream them
+        // as a single untransformed block
+        qp_pixdata(display, fb.pixels[y1], (uint32_t)FB_WIDTH * (y2 - y1 + 1));
+    } else {
+        // Stream pixel data row by row for this region only
+        for (int16_t y = y1; y <= y2; y++) {
+            qp_pixdata(display, &fb.pixels[y][x1], width);
+        }
+    }
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_DISPLAY_FLUSH, probe_start);
+#endif
+}
+
+void fb_flush_fullscreen(painter_device_t display) {
+    if (fb_defer_capture(0, 0, FB_WIDTH - 1, FB_HEIGHT - 1, true)) {
+        return;
+    }
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
+    // Set viewport to entire screen (no FB_SPLIT_Y restriction)
+    qp_viewport(display, 0, 0, FB_WIDTH - 1, FB_HEIGHT - 1);
+
+    // Entire framebuffer in one untransformed stream (rows are contiguous)
+    qp_pixdata(display, fb.pixels[0], (uint32_t)FB_WIDTH * FB_HEIGHT);
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_DISPLAY_FLUSH, probe_start);
+#endif
+}
+
+#ifndef FB_COMPRESSED_BACKGROUND
+
+void fb_save_to_background(void) {
+    // Shadow holds the outgoing scene of an in-flight crossfade; the save runs
+    // when the fade completes (see fb_crossfade_flush)
+    if (fb_crossfade_in_progress) {
+        fb_crossfade_save_pending = true;
+        return;
+    }
+
+    // Copy entire framebuffer to background buffer
+    memcpy(fb_background.pixels, fb.pixels, sizeof(fb.pixels));
+}
+
+// Fetch one background row for the crossfade blend
+static void fb_background_row(uint16_t y, fb_color_t *row) {
+    memcpy(row, fb_background.pixels[y], sizeof(fb_background.pixels[0]));
+}
+
+// Uncompressed shadow is always addressable
+static bool fb_background_available(void) {
+    return true;
+}
+
+void fb_restore_from_background(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // Clamp to screen bounds
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_HEIGHT) y2 = FB_HEIGHT - 1;
+
+    // Bounds check
+    if (x1 > x2 || y1 > y2 || x1 >= FB_WIDTH || y1 >= FB_HEIGHT) {
+        return;
+    }
+
+    // Restore pixels from background buffer
+    for (int16_t y = y1; y <= y2; y++) {
+        for (int16_t x = x1; x <= x2; x++) {
+            fb.pixels[y][x] = fb_background.pixels[y][x];
+        }
+    }
+}
+
+#else // FB_COMPRESSED_BACKGROUND
+
+void fb_save_to_background(void) {
+    // Shadow holds the outgoing scene of an in-flight crossfade; the save runs
+    // when the fade completes (see fb_crossfade_flush)
+    if (fb_crossfade_in_progress) {
+        fb_crossfade_save_pending = true;
+        return;
+    }
+
+    // Encode each row as (run length, color) runs. Scene backgrounds are mostly flat
+    // fills, so this is a single pass over the framebuffer with no lookback.
+    uint32_t pos = 0;
+    for (uint16_t y = 0; y < FB_HEIGHT; y++) {
+        fb_bg_row_offset[y] = (uint16_t)pos;
+
+        uint16_t x = 0;
+        while (x < FB_WIDTH) {
+            fb_color_t color = fb.pixels[y][x];
+            uint16_t   run   = 1;
+            while (x + run < FB_WIDTH && run < 255 && fb.pixels[y][x + run] == color) {
+                run++;
+            }
+
+            if (pos + 3 > FB_BG_RLE_BUFFER_SIZE) {
+                // Arena overflow (very noisy content) - drop the shadow entirely.
+                // Restores become no-ops until the next full scene save recovers.
+                fb_bg_valid = false;
+                return;
+            }
+
+            fb_bg_rle[pos++] = (uint8_t)run;
+            fb_bg_rle[pos++] = (uint8_t)(color & 0xFF);
+            fb_bg_rle[pos++] = (uint8_t)(color >> 8);
+            x += run;
+        }
+    }
+    fb_bg_valid = true;
+}
+
+void fb_restore_from_background(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // No shadow available (never saved, or the last save overflowed the arena)
+    if (!fb_bg_valid) {
+        return;
+    }
+
+    // Clamp to screen bounds
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_HEIGHT) y2 = FB_HEIGHT - 1;
+
+    // Bounds check
+    if (x1 > x2 || y1 > y2 || x1 >= FB_WIDTH || y1 >= FB_HEIGHT) {
+        return;
+    }
+
+    // Decode only the rows the region touches, walking each row's runs and copying
+    // the slice that overlaps [x1, x2]
+    for (int16_t y = y1; y <= y2; y++) {
+        uint32_t pos = fb_bg_row_offset[y];
+        int16_t  x   = 0;
+        while (x < FB_WIDTH) {
+            uint8_t    run   = fb_bg_rle[pos++];
+            fb_color_t color = (fb_color_t)fb_bg_rle[pos] | ((fb_color_t)fb_bg_rle[pos + 1] << 8);
+            pos += 2;
+
+            int16_t run_end = x + run - 1; // inclusive
+            if (run_end >= x1) {
+                int16_t from = MAX(x, x1);
+                int16_t to   = MIN(run_end, x2);
+                for (int16_t px = from; px <= to; px++) {
+                    fb.pixels[y][px] = color;
+                }
+            }
+
+            x += run;
+            if (x > x2) {
+                break; // Past the right edge of the region, rest of the row is untouched
+            }
+        }
+    }
+}
+
+// Decode one background row from the RLE arena for the crossfade blend
+static void fb_background_row(uint16_t y, fb_color_t *row) {
+    uint32_t pos = fb_bg_row_offset[y];
+    uint16_t x   = 0;
+    while (x < FB_WIDTH) {
+        uint8_t    run   = fb_bg_rle[pos++];
+        fb_color_t color = (fb_color_t)fb_bg_rle[pos] | ((fb_color_t)fb_bg_rle[pos + 1] << 8);
+        pos += 2;
+        while (run-- && x < FB_WIDTH) {
+            row[x++] = color;
+        }
+    }
+}
+
+static bool fb_background_available(void) {
+    return fb_bg_valid;
+}
+
+#endif // FB_COMPRESSED_BACKGROUND
+
+// ============================================================================
+// Crossfade Flush
+// ============================================================================
+
+// Blend two byte-swapped RGB565 colors; alpha runs 0 (all `from`) to 32 (all `to`).
+// Spreading the three 565 fields across one 32-bit word (green in the high half,
+// red/blue in the low half) blends all channels with two multiplies instead of six.
+static inline fb_color_t fb_blend_rgb565(fb_color_t from, fb_color_t to, uint8_t alpha) {
+    uint16_t f = __builtin_bswap16(from);
+    uint16_t t = __builtin_bswap16(to);
+
+    uint32_t fs = ((uint32_t)f | ((uint32_t)f << 16)) & 0x07E0F81F;
+    uint32_t ts = ((uint32_t)t | ((uint32_t)t << 16)) & 0x07E0F81F;
+
+    uint32_t blended = ((fs * (32 - alpha) + ts * alpha) >> 5) & 0x07E0F81F;
+
+    uint16_t out = (uint16_t)(blended | (blended >> 16));
+    return __builtin_bswap16(out);
+}
+
+void fb_crossfade_begin(uint16_t duration_ms) {
+    // Let the snapshot of the outgoing scene through even if a previous fade is
+    // still marked active (back-to-back weather changes restart the fade)
+    fb_crossfade_in_progress = false;
+    fb_save_to_background();
+
+    fb_crossfade_in_progress  = true;
+    fb_crossfade_save_pending = false;
+    fb_crossfade_hold         = false;
+    fb_crossfade_timer        = timer_read32();
+    fb_crossfade_duration     = duration_ms;
+}
+
+bool fb_crossfade_active(void) {
+    return fb_crossfade_in_progress;
+}
+
+void fb_crossfade_begin_held(uint16_t duration_ms) {
+    fb_crossfade_begin(duration_ms);
+    fb_crossfade_hold = true;
+}
+
+void fb_crossfade_release(void) {
+    if (fb_crossfade_in_progress && fb_crossfade_hold) {
+        fb_crossfade_hold  = false;
+        fb_crossfade_timer = timer_read32(); // fade duration is measured from release
+    }
+}
+
+bool fb_crossfade_held_active(void) {
+    return fb_crossfade_in_progress && fb_crossfade_hold;
+}
+
+bool fb_crossfade_flush(painter_device_t display) {
+    if (!fb_crossfade_in_progress) {
+        return false;
+    }
+
+    // A held fade is pinned at alpha 0 and the panel already shows the outgoing
+    // scene, so there is nothing to stream until release
+    if (fb_crossfade_hold) {
+        return true;
+    }
+
+    uint32_t elapsed = timer_elapsed32(fb_crossfade_timer);
+    if (elapsed >= fb_crossfade_duration || !fb_background_available()) {
+        // Fade complete (or the outgoing-scene snapshot overflowed the RLE arena,
+        // in which case we cut straight to the new scene). Run the save that scene
+        // code attempted mid-fade so the shadow now holds the incoming scene.
+        fb_crossfade_in_progress = false;
+        if (fb_crossfade_save_pending) {
+            fb_crossfade_save_pending = false;
+            fb_save_to_background();
+        }
+        fb_flush(display);
+        return true;
+    }
+
+#ifdef CPU_PROFILER_ENABLE
+    uint32_t probe_start = cpu_profiler_timestamp();
+#endif
+    uint8_t alpha = (uint8_t)((elapsed * 32) / fb_crossfade_duration);
+
+    qp_viewport(display, 0, 0, FB_WIDTH - 1, FB_SPLIT_Y - 1);
+
+    // Blend row by row into a scratch buffer so neither the framebuffer (incoming
+    // scene) nor the shadow (outgoing scene) is modified
+    fb_color_t row[FB_WIDTH];
+    for (uint16_t y = 0; y < FB_SPLIT_Y; y++) {
+        fb_background_row(y, row);
+        for (uint16_t x = 0; x < FB_WIDTH; x++) {
+            row[x] = fb_blend_rgb565(row[x], fb.pixels[y][x], alpha);
+        }
+        qp_pixdata(display, row, FB_WIDTH);
+    }
+#ifdef CPU_PROFILER_ENABLE
+    cpu_profiler_record(CPU_PROBE_DISPLAY_FLUSH, probe_start);
+#endif
+    return true;
+}
+
+// ============================================================================
+// Foreground Overlay Layer
+// ============================================================================
+// A single rectangular foreground layer over the composed scene. begin()
+// snapshots the covered framebuffer pixels into a small scratch buffer, the
+// caller draws the overlay content, and end() blits the snapshot back and
+// flushes just that region - the scene underneath is never re-rendered to
+// dismiss the overlay. Full layer buffers are out of reach here (a second
+// 64 KB plane per layer does not fit next to fb and the background shadow),
+// but overlays are small, so one bounded scratch region covers the case
+// where dismissing a foreground element used to force a whole-scene redraw.
+
+static fb_color_t overlay_saved[FB_OVERLAY_MAX_PIXELS];
+static int16_t    overlay_x1, overlay_y1, overlay_x2, overlay_y2;
+static bool       overlay_in_progress = false;
+
+bool fb_overlay_begin(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // Re-begin over an active overlay keeps the original snapshot: the covered
+    // framebuffer pixels already belong to the overlay, not the scene
+    if (overlay_in_progress) {
+        return true;
+    }
+
+    // Clamp to screen bounds
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_HEIGHT) y2 = FB_HEIGHT - 1;
+    if (x1 > x2 || y1 > y2) {
+        return false;
+    }
+
+    uint32_t pixels = (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+    if (pixels > FB_OVERLAY_MAX_PIXELS) {
+        return false; // Region exceeds the scratch buffer; caller falls back to a full redraw
+    }
+
+    uint32_t pos = 0;
+    for (int16_t y = y1; y <= y2; y++) {
+        memcpy(&overlay_saved[pos], &fb.pixels[y][x1], (size_t)(x2 - x1 + 1) * sizeof(fb_color_t));
+        pos += x2 - x1 + 1;
+    }
+
+    overlay_x1          = x1;
+    overlay_y1          = y1;
+    overlay_x2          = x2;
+    overlay_y2          = y2;
+    overlay_in_progress = true;
+    return true;
+}
+
+bool fb_overlay_active(void) {
+    return overlay_in_progress;
+}
+
+void fb_overlay_cancel(void) {
+    overlay_in_progress = false;
+}
+
+void fb_overlay_end(painter_device_t display) {
+    if (!overlay_in_progress) {
+        return;
+    }
+    overlay_in_progress = false;
+
+    uint32_t pos = 0;
+    for (int16_t y = overlay_y1; y <= overlay_y2; y++) {
+        memcpy(&fb.pixels[y][overlay_x1], &overlay_saved[pos], (size_t)(overlay_x2 - overlay_x1 + 1) * sizeof(fb_color_t));
+        pos += overlay_x2 - overlay_x1 + 1;
+    }
+
+    fb_flush_region(display, overlay_x1, overlay_y1, overlay_x2, overlay_y2);
+}
+
+// ============================================================================
+// Drawing Primitives - Pixel
+// ============================================================================
+
+void fb_set_pixel(int16_t x, int16_t y, fb_color_t color) {
+    // Bounds checking
+    if (x < 0 || x >= FB_WIDTH || y < 0 || y >= FB_HEIGHT) {
+        return;
+    }
+
+    fb.pixels[y][x] = color;
+}
+
+void fb_set_pixel_hsv(int16_t x, int16_t y, uint8_t hue, uint8_t sat, uint8_t val) {
+    fb_set_pixel(x, y, fb_hsv_to_rgb565(hue, sat, val));
+}
+
+fb_color_t fb_get_pixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= FB_WIDTH || y < 0 || y >= FB_HEIGHT) {
+        return 0;
+    }
+    return fb.pixels[y][x];
+}
+
+bool fb_get_pixel_rgb(int16_t x, int16_t y, uint8_t *r, uint8_t *g, uint8_t *b) {
+    if (x < 0 || x >= FB_WIDTH || y < 0 || y >= FB_HEIGHT) {
+        *r = 0;
+        *g = 0;
+        *b = 0;
+        return false;
+    }
+    fb_rgb565_to_rgb888(fb.pixels[y][x], r, g, b);
+    return true;
+}
+
+bool fb_get_pixel_hsv(int16_t x, int16_t y, uint8_t *h, uint8_t *s, uint8_t *v) {
+    if (x < 0 || x >= FB_WIDTH || y < 0 || y >= FB_HEIGHT) {
+        *h = 0;
+        *s = 0;
+        *v = 0;
+        return false;
+    }
+    fb_rgb565_to_hsv(fb.pixels[y][x], h, s, v);
+    return true;
+}
+
+// ============================================================================
+// Drawing Primitives - Line
+// ============================================================================
+
+void fb_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, fb_color_t color) {
+    // Bresenham's line algorithm
+    int16_t dx = ABS(x2 - x1);
+    int16_t dy = -ABS(y2 - y1);
+    int16_t sx = x1 < x2 ? 1 : -1;
+    int16_t sy = y1 < y2 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (true) {
+        fb_set_pixel(x1, y1, color);
+
+        if (x1 == x2 && y1 == y2) break;
+
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+void fb_line_hsv(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t hue, uint8_t sat, uint8_t val) {
+    fb_line(x1, y1, x2, y2, fb_hsv_to_rgb565(hue, sat, val));
+}
+
+// ============================================================================
+// Drawing Primitives - Rectangle
+// ============================================================================
+
+void fb_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, fb_color_t color, bool filled) {
+    // Ensure x1 <= x2 and y1 <= y2
+    if (x1 > x2) swap_int16(&x1, &x2);
+    if (y1 > y2) swap_int16(&y1, &y2);
+
+    // Clamp to screen bounds
+    x1 = MAX(x1, 0);
+    y1 = MAX(y1, 0);
+    x2 = MIN(x2, FB_WIDTH - 1);
+    y2 = MIN(y2, FB_HEIGHT - 1);
+
+    if (filled) {
+        // Fill rectangle
+        for (int16_t y = y1; y <= y2; y++) {
+            for (int16_t x = x1; x <= x2; x++) {
+                fb.pixels[y][x] = color;
+            }
+        }
+    } else {
+        // Draw outline
+        // Top and bottom edges
+        for (int16_t x = x1; x <= x2; x++) {
+            fb.pixels[y1][x] = color;
+            fb.pixels[y2][x] = color;
+        }
+        // Left and right edges
+        for (int16_t y = y1; y <= y2; y++) {
+            fb.pixels[y][x1] = color;
+            fb.pixels[y][x2] = color;
+        }
+    }
+}
+
+void fb_rect_hsv(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    fb_rect(x1, y1, x2, y2, fb_hsv_to_rgb565(hue, sat, val), filled);
+}
+
+// ============================================================================
+// Drawing Primitives - Circle
+// ============================================================================
+
+void fb_circle(int16_t x0, int16_t y0, uint16_t radius, fb_color_t color, bool filled) {
+    // Midpoint circle algorithm
+    int16_t x = radius;
+    int16_t y = 0;
+    int16_t err = 0;
+
+    while (x >= y) {
+        if (filled) {
+            // Draw horizontal lines for filled circle
+            fb_line(x0 - x, y0 + y, x0 + x, y0 + y, color);
+            fb_line(x0 - x, y0 - y, x0 + x, y0 - y, color);
+            fb_line(x0 - y, y0 + x, x0 + y, y0 + x, color);
+            fb_line(x0 - y, y0 - x, x0 + y, y0 - x, color);
+        } else {
+            // Draw outline points (8-way symmetry)
+            fb_set_pixel(x0 + x, y0 + y, color);
+            fb_set_pixel(x0 + y, y0 + x, color);
+            fb_set_pixel(x0 - y, y0 + x, color);
+            fb_set_pixel(x0 - x, y0 + y, color);
+            fb_set_pixel(x0 - x, y0 - y, color);
+            fb_set_pixel(x0 - y, y0 - x, color);
+            fb_set_pixel(x0 + y, y0 - x, color);
+            fb_set_pixel(x0 + x, y0 - y, color);
+        }
+
+        if (err <= 0) {
+            y += 1;
+            err += 2 * y + 1;
+        }
+        if (err > 0) {
+            x -= 1;
+            err -= 2 * x + 1;
+        }
+    }
+}
+
+void fb_circle_hsv(int16_t x, int16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    fb_circle(x, y, radius, fb_hsv_to_rgb565(hue, sat, val), filled);
+}
+
+// ============================================================================
+// Drawing Primitives - Ellipse
+// ============================================================================
+
+void fb_ellipse(int16_t x0, int16_t y0, uint16_t rx, uint16_t ry, fb_color_t color, bool filled) {
+    // Bresenham's ellipse algorithm
+    int16_t x = 0;
+    int16_t y = ry;
+
+    // Initial decision parameters
+    int32_t rx_sq = rx * rx;
+    int32_t ry_sq = ry * ry;
+    int32_t two_rx_sq = 2 * rx_sq;
+    int32_t two_ry_sq = 2 * ry_sq;
+    int32_t p;
+    int32_t px = 0;
+    int32_t py = two_rx_sq * y;
+
+    // Region 1
+    p = ry_sq - (rx_sq * ry) + (rx_sq / 4);
+
+    while (px < py) {
+        x++;
+        px += two_ry_sq;
+
+        if (p < 0) {
+            p += ry_sq + px;
+        } else {
+            y--;
+            py -= two_rx_sq;
+            p += ry_sq + px - py;
+        }
+
+        if (filled) {
+            fb_line(x0 - x, y0 + y, x0 + x, y0 + y, color);
+            fb_line(x0 - x, y0 - y, x0 + x, y0 - y, color);
+        } else {
+            fb_set_pixel(x0 + x, y0 + y, color);
+            fb_set_pixel(x0 - x, y0 + y, color);
+            fb_set_pixel(x0 + x, y0 - y, color);
+            fb_set_pixel(x0 - x, y0 - y, color);
+        }
+    }
+
+    // Region 2
+    p = ry_sq * (x + 1) * (x + 1) + rx_sq * (y - 1) * (y - 1) - rx_sq * ry_sq;
+
+    while (y >= 0) {
+        y--;
+        py -= two_rx_sq;
+
+        if (p > 0) {
+            p += rx_sq - py;
+        } else {
+            x++;
+            px += two_ry_sq;
+            p += rx_sq - py + px;
+        }
+
+        if (filled) {
+            fb_line(x0 - x, y0 + y, x0 + x, y0 + y, color);
+            fb_line(x0 - x, y0 - y, x0 + x, y0 - y, color);
+        } else {
+            fb_set_pixel(x0 + x, y0 + y, color);
+            fb_set_pixel(x0 - x, y0 + y, color);
+            fb_set_pixel(x0 + x, y0 - y, color);
+            fb_set_pixel(x0 - x, y0 - y, color);
+        }
+    }
+}
+
+void fb_ellipse_hsv(int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    fb_ellipse(x, y, rx, ry, fb_hsv_to_rgb565(hue, sat, val), filled);
+}
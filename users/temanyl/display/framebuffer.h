@@ -14,9 +14,14 @@
 #include <string.h>
 #include "qp.h"
 
-// Display dimensions (portrait mode)
-#define FB_WIDTH  135
-#define FB_HEIGHT 240
+// Display dimensions (portrait mode); defaults match the chocmanyl36 panel, a
+// board with a different panel overrides them from its keymap config.h
+#ifndef FB_WIDTH
+#    define FB_WIDTH 135
+#endif
+#ifndef FB_HEIGHT
+#    define FB_HEIGHT 240
+#endif
 
 // Screen split for hybrid rendering
 // Upper region: Framebuffer (logo, scenic animations)
@@ -34,9 +39,21 @@ typedef struct {
 // Global framebuffer instance
 extern framebuffer_t fb;
 
+#ifndef FB_COMPRESSED_BACKGROUND
 // Background buffer for storing original scene (without animated elements)
 // Used for efficient raindrop animation - restore old positions from here
 extern framebuffer_t fb_background;
+#else
+// With FB_COMPRESSED_BACKGROUND defined, the background shadow is stored as row-RLE
+// runs (count + RGB565 color, 3 bytes each) instead of a second 64 KB pixel array.
+// Typical scene content (flat cartoon backgrounds) compresses well under 20 KB.
+// Access stays behind fb_save_to_background()/fb_restore_from_background(); only the
+// storage changes. If a very noisy scene overflows the arena the shadow is marked
+// invalid and restores become no-ops until the next full save.
+#    ifndef FB_BG_RLE_BUFFER_SIZE
+#        define FB_BG_RLE_BUFFER_SIZE 20480
+#    endif
+#endif
 
 // ============================================================================
 // Color Conversion Functions
@@ -93,6 +110,16 @@ void fb_init(void);
  */
 void fb_clear(fb_color_t color);
 
+/**
+ * Scroll the framebuffer contents down by a number of rows
+ * Rows shifted off the bottom are discarded; the exposed rows at the top are
+ * filled with the given color. Used for camera scrolling: static world content
+ * moves in one block copy instead of being cleared and redrawn
+ * @param rows Number of rows to scroll down (clamped to FB_HEIGHT)
+ * @param fill RGB565 color for the newly exposed top rows
+ */
+void fb_scroll_down(uint16_t rows, fb_color_t fill);
+
 /**
  * Flush the framebuffer to the physical display
  * Renders the entire framebuffer region (y=0 to FB_SPLIT_Y-1)
@@ -120,6 +147,36 @@ void fb_flush_region(painter_device_t display, int16_t x1, int16_t y1, int16_t x
  */
 void fb_flush_fullscreen(painter_device_t display);
 
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+// ============================================================================
+// Deferred Flush (core-1 game drawing)
+// ============================================================================
+// The SPI panel and its ChibiOS driver state belong to core 0, so a draw
+// running on the RP2040's second core must not flush. While a capture is
+// active, flush calls issued from core 1 record their target region instead of
+// streaming it; core 0 commits the merged region once the draw completes.
+// Flush calls from core 0 pass through a capture untouched.
+
+/**
+ * Begin capturing core-1 flush calls
+ * Call on core 0 before submitting a draw task to the second core
+ */
+void fb_flush_defer_begin(void);
+
+/**
+ * End the capture and perform the recorded flush (fullscreen wins over region)
+ * @param display The QP display device handle
+ * @return true if any pixels were pushed to the panel
+ */
+bool fb_flush_defer_commit(painter_device_t display);
+
+/**
+ * End the capture without flushing
+ * Use when the captured content is being discarded (e.g. game teardown)
+ */
+void fb_flush_defer_cancel(void);
+#endif
+
 /**
  * Save current framebuffer to background buffer
  * Used to preserve the base scene before drawing animated elements
@@ -136,6 +193,101 @@ void fb_save_to_background(void);
  */
 void fb_restore_from_background(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
+// ============================================================================
+// Crossfade Flush
+// ============================================================================
+// Crossfades reuse the two buffers that already exist: the background shadow
+// keeps the outgoing scene while fb holds the incoming one, and each flushed
+// frame is a per-pixel blend of the two streamed straight to the panel. The
+// whole transition costs two scene renders plus cheap blends - no
+// redraw-per-step, and no third pixel buffer.
+
+/**
+ * Start a crossfade. Call while fb still holds the OUTGOING scene: it is
+ * snapshotted into the background shadow, then the caller renders the incoming
+ * scene into fb as usual. While the fade is active, fb_save_to_background()
+ * calls are deferred so the snapshot survives until the fade completes
+ * @param duration_ms Fade length in milliseconds
+ */
+void fb_crossfade_begin(uint16_t duration_ms);
+
+/**
+ * Whether a crossfade is currently in flight
+ */
+bool fb_crossfade_active(void);
+
+/**
+ * Start a crossfade but hold it at alpha 0: the outgoing scene is snapshotted
+ * and the fade clock does not run until fb_crossfade_release(). While held,
+ * fb_crossfade_flush() leaves the panel untouched (it already shows the
+ * outgoing scene), so the incoming scene can be rendered into fb ahead of a
+ * known transition time without anything reaching the display early
+ * @param duration_ms Fade length in milliseconds, measured from release
+ */
+void fb_crossfade_begin_held(uint16_t duration_ms);
+
+/**
+ * Release a held crossfade, starting the fade clock now. No-op when no held
+ * fade is pending
+ */
+void fb_crossfade_release(void);
+
+/**
+ * Whether a held (not yet released) crossfade is pending
+ */
+bool fb_crossfade_held_active(void);
+
+/**
+ * Stream one crossfade frame (shadow blended with fb at the current fade
+ * position) to the display. On completion runs any deferred background save
+ * and flushes the framebuffer normally
+ * @param display The QP display device handle
+ * @return true if the flush was handled (fade active or just completed);
+ *         false if no fade is active and the caller should flush normally
+ */
+bool fb_crossfade_flush(painter_device_t display);
+
+// ============================================================================
+// Foreground Overlay Layer
+// ============================================================================
+// One rectangular foreground layer composited over the scene. The pixels it
+// covers are snapshotted on begin and blitted back on end, so dismissing an
+// overlay costs one region restore + region flush instead of a whole-scene
+// redraw. Bounded scratch storage; regions larger than the buffer are refused
+// and the caller falls back to its full-redraw path.
+
+// Scratch capacity in pixels; sized for the brightness indicator box with margin
+#ifndef FB_OVERLAY_MAX_PIXELS
+#    define FB_OVERLAY_MAX_PIXELS (104 * 44)
+#endif
+
+/**
+ * Snapshot the framebuffer region an overlay is about to cover.
+ * Re-begin while an overlay is active keeps the original snapshot (the
+ * covered pixels already belong to the overlay, not the scene).
+ * @return true if the region was captured (or an overlay is already active);
+ *         false if the clamped region is empty or exceeds the scratch buffer
+ */
+bool fb_overlay_begin(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Whether an overlay snapshot is currently held
+ */
+bool fb_overlay_active(void);
+
+/**
+ * Drop the snapshot without restoring it. Call when the scene underneath is
+ * being fully redrawn anyway, so a stale restore cannot clobber it
+ */
+void fb_overlay_cancel(void);
+
+/**
+ * Restore the snapshotted region into the framebuffer and flush just that
+ * region to the display, dismissing the overlay
+ * @param display The QP display device handle
+ */
+void fb_overlay_end(painter_device_t display);
+
 // ============================================================================
 // Drawing Primitives
 // ============================================================================
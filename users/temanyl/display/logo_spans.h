@@ -0,0 +1,117 @@
+// Auto-generated by graphics/gen_logo_spans.py - do not edit by hand
+// 101 horizontal spans, packed as y, x1, x2 (inclusive)
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t y;
+    uint8_t x1;
+    uint8_t x2;
+} logo_span_t;
+
+#define AMBOSS_LOGO_SPAN_COUNT 101
+
+static const logo_span_t amboss_logo_spans[AMBOSS_LOGO_SPAN_COUNT] = {
+    {40, 59, 60},
+    {41, 59, 61},
+    {42, 58, 61},
+    {43, 57, 61},
+    {44, 57, 60},
+    {45, 56, 60},
+    {45, 62, 63},
+    {46, 56, 59},
+    {46, 62, 63},
+    {47, 55, 58},
+    {47, 61, 64},
+    {48, 55, 58},
+    {48, 61, 64},
+    {49, 54, 57},
+    {49, 60, 65},
+    {50, 54, 57},
+    {50, 60, 65},
+    {51, 53, 56},
+    {51, 59, 66},
+    {52, 53, 56},
+    {52, 59, 67},
+    {53, 52, 55},
+    {53, 58, 61},
+    {53, 64, 67},
+    {54, 51, 55},
+    {54, 57, 61},
+    {54, 64, 68},
+    {55, 51, 54},
+    {55, 57, 60},
+    {55, 65, 68},
+    {56, 50, 54},
+    {56, 56, 60},
+    {56, 62, 63},
+    {56, 65, 69},
+    {57, 50, 53},
+    {57, 56, 59},
+    {57, 62, 63},
+    {57, 66, 69},
+    {58, 49, 52},
+    {58, 55, 58},
+    {58, 61, 64},
+    {58, 67, 70},
+    {59, 49, 52},
+    {59, 55, 58},
+    {59, 61, 64},
+    {59, 67, 70},
+    {60, 48, 51},
+    {60, 54, 57},
+    {60, 62, 65},
+    {60, 68, 71},
+    {61, 48, 51},
+    {61, 54, 57},
+    {61, 62, 65},
+    {61, 68, 71},
+    {62, 47, 50},
+    {62, 53, 56},
+    {62, 63, 66},
+    {62, 69, 72},
+    {63, 47, 50},
+    {63, 53, 56},
+    {63, 63, 67},
+    {63, 69, 73},
+    {64, 46, 49},
+    {64, 52, 55},
+    {64, 64, 67},
+    {64, 70, 73},
+    {65, 45, 49},
+    {65, 51, 55},
+    {65, 64, 68},
+    {65, 70, 74},
+    {66, 45, 48},
+    {66, 51, 54},
+    {66, 65, 68},
+    {66, 71, 74},
+    {67, 44, 48},
+    {67, 50, 54},
+    {67, 65, 69},
+    {67, 71, 75},
+    {68, 44, 47},
+    {68, 50, 53},
+    {68, 66, 69},
+    {68, 72, 75},
+    {69, 43, 46},
+    {69, 49, 52},
+    {69, 67, 70},
+    {69, 73, 76},
+    {70, 43, 46},
+    {70, 49, 52},
+    {70, 67, 70},
+    {70, 73, 76},
+    {71, 42, 77},
+    {72, 42, 77},
+    {73, 41, 78},
+    {74, 41, 78},
+    {75, 46, 49},
+    {75, 70, 73},
+    {76, 45, 49},
+    {76, 70, 74},
+    {77, 45, 74},
+    {78, 44, 75},
+    {79, 44, 75},
+};
@@ -2,13 +2,17 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "game_doodle.h"
+#include "game_manager.h"
+#include "highscore_store.h"
 #include "display/framebuffer.h"
+#include "sprite_batch.h"
 #include "action.h"
 #include "action_layer.h"
 #include <stdlib.h>
 #include <string.h>
 #include "timer.h"
 #include "raw_hid.h"
+#include "util.h"
 
 // HID message types (0x10-0x13 to avoid conflict with display HID messages)
 #define MSG_SCORE_SUBMIT  0x10
@@ -20,6 +24,50 @@
 game_state_t g_game;
 input_state_t g_input;
 
+// Gameplay keys delivered as queued edges (see game_input_subscribe); name
+// entry and the score screen unsubscribe and take their keys directly
+static const uint16_t doodle_gameplay_keys[] = {KC_LEFT, KC_RIGHT};
+
+// Set when a press edge is drained, cleared after the movement step: a tap
+// shorter than one tick still steers the player for that tick
+static bool left_tapped, right_tapped;
+
+// ============================================================================
+// Fixed-point physics
+// ============================================================================
+// Vertical motion is table-driven: the whole jump arc - launch velocity,
+// gravity integration and the terminal-velocity clamp - is precomputed per
+// tick in Q.4, so the per-frame update is one load and one add instead of
+// branchy arithmetic. Falling from rest (game start, or after the arc entry
+// is reset) enters the same curve at its zero-velocity entry.
+static const int16_t doodle_jump_arc[] = {
+    DOODLE_FP(-12), DOODLE_FP(-11), DOODLE_FP(-10), DOODLE_FP(-9), DOODLE_FP(-8), DOODLE_FP(-7), DOODLE_FP(-6),
+    DOODLE_FP(-5),  DOODLE_FP(-4),  DOODLE_FP(-3),  DOODLE_FP(-2), DOODLE_FP(-1), DOODLE_FP(0),  DOODLE_FP(1),
+    DOODLE_FP(2),   DOODLE_FP(3),   DOODLE_FP(4),   DOODLE_FP(5),  DOODLE_FP(6),  DOODLE_FP(7),  DOODLE_FP(8),
+    DOODLE_FP(9),   DOODLE_FP(10),  DOODLE_FP(11),  DOODLE_FP(12), DOODLE_FP(13), DOODLE_FP(14), DOODLE_FP(15),
+};
+#define DOODLE_ARC_LEN (sizeof(doodle_jump_arc) / sizeof(doodle_jump_arc[0]))
+#define DOODLE_ARC_FALL_INDEX 12  // The zero-velocity entry: start of a fall from rest
+
+// ============================================================================
+// Scroll-based render cache
+// ============================================================================
+// Platforms are static in world space, so instead of clearing and redrawing
+// the scene every frame the camera movement is applied to the framebuffer as a
+// block scroll: existing rows shift down, only the newly exposed strip and the
+// screen-fixed elements (player, score) are repainted
+static bool     doodle_fb_valid = false;
+static int16_t  doodle_prev_camera_y;
+static int16_t  doodle_prev_player_x;
+static int16_t  doodle_prev_player_y;  // Screen-space
+static uint16_t doodle_prev_score;
+
+// Score footprint in the top-left corner: up to 5 digits at scale 5
+#define DOODLE_SCORE_X1 10
+#define DOODLE_SCORE_Y1 10
+#define DOODLE_SCORE_X2 (10 + 5 * (3 * 5 + 2))
+#define DOODLE_SCORE_Y2 (10 + 5 * 5)
+
 // Helper function to generate random number in range
 static int16_t random_range(int16_t min, int16_t max) {
     return min + (rand() % (max - min + 1));
@@ -58,12 +106,16 @@ static void send_name_to_computer(const char *name, uint16_t score) {
 // Initialize the game
 void game_init(void) {
     // Initialize player in the middle of screen, more visible
-    g_game.player.x = GAME_WIDTH / 2;
-    g_game.player.y = GAME_HEIGHT - 50;  // Start higher for better visibility
+    g_game.player.x = DOODLE_FP(GAME_WIDTH / 2);
+    g_game.player.y = DOODLE_FP(GAME_HEIGHT - 50);  // Start higher for better visibility
     g_game.player.vx = 0;
     g_game.player.vy = 0;
+    g_game.player.arc_index = DOODLE_ARC_FALL_INDEX;
     g_game.player.on_platform = false;
 
+    // Restarts come from the score screen: force a full repaint
+    doodle_fb_valid = false;
+
     // Initialize camera
     g_game.camera_y = 0;
     g_game.score = 0;
@@ -102,16 +154,29 @@ void game_init(void) {
     // Initialize input
     g_input.left = false;
     g_input.right = false;
-    g_input.up = false;
-    g_input.down = false;
+    left_tapped = false;
+    right_tapped = false;
+
+    // Gameplay keys arrive as queued edges from here on
+    game_input_subscribe(doodle_gameplay_keys, ARRAY_SIZE(doodle_gameplay_keys));
 }
 
-// Set input state
-void game_set_input(bool left, bool right, bool up, bool down) {
-    g_input.left = left;
-    g_input.right = right;
-    g_input.up = up;
-    g_input.down = down;
+// Drain key edges queued since the last tick into the held-key flags. The tap
+// latches remember a press even if its release arrived in the same batch
+static void game_drain_input(void) {
+    game_input_event_t event;
+    while (game_input_next(&event)) {
+        switch (event.keycode) {
+            case KC_LEFT:
+                g_input.left = event.pressed;
+                if (event.pressed) left_tapped = true;
+                break;
+            case KC_RIGHT:
+                g_input.right = event.pressed;
+                if (event.pressed) right_tapped = true;
+                break;
+        }
+    }
 }
 
 // Check collision between player and platform
@@ -141,6 +206,79 @@ static bool check_collision(int16_t px, int16_t py, platform_t *platform) {
     return false;
 }
 
+// ============================================================================
+// Collision broadphase
+// ============================================================================
+// Platforms are bucketed by world-space Y band so the landing check only looks
+// at the band under the player's feet instead of scanning every platform.
+// Bands ring-wrap (power-of-two count, masked), so arbitrary world coordinates
+// stay in range as camera_y goes negative while climbing; aliased platforms
+// from a wrapped band are rejected by check_collision()'s exact test.
+#define BROADPHASE_BAND_SHIFT 5  // 32px bands: taller than a platform plus the 4px landing window
+#define BROADPHASE_ROWS 8        // Power of two so bands wrap with a mask
+#define BROADPHASE_BUCKET_CAP 4
+
+static uint8_t broadphase_bucket[BROADPHASE_ROWS][BROADPHASE_BUCKET_CAP];
+static uint8_t broadphase_count[BROADPHASE_ROWS];
+static bool    broadphase_overflow;  // A bucket filled up: fall back to the full scan
+
+static uint8_t broadphase_row(int16_t world_y) {
+    // Arithmetic shift keeps negative world coordinates in consistent bands
+    return (uint8_t)((world_y >> BROADPHASE_BAND_SHIFT) & (BROADPHASE_ROWS - 1));
+}
+
+static void broadphase_insert(uint8_t row, uint8_t index) {
+    if (broadphase_count[row] >= BROADPHASE_BUCKET_CAP) {
+        broadphase_overflow = true;
+        return;
+    }
+    broadphase_bucket[row][broadphase_count[row]++] = index;
+}
+
+// Rebuild the buckets from the active platforms (one pass, runs each tick).
+// Each platform covers the bands spanned by its landing window, so a query
+// only needs the single band containing the player's bottom edge.
+static void broadphase_rebuild(void) {
+    memset(broadphase_count, 0, sizeof(broadphase_count));
+    broadphase_overflow = false;
+
+    for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
+        if (!g_game.platforms[i].active) continue;
+        uint8_t top    = broadphase_row(g_game.platforms[i].y);
+        uint8_t bottom = broadphase_row(g_game.platforms[i].y + PLATFORM_HEIGHT + 4);
+        broadphase_insert(top, i);
+        if (bottom != top) broadphase_insert(bottom, i);
+    }
+}
+
+// Narrowphase shared by both paths: visibility filter plus the exact landing test
+static bool platform_can_land(platform_t *platform, int16_t px, int16_t py) {
+    int16_t platform_screen_y = platform->y - g_game.camera_y;
+    if (platform_screen_y < -PLATFORM_HEIGHT || platform_screen_y > GAME_HEIGHT) {
+        return false;  // Skip collision check for off-screen platforms
+    }
+    return check_collision(px, py, platform);
+}
+
+// Find the platform the player is landing on, or NULL
+static platform_t *broadphase_query_landing(int16_t px, int16_t py) {
+    if (broadphase_overflow) {
+        // Degenerate distribution - check everything like the pre-grid code did
+        for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
+            if (!g_game.platforms[i].active) continue;
+            if (platform_can_land(&g_game.platforms[i], px, py)) return &g_game.platforms[i];
+        }
+        return NULL;
+    }
+
+    uint8_t row = broadphase_row(py + PLAYER_SIZE);
+    for (uint8_t k = 0; k < broadphase_count[row]; k++) {
+        platform_t *platform = &g_game.platforms[broadphase_bucket[row][k]];
+        if (platform_can_land(platform, px, py)) return platform;
+    }
+    return NULL;
+}
+
 // Update game physics and logic
 void game_update(void) {
     if (!g_game.active) return;
@@ -166,6 +304,7 @@ void game_update(void) {
 
                 // Go directly to name entry
                 g_game.mode = GAME_NAME_ENTRY;
+                game_input_unsubscribe(); // name entry takes keys directly
                 g_game.name_entry.char_index = 0;
                 g_game.name_entry.letter_index = 0;
                 g_game.name_entry.name[0] = 'A';
@@ -176,34 +315,47 @@ void game_update(void) {
         return;
     }
 
-    uint32_t now = timer_read32();
-    if (now - g_game.last_update < 10) return;  // ~100 FPS for smoother fullscreen rendering
-    g_game.last_update = now;
+    // Pacing is owned by the game manager's fixed-timestep scheduler: each call advances
+    // the simulation by exactly one tick, so catch-up ticks under display load keep the
+    // game speed constant instead of slowing down with the housekeeping rate
+    g_game.last_update = timer_read32();
+
+    // Apply the key edges queued since the last tick
+    game_drain_input();
 
-    // Handle horizontal input
-    if (g_input.left) {
-        g_game.player.vx = -MOVE_SPEED;
-    } else if (g_input.right) {
-        g_game.player.vx = MOVE_SPEED;
+    // Handle horizontal input; a consumed tap latch steers for this one tick
+    if (g_input.left || left_tapped) {
+        g_game.player.vx = -DOODLE_FP(MOVE_SPEED);
+    } else if (g_input.right || right_tapped) {
+        g_game.player.vx = DOODLE_FP(MOVE_SPEED);
     } else {
         g_game.player.vx = 0;
     }
-
-    // Apply gravity
-    g_game.player.vy += GRAVITY;
-    if (g_game.player.vy > 15) g_game.player.vy = 15;  // Terminal velocity
+    left_tapped  = false;
+    right_tapped = false;
+
+    // Table-driven gravity: this tick's vertical velocity comes straight from
+    // the precomputed arc (the terminal-velocity clamp is its last entry)
+    g_game.player.vy = doodle_jump_arc[g_game.player.arc_index];
+    if (g_game.player.arc_index < DOODLE_ARC_LEN - 1) {
+        g_game.player.arc_index++;
+    }
 
     // Update player position
     g_game.player.x += g_game.player.vx;
     g_game.player.y += g_game.player.vy;
 
     // Wrap around horizontally
-    if (g_game.player.x < -PLAYER_SIZE) {
-        g_game.player.x = GAME_WIDTH;
-    } else if (g_game.player.x > GAME_WIDTH) {
-        g_game.player.x = -PLAYER_SIZE;
+    if (g_game.player.x < DOODLE_FP(-PLAYER_SIZE)) {
+        g_game.player.x = DOODLE_FP(GAME_WIDTH);
+    } else if (g_game.player.x > DOODLE_FP(GAME_WIDTH)) {
+        g_game.player.x = DOODLE_FP(-PLAYER_SIZE);
     }
 
+    // Whole-pixel view of the player for collision and camera work
+    int16_t player_px = DOODLE_FP_TO_INT(g_game.player.x);
+    int16_t player_py = DOODLE_FP_TO_INT(g_game.player.y);
+
     // Remove platforms that are off-screen (before collision detection)
     for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
         if (!g_game.platforms[i].active) continue;
@@ -215,58 +367,50 @@ void game_update(void) {
         }
     }
 
-    // Check platform collisions
+    // Check platform collisions via the grid broadphase
+    broadphase_rebuild();
     g_game.player.on_platform = false;
-    for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
-        if (!g_game.platforms[i].active) continue;
-
-        // Only check collision if platform is visible on screen
-        int16_t platform_screen_y = g_game.platforms[i].y - g_game.camera_y;
-        if (platform_screen_y < -PLATFORM_HEIGHT || platform_screen_y > GAME_HEIGHT) {
-            continue; // Skip collision check for off-screen platforms
-        }
-
-        if (check_collision(g_game.player.x, g_game.player.y, &g_game.platforms[i])) {
-            // Position player on top of platform (in world space)
-            g_game.player.y = g_game.platforms[i].y - PLAYER_SIZE;
-            // Make player jump
-            g_game.player.vy = JUMP_VELOCITY;
-            g_game.player.on_platform = true;
-
-            // Award point if this platform hasn't been scored yet
-            if (!g_game.platforms[i].scored) {
-                g_game.platforms[i].scored = true;
-                g_game.score++;
-            }
-            break;
+    platform_t *landing = broadphase_query_landing(player_px, player_py);
+    if (landing != NULL) {
+        // Position player on top of platform (in world space)
+        g_game.player.y = DOODLE_FP(landing->y - PLAYER_SIZE);
+        // Relaunch along the jump arc; gravity resumes from the next entry
+        g_game.player.vy = doodle_jump_arc[0];
+        g_game.player.arc_index = 1;
+        g_game.player.on_platform = true;
+
+        // Award point if this platform hasn't been scored yet
+        if (!landing->scored) {
+            landing->scored = true;
+            g_game.score++;
         }
     }
 
     // Update camera to follow player when jumping up
     // Keep player in bottom quarter (3/4 down the screen) to make falling easier
-    int16_t player_screen_y = g_game.player.y - g_game.camera_y;
+    int16_t player_screen_y = DOODLE_FP_TO_INT(g_game.player.y) - g_game.camera_y;
     int16_t target_y = (GAME_HEIGHT * 3) / 4;  // Bottom quarter position
     if (player_screen_y < target_y && g_game.player.vy < 0) {
         int16_t scroll = target_y - player_screen_y;
         g_game.camera_y -= scroll;
     }
 
-    // Spawn new platforms as we scroll up
+    // Spawn new platforms as we scroll up. Track the highest platform across the
+    // pass instead of rescanning every platform per empty slot
+    int16_t highest_y = GAME_HEIGHT;
+    for (uint8_t j = 0; j < MAX_PLATFORMS; j++) {
+        if (g_game.platforms[j].active && g_game.platforms[j].y < highest_y) {
+            highest_y = g_game.platforms[j].y;
+        }
+    }
+
     for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
-        // Spawn new platforms at the top
         if (!g_game.platforms[i].active) {
-            // Find the highest platform
-            int16_t highest_y = GAME_HEIGHT;
-            for (uint8_t j = 0; j < MAX_PLATFORMS; j++) {
-                if (g_game.platforms[j].active && g_game.platforms[j].y < highest_y) {
-                    highest_y = g_game.platforms[j].y;
-                }
-            }
-
             // Spawn new platform above the highest one
             if (highest_y - g_game.camera_y > PLATFORM_MAX_GAP) {
                 int16_t new_y = highest_y - random_range(PLATFORM_MIN_GAP, PLATFORM_MAX_GAP);
                 spawn_platform(i, new_y);
+                highest_y = new_y;  // The new platform is now the highest
             }
         }
     }
@@ -290,18 +434,23 @@ static void draw_player(int16_t screen_x, int16_t screen_y) {
     fb_set_pixel_hsv(screen_x + PLAYER_SIZE - 2, screen_y + 2, 0, 0, 255);
 }
 
-// Draw a platform
-static void draw_platform(platform_t *platform) {
-    int16_t screen_y = platform->y - g_game.camera_y;
+// Draw all platforms. They share one format (brown), so a single batch
+// converts the color once for the whole set
+static void draw_platforms(void) {
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, 30, 200, 200);
+
+    for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
+        if (!g_game.platforms[i].active) continue;
 
-    // Only draw if on screen
-    if (screen_y < -PLATFORM_HEIGHT || screen_y > GAME_HEIGHT) return;
+        int16_t screen_y = g_game.platforms[i].y - g_game.camera_y;
 
-    // Draw platform (brown color)
-    uint8_t h = 30, s = 200, v = 200;
-    fb_rect_hsv(platform->x, screen_y,
-            platform->x + platform->width, screen_y + PLATFORM_HEIGHT,
-            h, s, v, true);
+        // Only draw if on screen
+        if (screen_y < -PLATFORM_HEIGHT || screen_y > GAME_HEIGHT) continue;
+
+        sprite_batch_rect(&batch, g_game.platforms[i].x, screen_y,
+                          g_game.platforms[i].x + g_game.platforms[i].width, screen_y + PLATFORM_HEIGHT);
+    }
 }
 
 // Draw a digit (0-9) at position (x, y) using a simple 3x5 pixel font with scaling
@@ -322,19 +471,10 @@ static void draw_digit(int16_t x, int16_t y, uint8_t digit, uint8_t h, uint8_t s
         {0b111, 0b101, 0b111, 0b001, 0b111}, // 9
     };
 
-    // Draw the digit pixel by pixel with scaling
-    for (uint8_t row = 0; row < 5; row++) {
-        for (uint8_t col = 0; col < 3; col++) {
-            if (font[digit][row] & (1 << (2 - col))) {
-                // Draw a scaled pixel as a filled rectangle
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        fb_set_pixel_hsv(x + col * scale + sx, y + row * scale + sy, h, s, v);
-                    }
-                }
-            }
-        }
-    }
+    // One batch per glyph: the color converts once instead of per pixel
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, h, s, v);
+    sprite_batch_glyph(&batch, x, y, font[digit], scale);
 }
 
 // Draw the score in the top right corner
@@ -402,17 +542,10 @@ static void draw_char(int16_t x, int16_t y, char c, uint8_t h, uint8_t s, uint8_
     if (c < 'A' || c > 'Z') return;
     uint8_t index = c - 'A';
 
-    for (uint8_t row = 0; row < 5; row++) {
-        for (uint8_t col = 0; col < 3; col++) {
-            if (font[index][row] & (1 << (2 - col))) {
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        fb_set_pixel_hsv(x + col * scale + sx, y + row * scale + sy, h, s, v);
-                    }
-                }
-            }
-        }
-    }
+    // One batch per glyph: the color converts once instead of per pixel
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, h, s, v);
+    sprite_batch_glyph(&batch, x, y, font[index], scale);
 }
 
 // Render name entry screen (arcade-style)
@@ -751,37 +884,63 @@ void game_render(painter_device_t device) {
         bg_color = fb_hsv_to_rgb565(0, 0, 30);
         fb_clear(bg_color);
         render_name_entry();
+        doodle_fb_valid = false;
     } else if (g_game.mode == GAME_SCORE_DISPLAY) {
         // Score display screen - dark background
         bg_color = fb_hsv_to_rgb565(0, 0, 30);
         fb_clear(bg_color);
         render_score_display();
+        doodle_fb_valid = false;
     } else {
         // Normal gameplay - sky blue
         bg_color = fb_hsv_to_rgb565(150, 180, 255);
-        fb_clear(bg_color);
 
-        // Draw platforms
-        for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
-            if (g_game.platforms[i].active) {
-                draw_platform(&g_game.platforms[i]);
+        int16_t player_x        = DOODLE_FP_TO_INT(g_game.player.x);
+        int16_t player_screen_y = DOODLE_FP_TO_INT(g_game.player.y) - g_game.camera_y;
+        int16_t scroll          = doodle_prev_camera_y - g_game.camera_y;  // Climbing shifts content down
+
+        if (!doodle_fb_valid || g_game.game_over || scroll < 0 || scroll >= GAME_HEIGHT) {
+            // Full repaint: first frame after a mode change, the game-over
+            // overlay, or a camera jump too large to be worth scrolling
+            fb_clear(bg_color);
+            draw_platforms();
+            draw_player(player_x, player_screen_y);
+            draw_score();
+
+            if (g_game.game_over) {
+                // Draw "GAME OVER" background in center
+                fb_rect_hsv(GAME_WIDTH/2 - 30, GAME_HEIGHT/2 - 10,
+                        GAME_WIDTH/2 + 30, GAME_HEIGHT/2 + 10,
+                        0, 255, 255, true);
+            }
+        } else {
+            // Incremental path: erase last frame's screen-fixed elements, then
+            // apply the camera movement as a framebuffer scroll so the static
+            // world content moves in one block copy
+            fb_rect(doodle_prev_player_x, doodle_prev_player_y,
+                    doodle_prev_player_x + PLAYER_SIZE, doodle_prev_player_y + PLAYER_SIZE, bg_color, true);
+            if (scroll > 0 || g_game.score != doodle_prev_score) {
+                // The score is screen-fixed: take its old glyphs out before the
+                // world shifts underneath them or the digits change shape
+                fb_rect(DOODLE_SCORE_X1, DOODLE_SCORE_Y1, DOODLE_SCORE_X2, DOODLE_SCORE_Y2, bg_color, true);
+            }
+            if (scroll > 0) {
+                fb_scroll_down(scroll, bg_color);
             }
-        }
-
-        // Draw player
-        int16_t player_screen_y = g_game.player.y - g_game.camera_y;
-        draw_player(g_game.player.x, player_screen_y);
-
-        // Draw score in top left corner
-        draw_score();
 
-        // Draw game over text if needed
-        if (g_game.game_over) {
-            // Draw "GAME OVER" background in center
-            fb_rect_hsv(GAME_WIDTH/2 - 30, GAME_HEIGHT/2 - 10,
-                    GAME_WIDTH/2 + 30, GAME_HEIGHT/2 + 10,
-                    0, 255, 255, true);
+            // Platforms never move in world space and only leave the screen at
+            // its edges, so repainting the visible set covers both the exposed
+            // strip and any pixels the erases above took with them
+            draw_platforms();
+            draw_player(player_x, player_screen_y);
+            draw_score();
         }
+
+        doodle_fb_valid       = !g_game.game_over;
+        doodle_prev_camera_y  = g_game.camera_y;
+        doodle_prev_player_x  = player_x;
+        doodle_prev_player_y  = player_screen_y;
+        doodle_prev_score     = g_game.score;
     }
 
     // Flush entire framebuffer to display (fullscreen, bypasses FB_SPLIT_Y)
@@ -792,6 +951,7 @@ void game_render(painter_device_t device) {
 void game_cleanup(void) {
     g_game.active = false;
     g_game.game_over = false;
+    game_input_unsubscribe();
 }
 
 // Check if game is active
@@ -841,14 +1001,16 @@ bool game_process_record(uint16_t keycode, keyrecord_t *record, uint8_t *current
             case KC_LSFT:
             case KC_RSFT:
                 // Submit name
+                // Keep the on-keyboard persistent table current in either mode
+                highscore_store_submit(g_game.name_entry.name, g_game.score);
                 if (!g_game.offline_mode) {
                     // Online mode: send to computer and wait for score list
                     send_name_to_computer(g_game.name_entry.name, g_game.score);
                     // Will transition to SCORE_DISPLAY when computer responds
                 } else {
-                    // Offline mode: just show a simple restart screen
+                    // Offline mode: show the table persisted on the keyboard
                     g_game.mode = GAME_SCORE_DISPLAY;
-                    g_game.highscore_count = 0;  // No scores to display
+                    g_game.highscore_count = highscore_store_read(g_game.highscores, 10);
                 }
                 return false;
 
@@ -881,20 +1043,12 @@ bool game_process_record(uint16_t keycode, keyrecord_t *record, uint8_t *current
         }
     }
 
-    // Handle arrow key input
-    bool pressed = record->event.pressed;
+    // KC_LEFT/KC_RIGHT arrive as queued edges via the game input subscription
+    // and never reach this handler; swallow the unused arrows so they don't
+    // leak keystrokes into the host while a game is up
     switch (keycode) {
-        case KC_LEFT:
-            game_set_input(pressed, g_input.right, g_input.up, g_input.down);
-            return false;
-        case KC_RIGHT:
-            game_set_input(g_input.left, pressed, g_input.up, g_input.down);
-            return false;
         case KC_UP:
-            game_set_input(g_input.left, g_input.right, pressed, g_input.down);
-            return false;
         case KC_DOWN:
-            game_set_input(g_input.left, g_input.right, g_input.up, pressed);
             return false;
         default:
             // Let other keys be processed normally
@@ -916,6 +1070,7 @@ void game_hid_receive(uint8_t *data, uint8_t length) {
 
         // Initialize name entry
         g_game.mode = GAME_NAME_ENTRY;
+        game_input_unsubscribe(); // name entry takes keys directly
         g_game.name_entry.char_index = 0;
         g_game.name_entry.letter_index = 0;
         g_game.name_entry.name[0] = 'A';
@@ -927,6 +1082,7 @@ void game_hid_receive(uint8_t *data, uint8_t length) {
     } else if (msg_type == MSG_SHOW_SCORES) {
         // Receive high score list
         g_game.mode = GAME_SCORE_DISPLAY;
+        game_input_unsubscribe(); // score screen takes keys directly
         g_game.highscore_count = 0;
 
         // Parse high scores (each entry: 3 chars + 2 bytes score = 5 bytes)
@@ -23,6 +23,15 @@
 #define PLATFORM_MIN_GAP 20
 #define PLATFORM_MAX_GAP 40
 
+// Fixed-point format for player physics: 4 fractional bits (1/16 px resolution).
+// Stored in 32 bits so world-space Y can keep growing negative while climbing
+// without the integer part overflowing. Platforms and the camera stay in whole
+// pixels; conversion happens at the collision and render boundaries
+typedef int32_t doodle_fp_t;
+#define DOODLE_FP_SHIFT 4
+#define DOODLE_FP(v) ((doodle_fp_t)(v) * (1 << DOODLE_FP_SHIFT))  // Multiply: well-defined for negative v
+#define DOODLE_FP_TO_INT(v) ((int16_t)((v) >> DOODLE_FP_SHIFT))
+
 // Platform structure
 typedef struct {
     int16_t x;
@@ -34,10 +43,11 @@ typedef struct {
 
 // Player structure
 typedef struct {
-    int16_t x;
-    int16_t y;
-    int16_t vx;  // velocity x
-    int16_t vy;  // velocity y
+    doodle_fp_t x;   // position, Q.4 fixed point
+    doodle_fp_t y;
+    doodle_fp_t vx;  // velocity x, Q.4 per tick
+    doodle_fp_t vy;  // velocity y, Q.4 per tick
+    uint8_t arc_index;  // Position along the precomputed jump velocity curve
     bool on_platform;
 } player_t;
 
@@ -82,19 +92,17 @@ typedef struct {
     bool offline_mode;        // True if computer didn't respond (no Python script)
 } game_state_t;
 
-// Input state
+// Held-key state, reconstructed from the queued key edges the game subscribes
+// to (game_input_subscribe); see game_drain_input() in game_doodle.c
 typedef struct {
     bool left;
     bool right;
-    bool up;
-    bool down;
 } input_state_t;
 
 // Function declarations
 void game_init(void);
 void game_update(void);
 void game_render(painter_device_t device);
-void game_set_input(bool left, bool right, bool up, bool down);
 void game_cleanup(void);
 bool game_is_active(void);
 
@@ -6,16 +6,80 @@
 #include "game_tetris.h"
 #include "display/framebuffer.h"
 #include "display/display.h"
+#include "timer.h"
+#include "ring_buffer.h"
 #include <string.h>
 
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+#    include "core1_executor.h"
+#endif
+
 // Global game manager state
 game_manager_state_t g_game_manager = {0};
 
+// Input subscription state. SPSC is sufficient: process_record is the only
+// producer and the game update (same thread, later in the loop) the consumer
+static const uint16_t *subscribed_keys  = NULL;
+static uint8_t         subscribed_count = 0;
+RING_BUFFER_TYPED(game_input, game_input_event_t, GAME_INPUT_QUEUE_SIZE)
+
+void game_input_subscribe(const uint16_t *keycodes, uint8_t count) {
+    subscribed_keys  = keycodes;
+    subscribed_count = count;
+    game_input_clear();
+}
+
+void game_input_unsubscribe(void) {
+    subscribed_keys  = NULL;
+    subscribed_count = 0;
+    game_input_clear();
+}
+
+bool game_input_next(game_input_event_t *event) {
+    return game_input_dequeue(event);
+}
+
+static bool game_input_capture(uint16_t keycode, keyrecord_t *record) {
+    for (uint8_t i = 0; i < subscribed_count; i++) {
+        if (subscribed_keys[i] == keycode) {
+            game_input_event_t event = {
+                .keycode = keycode,
+                .pressed = record->event.pressed,
+                .time    = record->event.time,
+            };
+            // The queue drains every game tick, so overflow needs 15 edges in
+            // ~10ms; if it happens anyway the newest edge is dropped whole
+            game_input_enqueue(event);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fixed-timestep scheduler state
+static uint32_t          tick_last_time;   // Wall time of the previous housekeeping pass
+static uint32_t          tick_accumulator; // Unsimulated time, in ms
+static bool              render_pending;   // A skipped render still owed to the display
+static bool              selection_dirty;  // Selection screen needs a redraw
+static game_frame_stats_t frame_stats;
+
 // Forward declarations
 static void draw_selection_screen(void);
 static void draw_char(int16_t x, int16_t y, char c, uint8_t scale, uint8_t hue);
 static void start_selected_game(void);
 
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+// While a draw runs on core 1 it owns the framebuffer and the game state; core 0
+// must neither update nor render until it completes (see game_manager_housekeeping)
+static bool draw_in_flight = false;
+
+// Runs on core 1: the render paths only touch the RAM framebuffer (no timer, no
+// HID, no SPI - their flush calls are captured, see fb_flush_defer_begin)
+static void game_draw_task(void *arg) {
+    game_manager_render((painter_device_t)arg);
+}
+#endif
+
 // Draw a character (A-Z, 0-9, and some symbols)
 static void draw_char(int16_t x, int16_t y, char c, uint8_t scale, uint8_t hue) {
     // Simple 3x5 font for A-Z
@@ -225,6 +289,12 @@ void game_manager_init(void) {
     g_game_manager.active = true;
     g_game_manager.current_game = GAME_SELECTION;
     g_game_manager.selected_game = GAME_DOODLE;  // Default selection
+
+    // Reset the scheduler so the first pass doesn't try to catch up on idle time
+    tick_last_time   = timer_read32();
+    tick_accumulator = 0;
+    render_pending   = false;
+    selection_dirty  = true;
 }
 
 // Update game manager
@@ -245,8 +315,12 @@ void game_manager_render(painter_device_t device) {
     if (!g_game_manager.active) return;
 
     if (g_game_manager.current_game == GAME_SELECTION) {
-        draw_selection_screen();
-        fb_flush_fullscreen(device);
+        // The selection screen is static; only redraw when the highlight moved
+        if (selection_dirty) {
+            draw_selection_screen();
+            fb_flush_fullscreen(device);
+            selection_dirty = false;
+        }
     } else if (g_game_manager.current_game == GAME_DOODLE) {
         game_render(device);
     } else if (g_game_manager.current_game == GAME_TETRIS) {
@@ -256,6 +330,15 @@ void game_manager_render(painter_device_t device) {
 
 // Cleanup game manager
 void game_manager_cleanup(void) {
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+    // A draw may still be running on core 1 against the state being torn down;
+    // let it finish, then drop its captured flush - the caller repaints the
+    // whole display after cleanup anyway
+    core1_executor_wait();
+    draw_in_flight = false;
+    fb_flush_defer_cancel();
+#endif
+
     // Cleanup any active game
     if (g_game_manager.current_game == GAME_DOODLE) {
         game_cleanup();
@@ -276,14 +359,22 @@ bool game_manager_is_active(void) {
 bool game_manager_process_record(uint16_t keycode, keyrecord_t *record, uint8_t *current_display_layer) {
     if (!g_game_manager.active) return true;
 
+    // Subscribed keys become queued edges for the active game's update to
+    // drain; everything else falls through to the direct handlers below
+    if (game_input_capture(keycode, record)) {
+        return false;
+    }
+
     // Handle selection screen
     if (g_game_manager.current_game == GAME_SELECTION) {
         if (record->event.pressed) {
             if (keycode == KC_LEFT) {
                 g_game_manager.selected_game = GAME_DOODLE;
+                selection_dirty              = true;
                 return false;
             } else if (keycode == KC_RGHT) {
                 g_game_manager.selected_game = GAME_TETRIS;
+                selection_dirty              = true;
                 return false;
             } else if (keycode == KC_UP) {
                 // Start selected game
@@ -309,6 +400,7 @@ bool game_manager_process_record(uint16_t keycode, keyrecord_t *record, uint8_t
             // Return to selection screen
             g_game_manager.current_game = GAME_SELECTION;
             g_game_manager.selected_game = GAME_DOODLE;
+            selection_dirty = true;
         }
 
         return handled;
@@ -320,6 +412,7 @@ bool game_manager_process_record(uint16_t keycode, keyrecord_t *record, uint8_t
             // Return to selection screen
             g_game_manager.current_game = GAME_SELECTION;
             g_game_manager.selected_game = GAME_TETRIS;
+            selection_dirty = true;
         }
 
         return handled;
@@ -328,15 +421,100 @@ bool game_manager_process_record(uint16_t keycode, keyrecord_t *record, uint8_t
     return true;
 }
 
-// Housekeeping task
+// Housekeeping task: fixed-timestep scheduler.
+// Simulation advances in GAME_TICK_MS steps from an accumulator, so game speed is
+// independent of how often housekeeping runs. After a slow pass we catch up with extra
+// ticks, bounded by GAME_MAX_CATCHUP_TICKS and GAME_FRAME_BUDGET_MS; beyond that,
+// simulation time is dropped rather than spiralling (each catch-up tick would make the
+// next pass even later). Rendering happens at most once per pass, and is skipped when
+// updates consumed the budget - the skipped frame is owed and drawn on the next pass.
+// With the RP2040 second-core executor the draw itself runs on core 1; this pass only
+// submits it, and a later pass commits the captured flush once the draw has finished.
 bool game_manager_housekeeping(painter_device_t display) {
     if (!g_game_manager.active) return false;
 
-    game_manager_update();
-    game_manager_render(display);
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+    if (draw_in_flight) {
+        if (core1_executor_busy()) {
+            // Core 1 still owns the framebuffer and game state; updating or
+            // drawing now would race it. The tick accumulator keeps counting,
+            // so the simulation catches up on the next free pass.
+            return true;
+        }
+        draw_in_flight = false;
+        // The draw recorded its flush region; push it to the panel from this core
+        fb_flush_defer_commit(display);
+    }
+#endif
+
+    uint32_t pass_start = timer_read32();
+    tick_accumulator += pass_start - tick_last_time;
+    tick_last_time = pass_start;
+
+    uint8_t updates     = 0;
+    bool    over_budget = false;
+    while (tick_accumulator >= GAME_TICK_MS) {
+        if (updates >= GAME_MAX_CATCHUP_TICKS) break;
+        if (updates > 0 && timer_elapsed32(pass_start) >= GAME_FRAME_BUDGET_MS) {
+            over_budget = true;
+            break;
+        }
+        game_manager_update();
+        tick_accumulator -= GAME_TICK_MS;
+        updates++;
+        frame_stats.ticks++;
+    }
+
+    // Drop whatever backlog remains - it can only be there because we hit a limit above
+    if (tick_accumulator >= GAME_TICK_MS) {
+        frame_stats.skipped_ticks += tick_accumulator / GAME_TICK_MS;
+        tick_accumulator %= GAME_TICK_MS;
+    }
+
+    if (updates > 0 || render_pending || selection_dirty) {
+        if (timer_elapsed32(pass_start) >= GAME_FRAME_BUDGET_MS) {
+            // Updates ate the budget; defer the draw to the next pass
+            frame_stats.skipped_frames++;
+            render_pending = true;
+            over_budget    = true;
+        } else {
+#ifdef RP2040_CORE1_EXECUTOR_ENABLE
+            // Draw on core 1: the render paths only touch the RAM framebuffer,
+            // and their flush is captured and committed from core 0 once the
+            // draw completes. Matrix scanning on this core continues immediately
+            // instead of waiting out the draw.
+            fb_flush_defer_begin();
+            if (core1_executor_submit(game_draw_task, display)) {
+                draw_in_flight = true;
+            } else {
+                // Executor not started: drop the empty capture and draw inline
+                fb_flush_defer_cancel();
+                game_manager_render(display);
+            }
+#else
+            game_manager_render(display);
+#endif
+            frame_stats.frames++;
+            render_pending = false;
+        }
+    }
+
+    if (over_budget || timer_elapsed32(pass_start) > GAME_FRAME_BUDGET_MS) {
+        frame_stats.over_budget++;
+    }
+
     return true;
 }
 
+// Frame accounting accessors (raw HID command 0x07)
+void game_manager_get_frame_stats(game_frame_stats_t *out) {
+    *out = frame_stats;
+}
+
+void game_manager_reset_frame_stats(void) {
+    memset(&frame_stats, 0, sizeof(frame_stats));
+}
+
 // Handle HID receive
 void game_manager_hid_receive(uint8_t *data, uint8_t length) {
     if (length < 1) return;
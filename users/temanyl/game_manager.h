@@ -0,0 +1,151 @@
+// Copyright 2024
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum/painter/qp.h"
+
+// Available games
+typedef enum {
+    GAME_NONE = 0,
+    GAME_DOODLE = 1,
+    GAME_TETRIS = 2,
+    GAME_SELECTION = 3  // Special state for game selection screen
+} game_type_t;
+
+// Game manager state
+typedef struct {
+    game_type_t current_game;    // Which game is running
+    game_type_t selected_game;   // Which game is highlighted in selection
+    bool active;                 // Game manager is active
+} game_manager_state_t;
+
+// Fixed-timestep scheduler configuration
+#define GAME_TICK_MS 10           // Simulation tick length (one game_update per tick)
+#define GAME_FRAME_BUDGET_MS 12   // Max time one housekeeping pass may spend on the game
+#define GAME_MAX_CATCHUP_TICKS 4  // Catch-up ticks per pass before simulation time is dropped
+
+/*
+ * Game input subscription: edge-triggered key events.
+ *
+ * Games used to mirror key state into per-game flags from the key event path and
+ * poll those flags every tick, which lost taps shorter than the gap between two
+ * ticks (press and release both land between polls, leaving the flag as it was).
+ * Instead a game subscribes to the keys it plays with; the event path delivers
+ * each press/release edge, timestamped and in order, into a queue the game drains
+ * at the start of its update. Every edge is seen exactly once, at any frame rate.
+ *
+ * Subscribed keys are consumed before the game's process_record handler, so
+ * subscribe only for gameplay and unsubscribe when entering menu-style modes
+ * (name entry, score display) that want direct key handling.
+ */
+
+// Queue slots; power of two (the ring reserves one slot). 16 buffers two full
+// rollovers of both hands between game ticks - overflow drops the newest edge
+#define GAME_INPUT_QUEUE_SIZE 16
+
+typedef struct {
+    uint16_t keycode; // The subscribed key this edge belongs to
+    bool     pressed; // true = press edge, false = release edge
+    uint16_t time;    // Matrix scan timestamp of the edge (record->event.time)
+} game_input_event_t;
+
+/**
+ * Route the listed keycodes into the event queue
+ * The list is borrowed, not copied - point at static storage. Replaces any
+ * previous subscription and flushes stale queued events
+ * @param keycodes Keys to subscribe to
+ * @param count Number of entries in keycodes
+ */
+void game_input_subscribe(const uint16_t *keycodes, uint8_t count);
+
+/**
+ * Stop routing keys into the queue and flush it
+ * Subsequent key events reach the game's process_record handler directly
+ */
+void game_input_unsubscribe(void);
+
+/**
+ * Pop the oldest queued edge
+ * @param event Receives the edge
+ * @return true while events remain
+ */
+bool game_input_next(game_input_event_t *event);
+
+// Frame accounting, readable in production via raw HID command 0x07
+typedef struct {
+    uint32_t ticks;          // Simulation ticks executed
+    uint32_t frames;         // Frames rendered
+    uint32_t skipped_ticks;  // Simulation ticks dropped after falling too far behind
+    uint32_t skipped_frames; // Renders skipped because updates consumed the frame budget
+    uint32_t over_budget;    // Housekeeping passes that exceeded GAME_FRAME_BUDGET_MS
+} game_frame_stats_t;
+
+// Function declarations
+
+/**
+ * Initialize game manager (shows game selection screen)
+ */
+void game_manager_init(void);
+
+/**
+ * Update game manager state (delegates to active game or handles selection)
+ */
+void game_manager_update(void);
+
+/**
+ * Render game manager (delegates to active game or shows selection screen)
+ */
+void game_manager_render(painter_device_t device);
+
+/**
+ * Cleanup game manager and any active game
+ */
+void game_manager_cleanup(void);
+
+/**
+ * Check if game manager is active
+ */
+bool game_manager_is_active(void);
+
+/**
+ * Handle keypresses for game manager
+ * @param keycode The keycode being processed
+ * @param record The keyrecord
+ * @param current_display_layer Pointer to display layer cache
+ * @return false if game handled the key, true to continue normal processing
+ */
+bool game_manager_process_record(uint16_t keycode, keyrecord_t *record, uint8_t *current_display_layer);
+
+/**
+ * Handle game manager update and rendering in housekeeping loop.
+ * Runs the fixed-timestep scheduler: simulation advances in GAME_TICK_MS steps regardless
+ * of how often housekeeping runs, catching up after slow passes (up to
+ * GAME_MAX_CATCHUP_TICKS) and skipping the render when updates exhaust the frame budget.
+ * @param display The display device
+ * @return true if game manager handled the update, false otherwise
+ */
+bool game_manager_housekeeping(painter_device_t display);
+
+/**
+ * Copy out the frame accounting counters
+ */
+void game_manager_get_frame_stats(game_frame_stats_t *out);
+
+/**
+ * Reset the frame accounting counters
+ */
+void game_manager_reset_frame_stats(void);
+
+/**
+ * Handle Raw HID data from computer (high score responses)
+ * Routes to appropriate game
+ * @param data The received data buffer (32 bytes)
+ * @param length The length of the data
+ */
+void game_manager_hid_receive(uint8_t *data, uint8_t length);
+
+// Global state
+extern game_manager_state_t g_game_manager;
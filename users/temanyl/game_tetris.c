@@ -2,16 +2,31 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "game_tetris.h"
+#include "game_manager.h"
 #include "display/framebuffer.h"
+#include "sprite_batch.h"
 #include "raw_hid.h"
 #include <stdlib.h>
 #include <string.h>
 #include "timer.h"
+#include "coroutine.h"
+#include "util.h"
 
 // Global game state
 tetris_state_t g_tetris = {0};
 tetris_input_t g_tetris_input = {0};
 
+// Multi-frame sequences (gravity, the line clear animation) are stackless
+// coroutines (quantum/coroutine.h) rather than timestamp-and-flag state
+// machines; the coroutine bodies sit next to the logic they pace
+static coroutine_t gravity_co;
+static coroutine_t line_clear_co;
+
+// Gameplay keys delivered as queued edges (see game_input_subscribe); the
+// menu-style modes (name entry, score display) unsubscribe and take their
+// keys directly in tetris_process_record
+static const uint16_t tetris_gameplay_keys[] = {KC_LEFT, KC_RGHT, KC_DOWN, KC_UP};
+
 // Tetromino shape definitions
 // Format: [rotation][row][col] where 1 = block present, 0 = empty
 // All pieces use SRS (Super Rotation System) standard orientations
@@ -222,14 +237,17 @@ static void draw_score_display(void);
 static uint16_t get_drop_delay(void);
 static void submit_score_to_hid(void);
 static void submit_name_to_hid(void);
+static void tetris_invalidate_render_cache(void);
 
 // Initialize game
 void tetris_init(void) {
     memset(&g_tetris, 0, sizeof(tetris_state_t));
     memset(&g_tetris_input, 0, sizeof(tetris_input_t));
+    co_reset(&gravity_co);
 
     g_tetris.active = true;
     g_tetris.mode = TETRIS_PLAYING;
+    tetris_invalidate_render_cache();
     g_tetris.level = 1;
     g_tetris.player_rank = 255;  // Not in top 10
 
@@ -239,6 +257,9 @@ void tetris_init(void) {
     // Spawn first piece
     g_tetris.next_piece = rand() % TETRIS_NUM_PIECES;
     spawn_next_piece();
+
+    // Gameplay keys arrive as queued edges from here on
+    game_input_subscribe(tetris_gameplay_keys, ARRAY_SIZE(tetris_gameplay_keys));
 }
 
 // Spawn a specific piece type
@@ -334,9 +355,9 @@ static void check_lines(void) {
     }
 
     if (g_tetris.num_lines_to_clear > 0) {
-        // Start line clear animation
+        // Start line clear animation (sequenced by tetris_line_clear_anim)
         g_tetris.mode = TETRIS_LINE_CLEAR_ANIM;
-        g_tetris.anim_timer = timer_read32();
+        co_reset(&line_clear_co);
     } else {
         // No lines, spawn next piece
         spawn_next_piece();
@@ -384,6 +405,16 @@ static void clear_lines(void) {
     spawn_next_piece();
 }
 
+// Line clear animation sequence: the flash itself is drawn by the renderer
+// from lines_to_clear; this coroutine holds the mode for the animation's
+// duration and then commits the clear (which flips back to TETRIS_PLAYING)
+static void tetris_line_clear_anim(void) {
+    CO_BEGIN(&line_clear_co);
+    CO_DELAY(&line_clear_co, TETRIS_LINE_CLEAR_DELAY);
+    clear_lines();
+    CO_END(&line_clear_co);
+}
+
 // Move piece by delta
 static void move_piece(int8_t dx, int8_t dy) {
     int8_t new_x = g_tetris.current_piece.x + dx;
@@ -446,6 +477,51 @@ static uint16_t get_drop_delay(void) {
     return delay;
 }
 
+// Gravity: one row per delay tick, forever. CO_DELAY re-evaluates its duration
+// on every poll, so pressing soft drop mid-wait shortens the current tick
+// instead of waiting out the full level delay
+static void tetris_gravity(void) {
+    CO_BEGIN(&gravity_co);
+    for (;;) {
+        CO_DELAY(&gravity_co, g_tetris_input.down ? TETRIS_SOFT_DROP_DELAY : get_drop_delay());
+        move_piece(0, 1);
+    }
+    CO_END(&gravity_co);
+}
+
+// Drain key edges queued since the last tick. Press edges act immediately, so
+// a tap shorter than a tick still moves or rotates exactly once; the held
+// flags feed auto-repeat and soft drop from the main update. With act false
+// (line clear animation, game over) edges only track the held state
+static void tetris_drain_input(bool act) {
+    game_input_event_t event;
+    while (game_input_next(&event)) {
+        switch (event.keycode) {
+            case KC_LEFT:
+                g_tetris_input.left = event.pressed;
+                if (event.pressed) {
+                    g_tetris_input.left_press_time = timer_read32();
+                    if (act) move_piece(-1, 0);
+                }
+                break;
+            case KC_RGHT:
+                g_tetris_input.right = event.pressed;
+                if (event.pressed) {
+                    g_tetris_input.right_press_time = timer_read32();
+                    if (act) move_piece(1, 0);
+                }
+                break;
+            case KC_DOWN:
+                // Soft drop is a held state; the gravity coroutine reads it
+                g_tetris_input.down = event.pressed;
+                break;
+            case KC_UP:
+                if (event.pressed && act) try_rotate();
+                break;
+        }
+    }
+}
+
 // Update game state
 void tetris_update(void) {
     if (!g_tetris.active) return;
@@ -455,6 +531,7 @@ void tetris_update(void) {
     // Handle different modes
     switch (g_tetris.mode) {
         case TETRIS_PLAYING:
+            tetris_drain_input(!g_tetris.game_over);
             if (g_tetris.game_over) {
                 // Wait for HID response or timeout
                 if (g_tetris.waiting_for_hid_response) {
@@ -464,17 +541,14 @@ void tetris_update(void) {
                         g_tetris.waiting_for_hid_response = false;
                         g_tetris.mode = TETRIS_NAME_ENTRY;
                         memset(&g_tetris.name_entry, 0, sizeof(tetris_name_entry_state_t));
+                        game_input_unsubscribe(); // name entry takes keys directly
                     }
                 }
                 return;
             }
 
             // Handle automatic dropping
-            uint16_t drop_delay = g_tetris_input.down ? TETRIS_SOFT_DROP_DELAY : get_drop_delay();
-            if (timer_elapsed32(g_tetris.last_drop) > drop_delay) {
-                move_piece(0, 1);  // Move down
-                g_tetris.last_drop = now;
-            }
+            tetris_gravity();
 
             // Handle lock delay
             if (g_tetris.piece_locked && timer_elapsed32(g_tetris.lock_timer) > TETRIS_LOCK_DELAY) {
@@ -482,58 +556,26 @@ void tetris_update(void) {
                 g_tetris.piece_locked = false;
             }
 
-            // Handle horizontal movement with edge detection and auto-repeat
-            // Left movement
-            if (g_tetris_input.left && !g_tetris_input.prev_left) {
-                // Just pressed - move immediately
-                move_piece(-1, 0);
-                g_tetris_input.left_press_time = now;
-            } else if (g_tetris_input.left && g_tetris_input.prev_left) {
-                // Held - auto-repeat after initial delay
-                uint32_t held_time = timer_elapsed32(g_tetris_input.left_press_time);
-                if (held_time > TETRIS_MOVE_INITIAL_DELAY) {
-                    if (timer_elapsed32(g_tetris.last_move) > TETRIS_MOVE_REPEAT_DELAY) {
-                        move_piece(-1, 0);
-                        g_tetris.last_move = now;
-                    }
+            // Horizontal auto-repeat for held keys; the initiating press edge
+            // already moved the piece in tetris_drain_input()
+            if (g_tetris_input.left && timer_elapsed32(g_tetris_input.left_press_time) > TETRIS_MOVE_INITIAL_DELAY) {
+                if (timer_elapsed32(g_tetris.last_move) > TETRIS_MOVE_REPEAT_DELAY) {
+                    move_piece(-1, 0);
+                    g_tetris.last_move = now;
                 }
             }
-
-            // Right movement
-            if (g_tetris_input.right && !g_tetris_input.prev_right) {
-                // Just pressed - move immediately
-                move_piece(1, 0);
-                g_tetris_input.right_press_time = now;
-            } else if (g_tetris_input.right && g_tetris_input.prev_right) {
-                // Held - auto-repeat after initial delay
-                uint32_t held_time = timer_elapsed32(g_tetris_input.right_press_time);
-                if (held_time > TETRIS_MOVE_INITIAL_DELAY) {
-                    if (timer_elapsed32(g_tetris.last_move) > TETRIS_MOVE_REPEAT_DELAY) {
-                        move_piece(1, 0);
-                        g_tetris.last_move = now;
-                    }
+            if (g_tetris_input.right && timer_elapsed32(g_tetris_input.right_press_time) > TETRIS_MOVE_INITIAL_DELAY) {
+                if (timer_elapsed32(g_tetris.last_move) > TETRIS_MOVE_REPEAT_DELAY) {
+                    move_piece(1, 0);
+                    g_tetris.last_move = now;
                 }
             }
 
-            // Handle rotation - immediate on press
-            if (g_tetris_input.rotate && !g_tetris_input.prev_rotate) {
-                try_rotate();
-                g_tetris.last_rotate = now;
-            }
-
-            // Update previous input state
-            g_tetris_input.prev_left = g_tetris_input.left;
-            g_tetris_input.prev_right = g_tetris_input.right;
-            g_tetris_input.prev_down = g_tetris_input.down;
-            g_tetris_input.prev_rotate = g_tetris_input.rotate;
-
             break;
 
         case TETRIS_LINE_CLEAR_ANIM:
-            // Wait for animation to finish
-            if (timer_elapsed32(g_tetris.anim_timer) > TETRIS_LINE_CLEAR_DELAY) {
-                clear_lines();
-            }
+            tetris_drain_input(false); // keep held state current, no piece to act on
+            tetris_line_clear_anim();
             break;
 
         case TETRIS_NAME_ENTRY:
@@ -561,17 +603,10 @@ static void draw_digit(int16_t x, int16_t y, uint8_t digit, uint8_t scale, uint8
 
     if (digit > 9) return;
 
-    for (uint8_t row = 0; row < 5; row++) {
-        for (uint8_t col = 0; col < 3; col++) {
-            if (digits[digit][row] & (1 << (2 - col))) {
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        fb_set_pixel_hsv(x + col * scale + sx, y + row * scale + sy, hue, 255, 255);
-                    }
-                }
-            }
-        }
-    }
+    // One batch per glyph: the color converts once instead of per pixel
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, hue, 255, 255);
+    sprite_batch_glyph(&batch, x, y, digits[digit], scale);
 }
 
 // Draw a character (A-Z)
@@ -609,84 +644,92 @@ static void draw_char(int16_t x, int16_t y, char c, uint8_t scale, uint8_t hue)
     if (c < 'A' || c > 'Z') return;
 
     uint8_t index = c - 'A';
-    for (uint8_t row = 0; row < 5; row++) {
-        for (uint8_t col = 0; col < 3; col++) {
-            if (font[index][row] & (1 << (2 - col))) {
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        fb_set_pixel_hsv(x + col * scale + sx, y + row * scale + sy, hue, 255, 255);
-                    }
-                }
-            }
-        }
-    }
+
+    // One batch per glyph: the color converts once instead of per pixel
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, hue, 255, 255);
+    sprite_batch_glyph(&batch, x, y, font[index], scale);
 }
 
-// Draw the game board
+// Draw the game board. Cells sharing a format are painted in batches so the
+// HSV conversion happens per batch rather than per pixel
 static void draw_board(void) {
-    // Draw each cell
+    sprite_batch_t batch;
+
+    // Empty cells all share one format - one batch covers the whole background
+    sprite_batch_begin(&batch, 0, 0, 10);
+    uint8_t present = 0;  // Bitmap of piece values on the board, drives the per-piece passes
     for (uint8_t row = 0; row < TETRIS_BOARD_HEIGHT; row++) {
         for (uint8_t col = 0; col < TETRIS_BOARD_WIDTH; col++) {
             uint8_t cell = g_tetris.board[row][col];
-
-            int16_t px = TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE;
-            int16_t py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
-
             if (cell == 0) {
-                // Empty cell - dark background
-                for (uint8_t y = 0; y < TETRIS_CELL_SIZE; y++) {
-                    for (uint8_t x = 0; x < TETRIS_CELL_SIZE; x++) {
-                        fb_set_pixel_hsv(px + x, py + y, 0, 0, 10);
-                    }
-                }
+                int16_t px = TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE;
+                int16_t py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+                sprite_batch_rect(&batch, px, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
             } else {
-                // Filled cell - use piece color
-                uint8_t hue = tetris_pieces[cell - 1].hue;
+                present |= 1 << (cell - 1);
+            }
+        }
+    }
 
-                // Fill cell
-                for (uint8_t y = 1; y < TETRIS_CELL_SIZE - 1; y++) {
-                    for (uint8_t x = 1; x < TETRIS_CELL_SIZE - 1; x++) {
-                        fb_set_pixel_hsv(px + x, py + y, hue, 255, 200);
-                    }
-                }
+    // Filled cells share their piece's formats: one pass per piece type on the
+    // board, with a batch each for the fill, the lit top/left edge, and the
+    // shaded bottom/right edge
+    for (uint8_t piece = 0; piece < TETRIS_NUM_PIECES; piece++) {
+        if (!(present & (1 << piece))) continue;
 
-                // Draw border
-                for (uint8_t i = 0; i < TETRIS_CELL_SIZE; i++) {
-                    fb_set_pixel_hsv(px + i, py, hue, 255, 255);  // Top
-                    fb_set_pixel_hsv(px + i, py + TETRIS_CELL_SIZE - 1, hue, 100, 100);  // Bottom
-                    fb_set_pixel_hsv(px, py + i, hue, 255, 255);  // Left
-                    fb_set_pixel_hsv(px + TETRIS_CELL_SIZE - 1, py + i, hue, 100, 100);  // Right
-                }
+        uint8_t        hue = tetris_pieces[piece].hue;
+        sprite_batch_t fill, lit, shade;
+        sprite_batch_begin(&fill, hue, 255, 200);
+        sprite_batch_begin(&lit, hue, 255, 255);
+        sprite_batch_begin(&shade, hue, 100, 100);
+
+        for (uint8_t row = 0; row < TETRIS_BOARD_HEIGHT; row++) {
+            for (uint8_t col = 0; col < TETRIS_BOARD_WIDTH; col++) {
+                if (g_tetris.board[row][col] != piece + 1) continue;
+
+                int16_t px = TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE;
+                int16_t py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+
+                sprite_batch_rect(&fill, px + 1, py + 1, px + TETRIS_CELL_SIZE - 2, py + TETRIS_CELL_SIZE - 2);
+                sprite_batch_rect(&lit, px, py, px + TETRIS_CELL_SIZE - 1, py);                                                // Top
+                sprite_batch_rect(&lit, px, py, px, py + TETRIS_CELL_SIZE - 1);                                                // Left
+                sprite_batch_rect(&shade, px, py + TETRIS_CELL_SIZE - 1, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Bottom
+                sprite_batch_rect(&shade, px + TETRIS_CELL_SIZE - 1, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Right
             }
         }
     }
 
-    // Highlight lines being cleared
+    // Highlight lines being cleared - the flash cells share one format
     if (g_tetris.mode == TETRIS_LINE_CLEAR_ANIM) {
+        sprite_batch_begin(&batch, 0, 0, 255);
         for (uint8_t i = 0; i < g_tetris.num_lines_to_clear; i++) {
             uint8_t row = g_tetris.lines_to_clear[i];
-            int16_t py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+            int16_t py  = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+            int16_t px  = TETRIS_BOARD_X_OFFSET;
 
-            for (uint8_t col = 0; col < TETRIS_BOARD_WIDTH; col++) {
-                int16_t px = TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE;
-
-                // Flash white
-                for (uint8_t y = 0; y < TETRIS_CELL_SIZE; y++) {
-                    for (uint8_t x = 0; x < TETRIS_CELL_SIZE; x++) {
-                        fb_set_pixel_hsv(px + x, py + y, 0, 0, 255);
-                    }
-                }
-            }
+            // Flash white across the full row
+            sprite_batch_rect(&batch, px, py, px + TETRIS_BOARD_WIDTH * TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
         }
     }
 }
 
-// Draw a tetromino piece
+// Draw a tetromino piece. All four blocks share the piece's formats, so the
+// colors convert once per piece instead of per pixel
 static void draw_piece(tetris_piece_t *piece, bool ghost) {
     if (piece->type >= TETRIS_NUM_PIECES) return;
 
     const tetris_piece_def_t *piece_def = &tetris_pieces[piece->type];
 
+    sprite_batch_t fill, lit, shade;
+    if (ghost) {
+        sprite_batch_begin(&lit, piece_def->hue, 255, 100);
+    } else {
+        sprite_batch_begin(&fill, piece_def->hue, 255, 220);
+        sprite_batch_begin(&lit, piece_def->hue, 255, 255);
+        sprite_batch_begin(&shade, piece_def->hue, 100, 100);
+    }
+
     for (uint8_t row = 0; row < 4; row++) {
         for (uint8_t col = 0; col < 4; col++) {
             if (piece_def->blocks[piece->rotation][row][col]) {
@@ -701,27 +744,14 @@ static void draw_piece(tetris_piece_t *piece, bool ghost) {
 
                     if (ghost) {
                         // Ghost piece - outline only
-                        for (uint8_t i = 0; i < TETRIS_CELL_SIZE; i++) {
-                            fb_set_pixel_hsv(px + i, py, piece_def->hue, 255, 100);  // Top
-                            fb_set_pixel_hsv(px + i, py + TETRIS_CELL_SIZE - 1, piece_def->hue, 255, 100);  // Bottom
-                            fb_set_pixel_hsv(px, py + i, piece_def->hue, 255, 100);  // Left
-                            fb_set_pixel_hsv(px + TETRIS_CELL_SIZE - 1, py + i, piece_def->hue, 255, 100);  // Right
-                        }
+                        sprite_batch_frame(&lit, px, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
                     } else {
-                        // Active piece - filled
-                        for (uint8_t y = 1; y < TETRIS_CELL_SIZE - 1; y++) {
-                            for (uint8_t x = 1; x < TETRIS_CELL_SIZE - 1; x++) {
-                                fb_set_pixel_hsv(px + x, py + y, piece_def->hue, 255, 220);
-                            }
-                        }
-
-                        // Border
-                        for (uint8_t i = 0; i < TETRIS_CELL_SIZE; i++) {
-                            fb_set_pixel_hsv(px + i, py, piece_def->hue, 255, 255);
-                            fb_set_pixel_hsv(px + i, py + TETRIS_CELL_SIZE - 1, piece_def->hue, 100, 100);
-                            fb_set_pixel_hsv(px, py + i, piece_def->hue, 255, 255);
-                            fb_set_pixel_hsv(px + TETRIS_CELL_SIZE - 1, py + i, piece_def->hue, 100, 100);
-                        }
+                        // Active piece - filled with a lit/shaded bevel
+                        sprite_batch_rect(&fill, px + 1, py + 1, px + TETRIS_CELL_SIZE - 2, py + TETRIS_CELL_SIZE - 2);
+                        sprite_batch_rect(&lit, px, py, px + TETRIS_CELL_SIZE - 1, py);                                                // Top
+                        sprite_batch_rect(&lit, px, py, px, py + TETRIS_CELL_SIZE - 1);                                                // Left
+                        sprite_batch_rect(&shade, px, py + TETRIS_CELL_SIZE - 1, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Bottom
+                        sprite_batch_rect(&shade, px + TETRIS_CELL_SIZE - 1, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Right
                     }
                 }
             }
@@ -974,13 +1004,185 @@ static void draw_score_display(void) {
     }
 }
 
+// ---- Incremental board renderer ----
+// The playing-field frame is diffed cell by cell against the previous frame: each cell's visual
+// state (empty / locked piece / active piece / ghost / line flash) is composed into a byte grid,
+// only cells whose byte changed are repainted, and only the dirty bounding region is flushed to the
+// panel. Frame cost then scales with how far the piece moved, not with board size.
+#define TETRIS_CELL_ACTIVE 0x10  // low nibble = piece type
+#define TETRIS_CELL_GHOST 0x20   // low nibble = piece type
+#define TETRIS_CELL_FLASH 0xFE   // line-clear highlight
+#define TETRIS_CELL_DIRTY 0xFD   // never composed; forces a repaint
+
+static uint8_t  tetris_prev_cells[TETRIS_BOARD_HEIGHT][TETRIS_BOARD_WIDTH];
+static bool     tetris_prev_cells_valid = false;
+static uint16_t tetris_prev_score;
+static uint8_t  tetris_prev_level;
+static bool     tetris_prev_game_over;
+
+// Force the next playing-field frame to be a full repaint
+static void tetris_invalidate_render_cache(void) {
+    tetris_prev_cells_valid = false;
+}
+
+// Compose the desired per-cell visual state for this frame
+static void tetris_compose_cells(uint8_t cells[TETRIS_BOARD_HEIGHT][TETRIS_BOARD_WIDTH]) {
+    memcpy(cells, g_tetris.board, sizeof(g_tetris.board));
+
+    if (g_tetris.mode == TETRIS_LINE_CLEAR_ANIM) {
+        for (uint8_t i = 0; i < g_tetris.num_lines_to_clear; i++) {
+            memset(cells[g_tetris.lines_to_clear[i]], TETRIS_CELL_FLASH, TETRIS_BOARD_WIDTH);
+        }
+    }
+
+    if (g_tetris.mode == TETRIS_PLAYING && !g_tetris.game_over) {
+        tetris_piece_t ghost = g_tetris.current_piece;
+        while (!check_collision(ghost.x, ghost.y + 1, ghost.rotation)) {
+            ghost.y++;
+        }
+
+        const tetris_piece_def_t *piece_def = &tetris_pieces[g_tetris.current_piece.type];
+        for (uint8_t row = 0; row < 4; row++) {
+            for (uint8_t col = 0; col < 4; col++) {
+                if (!piece_def->blocks[g_tetris.current_piece.rotation][row][col]) continue;
+
+                // Ghost first; the active piece overwrites it where they overlap
+                int8_t gx = ghost.x + col;
+                int8_t gy = ghost.y + row;
+                if (gx >= 0 && gx < TETRIS_BOARD_WIDTH && gy >= 0 && gy < TETRIS_BOARD_HEIGHT) {
+                    cells[gy][gx] = TETRIS_CELL_GHOST | g_tetris.current_piece.type;
+                }
+
+                int8_t bx = g_tetris.current_piece.x + col;
+                int8_t by = g_tetris.current_piece.y + row;
+                if (bx >= 0 && bx < TETRIS_BOARD_WIDTH && by >= 0 && by < TETRIS_BOARD_HEIGHT) {
+                    cells[by][bx] = TETRIS_CELL_ACTIVE | g_tetris.current_piece.type;
+                }
+            }
+        }
+    }
+}
+
+// Paint a filled cell with the standard lit/shaded bevel
+static void tetris_paint_bevel_cell(int16_t px, int16_t py, uint8_t hue, uint8_t fill_val) {
+    sprite_batch_t fill, lit, shade;
+    sprite_batch_begin(&fill, hue, 255, fill_val);
+    sprite_batch_begin(&lit, hue, 255, 255);
+    sprite_batch_begin(&shade, hue, 100, 100);
+
+    sprite_batch_rect(&fill, px + 1, py + 1, px + TETRIS_CELL_SIZE - 2, py + TETRIS_CELL_SIZE - 2);
+    sprite_batch_rect(&lit, px, py, px + TETRIS_CELL_SIZE - 1, py);                                                 // Top
+    sprite_batch_rect(&lit, px, py, px, py + TETRIS_CELL_SIZE - 1);                                                 // Left
+    sprite_batch_rect(&shade, px, py + TETRIS_CELL_SIZE - 1, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Bottom
+    sprite_batch_rect(&shade, px + TETRIS_CELL_SIZE - 1, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1); // Right
+}
+
+// Repaint one cell to match its composed visual state
+static void tetris_paint_cell(uint8_t row, uint8_t col, uint8_t cell) {
+    int16_t        px = TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE;
+    int16_t        py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+    sprite_batch_t batch;
+
+    if (cell == TETRIS_CELL_FLASH) {
+        sprite_batch_begin(&batch, 0, 0, 255);
+        sprite_batch_rect(&batch, px, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
+    } else if (cell & TETRIS_CELL_GHOST) {
+        // Ghost outline over an empty backing
+        sprite_batch_begin(&batch, 0, 0, 10);
+        sprite_batch_rect(&batch, px, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
+        sprite_batch_begin(&batch, tetris_pieces[cell & 0x0F].hue, 255, 100);
+        sprite_batch_frame(&batch, px, py, px + TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
+    } else if (cell & TETRIS_CELL_ACTIVE) {
+        tetris_paint_bevel_cell(px, py, tetris_pieces[cell & 0x0F].hue, 220);
+    } else if (cell != 0) {
+        tetris_paint_bevel_cell(px, py, tetris_pieces[cell - 1].hue, 200);
+    }
+    // Empty cells are painted as spans by the diff loop, not here
+}
+
+// Diff against the previous frame, repaint changed cells and flush the dirty region
+static void tetris_render_diff(painter_device_t device, uint8_t cells[TETRIS_BOARD_HEIGHT][TETRIS_BOARD_WIDTH]) {
+    bool ui_changed = g_tetris.score != tetris_prev_score || g_tetris.level != tetris_prev_level;
+
+    if (ui_changed) {
+        // The score strip overlays board rows 0-1: clear it (including the side borders the board
+        // does not cover) and force those cells to repaint underneath the fresh text
+        fb_rect_hsv(0, 0, TETRIS_DISPLAY_WIDTH - 1, 2 * TETRIS_CELL_SIZE - 1, 0, 0, 0, true);
+        memset(tetris_prev_cells, TETRIS_CELL_DIRTY, 2 * TETRIS_BOARD_WIDTH);
+    }
+
+    int16_t min_row = TETRIS_BOARD_HEIGHT, max_row = -1;
+    int16_t min_col = TETRIS_BOARD_WIDTH, max_col = -1;
+
+    sprite_batch_t empty_batch;
+    sprite_batch_begin(&empty_batch, 0, 0, 10);
+
+    for (uint8_t row = 0; row < TETRIS_BOARD_HEIGHT; row++) {
+        int16_t empty_run_start = -1; // adjacent changed empty cells merge into one rect span
+        for (uint8_t col = 0; col <= TETRIS_BOARD_WIDTH; col++) {
+            bool changed = col < TETRIS_BOARD_WIDTH && cells[row][col] != tetris_prev_cells[row][col];
+            bool empty   = changed && cells[row][col] == 0;
+
+            if (!empty && empty_run_start >= 0) {
+                int16_t px = TETRIS_BOARD_X_OFFSET + empty_run_start * TETRIS_CELL_SIZE;
+                int16_t py = TETRIS_BOARD_Y_OFFSET + row * TETRIS_CELL_SIZE;
+                sprite_batch_rect(&empty_batch, px, py, TETRIS_BOARD_X_OFFSET + col * TETRIS_CELL_SIZE - 1, py + TETRIS_CELL_SIZE - 1);
+                empty_run_start = -1;
+            }
+            if (!changed) continue;
+
+            tetris_prev_cells[row][col] = cells[row][col];
+            if (row < min_row) min_row = row;
+            if (row > max_row) max_row = row;
+            if (col < min_col) min_col = col;
+            if (col > max_col) max_col = col;
+
+            if (empty) {
+                if (empty_run_start < 0) empty_run_start = col;
+            } else {
+                tetris_paint_cell(row, col, cells[row][col]);
+            }
+        }
+    }
+
+    if (ui_changed) {
+        draw_score_ui();
+        tetris_prev_score = g_tetris.score;
+        tetris_prev_level = g_tetris.level;
+        // The strip spans the full display width, beyond the board's columns
+        min_row = 0;
+        min_col = 0;
+        max_col = TETRIS_BOARD_WIDTH - 1;
+        if (max_row < 1) max_row = 1;
+    }
+
+    if (max_row >= 0) {
+        int16_t x1 = ui_changed ? 0 : TETRIS_BOARD_X_OFFSET + min_col * TETRIS_CELL_SIZE;
+        int16_t x2 = ui_changed ? TETRIS_DISPLAY_WIDTH - 1 : TETRIS_BOARD_X_OFFSET + (max_col + 1) * TETRIS_CELL_SIZE - 1;
+        int16_t y1 = TETRIS_BOARD_Y_OFFSET + min_row * TETRIS_CELL_SIZE;
+        int16_t y2 = TETRIS_BOARD_Y_OFFSET + (max_row + 1) * TETRIS_CELL_SIZE - 1;
+        fb_flush_region(device, x1, y1, x2, y2);
+    }
+}
+
 // Render game
 void tetris_render(painter_device_t device) {
     if (!g_tetris.active) return;
 
     switch (g_tetris.mode) {
         case TETRIS_PLAYING:
-        case TETRIS_LINE_CLEAR_ANIM:
+        case TETRIS_LINE_CLEAR_ANIM: {
+            uint8_t cells[TETRIS_BOARD_HEIGHT][TETRIS_BOARD_WIDTH];
+            tetris_compose_cells(cells);
+
+            // The incremental path only handles cell and score-strip changes; anything that draws
+            // outside the board grid ("GAME OVER" text, or a frame from another mode still on
+            // screen) forces one full repaint, after which diffing takes over again
+            if (tetris_prev_cells_valid && g_tetris.game_over == tetris_prev_game_over) {
+                tetris_render_diff(device, cells);
+                return;
+            }
+
             // Clear screen
             fb_rect_hsv(0, 0, TETRIS_DISPLAY_WIDTH - 1, TETRIS_DISPLAY_HEIGHT - 1, 0, 0, 0, true);  // Black background
 
@@ -1001,13 +1203,23 @@ void tetris_render(painter_device_t device) {
 
             // Draw UI
             draw_score_ui();
+
+            // Seed the diff state from this frame
+            memcpy(tetris_prev_cells, cells, sizeof(tetris_prev_cells));
+            tetris_prev_cells_valid = true;
+            tetris_prev_score       = g_tetris.score;
+            tetris_prev_level       = g_tetris.level;
+            tetris_prev_game_over   = g_tetris.game_over;
             break;
+        }
 
         case TETRIS_NAME_ENTRY:
+            tetris_prev_cells_valid = false;
             draw_name_entry();
             break;
 
         case TETRIS_SCORE_DISPLAY:
+            tetris_prev_cells_valid = false;
             draw_score_display();
             break;
     }
@@ -1016,14 +1228,6 @@ void tetris_render(painter_device_t device) {
     fb_flush_fullscreen(device);
 }
 
-// Set input state
-void tetris_set_input(bool left, bool right, bool down, bool rotate) {
-    g_tetris_input.left = left;
-    g_tetris_input.right = right;
-    g_tetris_input.down = down;
-    g_tetris_input.rotate = rotate;
-}
-
 // Submit score via HID
 static void submit_score_to_hid(void) {
     uint8_t data[32] = {0};
@@ -1056,27 +1260,8 @@ bool tetris_process_record(uint16_t keycode, keyrecord_t *record, uint8_t *curre
     switch (g_tetris.mode) {
         case TETRIS_PLAYING:
         case TETRIS_LINE_CLEAR_ANIM:
-            // Arrow keys for game control
-            if (keycode == KC_LEFT) {
-                tetris_set_input(record->event.pressed, g_tetris_input.right,
-                               g_tetris_input.down, g_tetris_input.rotate);
-                return false;
-            }
-            if (keycode == KC_RGHT) {
-                tetris_set_input(g_tetris_input.left, record->event.pressed,
-                               g_tetris_input.down, g_tetris_input.rotate);
-                return false;
-            }
-            if (keycode == KC_DOWN) {
-                tetris_set_input(g_tetris_input.left, g_tetris_input.right,
-                               record->event.pressed, g_tetris_input.rotate);
-                return false;
-            }
-            if (keycode == KC_UP) {
-                tetris_set_input(g_tetris_input.left, g_tetris_input.right,
-                               g_tetris_input.down, record->event.pressed);
-                return false;
-            }
+            // Arrow keys arrive as queued edges via the game input
+            // subscription and never reach this handler
 
             // Shift to exit game
             if ((keycode == KC_LSFT || keycode == KC_RSFT) && record->event.pressed) {
@@ -1158,6 +1343,7 @@ void tetris_hid_receive(uint8_t *data, uint8_t length) {
     switch (command) {
         case 0x15:  // MSG_TETRIS_ENTER_NAME - score made top 10
             g_tetris.mode = TETRIS_NAME_ENTRY;
+            game_input_unsubscribe(); // name entry takes keys directly
             g_tetris.player_rank = data[1];  // Rank 0-9
             memset(&g_tetris.name_entry, 0, sizeof(tetris_name_entry_state_t));
             g_tetris.name_entry.name[0] = 'A';
@@ -1167,6 +1353,7 @@ void tetris_hid_receive(uint8_t *data, uint8_t length) {
 
         case 0x16:  // MSG_TETRIS_SHOW_SCORES - show high score table
             g_tetris.mode = TETRIS_SCORE_DISPLAY;
+            game_input_unsubscribe(); // score screen takes keys directly
 
             // Parse high scores (format: count, then [name(3), score_lo, score_hi] * count)
             g_tetris.highscore_count = data[1];
@@ -1188,6 +1375,7 @@ void tetris_hid_receive(uint8_t *data, uint8_t length) {
 void tetris_cleanup(void) {
     g_tetris.active = false;
     memset(&g_tetris_input, 0, sizeof(tetris_input_t));
+    game_input_unsubscribe();
 }
 
 // Check if active
@@ -29,7 +29,6 @@
 #define TETRIS_LINE_CLEAR_DELAY 400     // ms to show line clear animation
 #define TETRIS_MOVE_INITIAL_DELAY 200   // ms before auto-repeat starts for horizontal movement
 #define TETRIS_MOVE_REPEAT_DELAY 60     // ms between auto-repeat moves
-#define TETRIS_ROTATE_DELAY 200         // ms debounce for rotation
 
 // Scoring
 #define TETRIS_SCORE_SINGLE 100
@@ -99,12 +98,10 @@ typedef struct {
     bool game_over;
     tetris_mode_t mode;
 
-    // Timing
-    uint32_t last_drop;       // Timer for automatic dropping
+    // Timing (gravity and the line clear animation keep their timing in
+    // coroutines instead; see game_tetris.c)
     uint32_t last_move;       // Timer for horizontal movement
-    uint32_t last_rotate;     // Timer for rotation
     uint32_t lock_timer;      // Timer for lock delay
-    uint32_t anim_timer;      // Timer for animations
     bool piece_locked;        // True when piece has landed
 
     // Line clearing animation
@@ -126,17 +123,13 @@ typedef struct {
     bool offline_mode;
 } tetris_state_t;
 
-// Input state
+// Held-key state, reconstructed from the queued key edges the game
+// subscribes to (game_input_subscribe); press edges act immediately in
+// tetris_drain_input(), these flags only drive auto-repeat and soft drop
 typedef struct {
     bool left;
     bool right;
     bool down;
-    bool rotate;
-    // Previous state for edge detection
-    bool prev_left;
-    bool prev_right;
-    bool prev_down;
-    bool prev_rotate;
     // Timing for auto-repeat
     uint32_t left_press_time;
     uint32_t right_press_time;
@@ -146,7 +139,6 @@ typedef struct {
 void tetris_init(void);
 void tetris_update(void);
 void tetris_render(painter_device_t device);
-void tetris_set_input(bool left, bool right, bool down, bool rotate);
 void tetris_cleanup(void);
 bool tetris_is_active(void);
 
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""Subset a generated QFF font to the glyphs the keymap actually uses.
+
+Scans the given source files for C string literals (expanding printf-style
+conversions to the characters they can produce), then rewrites a
+`painter-convert-font-image` generated .qff.c so only the referenced glyphs
+keep their bitmap data. The 95-entry ASCII glyph table is retained unchanged
+in shape - it is what makes qp_drawtext's lookup a direct index - but every
+dropped glyph is aliased onto the space glyph and its bitmap removed, so the
+table stays dense while the data block shrinks to the referenced subset.
+
+Do not subset fonts that render host-supplied text (e.g. the media font);
+arbitrary strings need the full glyph set.
+
+Usage:
+    gen_font_subset.py thintel15.qff.c --scan ../keymap.c ../display \\
+        --keep "0123456789:%" -o thintel15_subset.qff.c
+"""
+import argparse
+import os
+import re
+import sys
+
+BLOCK_HEADER_SIZE = 5
+FONT_DESCRIPTOR_SIZE = 25
+ASCII_TABLE_GLYPHS = 95
+ASCII_GLYPH_SIZE = 3
+DATA_BLOCK_TYPEID = 0x04 # QFF font data block
+
+# Characters a printf conversion can emit; %s/%c are unknowable and warn instead.
+FORMAT_EXPANSIONS = {
+    'd': '0123456789-',
+    'i': '0123456789-',
+    'u': '0123456789',
+    'x': '0123456789abcdef',
+    'X': '0123456789ABCDEF',
+    'f': '0123456789.-',
+    'l': '',  # length modifier, consumed with the conversion
+    '%': '%',
+}
+
+
+def extract_font(path):
+    """Returns (symbol_name, bytearray, header_comment_lines)."""
+    with open(path) as f:
+        text = f.read()
+    m = re.search(r'const uint8_t\s+(\w+)\[\d+\]\s*=\s*\{(.*?)\};', text, re.DOTALL)
+    if not m:
+        sys.exit(f'error: no font byte array found in {path}')
+    name = m.group(1)
+    data = bytearray(int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', m.group(2)))
+    return name, data
+
+
+def scan_chars(paths):
+    chars = set()
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files.extend(os.path.join(root, n) for n in names if n.endswith(('.c', '.h')))
+        else:
+            files.append(path)
+    literal = re.compile(r'"((?:\\.|[^"\\])*)"')
+    for path in files:
+        with open(path, errors='replace') as f:
+            text = f.read()
+        for raw in literal.findall(text):
+            try:
+                s = raw.encode().decode('unicode_escape')
+            except UnicodeDecodeError:
+                s = raw
+            i = 0
+            while i < len(s):
+                c = s[i]
+                if c == '%' and i + 1 < len(s):
+                    # Walk the conversion: flags/width/precision then the letter
+                    j = i + 1
+                    while j < len(s) and s[j] in '0123456789.+- #':
+                        j += 1
+                    conv = s[j] if j < len(s) else ''
+                    while conv == 'l' and j + 1 < len(s):
+                        j += 1
+                        conv = s[j]
+                    if conv in FORMAT_EXPANSIONS:
+                        chars.update(FORMAT_EXPANSIONS[conv])
+                    elif conv in ('s', 'c'):
+                        print(f'warning: %{conv} in {path} - its output is unknowable, pass the needed characters via --keep', file=sys.stderr)
+                    i = j + 1
+                    continue
+                chars.add(c)
+                i += 1
+    return chars
+
+
+def subset(data, kept_chars):
+    """Returns (new_bytes, kept_count). Only ASCII-table fonts are supported."""
+    if data[0] != 0x00 or data[1] != 0xFF:
+        sys.exit('error: not a QFF font descriptor')
+    has_ascii = data[18]
+    num_unicode = data[19] | (data[20] << 8)
+    if not has_ascii:
+        sys.exit('error: font has no ASCII glyph table; nothing to subset')
+    if num_unicode:
+        sys.exit('error: fonts with unicode glyph tables are not supported')
+
+    table_off = FONT_DESCRIPTOR_SIZE + BLOCK_HEADER_SIZE
+    entries = []
+    for i in range(ASCII_TABLE_GLYPHS):
+        off = table_off + i * ASCII_GLYPH_SIZE
+        value = data[off] | (data[off + 1] << 8) | (data[off + 2] << 16)
+        entries.append((value & 0x3F, value >> 6))  # (width, offset)
+
+    # Walk the remaining blocks; everything except the data block is kept verbatim
+    pos = table_off + ASCII_TABLE_GLYPHS * ASCII_GLYPH_SIZE
+    pre_blocks = bytearray()
+    while pos < len(data):
+        type_id = data[pos]
+        length = data[pos + 2] | (data[pos + 3] << 8) | (data[pos + 4] << 16)
+        if type_id == DATA_BLOCK_TYPEID:
+            break
+        pre_blocks += data[pos:pos + BLOCK_HEADER_SIZE + length]
+        pos += BLOCK_HEADER_SIZE + length
+    else:
+        sys.exit('error: no font data block found')
+    payload = data[pos + BLOCK_HEADER_SIZE:pos + BLOCK_HEADER_SIZE + length]
+
+    # Glyph data extents: each glyph runs to the next-higher offset in use
+    bounds = sorted({off for _, off in entries}) + [len(payload)]
+    extent = {off: bounds[bounds.index(off) + 1] - off for off in {o for _, o in entries}}
+
+    kept = {0}  # the space glyph is the alias target for dropped glyphs
+    kept |= {ord(c) - 0x20 for c in kept_chars if 0x20 <= ord(c) < 0x7F}
+
+    # Repack kept glyph data densely, in original offset order
+    new_payload = bytearray()
+    remap = {}
+    for idx in sorted(kept, key=lambda i: entries[i][1]):
+        width, off = entries[idx]
+        if off not in remap:
+            remap[off] = len(new_payload)
+            new_payload += payload[off:off + extent[off]]
+
+    space_width, space_off = entries[0]
+    out_table = bytearray()
+    for idx, (width, off) in enumerate(entries):
+        if idx in kept:
+            value = width | (remap[off] << 6)
+        else:
+            value = space_width | (remap[space_off] << 6)
+        out_table += bytes((value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF))
+
+    out = bytearray(data[:table_off]) + out_table + pre_blocks
+    out += bytes((DATA_BLOCK_TYPEID, 0xFF ^ DATA_BLOCK_TYPEID, len(new_payload) & 0xFF, (len(new_payload) >> 8) & 0xFF, (len(new_payload) >> 16) & 0xFF))
+    out += new_payload
+
+    total = len(out)
+    out[9:13] = total.to_bytes(4, 'little')
+    out[13:17] = (total ^ 0xFFFFFFFF).to_bytes(4, 'little')
+    return out, len(kept)
+
+
+def emit(path, name, data, kept_count, source):
+    guard_name = name
+    hex_lines = []
+    for i in range(0, len(data), 16):
+        hex_lines.append('    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',')
+    body = '\n'.join(hex_lines)
+    header = (
+        '// Copyright 2025 QMK -- generated source code only, font retains original copyright\n'
+        '// SPDX-License-Identifier: GPL-2.0-or-later\n'
+        '\n'
+        f'// This file was auto-generated by `gen_font_subset.py` from {source}:\n'
+        f'//    {kept_count} of {ASCII_TABLE_GLYPHS} ASCII glyphs retain bitmap data; the rest alias the space\n'
+        '//    glyph, keeping the table densely indexed. Regenerate after changing keymap strings.\n'
+    )
+    with open(path, 'w') as f:
+        f.write(header)
+        f.write('\n#include <qp.h>\n\n')
+        f.write(f'const uint32_t {name}_length = {len(data)};\n\n')
+        f.write('// clang-format off\n')
+        f.write(f'const uint8_t {name}[{len(data)}] = {{\n{body}\n}};\n')
+        f.write('// clang-format on\n')
+    h_path = os.path.splitext(path)[0] + '.h'
+    with open(h_path, 'w') as f:
+        f.write(header)
+        f.write('\n#pragma once\n\n#include <qp.h>\n\n')
+        f.write(f'extern const uint32_t {guard_name}_length;\n')
+        f.write(f'extern const uint8_t  {guard_name}[{len(data)}];\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('font', help='generated .qff.c font to subset')
+    parser.add_argument('--scan', nargs='+', required=True, metavar='PATH', help='source files/directories to scan for string literals')
+    parser.add_argument('--keep', default='', help='extra characters to keep (for %%s/%%c output and runtime strings)')
+    parser.add_argument('-o', '--output', required=True, help='output .qff.c path (a matching .h is written alongside)')
+    args = parser.parse_args()
+
+    name, data = extract_font(args.font)
+    chars = scan_chars(args.scan) | set(args.keep)
+    out, kept_count = subset(data, chars)
+    emit(args.output, name, out, kept_count, os.path.basename(args.font))
+    print(f'{os.path.basename(args.output)}: {len(data)} -> {len(out)} bytes, {kept_count}/{ASCII_TABLE_GLYPHS} glyphs kept')
+
+
+if __name__ == '__main__':
+    main()
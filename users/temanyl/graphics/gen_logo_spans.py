@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""Regenerate display/logo_spans.h from a generated draw_logo-style header.
+
+The original logo pipeline emitted one fb_line_hsv() call per horizontal run,
+which costs an HSV-to-RGB565 conversion and a function call per run at every
+scene redraw. This script folds those runs into a packed span table compiled
+into flash, so drawing becomes one color conversion plus pure streaming row
+writes (see draw_amboss_logo in display/draw_logo.h).
+
+Usage:
+    python3 gen_logo_spans.py ../display/draw_logo_calls.h > ../display/logo_spans.h
+
+The input is any file containing lines of the form
+    fb_line_hsv(X1 + x_offset, Y + y_offset, X2 + x_offset, Y + y_offset, ...);
+All coordinates must fit in a uint8_t (the logo is 120x120).
+"""
+
+import re
+import sys
+
+CALL_RE = re.compile(
+    r"fb_line_hsv\(\s*(\d+)\s*\+\s*x_offset\s*,\s*(\d+)\s*\+\s*y_offset\s*,"
+    r"\s*(\d+)\s*\+\s*x_offset\s*,\s*(\d+)\s*\+\s*y_offset"
+)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    spans = []
+    with open(sys.argv[1]) as f:
+        for line in f:
+            m = CALL_RE.search(line)
+            if not m:
+                continue
+            x1, y1, x2, y2 = (int(g) for g in m.groups())
+            if y1 != y2:
+                sys.stderr.write(f"non-horizontal span: {line.strip()}\n")
+                return 1
+            if max(x1, x2, y1) > 255:
+                sys.stderr.write(f"coordinate out of uint8_t range: {line.strip()}\n")
+                return 1
+            spans.append((y1, min(x1, x2), max(x1, x2)))
+
+    spans.sort()
+
+    print("// Auto-generated by graphics/gen_logo_spans.py - do not edit by hand")
+    print(f"// {len(spans)} horizontal spans, packed as y, x1, x2 (inclusive)")
+    print("#pragma once")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("typedef struct {")
+    print("    uint8_t y;")
+    print("    uint8_t x1;")
+    print("    uint8_t x2;")
+    print("} logo_span_t;")
+    print()
+    print(f"#define AMBOSS_LOGO_SPAN_COUNT {len(spans)}")
+    print()
+    print("static const logo_span_t amboss_logo_spans[AMBOSS_LOGO_SPAN_COUNT] = {")
+    for y, x1, x2 in spans:
+        print(f"    {{{y}, {x1}, {x2}}},")
+    print("};")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Precompute native-format (RGB565) palettes for palette-based QGF assets.
+
+At runtime, Quantum Painter expands an image's palette by interpolating HSV
+entries and converting each one to the panel's pixel format on every open
+(or caching the result in RAM per image). For a fixed display config both
+steps are pure functions of data known at build time, so this script performs
+them here and emits a `const qp_pixel_t` table ready to attach with
+qp_image_set_native_palette() (requires QUANTUM_PAINTER_PRECOMPUTED_PALETTES).
+
+Usage:
+    # Grayscale/mono asset: interpolate fg over bg across 2**bpp steps
+    python3 gen_native_palettes.py --name amboss_teal --bpp 8 \
+        --fg 132,255,255 --bg 0,0,0 > ../display/amboss_teal_palette.h
+
+    # Asset with an explicit palette: one H,S,V triple per line on stdin
+    python3 gen_native_palettes.py --name myimage --hsv-list < palette.txt
+
+Colors are QMK-style HSV with all components in 0..255. Output matches the
+ST7789 on this board: RGB565, byte-swapped for big-endian SPI transfers.
+"""
+
+import argparse
+import sys
+
+
+def hsv_to_rgb(h, s, v):
+    # Mirrors quantum/color.c hsv_to_rgb_impl() so the firmware and the
+    # precomputed table agree bit-for-bit.
+    if s == 0:
+        return v, v, v
+    region = min(h * 6 // 255, 5)
+    remainder = (h * 2 - region * 85) * 3
+    p = (v * (255 - s)) >> 8
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8
+    return [
+        (v, t, p),
+        (q, v, p),
+        (p, v, t),
+        (p, q, v),
+        (t, p, v),
+        (v, p, q),
+    ][region]
+
+
+def rgb565_swapped(r, g, b):
+    rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((rgb565 & 0xFF) << 8) | (rgb565 >> 8)
+
+
+def interpolate(fg, bg, steps):
+    # Matches qp_internal_interpolate_palette(): linear HSV blend, shortest
+    # path around the hue circle.
+    fh, fs, fv = fg
+    bh, bs, bv = bg
+    dh = fh - bh
+    if dh > 127:
+        dh -= 256
+    elif dh < -128:
+        dh += 256
+    out = []
+    for i in range(steps):
+        h = (bh + dh * i // (steps - 1)) & 0xFF
+        s = bs + (fs - bs) * i // (steps - 1)
+        v = bv + (fv - bv) * i // (steps - 1)
+        out.append((h, s, v))
+    return out
+
+
+def parse_hsv(text):
+    parts = [int(p) for p in text.split(",")]
+    if len(parts) != 3 or not all(0 <= p <= 255 for p in parts):
+        raise argparse.ArgumentTypeError(f"expected H,S,V in 0..255: {text!r}")
+    return tuple(parts)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument("--name", required=True, help="C identifier stem for the table")
+    ap.add_argument("--bpp", type=int, choices=(1, 2, 4, 8), help="grayscale bit depth")
+    ap.add_argument("--fg", type=parse_hsv, help="foreground H,S,V (grayscale mode)")
+    ap.add_argument("--bg", type=parse_hsv, help="background H,S,V (grayscale mode)")
+    ap.add_argument("--hsv-list", action="store_true", help="read H,S,V lines from stdin")
+    args = ap.parse_args()
+
+    if args.hsv_list:
+        entries = [parse_hsv(line.strip()) for line in sys.stdin if line.strip()]
+    elif args.bpp and args.fg and args.bg:
+        entries = interpolate(args.fg, args.bg, 1 << args.bpp)
+    else:
+        ap.error("need either --hsv-list or all of --bpp/--fg/--bg")
+
+    print("// Auto-generated by graphics/gen_native_palettes.py - do not edit by hand")
+    print("// RGB565 (byte-swapped), attach with qp_image_set_native_palette()")
+    print("#pragma once")
+    print()
+    print('#include "qp.h"')
+    print('#include "qp_internal_formats.h"')
+    print()
+    print(f"static const qp_pixel_t {args.name}_native_palette[{len(entries)}] = {{")
+    for i in range(0, len(entries), 8):
+        row = entries[i : i + 8]
+        cells = ", ".join(f"{{.rgb565 = 0x{rgb565_swapped(*hsv_to_rgb(*e)):04X}}}" for e in row)
+        print(f"    {cells},")
+    print("};")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,114 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include QMK_KEYBOARD_H
+#include <string.h>
+#include "ring_buffer.h"
+#include "hid_inbox.h"
+#include "hid_protocol.h"
+#include "scene_timeline.h"
+#include "media_image.h"
+
+typedef struct {
+    uint8_t length;
+    uint8_t data[RAW_EPSIZE];
+} hid_inbox_slot_t;
+
+// SPSC is sufficient: raw_hid_receive() is the only producer and
+// hid_inbox_task() the only consumer
+RING_BUFFER_TYPED(inbox, hid_inbox_slot_t, HID_INBOX_SIZE)
+
+// Cheap structural validation, safe for receive context; range checks on the
+// field values stay in the hid_apply_* functions
+static bool packet_valid(const uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case 0x01: // Volume
+        case 0x02: // Media text
+        case 0x04: // Weather
+            return length >= 2;
+        case 0x03: // Date/Time
+            return length >= 8;
+        case 0x05: // Wind
+            return length >= 3;
+        case HID_CMD_FRAME:
+            return length >= 3;
+        default:
+            return false;
+    }
+}
+
+bool hid_inbox_push(const uint8_t *data, uint8_t length) {
+    if (length == 0) {
+        return false;
+    }
+    uint8_t command = data[0];
+    if (!((command >= 0x01 && command <= 0x05) || command == HID_CMD_FRAME)) {
+        return false; // Not a state push - caller dispatches inline
+    }
+    if (!packet_valid(data, length)) {
+        // Malformed packets die here
+        return true;
+    }
+
+    hid_inbox_slot_t slot;
+    slot.length = length > RAW_EPSIZE ? RAW_EPSIZE : length;
+    memcpy(slot.data, data, slot.length);
+    // A full inbox drops the packet un-ACKed so a v2 host resends it once
+    // the backlog clears
+    inbox_enqueue(slot);
+    return true;
+}
+
+// Legacy single-value commands; mirrors the dispatch that used to live in
+// raw_hid_receive(), minus the per-packet flush
+static hid_redraw_t apply_legacy(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case 0x01:
+            return hid_apply_volume(data[1]);
+        case 0x02:
+            // Null-terminated string starting at byte 1; force termination at the packet edge
+            data[length - 1] = '\0';
+            return hid_apply_media_text((const char *)&data[1]);
+        case 0x03:
+            return hid_apply_datetime(&data[1]);
+        case 0x04:
+            return hid_apply_weather(data[1]);
+        case 0x05:
+            return hid_apply_wind(data[1], data[2]);
+    }
+    return HID_REDRAW_NONE;
+}
+
+void hid_inbox_task(void) {
+    hid_redraw_t     redraw = HID_REDRAW_NONE;
+    hid_inbox_slot_t slot;
+    while (inbox_dequeue(&slot)) {
+        hid_redraw_t r = HID_REDRAW_NONE;
+        if (!hid_protocol_receive(slot.data, slot.length, &r)) {
+            r = apply_legacy(slot.data, slot.length);
+        }
+        redraw = hid_redraw_max(redraw, r);
+    }
+    // Timeline keyframes are locally-generated state pushes; they land at the same
+    // frame boundary as host pushes and share the flush below
+    scene_timeline_task(&redraw);
+    // A committed image upload swaps its double buffer here for the same reason:
+    // the swap must not interleave with an in-progress flush
+    media_image_task();
+    // One flush for everything that arrived since the last frame
+    hid_redraw_flush(redraw);
+}
@@ -0,0 +1,52 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Raw HID inbox: decouples host push rate from render timing.
+ *
+ * keyboard_monitor.py and weather_control.py push state updates whenever they
+ * feel like it; handling them directly in raw_hid_receive() meant applies (and
+ * their flushes) could land mid-frame, tearing the display and occasionally
+ * dropping packets during long flushes. State-push packets (legacy commands
+ * 0x01-0x05 and protocol v2 frames) now land in this ring after cheap
+ * structural validation, and hid_inbox_task() applies them from housekeeping
+ * at the next frame boundary with a single combined flush.
+ *
+ * Query/benchmark commands (0x06 and up) still respond inline - they are
+ * host-pull round trips with no display state to tear.
+ */
+
+// Inbox slots; each holds one raw HID packet. Must be a power of two (the
+// ring reserves one slot, so 8 slots buffer 7 packets). A full inbox drops
+// further packets un-ACKed, so a v2 host retransmits once the backlog clears.
+#ifndef HID_INBOX_SIZE
+#    define HID_INBOX_SIZE 8
+#endif
+
+// Accepts state-push packets into the inbox. Returns true when the packet is
+// inbox material (even if malformed or dropped - the caller is done with it),
+// false when it should be dispatched inline.
+bool hid_inbox_push(const uint8_t *data, uint8_t length);
+
+// Applies all pending packets and performs one flush at the highest redraw
+// level any of them required. Call at a frame boundary.
+void hid_inbox_task(void);
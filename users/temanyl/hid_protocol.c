@@ -0,0 +1,257 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include QMK_KEYBOARD_H
+#include <string.h>
+#include "hid_protocol.h"
+#include "display/display.h"
+#include "display/framebuffer.h"
+#include "scenes/scenes.h"
+#include "weather_transition.h"
+#include "objects/weather/wind.h"
+
+// Animation re-initialization flags owned by the weather effect modules
+extern bool rain_initialized, rain_background_saved;
+extern bool snowflake_initialized, snowflake_background_saved;
+extern bool cloud_initialized, cloud_background_saved;
+
+/**
+ * Invalidate all weather particle animations and force a full scene redraw.
+ * Common tail of every state change that alters the scene background.
+ */
+static void invalidate_scene(void) {
+    rain_initialized           = false;
+    rain_background_saved      = false;
+    snowflake_initialized      = false;
+    snowflake_background_saved = false;
+    cloud_initialized          = false;
+    cloud_background_saved     = false;
+    current_display_layer      = 255; // Force full redraw on next update
+}
+
+hid_redraw_t hid_apply_volume(uint8_t volume) {
+    // Clamp to 0-100 range
+    if (volume > 100) {
+        volume = 100;
+    }
+    if (volume == current_volume) {
+        return HID_REDRAW_NONE; // Host re-pushed the same value; nothing to repaint or flush
+    }
+    current_volume = volume;
+
+    // Update the permanent volume bar
+    uint8_t layer = get_highest_layer(layer_state);
+    uint8_t hue, sat, val;
+    get_layer_color(layer, &hue, &sat, &val);
+    draw_volume_bar(hue, sat, val);
+    return HID_REDRAW_INFO;
+}
+
+hid_redraw_t hid_apply_media_text(const char *text) {
+    bool text_changed = false;
+    if (text[0] == '\0') {
+        // Empty string = no media playing
+        if (media_active) {
+            media_active     = false;
+            current_media[0] = '\0';
+            text_changed     = true;
+        }
+    } else if (strcmp(current_media, text) != 0) {
+        // Only update if text changed
+        strncpy(current_media, text, sizeof(current_media) - 1);
+        current_media[sizeof(current_media) - 1] = '\0';
+        media_active                             = true;
+        text_changed                             = true;
+    }
+
+    if (!text_changed) {
+        return HID_REDRAW_NONE;
+    }
+
+    // Reset scroll state for new text
+    scroll_position = 0;
+    text_length     = 0;
+    needs_scroll    = false;
+    scroll_timer    = timer_read32();
+    draw_media_text();
+    return HID_REDRAW_INFO;
+}
+
+hid_redraw_t hid_apply_datetime(const uint8_t *payload) {
+#ifdef HARDCODE_DATE_TIME
+#    if IGNORE_HID_TIME_UPDATES
+    // Hard-coded date mode is active - ignore HID time updates
+    return HID_REDRAW_NONE;
+#    endif
+#endif
+    // Extract date/time components
+    current_year      = payload[0] | (payload[1] << 8); // 16-bit year
+    uint8_t new_month = payload[2];
+    current_day       = payload[3];
+    current_hour      = payload[4];
+    current_minute    = payload[5];
+    // payload[6] is seconds, but we don't display it
+
+    // Validate ranges
+    if (new_month < 1 || new_month > 12) new_month = 1;
+    if (current_day < 1 || current_day > 31) current_day = 1;
+    if (current_hour > 23) current_hour = 0;
+    if (current_minute > 59) current_minute = 0;
+
+    hid_redraw_t redraw = HID_REDRAW_NONE;
+
+    // If month changed, update weather to match new season default
+    if (new_month != current_month) {
+        current_month = new_month;
+        weather_transition_init(current_month);
+        invalidate_scene();
+        redraw = HID_REDRAW_SCENE;
+    } else {
+        current_month = new_month;
+    }
+
+    time_received      = true;
+    last_uptime_update = timer_read32();
+
+    // Note: hour/day rollovers are NOT redrawn here; the change detection in
+    // display_housekeeping_task() handles those by only resetting background_saved flags,
+    // which lets animated elements (snowflakes, rain, clouds, etc.) persist.
+    return redraw;
+}
+
+hid_redraw_t hid_apply_weather(uint8_t weather) {
+    // Validate weather state (0=sunny, 1-3=rain, 4-6=snow, 7-8=cloudy)
+    if (weather > 8) {
+        return HID_REDRAW_NONE;
+    }
+    // Snapshot the outgoing scene before the state switches; the display fades
+    // to the new scene instead of cutting (see fb_crossfade_begin). When the
+    // scene timeline has a held prefetch fade pending, the outgoing scene is
+    // already snapshotted and the fade timing belongs to the timeline, so a
+    // restart here would both unhold it and drop the staged snapshot
+    if ((weather_state_t)weather != weather_transition_get_current() && !fb_crossfade_held_active()) {
+        fb_crossfade_begin(WEATHER_CROSSFADE_DURATION_MS);
+    }
+    weather_transition_set_target((weather_state_t)weather);
+
+    // Reset animation flags so particles are redrawn and old ones cleared
+    invalidate_scene();
+    return HID_REDRAW_SCENE;
+}
+
+hid_redraw_t hid_apply_wind(uint8_t intensity, uint8_t direction) {
+    // Validate intensity (0-3) and direction (0-1)
+    if (intensity > 3 || direction > 1) {
+        return HID_REDRAW_NONE;
+    }
+    wind_set_state((wind_intensity_t)intensity, (wind_direction_t)direction);
+
+    // Reset cloud animation to pick up new wind velocity
+    invalidate_scene();
+    return HID_REDRAW_SCENE;
+}
+
+void hid_redraw_flush(hid_redraw_t redraw) {
+    switch (redraw) {
+        case HID_REDRAW_SCENE:
+            // Redraw the scene immediately and flush everything, clearing stale
+            // particles. A pending weather crossfade takes over the flush and
+            // streams the first blended frame instead
+            draw_seasonal_animation();
+            if (!fb_crossfade_flush(display)) {
+                fb_flush(display);
+            }
+            break;
+        case HID_REDRAW_INFO:
+            qp_flush(display); // Flush QP info area only
+            break;
+        case HID_REDRAW_NONE:
+            break;
+    }
+}
+
+bool hid_protocol_receive(uint8_t *data, uint8_t length, hid_redraw_t *redraw_out) {
+    if (length < 3 || data[0] != HID_CMD_FRAME) {
+        return false;
+    }
+
+    const uint8_t seq    = data[1];
+    const uint8_t fields = data[2];
+
+    // Track the last sequence seen so a retransmitted frame is re-ACKed without being
+    // re-applied (and without a second redraw)
+    static uint8_t last_seq;
+    static uint8_t last_applied;
+    static bool    seq_valid;
+
+    if (seq_valid && seq == last_seq) {
+        uint8_t ack[RAW_EPSIZE] = {HID_CMD_FRAME_ACK, seq, last_applied};
+        raw_hid_send(ack, sizeof(ack));
+        return true;
+    }
+
+    // Walk the fields in bitmap order; a malformed frame is truncated at the first field that
+    // doesn't fit, and only cleanly-parsed fields are applied and reported in the ACK
+    uint8_t      offset  = 3;
+    uint8_t      applied = 0;
+    hid_redraw_t redraw  = HID_REDRAW_NONE;
+
+    if (fields & HID_FRAME_FIELD_DATETIME) {
+        if (offset + 7 > length) goto respond;
+        redraw = hid_redraw_max(redraw, hid_apply_datetime(&data[offset]));
+        offset += 7;
+        applied |= HID_FRAME_FIELD_DATETIME;
+    }
+    if (fields & HID_FRAME_FIELD_VOLUME) {
+        if (offset + 1 > length) goto respond;
+        redraw = hid_redraw_max(redraw, hid_apply_volume(data[offset]));
+        offset += 1;
+        applied |= HID_FRAME_FIELD_VOLUME;
+    }
+    if (fields & HID_FRAME_FIELD_WEATHER) {
+        if (offset + 1 > length) goto respond;
+        redraw = hid_redraw_max(redraw, hid_apply_weather(data[offset]));
+        offset += 1;
+        applied |= HID_FRAME_FIELD_WEATHER;
+    }
+    if (fields & HID_FRAME_FIELD_WIND) {
+        if (offset + 2 > length) goto respond;
+        redraw = hid_redraw_max(redraw, hid_apply_wind(data[offset], data[offset + 1]));
+        offset += 2;
+        applied |= HID_FRAME_FIELD_WIND;
+    }
+    if (fields & HID_FRAME_FIELD_MEDIA) {
+        if (offset >= length) goto respond;
+        // Null-terminate in place -- the media field runs to the end of the packet
+        data[length - 1] = '\0';
+        redraw           = hid_redraw_max(redraw, hid_apply_media_text((const char *)&data[offset]));
+        applied |= HID_FRAME_FIELD_MEDIA;
+    }
+
+respond:
+    // The caller performs one flush for everything drained this pass, at the
+    // highest level any field required
+    *redraw_out = hid_redraw_max(*redraw_out, redraw);
+
+    last_seq     = seq;
+    last_applied = applied;
+    seq_valid    = true;
+
+    uint8_t ack[RAW_EPSIZE] = {HID_CMD_FRAME_ACK, seq, applied};
+    raw_hid_send(ack, sizeof(ack));
+    return true;
+}
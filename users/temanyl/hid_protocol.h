@@ -0,0 +1,89 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Raw HID protocol v2: framed multi-field state updates.
+ *
+ * The legacy protocol (commands 0x01-0x05, drained via hid_inbox.c) carries one value per
+ * 32-byte packet and redraws the display after each one, so a full state push from
+ * keyboard_monitor.py costs a burst of packets with a redraw per packet. Protocol v2 packs
+ * several fields into a single frame and performs at most one redraw per frame.
+ *
+ * Frame layout (computer -> keyboard, 32 bytes):
+ *   Byte 0: 0x20 (HID_CMD_FRAME)
+ *   Byte 1: sequence number (wraps; consecutive duplicates are ACKed but not re-applied)
+ *   Byte 2: field bitmap -- fields present in this frame, packed in bit order from byte 3:
+ *     bit 0: datetime (7 bytes: year_low, year_high, month, day, hour, minute, second)
+ *     bit 1: volume   (1 byte: 0-100)
+ *     bit 2: weather  (1 byte: weather_state_t, 0-8)
+ *     bit 3: wind     (2 bytes: intensity 0-3, direction 0-1)
+ *     bit 4: media    (null-terminated string, must be the last field; empty = no media playing)
+ *
+ * ACK (keyboard -> computer, 32 bytes):
+ *   Byte 0: 0x21 (HID_CMD_FRAME_ACK)
+ *   Byte 1: sequence number being acknowledged
+ *   Byte 2: bitmap of fields actually applied (absent/invalid fields are dropped)
+ *
+ * USB interrupt transfers are already reliable; the sequence/ACK pair exists so the host can
+ * keep a window of frames in flight and only resend the ones the firmware never saw (e.g. sent
+ * while the device was re-enumerating), instead of pacing itself with per-packet round trips.
+ *
+ * A host sending only the fields that changed gets delta updates for free: a volume tick is a
+ * 4-byte payload and touches nothing but the volume bar.
+ */
+
+#define HID_CMD_FRAME 0x20
+#define HID_CMD_FRAME_ACK 0x21
+
+#define HID_FRAME_FIELD_DATETIME (1 << 0)
+#define HID_FRAME_FIELD_VOLUME (1 << 1)
+#define HID_FRAME_FIELD_WEATHER (1 << 2)
+#define HID_FRAME_FIELD_WIND (1 << 3)
+#define HID_FRAME_FIELD_MEDIA (1 << 4)
+
+// Redraw cost of an applied field, in increasing order of expense. Appliers return the redraw
+// they need; callers combine them with hid_redraw_max() and flush once via hid_redraw_flush().
+typedef enum {
+    HID_REDRAW_NONE = 0,  // State unchanged, nothing to do
+    HID_REDRAW_INFO = 1,  // Info area widgets redrawn, needs a QP flush
+    HID_REDRAW_SCENE = 2  // Scene invalidated, needs draw_seasonal_animation() + framebuffer flush
+} hid_redraw_t;
+
+static inline hid_redraw_t hid_redraw_max(hid_redraw_t a, hid_redraw_t b) {
+    return a > b ? a : b;
+}
+
+// Field appliers: update state and redraw widgets, but defer the flush to the caller.
+// Shared between the legacy single-value commands and v2 frames.
+hid_redraw_t hid_apply_volume(uint8_t volume);
+hid_redraw_t hid_apply_media_text(const char *text);
+hid_redraw_t hid_apply_datetime(const uint8_t *payload); // 7 bytes, same layout as command 0x03
+hid_redraw_t hid_apply_weather(uint8_t weather);
+hid_redraw_t hid_apply_wind(uint8_t intensity, uint8_t direction);
+
+// Performs the deferred flush for the combined redraw level of one packet/frame.
+void hid_redraw_flush(hid_redraw_t redraw);
+
+// Handles v2 frames; returns true if the packet was consumed (callers skip legacy dispatch).
+// The combined redraw level of the applied fields accumulates into *redraw_out; the caller
+// flushes, so several frames drained in one pass share a single flush.
+bool hid_protocol_receive(uint8_t *data, uint8_t length, hid_redraw_t *redraw_out);
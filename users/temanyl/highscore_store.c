@@ -0,0 +1,70 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "highscore_store.h"
+#include "eeconfig.h"
+#include <string.h>
+
+// RAM mirror of the persisted block. Layout changes require bumping
+// EECONFIG_USER_DATA_VERSION so stale data is discarded on boot
+typedef struct {
+    uint8_t           count;
+    highscore_entry_t entries[HIGHSCORE_STORE_CAPACITY];
+} highscore_store_t;
+
+_Static_assert(sizeof(highscore_store_t) <= EECONFIG_USER_DATA_SIZE, "highscore store exceeds eeconfig user datablock");
+
+static highscore_store_t store;
+static bool              store_dirty = false;
+
+void highscore_store_init(void) {
+    if (eeconfig_is_user_datablock_valid()) {
+        eeconfig_read_user_datablock(&store, 0, sizeof(store));
+        if (store.count > HIGHSCORE_STORE_CAPACITY) {
+            // Corrupt count: treat the whole table as lost
+            memset(&store, 0, sizeof(store));
+        }
+    } else {
+        memset(&store, 0, sizeof(store));
+    }
+    store_dirty = false;
+}
+
+uint8_t highscore_store_read(highscore_entry_t *dest, uint8_t max) {
+    uint8_t count = store.count < max ? store.count : max;
+    memcpy(dest, store.entries, count * sizeof(highscore_entry_t));
+    return count;
+}
+
+bool highscore_store_submit(const char name[3], uint16_t score) {
+    // Find the insertion rank (stable: ties go below existing entries)
+    uint8_t rank = 0;
+    while (rank < store.count && store.entries[rank].score >= score) {
+        rank++;
+    }
+    if (rank >= HIGHSCORE_STORE_CAPACITY) {
+        return false;
+    }
+
+    // Shift lower-ranked entries down, dropping the last one if full
+    uint8_t tail = store.count < HIGHSCORE_STORE_CAPACITY ? store.count : HIGHSCORE_STORE_CAPACITY - 1;
+    memmove(&store.entries[rank + 1], &store.entries[rank], (tail - rank) * sizeof(highscore_entry_t));
+
+    memcpy(store.entries[rank].name, name, 3);
+    store.entries[rank].name[3] = '\0';
+    store.entries[rank].score   = score;
+    if (store.count < HIGHSCORE_STORE_CAPACITY) {
+        store.count++;
+    }
+
+    store_dirty = true;
+    return true;
+}
+
+void highscore_store_task(void) {
+    if (!store_dirty) {
+        return;
+    }
+    store_dirty = false;
+    eeconfig_update_user_datablock(&store, 0, sizeof(store));
+}
@@ -0,0 +1,55 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game_doodle.h"  // highscore_entry_t
+
+// Persistent on-keyboard high score table.
+//
+// The table lives in the eeconfig user datablock, which on this board sits on
+// the wear-leveled flash log (quantum/wear_leveling): a save appends a few log
+// entries to the current page instead of erasing a sector, and with
+// WEAR_LEVELING_WRITE_BEHIND the page program runs from the deferred flush,
+// off the input path. Reads never touch flash - the table is mirrored into RAM
+// at boot and submissions update the mirror immediately; the actual write-out
+// happens from highscore_store_task() in the housekeeping loop.
+//
+// This backs the games' offline mode, where the host-side companion script is
+// not running to keep highscores.json.
+
+#define HIGHSCORE_STORE_CAPACITY 10
+
+/**
+ * Load the persisted table into the RAM mirror
+ * Call once from keyboard_post_init_kb; an invalid or never-written datablock
+ * yields an empty table
+ */
+void highscore_store_init(void);
+
+/**
+ * Copy the current table into dest, highest score first
+ * @param dest Destination array
+ * @param max Capacity of dest
+ * @return Number of entries copied
+ */
+uint8_t highscore_store_read(highscore_entry_t *dest, uint8_t max);
+
+/**
+ * Insert a score into the table if it ranks
+ * Updates only the RAM mirror and marks it dirty; the flash write is deferred
+ * to highscore_store_task()
+ * @param name 3-character player name (not null-terminated)
+ * @param score The achieved score
+ * @return true if the score made the table
+ */
+bool highscore_store_submit(const char name[3], uint16_t score);
+
+/**
+ * Write out a dirty table
+ * Call from housekeeping_task_user; does nothing unless a submission changed
+ * the table since the last write-out
+ */
+void highscore_store_task(void);
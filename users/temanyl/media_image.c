@@ -0,0 +1,168 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include QMK_KEYBOARD_H
+#include <string.h>
+#include "media_image.h"
+#include "display/display.h"
+#include "crc.h"
+
+// Bytes of pixel data per DATA packet: 32-byte report minus the 6-byte header
+#define IMAGE_CHUNK_PAYLOAD (RAW_EPSIZE - 6)
+
+#define IMAGE_MAX_BYTES (MEDIA_IMAGE_MAX_W * MEDIA_IMAGE_MAX_H * 2)
+#define IMAGE_MAX_CHUNKS ((IMAGE_MAX_BYTES + IMAGE_CHUNK_PAYLOAD - 1) / IMAGE_CHUNK_PAYLOAD)
+
+// ACK status codes
+#define IMAGE_STATUS_OK 0
+#define IMAGE_STATUS_BAD_CRC 1
+#define IMAGE_STATUS_MALFORMED 2
+#define IMAGE_STATUS_WRONG_STATE 3
+
+// Double buffer: the host streams into the staging plane while the panel shows the visible one;
+// a commit swaps the roles. Pixels are panel-native RGB565 (same byte order as the framebuffer).
+static uint16_t plane_a[MEDIA_IMAGE_MAX_W * MEDIA_IMAGE_MAX_H];
+static uint16_t plane_b[MEDIA_IMAGE_MAX_W * MEDIA_IMAGE_MAX_H];
+static uint16_t *staging = plane_a;
+static uint16_t *visible = plane_b;
+
+// Upload in flight
+static bool     upload_active = false;
+static uint8_t  up_width, up_height;
+static uint16_t up_x;
+static uint8_t  up_y;
+static uint16_t total_chunks;
+static uint16_t received_chunks;
+static uint8_t  received_bitmap[(IMAGE_MAX_CHUNKS + 7) / 8];
+
+// Committed image
+static bool     swap_pending  = false;
+static bool     visible_valid = false;
+static uint8_t  vis_width, vis_height;
+static uint16_t vis_x;
+static uint8_t  vis_y;
+
+static void image_ack(uint8_t subcmd, uint16_t seq, uint8_t status) {
+    uint8_t ack[RAW_EPSIZE] = {HID_CMD_IMAGE_ACK, subcmd, seq & 0xFF, (seq >> 8) & 0xFF, status, MEDIA_IMAGE_WINDOW};
+    raw_hid_send(ack, sizeof(ack));
+}
+
+bool media_image_hid_receive(uint8_t *data, uint8_t length) {
+    if (data[0] != HID_CMD_IMAGE || length < 2) {
+        return data[0] == HID_CMD_IMAGE;
+    }
+
+    switch (data[1]) {
+        case 0x00: { // BEGIN: width, height, x_lo, x_hi, y
+            if (length < 7) {
+                image_ack(0x00, 0, IMAGE_STATUS_MALFORMED);
+                break;
+            }
+            uint8_t w = data[2];
+            uint8_t h = data[3];
+            if (w == 0 || h == 0 || w > MEDIA_IMAGE_MAX_W || h > MEDIA_IMAGE_MAX_H) {
+                image_ack(0x00, 0, IMAGE_STATUS_MALFORMED);
+                break;
+            }
+            up_width        = w;
+            up_height       = h;
+            up_x            = data[4] | ((uint16_t)data[5] << 8);
+            up_y            = data[6];
+            total_chunks    = ((uint16_t)w * h * 2 + IMAGE_CHUNK_PAYLOAD - 1) / IMAGE_CHUNK_PAYLOAD;
+            received_chunks = 0;
+            memset(received_bitmap, 0, sizeof(received_bitmap));
+            upload_active = true;
+            image_ack(0x00, total_chunks, IMAGE_STATUS_OK);
+            break;
+        }
+
+        case 0x01: { // DATA: seq_lo, seq_hi, payload length, crc8, payload
+            uint16_t seq = data[2] | ((uint16_t)data[3] << 8);
+            if (!upload_active) {
+                image_ack(0x01, seq, IMAGE_STATUS_WRONG_STATE);
+                break;
+            }
+            uint8_t  count      = data[4];
+            uint16_t image_size = (uint16_t)up_width * up_height * 2;
+            uint16_t offset     = seq * IMAGE_CHUNK_PAYLOAD;
+            if (length < 6 + count || seq >= total_chunks || offset + count > image_size) {
+                image_ack(0x01, seq, IMAGE_STATUS_MALFORMED);
+                break;
+            }
+            if (crc8(&data[6], count) != data[5]) {
+                // Corruption is caught per chunk; the host resends just this one
+                image_ack(0x01, seq, IMAGE_STATUS_BAD_CRC);
+                break;
+            }
+            memcpy((uint8_t *)staging + offset, &data[6], count);
+            if (!(received_bitmap[seq / 8] & (1 << (seq % 8)))) {
+                received_bitmap[seq / 8] |= 1 << (seq % 8);
+                received_chunks++;
+            }
+            image_ack(0x01, seq, IMAGE_STATUS_OK);
+            break;
+        }
+
+        case 0x02: // COMMIT
+            if (!upload_active || received_chunks < total_chunks) {
+                image_ack(0x02, received_chunks, IMAGE_STATUS_WRONG_STATE);
+                break;
+            }
+            upload_active = false;
+            swap_pending  = true; // handed off to media_image_task() at the frame boundary
+            image_ack(0x02, total_chunks, IMAGE_STATUS_OK);
+            break;
+
+        case 0x03: // ABORT
+            upload_active = false;
+            image_ack(0x03, 0, IMAGE_STATUS_OK);
+            break;
+
+        default:
+            image_ack(data[1], 0, IMAGE_STATUS_MALFORMED);
+            break;
+    }
+    return true;
+}
+
+void media_image_draw(painter_device_t device) {
+    if (!visible_valid) {
+        return;
+    }
+    // One region transaction, like fb_flush_region: the previous image (or widget content
+    // underneath) is replaced in a single pass, never shown half-updated
+    qp_viewport(device, vis_x, vis_y, vis_x + vis_width - 1, vis_y + vis_height - 1);
+    qp_pixdata(device, visible, (uint32_t)vis_width * vis_height);
+}
+
+void media_image_task(void) {
+    if (!swap_pending) {
+        return;
+    }
+    swap_pending = false;
+
+    uint16_t *tmp = visible;
+    visible       = staging;
+    staging       = tmp;
+    vis_width     = up_width;
+    vis_height    = up_height;
+    vis_x         = up_x;
+    vis_y         = up_y;
+    visible_valid = true;
+
+    media_image_draw(display);
+}
@@ -0,0 +1,76 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "qp.h"
+
+/*
+ * Streamed host-image upload channel with double-buffered display handoff.
+ *
+ * The host streams a small RGB565 image (e.g. album art for the media widget) into an off-screen
+ * staging buffer; the panel never sees a partially-transferred frame. On commit the staging and
+ * visible buffers swap at the next frame boundary and the image is painted in one region
+ * transaction. Windowed streaming with a per-chunk CRC replaces per-packet round trips: the ACK
+ * stream is the pacing signal, and the host keeps up to the advertised window of chunks in flight,
+ * resending only the ones that are NAKed or never acknowledged.
+ *
+ * Upload (computer -> keyboard, 32 bytes, byte 0 = 0x26 / HID_CMD_IMAGE):
+ *   Byte 1 = 0x00 BEGIN:  width, height, x_lo, x_hi, y (panel position; image must fit
+ *            MEDIA_IMAGE_MAX_W x MEDIA_IMAGE_MAX_H). Resets staging and drops any upload in flight.
+ *   Byte 1 = 0x01 DATA:   seq_lo, seq_hi, payload length, crc8 of payload, payload bytes.
+ *            Chunk seq covers bytes [seq * payload capacity, ...) of the raw RGB565 stream; chunks
+ *            may arrive in any order within the window and duplicates are harmless.
+ *   Byte 1 = 0x02 COMMIT: no payload. Valid only when every chunk has been received.
+ *   Byte 1 = 0x03 ABORT:  drop the upload in flight; the visible image is untouched.
+ *
+ * ACK (keyboard -> computer, 32 bytes): {0x27, subcommand echoed, seq_lo, seq_hi, status, window}
+ *   status: 0 = ok, 1 = bad CRC (resend this chunk), 2 = out of range/malformed, 3 = wrong state
+ *   window: chunks the host may keep unacknowledged (backpressure feedback)
+ *   For BEGIN and COMMIT the seq field carries the total chunk count instead of a sequence number.
+ *
+ * The swap itself happens in media_image_task() at the display frame boundary, like timeline
+ * keyframes, so it can never interleave with an in-progress flush.
+ */
+
+#define HID_CMD_IMAGE 0x26
+#define HID_CMD_IMAGE_ACK 0x27
+
+// Largest accepted image; sizes both pixel buffers (two of max_w * max_h * 2 bytes)
+#ifndef MEDIA_IMAGE_MAX_W
+#    define MEDIA_IMAGE_MAX_W 48
+#endif
+#ifndef MEDIA_IMAGE_MAX_H
+#    define MEDIA_IMAGE_MAX_H 48
+#endif
+
+// Advertised window: chunks the host may keep in flight before waiting for ACKs
+#ifndef MEDIA_IMAGE_WINDOW
+#    define MEDIA_IMAGE_WINDOW 8
+#endif
+
+// Handles upload packets; returns true if the packet was consumed.
+bool media_image_hid_receive(uint8_t *data, uint8_t length);
+
+// Performs a pending buffer swap and paints the newly visible image. Called once per display
+// frame from hid_inbox_task().
+void media_image_task(void);
+
+// Repaints the visible image, if any (e.g. after a full info-area redraw painted over it).
+void media_image_draw(painter_device_t device);
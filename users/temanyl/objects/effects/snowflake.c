@@ -18,11 +18,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "snowflake.h"
 #include "../../display/framebuffer.h"
 
-// Snowflake color configuration (HSV)
-#define SNOWFLAKE_HUE 170  // Cyan/blue-white
-#define SNOWFLAKE_SAT 80   // Low saturation for white appearance
-#define SNOWFLAKE_VAL 255  // Maximum brightness
-
 // Initialize a snowflake
 void snowflake_init(snowflake_t* flake, int16_t x, int16_t y) {
     flake->x = x;
@@ -23,6 +23,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // Snowflake dimensions (cross pattern with center)
 #define SNOWFLAKE_SIZE 6  // Total size of cross pattern
 
+// Snowflake color configuration (HSV) - shared with the batched particle draw
+// pass in weather_effects.c
+#define SNOWFLAKE_HUE 170  // Cyan/blue-white
+#define SNOWFLAKE_SAT 80   // Low saturation for white appearance
+#define SNOWFLAKE_VAL 255  // Maximum brightness
+
 // Snowflake structure
 typedef struct {
     int16_t x;
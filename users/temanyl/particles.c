@@ -0,0 +1,100 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "particles.h"
+
+// Structure-of-arrays pool: lanes [0, part_count) are live, the rest are free
+static int16_t  part_x[PARTICLE_POOL_SIZE];
+static int16_t  part_y[PARTICLE_POOL_SIZE];
+static int8_t   part_vx[PARTICLE_POOL_SIZE];
+static int8_t   part_vy[PARTICLE_POOL_SIZE];
+static uint16_t part_count = 0;
+
+void particles_reset(void) {
+    part_count = 0;
+}
+
+bool particles_spawn(int16_t x, int16_t y, int8_t vx, int8_t vy) {
+    if (part_count >= PARTICLE_POOL_SIZE) {
+        return false;
+    }
+    part_x[part_count]  = x;
+    part_y[part_count]  = y;
+    part_vx[part_count] = vx;
+    part_vy[part_count] = vy;
+    part_count++;
+    return true;
+}
+
+void particles_kill_one(void) {
+    if (part_count > 0) {
+        part_count--;
+    }
+}
+
+uint16_t particles_active(void) {
+    return part_count;
+}
+
+void particles_set_velocity_all(int8_t vx, int8_t vy) {
+    for (uint16_t i = 0; i < part_count; i++) {
+        part_vx[i] = vx;
+        part_vy[i] = vy;
+    }
+}
+
+// Cheap per-lane hash for respawn scatter; mirrors the index-based
+// pseudo-random placement the old per-struct systems used
+static inline int16_t particles_scatter(uint16_t i, int16_t min, uint8_t span) {
+    if (span == 0) {
+        return min;
+    }
+    return min + (int16_t)(((i * 13u) + ((i >> 2) * 7u)) % span);
+}
+
+void particles_update(const particle_field_t *field) {
+    // Integration first: a straight-line pass over the dense arrays
+    for (uint16_t i = 0; i < part_count; i++) {
+        part_x[i] += part_vx[i];
+        part_y[i] += part_vy[i];
+    }
+
+    // Policy pass: wrap and respawn (branches here are rare per lane)
+    for (uint16_t i = 0; i < part_count; i++) {
+        if (part_x[i] < 0) {
+            part_x[i] = field->wrap_x_max;
+        } else if (part_x[i] > field->wrap_x_max) {
+            part_x[i] = 0;
+        }
+
+        if (part_y[i] >= field->kill_y) {
+            part_y[i] = particles_scatter(i, field->respawn_y_min, field->respawn_y_span);
+            part_x[i] = particles_scatter(i * 3u + 1u, field->respawn_x_min, field->respawn_x_span);
+        }
+    }
+}
+
+uint16_t particles_positions(const int16_t **xs, const int16_t **ys) {
+    *xs = part_x;
+    *ys = part_y;
+    return part_count;
+}
+
+bool particles_bounds(int16_t *x1, int16_t *y1, int16_t *x2, int16_t *y2) {
+    if (part_count == 0) {
+        return false;
+    }
+    int16_t min_x = part_x[0], max_x = part_x[0];
+    int16_t min_y = part_y[0], max_y = part_y[0];
+    for (uint16_t i = 1; i < part_count; i++) {
+        if (part_x[i] < min_x) min_x = part_x[i];
+        if (part_x[i] > max_x) max_x = part_x[i];
+        if (part_y[i] < min_y) min_y = part_y[i];
+        if (part_y[i] > max_y) max_y = part_y[i];
+    }
+    *x1 = min_x;
+    *y1 = min_y;
+    *x2 = max_x;
+    *y2 = max_y;
+    return true;
+}
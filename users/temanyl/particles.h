@@ -0,0 +1,80 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Fixed-pool particle engine for the weather effects.
+//
+// Storage is structure-of-arrays: positions and velocities live in parallel
+// int16/int8 arrays, so the per-tick integration is a tight sequential loop
+// over contiguous memory instead of a pointer walk over per-particle structs.
+// The pool recycles by swap-with-last: live particles stay dense at the front
+// of the arrays, killing one moves the last live lane into its slot, and the
+// free lanes are simply everything past the live count. Batch loops therefore
+// never test an alive flag.
+//
+// Motion policy (wrap, kill line, respawn window) is supplied per system via
+// particle_field_t so rain and snow can share the engine with different
+// parameters.
+
+#define PARTICLE_POOL_SIZE 160
+
+// Per-system motion policy applied by particles_update()
+typedef struct {
+    int16_t wrap_x_max;     // Horizontal wrap: x < 0 goes to wrap_x_max, x > wrap_x_max goes to 0
+    int16_t kill_y;         // Respawn a particle when its y reaches this line
+    int16_t respawn_y_min;  // Respawn window: y in [respawn_y_min, respawn_y_min + respawn_y_span)
+    uint8_t respawn_y_span;
+    int16_t respawn_x_min;  // Respawn window: x in [respawn_x_min, respawn_x_min + respawn_x_span)
+    uint8_t respawn_x_span;
+} particle_field_t;
+
+/**
+ * Kill all particles
+ */
+void particles_reset(void);
+
+/**
+ * Spawn a particle
+ * @return true if a pool lane was free
+ */
+bool particles_spawn(int16_t x, int16_t y, int8_t vx, int8_t vy);
+
+/**
+ * Kill one particle (the most recently spawned surviving lane)
+ * Used to trim the population when intensity drops
+ */
+void particles_kill_one(void);
+
+/**
+ * Number of live particles
+ */
+uint16_t particles_active(void);
+
+/**
+ * Set every live particle's velocity
+ * The weather systems are wind-driven: drift applies uniformly each tick
+ */
+void particles_set_velocity_all(int8_t vx, int8_t vy);
+
+/**
+ * Integrate one tick: position += velocity, then apply the field's wrap and
+ * respawn policy. One pass over the dense arrays
+ */
+void particles_update(const particle_field_t *field);
+
+/**
+ * Expose the dense position arrays for a batched draw pass
+ * Valid until the next spawn/kill/update
+ * @return Number of live particles in xs/ys
+ */
+uint16_t particles_positions(const int16_t **xs, const int16_t **ys);
+
+/**
+ * Bounding box over all live particles (positions only; the caller pads by its
+ * sprite extent). Returns false if no particles are live
+ */
+bool particles_bounds(int16_t *x1, int16_t *y1, int16_t *x2, int16_t *y2);
@@ -0,0 +1,92 @@
+# Shared userspace for the temanyl boards. Keymaps named "temanyl" pick this up
+# automatically; chocmanyl36's "default" keymap opts in with USER_NAME = temanyl.
+
+SRC += temanyl.c
+
+# tap_dance_actions[] lives in the userspace, so pull it into the keymap
+# introspection TU alongside keymap.c -- tap_dance_count() takes
+# ARRAY_SIZE(tap_dance_actions) and needs the array visible at compile time
+ifeq ($(strip $(TAP_DANCE_ENABLE)), yes)
+    INTROSPECTION_KEYMAP_C = tap_dances.c
+endif
+
+# Feature-gated modules; boards opt in from their keymap rules.mk and bake their
+# panel geometry/pins in at compile time via config.h (see display/display.c and
+# display/framebuffer.h for the overridable constants)
+TEMANYL_DISPLAY_ENGINE ?= no
+TEMANYL_GAMES ?= no
+
+# The games render through the display engine's framebuffer and sprite batcher
+ifeq ($(strip $(TEMANYL_GAMES)), yes)
+    TEMANYL_DISPLAY_ENGINE := yes
+endif
+
+ifeq ($(strip $(TEMANYL_DISPLAY_ENGINE)), yes)
+    OPT_DEFS += -DTEMANYL_DISPLAY_ENGINE
+
+    QUANTUM_PAINTER_ENABLE = yes
+    QUANTUM_PAINTER_DRIVERS += st7789_spi
+
+    # Background (DMA) pixel transmission: flushes hand chunks to the SPI peripheral and return
+    # instead of spinning until the last byte is on the wire (see qp_comms_spi.c)
+    QUANTUM_PAINTER_SPI_DMA = yes
+
+    # Cache decoded sprite frames; the weather scenes redraw the same images every frame
+    QUANTUM_PAINTER_IMAGE_CACHE = yes
+
+    # Cache decoded glyphs; the status bar redraws its text on every WPM tick
+    QUANTUM_PAINTER_GLYPH_ATLAS = yes
+
+    # Record repeated widget draw sequences once, replay with substituted parameters (volume bar)
+    QUANTUM_PAINTER_CMDLIST = yes
+
+    # Framebuffer support
+    SRC += display/framebuffer.c
+
+    # Round-robin flush scheduling across one or more panels
+    SRC += display/display_sched.c
+
+    # Display and scene rendering
+    SRC += display/display.c scenes/scenes.c
+
+    # Retained-mode scene graph with per-object dirty tracking
+    SRC += scenes/scene_graph.c
+
+    # Raw HID protocol v2 (framed multi-field updates from keyboard_monitor.py)
+    SRC += hid_protocol.c
+
+    # Raw HID inbox (state pushes applied at frame boundaries)
+    SRC += hid_inbox.c
+
+    # Firmware-side scene timeline (uploaded keyframe schedule, see scene_timeline.h)
+    SRC += scene_timeline.c
+
+    # Streamed host-image upload with double-buffered handoff (see media_image.h); CRC for its per-chunk checks
+    SRC += media_image.c
+    CRC_ENABLE = yes
+
+    # Scene state snapshot/restore across reboots (see scene_store.h)
+    SRC += scene_store.c
+
+    # Season modules
+    SRC += seasons/winter/seasons_winter.c seasons/spring/seasons_spring.c seasons/summer/seasons_summer.c seasons/fall/seasons_fall.c seasons/halloween/seasons_halloween.c seasons/christmas/seasons_christmas.c seasons/easter/seasons_easter.c seasons/newyear/seasons_newyear.c
+
+    # Weather transition system
+    SRC += weather_transition.c weather_effects.c particles.c
+
+    # Drawable objects
+    SRC += objects/seasonal/pumpkin.c objects/seasonal/ghost.c objects/seasonal/snowman.c objects/seasonal/easter_egg.c
+    SRC += objects/weather/smoke.c objects/weather/cloud.c objects/weather/raindrop.c objects/weather/wind.c
+    SRC += objects/celestial/sun.c objects/celestial/moon.c objects/celestial/stars.c objects/celestial/astronomical.c
+    SRC += objects/structures/tree.c objects/structures/cabin.c
+    SRC += objects/flora/flower.c objects/flora/sunflower.c objects/flora/fallen_leaf.c
+    SRC += objects/fauna/bird.c objects/fauna/butterfly.c objects/fauna/bee.c objects/fauna/firefly.c objects/fauna/bunny.c
+    SRC += objects/effects/snowflake.c objects/effects/snow_drift.c objects/effects/airplane.c
+endif
+
+ifeq ($(strip $(TEMANYL_GAMES)), yes)
+    OPT_DEFS += -DTEMANYL_ENABLE_GAMES
+
+    # Games (Doodle Jump, Tetris) with sprite batching and the persisted high score table
+    SRC += game_doodle.c game_tetris.c game_manager.c sprite_batch.c highscore_store.c
+endif
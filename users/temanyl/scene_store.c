@@ -0,0 +1,137 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "eeconfig.h"
+#include <string.h>
+#include "scene_store.h"
+#include "display/display.h"
+#include "weather_transition.h"
+#include "objects/weather/wind.h"
+
+// The snapshot shares the eeconfig user datablock with the high score table
+// (highscore_store.c, offset 0); it sits in the tail the table does not use.
+// The magic byte doubles as a layout version: eeconfig_init_user_datablock()
+// zeroes the block, so a fresh or stale snapshot reads as invalid. Bump the
+// magic when the layout changes.
+#define SCENE_STORE_EECONFIG_OFFSET 64
+#define SCENE_STORE_MAGIC 0x5C
+
+// Quiet period before a changed snapshot is committed. Long enough that a
+// volume sweep or a multi-field v2 frame burst lands as a single write, short
+// enough that a weather change survives a power cycle moments later
+#define SCENE_STORE_SETTLE_MS 5000
+
+typedef struct {
+    uint8_t  magic;
+    uint8_t  weather;        // weather_state_t
+    uint8_t  wind_intensity; // wind_intensity_t
+    uint8_t  wind_direction; // wind_direction_t
+    uint8_t  volume;         // 0-100
+    uint8_t  month;          // 1-12; 0 = no date/time was ever received
+    uint8_t  day;
+    uint8_t  hour;
+    uint8_t  minute;
+    uint16_t year;
+} scene_snapshot_t;
+
+_Static_assert(SCENE_STORE_EECONFIG_OFFSET + sizeof(scene_snapshot_t) <= EECONFIG_USER_DATA_SIZE, "scene snapshot exceeds eeconfig user datablock");
+
+// Last snapshot known to be in flash (or pending write-out)
+static scene_snapshot_t stored;
+static bool             stored_valid   = false;
+static bool             store_dirty    = false;
+static uint32_t         settle_timer   = 0;
+
+static void capture(scene_snapshot_t *snap) {
+    snap->magic          = SCENE_STORE_MAGIC;
+    snap->weather        = (uint8_t)weather_transition_get_current();
+    snap->wind_intensity = (uint8_t)wind_get_intensity();
+    snap->wind_direction = (uint8_t)wind_get_direction();
+    snap->volume         = current_volume;
+    if (time_received) {
+        snap->month  = current_month;
+        snap->day    = current_day;
+        snap->hour   = current_hour;
+        snap->minute = current_minute;
+        snap->year   = current_year;
+    } else {
+        // No time yet this boot: keep whatever the snapshot already holds
+        // rather than clobbering a restored date with defaults
+        snap->month  = stored.month;
+        snap->day    = stored.day;
+        snap->hour   = stored.hour;
+        snap->minute = stored.minute;
+        snap->year   = stored.year;
+    }
+}
+
+void scene_store_init(void) {
+    if (!eeconfig_is_user_datablock_valid()) {
+        return;
+    }
+    eeconfig_read_user_datablock(&stored, SCENE_STORE_EECONFIG_OFFSET, sizeof(stored));
+    if (stored.magic != SCENE_STORE_MAGIC) {
+        memset(&stored, 0, sizeof(stored));
+        return;
+    }
+    stored_valid = true;
+
+#ifndef HARDCODE_DATE_TIME
+    if (stored.month >= 1 && stored.month <= 12) {
+        current_year   = stored.year;
+        current_month  = stored.month;
+        current_day    = stored.day <= 31 && stored.day >= 1 ? stored.day : 1;
+        current_hour   = stored.hour <= 23 ? stored.hour : 0;
+        current_minute = stored.minute <= 59 ? stored.minute : 0;
+        // The clock resumes from the pre-reboot time (stale by the reboot
+        // duration) and ticks on uptime until the host pushes a correction
+        time_received      = true;
+        last_uptime_update = timer_read32();
+    }
+#endif
+    if (stored.volume <= 100) {
+        current_volume = stored.volume;
+    }
+}
+
+void scene_store_apply_environment(void) {
+    if (!stored_valid) {
+        return;
+    }
+    // set_target switches the current weather immediately; no crossfade has
+    // been staged this early, so the first paint renders the restored scene
+    if (stored.weather <= WEATHER_OVERCAST) {
+        weather_transition_set_target((weather_state_t)stored.weather);
+    }
+    if (stored.wind_intensity <= WIND_HIGH && stored.wind_direction <= WIND_RIGHT) {
+        wind_set_state((wind_intensity_t)stored.wind_intensity, (wind_direction_t)stored.wind_direction);
+    }
+}
+
+void scene_store_task(void) {
+    scene_snapshot_t live;
+    capture(&live);
+
+    // The minute (and the hour/day/year it rolls into) rides along with other
+    // changes instead of driving a flash write every 60 seconds of uptime:
+    // compare everything but the clock fields
+    scene_snapshot_t cmp = live;
+    cmp.minute           = stored.minute;
+    cmp.hour             = stored.hour;
+    cmp.day              = stored.day;
+    cmp.year             = stored.year;
+    if (memcmp(&cmp, &stored, sizeof(cmp)) != 0) {
+        stored       = live;
+        stored_valid = true;
+        store_dirty  = true;
+        settle_timer = timer_read32();
+        return; // Still changing; wait for the state to settle
+    }
+
+    if (!store_dirty || timer_elapsed32(settle_timer) < SCENE_STORE_SETTLE_MS) {
+        return;
+    }
+    store_dirty = false;
+    eeconfig_update_user_datablock(&stored, SCENE_STORE_EECONFIG_OFFSET, sizeof(stored));
+}
@@ -0,0 +1,46 @@
+// Copyright 2025
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Persistent scene state snapshot.
+//
+// After a flash or power cycle the display used to come up on the seasonal
+// default scene and sit there until keyboard_monitor.py re-pushed weather,
+// wind, volume and date/time - tens of seconds of stale UI plus a burst of
+// HID traffic. This module snapshots that state into the eeconfig user
+// datablock (offset 64, after the high score table) and restores it at boot
+// before the first paint, so a reboot is visually seamless and the host only
+// needs to correct the clock drift.
+//
+// Like the high score table, the snapshot rides the wear-leveled flash log:
+// writes append only the changed bytes to the current page, and the page
+// program runs from the deferred flush off the input path. Writes are further
+// debounced in scene_store_task() so a burst of host pushes (volume ticks, a
+// multi-field v2 frame) commits once, during the idle window after the burst.
+
+/**
+ * Load the persisted snapshot and restore date/time and volume
+ * Call from keyboard_post_init_deferred_kb BEFORE init_display(), so the
+ * restored month selects the right season for the first paint. An invalid or
+ * never-written snapshot leaves the defaults untouched
+ */
+void scene_store_init(void);
+
+/**
+ * Restore the persisted weather and wind state
+ * Called from init_display() after weather_transition_init()/wind_init() have
+ * set their seasonal defaults but before the first paint; a no-op when no
+ * valid snapshot was loaded
+ */
+void scene_store_apply_environment(void);
+
+/**
+ * Snapshot the live scene state and write it out once it settles
+ * Call from housekeeping_task_user; does nothing until the state has been
+ * stable for a few seconds, so bursts of host pushes coalesce into one write
+ */
+void scene_store_task(void);
@@ -0,0 +1,383 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include QMK_KEYBOARD_H
+#include <string.h>
+#include "scene_timeline.h"
+
+#ifdef SCENE_TIMELINE_PREFETCH
+#    include "display/display.h"
+#    include "display/framebuffer.h"
+#    include "weather_transition.h"
+#endif
+
+#define TIMELINE_HEADER_SIZE 4
+#define TIMELINE_FLAG_LOOP (1 << 0)
+
+// Field sizes in entry payloads, matching the v2 frame layout (media is not schedulable)
+#define TIMELINE_FIELDS_VALID (HID_FRAME_FIELD_DATETIME | HID_FRAME_FIELD_VOLUME | HID_FRAME_FIELD_WEATHER | HID_FRAME_FIELD_WIND)
+
+static uint8_t  schedule[SCENE_TIMELINE_BUFFER_SIZE];
+static uint16_t schedule_len = 0; // bytes uploaded so far
+
+static bool     timeline_active = false;
+static uint32_t timeline_start  = 0; // timer_read32() at start
+static uint16_t read_pos        = 0; // byte offset of the next unapplied entry
+static uint8_t  entries_applied = 0;
+
+#ifdef SCENE_TIMELINE_PREFETCH
+// How far ahead of a scene-changing keyframe the incoming scene may be pre-rendered
+#    ifndef SCENE_TIMELINE_PREFETCH_WINDOW_MS
+#        define SCENE_TIMELINE_PREFETCH_WINDOW_MS 3000
+#    endif
+// The pre-render only runs on an idle frame; below this input gap it waits (and falls back to
+// rendering at the keyframe offset, i.e. today's behavior, if the user types through the window)
+#    ifndef SCENE_TIMELINE_PREFETCH_IDLE_MS
+#        define SCENE_TIMELINE_PREFETCH_IDLE_MS 250
+#    endif
+
+// A scene-changing keyframe has been pre-applied; the held crossfade releases at this offset
+static bool     prefetch_held = false;
+static uint32_t prefetch_release_offset;
+#endif
+
+// Datetime interpolation segment: the last applied and the next upcoming datetime keyframe
+static bool     interp_valid = false;
+static uint32_t interp_from_offset, interp_to_offset;
+static uint8_t  interp_from[7], interp_to[7];
+static uint32_t interp_last_minutes;
+
+static uint8_t entry_count(void) {
+    return schedule_len >= TIMELINE_HEADER_SIZE ? schedule[0] : 0;
+}
+
+static uint8_t timeline_flags(void) {
+    return schedule_len >= TIMELINE_HEADER_SIZE ? schedule[1] : 0;
+}
+
+static uint32_t read_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Returns the payload size of one entry's fields, or 0 when the bitmap is invalid
+static uint16_t fields_size(uint8_t fields) {
+    if (fields & (uint8_t)~TIMELINE_FIELDS_VALID) {
+        return 0;
+    }
+    uint16_t size = 0;
+    if (fields & HID_FRAME_FIELD_DATETIME) size += 7;
+    if (fields & HID_FRAME_FIELD_VOLUME) size += 1;
+    if (fields & HID_FRAME_FIELD_WEATHER) size += 1;
+    if (fields & HID_FRAME_FIELD_WIND) size += 2;
+    return size;
+}
+
+// Total encoded size of the entry at byte offset pos, or 0 when it doesn't parse
+static uint16_t entry_size(uint16_t pos) {
+    if (pos + 5 > schedule_len) {
+        return 0;
+    }
+    uint16_t payload = fields_size(schedule[pos + 4]);
+    if (payload == 0 || pos + 5 + payload > schedule_len) {
+        return 0;
+    }
+    return 5 + payload;
+}
+
+// Simulated-clock position of a datetime payload within its month, in minutes
+static uint32_t datetime_minutes(const uint8_t *dt) {
+    return (((uint32_t)(dt[3] - 1) * 24 + dt[4]) * 60) + dt[5];
+}
+
+static void timeline_stop(void) {
+    timeline_active = false;
+    interp_valid    = false;
+#ifdef SCENE_TIMELINE_PREFETCH
+    if (prefetch_held) {
+        // The pre-applied state is already live in fb; fade to it now rather
+        // than leaving the panel pinned on the outgoing scene forever
+        fb_crossfade_release();
+        prefetch_held = false;
+    }
+#endif
+}
+
+static void timeline_rewind(void) {
+    timeline_start  = timer_read32();
+    read_pos        = TIMELINE_HEADER_SIZE;
+    entries_applied = 0;
+    interp_valid    = false;
+#ifdef SCENE_TIMELINE_PREFETCH
+    if (prefetch_held) {
+        fb_crossfade_release();
+        prefetch_held = false;
+    }
+#endif
+}
+
+// Scans forward from pos for the next entry carrying a datetime field, to close an
+// interpolation segment after a datetime keyframe was applied
+static void interp_find_target(uint16_t pos) {
+    interp_valid = false;
+    while (true) {
+        uint16_t size = entry_size(pos);
+        if (size == 0) {
+            return;
+        }
+        if (schedule[pos + 4] & HID_FRAME_FIELD_DATETIME) {
+            interp_to_offset = read_u32(&schedule[pos]);
+            memcpy(interp_to, &schedule[pos + 5], 7);
+            // Only interpolate into a keyframe the clock can advance towards; a rollover
+            // (month change, day reset) is applied as a jump at its own offset
+            interp_valid = interp_to[2] == interp_from[2] && interp_to[1] == interp_from[1] && interp_to[0] == interp_from[0] && datetime_minutes(interp_to) > datetime_minutes(interp_from) && interp_to_offset > interp_from_offset;
+            return;
+        }
+        pos += size;
+    }
+}
+
+// Applies the entry at read_pos and advances past it; returns false when parsing fails
+static bool apply_entry(hid_redraw_t *redraw_out) {
+    uint16_t size = entry_size(read_pos);
+    if (size == 0) {
+        return false;
+    }
+
+    uint8_t        fields = schedule[read_pos + 4];
+    const uint8_t *p      = &schedule[read_pos + 5];
+
+    if (fields & HID_FRAME_FIELD_DATETIME) {
+        *redraw_out = hid_redraw_max(*redraw_out, hid_apply_datetime(p));
+        // This keyframe opens the next interpolation segment
+        interp_from_offset = read_u32(&schedule[read_pos]);
+        memcpy(interp_from, p, 7);
+        interp_last_minutes = datetime_minutes(interp_from);
+        p += 7;
+    }
+    if (fields & HID_FRAME_FIELD_VOLUME) {
+        *redraw_out = hid_redraw_max(*redraw_out, hid_apply_volume(p[0]));
+        p += 1;
+    }
+    if (fields & HID_FRAME_FIELD_WEATHER) {
+        *redraw_out = hid_redraw_max(*redraw_out, hid_apply_weather(p[0]));
+        p += 1;
+    }
+    if (fields & HID_FRAME_FIELD_WIND) {
+        *redraw_out = hid_redraw_max(*redraw_out, hid_apply_wind(p[0], p[1]));
+        p += 2;
+    }
+
+    read_pos += size;
+    entries_applied++;
+    if (fields & HID_FRAME_FIELD_DATETIME) {
+        interp_find_target(read_pos);
+    }
+    return true;
+}
+
+#ifdef SCENE_TIMELINE_PREFETCH
+// Whether applying the entry at pos would invalidate the scene background: a weather change, or a
+// datetime whose month differs (season switch). Entries that only move the clock or the volume bar
+// are not worth a held pre-render.
+static bool entry_changes_scene(uint16_t pos) {
+    uint8_t        fields = schedule[pos + 4];
+    const uint8_t *p      = &schedule[pos + 5];
+    if (fields & HID_FRAME_FIELD_DATETIME) {
+        if (p[2] != current_month) {
+            return true;
+        }
+        p += 7;
+    }
+    if (fields & HID_FRAME_FIELD_VOLUME) {
+        p += 1;
+    }
+    if (fields & HID_FRAME_FIELD_WEATHER) {
+        if ((weather_state_t)p[0] != weather_transition_get_current()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Pre-applies the next keyframe when it is close, scene-changing, and the board is idle. The full
+// scene render (the former transition hitch) happens at this frame boundary into fb behind a held
+// crossfade: the panel keeps showing the outgoing scene (display_housekeeping_task also pauses
+// per-object animation while a fade is active, so nothing repaints over the staged scene), and
+// when the keyframe's offset arrives the fade is released -- the transition then costs only the
+// blend stream, never a render.
+static void prefetch_step(uint32_t elapsed, hid_redraw_t *redraw_out) {
+    if (prefetch_held) {
+        if (elapsed >= prefetch_release_offset) {
+            fb_crossfade_release();
+            prefetch_held = false;
+        }
+        return;
+    }
+    if (entries_applied >= entry_count() || entry_size(read_pos) == 0) {
+        return;
+    }
+    uint32_t offset = read_u32(&schedule[read_pos]);
+    if (offset <= elapsed || offset - elapsed > SCENE_TIMELINE_PREFETCH_WINDOW_MS) {
+        return;
+    }
+    if (last_input_activity_elapsed() < SCENE_TIMELINE_PREFETCH_IDLE_MS || fb_crossfade_active()) {
+        return;
+    }
+    if (!entry_changes_scene(read_pos)) {
+        return;
+    }
+
+    fb_crossfade_begin_held(WEATHER_CROSSFADE_DURATION_MS);
+    prefetch_release_offset = offset;
+    prefetch_held           = true;
+    if (!apply_entry(redraw_out)) {
+        fb_crossfade_release();
+        prefetch_held = false;
+        timeline_stop();
+    }
+}
+#endif // SCENE_TIMELINE_PREFETCH
+
+// Advances the simulated clock linearly between the two datetime keyframes bracketing `elapsed`
+static void interp_step(uint32_t elapsed, hid_redraw_t *redraw_out) {
+    if (!interp_valid || elapsed <= interp_from_offset) {
+        return;
+    }
+
+    uint32_t m0      = datetime_minutes(interp_from);
+    uint32_t m1      = datetime_minutes(interp_to);
+    uint32_t span    = interp_to_offset - interp_from_offset;
+    uint32_t minutes = m0 + (uint32_t)(((uint64_t)(m1 - m0) * (elapsed - interp_from_offset)) / span);
+    if (minutes == interp_last_minutes) {
+        return;
+    }
+    interp_last_minutes = minutes;
+
+    // Year and month carry over from the segment start; day/hour/minute come from the clock
+    uint8_t payload[7];
+    payload[0] = interp_from[0];
+    payload[1] = interp_from[1];
+    payload[2] = interp_from[2];
+    payload[3] = (uint8_t)(minutes / (24 * 60)) + 1;
+    payload[4] = (uint8_t)((minutes / 60) % 24);
+    payload[5] = (uint8_t)(minutes % 60);
+    payload[6] = 0;
+
+    *redraw_out = hid_redraw_max(*redraw_out, hid_apply_datetime(payload));
+}
+
+bool scene_timeline_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case HID_CMD_TIMELINE_LOAD: {
+            if (length < 3) {
+                return true;
+            }
+            uint8_t chunk = data[1];
+            uint8_t count = data[2];
+            uint8_t status;
+
+            if (chunk == 0) {
+                // New upload: playback stops so applies never race a partially-written schedule
+                timeline_stop();
+                schedule_len = 0;
+            }
+
+            if (count > length - 3) {
+                status = 2; // malformed
+            } else if (schedule_len + count > SCENE_TIMELINE_BUFFER_SIZE) {
+                status = 1; // overflow; raise SCENE_TIMELINE_BUFFER_SIZE
+            } else {
+                memcpy(&schedule[schedule_len], &data[3], count);
+                schedule_len += count;
+                status = 0;
+            }
+
+            uint8_t ack[RAW_EPSIZE] = {HID_CMD_TIMELINE_LOAD_ACK, chunk, status};
+            raw_hid_send(ack, sizeof(ack));
+            return true;
+        }
+
+        case HID_CMD_TIMELINE_CTRL: {
+            if (length < 2) {
+                return true;
+            }
+            switch (data[1]) {
+                case 0: // stop
+                    timeline_stop();
+                    break;
+                case 1: // start from the beginning
+                    if (entry_count() > 0) {
+                        timeline_rewind();
+                        timeline_active = true;
+                    }
+                    break;
+                case 2: { // status query
+                    uint8_t status[RAW_EPSIZE] = {HID_CMD_TIMELINE_CTRL, 2, timeline_active, entry_count(), entries_applied};
+                    raw_hid_send(status, sizeof(status));
+                    break;
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void scene_timeline_task(hid_redraw_t *redraw_out) {
+    if (!timeline_active) {
+        return;
+    }
+
+    uint32_t elapsed = timer_elapsed32(timeline_start);
+
+    // Apply every keyframe that has come due since the last frame, in schedule order
+    while (entries_applied < entry_count() && read_pos + 5 <= schedule_len && read_u32(&schedule[read_pos]) <= elapsed) {
+        if (!apply_entry(redraw_out)) {
+            timeline_stop(); // schedule doesn't parse past this point; bail out
+            return;
+        }
+    }
+
+#ifdef SCENE_TIMELINE_PREFETCH
+    prefetch_step(elapsed, redraw_out);
+    if (!timeline_active) {
+        return; // prefetch hit an unparseable entry and stopped the timeline
+    }
+    if (prefetch_held) {
+        // A pre-applied keyframe is waiting for its offset; hold off the
+        // completion check so a pre-applied final entry doesn't loop or stop
+        // the timeline before its fade has even been released
+        interp_step(elapsed, redraw_out);
+        return;
+    }
+#endif
+
+    if (entries_applied >= entry_count()) {
+        if (timeline_flags() & TIMELINE_FLAG_LOOP) {
+            timeline_rewind();
+        } else {
+            timeline_stop();
+        }
+        return;
+    }
+
+    interp_step(elapsed, redraw_out);
+}
+
+bool scene_timeline_is_active(void) {
+    return timeline_active;
+}
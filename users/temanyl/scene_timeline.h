@@ -0,0 +1,81 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hid_protocol.h"
+
+/*
+ * Firmware-side scene timeline.
+ *
+ * season_simulator.py used to drive scene changes by streaming one datetime packet per simulated
+ * hour, so transition timing was bound to host scheduling jitter and the link never went quiet.
+ * Instead, the host now uploads a compact binary schedule once and the firmware advances it
+ * locally: keyframes are applied frame-accurately against the local clock, datetime is linearly
+ * interpolated between consecutive datetime keyframes, and steady-state HID traffic drops to zero.
+ *
+ * Upload (computer -> keyboard, 32 bytes):
+ *   Byte 0: 0x22 (HID_CMD_TIMELINE_LOAD)
+ *   Byte 1: chunk index (0 stops playback and resets the write cursor; chunks arrive in order)
+ *   Byte 2: payload byte count
+ *   Bytes 3..: schedule bytes, appended verbatim
+ * ACK (keyboard -> computer): {0x23, chunk index, status} with status 0 = ok, 1 = overflow,
+ * 2 = malformed.
+ *
+ * Control (computer -> keyboard):
+ *   Byte 0: 0x24 (HID_CMD_TIMELINE_CTRL)
+ *   Byte 1: 0 = stop, 1 = start from the beginning, 2 = status query
+ * The status response is {0x24, 2, active, entry count, entries applied}.
+ *
+ * Schedule layout (after reassembly):
+ *   Header (4 bytes): entry count, flags (bit 0: loop), 2 reserved bytes
+ *   Entry: uint32 LE offset in ms from timeline start, then a v2-style field bitmap and payloads
+ *   (hid_protocol.h field order; datetime/volume/weather/wind only -- no media). Entries must be
+ *   sorted by offset.
+ *
+ * Between two datetime keyframes the simulated clock advances linearly in minutes, carrying
+ * year/month from the earlier keyframe; a keyframe whose day/hour/minute does not advance (e.g. a
+ * month rollover) is applied as a jump at its exact offset instead of being interpolated into.
+ *
+ * With SCENE_TIMELINE_PREFETCH defined, a scene-changing keyframe (weather change or season/month
+ * switch) within SCENE_TIMELINE_PREFETCH_WINDOW_MS of firing is pre-applied on an idle frame: the
+ * incoming scene renders into fb behind a held crossfade (fb_crossfade_begin_held) while the panel
+ * keeps showing the outgoing scene, and the fade is released at the keyframe's exact offset. The
+ * full-scene render -- the hitch that used to land at the transition moment -- is moved into the
+ * idle window, so the transition itself costs only the blend stream. If the user types through the
+ * whole window the keyframe simply applies at its offset as before.
+ */
+
+#define HID_CMD_TIMELINE_LOAD 0x22
+#define HID_CMD_TIMELINE_LOAD_ACK 0x23
+#define HID_CMD_TIMELINE_CTRL 0x24
+
+#ifndef SCENE_TIMELINE_BUFFER_SIZE
+#    define SCENE_TIMELINE_BUFFER_SIZE 512
+#endif
+
+// Handles timeline upload/control packets; returns true if the packet was consumed.
+bool scene_timeline_hid_receive(uint8_t *data, uint8_t length);
+
+// Advances the timeline against the local clock, applying due keyframes and interpolated
+// datetimes through the hid_apply_* functions. The combined redraw level accumulates into
+// *redraw_out; the caller flushes once per frame.
+void scene_timeline_task(hid_redraw_t *redraw_out);
+
+bool scene_timeline_is_active(void);
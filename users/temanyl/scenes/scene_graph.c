@@ -0,0 +1,236 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "scene_graph.h"
+#include "../display/framebuffer.h"
+
+// Node registry; released slots are reused by the next register call
+static scene_node_t nodes[SCENE_GRAPH_MAX_NODES];
+
+// Damage rectangles accumulated for the current render pass
+typedef struct {
+    int16_t x1, y1, x2, y2;
+    bool    used;
+} damage_rect_t;
+
+static damage_rect_t damage[SCENE_GRAPH_MAX_DAMAGE];
+
+// Two rectangles count as mergeable when they overlap or sit within this many pixels of each
+// other -- flushing the small gap between them is cheaper than a second SPI transaction
+#define DAMAGE_MERGE_SLACK 8
+
+static bool rects_overlap(int16_t ax1, int16_t ay1, int16_t ax2, int16_t ay2, int16_t bx1, int16_t by1, int16_t bx2, int16_t by2) {
+    return !(ax2 < bx1 || ax1 > bx2 || ay2 < by1 || ay1 > by2);
+}
+
+static void damage_extend(damage_rect_t *d, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (x1 < d->x1) d->x1 = x1;
+    if (y1 < d->y1) d->y1 = y1;
+    if (x2 > d->x2) d->x2 = x2;
+    if (y2 > d->y2) d->y2 = y2;
+}
+
+// Adds a rectangle to the damage set, merging with a nearby rect when possible. When all
+// slots are taken by disjoint damage, the nearest rect is widened instead -- the widened
+// area only re-composites pixels that are already correct, so this is purely a cost tradeoff.
+static void damage_add(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (x2 < x1 || y2 < y1) {
+        return;
+    }
+
+    int free_slot = -1;
+    for (int i = 0; i < SCENE_GRAPH_MAX_DAMAGE; i++) {
+        if (!damage[i].used) {
+            if (free_slot < 0) {
+                free_slot = i;
+            }
+            continue;
+        }
+        if (rects_overlap(x1 - DAMAGE_MERGE_SLACK, y1 - DAMAGE_MERGE_SLACK, x2 + DAMAGE_MERGE_SLACK, y2 + DAMAGE_MERGE_SLACK, damage[i].x1, damage[i].y1, damage[i].x2, damage[i].y2)) {
+            damage_extend(&damage[i], x1, y1, x2, y2);
+            return;
+        }
+    }
+
+    if (free_slot >= 0) {
+        damage[free_slot] = (damage_rect_t){x1, y1, x2, y2, true};
+        return;
+    }
+
+    // Damage set full; widen whichever rect is closest by center distance
+    int     nearest  = 0;
+    int32_t best     = INT32_MAX;
+    int32_t cx       = (x1 + x2) / 2;
+    int32_t cy       = (y1 + y2) / 2;
+    for (int i = 0; i < SCENE_GRAPH_MAX_DAMAGE; i++) {
+        int32_t dx   = cx - (damage[i].x1 + damage[i].x2) / 2;
+        int32_t dy   = cy - (damage[i].y1 + damage[i].y2) / 2;
+        int32_t dist = dx * dx + dy * dy;
+        if (dist < best) {
+            best    = dist;
+            nearest = i;
+        }
+    }
+    damage_extend(&damage[nearest], x1, y1, x2, y2);
+}
+
+scene_node_t *scene_node_register(uint8_t z, void (*draw)(const scene_node_t *node, void *ctx), void *ctx) {
+    for (int i = 0; i < SCENE_GRAPH_MAX_NODES; i++) {
+        if (!nodes[i].in_use) {
+            nodes[i] = (scene_node_t){
+                .x1 = 0, .y1 = 0, .x2 = -1, .y2 = -1, // Empty bounds until first move
+                .px1 = 0, .py1 = 0, .px2 = -1, .py2 = -1,
+                .z = z,
+                .dirty = false,
+                .visible = false,
+                .in_use = true,
+                .draw = draw,
+                .ctx = ctx,
+            };
+            return &nodes[i];
+        }
+    }
+    return NULL;
+}
+
+void scene_node_release(scene_node_t *node) {
+    if (node == NULL || !node->in_use) {
+        return;
+    }
+    // Leave its last rendered bounds as damage so the next pass erases it
+    damage_add(node->px1, node->py1, node->px2, node->py2);
+    node->in_use = false;
+}
+
+void scene_node_move(scene_node_t *node, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (node == NULL) {
+        return;
+    }
+    node->x1    = x1;
+    node->y1    = y1;
+    node->x2    = x2;
+    node->y2    = y2;
+    node->dirty = true;
+}
+
+void scene_node_mark_dirty(scene_node_t *node) {
+    if (node != NULL) {
+        node->dirty = true;
+    }
+}
+
+void scene_node_set_visible(scene_node_t *node, bool visible) {
+    if (node == NULL || node->visible == visible) {
+        return;
+    }
+    node->visible = visible;
+    node->dirty   = true;
+}
+
+void scene_graph_mark_all_dirty(void) {
+    for (int i = 0; i < SCENE_GRAPH_MAX_NODES; i++) {
+        if (nodes[i].in_use) {
+            nodes[i].dirty = true;
+        }
+    }
+}
+
+void scene_graph_reset(void) {
+    for (int i = 0; i < SCENE_GRAPH_MAX_NODES; i++) {
+        nodes[i].in_use = false;
+    }
+    for (int i = 0; i < SCENE_GRAPH_MAX_DAMAGE; i++) {
+        damage[i].used = false;
+    }
+}
+
+void scene_graph_render(painter_device_t display) {
+    // Pass 1: gather damage from dirty nodes (old position gets erased, new gets drawn)
+    bool any_damage = false;
+    for (int i = 0; i < SCENE_GRAPH_MAX_DAMAGE; i++) {
+        if (damage[i].used) {
+            any_damage = true;
+        }
+    }
+    for (int i = 0; i < SCENE_GRAPH_MAX_NODES; i++) {
+        scene_node_t *node = &nodes[i];
+        if (!node->in_use || !node->dirty) {
+            continue;
+        }
+        damage_add(node->px1, node->py1, node->px2, node->py2);
+        if (node->visible) {
+            damage_add(node->x1, node->y1, node->x2, node->y2);
+        }
+        node->px1   = node->x1;
+        node->py1   = node->y1;
+        node->px2   = node->x2;
+        node->py2   = node->y2;
+        node->dirty = false;
+        any_damage  = true;
+    }
+    if (!any_damage) {
+        return;
+    }
+
+    // Pass 2: restore the damaged background, then composite every intersecting node over it
+    // in z-order. Unmoved nodes overlapping the damage are redrawn too, so objects passing
+    // over each other layer correctly.
+    for (int d = 0; d < SCENE_GRAPH_MAX_DAMAGE; d++) {
+        if (!damage[d].used) {
+            continue;
+        }
+        fb_restore_from_background(damage[d].x1, damage[d].y1, damage[d].x2, damage[d].y2);
+    }
+
+    // Z levels in use are a handful of small constants; an insertion-sorted walk would be
+    // overkill for <= 64 nodes, so scan once per distinct z from low to high
+    uint8_t z = 0;
+    while (true) {
+        uint8_t next_z    = 255;
+        bool    z_pending = false;
+        for (int i = 0; i < SCENE_GRAPH_MAX_NODES; i++) {
+            scene_node_t *node = &nodes[i];
+            if (!node->in_use || !node->visible || node->x2 < node->x1) {
+                continue;
+            }
+            if (node->z == z) {
+                for (int d = 0; d < SCENE_GRAPH_MAX_DAMAGE; d++) {
+                    if (damage[d].used && rects_overlap(node->x1, node->y1, node->x2, node->y2, damage[d].x1, damage[d].y1, damage[d].x2, damage[d].y2)) {
+                        node->draw(node, node->ctx);
+                        break;
+                    }
+                }
+            } else if (node->z > z && node->z < next_z) {
+                next_z    = node->z;
+                z_pending = true;
+            }
+        }
+        if (!z_pending) {
+            break;
+        }
+        z = next_z;
+    }
+
+    // Pass 3: flush each damage rect to the panel (fb_flush_region clips to the scene area)
+    for (int d = 0; d < SCENE_GRAPH_MAX_DAMAGE; d++) {
+        if (!damage[d].used) {
+            continue;
+        }
+        fb_flush_region(display, damage[d].x1, damage[d].y1, damage[d].x2, damage[d].y2);
+        damage[d].used = false;
+    }
+}
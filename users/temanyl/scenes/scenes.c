@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdio.h>
 #include <string.h>
 #include "scenes.h"
+#include "scene_graph.h"
 #include "../display/display.h"
 #include "../display/framebuffer.h"
 #include "../display/draw_logo.h"
@@ -698,6 +699,10 @@ void draw_seasonal_animation(void) {
     if (need_background) {
         fb_save_to_background();
 
+        // The scene underneath the animated objects changed; make every registered node
+        // recomposite itself against the new background on the next render pass
+        scene_graph_mark_all_dirty();
+
         // Set the appropriate flags based on what's active
         // Use weather state for weather animations, season for seasonal elements
         weather_state_t bg_weather = weather_transition_get_current();
@@ -865,18 +870,8 @@ void draw_seasonal_animation(void) {
     // === DRAW SNOWFLAKES (snow weather) ===
     // Snowflakes are weather-based, not seasonal
     if (weather_is_snowing(draw_weather) && snowflake_initialized) {
-        // Get active snowflake count based on intensity
-        uint8_t intensity = weather_get_snow_intensity(draw_weather);
-        uint8_t active_flakes = (intensity == 1) ? NUM_SNOWFLAKES / 4 :
-                                (intensity == 2) ? NUM_SNOWFLAKES / 2 :
-                                NUM_SNOWFLAKES;
-
-        // Draw snowflakes
-        for (uint8_t i = 0; i < active_flakes; i++) {
-            if (snowflakes[i].y >= 0 && snowflakes[i].y < 150) {
-                snowflake_draw(&snowflakes[i]);
-            }
-        }
+        // Single batched pass over the particle pool
+        weather_snow_draw_all();
     } else if (!weather_is_snowing(draw_weather)) {
         // Not snowy weather - clean up snowflake state
         if (snowflake_initialized) {
@@ -0,0 +1,77 @@
+// Copyright 2024
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "sprite_batch.h"
+
+// Fold a painted rect into the batch's union bounds
+static void batch_grow_bounds(sprite_batch_t *batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (!batch->dirty) {
+        batch->x1    = x1;
+        batch->y1    = y1;
+        batch->x2    = x2;
+        batch->y2    = y2;
+        batch->dirty = true;
+        return;
+    }
+    if (x1 < batch->x1) batch->x1 = x1;
+    if (y1 < batch->y1) batch->y1 = y1;
+    if (x2 > batch->x2) batch->x2 = x2;
+    if (y2 > batch->y2) batch->y2 = y2;
+}
+
+void sprite_batch_begin(sprite_batch_t *batch, uint8_t hue, uint8_t sat, uint8_t val) {
+    sprite_batch_begin_color(batch, fb_hsv_to_rgb565(hue, sat, val));
+}
+
+void sprite_batch_begin_color(sprite_batch_t *batch, fb_color_t color) {
+    batch->color = color;
+    batch->dirty = false;
+}
+
+void sprite_batch_rect(sprite_batch_t *batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    // Clip to the framebuffer; paint row-major so the inner loop is a straight run
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= FB_WIDTH) x2 = FB_WIDTH - 1;
+    if (y2 >= FB_HEIGHT) y2 = FB_HEIGHT - 1;
+    if (x1 > x2 || y1 > y2) return;
+
+    for (int16_t y = y1; y <= y2; y++) {
+        fb_color_t *row = &fb.pixels[y][x1];
+        for (int16_t x = x1; x <= x2; x++) {
+            *row++ = batch->color;
+        }
+    }
+    batch_grow_bounds(batch, x1, y1, x2, y2);
+}
+
+void sprite_batch_frame(sprite_batch_t *batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    sprite_batch_rect(batch, x1, y1, x2, y1); // Top
+    sprite_batch_rect(batch, x1, y2, x2, y2); // Bottom
+    sprite_batch_rect(batch, x1, y1, x1, y2); // Left
+    sprite_batch_rect(batch, x2, y1, x2, y2); // Right
+}
+
+void sprite_batch_pixel(sprite_batch_t *batch, int16_t x, int16_t y) {
+    if (x < 0 || x >= FB_WIDTH || y < 0 || y >= FB_HEIGHT) return;
+    fb.pixels[y][x] = batch->color;
+    batch_grow_bounds(batch, x, y, x, y);
+}
+
+void sprite_batch_glyph(sprite_batch_t *batch, int16_t x, int16_t y, const uint8_t rows[5], uint8_t scale) {
+    for (uint8_t row = 0; row < 5; row++) {
+        for (uint8_t col = 0; col < 3; col++) {
+            if (rows[row] & (1 << (2 - col))) {
+                int16_t bx = x + col * scale;
+                int16_t by = y + row * scale;
+                sprite_batch_rect(batch, bx, by, bx + scale - 1, by + scale - 1);
+            }
+        }
+    }
+}
+
+void sprite_batch_flush(sprite_batch_t *batch, painter_device_t device) {
+    if (!batch->dirty) return;
+    fb_flush_region(device, batch->x1, batch->y1, batch->x2, batch->y2);
+    batch->dirty = false;
+}
@@ -0,0 +1,66 @@
+// Copyright 2024
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "display/framebuffer.h"
+
+// Sprite batching for the games.
+//
+// All game drawing targets the RAM framebuffer, so the display itself already
+// sees one SPI transaction per frame - the per-sprite cost that remains is the
+// HSV-to-RGB565 conversion, which the old code repeated for every pixel of
+// every sprite. A batch groups sprites that share a format (one color): the
+// conversion happens once in sprite_batch_begin() and every rect, pixel, and
+// glyph painted through the batch reuses it. The batch also accumulates the
+// union of everything it painted, so a caller that doesn't want a fullscreen
+// flush can push exactly the touched region in a single transaction via
+// sprite_batch_flush().
+//
+// A batch is a small stack object; re-begin it to switch formats.
+
+typedef struct {
+    fb_color_t color;            // Shared format: one RGB565 color for the whole batch
+    int16_t    x1, y1, x2, y2;   // Union of painted sprites (inclusive), valid when dirty
+    bool       dirty;            // Anything painted since begin?
+} sprite_batch_t;
+
+/**
+ * Start (or restart) a batch with an HSV format, converting it to RGB565 once
+ */
+void sprite_batch_begin(sprite_batch_t *batch, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Start (or restart) a batch with a pre-converted RGB565 color
+ */
+void sprite_batch_begin_color(sprite_batch_t *batch, fb_color_t color);
+
+/**
+ * Paint a filled rectangle (inclusive bounds, clipped to the framebuffer)
+ */
+void sprite_batch_rect(sprite_batch_t *batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Paint a 1px rectangle outline (the tetris cell bevels)
+ */
+void sprite_batch_frame(sprite_batch_t *batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Paint a single pixel
+ */
+void sprite_batch_pixel(sprite_batch_t *batch, int16_t x, int16_t y);
+
+/**
+ * Paint one 3x5 font glyph scaled by an integer factor.
+ * rows[] holds five rows of 3 bits each, MSB = leftmost column - the layout
+ * both games' draw_digit()/draw_char() fonts already use.
+ */
+void sprite_batch_glyph(sprite_batch_t *batch, int16_t x, int16_t y, const uint8_t rows[5], uint8_t scale);
+
+/**
+ * Flush the union of everything painted since begin to the display in one
+ * region transaction, then clear the batch's bounds
+ */
+void sprite_batch_flush(sprite_batch_t *batch, painter_device_t device);
@@ -0,0 +1,184 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Shared tap dances for the temanyl boards. This file is pulled into the keymap
+// introspection translation unit via INTROSPECTION_KEYMAP_C (see rules.mk), not
+// compiled on its own: tap_dance_count() takes ARRAY_SIZE(tap_dance_actions), so
+// the array has to be visible in that TU alongside keymap.c.
+
+#ifdef TAP_DANCE_ENABLE
+
+#include "temanyl.h"
+
+// Define a type for as many tap dance states as you need
+typedef enum {
+    TD_NONE,
+    TD_UNKNOWN,
+    TD_SINGLE_TAP,
+    TD_SINGLE_HOLD,
+    TD_DOUBLE_TAP
+} td_state_t;
+
+typedef struct {
+    bool is_press_action;
+    td_state_t state;
+} td_tap_t;
+
+// Determine the current tap dance state
+static td_state_t cur_dance(tap_dance_state_t *state) {
+    if (state->count == 1) {
+        if (!state->pressed) return TD_SINGLE_TAP;
+        else return TD_SINGLE_HOLD;
+    } else if (state->count == 2) return TD_DOUBLE_TAP;
+    else return TD_UNKNOWN;
+}
+
+// Initialize tap structure associated with example tap dance key
+static td_tap_t ql_tap_state = {
+    .is_press_action = true,
+    .state = TD_NONE
+};
+
+// Functions that control what our tap dance key does
+static void nav_num_finished(tap_dance_state_t *state, void *user_data) {
+    ql_tap_state.state = cur_dance(state);
+    switch (ql_tap_state.state) {
+        case TD_SINGLE_TAP:
+           // Check to see if the layer is already set
+           if (layer_state_is(_MAC_NAV)) {
+               // If already set, then switch it off
+               layer_off(_MAC_NAV);
+           } else {
+               // If not already set, then switch the layer on
+               layer_on(_MAC_NAV);
+           }
+           break;
+        case TD_SINGLE_HOLD:
+            layer_on(_MAC_NUM);
+            break;
+        case TD_DOUBLE_TAP:
+            // Check to see if the layer is already set
+            if (layer_state_is(_MAC_NUM)) {
+                // If already set, then switch it off
+                layer_off(_MAC_NUM);
+            } else {
+                // If not already set, then switch the layer on
+                layer_on(_MAC_NUM);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void nav_num_reset(tap_dance_state_t *state, void *user_data) {
+    // If the key was held down and now is released then switch off the layer
+    if (ql_tap_state.state != TD_DOUBLE_TAP) {
+        layer_off(_MAC_NUM);
+    }
+    ql_tap_state.state = TD_NONE;
+}
+
+// Functions that control what our tap dance key does
+static void layer_default_shift_finished(tap_dance_state_t *state, void *user_data) {
+    ql_tap_state.state = cur_dance(state);
+    switch (ql_tap_state.state) {
+        case TD_SINGLE_TAP:
+           layer_clear();
+           break;
+        case TD_SINGLE_HOLD:
+            register_code(KC_LSFT);
+            break;
+        default:
+            break;
+    }
+}
+
+static void layer_default_shift_reset(tap_dance_state_t *state, void *user_data) {
+    // If the key was held down and now is released then switch off the layer
+    if (ql_tap_state.state == TD_SINGLE_HOLD) {
+         unregister_code(KC_LSFT);
+    }
+    ql_tap_state.state = TD_NONE;
+}
+
+static void layer_default_shift_release(tap_dance_state_t *state, void *user_data) {
+    // This dance only distinguishes single-tap from hold, so a release before the tapping term can resolve as
+    // the tap right away instead of waiting out the term for a second tap that never matters.
+    if (!state->finished) {
+        ql_tap_state.state = TD_SINGLE_TAP;
+        layer_clear();
+        state->finished = true;
+    }
+}
+
+static void osl_code_finished(tap_dance_state_t *state, void *user_data) {
+    ql_tap_state.state = cur_dance(state);
+    switch (ql_tap_state.state) {
+        case TD_SINGLE_TAP:
+            set_oneshot_layer(_MAC_CODE, ONESHOT_START);
+            break;
+        case TD_SINGLE_HOLD:
+            layer_on(_MAC_CODE);
+            break;
+        default:
+            break;
+    }
+}
+
+static void osl_code_reset(tap_dance_state_t *state, void *user_data) {
+    ql_tap_state.state = cur_dance(state);
+    // If the key was held down and now is released then switch off the layer
+    if (ql_tap_state.state == TD_SINGLE_TAP) {
+        clear_oneshot_layer_state(ONESHOT_PRESSED);
+    } else {
+        layer_clear();
+    }
+}
+
+static void osl_code_release(tap_dance_state_t *state, void *user_data) {
+    // Tap-vs-hold only -- resolve the one-shot layer at release time rather than at the tapping term
+    if (!state->finished) {
+        ql_tap_state.state = TD_SINGLE_TAP;
+        set_oneshot_layer(_MAC_CODE, ONESHOT_START);
+        state->finished = true;
+    }
+}
+
+static void td_q_esc_emoji_reset(tap_dance_state_t *state, void *user_data) {
+    if (state->count == 1) {
+        tap_code(KC_Q);
+    } else if (state->count == 2) {
+        tap_code(KC_ESC);
+    } else if (state->count == 3) {
+        tap_code16(C(G(KC_SPC)));
+    } else if (state->count == 5) {
+        reset_keyboard();
+    }
+}
+
+// Tap Dance definitions
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_Q_ESC_EMOJI_RESET]   = ACTION_TAP_DANCE_FN(td_q_esc_emoji_reset),
+    [TD_LAYER_NAV_NUM]       = ACTION_TAP_DANCE_FN_ADVANCED(NULL, nav_num_finished, nav_num_reset),
+    // These two dances never use a second tap, so they resolve taps at release time via the release handlers;
+    // TD_LAYER_NAV_NUM has a double-tap action and has to keep waiting out the tapping term.
+    [TD_LAYER_DEFAULT_SHIFT] = ACTION_TAP_DANCE_FN_ADVANCED_WITH_RELEASE(NULL, layer_default_shift_release, layer_default_shift_finished, layer_default_shift_reset),
+    [TD_OSL_CODE]            = ACTION_TAP_DANCE_FN_ADVANCED_WITH_RELEASE(NULL, osl_code_release, osl_code_finished, osl_code_reset)
+};
+
+#endif // TAP_DANCE_ENABLE
@@ -0,0 +1,103 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "temanyl.h"
+
+#ifdef TAPPING_TERM_PER_KEY
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+#ifdef TAP_DANCE_ENABLE
+        case TD(TD_Q_ESC_EMOJI_RESET):
+        case TD(TD_ESC_WINDOWS_EMOJI):
+#endif
+        case LGUI_T(KC_SPC):
+        case LT(1, KC_TAB):
+        case LT(2, KC_ENT):
+            return 200;
+#ifdef TAP_DANCE_ENABLE
+        case TD(TD_LAYER_DEFAULT_SHIFT):
+            return 180;
+#endif
+        case LT(0,KC_SCLN):
+            return 155;
+        default:
+#ifdef DYNAMIC_TAPPING_TERM_ENABLE
+            // Runtime base term, so DT_UP/DT_DOWN and the A/B experiment harness
+            // (EXPERIMENT_TAPPING_TERM_A/_B) can vary it per boot
+            return g_tapping_term;
+#else
+            return TAPPING_TERM;
+#endif
+    }
+}
+#endif
+
+__attribute__((weak)) bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+// Initialize variable holding the binary representation of active modifiers
+uint8_t mod_state;
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    mod_state = get_mods();
+
+    // Board-specific keycodes first (games, display brightness, ...)
+    if (!process_record_keymap(keycode, record)) {
+        return false;
+    }
+
+    switch (keycode) {
+        case LT(0,KC_SCLN):
+            if (!record->tap.count && record->event.pressed) {
+                tap_code(KC_ENT);
+                return false;
+            }
+            return true;
+        case KC_BSPC:
+        {
+            // Initialize a boolean variable that keeps track
+            // of the delete key status: registered or not?
+            static bool delkey_registered;
+            if (record->event.pressed) {
+                // Detect the activation of either shift keys
+                if (mod_state & MOD_MASK_SHIFT) {
+                    // First temporarily canceling both shifts so that
+                    // shift isn't applied to the KC_DEL keycode
+                    del_mods(MOD_MASK_SHIFT);
+                    register_code(KC_DEL);
+                    // Update the boolean variable to reflect the status of KC_DEL
+                    delkey_registered = true;
+                    // Reapplying modifier state so that the held shift key(s)
+                    // still work even after having tapped the Backspace/Delete key.
+                    set_mods(mod_state);
+                    return false;
+                }
+            } else { // on release of KC_BSPC
+                // In case KC_DEL is still being sent even after the release of KC_BSPC
+                if (delkey_registered) {
+                    unregister_code(KC_DEL);
+                    delkey_registered = false;
+                    return false;
+                }
+            }
+            // Let QMK process the KC_BSPC keycode as usual outside of shift
+            return true;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,50 @@
+/*
+Copyright 2022 Joe Scotto
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Shared userspace for the temanyl boards (chocmanyl36, splitmanyl, duckymanyl,
+// fulcrum34). The tap dances, tapping terms and process_record tweaks used to be
+// copy-pasted into each keymap and had already drifted apart; they live here once
+// now. Board keymaps hook in via process_record_keymap() for their own keycodes.
+
+// Layers shared by the Colemak-DH boards. Boards with extra layers start theirs
+// at TEMANYL_LAYER_SAFE, e.g. `enum { _MAC_ARROW = TEMANYL_LAYER_SAFE };`
+enum temanyl_layers {
+    _MAC_COLEMAK_DH,
+    _MAC_CODE,
+    _MAC_NAV,
+    _MAC_NUM,
+    TEMANYL_LAYER_SAFE
+};
+
+#ifdef TAP_DANCE_ENABLE
+// Tap Dance declarations
+enum {
+    TD_Q_ESC_EMOJI_RESET,
+    TD_ESC_WINDOWS_EMOJI,
+    TD_LAYER_NAV_NUM,
+    TD_LAYER_DEFAULT_SHIFT,
+    TD_OSL_CODE
+};
+#endif
+
+// Board-specific keycode handling; runs before the shared cases. Return false to
+// swallow the event, true to fall through to the shared handling.
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record);
@@ -25,6 +25,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "objects/weather/wind.h"
 #include "objects/effects/snowflake.h"
 #include "objects/effects/snow_drift.h"
+#include "particles.h"
+#include "sprite_batch.h"
+#include "scenes/scene_graph.h"
 #include "objects/seasonal/snowman.h"
 
 // Forward declarations
@@ -316,7 +319,6 @@ void weather_rain_reset(void) {
 // SNOW SYSTEM
 // =============================================================================
 
-snowflake_t snowflakes[NUM_SNOWFLAKES];
 bool snowflake_initialized = false;
 bool snowflake_background_saved = false;
 uint32_t snowflake_animation_timer = 0;
@@ -324,47 +326,82 @@ uint32_t snowflake_animation_timer = 0;
 snowman_t snowmen[NUM_SNOWMEN];
 bool snowman_initialized = false;
 
+// Snow motion policy for the particle engine: wrap at the screen edges, fall
+// until the ground line, respawn just below the clouds
+static const particle_field_t snow_field = {
+    .wrap_x_max     = 130,
+    .kill_y         = 150,
+    .respawn_y_min  = 45,
+    .respawn_y_span = 10,
+    .respawn_x_min  = 5,
+    .respawn_x_span = 125,
+};
+
 // Get number of active snowflakes based on snow intensity
 static uint8_t get_active_snowflake_count(void) {
     uint8_t intensity = weather_get_snow_intensity(weather_transition.current_weather);
 
-    if (intensity == 1) return NUM_SNOWFLAKES / 4;      // Light snow: ~10 flakes
-    if (intensity == 2) return NUM_SNOWFLAKES / 2;      // Medium snow: ~20 flakes
-    if (intensity == 3) return NUM_SNOWFLAKES;          // Heavy snow: 40 flakes
+    if (intensity == 1) return NUM_SNOWFLAKES / 4;      // Light snow: 40 flakes
+    if (intensity == 2) return NUM_SNOWFLAKES / 2;      // Medium snow: 80 flakes
+    if (intensity == 3) return NUM_SNOWFLAKES;          // Heavy snow: 160 flakes
     return NUM_SNOWFLAKES / 2;  // Default to medium
 }
 
+// Spawn one flake scattered across the sky by its pool index
+static void snow_spawn_scattered(uint16_t i) {
+    int16_t x = 5 + (int16_t)((i * 11u + (i / 5u) * 13u) % 125u);
+    int16_t y = 45 + (int16_t)((i * 53u + 7u) % 100u);
+    particles_spawn(x, y, 0, 1);
+}
+
 // Initialize snow system
 void weather_snow_init(void) {
     if (snowflake_initialized) return;
 
-    // Get current snow intensity to determine how many flakes to initialize
+    particles_reset();
     uint8_t flakes_to_init = get_active_snowflake_count();
+    for (uint16_t i = 0; i < flakes_to_init; i++) {
+        snow_spawn_scattered(i);
+    }
 
-    // Initialize snowflake positions (only for active flakes)
-    uint16_t snow_positions[][2] = {
-        {15, 50}, {40, 70}, {65, 90}, {85, 60}, {110, 80}, {25, 100}, {55, 120}, {95, 110}, {120, 65}, {10, 45},
-        {32, 85}, {48, 105}, {72, 55}, {90, 75}, {105, 95}, {125, 115}, {18, 130}, {35, 62}, {62, 88}, {78, 108},
-        {98, 72}, {22, 95}, {47, 68}, {73, 122}, {103, 58}, {118, 87}, {28, 114}, {58, 77}, {88, 102}, {113, 71},
-        {8, 125}, {38, 83}, {68, 96}, {93, 64}, {123, 106}, {13, 79}, {43, 118}, {77, 81}, {100, 91}, {128, 99}
-    };
+    snowflake_initialized = true;
+}
 
-    // Initialize only the flakes we need based on intensity
-    for (uint8_t i = 0; i < flakes_to_init; i++) {
-        snowflakes[i].x = snow_positions[i][0];
-        snowflakes[i].y = snow_positions[i][1];
-    }
+// One scene node covers the whole particle layer; it draws every live flake in
+// a single batched pass (registered lazily on the first animate tick)
+static scene_node_t *snow_layer_node = NULL;
 
-    // Set remaining flakes off-screen (below ground) so they don't appear
-    for (uint8_t i = flakes_to_init; i < NUM_SNOWFLAKES; i++) {
-        snowflakes[i].x = 0;
-        snowflakes[i].y = 200;  // Off screen below ground
+// Draw all live snowflakes through one sprite batch: the HSV color converts
+// once for the whole set instead of once per rect
+void weather_snow_draw_all(void) {
+    const int16_t *xs, *ys;
+    uint16_t       count = particles_positions(&xs, &ys);
+
+    sprite_batch_t batch;
+    sprite_batch_begin(&batch, SNOWFLAKE_HUE, SNOWFLAKE_SAT, SNOWFLAKE_VAL);
+
+    for (uint16_t i = 0; i < count; i++) {
+        int16_t x = xs[i];
+        int16_t y = ys[i];
+        if (y < 0 || y >= 150) continue;
+
+        // Cross pattern, same shape as snowflake_draw()
+        sprite_batch_rect(&batch, x, y, x + 2, y + 2);          // Center
+        sprite_batch_rect(&batch, x - 2, y + 1, x + 4, y + 1);  // Horizontal
+        sprite_batch_rect(&batch, x + 1, y - 2, x + 1, y + 4);  // Vertical
     }
+}
 
-    snowflake_initialized = true;
+static void snow_layer_draw(const scene_node_t *node, void *ctx) {
+    (void)node;
+    (void)ctx;
+    weather_snow_draw_all();
 }
 
 // Animate snowflakes
+// Position updates only; erase/composite/flush happens in scene_graph_render().
+// The whole flake population updates as one structure-of-arrays pass and draws
+// through a single layer node
 void weather_snow_animate(void) {
     if (!snowflake_initialized || !snowflake_background_saved) {
         return;
@@ -373,54 +410,30 @@ void weather_snow_animate(void) {
     // Animation logic controlled by weather state (checked in display.c)
     // No season check needed here anymore
 
-    // Get number of active snowflakes based on intensity
-    uint8_t active_flakes = get_active_snowflake_count();
-
-    // Animate each active snowflake
-    for (uint8_t i = 0; i < active_flakes; i++) {
-        // Restore old snowflake position from background
-        int16_t bounds_x1, bounds_y1, bounds_x2, bounds_y2;
-        snowflake_get_bounds(&snowflakes[i], &bounds_x1, &bounds_y1, &bounds_x2, &bounds_y2);
-        fb_restore_from_background(bounds_x1, bounds_y1, bounds_x2, bounds_y2);
-
-        // Flush the old snowflake region to erase it from display
-        fb_flush_region(display, bounds_x1, bounds_y1, bounds_x2, bounds_y2);
-
-        // Move snowflake down by 1 pixel (slower than rain)
-        snowflakes[i].y += 1;
-
-        // Add horizontal drift based on wind
-        int8_t drift = wind_get_rain_drift();
-        snowflakes[i].x += drift;
-
-        // Wrap around screen edges instead of clamping
-        if (snowflakes[i].x < 0) {
-            snowflakes[i].x = 130;  // Wrap from left to right
-        } else if (snowflakes[i].x > 130) {
-            snowflakes[i].x = 0;    // Wrap from right to left
-        }
-
-        // Reset snowflake to top if it goes below ground (y=150)
-        if (snowflakes[i].y >= 150) {
-            // Reset to random position at top (below clouds, y=45-55)
-            snowflakes[i].y = 45 + (i * 7) % 10;
-            // Reset to pseudo-random x position based on snowflake index
-            snowflakes[i].x = 5 + ((i * 11 + (i / 5) * 13) % 125);
-            // Clamp to screen bounds
-            if (snowflakes[i].x < 0) snowflakes[i].x = 0;
-            if (snowflakes[i].x > 130) snowflakes[i].x = 130;
-        }
+    // Track the intensity: grow or trim the pool towards the target count
+    uint8_t target_flakes = get_active_snowflake_count();
+    while (particles_active() < target_flakes) {
+        snow_spawn_scattered(particles_active());
+    }
+    while (particles_active() > target_flakes) {
+        particles_kill_one();
+    }
 
-        // Draw snowflake at new position
-        if (snowflakes[i].y >= 0 && snowflakes[i].y < 150) {
-            snowflake_draw(&snowflakes[i]);
+    if (snow_layer_node == NULL) {
+        snow_layer_node = scene_node_register(SCENE_Z_PARTICLES, snow_layer_draw, NULL);
+    }
 
-            // Get new bounds for flushing
-            snowflake_get_bounds(&snowflakes[i], &bounds_x1, &bounds_y1, &bounds_x2, &bounds_y2);
+    // Wind drift applies uniformly; flakes fall 1px per tick (slower than rain)
+    particles_set_velocity_all(wind_get_rain_drift(), 1);
+    particles_update(&snow_field);
 
-            // Flush the new snowflake region to draw it on display
-            fb_flush_region(display, bounds_x1, bounds_y1, bounds_x2, bounds_y2);
-        }
+    // The layer node spans the live flakes, padded by the cross-pattern extent
+    int16_t x1, y1, x2, y2;
+    if (particles_bounds(&x1, &y1, &x2, &y2)) {
+        scene_node_move(snow_layer_node, x1 - 2, y1 - 2, x2 + 4, y2 + 4);
+        scene_node_set_visible(snow_layer_node, true);
+    } else {
+        scene_node_set_visible(snow_layer_node, false);
     }
 }
 
@@ -463,6 +476,9 @@ void weather_snow_reset(void) {
     snowflake_initialized = false;
     snowflake_background_saved = false;
     snowman_initialized = false;
+    particles_reset();
+    scene_node_release(snow_layer_node);
+    snow_layer_node = NULL;
 }
 
 // =============================================================================
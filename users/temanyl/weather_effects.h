@@ -27,7 +27,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // Weather effect counts
 #define NUM_CLOUDS 5        // Max 5 clouds
 #define NUM_RAINDROPS 50    // Max 50 raindrops
-#define NUM_SNOWFLAKES 40   // Max 40 snowflakes
+#define NUM_SNOWFLAKES 160  // Max snowflakes (pooled particle engine, see particles.h)
 #define NUM_SNOWMEN 1       // Max 1 snowman
 
 // Animation speeds
@@ -48,7 +48,8 @@ extern bool rain_background_saved;
 extern uint32_t rain_animation_timer;
 
 // External state - snow
-extern snowflake_t snowflakes[NUM_SNOWFLAKES];
+// Snowflake storage lives in the pooled particle engine (particles.c); only
+// the lifecycle flags remain shared
 extern bool snowflake_initialized;
 extern bool snowflake_background_saved;
 extern uint32_t snowflake_animation_timer;
@@ -70,6 +71,7 @@ void weather_rain_reset(void);
 // Snow system functions
 void weather_snow_init(void);
 void weather_snow_animate(void);
+void weather_snow_draw_all(void);
 void weather_snow_draw_ground_effects(void);
 void weather_snow_reset(void);
 
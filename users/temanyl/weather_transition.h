@@ -37,6 +37,11 @@ typedef enum {
 #define WEATHER_RAIN WEATHER_RAIN_MEDIUM
 #define WEATHER_SNOW WEATHER_SNOW_MEDIUM
 
+// Visual crossfade between the outgoing and incoming scene on a weather change
+// (the weather STATE still switches instantly; see fb_crossfade_begin)
+#define WEATHER_CROSSFADE_DURATION_MS 500
+#define WEATHER_CROSSFADE_STEP_MS 40   // One blended frame every 40ms (~12 steps)
+
 // Weather transition system
 typedef struct {
     weather_state_t current_weather;
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Estimate the per-key-event dispatch cost of a resolved keymap.
+
+Walks a model of the process chain in quantum/quantum.c (pre_process_record_quantum
+and process_record_quantum, in source order) against the feature defines the build
+resolved, and prints which handlers a key event traverses plus a rough cycle
+estimate for each. Table-driven stages are sized from the keymap's introspection
+arrays (util/introspection_counts.py does the counting), so the report reflects
+this keymap, not just the feature set.
+
+Two totals are printed: one for a basic typing event (keycode <= QK_MODS_MAX,
+which skips the quantum-range-only dispatchers and any un-armed transformation
+features) and one for the worst-case quantum-range event that traverses the full
+chain. The cycle weights are calibrated by hand against Cortex-M0+ codegen
+(call + weak-chain overhead ~15 cycles, a guarded skip ~3); treat them as
+relative weights for comparing configurations, not as measured latency.
+
+The chain model must be kept in sync with process_record_quantum() by hand; the
+stage list below mirrors its source order on purpose so a diff of quantum.c can
+be applied line-for-line.
+
+Usage: dispatch_cost_report.py [-D<define>[=<value>] ...] <source-or-config> ...
+Non -D arguments are scanned for `#define`s (config.h) and introspection arrays
+(keymap sources). Wired up as the `dispatch-report` build target:
+
+    make handwired/temanyl/chocmanyl36:default:dispatch-report
+"""
+import re
+import sys
+
+from introspection_counts import strip_noise, count_entries
+
+# Relative cycle weights (Cortex-M0+ flavored)
+CALL = 15          # out-of-line handler call incl. weak-chain hop and return
+GUARD = 3          # compile-time-resolved chain link that only tests a flag
+PER_LAYER = 6      # one layer-bit test in the keymap lookup loop
+LOOKUP = 12        # one keymaps[][][] read from flash
+PER_COMBO = 20     # scanning one combo's key list for the incoming keycode
+PER_TAP_DANCE = 4  # tap dance action table is indexed, cost is mostly bookkeeping
+
+
+class Stage:
+    def __init__(self, name, condition, cost, skipped_basic=False, note=''):
+        self.name = name
+        self.condition = condition  # define expression, '' = always present
+        self.cost = cost            # callable(counts) -> cycles, or int
+        self.skipped_basic = skipped_basic
+        self.note = note
+
+
+# process chain stages, in quantum.c source order. skipped_basic marks the
+# `is_basic_event ||` dispatchers; the armed-transform skips (caps word, key
+# override, auto shift) are modeled as skipped for basic events too, which is
+# the steady state while the feature is off.
+STAGES = [
+    # pre_process_record_quantum()
+    Stage('keycode lookup', '', lambda c: PER_LAYER * c['layers'] + LOOKUP,
+          note='layer scan is worst-case: all {layers} layers tested'),
+    Stage('pre_process_record_kb/user', '', CALL),
+    Stage('process_combo', 'COMBO_ENABLE', lambda c: CALL + PER_COMBO * c['combos'],
+          note='scans all {combos} combos per event'),
+    # process_record_quantum()
+    Stage('preprocess_secure', 'SECURE_ENABLE', CALL),
+    Stage('preprocess_tap_dance', 'TAP_DANCE_ENABLE', lambda c: CALL + PER_TAP_DANCE * c['tap_dances']),
+    Stage('preprocess_rgblight', 'RGBLIGHT_ENABLE', CALL),
+    Stage('update_wpm', 'WPM_ENABLE', CALL),
+    Stage('word_boundary_track', 'CAPS_WORD_ENABLE || AUTOCORRECT_ENABLE', CALL),
+    Stage('process_key_lock', 'KEY_LOCK_ENABLE', CALL),
+    Stage('process_dynamic_macro', 'DYNAMIC_MACRO_ENABLE && !DYNAMIC_MACRO_USER_CALL', CALL),
+    Stage('process_last_key + process_repeat_key', 'REPEAT_KEY_ENABLE', 2 * CALL),
+    Stage('process_clicky', 'AUDIO_ENABLE && AUDIO_CLICKY', CALL),
+    Stage('process_haptic', 'HAPTIC_ENABLE', CALL),
+    Stage('process_auto_mouse', 'POINTING_DEVICE_ENABLE && POINTING_DEVICE_AUTO_MOUSE_ENABLE', CALL),
+    Stage('process_record_kb/user', '', CALL),
+    Stage('process_record_via', 'VIA_ENABLE', CALL),
+    Stage('process_secure', 'SECURE_ENABLE', CALL),
+    Stage('process_sequencer', 'SEQUENCER_ENABLE', CALL, skipped_basic=True),
+    Stage('process_midi', 'MIDI_ENABLE && MIDI_ADVANCED', CALL, skipped_basic=True),
+    Stage('process_audio', 'AUDIO_ENABLE', CALL, skipped_basic=True),
+    Stage('process_backlight', 'BACKLIGHT_ENABLE', CALL, skipped_basic=True),
+    Stage('process_led_matrix', 'LED_MATRIX_ENABLE', CALL, skipped_basic=True),
+    Stage('process_steno', 'STENO_ENABLE', CALL, skipped_basic=True),
+    Stage('process_music', '(AUDIO_ENABLE || (MIDI_ENABLE && MIDI_BASIC)) && !NO_MUSIC_MODE', CALL),
+    Stage('process_caps_word', 'CAPS_WORD_ENABLE', CALL, skipped_basic=True,
+          note='sees basic events only while armed (or with shift-based activation)'),
+    Stage('process_key_override', 'KEY_OVERRIDE_ENABLE', CALL, skipped_basic=True,
+          note='sees basic events only while an override is armed'),
+    Stage('process_tap_dance', 'TAP_DANCE_ENABLE', lambda c: CALL + PER_TAP_DANCE * c['tap_dances'],
+          note='{tap_dances} tap dance actions'),
+    Stage('process_unicode_common', 'UNICODE_COMMON_ENABLE', CALL, skipped_basic=True),
+    Stage('process_leader', 'LEADER_ENABLE', CALL),
+    Stage('process_auto_shift', 'AUTO_SHIFT_ENABLE', CALL, skipped_basic=True,
+          note='sees basic events only while armed (always with RETRO_SHIFT)'),
+    Stage('process_dynamic_tapping_term', 'DYNAMIC_TAPPING_TERM_ENABLE', CALL, skipped_basic=True),
+    Stage('process_space_cadet', 'SPACE_CADET_ENABLE', CALL),
+    Stage('process_magic', 'MAGIC_ENABLE', CALL, skipped_basic=True),
+    Stage('process_grave_esc', 'GRAVE_ESC_ENABLE', CALL, skipped_basic=True),
+    Stage('process_underglow', 'RGBLIGHT_ENABLE || RGB_MATRIX_ENABLE', CALL, skipped_basic=True),
+    Stage('process_rgb_matrix', 'RGB_MATRIX_ENABLE', CALL, skipped_basic=True),
+    Stage('process_joystick', 'JOYSTICK_ENABLE', CALL, skipped_basic=True),
+    Stage('process_programmable_button', 'PROGRAMMABLE_BUTTON_ENABLE', CALL, skipped_basic=True),
+    Stage('process_autocorrect', 'AUTOCORRECT_ENABLE', CALL),
+    Stage('process_tri_layer', 'TRI_LAYER_ENABLE', CALL, skipped_basic=True),
+    Stage('process_default_layer', '!NO_ACTION_LAYER', CALL, skipped_basic=True),
+    Stage('process_layer_lock', 'LAYER_LOCK_ENABLE', CALL),
+    Stage('process_connection', 'CONNECTION_ENABLE', CALL, skipped_basic=True),
+    Stage('process_oneshot', '!NO_ACTION_ONESHOT', CALL),
+    Stage('process_quantum', '', CALL),
+    # post_process_record_quantum()
+    Stage('post_process_record_kb/user', '', CALL),
+]
+
+IDENT = re.compile(r'\b[A-Z_][A-Z0-9_]*\b')
+
+
+def condition_holds(expr, defines):
+    """Evaluate a define expression ('A && !B') against the resolved define set."""
+    if not expr:
+        return True
+    python_expr = IDENT.sub(lambda m: str(m.group(0) in defines), expr)
+    python_expr = python_expr.replace('&&', ' and ').replace('||', ' or ').replace('!', ' not ')
+    return bool(eval(python_expr))  # noqa: S307 -- operands are the literals substituted above
+
+
+def collect_defines(define_args, texts):
+    """Resolved define set from -D arguments plus #defines found in config sources."""
+    defines = set()
+    for arg in define_args:
+        name = arg[2:].split('=', 1)[0]
+        if name:
+            defines.add(name)
+    for text in texts:
+        for m in re.finditer(r'^\s*#\s*define\s+([A-Za-z_][A-Za-z0-9_]*)', text, re.MULTILINE):
+            defines.add(m.group(1))
+    return defines
+
+
+def stage_cost(stage, counts):
+    return stage.cost(counts) if callable(stage.cost) else stage.cost
+
+
+def main():
+    define_args = [a for a in sys.argv[1:] if a.startswith('-D')]
+    paths = [a for a in sys.argv[1:] if not a.startswith('-')]
+    if not paths:
+        print(f'Usage: {sys.argv[0]} [-D<define> ...] <source-or-config> ...', file=sys.stderr)
+        return 1
+
+    texts = []
+    for path in paths:
+        with open(path, encoding='utf-8') as f:
+            texts.append(strip_noise(f.read()))
+
+    defines = collect_defines(define_args, texts)
+    merged = '\n'.join(texts)
+    counts = {
+        'layers': count_entries(merged, 'keymaps') or 1,
+        'combos': count_entries(merged, 'key_combos') or 0,
+        'tap_dances': count_entries(merged, 'tap_dance_actions') or 0,
+    }
+
+    print('Per-event dispatch cost estimate (relative cycles, Cortex-M0+ weights)')
+    print(f"  layers: {counts['layers']}  combos: {counts['combos']}  tap dances: {counts['tap_dances']}")
+    print()
+    print(f"  {'stage':<38} {'basic':>7} {'quantum':>9}")
+
+    total_basic = 0
+    total_quantum = 0
+    handlers = 0
+    for stage in STAGES:
+        if not condition_holds(stage.condition, defines):
+            continue
+        cost = stage_cost(stage, counts)
+        basic = GUARD if stage.skipped_basic else cost
+        total_basic += basic
+        total_quantum += cost
+        handlers += 1
+        note = ('  # ' + stage.note.format(**counts)) if stage.note else ''
+        basic_str = f'({basic})' if stage.skipped_basic else f'{basic}'
+        print(f'  {stage.name:<38} {basic_str:>7} {cost:>9}{note}')
+
+    print(f"  {'-' * 56}")
+    print(f"  {'total (' + str(handlers) + ' stages traversed)':<38} {total_basic:>7} {total_quantum:>9}")
+    print()
+    print('  basic   = typing event (keycode <= QK_MODS_MAX); (n) = skipped, guard cost only')
+    print('  quantum = worst-case quantum-range event traversing the full chain')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
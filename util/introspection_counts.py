@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Count the entries in a keymap's introspection arrays.
+
+Scans the resolved keymap sources for the top-level initializers of `keymaps`,
+`key_combos` and `tap_dance_actions`, and prints one -D define per array found
+so the introspection accessors can return compile-time literals instead of
+reading a count through a function call (see KEYMAP_INTROSPECTION_CONSTANTS in
+builddefs/introspection_counts.mk).
+
+Counting is done with a brace-depth parser on comment- and string-stripped
+source, so it is robust against LAYOUT macro names and nested initializers.
+Every emitted count is cross-checked against ARRAY_SIZE() by a static assert
+in quantum/keymap_introspection.c, so a miscount fails the build rather than
+shipping a wrong constant.
+
+Usage: introspection_counts.py <keymap_source> [<keymap_source> ...]
+"""
+import re
+import sys
+
+ARRAYS = {
+    'keymaps': 'INTROSPECTION_LAYER_COUNT',
+    'key_combos': 'INTROSPECTION_COMBO_COUNT',
+    'tap_dance_actions': 'INTROSPECTION_TAP_DANCE_COUNT',
+}
+
+
+def strip_noise(text):
+    """Blank out comments and string/char literals, preserving line structure."""
+    pattern = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'', re.DOTALL)
+    return pattern.sub(lambda m: re.sub(r'[^\n]', ' ', m.group(0)), text)
+
+
+def count_entries(text, name):
+    """Count top-level entries in `name[]... = { ... }`, or None if not defined here."""
+    decl = re.search(r'\b' + name + r'\s*(?:\[[^\]]*\]\s*)+=\s*\{', text)
+    if not decl:
+        return None
+
+    depth = 1
+    entries = 0
+    has_content = False
+    for ch in text[decl.end():]:
+        if ch in '{([':
+            depth += 1
+        elif ch in '})]':
+            depth -= 1
+            if depth == 0:
+                break
+        elif depth == 1 and ch == ',':
+            entries += 1
+            has_content = False
+            continue
+        if depth >= 1 and not ch.isspace():
+            has_content = True
+    if has_content:
+        entries += 1  # no trailing comma after the last entry
+    return entries
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(f'Usage: {sys.argv[0]} <keymap_source> [<keymap_source> ...]', file=sys.stderr)
+        return 1
+
+    text = ''
+    for path in sys.argv[1:]:
+        with open(path, encoding='utf-8') as f:
+            text += strip_noise(f.read()) + '\n'
+
+    defines = []
+    for name, macro in ARRAYS.items():
+        count = count_entries(text, name)
+        if count is not None and count > 0:
+            defines.append(f'-D{macro}={count}')
+
+    print(' '.join(defines))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
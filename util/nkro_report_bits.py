@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Compute the smallest NKRO bitmap size covering a keymap's keycodes.
+
+Scans the given keymap sources for basic Keyboard/Keypad-page keycodes (by
+canonical name or alias, as listed in the keycode constants file) and prints
+the number of bitmap bytes needed to cover the highest usage referenced.
+
+Modifier usages (0xE0-0xE7) travel in the report's dedicated mods byte and
+never occupy the bitmap, so they are ignored. A floor of 13 bytes (usages
+0x00-0x67) is always applied: it covers everything SEND_STRING() and the
+default macro ASCII table can emit, plus the nav cluster, keypad and F-keys,
+regardless of what the keymap itself places on a layer.
+
+Usage: nkro_report_bits.py <keycodes.hjson> <source files...>
+"""
+import json
+import re
+import sys
+
+# Usages 0x00-0x67; see the module docstring before lowering this.
+FLOOR_BYTES = 13
+
+MODIFIER_USAGE_FIRST = 0xE0
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(f'Usage: {sys.argv[0]} <keycodes.hjson> <source files...>', file=sys.stderr)
+        return 1
+
+    with open(sys.argv[1]) as f:
+        keycodes = json.load(f)['keycodes']
+
+    usage_for_name = {}
+    for value, entry in keycodes.items():
+        usage = int(value, 16)
+        if usage >= MODIFIER_USAGE_FIRST:
+            continue
+        usage_for_name[entry['key']] = usage
+        for alias in entry.get('aliases', []):
+            usage_for_name[alias] = usage
+
+    max_usage = FLOOR_BYTES * 8 - 1
+    token_re = re.compile(r'\b[A-Z][A-Z0-9_]*\b')
+    for path in sys.argv[2:]:
+        with open(path, errors='replace') as f:
+            text = f.read()
+        for token in token_re.findall(text):
+            usage = usage_for_name.get(token)
+            if usage is not None and usage > max_usage:
+                max_usage = usage
+
+    print((max_usage + 8) // 8)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
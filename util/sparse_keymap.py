@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Generate sparse keymap tables from a keymap's dense keymaps[] initializer.
+
+Re-expands each layer's LAYOUT macro invocation through the layout definition
+in the keyboard's info.json/keyboard.json, and emits a header with a column
+bitmap per layer-row plus a packed array holding only the stored (non-KC_TRNS)
+keycodes. quantum/keymap_introspection.c includes the header after KEYMAP_C
+when KEYMAP_SPARSE is defined, so the keycode tokens are emitted verbatim and
+resolve against the keymap's own enums and macros (see
+builddefs/sparse_keymap.mk for the lookup scheme and the break-even math).
+
+Keycodes are never evaluated here -- only classified as transparent or stored
+by token spelling -- and the generated header static-asserts its layer count
+and matrix geometry against the real keymap, so a misparse fails the build
+rather than shipping wrong tables.
+
+Prints -DKEYMAP_SPARSE on success; on any parse failure it prints nothing, so
+the build falls back to the dense keymap.
+
+Usage: sparse_keymap.py <output_header> <keymap_source_or_config_json> [...]
+"""
+import json
+import os
+import re
+import sys
+
+from introspection_counts import strip_noise
+
+TRANSPARENT_TOKENS = {'KC_TRNS', 'KC_TRANSPARENT', '_______'}
+
+
+def merge_layouts(json_paths):
+    """Collect LAYOUT macro name -> [(row, col), ...] and the matrix geometry."""
+    layouts = {}
+    rows = cols = None
+    for path in json_paths:
+        with open(path, encoding='utf-8') as f:
+            config = json.load(f)
+        for name, layout in config.get('layouts', {}).items():
+            layouts[name] = [tuple(key['matrix']) for key in layout['layout']]
+        pins = config.get('matrix_pins', {})
+        if 'rows' in pins and 'cols' in pins:
+            rows, cols = len(pins['rows']), len(pins['cols'])
+    if rows is None and layouts:
+        rows = 1 + max(r for keys in layouts.values() for r, _ in keys)
+        cols = 1 + max(c for keys in layouts.values() for _, c in keys)
+    return layouts, rows, cols
+
+
+def parse_constants(text):
+    """Resolve plain enumerators and integer #defines to values, for [INDEX] = layer tags."""
+    constants = {}
+    for body in re.findall(r'\benum\b[^{;]*\{([^}]*)\}', text):
+        value = 0
+        for item in body.split(','):
+            item = item.strip()
+            if not item:
+                continue
+            name, _, expr = item.partition('=')
+            name = name.strip()
+            if expr.strip():
+                try:
+                    value = int(expr.strip(), 0)
+                except ValueError:
+                    value = None  # computed enumerator (e.g. = SAFE_RANGE); skip until the next literal
+            if value is not None:
+                constants[name] = value
+                value += 1
+    for name, expr in re.findall(r'#\s*define\s+(\w+)\s+(\d\w*)\s*$', text, re.MULTILINE):
+        try:
+            constants[name] = int(expr, 0)
+        except ValueError:
+            pass
+    return constants
+
+
+def split_top_level(text, seps=','):
+    """Split on separators at bracket depth zero."""
+    parts = []
+    depth = 0
+    start = 0
+    for pos, ch in enumerate(text):
+        if ch in '{([':
+            depth += 1
+        elif ch in '})]':
+            depth -= 1
+        elif depth == 0 and ch in seps:
+            parts.append(text[start:pos])
+            start = pos + 1
+    parts.append(text[start:])
+    return [p for p in parts if p.strip()]
+
+
+def extract_keymap_entries(text):
+    """Return the top-level entry texts of the keymaps[] initializer, or None."""
+    decl = re.search(r'\bkeymaps\s*(?:\[[^\]]*\]\s*)+=\s*\{', text)
+    if not decl:
+        return None
+    depth = 1
+    for pos in range(decl.end(), len(text)):
+        if text[pos] in '{([':
+            depth += 1
+        elif text[pos] in '})]':
+            depth -= 1
+            if depth == 0:
+                return split_top_level(text[decl.end():pos])
+    return None
+
+
+def parse_layers(entries, layouts, constants, rows, cols):
+    """Map each keymaps[] entry to a {(row, col): token} dict, in layer order."""
+    layers = {}
+    for position, entry in enumerate(entries):
+        match = re.match(r'\s*(?:\[\s*(\w+)\s*\]\s*=)?\s*(\w+)\s*\(', entry.strip())
+        if not match:
+            return None
+        tag, macro = match.group(1), match.group(2)
+        if tag is None:
+            index = position
+        elif tag in constants:
+            index = constants[tag]
+        else:
+            try:
+                index = int(tag, 0)
+            except ValueError:
+                return None
+        if macro not in layouts or index in layers:
+            return None
+        args = split_top_level(entry.strip()[match.end():].rsplit(')', 1)[0])
+        if len(args) != len(layouts[macro]):
+            return None
+        keys = {}
+        for (row, col), token in zip(layouts[macro], args):
+            if not (0 <= row < rows and 0 <= col < cols):
+                return None
+            keys[(row, col)] = ' '.join(token.split())
+        layers[index] = (tag, keys)
+    if sorted(layers) != list(range(len(layers))):
+        return None  # gap layers would be all-KC_NO in the dense keymap; not representable
+    return [layers[i] for i in range(len(layers))]
+
+
+def emit_header(out, layers, rows, cols, layer_names):
+    out.write('// This file was generated by util/sparse_keymap.py -- do not edit.\n')
+    out.write('//\n')
+    out.write('// Sparse keymap tables for KEYMAP_SPARSE (see builddefs/sparse_keymap.mk).\n')
+    out.write('// Included by quantum/keymap_introspection.c after KEYMAP_C, so the keycode\n')
+    out.write('// tokens below resolve against the keymap\'s own enums and macros.\n\n')
+    out.write(f'STATIC_ASSERT(MATRIX_ROWS == {rows} && MATRIX_COLS == {cols}, '
+              '"sparse_keymap.py scanned a different matrix geometry than the build is using");\n\n')
+    out.write(f'#define SPARSE_KEYMAP_LAYER_COUNT {len(layers)}\n\n')
+    out.write('typedef struct {\n')
+    out.write('    uint16_t bits; // column bitmap: bit n set = column n has a stored keycode\n')
+    out.write('    uint16_t base; // index of this row\'s first stored keycode in sparse_keymap_keycodes[]\n')
+    out.write('} sparse_keymap_row_t;\n\n')
+
+    row_entries = []
+    packed = []
+    base = 0
+    for layer, (_, keys) in enumerate(layers):
+        rows_out = []
+        packed.append(f'    // layer {layer}{layer_names[layer]}\n')
+        for row in range(rows):
+            bits = 0
+            stored = []
+            for col in range(cols):
+                token = keys.get((row, col))
+                if token is not None and token not in TRANSPARENT_TOKENS:
+                    bits |= 1 << col
+                    stored.append(token)
+            rows_out.append(f'{{0x{bits:04x}, {base}}}')
+            if stored:
+                packed.append('    ' + ', '.join(stored) + ',\n')
+            base += len(stored)
+        row_entries.append(f'    {{{", ".join(rows_out)}}}, // layer {layer}{layer_names[layer]}\n')
+
+    out.write('static const sparse_keymap_row_t PROGMEM sparse_keymap_rows[SPARSE_KEYMAP_LAYER_COUNT][MATRIX_ROWS] = {\n')
+    out.writelines(row_entries)
+    out.write('};\n\n')
+    out.write('static const uint16_t PROGMEM sparse_keymap_keycodes[] = {\n')
+    out.writelines(packed)
+    if base == 0:
+        out.write('    KC_NO, // every key is transparent; an empty initializer is not valid C\n')
+    out.write('};\n')
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(f'Usage: {sys.argv[0]} <output_header> <keymap_source_or_config_json> [...]', file=sys.stderr)
+        return 1
+
+    output = sys.argv[1]
+    json_paths = [p for p in sys.argv[2:] if p.endswith('.json')]
+    source_paths = [p for p in sys.argv[2:] if not p.endswith('.json')]
+
+    layouts, rows, cols = merge_layouts(json_paths)
+    if not layouts or not rows or cols > 16:
+        print('sparse_keymap: no usable layout definition (or MATRIX_COLS > 16)', file=sys.stderr)
+        return 1
+
+    text = ''
+    for path in source_paths:
+        with open(path, encoding='utf-8') as f:
+            text += strip_noise(f.read()) + '\n'
+
+    constants = parse_constants(text)
+    entries = extract_keymap_entries(text)
+    if constants is None or not entries:
+        print('sparse_keymap: could not parse the keymaps[] initializer', file=sys.stderr)
+        return 1
+
+    layers = parse_layers(entries, layouts, constants, rows, cols)
+    if layers is None:
+        print('sparse_keymap: keymaps[] layer entries did not match the layout definition', file=sys.stderr)
+        return 1
+
+    layer_names = [f' ({tag})' if tag else '' for tag, _ in layers]
+
+    os.makedirs(os.path.dirname(output) or '.', exist_ok=True)
+    with open(output, 'w', encoding='utf-8') as out:
+        emit_header(out, layers, rows, cols, layer_names)
+
+    print('-DKEYMAP_SPARSE')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
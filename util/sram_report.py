@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Per-subsystem static RAM report from a GNU ld map file.
+
+Parses the linker map emitted by the firmware link (-Wl,-Map=...), sums the
+.bss/.data/COMMON/.noinit contributions of every object file, and groups them
+into subsystems by source path. Optionally enforces per-subsystem budgets and
+exits non-zero when one is exceeded, failing the build.
+
+Usage:
+    util/sram_report.py .build/<target>.map [--budget painter=16384] ...
+"""
+import argparse
+import re
+import sys
+
+# Ordered path-substring -> subsystem rules; first match wins.
+SUBSYSTEM_RULES = [
+    ('quantum/painter', 'painter'),
+    ('quantum/audio', 'audio'),
+    ('quantum/rgb_matrix', 'rgb_matrix'),
+    ('quantum/rgblight', 'rgblight'),
+    ('quantum/process_keycode', 'process_keycode'),
+    ('quantum/', 'quantum'),
+    ('tmk_core/', 'protocol'),
+    ('drivers/', 'drivers'),
+    ('platforms/', 'platform'),
+    ('lib/chibios', 'chibios'),
+    ('lib/', 'lib'),
+    ('keymaps/', 'keymap'),
+    ('keyboards/', 'keyboard'),
+]
+
+RAM_SECTION_PREFIXES = ('.bss', '.data', 'COMMON', '.noinit')
+
+
+def classify(obj_path):
+    for substring, subsystem in SUBSYSTEM_RULES:
+        if substring in obj_path:
+            return subsystem
+    return 'other'
+
+
+def parse_map(path):
+    """Returns {subsystem: {obj_path: bytes}} for RAM sections."""
+    usage = {}
+    in_memory_map = False
+    pending_section = None
+    # Input-section records look like either
+    #   " .bss.foo       0x20001234      0x40 path/to/file.o"
+    # or, when the section name is too long for one line,
+    #   " .bss.a_very_long_symbol_name"
+    #   "                0x20001234      0x40 path/to/file.o"
+    record = re.compile(r'^ (\S+)?\s+0x[0-9a-fA-F]+\s+0x([0-9a-fA-F]+)\s+(\S.*\.(?:o|obj)\)?)\s*$')
+    name_only = re.compile(r'^ (\S+)$')
+
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not in_memory_map:
+                if line.startswith('Linker script and memory map'):
+                    in_memory_map = True
+                continue
+            m = name_only.match(line)
+            if m:
+                pending_section = m.group(1)
+                continue
+            m = record.match(line)
+            if not m:
+                pending_section = None
+                continue
+            section = m.group(1) or pending_section
+            pending_section = None
+            if section is None or not section.startswith(RAM_SECTION_PREFIXES):
+                continue
+            size = int(m.group(2), 16)
+            if size == 0:
+                continue
+            obj_path = m.group(3)
+            subsystem = classify(obj_path)
+            usage.setdefault(subsystem, {})[obj_path] = usage.get(subsystem, {}).get(obj_path, 0) + size
+    return usage
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('map_file', help='linker map file')
+    parser.add_argument('--budget', action='append', default=[], metavar='SUBSYSTEM=BYTES', help='fail if the subsystem exceeds this many bytes of static RAM (repeatable)')
+    parser.add_argument('--verbose', action='store_true', help='also list per-object contributions')
+    args = parser.parse_args()
+
+    budgets = {}
+    for spec in args.budget:
+        name, _, value = spec.partition('=')
+        if not value:
+            parser.error(f'invalid budget {spec!r}, expected SUBSYSTEM=BYTES')
+        budgets[name] = int(value, 0)
+
+    usage = parse_map(args.map_file)
+    totals = {subsystem: sum(objs.values()) for subsystem, objs in usage.items()}
+
+    print('###########################################')
+    print('# Static RAM usage by subsystem:')
+    for subsystem in sorted(totals, key=totals.get, reverse=True):
+        budget = budgets.get(subsystem)
+        note = f'  (budget {budget})' if budget is not None else ''
+        print(f'{totals[subsystem]:>8} {subsystem}{note}')
+        if args.verbose:
+            objs = usage[subsystem]
+            for obj_path in sorted(objs, key=objs.get, reverse=True):
+                print(f'         {objs[obj_path]:>8} {obj_path}')
+    print(f'{sum(totals.values()):>8} total')
+    print('###########################################')
+
+    failed = False
+    for subsystem, budget in sorted(budgets.items()):
+        used = totals.get(subsystem, 0)
+        if used > budget:
+            print(f'ERROR: subsystem {subsystem!r} uses {used} bytes of static RAM, exceeding its budget of {budget}', file=sys.stderr)
+            failed = True
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())